@@ -193,6 +193,30 @@ bf_add_config(
     SKIP_VALIDATION
 )
 
+bf_add_config(
+    CONFIG_NAME HYPERVISOR_SERIAL_ASYNC
+    CONFIG_TYPE BOOL
+    DEFAULT_VAL OFF
+    DESCRIPTION "Turns on/off buffering the microkernel's serial output in a per-PP ring that is drained off the hot path"
+    SKIP_VALIDATION
+)
+
+bf_add_config(
+    CONFIG_NAME HYPERVISOR_SERIAL_RING_SIZE
+    CONFIG_TYPE STRING
+    DEFAULT_VAL "0x1000"
+    DESCRIPTION "Defines the size in bytes of each PP's serial ring"
+    SKIP_VALIDATION
+)
+
+bf_add_config(
+    CONFIG_NAME HYPERVISOR_LOG_MASK
+    CONFIG_TYPE STRING
+    DEFAULT_VAL "0x0"
+    DESCRIPTION "Defines the initial runtime log mask of the microkernel (see BF_LOG_SUBSYSTEM_xxx)"
+    SKIP_VALIDATION
+)
+
 bf_add_config(
     CONFIG_NAME HYPERVISOR_VMEXIT_LOG_SIZE
     CONFIG_TYPE STRING
@@ -201,6 +225,38 @@ bf_add_config(
     SKIP_VALIDATION
 )
 
+bf_add_config(
+    CONFIG_NAME HYPERVISOR_SYSCALL_STATS
+    CONFIG_TYPE BOOL
+    DEFAULT_VAL OFF
+    DESCRIPTION "Turns on/off per-PP syscall statistics and latency histograms"
+    SKIP_VALIDATION
+)
+
+bf_add_config(
+    CONFIG_NAME HYPERVISOR_SYSCALL_TRACE_SIZE
+    CONFIG_TYPE STRING
+    DEFAULT_VAL "16"
+    DESCRIPTION "Defines the hypervisor's syscall trace size in # of entries"
+    SKIP_VALIDATION
+)
+
+bf_add_config(
+    CONFIG_NAME HYPERVISOR_TRACE
+    CONFIG_TYPE BOOL
+    DEFAULT_VAL OFF
+    DESCRIPTION "Turns on/off the microkernel's hot-path trace probes (read using vmmctl trace)"
+    SKIP_VALIDATION
+)
+
+bf_add_config(
+    CONFIG_NAME HYPERVISOR_TRACE_RING_SIZE
+    CONFIG_TYPE STRING
+    DEFAULT_VAL "1024"
+    DESCRIPTION "Defines the size of each PP's trace ring in # of records"
+    SKIP_VALIDATION
+)
+
 bf_add_config(
     CONFIG_NAME HYPERVISOR_MAX_ELF_FILE_SIZE
     CONFIG_TYPE STRING
@@ -233,6 +289,22 @@ bf_add_config(
     SKIP_VALIDATION
 )
 
+bf_add_config(
+    CONFIG_NAME HYPERVISOR_MAX_NUMA_NODES
+    CONFIG_TYPE STRING
+    DEFAULT_VAL "4"
+    DESCRIPTION "Defines the hypervisor's max number of NUMA nodes the page pool is split across"
+    SKIP_VALIDATION
+)
+
+bf_add_config(
+    CONFIG_NAME HYPERVISOR_BITMAP_PAGE_POOL
+    CONFIG_TYPE BOOL
+    DEFAULT_VAL OFF
+    DESCRIPTION "Turns on/off the bitmap page pool (supports contiguous runs) in place of the list page pool"
+    SKIP_VALIDATION
+)
+
 bf_add_config(
     CONFIG_NAME HYPERVISOR_MAX_VMS
     CONFIG_TYPE STRING
@@ -265,6 +337,14 @@ bf_add_config(
     SKIP_VALIDATION
 )
 
+bf_add_config(
+    CONFIG_NAME HYPERVISOR_MAX_CACHED_RPTS
+    CONFIG_TYPE STRING
+    DEFAULT_VAL "2"
+    DESCRIPTION "Defines the max number of pre-zeroed direct map RPTs an extension keeps for reuse"
+    SKIP_VALIDATION
+)
+
 bf_add_config(
     CONFIG_NAME HYPERVISOR_MK_DIRECT_MAP_ADDR
     CONFIG_TYPE STRING
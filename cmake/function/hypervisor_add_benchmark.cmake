@@ -0,0 +1,45 @@
+#
+# Copyright (C) 2020 Assured Information Security, Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+# Adds a host benchmark target. Benchmarks are built alongside the unit
+# tests, but are not added to CTest as they measure performance instead
+# of checking behavior. Use the "benchmarks" target to run all of them.
+#
+macro(hypervisor_add_benchmark NAME)
+    cmake_parse_arguments(ARG "" "" "INCLUDES;SYSTEM_INCLUDES;DEFINES" ${ARGN})
+
+    add_executable(benchmark_${NAME})
+
+    target_sources(benchmark_${NAME} PRIVATE
+        ${NAME}.cpp
+    )
+
+    target_include_directories(benchmark_${NAME} PRIVATE ${ARG_INCLUDES})
+    target_include_directories(benchmark_${NAME} SYSTEM PRIVATE ${ARG_SYSTEM_INCLUDES})
+    target_compile_definitions(benchmark_${NAME} PRIVATE ${ARG_DEFINES})
+
+    target_link_libraries(benchmark_${NAME} PRIVATE
+        bsl
+        Threads::Threads
+    )
+
+    list(APPEND HYPERVISOR_BENCHMARKS COMMAND benchmark_${NAME})
+endmacro(hypervisor_add_benchmark)
@@ -69,15 +69,25 @@ macro(hypervisor_add_cmake_args)
         -DHYPERVISOR_PAGE_SIZE=${HYPERVISOR_PAGE_SIZE}
         -DHYPERVISOR_PAGE_SHIFT=${HYPERVISOR_PAGE_SHIFT}
         -DHYPERVISOR_DEBUG_RING_SIZE=${HYPERVISOR_DEBUG_RING_SIZE}
+        -DHYPERVISOR_SERIAL_ASYNC=${HYPERVISOR_SERIAL_ASYNC}
+        -DHYPERVISOR_SERIAL_RING_SIZE=${HYPERVISOR_SERIAL_RING_SIZE}
+        -DHYPERVISOR_LOG_MASK=${HYPERVISOR_LOG_MASK}
         -DHYPERVISOR_VMEXIT_LOG_SIZE=${HYPERVISOR_VMEXIT_LOG_SIZE}
+        -DHYPERVISOR_SYSCALL_STATS=${HYPERVISOR_SYSCALL_STATS}
+        -DHYPERVISOR_SYSCALL_TRACE_SIZE=${HYPERVISOR_SYSCALL_TRACE_SIZE}
+        -DHYPERVISOR_TRACE=${HYPERVISOR_TRACE}
+        -DHYPERVISOR_TRACE_RING_SIZE=${HYPERVISOR_TRACE_RING_SIZE}
         -DHYPERVISOR_MAX_ELF_FILE_SIZE=${HYPERVISOR_MAX_ELF_FILE_SIZE}
         -DHYPERVISOR_MAX_SEGMENTS=${HYPERVISOR_MAX_SEGMENTS}
         -DHYPERVISOR_MAX_EXTENSIONS=${HYPERVISOR_MAX_EXTENSIONS}
         -DHYPERVISOR_MAX_PPS=${HYPERVISOR_MAX_PPS}
+        -DHYPERVISOR_MAX_NUMA_NODES=${HYPERVISOR_MAX_NUMA_NODES}
+        -DHYPERVISOR_BITMAP_PAGE_POOL=${HYPERVISOR_BITMAP_PAGE_POOL}
         -DHYPERVISOR_MAX_VMS=${HYPERVISOR_MAX_VMS}
         -DHYPERVISOR_MAX_VPS=${HYPERVISOR_MAX_VPS}
         -DHYPERVISOR_MAX_VSS=${HYPERVISOR_MAX_VSS}
         -DHYPERVISOR_MAX_HUGE_ALLOCS=${HYPERVISOR_MAX_HUGE_ALLOCS}
+        -DHYPERVISOR_MAX_CACHED_RPTS=${HYPERVISOR_MAX_CACHED_RPTS}
         -DHYPERVISOR_MK_DIRECT_MAP_ADDR=${HYPERVISOR_MK_DIRECT_MAP_ADDR}
         -DHYPERVISOR_MK_DIRECT_MAP_SIZE=${HYPERVISOR_MK_DIRECT_MAP_SIZE}
         -DHYPERVISOR_MK_STACK_ADDR=${HYPERVISOR_MK_STACK_ADDR}
@@ -148,11 +148,46 @@ macro(hypervisor_add_info)
         VERBATIM
     )
 
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_SERIAL_ASYNC        ${BF_COLOR_CYN}${HYPERVISOR_SERIAL_ASYNC}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_SERIAL_RING_SIZE    ${BF_COLOR_CYN}${HYPERVISOR_SERIAL_RING_SIZE}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_LOG_MASK            ${BF_COLOR_CYN}${HYPERVISOR_LOG_MASK}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
     add_custom_command(TARGET info
         COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_VMEXIT_LOG_SIZE     ${BF_COLOR_CYN}${HYPERVISOR_VMEXIT_LOG_SIZE}${BF_COLOR_RST}"
         VERBATIM
     )
 
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_SYSCALL_STATS       ${BF_COLOR_CYN}${HYPERVISOR_SYSCALL_STATS}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_SYSCALL_TRACE_SIZE  ${BF_COLOR_CYN}${HYPERVISOR_SYSCALL_TRACE_SIZE}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_TRACE               ${BF_COLOR_CYN}${HYPERVISOR_TRACE}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_TRACE_RING_SIZE     ${BF_COLOR_CYN}${HYPERVISOR_TRACE_RING_SIZE}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
     add_custom_command(TARGET info
         COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_MAX_ELF_FILE_SIZE   ${BF_COLOR_CYN}${HYPERVISOR_MAX_ELF_FILE_SIZE}${BF_COLOR_RST}"
         VERBATIM
@@ -173,6 +208,16 @@ macro(hypervisor_add_info)
         VERBATIM
     )
 
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_MAX_NUMA_NODES      ${BF_COLOR_CYN}${HYPERVISOR_MAX_NUMA_NODES}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_BITMAP_PAGE_POOL    ${BF_COLOR_CYN}${HYPERVISOR_BITMAP_PAGE_POOL}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
     add_custom_command(TARGET info
         COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_MAX_VMS             ${BF_COLOR_CYN}${HYPERVISOR_MAX_VMS}${BF_COLOR_RST}"
         VERBATIM
@@ -193,6 +238,11 @@ macro(hypervisor_add_info)
         VERBATIM
     )
 
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_MAX_CACHED_RPTS     ${BF_COLOR_CYN}${HYPERVISOR_MAX_CACHED_RPTS}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
     add_custom_command(TARGET info
         COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_MK_DIRECT_MAP_ADDR  ${BF_COLOR_CYN}${HYPERVISOR_MK_DIRECT_MAP_ADDR}${BF_COLOR_RST}"
         VERBATIM
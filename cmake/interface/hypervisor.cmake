@@ -36,15 +36,25 @@ target_compile_definitions(hypervisor INTERFACE
     HYPERVISOR_PAGE_SIZE=${HYPERVISOR_PAGE_SIZE}_umx
     HYPERVISOR_PAGE_SHIFT=${HYPERVISOR_PAGE_SHIFT}_umx
     HYPERVISOR_DEBUG_RING_SIZE=${HYPERVISOR_DEBUG_RING_SIZE}
+    HYPERVISOR_SERIAL_ASYNC=$<IF:$<BOOL:${HYPERVISOR_SERIAL_ASYNC}>,true,false>
+    HYPERVISOR_SERIAL_RING_SIZE=${HYPERVISOR_SERIAL_RING_SIZE}_umx
+    HYPERVISOR_LOG_MASK=${HYPERVISOR_LOG_MASK}_u64
     HYPERVISOR_VMEXIT_LOG_SIZE=${HYPERVISOR_VMEXIT_LOG_SIZE}_umx
+    HYPERVISOR_SYSCALL_STATS=$<IF:$<BOOL:${HYPERVISOR_SYSCALL_STATS}>,true,false>
+    HYPERVISOR_SYSCALL_TRACE_SIZE=${HYPERVISOR_SYSCALL_TRACE_SIZE}_umx
+    HYPERVISOR_TRACE=$<IF:$<BOOL:${HYPERVISOR_TRACE}>,true,false>
+    HYPERVISOR_TRACE_RING_SIZE=${HYPERVISOR_TRACE_RING_SIZE}
     HYPERVISOR_MAX_ELF_FILE_SIZE=${HYPERVISOR_MAX_ELF_FILE_SIZE}_umx
     HYPERVISOR_MAX_SEGMENTS=${HYPERVISOR_MAX_SEGMENTS}_umx
     HYPERVISOR_MAX_EXTENSIONS=${HYPERVISOR_MAX_EXTENSIONS}_umx
     HYPERVISOR_MAX_PPS=${HYPERVISOR_MAX_PPS}_umx
+    HYPERVISOR_MAX_NUMA_NODES=${HYPERVISOR_MAX_NUMA_NODES}_umx
+    HYPERVISOR_BITMAP_PAGE_POOL=$<IF:$<BOOL:${HYPERVISOR_BITMAP_PAGE_POOL}>,true,false>
     HYPERVISOR_MAX_VMS=${HYPERVISOR_MAX_VMS}_umx
     HYPERVISOR_MAX_VPS=${HYPERVISOR_MAX_VPS}_umx
     HYPERVISOR_MAX_VSS=${HYPERVISOR_MAX_VSS}_umx
     HYPERVISOR_MAX_HUGE_ALLOCS=${HYPERVISOR_MAX_HUGE_ALLOCS}_umx
+    HYPERVISOR_MAX_CACHED_RPTS=${HYPERVISOR_MAX_CACHED_RPTS}_umx
     HYPERVISOR_MK_DIRECT_MAP_ADDR=${HYPERVISOR_MK_DIRECT_MAP_ADDR}_umx
     HYPERVISOR_MK_DIRECT_MAP_SIZE=${HYPERVISOR_MK_DIRECT_MAP_SIZE}_umx
     HYPERVISOR_MK_STACK_ADDR=${HYPERVISOR_MK_STACK_ADDR}_umx
@@ -58,15 +58,25 @@ else()
 endif()
 
 hypervisor_silence(HYPERVISOR_DEBUG_RING_SIZE)
+hypervisor_silence(HYPERVISOR_SERIAL_ASYNC)
+hypervisor_silence(HYPERVISOR_SERIAL_RING_SIZE)
+hypervisor_silence(HYPERVISOR_LOG_MASK)
 hypervisor_silence(HYPERVISOR_VMEXIT_LOG_SIZE)
+hypervisor_silence(HYPERVISOR_SYSCALL_STATS)
+hypervisor_silence(HYPERVISOR_SYSCALL_TRACE_SIZE)
+hypervisor_silence(HYPERVISOR_TRACE)
+hypervisor_silence(HYPERVISOR_TRACE_RING_SIZE)
 hypervisor_silence(HYPERVISOR_MAX_ELF_FILE_SIZE)
 hypervisor_silence(HYPERVISOR_MAX_SEGMENTS)
 hypervisor_silence(HYPERVISOR_MAX_EXTENSIONS)
 hypervisor_silence(HYPERVISOR_MAX_PPS)
+hypervisor_silence(HYPERVISOR_MAX_NUMA_NODES)
+hypervisor_silence(HYPERVISOR_BITMAP_PAGE_POOL)
 hypervisor_silence(HYPERVISOR_MAX_VMS)
 hypervisor_silence(HYPERVISOR_MAX_VPS)
 hypervisor_silence(HYPERVISOR_MAX_VSS)
 hypervisor_silence(HYPERVISOR_MAX_HUGE_ALLOCS)
+hypervisor_silence(HYPERVISOR_MAX_CACHED_RPTS)
 hypervisor_silence(HYPERVISOR_MK_DIRECT_MAP_ADDR)
 hypervisor_silence(HYPERVISOR_MK_DIRECT_MAP_SIZE)
 hypervisor_silence(HYPERVISOR_MK_STACK_ADDR)
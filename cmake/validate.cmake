@@ -37,10 +37,22 @@ if(HYPERVISOR_DEBUG_RING_SIZE LESS 0x1000)
     message(FATAL_ERROR "HYPERVISOR_DEBUG_RING_SIZE must be at least a page")
 endif()
 
+if(HYPERVISOR_SERIAL_RING_SIZE LESS 0x100)
+    message(FATAL_ERROR "HYPERVISOR_SERIAL_RING_SIZE must be at least 0x100")
+endif()
+
 if(HYPERVISOR_VMEXIT_LOG_SIZE LESS 1)
     message(FATAL_ERROR "HYPERVISOR_VMEXIT_LOG_SIZE must be at least 1")
 endif()
 
+if(HYPERVISOR_SYSCALL_TRACE_SIZE LESS 1)
+    message(FATAL_ERROR "HYPERVISOR_SYSCALL_TRACE_SIZE must be at least 1")
+endif()
+
+if(HYPERVISOR_TRACE_RING_SIZE LESS 1)
+    message(FATAL_ERROR "HYPERVISOR_TRACE_RING_SIZE must be at least 1")
+endif()
+
 if(HYPERVISOR_MAX_SEGMENTS LESS 2)
     message(FATAL_ERROR "HYPERVISOR_MAX_SEGMENTS must be at least 2")
 endif()
@@ -53,6 +65,10 @@ if(HYPERVISOR_MAX_PPS LESS 1)
     message(FATAL_ERROR "HYPERVISOR_MAX_PPS must be at least 1")
 endif()
 
+if(HYPERVISOR_MAX_NUMA_NODES LESS 1)
+    message(FATAL_ERROR "HYPERVISOR_MAX_NUMA_NODES must be at least 1")
+endif()
+
 if(HYPERVISOR_MAX_VMS LESS 1)
     message(FATAL_ERROR "HYPERVISOR_MAX_VMS must be at least 1")
 endif()
@@ -65,6 +81,10 @@ if(HYPERVISOR_MAX_VSS LESS HYPERVISOR_MAX_VPS)
     message(FATAL_ERROR "HYPERVISOR_MAX_VSS the same or greater as HYPERVISOR_MAX_VPS")
 endif()
 
+if(HYPERVISOR_MAX_CACHED_RPTS LESS 1)
+    message(FATAL_ERROR "HYPERVISOR_MAX_CACHED_RPTS must be at least 1")
+endif()
+
 if(HYPERVISOR_MK_STACK_SIZE LESS 0x1000)
     message(FATAL_ERROR "HYPERVISOR_MK_STACK_SIZE must be at least a page")
 endif()
@@ -47,10 +47,18 @@ if(NOT EXISTS ${CMAKE_BINARY_DIR}/include/constants.h)
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_PAGE_SHIFT ((uint64_t)(${HYPERVISOR_PAGE_SHIFT}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_DEBUG_RING_SIZE ((uint64_t)(${HYPERVISOR_DEBUG_RING_SIZE}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_VMEXIT_LOG_SIZE ((uint64_t)(${HYPERVISOR_VMEXIT_LOG_SIZE}))\n")
+    file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_SYSCALL_TRACE_SIZE ((uint64_t)(${HYPERVISOR_SYSCALL_TRACE_SIZE}))\n")
+    if(HYPERVISOR_TRACE)
+        file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_TRACE ((uint64_t)(1))\n")
+    else()
+        file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_TRACE ((uint64_t)(0))\n")
+    endif()
+    file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_TRACE_RING_SIZE ((uint64_t)(${HYPERVISOR_TRACE_RING_SIZE}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_MAX_ELF_FILE_SIZE ((uint64_t)(${HYPERVISOR_MAX_ELF_FILE_SIZE}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_MAX_SEGMENTS ((uint64_t)(${HYPERVISOR_MAX_SEGMENTS}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_MAX_EXTENSIONS ((uint64_t)(${HYPERVISOR_MAX_EXTENSIONS}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_MAX_PPS ((uint64_t)(${HYPERVISOR_MAX_PPS}))\n")
+    file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_MAX_NUMA_NODES ((uint64_t)(${HYPERVISOR_MAX_NUMA_NODES}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_MAX_VMS ((uint64_t)(${HYPERVISOR_MAX_VMS}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_MAX_VPS ((uint64_t)(${HYPERVISOR_MAX_VPS}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_MAX_VSS ((uint64_t)(${HYPERVISOR_MAX_VSS}))\n")
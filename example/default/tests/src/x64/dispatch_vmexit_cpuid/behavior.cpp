@@ -120,6 +120,39 @@ namespace example
             };
         };
 
+        bsl::ut_scenario{"dump syscall stats command"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                syscall::bf_syscall_t mut_sys{};
+                constexpr auto online_pps{0x2_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_sys.bf_tls_set_rax(bsl::to_u64(loader::CPUID_COMMAND_EAX));
+                    mut_sys.bf_tls_set_rcx(
+                        bsl::to_u64(loader::CPUID_COMMAND_ECX_DUMP_SYSCALL_STATS));
+                    mut_sys.bf_tls_set_online_pps(online_pps);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(dispatch_vmexit_cpuid({}, {}, mut_sys, {}, {}));
+                        bsl::ut_check(mut_sys.bf_tls_rax().is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"set log mask command"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                syscall::bf_syscall_t mut_sys{};
+                constexpr auto mask{0x1230_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_sys.bf_tls_set_rax(bsl::to_u64(loader::CPUID_COMMAND_EAX));
+                    mut_sys.bf_tls_set_rbx(mask);
+                    mut_sys.bf_tls_set_rcx(bsl::to_u64(loader::CPUID_COMMAND_ECX_SET_LOG_MASK));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(dispatch_vmexit_cpuid({}, {}, mut_sys, {}, {}));
+                        bsl::ut_check(mut_sys.bf_tls_rax().is_zero());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"unknown command"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 syscall::bf_syscall_t mut_sys{};
@@ -26,6 +26,8 @@ const CPUID_COMMAND_EAX: u32 = 0x400000FF;
 const CPUID_COMMAND_ECX_STOP: u32 = 0xBF000000;
 const CPUID_COMMAND_ECX_REPORT_ON: u32 = 0xBF000001;
 const CPUID_COMMAND_ECX_REPORT_OFF: u32 = 0xBF000002;
+const CPUID_COMMAND_ECX_DUMP_SYSCALL_STATS: u32 = 0xBF000003;
+const CPUID_COMMAND_ECX_SET_LOG_MASK: u32 = 0xBF000004;
 
 const CPUID_COMMAND_RAX_SUCCESS: u32 = 0x0;
 const CPUID_COMMAND_RAX_FAILURE: u32 = 0x1;
@@ -158,6 +160,33 @@ pub fn dispatch_vmexit_cpuid(
                 return sys.bf_vs_op_advance_ip_and_run_current();
             }
 
+            CPUID_COMMAND_ECX_DUMP_SYSCALL_STATS => {
+                // NOTE:
+                // - Ask the microkernel to dump the syscall stats
+                //   for this specific PP.
+                //
+
+                syscall::bf_debug_op_dump_syscall_stats(syscall::BfSyscallT::bf_tls_ppid());
+
+                syscall::BfSyscallT::bf_tls_set_rax(bsl::to_u64(CPUID_COMMAND_RAX_SUCCESS));
+                return sys.bf_vs_op_advance_ip_and_run_current();
+            }
+
+            CPUID_COMMAND_ECX_SET_LOG_MASK => {
+                // NOTE:
+                // - Ask the microkernel to change its runtime log
+                //   mask. The mask is global, so this only needs to
+                //   be done on one PP.
+                //
+
+                syscall::bf_debug_op_set_log_mask(bsl::to_u64(bsl::to_u32_unsafe(
+                    syscall::BfSyscallT::bf_tls_rbx(),
+                )));
+
+                syscall::BfSyscallT::bf_tls_set_rax(bsl::to_u64(CPUID_COMMAND_RAX_SUCCESS));
+                return sys.bf_vs_op_advance_ip_and_run_current();
+            }
+
             _ => {
                 error!("unsupported cpuid command {:#018x}\n{}", rcx, bsl::here());
             }
@@ -39,8 +39,6 @@ namespace mk
 {
     /// @brief defines the size of the reserved1 field in the tls_t
     constexpr auto TLS_T_RESERVED1_SIZE{0x020_umx};
-    /// @brief defines the size of the reserved2 field in the tls_t
-    constexpr auto TLS_T_RESERVED2_SIZE{0x008_umx};
     /// @brief defines the size of the reserved3 field in the tls_t
     constexpr auto TLS_T_RESERVED3_SIZE{0x007_umx};
     /// @brief defines the size of the reserved4 field in the tls_t
@@ -326,8 +324,12 @@ namespace mk
 
         /// @brief reserved (0x358)
         bsl::uintmx reserved_padding2;
-        /// @brief reserved (0x360)
-        bsl::uintmx reserved_padding3;
+        /// @brief stores the NUMA node this PP belongs to (0x360)
+        bsl::uint16 numa_node;
+        /// @brief reserved (0x362)
+        bsl::uint16 reserved_padding3;
+        /// @brief reserved (0x364)
+        bsl::uint32 reserved_padding4;
 
         /// @brief stores whether or not the first launch succeeded (0x368)
         bsl::uintmx first_launch_succeeded;
@@ -335,8 +337,8 @@ namespace mk
         /// @brief stores the currently active root page table (0x370)
         void *active_rpt;
 
-        /// @brief reserve the rest of the TLS block for later use.
-        bsl::array<bsl::uint8, TLS_T_RESERVED2_SIZE.get()> reserved2;
+        /// @brief stores this PP's cached copy of the runtime log mask (0x378)
+        bsl::uint64 log_mask;
     };
 
     /// @brief make sure the tls_t is the size of a page
@@ -0,0 +1,65 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef LOG_ENABLED_HPP
+#define LOG_ENABLED_HPP
+
+#include <bf_constants.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Returns true if messages of the provided level should be
+    ///     logged for the provided subsystem given a PP's cached log mask.
+    ///     Log sites are expected to pass the log mask cached in the
+    ///     current TLS block, which means that a disabled message costs a
+    ///     single, predictable branch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mask the log mask to check (usually tls_t.log_mask)
+    ///   @param subsystem the subsystem the message belongs to (i.e.,
+    ///     one of syscall::BF_LOG_SUBSYSTEM_xxx)
+    ///   @param level the level of the message (i.e., one of
+    ///     syscall::BF_LOG_LEVEL_V, VV or VVV)
+    ///   @return Returns true if the message should be logged, false
+    ///     otherwise.
+    ///
+    [[nodiscard]] constexpr auto
+    log_enabled(
+        bsl::uint64 const mask,
+        bsl::safe_u64 const &subsystem,
+        bsl::safe_u64 const &level) noexcept -> bool
+    {
+        auto const bits{(bsl::to_u64(mask) >> subsystem).checked()};
+        auto const enabled{(bits & syscall::BF_LOG_LEVEL_MASK).checked()};
+        return bsl::unlikely(enabled >= level);
+    }
+}
+
+#endif
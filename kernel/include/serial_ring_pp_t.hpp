@@ -0,0 +1,56 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef SERIAL_RING_PP_T
+#define SERIAL_RING_PP_T
+
+#include <bsl/array.hpp>
+#include <bsl/char_type.hpp>
+#include <bsl/convert.hpp>    // IWYU pragma: keep
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Stores the serial output of a single PP that has not yet
+    ///     been written to the serial device. The head and tail are free
+    ///     running counters, meaning the number of bytes in the ring is
+    ///     always head - tail.
+    ///
+    struct serial_ring_pp_t final
+    {
+        /// @brief stores the bytes that have not yet been written
+        bsl::array<bsl::char_type, HYPERVISOR_SERIAL_RING_SIZE.get()> buf;
+        /// @brief stores the total number of bytes added to the ring
+        bsl::safe_umx head;
+        /// @brief stores the total number of bytes written to the device
+        bsl::safe_umx tail;
+        /// @brief stores the total number of bytes dropped as the ring was full
+        bsl::safe_u64 dropped;
+        /// @brief stores the number of dropped bytes already reported
+        bsl::safe_u64 reported;
+    };
+}
+
+#endif
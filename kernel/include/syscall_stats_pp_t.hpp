@@ -0,0 +1,84 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef SYSCALL_STATS_PP_T
+#define SYSCALL_STATS_PP_T
+
+#include <syscall_stats_record_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>    // IWYU pragma: keep
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// @brief defines the max number of syscall opcodes that are tracked
+    constexpr auto SYSCALL_STATS_MAX_OPCODES{0x10_umx};
+    /// @brief defines the max number of syscall indexes tracked per opcode
+    constexpr auto SYSCALL_STATS_MAX_INDEXES{0x10_umx};
+    /// @brief defines the number of log2 latency buckets tracked per opcode
+    constexpr auto SYSCALL_STATS_MAX_BUCKETS{0x20_umx};
+
+    /// <!-- description -->
+    ///   @brief Stores the counters associated with a single syscall
+    ///     (i.e., a single opcode/index pair).
+    ///
+    struct syscall_stats_counter_t final
+    {
+        /// @brief stores the number of times the syscall was dispatched
+        bsl::safe_u64 count;
+        /// @brief stores the number of times the syscall failed
+        bsl::safe_u64 fails;
+        /// @brief stores the total number of ticks spent in the syscall
+        bsl::safe_u64 total;
+        /// @brief stores the max number of ticks spent in the syscall
+        bsl::safe_u64 max;
+    };
+
+    /// <!-- description -->
+    ///   @brief Stores information about each syscall per PP
+    ///
+    struct syscall_stats_pp_t final
+    {
+        /// @brief stores the counters for each opcode/index pair
+        bsl::array<
+            bsl::array<syscall_stats_counter_t, SYSCALL_STATS_MAX_INDEXES.get()>,
+            SYSCALL_STATS_MAX_OPCODES.get()>
+            counters;
+        /// @brief stores the log2 latency histogram for each opcode
+        bsl::array<
+            bsl::array<bsl::safe_u64, SYSCALL_STATS_MAX_BUCKETS.get()>,
+            SYSCALL_STATS_MAX_OPCODES.get()>
+            hists;
+        /// @brief stores the syscall trace
+        bsl::array<syscall_stats_record_t, HYPERVISOR_SYSCALL_TRACE_SIZE.get()> trace;
+        /// @brief stores the syscall trace circular cursor
+        bsl::safe_idx crsr;
+        /// @brief stores the index of the trace record that is in flight
+        bsl::safe_idx active;
+    };
+}
+
+#endif
@@ -0,0 +1,50 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef SYSCALL_STATS_RECORD_T
+#define SYSCALL_STATS_RECORD_T
+
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Stores information about each syscall that is traced
+    ///
+    struct syscall_stats_record_t final
+    {
+        /// @brief stores the syscall (i.e., the value of RAX)
+        bsl::safe_u64 syscall;
+        /// @brief stores the first input register of the syscall
+        bsl::safe_u64 reg0;
+        /// @brief stores the TSC when the syscall was dispatched
+        bsl::safe_u64 tsc;
+        /// @brief stores the number of ticks the syscall took
+        bsl::safe_u64 ticks;
+        /// @brief stores the bf_status_t the syscall returned
+        bsl::safe_u64 status;
+    };
+}
+
+#endif
@@ -50,8 +50,8 @@ namespace lib
         bsl::uint64 a : static_cast<bsl::uint64>(1);
         /// @brief defines the "dirty" field in the page (ignored)
         bsl::uint64 ignored1 : static_cast<bsl::uint64>(1);
-        /// @brief defines the "page size" field in the page (must be 0)
-        bsl::uint64 mbz1 : static_cast<bsl::uint64>(1);
+        /// @brief defines the "page size" field in the page
+        bsl::uint64 ps : static_cast<bsl::uint64>(1);
         /// @brief defines the "global" field in the page (must be 0)
         bsl::uint64 ignored2 : static_cast<bsl::uint64>(1);
         /// @brief defines our "auto_release" field in the page
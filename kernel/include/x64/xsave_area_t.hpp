@@ -0,0 +1,91 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef XSAVE_AREA_T_HPP
+#define XSAVE_AREA_T_HPP
+
+#include <bsl/array.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace mk
+{
+    /// @brief defines the size of the x87/SSE register portion of the legacy region
+    constexpr auto XSAVE_AREA_T_LEGACY_REGS_SIZE{0x1E0_umx};
+    /// @brief defines the size of the reserved portion of the XSAVE header
+    constexpr auto XSAVE_AREA_T_HEADER_RESERVED_SIZE{0x30_umx};
+    /// @brief defines the size of the extended region of the XSAVE area
+    constexpr auto XSAVE_AREA_T_EXTENDED_SIZE{0xDC0_umx};
+
+    /// <!-- description -->
+    ///   @brief Stores the extended processor state (x87, SSE, AVX, etc.)
+    ///     of a VS using the standard (non-compacted) XSAVE format. Only
+    ///     the fields of the legacy region and the XSAVE header that the
+    ///     microkernel needs to initialize are broken out. The rest of the
+    ///     area is owned by XSAVEOPT/XRSTOR. Note that this structure must
+    ///     be 64 byte aligned, which is why it is allocated as a page.
+    ///
+    struct xsave_area_t final
+    {
+        /// @brief stores the x87 FPU control word (0x000)
+        bsl::uint16 fcw;
+        /// @brief stores the x87 FPU status word (0x002)
+        bsl::uint16 fsw;
+        /// @brief stores the abridged x87 FPU tag word (0x004)
+        bsl::uint8 ftw;
+        /// @brief reserved (0x005)
+        bsl::uint8 reserved1;
+        /// @brief stores the x87 FPU opcode (0x006)
+        bsl::uint16 fop;
+        /// @brief stores the x87 FPU instruction pointer (0x008)
+        bsl::uint64 fip;
+        /// @brief stores the x87 FPU data pointer (0x010)
+        bsl::uint64 fdp;
+        /// @brief stores the value of MXCSR (0x018)
+        bsl::uint32 mxcsr;
+        /// @brief stores the value of MXCSR_MASK (0x01C)
+        bsl::uint32 mxcsr_mask;
+        /// @brief stores the x87 and SSE registers (0x020)
+        bsl::array<bsl::uint8, XSAVE_AREA_T_LEGACY_REGS_SIZE.get()> legacy_regs;
+
+        /// @brief stores the XSTATE_BV field of the XSAVE header (0x200)
+        bsl::uint64 xstate_bv;
+        /// @brief stores the XCOMP_BV field of the XSAVE header (0x208)
+        bsl::uint64 xcomp_bv;
+        /// @brief reserved (0x210)
+        bsl::array<bsl::uint8, XSAVE_AREA_T_HEADER_RESERVED_SIZE.get()> reserved2;
+
+        /// @brief stores the extended state components (0x240)
+        bsl::array<bsl::uint8, XSAVE_AREA_T_EXTENDED_SIZE.get()> extended;
+    };
+
+    /// @brief sanity check
+    static_assert(sizeof(xsave_area_t) == HYPERVISOR_PAGE_SIZE);
+}
+
+#pragma pack(pop)
+
+#endif
@@ -27,11 +27,13 @@ hypervisor_add_integration_target(bf_callback_op_register_vmexit)
 hypervisor_add_integration_target(bf_debug_op_dump_ext)
 hypervisor_add_integration_target(bf_debug_op_dump_huge_pool)
 hypervisor_add_integration_target(bf_debug_op_dump_page_pool)
+hypervisor_add_integration_target(bf_debug_op_dump_syscall_stats)
 hypervisor_add_integration_target(bf_debug_op_dump_vm)
 hypervisor_add_integration_target(bf_debug_op_dump_vmexit_log)
 hypervisor_add_integration_target(bf_debug_op_dump_vp)
 hypervisor_add_integration_target(bf_debug_op_dump_vs)
 hypervisor_add_integration_target(bf_debug_op_out)
+hypervisor_add_integration_target(bf_debug_op_set_log_mask)
 hypervisor_add_integration_target(bf_debug_op_write_c)
 hypervisor_add_integration_target(bf_debug_op_write_str)
 hypervisor_add_integration_target(bf_handle_op_close_handle)
@@ -53,6 +55,7 @@ hypervisor_add_integration_target(bf_vs_op_advance_ip_and_run_current)
 hypervisor_add_integration_target(bf_vs_op_advance_ip_and_run)
 hypervisor_add_integration_target(bf_vs_op_advance_ip_and_set_active)
 hypervisor_add_integration_target(bf_vs_op_clear)
+hypervisor_add_integration_target(bf_vs_op_drain_posted_events)
 hypervisor_add_integration_target(bf_vs_op_init_as_root)
 hypervisor_add_integration_target(bf_vs_op_migrate)
 hypervisor_add_integration_target(bf_vs_op_promote)
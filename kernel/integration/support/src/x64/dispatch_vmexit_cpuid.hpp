@@ -162,6 +162,36 @@ namespace syscall
                     return mut_sys.bf_vs_op_advance_ip_and_run_current();
                 }
 
+                case loader::CPUID_COMMAND_ECX_DUMP_SYSCALL_STATS.get(): {
+
+                    /// NOTE:
+                    /// - Ask the microkernel to dump the syscall stats
+                    ///   for this specific PP. If the microkernel was
+                    ///   not compiled with HYPERVISOR_SYSCALL_STATS
+                    ///   enabled, it will simply say so.
+                    ///
+
+                    bf_debug_op_dump_syscall_stats(mut_sys.bf_tls_ppid());
+
+                    mut_sys.bf_tls_set_rax(loader::CPUID_COMMAND_RAX_SUCCESS);
+                    return mut_sys.bf_vs_op_advance_ip_and_run_current();
+                }
+
+                case loader::CPUID_COMMAND_ECX_SET_LOG_MASK.get(): {
+
+                    /// NOTE:
+                    /// - Ask the microkernel to change its runtime log
+                    ///   mask. The mask is global, so this only needs to
+                    ///   be done on one PP.
+                    ///
+
+                    bf_debug_op_set_log_mask(
+                        bsl::to_u64(bsl::to_u32_unsafe(mut_sys.bf_tls_rbx())));
+
+                    mut_sys.bf_tls_set_rax(loader::CPUID_COMMAND_RAX_SUCCESS);
+                    return mut_sys.bf_vs_op_advance_ip_and_run_current();
+                }
+
                 default: {
                     bsl::error() << "unsupported cpuid command "    // --
                                  << bsl::hex(mut_rcx)               // --
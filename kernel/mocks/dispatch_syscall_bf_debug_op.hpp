@@ -31,6 +31,7 @@
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
+#include <syscall_stats_t.hpp>
 #include <tls_t.hpp>
 #include <vm_pool_t.hpp>
 #include <vmexit_log_t.hpp>
@@ -58,6 +59,7 @@ namespace mk
     ///   @param vs_pool the vs_pool_t to use
     ///   @param ext_pool the ext_pool_t to use
     ///   @param log the VMExit log to use
+    ///   @param stats the syscall stats to use
     ///   @return Returns a bf_status_t containing success or failure
     ///
     [[nodiscard]] constexpr auto
@@ -70,7 +72,8 @@ namespace mk
         vp_pool_t const &vp_pool,
         vs_pool_t const &vs_pool,
         ext_pool_t const &ext_pool,
-        vmexit_log_t const &log) noexcept -> syscall::bf_status_t
+        vmexit_log_t const &log,
+        syscall_stats_t const &stats) noexcept -> syscall::bf_status_t
     {
         bsl::discard(page_pool);
         bsl::discard(huge_pool);
@@ -80,6 +83,7 @@ namespace mk
         bsl::discard(vs_pool);
         bsl::discard(ext_pool);
         bsl::discard(log);
+        bsl::discard(stats);
 
         if (SYSCALL_BF_DEBUG_OP_FAILS == tls.test_ret) {
             return syscall::BF_STATUS_FAILURE_UNKNOWN;
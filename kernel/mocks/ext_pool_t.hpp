@@ -60,6 +60,8 @@ namespace mk
         ///   @param huge_pool the huge_pool_t to use
         ///   @param system_rpt the system RPT provided by the loader
         ///   @param elf_files the ext_elf_files provided by the loader
+        ///   @param elf_files_phys the ext_elf_files_phys provided by the
+        ///     loader (optional)
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     and friends otherwise
         ///
@@ -69,12 +71,14 @@ namespace mk
             page_pool_t const &page_pool,
             huge_pool_t const &huge_pool,
             root_page_table_t const &system_rpt,
-            loader::ext_elf_files_t const &elf_files) noexcept -> bsl::errc_type
+            loader::ext_elf_files_t const &elf_files,
+            loader::ext_elf_files_phys_t const &elf_files_phys = {}) noexcept -> bsl::errc_type
         {
             bsl::discard(page_pool);
             bsl::discard(huge_pool);
             bsl::discard(system_rpt);
             bsl::discard(elf_files);
+            bsl::discard(elf_files_phys);
 
             if (UNIT_TEST_EXT_POOL_FAIL_INITIALIZE == tls.test_ret) {
                 return UNIT_TEST_EXT_POOL_FAIL_INITIALIZE;
@@ -140,6 +144,36 @@ namespace mk
             bsl::discard(vmid);
         }
 
+        /// <!-- description -->
+        ///   @brief Tells each extension to reclaim a single batch of the
+        ///     memory that is still owned by destroyed VMs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///
+        static constexpr void
+        reclaim(tls_t const &tls, page_pool_t const &page_pool) noexcept
+        {
+            bsl::discard(tls);
+            bsl::discard(page_pool);
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells each extension to flush this PP's TLB if memory
+        ///     it freed might still be cached in it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///
+        static constexpr void
+        flush_tlb(tls_t const &tls, intrinsic_t const &intrinsic) noexcept
+        {
+            bsl::discard(tls);
+            bsl::discard(intrinsic);
+        }
+
         /// <!-- description -->
         ///   @brief Tells the extensions that the requested VM was set to
         ///     active and therefore it's memory map should change on this PP.
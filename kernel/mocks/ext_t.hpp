@@ -41,6 +41,7 @@
 #include <bsl/errc_type.hpp>
 #include <bsl/expects.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
 #include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
@@ -113,6 +114,10 @@ namespace mk
         bsl::safe_u64 m_vmexit_ip{};
         /// @brief stores the fail IP registered by the extension
         bsl::safe_u64 m_fail_ip{};
+        /// @brief stores the tick IP registered by the extension
+        bsl::safe_u64 m_tick_ip{};
+        /// @brief stores the tick period (in TSC ticks) registered by the extension
+        bsl::safe_u64 m_tick_period{};
 
     public:
         /// <!-- description -->
@@ -124,6 +129,8 @@ namespace mk
         ///   @param i the ID for this ext_t
         ///   @param file the ELF file for this ext_t
         ///   @param system_rpt the system RPT provided by the loader
+        ///   @param file_phys the physical address of each page of file. If
+        ///     empty, every segment is copied instead of being shared.
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     and friends otherwise
         ///
@@ -133,7 +140,8 @@ namespace mk
             page_pool_t const &page_pool,
             bsl::safe_u16 const &i,
             loader::ext_elf_file_t const *const file,
-            root_page_table_t const &system_rpt) noexcept -> bsl::errc_type
+            root_page_table_t const &system_rpt,
+            bsl::span<bsl::uint64 const> const &file_phys = {}) noexcept -> bsl::errc_type
         {
             bsl::expects(i.is_valid_and_checked());
             bsl::expects(i != syscall::BF_INVALID_ID);
@@ -141,6 +149,7 @@ namespace mk
             bsl::discard(file);
             bsl::discard(page_pool);
             bsl::discard(system_rpt);
+            bsl::discard(file_phys);
 
             m_id = ~i;
             m_handle = syscall::BF_INVALID_HANDLE;
@@ -163,6 +172,8 @@ namespace mk
             bsl::discard(page_pool);
             bsl::discard(huge_pool);
 
+            m_tick_period = {};
+            m_tick_ip = {};
             m_fail_ip = {};
             m_vmexit_ip = {};
             m_bootstrap_ip = {};
@@ -279,6 +290,65 @@ namespace mk
             m_fail_ip = ip;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the tick IP for this extension.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the tick IP for this extension.
+        ///
+        [[nodiscard]] constexpr auto
+        tick_ip() const noexcept -> bsl::safe_u64 const &
+        {
+            bsl::ensures(m_tick_ip.is_valid_and_checked());
+            return m_tick_ip;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the tick IP for this extension. This should
+        ///     be called by the syscall dispatcher as the result of a
+        ///     syscall from the extension defining what IP the extension
+        ///     would like to use for ticks.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ip the tick IP to use
+        ///
+        constexpr void
+        set_tick_ip(bsl::safe_u64 const &ip) noexcept
+        {
+            bsl::expects(ip.is_valid_and_checked());
+            bsl::expects(ip.is_pos());
+
+            m_tick_ip = ip;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of TSC ticks between each tick.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of TSC ticks between each tick.
+        ///
+        [[nodiscard]] constexpr auto
+        tick_period() const noexcept -> bsl::safe_u64 const &
+        {
+            bsl::ensures(m_tick_period.is_valid_and_checked());
+            return m_tick_period;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the number of TSC ticks between each tick.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param period the number of TSC ticks between each tick
+        ///
+        constexpr void
+        set_tick_period(bsl::safe_u64 const &period) noexcept
+        {
+            bsl::expects(period.is_valid_and_checked());
+            bsl::expects(period.is_pos());
+
+            m_tick_period = period;
+        }
+
         /// <!-- description -->
         ///   @brief Opens a handle and returns the resulting handle
         ///
@@ -408,6 +478,63 @@ namespace mk
             return {tls.test_virt, tls.test_phys};
         }
 
+        /// <!-- description -->
+        ///   @brief Frees a page previously allocated with alloc_page().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param page_virt the virtual address of the page to free
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] static constexpr auto
+        free_page(
+            tls_t const &tls,
+            page_pool_t const &page_pool,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u64 const &page_virt) noexcept -> bsl::errc_type
+        {
+            bsl::expects(page_virt.is_valid_and_checked());
+            bsl::expects(page_virt.is_pos());
+
+            bsl::discard(page_pool);
+            bsl::discard(intrinsic);
+
+            return tls.test_ret;
+        }
+
+        /// <!-- description -->
+        ///   @brief Frees memory previously allocated with alloc_huge().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param huge_pool the huge_pool_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param huge_virt the virtual address returned by alloc_huge()
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] static constexpr auto
+        free_huge(
+            tls_t const &tls,
+            page_pool_t const &page_pool,
+            huge_pool_t const &huge_pool,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u64 const &huge_virt) noexcept -> bsl::errc_type
+        {
+            bsl::expects(huge_virt.is_valid_and_checked());
+            bsl::expects(huge_virt.is_pos());
+
+            bsl::discard(page_pool);
+            bsl::discard(huge_pool);
+            bsl::discard(intrinsic);
+
+            return tls.test_ret;
+        }
+
         /// <!-- description -->
         ///   @brief Maps a page into the direct map portion of the requested
         ///     VM's direct map RPT given a physical address to map.
@@ -415,6 +542,7 @@ namespace mk
         /// <!-- inputs/outputs -->
         ///   @param tls the current TLS block
         ///   @param page_pool the page_pool_t to use
+        ///   @param intrinsic the intrinsic_t to use
         ///   @param vmid the ID of the VM to map page_phys to
         ///   @param page_phys the physical address to map
         ///   @return Returns the virtual address the physical address was
@@ -425,10 +553,12 @@ namespace mk
         map_page_direct(
             tls_t const &tls,
             page_pool_t const &page_pool,
+            intrinsic_t const &intrinsic,
             bsl::safe_u16 const &vmid,
             bsl::safe_u64 const &page_phys) noexcept -> bsl::safe_u64
         {
             bsl::discard(page_pool);
+            bsl::discard(intrinsic);
             bsl::discard(vmid);
             bsl::discard(page_phys);
 
@@ -464,6 +594,73 @@ namespace mk
             return tls.test_ret;
         }
 
+        /// <!-- description -->
+        ///   @brief Maps a physically contiguous range into the direct map
+        ///     portion of the requested VM's direct map RPT using 2M and 1G
+        ///     pages wherever the alignment of the range allows.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param vmid the ID of the VM to map the range to
+        ///   @param phys the physical address of the start of the range
+        ///   @param bytes the total number of bytes to map
+        ///   @return Returns the virtual address the start of the range was
+        ///     mapped to in the direct map. On failure returns
+        ///     bsl::safe_u64::failure().
+        ///
+        [[nodiscard]] static constexpr auto
+        map_range_direct(
+            tls_t const &tls,
+            page_pool_t const &page_pool,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u64 const &phys,
+            bsl::safe_u64 const &bytes) noexcept -> bsl::safe_u64
+        {
+            bsl::discard(page_pool);
+            bsl::discard(intrinsic);
+            bsl::discard(vmid);
+            bsl::discard(phys);
+            bsl::discard(bytes);
+
+            return tls.test_virt;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps a range previously mapped using map_range_direct()
+        ///     from the direct map portion of the requested VM's direct
+        ///     map RPT.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param vmid the ID of the VM to unmap the range from
+        ///   @param virt the virtual address of the start of the range
+        ///   @param bytes the total number of bytes to unmap
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] static constexpr auto
+        unmap_range_direct(
+            tls_t const &tls,
+            page_pool_t const &page_pool,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u64 const &virt,
+            bsl::safe_u64 const &bytes) noexcept -> bsl::errc_type
+        {
+            bsl::discard(page_pool);
+            bsl::discard(intrinsic);
+            bsl::discard(vmid);
+            bsl::discard(virt);
+            bsl::discard(bytes);
+
+            return tls.test_ret;
+        }
+
         /// <!-- description -->
         ///   @brief Tells the extension that a VM was created so that it
         ///     can initialize it's VM specific resources.
@@ -504,6 +701,36 @@ namespace mk
             bsl::discard(vmid);
         }
 
+        /// <!-- description -->
+        ///   @brief Reclaims a single batch of the memory owned by the
+        ///     direct map RPTs of destroyed VMs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///
+        static constexpr void
+        reclaim(tls_t const &tls, page_pool_t const &page_pool) noexcept
+        {
+            bsl::discard(tls);
+            bsl::discard(page_pool);
+        }
+
+        /// <!-- description -->
+        ///   @brief Flushes this PP's TLB if memory freed by the extension
+        ///     might still be cached in it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///
+        static constexpr void
+        flush_tlb(tls_t const &tls, intrinsic_t const &intrinsic) noexcept
+        {
+            bsl::discard(tls);
+            bsl::discard(intrinsic);
+        }
+
         /// <!-- description -->
         ///   @brief Tells the extension that the requested VM was set to
         ///     active and therefore it's memory map should change on this PP.
@@ -590,6 +817,22 @@ namespace mk
             return tls.test_ret;
         }
 
+        /// <!-- description -->
+        ///   @brief Executes the extension's tick entry point.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] static constexpr auto
+        tick(tls_t const &tls, intrinsic_t const &intrinsic) noexcept -> bsl::errc_type
+        {
+            bsl::discard(intrinsic);
+            return tls.test_ret;
+        }
+
         /// <!-- description -->
         ///   @brief Bootstraps the extension by executing it's bootstrap entry
         ///     point. If the extension has not been initialized, this function
@@ -38,6 +38,9 @@ namespace mk
     ///
     class intrinsic_t final
     {
+        /// @brief stores the return value of is_page_1g_supported
+        bool m_page_1g_supported{true};
+
     public:
         /// <!-- description -->
         ///   @brief Invalidates TLB entries given an address.
@@ -53,6 +56,32 @@ namespace mk
             bsl::expects(ignored.is_zero());
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if this PP supports 1G pages (i.e., an
+        ///     l2e_t can point to a block). Returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if this PP supports 1G pages. Returns
+        ///     false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        is_page_1g_supported() const noexcept -> bool
+        {
+            return m_page_1g_supported;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the return value of is_page_1g_supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to return from is_page_1g_supported
+        ///
+        constexpr void
+        set_page_1g_supported(bool const val) noexcept
+        {
+            m_page_1g_supported = val;
+        }
+
         /// <!-- description -->
         ///   @brief Sets the value of CR3
         ///
@@ -76,6 +105,18 @@ namespace mk
         {
             bsl::discard(val);
         }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of the TSC (time stamp counter)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of the TSC (time stamp counter)
+        ///
+        [[nodiscard]] static constexpr auto
+        rdtsc() noexcept -> bsl::safe_u64
+        {
+            return {};
+        }
     };    // GRCOV_EXCLUDE
 }
 
@@ -0,0 +1,65 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MOCKS_LOG_MASK_HPP
+#define MOCKS_LOG_MASK_HPP
+
+#include <tls_t.hpp>
+
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Sets the runtime log mask. The current PP uses the new
+    ///     log mask right away, while all other PPs pick it up on their
+    ///     next call to refresh_log_mask().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mask the new log mask
+    ///
+    constexpr void
+    set_log_mask(tls_t &mut_tls, bsl::safe_u64 const &mask) noexcept
+    {
+        mut_tls.log_mask = mask.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Updates the current PP's cached copy of the runtime log
+    ///     mask. This is done once per VMExit, so that the log sites
+    ///     themselves only ever have to read the current TLS block.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the current TLS block
+    ///
+    constexpr void
+    refresh_log_mask(tls_t const &tls) noexcept
+    {
+        bsl::discard(tls);
+    }
+}
+
+#endif
@@ -0,0 +1,79 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MOCKS_POSTED_EVENTS_HPP
+#define MOCKS_POSTED_EVENTS_HPP
+
+#include <bf_constants.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Posts an event to the current PP's posted events mask.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the current TLS block
+    ///   @param event the BF_POSTED_EVENT bit to post
+    ///
+    constexpr void
+    post_event(tls_t const &tls, bsl::safe_u64 const &event) noexcept
+    {
+        bsl::discard(tls);
+        bsl::discard(event);
+    }
+
+    /// <!-- description -->
+    ///   @brief Drains the current PP's posted events mask, returning a
+    ///     mask of every event that was drained.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the current TLS block
+    ///   @return Always returns BF_POSTED_EVENT_NMI
+    ///
+    [[nodiscard]] constexpr auto
+    drain_posted_events(tls_t const &tls) noexcept -> bsl::safe_u64
+    {
+        bsl::discard(tls);
+        return syscall::BF_POSTED_EVENT_NMI;
+    }
+
+    /// <!-- description -->
+    ///   @brief Discards any events left in the current PP's posted events
+    ///     mask.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the current TLS block
+    ///
+    constexpr void
+    discard_posted_events(tls_t const &tls) noexcept
+    {
+        bsl::discard(tls);
+    }
+}
+
+#endif
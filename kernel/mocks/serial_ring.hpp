@@ -0,0 +1,61 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MOCKS_SERIAL_RING_HPP
+#define MOCKS_SERIAL_RING_HPP
+
+#include <tls_t.hpp>
+
+#include <bsl/discard.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Writes as much of the current PP's serial ring to the
+    ///     serial port as it can take without waiting.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the current TLS block
+    ///
+    constexpr void
+    serial_ring_drain(tls_t const &tls) noexcept
+    {
+        bsl::discard(tls);
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes all of the current PP's serial ring to the serial
+    ///     port, waiting on the serial port as needed.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the current TLS block
+    ///
+    constexpr void
+    serial_ring_flush(tls_t const &tls) noexcept
+    {
+        bsl::discard(tls);
+    }
+}
+
+#endif
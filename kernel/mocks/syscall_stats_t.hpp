@@ -0,0 +1,102 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MOCKS_SYSCALL_STATS_T_HPP
+#define MOCKS_SYSCALL_STATS_T_HPP
+
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Stores per-PP syscall statistics. For each syscall, the
+    ///     number of calls, the number of failures and the number of ticks
+    ///     (as reported by the TSC) spent in the microkernel are recorded,
+    ///     together with a log2 latency histogram for each opcode and a
+    ///     small trace of the most recent syscalls. Note that syscalls that
+    ///     never return to dispatch_syscall (e.g., bf_vs_op_run or
+    ///     bf_control_op_exit) are counted and traced, but not timed.
+    ///
+    class syscall_stats_t final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Records the start of a syscall. This counts the
+        ///     syscall and adds it to the trace.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP the syscall was executed on
+        ///   @param syscall the syscall that was executed (i.e., RAX)
+        ///   @param reg0 the first argument of the syscall
+        ///   @param tsc the TSC when the syscall was dispatched
+        ///
+        static constexpr void
+        begin(
+            bsl::safe_u16 const &ppid,
+            bsl::safe_u64 const &syscall,
+            bsl::safe_u64 const &reg0,
+            bsl::safe_u64 const &tsc) noexcept
+        {
+            bsl::discard(ppid);
+            bsl::discard(syscall);
+            bsl::discard(reg0);
+            bsl::discard(tsc);
+        }
+
+        /// <!-- description -->
+        ///   @brief Records the end of the syscall that was last started
+        ///     on the provided PP using begin().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP the syscall was executed on
+        ///   @param status the status returned by the syscall
+        ///   @param tsc the TSC when the syscall completed
+        ///
+        static constexpr void
+        end(
+            bsl::safe_u16 const &ppid,
+            bsl::safe_u64 const &status,
+            bsl::safe_u64 const &tsc) noexcept
+        {
+            bsl::discard(ppid);
+            bsl::discard(status);
+            bsl::discard(tsc);
+        }
+
+        /// <!-- description -->
+        ///   @brief Dumps the syscall stats for the requested PP
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP whose stats should be dumped
+        ///
+        static constexpr void
+        dump(bsl::safe_u16 const &ppid) noexcept
+        {
+            bsl::discard(ppid);
+        }
+    };
+}
+
+#endif
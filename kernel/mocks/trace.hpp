@@ -0,0 +1,68 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MOCKS_TRACE_HPP
+#define MOCKS_TRACE_HPP
+
+#include <tls_t.hpp>
+#include <trace_ring_t.hpp>
+
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Stores the trace ring the loader provided for a PP. A
+    ///     nullptr turns tracing off for that PP.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ppid the ID of the PP the trace ring belongs to
+    ///   @param pmut_ring the trace ring to use for this PP
+    ///
+    constexpr void
+    trace_set_ring(bsl::safe_u16 const &ppid, loader::trace_ring_t *const pmut_ring) noexcept
+    {
+        bsl::discard(ppid);
+        bsl::discard(pmut_ring);
+    }
+
+    /// <!-- description -->
+    ///   @brief Records that the current PP hit a probe, along with the
+    ///     current TSC. If HYPERVISOR_TRACE is disabled, this compiles to
+    ///     nothing.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the current TLS block
+    ///   @param probe the id of the probe (see loader::TRACE_PROBE_xxx)
+    ///
+    constexpr void
+    trace(tls_t const &tls, bsl::safe_u16 const &probe) noexcept
+    {
+        bsl::discard(tls);
+        bsl::discard(probe);
+    }
+}
+
+#endif
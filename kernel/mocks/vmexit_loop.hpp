@@ -25,7 +25,9 @@
 #ifndef MOCKS_VMEXIT_LOOP_HPP
 #define MOCKS_VMEXIT_LOOP_HPP
 
+#include <ext_pool_t.hpp>
 #include <intrinsic_t.hpp>
+#include <page_pool_t.hpp>
 #include <tls_t.hpp>
 #include <vmexit_log_t.hpp>
 #include <vs_pool_t.hpp>
@@ -41,8 +43,10 @@ namespace mk
     ///
     /// <!-- inputs/outputs -->
     ///   @param tls the current TLS block
+    ///   @param page_pool the page_pool_t to use
     ///   @param intrinsic the intrinsic_t to use
     ///   @param vs_pool the VPS pool to use
+    ///   @param ext_pool the ext_pool_t to use
     ///   @param log the VMExit log to use
     ///   @return Returns bsl::errc_success on success, bsl::errc_failure
     ///     otherwise
@@ -50,13 +54,17 @@ namespace mk
     [[nodiscard]] constexpr auto
     vmexit_loop(
         tls_t const &tls,
+        page_pool_t const &page_pool,
         intrinsic_t const &intrinsic,
         vs_pool_t const &vs_pool,
+        ext_pool_t const &ext_pool,
         vmexit_log_t const &log) noexcept -> bsl::errc_type
     {
         bsl::discard(tls);
+        bsl::discard(page_pool);
         bsl::discard(intrinsic);
         bsl::discard(vs_pool);
+        bsl::discard(ext_pool);
         bsl::discard(log);
 
         return bsl::errc_success;
@@ -493,6 +493,22 @@ namespace mk
             return {};
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if the provided exit reason was generated
+        ///     by the timer used to deliver ticks. Returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param exit_reason the exit reason to query
+        ///   @return Returns true if the provided exit reason was generated
+        ///     by the timer used to deliver ticks. Returns false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_tick_exit(bsl::safe_umx const &exit_reason) noexcept -> bool
+        {
+            bsl::discard(exit_reason);
+            return false;
+        }
+
         /// <!-- description -->
         ///   @brief Advance the IP of the vs_t
         ///
@@ -69,6 +69,49 @@ namespace mk
             bsl::expects(asid.is_pos());
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the max ASID that can be given to a guest on
+        ///     this PP. ASID 0 is reserved for the host, so this is the
+        ///     number of ASIDs reported by CPUID minus 1, capped to the
+        ///     max value of a 16 bit ASID.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max ASID that can be given to a guest
+        ///
+        [[nodiscard]] static constexpr auto
+        max_asid() noexcept -> bsl::safe_u16
+        {
+            constexpr auto max{0x7FFF_u16};
+            return max;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the XSAVE features this PP supports (i.e.,
+        ///     CPUID.(EAX=0Dh,ECX=0):EDX:EAX).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the XSAVE features this PP supports.
+        ///
+        [[nodiscard]] static constexpr auto
+        supported_xcr0() noexcept -> bsl::safe_u64
+        {
+            return 0x0000000000000007_u64;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if this PP supports 1G pages (i.e., an
+        ///     l2e_t can point to a block). Returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if this PP supports 1G pages. Returns
+        ///     false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_page_1g_supported() noexcept -> bool
+        {
+            return true;
+        }
+
         /// <!-- description -->
         ///   @brief Sets the value of CR3
         ///
@@ -93,6 +136,50 @@ namespace mk
             bsl::discard(val);
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the value of the TSC (time stamp counter)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of the TSC (time stamp counter)
+        ///
+        [[nodiscard]] static constexpr auto
+        rdtsc() noexcept -> bsl::safe_u64
+        {
+            return {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Saves the extended processor state (FPU/SSE/AVX, etc.)
+        ///     selected by rfbm into the provided XSAVE area using
+        ///     XSAVEOPT. The area must be 64 byte aligned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_area the XSAVE area to save the state to
+        ///   @param rfbm the requested-feature bitmap to save
+        ///
+        static constexpr void
+        xsave(void *const pmut_area, bsl::safe_u64 const &rfbm) noexcept
+        {
+            bsl::discard(pmut_area);
+            bsl::discard(rfbm);
+        }
+
+        /// <!-- description -->
+        ///   @brief Restores the extended processor state (FPU/SSE/AVX,
+        ///     etc.) selected by rfbm from the provided XSAVE area using
+        ///     XRSTOR. The area must be 64 byte aligned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param area the XSAVE area to restore the state from
+        ///   @param rfbm the requested-feature bitmap to restore
+        ///
+        static constexpr void
+        xrstor(void const *const area, bsl::safe_u64 const &rfbm) noexcept
+        {
+            bsl::discard(area);
+            bsl::discard(rfbm);
+        }
+
         /// <!-- description -->
         ///   @brief Returns the value of a requested TLS register
         ///
@@ -81,6 +81,15 @@ namespace mk
             bsl::expects(vpid.is_valid_and_checked());
         }
 
+        /// <!-- description -->
+        ///   @brief Invalidates every TLB entry on this PP that is
+        ///     associated with a non-zero VPID. This is used when the
+        ///     VPIDs handed out on this PP roll over to a new generation.
+        ///
+        static constexpr void
+        tlb_flush_all_vpids() noexcept
+        {}
+
         /// <!-- description -->
         ///   @brief Returns the value of ES
         ///
@@ -201,6 +210,33 @@ namespace mk
             return {};
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the XSAVE features this PP supports (i.e.,
+        ///     CPUID.(EAX=0Dh,ECX=0):EDX:EAX).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the XSAVE features this PP supports.
+        ///
+        [[nodiscard]] static constexpr auto
+        supported_xcr0() noexcept -> bsl::safe_u64
+        {
+            return 0x0000000000000007_u64;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if this PP supports 1G pages (i.e., an
+        ///     l2e_t can point to a block). Returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if this PP supports 1G pages. Returns
+        ///     false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_page_1g_supported() noexcept -> bool
+        {
+            return true;
+        }
+
         /// <!-- description -->
         ///   @brief Sets the value of CR3
         ///
@@ -225,6 +261,50 @@ namespace mk
             bsl::discard(val);
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the value of the TSC (time stamp counter)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of the TSC (time stamp counter)
+        ///
+        [[nodiscard]] static constexpr auto
+        rdtsc() noexcept -> bsl::safe_u64
+        {
+            return {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Saves the extended processor state (FPU/SSE/AVX, etc.)
+        ///     selected by rfbm into the provided XSAVE area using
+        ///     XSAVEOPT. The area must be 64 byte aligned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_area the XSAVE area to save the state to
+        ///   @param rfbm the requested-feature bitmap to save
+        ///
+        static constexpr void
+        xsave(void *const pmut_area, bsl::safe_u64 const &rfbm) noexcept
+        {
+            bsl::discard(pmut_area);
+            bsl::discard(rfbm);
+        }
+
+        /// <!-- description -->
+        ///   @brief Restores the extended processor state (FPU/SSE/AVX,
+        ///     etc.) selected by rfbm from the provided XSAVE area using
+        ///     XRSTOR. The area must be 64 byte aligned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param area the XSAVE area to restore the state from
+        ///   @param rfbm the requested-feature bitmap to restore
+        ///
+        static constexpr void
+        xrstor(void const *const area, bsl::safe_u64 const &rfbm) noexcept
+        {
+            bsl::discard(area);
+            bsl::discard(rfbm);
+        }
+
         /// <!-- description -->
         ///   @brief Returns the value of a requested TLS register
         ///
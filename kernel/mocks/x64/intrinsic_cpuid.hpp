@@ -0,0 +1,63 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MOCKS_INTRINSIC_CPUID_HPP
+#define MOCKS_INTRINSIC_CPUID_HPP
+
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// @brief defines the value of EBX that the mocked CPUID returns
+    constexpr auto MOCK_CPUID_EBX{0x8000_u64};
+    /// @brief defines the value of EDX that the mocked CPUID returns
+    constexpr auto MOCK_CPUID_EDX{0x04000000_u64};
+
+    /// <!-- description -->
+    ///   @brief Implements intrinsic_t::cpuid
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_rax n/a
+    ///   @param pmut_rbx n/a
+    ///   @param pmut_rcx n/a
+    ///   @param pmut_rdx n/a
+    ///
+    constexpr void
+    intrinsic_cpuid(
+        bsl::uint64 *const pmut_rax,
+        bsl::uint64 *const pmut_rbx,
+        bsl::uint64 *const pmut_rcx,
+        bsl::uint64 *const pmut_rdx) noexcept
+    {
+        bsl::discard(pmut_rax);
+        bsl::discard(pmut_rcx);
+
+        *pmut_rbx = MOCK_CPUID_EBX.get();
+        *pmut_rdx = MOCK_CPUID_EDX.get();
+    }
+}
+
+#endif
@@ -69,6 +69,20 @@ namespace mk
             bsl::expects(asid.is_pos());
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if this PP supports 1G pages (i.e., an
+        ///     l2e_t can point to a block). Returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if this PP supports 1G pages. Returns
+        ///     false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_page_1g_supported() noexcept -> bool
+        {
+            return true;
+        }
+
         /// <!-- description -->
         ///   @brief Sets the value of CR3
         ///
@@ -93,6 +107,18 @@ namespace mk
             bsl::discard(val);
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the value of the TSC (time stamp counter)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of the TSC (time stamp counter)
+        ///
+        [[nodiscard]] static constexpr auto
+        rdtsc() noexcept -> bsl::safe_u64
+        {
+            return {};
+        }
+
         /// <!-- description -->
         ///   @brief Returns the value of a requested TLS register
         ///
@@ -26,8 +26,7 @@
 #define BSL_CSTDIO_HPP
 
 #include <debug_ring_write.hpp>
-#include <serial_write.hpp>
-#include <serial_write_c.hpp>
+#include <serial_ring_write.hpp>
 #include <serial_write_hex.hpp>
 
 #include <bsl/char_type.hpp>
@@ -58,7 +57,7 @@ namespace bsl
         }
 
         mk::debug_ring_write(*g_pmut_mut_debug_ring, c);
-        mk::serial_write_c(c);
+        mk::serial_ring_write_c(c);
     }
 
     /// <!-- description -->
@@ -76,7 +75,7 @@ namespace bsl
         }
 
         mk::debug_ring_write(*g_pmut_mut_debug_ring, str, len);
-        mk::serial_write(str, len);
+        mk::serial_ring_write(str, len);
     }
 }
 
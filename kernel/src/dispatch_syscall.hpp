@@ -41,13 +41,18 @@
 #include <ext_pool_t.hpp>
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
+#include <log_enabled.hpp>
 #include <page_pool_t.hpp>
+#include <syscall_stats_t.hpp>
 #include <tls_t.hpp>
+#include <trace.hpp>
+#include <trace_record_t.hpp>
 #include <vm_pool_t.hpp>
 #include <vmexit_log_t.hpp>
 #include <vp_pool_t.hpp>
 #include <vs_pool_t.hpp>
 
+#include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/expects.hpp>
 #include <bsl/safe_integral.hpp>
@@ -56,8 +61,8 @@
 namespace mk
 {
     /// <!-- description -->
-    ///   @brief Provides the main entry point for all syscalls. This function
-    ///     will dispatch syscalls as needed.
+    ///   @brief Dispatches a syscall to the handler associated with the
+    ///     syscall's opcode.
     ///
     /// <!-- inputs/outputs -->
     ///   @param mut_tls the current TLS block
@@ -69,10 +74,11 @@ namespace mk
     ///   @param mut_vs_pool the vs_pool_t to use
     ///   @param mut_ext_pool the ext_pool_t to use
     ///   @param mut_log the VMExit log to use
+    ///   @param stats the syscall stats to use
     ///   @return Returns a bf_status_t containing success or failure
     ///
     [[nodiscard]] constexpr auto
-    dispatch_syscall(
+    dispatch_syscall_opcode(
         tls_t &mut_tls,
         page_pool_t &mut_page_pool,
         huge_pool_t &mut_huge_pool,
@@ -81,10 +87,9 @@ namespace mk
         vp_pool_t &mut_vp_pool,
         vs_pool_t &mut_vs_pool,
         ext_pool_t &mut_ext_pool,
-        vmexit_log_t &mut_log) noexcept -> syscall::bf_status_t
+        vmexit_log_t &mut_log,
+        syscall_stats_t const &stats) noexcept -> syscall::bf_status_t
     {
-        bsl::expects(nullptr != mut_tls.ext);
-
         switch (syscall::bf_syscall_opcode(mut_tls.ext_syscall).get()) {
             case syscall::BF_DEBUG_OP_VAL.get(): {
                 auto const ret{dispatch_syscall_bf_debug_op(
@@ -96,7 +101,8 @@ namespace mk
                     mut_vp_pool,
                     mut_vs_pool,
                     mut_ext_pool,
-                    mut_log)};
+                    mut_log,
+                    stats)};
 
                 if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
                     bsl::print<bsl::V>() << bsl::here();
@@ -124,7 +130,8 @@ namespace mk
             }
 
             case syscall::BF_MEM_OP_VAL.get(): {
-                auto const ret{dispatch_syscall_bf_mem_op(mut_tls, mut_page_pool, mut_huge_pool)};
+                auto const ret{dispatch_syscall_bf_mem_op(
+                    mut_tls, mut_page_pool, mut_huge_pool, mut_intrinsic)};
                 if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return ret;
@@ -208,6 +215,98 @@ namespace mk
 
         return report_syscall_unknown_unsupported(mut_tls);
     }
+
+    /// <!-- description -->
+    ///   @brief Provides the main entry point for all syscalls. This function
+    ///     will dispatch syscalls as needed. If HYPERVISOR_SYSCALL_STATS is
+    ///     enabled, each syscall is also counted, traced and timed.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_page_pool the page_pool_t to use
+    ///   @param mut_huge_pool the huge pool to use
+    ///   @param mut_intrinsic the intrinsic_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vp_pool the vp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param mut_ext_pool the ext_pool_t to use
+    ///   @param mut_log the VMExit log to use
+    ///   @param mut_stats the syscall stats to use
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    dispatch_syscall(
+        tls_t &mut_tls,
+        page_pool_t &mut_page_pool,
+        huge_pool_t &mut_huge_pool,
+        intrinsic_t &mut_intrinsic,
+        vm_pool_t &mut_vm_pool,
+        vp_pool_t &mut_vp_pool,
+        vs_pool_t &mut_vs_pool,
+        ext_pool_t &mut_ext_pool,
+        vmexit_log_t &mut_log,
+        syscall_stats_t &mut_stats) noexcept -> syscall::bf_status_t
+    {
+        bsl::expects(nullptr != mut_tls.ext);
+        trace(mut_tls, loader::TRACE_PROBE_SYSCALL);
+
+        if (log_enabled(
+                mut_tls.log_mask, syscall::BF_LOG_SUBSYSTEM_SYSCALL, syscall::BF_LOG_LEVEL_VV)) {
+            bsl::print() << bsl::ylw << "syscall "                                    // --
+                         << bsl::rst << bsl::hex(bsl::to_u64(mut_tls.ext_syscall))    // --
+                         << bsl::ylw << " reg0 "                                      // --
+                         << bsl::rst << bsl::hex(bsl::to_u64(mut_tls.ext_reg0))       // --
+                         << bsl::ylw << " reg1 "                                      // --
+                         << bsl::rst << bsl::hex(bsl::to_u64(mut_tls.ext_reg1))       // --
+                         << bsl::ylw << " on pp "                                     // --
+                         << bsl::rst << bsl::hex(bsl::to_u16(mut_tls.ppid))           // --
+                         << bsl::endl;                                                // --
+        }
+
+        if constexpr (HYPERVISOR_SYSCALL_STATS) {
+            mut_stats.begin(
+                bsl::to_u16(mut_tls.ppid),
+                bsl::to_u64(mut_tls.ext_syscall),
+                bsl::to_u64(mut_tls.ext_reg0),
+                mut_intrinsic.rdtsc());
+        }
+
+        auto const ret{dispatch_syscall_opcode(
+            mut_tls,
+            mut_page_pool,
+            mut_huge_pool,
+            mut_intrinsic,
+            mut_vm_pool,
+            mut_vp_pool,
+            mut_vs_pool,
+            mut_ext_pool,
+            mut_log,
+            mut_stats)};
+
+        if constexpr (HYPERVISOR_SYSCALL_STATS) {
+            mut_stats.end(bsl::to_u16(mut_tls.ppid), ret, mut_intrinsic.rdtsc());
+        }
+
+        trace(mut_tls, loader::TRACE_PROBE_SYSCALL_RET);
+
+        if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+            if (log_enabled(
+                    mut_tls.log_mask, syscall::BF_LOG_SUBSYSTEM_SYSCALL, syscall::BF_LOG_LEVEL_V)) {
+                bsl::print() << bsl::red << "syscall "                                    // --
+                             << bsl::rst << bsl::hex(bsl::to_u64(mut_tls.ext_syscall))    // --
+                             << bsl::red << " failed with "                               // --
+                             << bsl::rst << bsl::hex(ret)                                 // --
+                             << bsl::red << " on pp "                                     // --
+                             << bsl::rst << bsl::hex(bsl::to_u16(mut_tls.ppid))           // --
+                             << bsl::endl;                                                // --
+            }
+
+            bsl::print<bsl::V>() << bsl::here();
+            return ret;
+        }
+
+        return ret;
+    }
 }
 
 #endif
@@ -32,6 +32,7 @@
 #include <ext_t.hpp>
 #include <tls_t.hpp>
 
+#include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/unlikely.hpp>
@@ -123,6 +124,54 @@ namespace mk
         return syscall::BF_STATUS_SUCCESS;
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the bf_callback_op_register_tick syscall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    syscall_bf_callback_op_register_tick(tls_t &mut_tls) noexcept -> syscall::bf_status_t
+    {
+        auto const callback{get_callback(mut_tls.ext_reg1)};
+        if (bsl::unlikely(callback.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG1;
+        }
+
+        auto const period{bsl::to_u64(mut_tls.ext_reg2)};
+        if (bsl::unlikely(period.is_zero())) {
+            bsl::error() << "the tick period cannot be 0\n" << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG2;
+        }
+
+        /// NOTE:
+        /// - The tick handler has to resume the VS that was running when
+        ///   the tick fired, which only the extension that registered for
+        ///   VMExits is allowed to do.
+        ///
+
+        if (bsl::unlikely(!is_the_active_ext_the_vmexit_ext(mut_tls))) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_FAILURE_UNKNOWN;
+        }
+
+        bool const already_registered_by_any_ext{
+            has_any_ext_registered_a_callback(mut_tls.ext_tick, "tick")};
+        if (bsl::unlikely(already_registered_by_any_ext)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_FAILURE_UNKNOWN;
+        }
+
+        mut_tls.ext->set_tick_ip(callback);
+        mut_tls.ext->set_tick_period(period);
+        mut_tls.ext_tick = mut_tls.ext;
+        mut_tls.tick_deadline = {};
+
+        return syscall::BF_STATUS_SUCCESS;
+    }
+
     /// <!-- description -->
     ///   @brief Dispatches the bf_callback_op syscalls
     ///
@@ -169,6 +218,16 @@ namespace mk
                 return ret;
             }
 
+            case syscall::BF_CALLBACK_OP_REGISTER_TICK_IDX_VAL.get(): {
+                auto const ret{syscall_bf_callback_op_register_tick(mut_tls)};
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             default: {
                 break;
             }
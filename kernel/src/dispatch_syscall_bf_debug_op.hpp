@@ -32,7 +32,9 @@
 #include <ext_pool_t.hpp>
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
+#include <log_mask.hpp>
 #include <page_pool_t.hpp>
+#include <syscall_stats_t.hpp>
 #include <tls_t.hpp>
 #include <vm_pool_t.hpp>
 #include <vmexit_log_t.hpp>
@@ -61,6 +63,7 @@ namespace mk
     ///   @param vs_pool the vs_pool_t to use
     ///   @param ext_pool the ext_pool_t to use
     ///   @param log the VMExit log to use
+    ///   @param stats the syscall stats to use
     ///   @return Returns a bf_status_t containing success or failure
     ///
     [[nodiscard]] constexpr auto
@@ -73,7 +76,8 @@ namespace mk
         vp_pool_t const &vp_pool,
         vs_pool_t const &vs_pool,
         ext_pool_t const &ext_pool,
-        vmexit_log_t const &log) noexcept -> syscall::bf_status_t
+        vmexit_log_t const &log,
+        syscall_stats_t const &stats) noexcept -> syscall::bf_status_t
     {
         switch (syscall::bf_syscall_index(mut_tls.ext_syscall).get()) {
             case syscall::BF_DEBUG_OP_OUT_IDX_VAL.get(): {
@@ -181,6 +185,22 @@ namespace mk
                 return syscall::BF_STATUS_SUCCESS;
             }
 
+            case syscall::BF_DEBUG_OP_DUMP_SYSCALL_STATS_IDX_VAL.get(): {
+                auto const ppid{get_ppid(mut_tls, mut_tls.ext_reg0)};
+                if (bsl::unlikely(ppid.is_invalid())) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return syscall::BF_STATUS_INVALID_INPUT_REG0;
+                }
+
+                stats.dump(ppid);
+                return syscall::BF_STATUS_SUCCESS;
+            }
+
+            case syscall::BF_DEBUG_OP_SET_LOG_MASK_IDX_VAL.get(): {
+                set_log_mask(mut_tls, bsl::to_u64(mut_tls.ext_reg0));
+                return syscall::BF_STATUS_SUCCESS;
+            }
+
             default: {
                 break;
             }
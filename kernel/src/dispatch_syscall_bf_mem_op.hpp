@@ -33,9 +33,14 @@
 #include <bf_types.hpp>
 #include <ext_t.hpp>
 #include <huge_pool_t.hpp>
+#include <intrinsic_t.hpp>
+#include <log_enabled.hpp>
 #include <page_pool_t.hpp>
 #include <tls_t.hpp>
+#include <trace.hpp>
+#include <trace_record_t.hpp>
 
+#include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/unlikely.hpp>
@@ -54,12 +59,33 @@ namespace mk
     syscall_bf_mem_op_alloc_page(tls_t &mut_tls, page_pool_t &mut_page_pool) noexcept
         -> syscall::bf_status_t
     {
+        trace(mut_tls, loader::TRACE_PROBE_PAGE_ALLOC);
         auto const page{mut_tls.ext->alloc_page(mut_tls, mut_page_pool)};
+        trace(mut_tls, loader::TRACE_PROBE_PAGE_ALLOC_RET);
+
         if (bsl::unlikely(page.virt.is_invalid())) {
+            if (log_enabled(
+                    mut_tls.log_mask,
+                    syscall::BF_LOG_SUBSYSTEM_PAGE_POOL,
+                    syscall::BF_LOG_LEVEL_V)) {
+                bsl::print() << bsl::red << "alloc_page failed on pp "             // --
+                             << bsl::rst << bsl::hex(bsl::to_u16(mut_tls.ppid))    // --
+                             << bsl::endl;                                         // --
+            }
+
             bsl::print<bsl::V>() << bsl::here();
             return syscall::BF_STATUS_FAILURE_UNKNOWN;
         }
 
+        if (log_enabled(
+                mut_tls.log_mask, syscall::BF_LOG_SUBSYSTEM_PAGE_POOL, syscall::BF_LOG_LEVEL_VV)) {
+            bsl::print() << bsl::ylw << "alloc_page virt "     // --
+                         << bsl::rst << bsl::hex(page.virt)    // --
+                         << bsl::ylw << " phys "               // --
+                         << bsl::rst << bsl::hex(page.phys)    // --
+                         << bsl::endl;                         // --
+        }
+
         mut_tls.ext_reg0 = page.virt.get();
         mut_tls.ext_reg1 = page.phys.get();
 
@@ -86,18 +112,119 @@ namespace mk
             return syscall::BF_STATUS_INVALID_INPUT_REG1;
         }
 
+        trace(mut_tls, loader::TRACE_PROBE_PAGE_ALLOC);
         auto const huge{mut_tls.ext->alloc_huge(mut_tls, mut_page_pool, mut_huge_pool, size)};
+        trace(mut_tls, loader::TRACE_PROBE_PAGE_ALLOC_RET);
+
         if (bsl::unlikely(huge.virt.is_invalid())) {
+            if (log_enabled(
+                    mut_tls.log_mask,
+                    syscall::BF_LOG_SUBSYSTEM_PAGE_POOL,
+                    syscall::BF_LOG_LEVEL_V)) {
+                bsl::print() << bsl::red << "alloc_huge of "                       // --
+                             << bsl::rst << bsl::hex(size)                         // --
+                             << bsl::red << " bytes failed on pp "                 // --
+                             << bsl::rst << bsl::hex(bsl::to_u16(mut_tls.ppid))    // --
+                             << bsl::endl;                                         // --
+            }
+
             bsl::print<bsl::V>() << bsl::here();
             return syscall::BF_STATUS_FAILURE_UNKNOWN;
         }
 
+        if (log_enabled(
+                mut_tls.log_mask, syscall::BF_LOG_SUBSYSTEM_PAGE_POOL, syscall::BF_LOG_LEVEL_VV)) {
+            bsl::print() << bsl::ylw << "alloc_huge virt "     // --
+                         << bsl::rst << bsl::hex(huge.virt)    // --
+                         << bsl::ylw << " phys "               // --
+                         << bsl::rst << bsl::hex(huge.phys)    // --
+                         << bsl::ylw << " size "               // --
+                         << bsl::rst << bsl::hex(size)         // --
+                         << bsl::endl;                         // --
+        }
+
         mut_tls.ext_reg0 = huge.virt.get();
         mut_tls.ext_reg1 = huge.phys.get();
 
         return syscall::BF_STATUS_SUCCESS;
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the bf_mem_op_free_page syscall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_page_pool the page_pool_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    syscall_bf_mem_op_free_page(
+        tls_t &mut_tls, page_pool_t &mut_page_pool, intrinsic_t const &intrinsic) noexcept
+        -> syscall::bf_status_t
+    {
+        auto const virt{get_page_pool_virt(mut_tls.ext_reg1)};
+        if (bsl::unlikely(virt.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG1;
+        }
+
+        auto const ret{mut_tls.ext->free_page(mut_tls, mut_page_pool, intrinsic, virt)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_FAILURE_UNKNOWN;
+        }
+
+        if (log_enabled(
+                mut_tls.log_mask, syscall::BF_LOG_SUBSYSTEM_PAGE_POOL, syscall::BF_LOG_LEVEL_VV)) {
+            bsl::print() << bsl::ylw << "free_page virt "    // --
+                         << bsl::rst << bsl::hex(virt)       // --
+                         << bsl::endl;                       // --
+        }
+
+        return syscall::BF_STATUS_SUCCESS;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the bf_mem_op_free_huge syscall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_page_pool the page_pool_t to use
+    ///   @param mut_huge_pool the huge pool to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    syscall_bf_mem_op_free_huge(
+        tls_t &mut_tls,
+        page_pool_t &mut_page_pool,
+        huge_pool_t &mut_huge_pool,
+        intrinsic_t const &intrinsic) noexcept -> syscall::bf_status_t
+    {
+        auto const virt{get_huge_pool_virt(mut_tls.ext_reg1)};
+        if (bsl::unlikely(virt.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG1;
+        }
+
+        auto const ret{
+            mut_tls.ext->free_huge(mut_tls, mut_page_pool, mut_huge_pool, intrinsic, virt)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_FAILURE_UNKNOWN;
+        }
+
+        if (log_enabled(
+                mut_tls.log_mask, syscall::BF_LOG_SUBSYSTEM_PAGE_POOL, syscall::BF_LOG_LEVEL_VV)) {
+            bsl::print() << bsl::ylw << "free_huge virt "    // --
+                         << bsl::rst << bsl::hex(virt)       // --
+                         << bsl::endl;                       // --
+        }
+
+        return syscall::BF_STATUS_SUCCESS;
+    }
+
     /// <!-- description -->
     ///   @brief Dispatches the bf_mem_op syscalls
     ///
@@ -105,12 +232,15 @@ namespace mk
     ///   @param mut_tls the current TLS block
     ///   @param mut_page_pool the page_pool_t to use
     ///   @param mut_huge_pool the huge pool to use
+    ///   @param intrinsic the intrinsic_t to use
     ///   @return Returns a bf_status_t containing success or failure
     ///
     [[nodiscard]] constexpr auto
     dispatch_syscall_bf_mem_op(
-        tls_t &mut_tls, page_pool_t &mut_page_pool, huge_pool_t &mut_huge_pool) noexcept
-        -> syscall::bf_status_t
+        tls_t &mut_tls,
+        page_pool_t &mut_page_pool,
+        huge_pool_t &mut_huge_pool,
+        intrinsic_t const &intrinsic) noexcept -> syscall::bf_status_t
     {
         if (bsl::unlikely(!verify_handle_for_current_ext(mut_tls))) {
             bsl::print<bsl::V>() << bsl::here();
@@ -138,6 +268,27 @@ namespace mk
                 return ret;
             }
 
+            case syscall::BF_MEM_OP_FREE_PAGE_IDX_VAL.get(): {
+                auto const ret{syscall_bf_mem_op_free_page(mut_tls, mut_page_pool, intrinsic)};
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case syscall::BF_MEM_OP_FREE_HUGE_IDX_VAL.get(): {
+                auto const ret{
+                    syscall_bf_mem_op_free_huge(mut_tls, mut_page_pool, mut_huge_pool, intrinsic)};
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             default: {
                 break;
             }
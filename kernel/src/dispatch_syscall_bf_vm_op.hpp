@@ -114,13 +114,16 @@ namespace mk
     /// <!-- inputs/outputs -->
     ///   @param mut_tls the current TLS block
     ///   @param mut_page_pool the page_pool_t to use
+    ///   @param mut_intrinsic the intrinsic_t to use
     ///   @param vm_pool the vm_pool_t to use
     ///   @return Returns a bf_status_t containing success or failure
     ///
     [[nodiscard]] constexpr auto
     syscall_bf_vm_op_map_direct(
-        tls_t &mut_tls, page_pool_t &mut_page_pool, vm_pool_t const &vm_pool) noexcept
-        -> syscall::bf_status_t
+        tls_t &mut_tls,
+        page_pool_t &mut_page_pool,
+        intrinsic_t &mut_intrinsic,
+        vm_pool_t const &vm_pool) noexcept -> syscall::bf_status_t
     {
         auto const vmid{get_allocated_vmid(mut_tls.ext_reg1, vm_pool)};
         if (bsl::unlikely(vmid.is_invalid())) {
@@ -134,7 +137,9 @@ namespace mk
             return syscall::BF_STATUS_INVALID_INPUT_REG2;
         }
 
-        auto const virt{mut_tls.ext->map_page_direct(mut_tls, mut_page_pool, vmid, phys)};
+        auto const virt{
+            mut_tls.ext->map_page_direct(mut_tls, mut_page_pool, mut_intrinsic, vmid, phys)};
+
         if (bsl::unlikely(virt.is_invalid())) {
             bsl::print<bsl::V>() << bsl::here();
             return syscall::BF_STATUS_FAILURE_UNKNOWN;
@@ -184,6 +189,126 @@ namespace mk
         return syscall::BF_STATUS_SUCCESS;
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the bf_vm_op_map_direct_range syscall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_page_pool the page_pool_t to use
+    ///   @param mut_intrinsic the intrinsic_t to use
+    ///   @param vm_pool the vm_pool_t to use
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    syscall_bf_vm_op_map_direct_range(
+        tls_t &mut_tls,
+        page_pool_t &mut_page_pool,
+        intrinsic_t &mut_intrinsic,
+        vm_pool_t const &vm_pool) noexcept -> syscall::bf_status_t
+    {
+        auto const vmid{get_allocated_vmid(mut_tls.ext_reg1, vm_pool)};
+        if (bsl::unlikely(vmid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG1;
+        }
+
+        auto const phys{get_phys(mut_tls.ext_reg2)};
+        if (bsl::unlikely(phys.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG2;
+        }
+
+        auto const size{get_direct_map_size(mut_tls.ext_reg3)};
+        if (bsl::unlikely(size.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG3;
+        }
+
+        if (bsl::unlikely((phys + size).checked() > HYPERVISOR_EXT_DIRECT_MAP_SIZE)) {
+            bsl::error() << "the range "                               // --
+                         << bsl::hex(phys)                             // --
+                         << " + "                                      // --
+                         << bsl::hex(size)                             // --
+                         << " is out of range and cannot be mapped"    // --
+                         << bsl::endl                                  // --
+                         << bsl::here();                               // --
+
+            return syscall::BF_STATUS_INVALID_INPUT_REG3;
+        }
+
+        auto const virt{mut_tls.ext->map_range_direct(
+            mut_tls, mut_page_pool, mut_intrinsic, vmid, phys, size)};
+
+        if (bsl::unlikely(virt.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_FAILURE_UNKNOWN;
+        }
+
+        mut_tls.ext_reg0 = virt.get();
+        return syscall::BF_STATUS_SUCCESS;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the bf_vm_op_unmap_direct_range syscall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_page_pool the page_pool_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param vm_pool the vm_pool_t to use
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    syscall_bf_vm_op_unmap_direct_range(
+        tls_t &mut_tls,
+        page_pool_t &mut_page_pool,
+        intrinsic_t const &intrinsic,
+        vm_pool_t const &vm_pool) noexcept -> syscall::bf_status_t
+    {
+        constexpr auto min_addr{HYPERVISOR_EXT_DIRECT_MAP_ADDR};
+        constexpr auto max_addr{(min_addr + HYPERVISOR_EXT_DIRECT_MAP_SIZE).checked()};
+
+        auto const vmid{get_allocated_vmid(mut_tls.ext_reg1, vm_pool)};
+        if (bsl::unlikely(vmid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG1;
+        }
+
+        auto const virt{get_direct_map_virt(mut_tls.ext_reg2)};
+        if (bsl::unlikely(virt.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG2;
+        }
+
+        auto const size{get_direct_map_size(mut_tls.ext_reg3)};
+        if (bsl::unlikely(size.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG3;
+        }
+
+        if (bsl::unlikely((virt + size).checked() > max_addr)) {
+            bsl::error() << "the range "                                 // --
+                         << bsl::hex(virt)                               // --
+                         << " + "                                        // --
+                         << bsl::hex(size)                               // --
+                         << " is out of range and cannot be unmapped"    // --
+                         << bsl::endl                                    // --
+                         << bsl::here();                                 // --
+
+            return syscall::BF_STATUS_INVALID_INPUT_REG3;
+        }
+
+        auto const ret{mut_tls.ext->unmap_range_direct(
+            mut_tls, mut_page_pool, intrinsic, vmid, virt, size)};
+
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_FAILURE_UNKNOWN;
+        }
+
+        return syscall::BF_STATUS_SUCCESS;
+    }
+
     /// <!-- description -->
     ///   @brief Implements the bf_vm_op_unmap_direct_broadcast syscall
     ///
@@ -287,7 +412,8 @@ namespace mk
             }
 
             case syscall::BF_VM_OP_MAP_DIRECT_IDX_VAL.get(): {
-                auto const ret{syscall_bf_vm_op_map_direct(mut_tls, mut_page_pool, mut_vm_pool)};
+                auto const ret{syscall_bf_vm_op_map_direct(
+                    mut_tls, mut_page_pool, mut_intrinsic, mut_vm_pool)};
                 if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return ret;
@@ -328,6 +454,28 @@ namespace mk
                 return ret;
             }
 
+            case syscall::BF_VM_OP_MAP_DIRECT_RANGE_IDX_VAL.get(): {
+                auto const ret{syscall_bf_vm_op_map_direct_range(
+                    mut_tls, mut_page_pool, mut_intrinsic, mut_vm_pool)};
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case syscall::BF_VM_OP_UNMAP_DIRECT_RANGE_IDX_VAL.get(): {
+                auto const ret{syscall_bf_vm_op_unmap_direct_range(
+                    mut_tls, mut_page_pool, mut_intrinsic, mut_vm_pool)};
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             default: {
                 break;
             }
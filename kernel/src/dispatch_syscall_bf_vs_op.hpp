@@ -33,7 +33,9 @@
 #include <errc_types.hpp>
 #include <ext_pool_t.hpp>
 #include <intrinsic_t.hpp>
+#include <log_enabled.hpp>
 #include <page_pool_t.hpp>
+#include <posted_events.hpp>
 #include <promote.hpp>
 #include <return_to_mk.hpp>
 #include <tls_t.hpp>
@@ -654,6 +656,61 @@ namespace mk
         return syscall::BF_STATUS_SUCCESS;
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the bf_vs_op_drain_posted_events syscall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    syscall_bf_vs_op_drain_posted_events(tls_t &mut_tls) noexcept -> syscall::bf_status_t
+    {
+        mut_tls.ext_reg0 = drain_posted_events(mut_tls).get();
+        return syscall::BF_STATUS_SUCCESS;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns false if the extension's tick handler is executing
+    ///     and the requested bf_vs_op syscall would resume or change the
+    ///     active VS. Ticks are delivered before the VMExit that they are
+    ///     piggybacked on, so the tick handler has to resume the active VS
+    ///     as is using bf_vs_op_run_current, otherwise that VMExit would
+    ///     be handed to the wrong VS (or lost). Returns true otherwise.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the current TLS block
+    ///   @return Returns false if the requested bf_vs_op syscall is not
+    ///     allowed from the tick handler. Returns true otherwise.
+    ///
+    [[nodiscard]] constexpr auto
+    is_vs_op_allowed_in_tick(tls_t const &tls) noexcept -> bool
+    {
+        if (bsl::safe_u64::magic_0() == tls.in_tick) {
+            return true;
+        }
+
+        switch (syscall::bf_syscall_index(tls.ext_syscall).get()) {
+            case syscall::BF_VS_OP_RUN_IDX_VAL.get():
+                [[fallthrough]];
+            case syscall::BF_VS_OP_ADVANCE_IP_AND_RUN_IDX_VAL.get():
+                [[fallthrough]];
+            case syscall::BF_VS_OP_ADVANCE_IP_AND_RUN_CURRENT_IDX_VAL.get():
+                [[fallthrough]];
+            case syscall::BF_VS_OP_SET_ACTIVE_IDX_VAL.get():
+                [[fallthrough]];
+            case syscall::BF_VS_OP_ADVANCE_IP_AND_SET_ACTIVE_IDX_VAL.get(): {
+                return false;
+            }
+
+            default: {
+                break;
+            }
+        }
+
+        return true;
+    }
+
     /// <!-- description -->
     ///   @brief Dispatches the bf_vs_op syscalls
     ///
@@ -687,6 +744,22 @@ namespace mk
             return syscall::BF_STATUS_INVALID_PERM_DENIED;
         }
 
+        if (bsl::unlikely(!is_vs_op_allowed_in_tick(mut_tls))) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_PERM_DENIED;
+        }
+
+        if (log_enabled(mut_tls.log_mask, syscall::BF_LOG_SUBSYSTEM_VS, syscall::BF_LOG_LEVEL_VV)) {
+            auto const idx{syscall::bf_syscall_index(mut_tls.ext_syscall)};
+            bsl::print() << bsl::blu << "vs_op "                                   // --
+                         << bsl::rst << bsl::hex(idx)                              // --
+                         << bsl::blu << " reg1 "                                   // --
+                         << bsl::rst << bsl::hex(bsl::to_u64(mut_tls.ext_reg1))    // --
+                         << bsl::blu << " on pp "                                  // --
+                         << bsl::rst << bsl::hex(bsl::to_u16(mut_tls.ppid))        // --
+                         << bsl::endl;                                             // --
+        }
+
         switch (syscall::bf_syscall_index(mut_tls.ext_syscall).get()) {
             case syscall::BF_VS_OP_CREATE_VS_IDX_VAL.get(): {
                 auto const ret{syscall_bf_vs_op_create_vs(
@@ -857,6 +930,16 @@ namespace mk
                 return ret;
             }
 
+            case syscall::BF_VS_OP_DRAIN_POSTED_EVENTS_IDX_VAL.get(): {
+                auto const ret{syscall_bf_vs_op_drain_posted_events(mut_tls)};
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             default: {
                 break;
             }
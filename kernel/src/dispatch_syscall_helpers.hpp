@@ -1109,6 +1109,116 @@ namespace mk
         return virt;
     }
 
+    /// <!-- description -->
+    ///   @brief Given an input register, returns a virtual address if the
+    ///     provided register contains a valid virtual address in the
+    ///     extension's page pool. Otherwise, this function returns
+    ///     bsl::safe_umx::failure().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg the register to get the virtual address from.
+    ///   @return Given an input register, returns a virtual address if the
+    ///     provided register contains a valid virtual address in the
+    ///     extension's page pool. Otherwise, this function returns
+    ///     bsl::safe_umx::failure().
+    ///
+    [[nodiscard]] constexpr auto
+    // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+    get_page_pool_virt(bsl::uint64 const reg) noexcept -> bsl::safe_umx
+    {
+        constexpr auto min_addr{HYPERVISOR_EXT_PAGE_POOL_ADDR};
+        constexpr auto max_addr{(min_addr + HYPERVISOR_EXT_PAGE_POOL_SIZE).checked()};
+
+        auto const virt{bsl::to_umx(reg)};
+        if (bsl::unlikely(virt < min_addr)) {
+            bsl::error() << "the virtual address "                   // --
+                         << bsl::hex(virt)                           // --
+                         << " is out of range and cannot be used"    // --
+                         << bsl::endl                                // --
+                         << bsl::here();                             // --
+
+            return bsl::safe_umx::failure();
+        }
+
+        if (bsl::unlikely(virt >= max_addr)) {
+            bsl::error() << "the virtual address "                   // --
+                         << bsl::hex(virt)                           // --
+                         << " is out of range and cannot be used"    // --
+                         << bsl::endl                                // --
+                         << bsl::here();                             // --
+
+            return bsl::safe_umx::failure();
+        }
+
+        bool const aligned{syscall::bf_is_page_aligned(virt)};
+        if (bsl::unlikely(!aligned)) {
+            bsl::error() << "the virtual address "                       // --
+                         << bsl::hex(virt)                               // --
+                         << " is not page aligned and cannot be used"    // --
+                         << bsl::endl                                    // --
+                         << bsl::here();                                 // --
+
+            return bsl::safe_umx::failure();
+        }
+
+        return virt;
+    }
+
+    /// <!-- description -->
+    ///   @brief Given an input register, returns a virtual address if the
+    ///     provided register contains a valid virtual address in the
+    ///     extension's huge pool. Otherwise, this function returns
+    ///     bsl::safe_umx::failure().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg the register to get the virtual address from.
+    ///   @return Given an input register, returns a virtual address if the
+    ///     provided register contains a valid virtual address in the
+    ///     extension's huge pool. Otherwise, this function returns
+    ///     bsl::safe_umx::failure().
+    ///
+    [[nodiscard]] constexpr auto
+    // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+    get_huge_pool_virt(bsl::uint64 const reg) noexcept -> bsl::safe_umx
+    {
+        constexpr auto min_addr{HYPERVISOR_EXT_HUGE_POOL_ADDR};
+        constexpr auto max_addr{(min_addr + HYPERVISOR_EXT_HUGE_POOL_SIZE).checked()};
+
+        auto const virt{bsl::to_umx(reg)};
+        if (bsl::unlikely(virt < min_addr)) {
+            bsl::error() << "the virtual address "                   // --
+                         << bsl::hex(virt)                           // --
+                         << " is out of range and cannot be used"    // --
+                         << bsl::endl                                // --
+                         << bsl::here();                             // --
+
+            return bsl::safe_umx::failure();
+        }
+
+        if (bsl::unlikely(virt >= max_addr)) {
+            bsl::error() << "the virtual address "                   // --
+                         << bsl::hex(virt)                           // --
+                         << " is out of range and cannot be used"    // --
+                         << bsl::endl                                // --
+                         << bsl::here();                             // --
+
+            return bsl::safe_umx::failure();
+        }
+
+        bool const aligned{syscall::bf_is_page_aligned(virt)};
+        if (bsl::unlikely(!aligned)) {
+            bsl::error() << "the virtual address "                       // --
+                         << bsl::hex(virt)                               // --
+                         << " is not page aligned and cannot be used"    // --
+                         << bsl::endl                                    // --
+                         << bsl::here();                                 // --
+
+            return bsl::safe_umx::failure();
+        }
+
+        return virt;
+    }
+
     /// <!-- description -->
     ///   @brief Given an input register, returns a guest linear address if the
     ///     provided register contains a valid guest linear address. Otherwise,
@@ -1199,6 +1309,56 @@ namespace mk
         return size;
     }
 
+    /// <!-- description -->
+    ///   @brief Given an input register, returns the size of a direct map
+    ///     range if the provided register contains a valid size. Otherwise,
+    ///     this function returns bsl::safe_u64::failure().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg the register to get the size from.
+    ///   @return Given an input register, returns the size of a direct map
+    ///     range if the provided register contains a valid size. Otherwise,
+    ///     this function returns bsl::safe_u64::failure().
+    ///
+    [[nodiscard]] constexpr auto
+    // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+    get_direct_map_size(bsl::uint64 const reg) noexcept -> bsl::safe_u64
+    {
+        auto const size{bsl::to_u64(reg)};
+        if (bsl::unlikely(size.is_zero())) {
+            bsl::error() << "the size "                      // --
+                         << bsl::hex(size)                   // --
+                         << " is zero and cannot be used"    // --
+                         << bsl::endl                        // --
+                         << bsl::here();                     // --
+
+            return bsl::safe_u64::failure();
+        }
+
+        if (bsl::unlikely(size > HYPERVISOR_EXT_DIRECT_MAP_SIZE)) {
+            bsl::error() << "the size "                           // --
+                         << bsl::hex(size)                        // --
+                         << " is too large and cannot be used"    // --
+                         << bsl::endl                             // --
+                         << bsl::here();                          // --
+
+            return bsl::safe_u64::failure();
+        }
+
+        bool const aligned{syscall::bf_is_page_aligned(size)};
+        if (bsl::unlikely(!aligned)) {
+            bsl::error() << "the size "                                  // --
+                         << bsl::hex(size)                               // --
+                         << " is not page aligned and cannot be used"    // --
+                         << bsl::endl                                    // --
+                         << bsl::here();                                 // --
+
+            return bsl::safe_u64::failure();
+        }
+
+        return size;
+    }
+
     /// <!-- description -->
     ///   @brief Given an input register, returns an msr index if the provided
     ///     register contains a valid msr index. Otherwise, this function
@@ -79,6 +79,8 @@ namespace mk
         ///   @param mut_huge_pool the huge_pool_t to use
         ///   @param system_rpt the system RPT provided by the loader
         ///   @param elf_files the ext_elf_files provided by the loader
+        ///   @param elf_files_phys the ext_elf_files_phys provided by the
+        ///     loader (optional)
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     and friends otherwise
         ///
@@ -88,7 +90,8 @@ namespace mk
             page_pool_t &mut_page_pool,
             huge_pool_t &mut_huge_pool,
             root_page_table_t const &system_rpt,
-            loader::ext_elf_files_t const &elf_files) noexcept -> bsl::errc_type
+            loader::ext_elf_files_t const &elf_files,
+            loader::ext_elf_files_phys_t const &elf_files_phys = {}) noexcept -> bsl::errc_type
         {
             bsl::finally mut_release_on_error{
                 [this, &mut_tls, &mut_page_pool, &mut_huge_pool]() noexcept -> void {
@@ -107,7 +110,8 @@ namespace mk
                     mut_page_pool,
                     bsl::to_u16(mut_i),
                     *elf_files.at_if(mut_i),
-                    system_rpt)};
+                    system_rpt,
+                    *elf_files_phys.at_if(mut_i))};
 
                 if (bsl::unlikely(!ret)) {
                     bsl::print<bsl::V>() << bsl::here();
@@ -184,6 +188,38 @@ namespace mk
             }
         }
 
+        /// <!-- description -->
+        ///   @brief Tells each extension to reclaim a single batch of the
+        ///     memory that is still owned by destroyed VMs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///
+        constexpr void
+        reclaim(tls_t &mut_tls, page_pool_t &mut_page_pool) noexcept
+        {
+            for (auto &mut_ext : m_pool) {
+                mut_ext.reclaim(mut_tls, mut_page_pool);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells each extension to flush this PP's TLB if memory
+        ///     it freed might still be cached in it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        flush_tlb(tls_t &mut_tls, intrinsic_t &mut_intrinsic) noexcept
+        {
+            for (auto &mut_ext : m_pool) {
+                mut_ext.flush_tlb(mut_tls, mut_intrinsic);
+            }
+        }
+
         /// <!-- description -->
         ///   @brief Tells the extensions that the requested VM was set to
         ///     active and therefore it's memory map should change on this PP.
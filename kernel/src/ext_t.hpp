@@ -28,6 +28,8 @@
 #include <alloc_huge_t.hpp>
 #include <alloc_page_t.hpp>
 #include <basic_alloc_page_t.hpp>
+#include <basic_page_1g_t.hpp>
+#include <basic_page_2m_t.hpp>
 #include <basic_page_4k_t.hpp>
 #include <basic_root_page_table_t.hpp>
 #include <bf_constants.hpp>
@@ -37,13 +39,20 @@
 #include <ext_tcb_t.hpp>
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
+#include <l0e_t.hpp>
+#include <l1e_t.hpp>
+#include <l2e_t.hpp>
+#include <lock_guard_t.hpp>
 #include <map_page_flags.hpp>
 #include <mk_args_t.hpp>
 #include <page_4k_t.hpp>
 #include <page_aligned_bytes_t.hpp>
 #include <page_pool_t.hpp>
 #include <root_page_table_t.hpp>
+#include <spinlock_t.hpp>
 #include <tls_t.hpp>
+#include <trace.hpp>
+#include <trace_record_t.hpp>
 
 #include <bsl/array.hpp>
 #include <bsl/convert.hpp>
@@ -54,6 +63,8 @@
 #include <bsl/errc_type.hpp>
 #include <bsl/expects.hpp>
 #include <bsl/finally.hpp>
+#include <bsl/is_constant_evaluated.hpp>
+#include <bsl/is_same.hpp>
 #include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/span.hpp>
@@ -103,6 +114,9 @@
 
 namespace mk
 {
+    /// @brief defines the max number of frees that can wait on a TLB flush
+    constexpr auto EXT_MAX_PENDING_FREES{64_umx};
+
     /// <!-- description -->
     ///   @brief Defines an extension WRT to the microkernel. Whenever an
     ///     executes, it must go through this class to do so. This class
@@ -112,6 +126,15 @@ namespace mk
     ///
     class ext_t final
     {
+        /// @brief stores memory that was freed, but might still be in a TLB
+        struct pending_free_t final
+        {
+            /// @brief stores the memory that was freed
+            bsl::span<page_4k_t> mem;
+            /// @brief stores the TLB generation every PP must flush first
+            bsl::safe_umx gen;
+        };
+
         /// @brief stores the ID associated with this ext_t
         bsl::safe_u16 m_id{};
         /// @brief stores the extension's handle
@@ -125,6 +148,22 @@ namespace mk
         root_page_table_t m_main_rpt{};
         /// @brief stores the direct map rpts
         bsl::array<root_page_table_t, HYPERVISOR_MAX_VMS.get()> m_direct_map_rpts{};
+        /// @brief stores the direct map rpt owned by each VM (nullptr if none)
+        bsl::array<root_page_table_t *, HYPERVISOR_MAX_VMS.get()> m_vm_rpts{};
+        /// @brief stores cleared direct map rpts that are ready to be reused
+        bsl::array<root_page_table_t *, HYPERVISOR_MAX_CACHED_RPTS.get()> m_rpt_cache{};
+        /// @brief stores the index into m_rpt_cache
+        bsl::safe_idx m_rpt_cache_idx{};
+        /// @brief stores the direct map rpts of destroyed VMs waiting to be reclaimed
+        bsl::array<root_page_table_t *, HYPERVISOR_MAX_VMS.get()> m_rpt_reclaim{};
+        /// @brief stores the index into m_rpt_reclaim
+        bsl::safe_idx m_rpt_reclaim_idx{};
+        /// @brief stores the number of rpts that are waiting to be, or are being, reclaimed
+        bsl::uintmx m_rpt_reclaim_pending{};
+        /// @brief safe guards m_rpt_cache and m_rpt_reclaim
+        mutable spinlock_t m_rpt_lock{};
+        /// @brief safe guards the creation of the rpts in m_vm_rpts
+        mutable spinlock_t m_vm_rpts_lock{};
 
         /// @brief stores the main IP registered by the extension
         bsl::safe_u64 m_entry_ip{};
@@ -134,12 +173,40 @@ namespace mk
         bsl::safe_u64 m_vmexit_ip{};
         /// @brief stores the fail IP registered by the extension
         bsl::safe_u64 m_fail_ip{};
+        /// @brief stores the tick IP registered by the extension
+        bsl::safe_u64 m_tick_ip{};
+        /// @brief stores the tick period (in TSC ticks) registered by the extension
+        bsl::safe_u64 m_tick_period{};
 
         /// @brief stores the direct map rpts
         bsl::array<bsl::span<page_4k_t>, HYPERVISOR_MAX_HUGE_ALLOCS.get()> m_huge_allocs{};
         /// @brief stores the index into m_huge_allocs
         bsl::safe_idx m_huge_allocs_idx{};
 
+        /// @brief stores the number of pages allocated using alloc_page
+        bsl::safe_umx m_page_usage{};
+        /// @brief stores the most pages ever allocated using alloc_page
+        bsl::safe_umx m_page_hwm{};
+        /// @brief stores the number of pages allocated using alloc_huge
+        bsl::safe_umx m_huge_usage{};
+        /// @brief stores the most pages ever allocated using alloc_huge
+        bsl::safe_umx m_huge_hwm{};
+
+        /// @brief stores pages freed by free_page() waiting on a TLB flush
+        bsl::array<pending_free_t, EXT_MAX_PENDING_FREES.get()> m_pending_pages{};
+        /// @brief stores the index into m_pending_pages
+        bsl::safe_idx m_pending_pages_idx{};
+        /// @brief stores memory freed by free_huge() waiting on a TLB flush
+        bsl::array<pending_free_t, EXT_MAX_PENDING_FREES.get()> m_pending_huge{};
+        /// @brief stores the index into m_pending_huge
+        bsl::safe_idx m_pending_huge_idx{};
+        /// @brief stores the TLB generation, advanced by each free
+        bsl::uintmx m_tlb_gen{};
+        /// @brief stores the last TLB generation flushed by each PP
+        bsl::array<bsl::uintmx, HYPERVISOR_MAX_PPS.get()> m_tlb_acks{};
+        /// @brief safe guards the usage counters, m_huge_allocs and frees
+        mutable spinlock_t m_alloc_lock{};
+
         /// <!-- description -->
         ///   @brief Returns the program header table
         ///
@@ -356,14 +423,147 @@ namespace mk
             return pmut_mut_page;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the offset of the provided PT_LOAD segment in
+        ///     the loader's copy of the ELF file if the segment can be mapped
+        ///     directly from the ELF file instead of being copied. To be
+        ///     shared, the segment cannot be writable, must be entirely
+        ///     backed by the file (i.e., no BSS), must start on a page
+        ///     boundary and must be covered by the provided physical address
+        ///     table. Otherwise, an invalid offset is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param file the ELF file for this ext_t
+        ///   @param file_phys the physical address of each page of file
+        ///   @param phdr the pt_load segment to get the offset of
+        ///   @return Returns the offset of the segment in the ELF file, or
+        ///     bsl::safe_umx::failure() if the segment must be copied.
+        ///
+        [[nodiscard]] static constexpr auto
+        get_shared_segment_offset(
+            loader::ext_elf_file_t const *const file,
+            bsl::span<bsl::uint64 const> const &file_phys,
+            bfelf::elf64_phdr_t const *const phdr) noexcept -> bsl::safe_umx
+        {
+            if (bsl::is_constant_evaluated()) {
+                return bsl::safe_umx::failure();
+            }
+
+            if (file_phys.empty()) {
+                return bsl::safe_umx::failure();
+            }
+
+            if (bsl::safe_u32::magic_0() != (phdr->p_flags & bfelf::PF_W)) {
+                return bsl::safe_umx::failure();
+            }
+
+            if (phdr->p_filesz != phdr->p_memsz) {
+                return bsl::safe_umx::failure();
+            }
+
+            /// NOTE:
+            /// - The loader replaces p_offset with a pointer into its copy of
+            ///   the ELF file, so the offset is recovered by subtracting the
+            ///   start of the file. The loader's copy is page aligned, which
+            ///   means a page aligned offset is also a page aligned address.
+            ///
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto const base{bsl::to_umx(reinterpret_cast<bsl::uintmx>(file))};
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto const addr{bsl::to_umx(reinterpret_cast<bsl::uintmx>(phdr->p_offset))};
+
+            auto const offs{addr - base};
+            if (bsl::unlikely(offs.is_invalid())) {
+                return bsl::safe_umx::failure();
+            }
+
+            if (!(offs % HYPERVISOR_PAGE_SIZE).is_zero()) {
+                return bsl::safe_umx::failure();
+            }
+
+            auto const last{(offs + bsl::to_umx(phdr->p_memsz)).checked()};
+            if ((file_phys.size() * HYPERVISOR_PAGE_SIZE) < last) {
+                return bsl::safe_umx::failure();
+            }
+
+            return offs;
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps a PT_LOAD segment directly from the loader's copy of
+        ///     the ELF file into the provided root page table instead of
+        ///     allocating and copying each page. The pages are owned by the
+        ///     loader, so they are not returned to the page pool when the
+        ///     root page table is released.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param mut_rpt the root page table to add too
+        ///   @param file_phys the physical address of each page of the file
+        ///   @param phdr the pt_load segment to add
+        ///   @param offs the offset of the segment in the ELF file
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] static constexpr auto
+        map_shared_segment(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            root_page_table_t &mut_rpt,
+            bsl::span<bsl::uint64 const> const &file_phys,
+            bfelf::elf64_phdr_t const *const phdr,
+            bsl::safe_umx const &offs) noexcept -> bsl::errc_type
+        {
+            constexpr auto inc{bsl::to_idx(HYPERVISOR_PAGE_SIZE)};
+
+            auto mut_flags{MAP_PAGE_READ};
+            if ((phdr->p_flags & bfelf::PF_X).is_pos()) {
+                mut_flags = MAP_PAGE_RE;
+            }
+            else {
+                bsl::touch();
+            }
+
+            for (bsl::safe_idx mut_i{}; mut_i < phdr->p_memsz; mut_i += inc) {
+
+                /// NOTE:
+                /// - get_shared_segment_offset() ensures that every page of
+                ///   the segment is covered by file_phys and that the
+                ///   virtual address cannot overflow, which is why these are
+                ///   marked as checked.
+                ///
+
+                auto const virt{(phdr->p_vaddr + bsl::to_umx(mut_i)).checked()};
+                auto const page{((offs + bsl::to_umx(mut_i)) / HYPERVISOR_PAGE_SIZE).checked()};
+                auto const phys{bsl::to_u64(*file_phys.at_if(bsl::to_idx(page)))};
+
+                auto const ret{mut_rpt.map(mut_tls, mut_page_pool, virt, phys, mut_flags)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                bsl::touch();
+            }
+
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief Adds all of the program segments given an ELF file to
-        ///     the provided root page table.
+        ///     the provided root page table. Read-only segments are mapped
+        ///     directly from the loader's copy of the ELF file when possible,
+        ///     while everything else is copied into pages allocated from
+        ///     the page pool.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_tls the current TLS block
         ///   @param mut_page_pool the page_pool_t to use
         ///   @param mut_rpt the root page table to add too
+        ///   @param file the ELF file for this ext_t
+        ///   @param file_phys the physical address of each page of file
         ///   @param phdr the pt_load segment to add
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     and friends otherwise
@@ -373,8 +573,15 @@ namespace mk
             tls_t &mut_tls,
             page_pool_t &mut_page_pool,
             root_page_table_t &mut_rpt,
+            loader::ext_elf_file_t const *const file,
+            bsl::span<bsl::uint64 const> const &file_phys,
             bfelf::elf64_phdr_t const *const phdr) noexcept -> bsl::errc_type
         {
+            auto const offs{get_shared_segment_offset(file, file_phys, phdr)};
+            if (offs.is_valid()) {
+                return map_shared_segment(mut_tls, mut_page_pool, mut_rpt, file_phys, phdr, offs);
+            }
+
             constexpr auto inc{bsl::to_idx(HYPERVISOR_PAGE_SIZE)};
             bsl::span const segment{phdr->p_offset, bsl::to_umx(phdr->p_filesz)};
 
@@ -418,6 +625,7 @@ namespace mk
         ///   @param mut_page_pool the page_pool_t to use
         ///   @param mut_rpt the root page table to add too
         ///   @param file the ELF file for this ext_t
+        ///   @param file_phys the physical address of each page of file
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     and friends otherwise
         ///
@@ -426,7 +634,8 @@ namespace mk
             tls_t &mut_tls,
             page_pool_t &mut_page_pool,
             root_page_table_t &mut_rpt,
-            loader::ext_elf_file_t const *const file) noexcept -> bsl::errc_type
+            loader::ext_elf_file_t const *const file,
+            bsl::span<bsl::uint64 const> const &file_phys) noexcept -> bsl::errc_type
         {
             auto mut_tls_vaddr{bsl::safe_u64::max_value()};
 
@@ -459,7 +668,8 @@ namespace mk
                     continue;
                 }
 
-                auto const ret{add_segment(mut_tls, mut_page_pool, mut_rpt, phdr)};
+                auto const ret{
+                    add_segment(mut_tls, mut_page_pool, mut_rpt, file, file_phys, phdr)};
                 if (bsl::unlikely(!ret)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return bsl::errc_failure;
@@ -845,6 +1055,7 @@ namespace mk
         ///   @param system_rpt the system root page table to initialize with
         ///   @param file the ELF file that contains the segment and TLS
         ///      info need to initialize the provided rpt
+        ///   @param file_phys the physical address of each page of file
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     and friends otherwise
         ///
@@ -854,7 +1065,8 @@ namespace mk
             page_pool_t &mut_page_pool,
             root_page_table_t &mut_rpt,
             root_page_table_t const &system_rpt,
-            loader::ext_elf_file_t const *const file) noexcept -> bsl::errc_type
+            loader::ext_elf_file_t const *const file,
+            bsl::span<bsl::uint64 const> const &file_phys) noexcept -> bsl::errc_type
         {
             bsl::errc_type mut_ret{};
 
@@ -871,7 +1083,7 @@ namespace mk
 
             mut_rpt.add_tables(mut_tls, system_rpt);
 
-            mut_ret = this->add_segments(mut_tls, mut_page_pool, mut_rpt, file);
+            mut_ret = this->add_segments(mut_tls, mut_page_pool, mut_rpt, file, file_phys);
             if (bsl::unlikely(!mut_ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
@@ -900,235 +1112,913 @@ namespace mk
         }
 
         /// <!-- description -->
-        ///   @brief Initializes a direct map root page table to support the
-        ///     execution of this extension (with the inclusion of a direct
-        ///     map).
+        ///   @brief Returns the number of direct map RPTs that are waiting
+        ///     to be, or are being, reclaimed. This is read without holding
+        ///     m_rpt_lock, so it is read atomically.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param mut_tls the current TLS block
-        ///   @param mut_page_pool the page_pool_t to use
-        ///   @param pmut_rpt the root page table to initialize
-        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
-        ///     and friends otherwise
+        ///   @return Returns the number of direct map RPTs that are waiting
+        ///     to be, or are being, reclaimed.
         ///
         [[nodiscard]] constexpr auto
-        initialize_direct_map_rpt(
-            tls_t &mut_tls, page_pool_t &mut_page_pool, root_page_table_t *const pmut_rpt) noexcept
-            -> bsl::errc_type
+        rpt_reclaim_pending() const noexcept -> bsl::safe_umx
         {
-            auto const ret{pmut_rpt->initialize(mut_tls, mut_page_pool)};
-            if (bsl::unlikely(!ret)) {
-                bsl::print<bsl::V>() << bsl::here();
-                return ret;
+            if (bsl::is_constant_evaluated()) {
+                return bsl::to_umx(m_rpt_reclaim_pending);
             }
 
-            pmut_rpt->add_tables(mut_tls, m_main_rpt);
-            return bsl::errc_success;
+            return bsl::to_umx(__atomic_load_n(&m_rpt_reclaim_pending, __ATOMIC_ACQUIRE));
         }
 
         /// <!-- description -->
-        ///   @brief Makes sure that all m_main_rpt aliases are updated
-        ///     in all of the direct maps. This ensures that any allocations
-        ///     are mapped into all VMs.
+        ///   @brief Adds the provided value to m_rpt_reclaim_pending.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param mut_tls the current TLS block
+        ///   @param val the value to add
         ///
         constexpr void
-        update_direct_map_rpts(tls_t &mut_tls) noexcept
+        inc_rpt_reclaim_pending(bsl::safe_umx const &val) noexcept
         {
-            for (auto &mut_rpt : m_direct_map_rpts) {
-                if (!mut_rpt.is_initialized()) {
-                    continue;
-                }
-
-                mut_rpt.add_tables(mut_tls, m_main_rpt);
+            if (bsl::is_constant_evaluated()) {
+                m_rpt_reclaim_pending += val.get();
+                return;
             }
+
+            __atomic_add_fetch(&m_rpt_reclaim_pending, val.get(), __ATOMIC_RELEASE);
         }
 
         /// <!-- description -->
-        ///   @brief Executes the extension given an instruction pointer to
-        ///     execute the extension at, a stack pointer to execute the
-        ///     extension with, and a root page table defining the memory
-        ///     layout to execute the extension with.
+        ///   @brief Subtracts the provided value from m_rpt_reclaim_pending.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param mut_tls the current TLS block
-        ///   @param mut_intrinsic the intrinsic_t to use
-        ///   @param ip the instruction pointer defining where in the
-        ///     extension to start execution at.
-        ///   @param arg0 the first argument to pass the extension
-        ///   @param arg1 the second argument to pass the extension
-        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
-        ///     and friends otherwise
+        ///   @param val the value to subtract
         ///
-        [[nodiscard]] constexpr auto
-        execute(
-            tls_t &mut_tls,
-            intrinsic_t &mut_intrinsic,
-            bsl::safe_u64 const &ip,
-            bsl::safe_u64 const &arg0 = {},
-            bsl::safe_u64 const &arg1 = {}) noexcept -> bsl::errc_type
+        constexpr void
+        dec_rpt_reclaim_pending(bsl::safe_umx const &val) noexcept
         {
-            bsl::expects(ip.is_valid_and_checked());
-            bsl::expects(ip.is_pos());
-            bsl::expects(arg0.is_valid_and_checked());
-            bsl::expects(arg1.is_valid_and_checked());
-
-            auto *const pmut_rpt{m_direct_map_rpts.at_if(bsl::to_idx(mut_tls.active_vmid))};
-            bsl::expects(nullptr != pmut_rpt);
-
-            if (pmut_rpt->is_inactive(mut_tls)) {
-                pmut_rpt->activate(mut_tls, mut_intrinsic);
-            }
-            else {
-                bsl::touch();
-            }
-
-            if (mut_tls.ext != this) {
-                mut_tls.ext = this;
-                mut_tls.active_extid = this->id().get();
-            }
-            else {
-                bsl::touch();
-            }
-
-            if (ip == m_fail_ip) {
-                return call_ext(ip.get(), mut_tls.ext_fail_sp, arg0.get(), arg1.get());
+            if (bsl::is_constant_evaluated()) {
+                m_rpt_reclaim_pending -= val.get();
+                return;
             }
 
-            return call_ext(ip.get(), mut_tls.sp, arg0.get(), arg1.get());
+            __atomic_sub_fetch(&m_rpt_reclaim_pending, val.get(), __ATOMIC_RELEASE);
         }
 
-    public:
         /// <!-- description -->
-        ///   @brief Initializes this ext_t
+        ///   @brief Removes the last RPT from m_rpt_reclaim and returns it.
+        ///     The caller owns the RPT until it hands it back using
+        ///     push_rpt_reclaim() or finishes reclaiming it. m_rpt_lock
+        ///     must be held by the caller.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param mut_tls the current TLS block
-        ///   @param mut_page_pool the page_pool_t to use
-        ///   @param i the ID for this ext_t
-        ///   @param file the ELF file for this ext_t
-        ///   @param system_rpt the system RPT provided by the loader
-        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
-        ///     and friends otherwise
+        ///   @return Returns the last RPT in m_rpt_reclaim, or a nullptr
+        ///     if m_rpt_reclaim is empty.
         ///
         [[nodiscard]] constexpr auto
-        initialize(
-            tls_t &mut_tls,
-            page_pool_t &mut_page_pool,
-            bsl::safe_u16 const &i,
-            loader::ext_elf_file_t const *const file,
-            root_page_table_t const &system_rpt) noexcept -> bsl::errc_type
+        pop_rpt_reclaim() noexcept -> root_page_table_t *
         {
-            bsl::expects(i.is_valid_and_checked());
-            bsl::expects(i != syscall::BF_INVALID_ID);
-            bsl::expects(nullptr != file);
+            if (bsl::to_umx(m_rpt_reclaim_idx).is_zero()) {
+                return nullptr;
+            }
 
-            validate(file);
-            m_entry_ip = file->e_entry;
+            --m_rpt_reclaim_idx;
 
-            auto const ret{
-                this->initialize_rpt(mut_tls, mut_page_pool, m_main_rpt, system_rpt, file)};
+            auto *const pmut_rpt{*m_rpt_reclaim.at_if(m_rpt_reclaim_idx)};
+            *m_rpt_reclaim.at_if(m_rpt_reclaim_idx) = {};
 
-            if (bsl::unlikely(!ret)) {
-                bsl::print<bsl::V>() << bsl::here();
-                return ret;
-            }
+            return pmut_rpt;
+        }
 
-            m_id = ~i;
-            m_handle = syscall::BF_INVALID_HANDLE;
-            return ret;
+        /// <!-- description -->
+        ///   @brief Adds the provided RPT to the end of m_rpt_reclaim.
+        ///     Since a VM can only own one direct map RPT, m_rpt_reclaim
+        ///     cannot overflow. m_rpt_lock must be held by the caller.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_rpt the RPT to add to m_rpt_reclaim
+        ///
+        constexpr void
+        push_rpt_reclaim(root_page_table_t *const pmut_rpt) noexcept
+        {
+            *m_rpt_reclaim.at_if(m_rpt_reclaim_idx) = pmut_rpt;
+            ++m_rpt_reclaim_idx;
         }
 
         /// <!-- description -->
-        ///   @brief Release the ext_t
+        ///   @brief Returns a direct map root page table that is not owned
+        ///     by any VM. A previously cleared RPT is taken from m_rpt_cache
+        ///     if one is available. Otherwise, an unused RPT is initialized,
+        ///     which allocates its root page table from the page pool. If
+        ///     there are no unused RPTs, the RPT of a destroyed VM that is
+        ///     still waiting to be reclaimed is reclaimed immediately.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_tls the current TLS block
         ///   @param mut_page_pool the page_pool_t to use
-        ///   @param mut_huge_pool the huge_pool_t to use
+        ///   @return Returns a pointer to an empty, initialized direct map
+        ///     RPT on success, or a nullptr on failure.
         ///
-        constexpr void
-        release(tls_t &mut_tls, page_pool_t &mut_page_pool, huge_pool_t &mut_huge_pool) noexcept
+        [[nodiscard]] constexpr auto
+        alloc_direct_map_rpt(tls_t &mut_tls, page_pool_t &mut_page_pool) noexcept
+            -> root_page_table_t *
         {
-            for (bsl::safe_idx mut_i; mut_i < m_huge_allocs_idx; ++mut_i) {
-                auto *const pmut_huge{m_huge_allocs.at_if(mut_i)};
+            root_page_table_t *pmut_mut_rpt{};
+            while (nullptr == pmut_mut_rpt) {
+                lock_guard_t mut_lock{mut_tls, m_rpt_lock};
 
-                auto const huge_phys{mut_huge_pool.virt_to_phys(pmut_huge->data())};
-                bsl::expects(huge_phys.is_valid_and_checked());
-                bsl::expects(huge_phys.is_pos());
+                if (bsl::to_umx(m_rpt_cache_idx).is_pos()) {
+                    --m_rpt_cache_idx;
 
-                auto const huge_virt{(HYPERVISOR_EXT_HUGE_POOL_ADDR + huge_phys).checked()};
-                bsl::expects(huge_virt.is_valid_and_checked());
-                bsl::expects(huge_virt.is_pos());
+                    auto *const pmut_rpt{*m_rpt_cache.at_if(m_rpt_cache_idx)};
+                    *m_rpt_cache.at_if(m_rpt_cache_idx) = {};
 
-                bsl::discard(m_main_rpt.unmap(mut_tls, mut_page_pool, huge_virt));
-                mut_huge_pool.deallocate(mut_tls, *pmut_huge);
-            }
+                    return pmut_rpt;
+                }
 
-            m_huge_allocs_idx = {};
-            for (auto &mut_elem : m_huge_allocs) {
-                mut_elem = {};
-            }
+                for (auto &mut_rpt : m_direct_map_rpts) {
+                    if (!mut_rpt.is_initialized()) {
+                        pmut_mut_rpt = &mut_rpt;
+                        break;
+                    }
 
-            m_fail_ip = {};
-            m_vmexit_ip = {};
-            m_bootstrap_ip = {};
-            m_entry_ip = {};
+                    bsl::touch();
+                }
 
-            for (auto &mut_rpt : m_direct_map_rpts) {
-                mut_rpt.release(mut_tls, mut_page_pool);
+                if (nullptr != pmut_mut_rpt) {
+                    auto const ret{pmut_mut_rpt->initialize(mut_tls, mut_page_pool)};
+                    if (bsl::unlikely(!ret)) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return nullptr;
+                    }
+
+                    return pmut_mut_rpt;
+                }
+
+                /// NOTE:
+                /// - A VM can only own one direct map RPT, so when the cache
+                ///   is empty and every RPT is initialized, at least one of
+                ///   them belongs to a destroyed VM and is waiting to be, or
+                ///   is being, reclaimed. This should be rare, so we take
+                ///   it and finish reclaiming it below instead of failing.
+                /// - If m_rpt_reclaim is empty, another PP is in the middle
+                ///   of reclaim(). It either hands the RPT back or adds it
+                ///   to the cache once m_rpt_lock is dropped, so we retry.
+                ///
+
+                bsl::expects(this->rpt_reclaim_pending().is_pos());
+                pmut_mut_rpt = this->pop_rpt_reclaim();
             }
 
-            m_main_rpt.release(mut_tls, mut_page_pool);
+            /// NOTE:
+            /// - The RPT was removed from m_rpt_reclaim, so no other PP can
+            ///   touch it and it is drained without holding m_rpt_lock.
+            ///
 
-            m_is_executing_fail = {};
-            m_has_executed_start = {};
-            m_handle = {};
-            m_id = {};
+            while (!pmut_mut_rpt->reclaim(mut_tls, mut_page_pool)) {
+                bsl::touch();
+            }
+
+            this->dec_rpt_reclaim_pending(bsl::safe_umx::magic_1());
+            return pmut_mut_rpt;
         }
 
         /// <!-- description -->
-        ///   @brief Returns the ID of this ext_t
+        ///   @brief Returns the RPT stored in the provided m_vm_rpts slot.
+        ///     The slot is read atomically as it can be filled in by
+        ///     get_direct_map_rpt() on another PP at any time.
         ///
         /// <!-- inputs/outputs -->
-        ///   @return Returns the ID of this ext_t
+        ///   @param vm_rpt the m_vm_rpts slot to read
+        ///   @return Returns the RPT stored in the provided m_vm_rpts slot
         ///
-        [[nodiscard]] constexpr auto
-        id() const noexcept -> bsl::safe_u16
+        [[nodiscard]] static constexpr auto
+        load_vm_rpt(root_page_table_t *const *const vm_rpt) noexcept -> root_page_table_t *
         {
-            bsl::ensures(m_id.is_valid_and_checked());
-            return ~m_id;
+            if (bsl::is_constant_evaluated()) {
+                return *vm_rpt;
+            }
+
+            return __atomic_load_n(vm_rpt, __ATOMIC_ACQUIRE);
         }
 
         /// <!-- description -->
-        ///   @brief Returns the bootstrap IP for this extension.
+        ///   @brief Returns the direct map root page table owned by the
+        ///     requested VM, creating it if it does not exist yet. Direct
+        ///     map RPTs are created lazily as most VMs never have memory
+        ///     mapped into an extension's direct map, and until they do,
+        ///     m_main_rpt is all the extension needs to execute. If more
+        ///     than one PP asks for the same VM's RPT at the same time, only
+        ///     one of them creates it, and the rest are given that one.
         ///
         /// <!-- inputs/outputs -->
-        ///   @return Returns the bootstrap IP for this extension.
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param vmid the ID of the VM to get the direct map RPT for
+        ///   @return Returns a pointer to the VM's direct map RPT on
+        ///     success, or a nullptr on failure.
         ///
         [[nodiscard]] constexpr auto
-        bootstrap_ip() const noexcept -> bsl::safe_u64 const &
+        get_direct_map_rpt(
+            tls_t &mut_tls, page_pool_t &mut_page_pool, bsl::safe_u16 const &vmid) noexcept
+            -> root_page_table_t *
         {
-            bsl::ensures(m_bootstrap_ip.is_valid_and_checked());
-            return m_bootstrap_ip;
-        }
+            auto *const pmut_vm_rpt{m_vm_rpts.at_if(bsl::to_idx(vmid))};
+            bsl::expects(nullptr != pmut_vm_rpt);
 
-        /// <!-- description -->
-        ///   @brief Sets the bootstrap IP for this extension. This should
-        ///     be called by the syscall dispatcher as the result of a
-        ///     syscall from the extension defining what IP the extension
-        ///     would like to use for bootstrapping.
-        ///
-        /// <!-- inputs/outputs -->
-        ///   @param ip the bootstrap IP to use
-        ///
-        constexpr void
-        set_bootstrap_ip(bsl::safe_u64 const &ip) noexcept
-        {
-            bsl::expects(ip.is_valid_and_checked());
-            bsl::expects(ip.is_pos());
+            auto *const pmut_vm_rpt_old{load_vm_rpt(pmut_vm_rpt)};
+            if (nullptr != pmut_vm_rpt_old) {
+                return pmut_vm_rpt_old;
+            }
+
+            /// NOTE:
+            /// - The check above is repeated once the lock is held, as
+            ///   another PP might have created the RPT in the meantime, in
+            ///   which case we must use that one instead of creating (and
+            ///   leaking) a second one.
+            ///
+
+            lock_guard_t mut_lock{mut_tls, m_vm_rpts_lock};
+
+            auto *const pmut_vm_rpt_new{load_vm_rpt(pmut_vm_rpt)};
+            if (nullptr != pmut_vm_rpt_new) {
+                return pmut_vm_rpt_new;
+            }
+
+            auto *const pmut_rpt{this->alloc_direct_map_rpt(mut_tls, mut_page_pool)};
+            if (bsl::unlikely(nullptr == pmut_rpt)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return nullptr;
+            }
+
+            /// NOTE:
+            /// - Direct map RPTs are walked by the CPU on every PP that is
+            ///   executing one of the VM's VSs, and the TLB is only ever
+            ///   flushed on the PP that changes the RPT. If map() promoted
+            ///   a table (or unmap() released an empty one), the table
+            ///   would go back to the page pool while another PP's paging
+            ///   structure caches might still point to it, so neither is
+            ///   allowed. The tables are released once the VM is destroyed
+            ///   and the RPT is reclaimed.
+            ///
+
+            pmut_rpt->add_tables(mut_tls, m_main_rpt);
+            pmut_rpt->set_defer_release(true);
+
+            if (bsl::is_constant_evaluated()) {
+                *pmut_vm_rpt = pmut_rpt;
+            }
+            else {
+                __atomic_store_n(pmut_vm_rpt, pmut_rpt, __ATOMIC_RELEASE);
+            }
+
+            return pmut_rpt;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the root page table to execute the extension
+        ///     with while the requested VM is active. This is the VM's
+        ///     direct map RPT if one was created, and m_main_rpt otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid the ID of the VM to get the RPT for
+        ///   @return Returns the root page table to execute the extension
+        ///     with while the requested VM is active.
+        ///
+        [[nodiscard]] constexpr auto
+        active_rpt(bsl::safe_u16 const &vmid) noexcept -> root_page_table_t *
+        {
+            auto const *const vm_rpt{m_vm_rpts.at_if(bsl::to_idx(vmid))};
+            bsl::expects(nullptr != vm_rpt);
+
+            auto *const pmut_rpt{load_vm_rpt(vm_rpt)};
+            if (nullptr == pmut_rpt) {
+                return &m_main_rpt;
+            }
+
+            return pmut_rpt;
+        }
+
+        /// <!-- description -->
+        ///   @brief Activates the provided direct map RPT if the VM it
+        ///     belongs to is the active VM on this PP and the RPT is not
+        ///     already active. This is needed when a VM's direct map RPT is
+        ///     created while the VM is executing, as up until that point,
+        ///     the extension was executing with m_main_rpt.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///   @param vmid the ID of the VM that owns pmut_rpt
+        ///   @param pmut_rpt the direct map RPT to activate
+        ///
+        static constexpr void
+        activate_direct_map_rpt(
+            tls_t &mut_tls,
+            intrinsic_t &mut_intrinsic,
+            bsl::safe_u16 const &vmid,
+            root_page_table_t *const pmut_rpt) noexcept
+        {
+            if (vmid != mut_tls.active_vmid) {
+                return;
+            }
+
+            if (pmut_rpt->is_inactive(mut_tls)) {
+                pmut_rpt->activate(mut_tls, mut_intrinsic);
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the size of the largest page that can be used
+        ///     to map the start of the requested direct map range. 1G pages
+        ///     are only used if the PP supports them. Since the direct map
+        ///     is linear, the physical address is always virt minus
+        ///     HYPERVISOR_EXT_DIRECT_MAP_ADDR, which means that given the
+        ///     same range, this function always breaks the range up the same
+        ///     way, which is what allows a range to be unmapped without
+        ///     having to remember how it was mapped.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param virt the virtual address of the start of the range
+        ///   @param bytes the number of bytes left in the range
+        ///   @return Returns the size of the largest page that can be used
+        ///     to map the start of the requested direct map range.
+        ///
+        [[nodiscard]] static constexpr auto
+        direct_map_page_size(
+            intrinsic_t const &intrinsic,
+            bsl::safe_u64 const &virt,
+            bsl::safe_u64 const &bytes) noexcept -> bsl::safe_u64
+        {
+            auto const phys{(virt - HYPERVISOR_EXT_DIRECT_MAP_ADDR).checked()};
+            auto const addrs{virt | phys};
+
+            if (bytes >= lib::BASIC_PAGE_1G_T_SIZE) {
+                if ((addrs & lib::BASIC_PAGE_1G_T_MASK).is_zero()) {
+                    if (intrinsic.is_page_1g_supported()) {
+                        return lib::BASIC_PAGE_1G_T_SIZE;
+                    }
+
+                    bsl::touch();
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (bytes >= lib::BASIC_PAGE_2M_T_SIZE) {
+                if ((addrs & lib::BASIC_PAGE_2M_T_MASK).is_zero()) {
+                    return lib::BASIC_PAGE_2M_T_SIZE;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
+            return HYPERVISOR_PAGE_SIZE;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps the range [virt, virt + bytes) from the provided
+        ///     direct map RPT and flushes the TLB for each page that was
+        ///     unmapped. The range must have been mapped using
+        ///     map_range_direct() (or be a prefix of one that stops on a
+        ///     page boundary that map_range_direct() used).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param pmut_rpt the direct map RPT to unmap the range from
+        ///   @param virt the virtual address of the start of the range
+        ///   @param bytes the total number of bytes to unmap
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] static constexpr auto
+        unmap_direct_map_range(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            intrinsic_t const &intrinsic,
+            root_page_table_t *const pmut_rpt,
+            bsl::safe_u64 const &virt,
+            bsl::safe_u64 const &bytes) noexcept -> bsl::errc_type
+        {
+            bsl::safe_u64 mut_off{};
+            while (mut_off < bytes) {
+                auto const page_virt{(virt + mut_off).checked()};
+                auto const page_size{
+                    direct_map_page_size(intrinsic, page_virt, (bytes - mut_off).checked())};
+
+                bsl::errc_type mut_ret{};
+                if (page_size == lib::BASIC_PAGE_1G_T_SIZE) {
+                    mut_ret = pmut_rpt->unmap<lib::l2e_t>(mut_tls, mut_page_pool, page_virt);
+                }
+                else if (page_size == lib::BASIC_PAGE_2M_T_SIZE) {
+                    mut_ret = pmut_rpt->unmap<lib::l1e_t>(mut_tls, mut_page_pool, page_virt);
+                }
+                else {
+                    mut_ret = pmut_rpt->unmap(mut_tls, mut_page_pool, page_virt);
+                }
+
+                if (bsl::unlikely(!mut_ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return mut_ret;
+                }
+
+                intrinsic.tlb_flush(page_virt);
+                mut_off += page_size;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Makes sure that all m_main_rpt aliases are updated
+        ///     in all of the direct maps. This ensures that any allocations
+        ///     are mapped into all VMs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///
+        constexpr void
+        update_direct_map_rpts(tls_t &mut_tls) noexcept
+        {
+            for (auto *const pmut_rpt : m_vm_rpts) {
+                if (nullptr == pmut_rpt) {
+                    continue;
+                }
+
+                pmut_rpt->add_tables(mut_tls, m_main_rpt);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Advances the TLB generation. Memory that was unmapped
+        ///     from m_main_rpt before this is called can be released once
+        ///     every online PP has flushed the returned generation.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the new TLB generation
+        ///
+        [[nodiscard]] constexpr auto
+        next_tlb_gen() noexcept -> bsl::safe_umx
+        {
+            if (bsl::is_constant_evaluated()) {
+                ++m_tlb_gen;
+                return bsl::to_umx(m_tlb_gen);
+            }
+
+            return bsl::to_umx(
+                __atomic_add_fetch(&m_tlb_gen, bsl::safe_umx::magic_1().get(), __ATOMIC_SEQ_CST));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if every online PP has flushed its TLB
+        ///     since the provided TLB generation was reached. Returns false
+        ///     otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param gen the TLB generation to check
+        ///   @return Returns true if every online PP has flushed its TLB
+        ///     since the provided TLB generation was reached. Returns false
+        ///     otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        is_tlb_flushed(tls_t const &tls, bsl::safe_umx const &gen) const noexcept -> bool
+        {
+            for (bsl::safe_idx mut_i{}; mut_i < bsl::to_umx(tls.online_pps); ++mut_i) {
+                auto const *const ack{m_tlb_acks.at_if(mut_i)};
+
+                bsl::safe_umx mut_ack{};
+                if (bsl::is_constant_evaluated()) {
+                    mut_ack = bsl::to_umx(*ack);
+                }
+                else {
+                    mut_ack = bsl::to_umx(__atomic_load_n(ack, __ATOMIC_ACQUIRE));
+                }
+
+                if (mut_ack < gen) {
+                    return false;
+                }
+
+                bsl::touch();
+            }
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds freed memory to the provided list of pending frees.
+        ///     The memory is released by release_pending() once every
+        ///     online PP has flushed its TLB.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_list the list of pending frees to add to
+        ///   @param mut_idx the index into mut_list
+        ///   @param mem the memory that was freed
+        ///
+        constexpr void
+        defer_free(
+            bsl::array<pending_free_t, EXT_MAX_PENDING_FREES.get()> &mut_list,
+            bsl::safe_idx &mut_idx,
+            bsl::span<page_4k_t> const &mem) noexcept
+        {
+            bsl::expects(mut_idx < mut_list.size());
+
+            *mut_list.at_if(mut_idx) = {mem, this->next_tlb_gen()};
+            ++mut_idx;
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases every pending free in the provided list that
+        ///     can no longer be in any PP's TLB back to the provided pool.
+        ///     The caller must hold m_alloc_lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam POOL_TYPE the type of pool to release the memory to
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_pool the pool to release the memory to
+        ///   @param mut_list the list of pending frees to release
+        ///   @param mut_idx the index into mut_list
+        ///   @param release_all if true, every pending free is released.
+        ///     This can only be used when the extension cannot execute.
+        ///
+        template<typename POOL_TYPE>
+        constexpr void
+        release_pending(
+            tls_t &mut_tls,
+            POOL_TYPE &mut_pool,
+            bsl::array<pending_free_t, EXT_MAX_PENDING_FREES.get()> &mut_list,
+            bsl::safe_idx &mut_idx,
+            bool const release_all = false) noexcept
+        {
+            bsl::safe_idx mut_i{};
+            while (mut_i < mut_idx) {
+                auto *const pmut_pending{mut_list.at_if(mut_i)};
+                if (!release_all && !this->is_tlb_flushed(mut_tls, pmut_pending->gen)) {
+                    ++mut_i;
+                    continue;
+                }
+
+                if constexpr (bsl::is_same<POOL_TYPE, huge_pool_t>::value) {
+                    mut_pool.deallocate(mut_tls, pmut_pending->mem);
+                }
+                else {
+                    mut_pool.deallocate(mut_tls, pmut_pending->mem.data());
+                }
+
+                /// NOTE:
+                /// - The order of the list does not matter, so the last
+                ///   pending free is moved into the slot that was just
+                ///   released.
+                ///
+
+                --mut_idx;
+                *pmut_pending = *mut_list.at_if(mut_idx);
+                *mut_list.at_if(mut_idx) = {};
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the virtual address that a huge allocation is
+        ///     mapped to in the extension's address space.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param huge_pool the huge_pool_t to use
+        ///   @param huge the huge allocation to get the virtual address for
+        ///   @return Returns the virtual address that a huge allocation is
+        ///     mapped to in the extension's address space.
+        ///
+        [[nodiscard]] static constexpr auto
+        huge_to_virt(huge_pool_t const &huge_pool, bsl::span<page_4k_t> const &huge) noexcept
+            -> bsl::safe_u64
+        {
+            auto const huge_phys{huge_pool.virt_to_phys(huge.data())};
+            bsl::expects(huge_phys.is_valid_and_checked());
+            bsl::expects(huge_phys.is_pos());
+
+            /// NOTE:
+            /// - Huge allocations come from the kernel's direct map, which
+            ///   is the same size as the extension's direct map, something
+            ///   that is validated by CMake. As a result, the virtual address
+            ///   below can never overflow which is why it is marked as
+            ///   checked().
+            ///
+
+            auto const huge_virt{(HYPERVISOR_EXT_HUGE_POOL_ADDR + huge_phys).checked()};
+            bsl::expects(huge_virt.is_valid_and_checked());
+            bsl::expects(huge_virt.is_pos());
+
+            return huge_virt;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps the first "bytes" bytes of a huge allocation from
+        ///     m_main_rpt. It is the caller's responsibility to flush the
+        ///     TLB as needed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param huge_virt the virtual address of the huge allocation
+        ///   @param bytes the total number of bytes to unmap
+        ///
+        constexpr void
+        unmap_huge(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            bsl::safe_u64 const &huge_virt,
+            bsl::safe_umx const &bytes) noexcept
+        {
+            constexpr auto inc{bsl::to_idx(HYPERVISOR_PAGE_SIZE)};
+            for (bsl::safe_idx mut_i{}; mut_i < bytes; mut_i += inc) {
+                auto const page_virt{(huge_virt + bsl::to_u64(mut_i)).checked()};
+                bsl::discard(m_main_rpt.unmap(mut_tls, mut_page_pool, page_virt));
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided l0e_t maps a page that was
+        ///     allocated using alloc_page() to the provided virtual address.
+        ///     Returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param l0e the l0e_t to query
+        ///   @param page_virt the virtual address the l0e_t maps
+        ///   @return Returns true if the provided l0e_t maps a page that was
+        ///     allocated using alloc_page() to the provided virtual address.
+        ///     Returns false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_alloc_page(lib::l0e_t const &l0e, bsl::safe_u64 const &page_virt) noexcept -> bool
+        {
+            if (bsl::safe_u64::magic_1() != l0e.auto_release) {
+                return false;
+            }
+
+            if (bsl::safe_u64::magic_0() != l0e.explicit_unmap) {
+                return false;
+            }
+
+            if (bsl::safe_u64::magic_0() != l0e.alias) {
+                return false;
+            }
+
+            auto const page_phys{l0e.phys << HYPERVISOR_PAGE_SHIFT};
+            return (HYPERVISOR_EXT_PAGE_POOL_ADDR + page_phys).checked() == page_virt;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds "pages" to the provided usage counter and updates
+        ///     the provided high watermark if needed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_usage the usage counter to update
+        ///   @param mut_hwm the high watermark to update
+        ///   @param pages the number of pages to add to mut_usage
+        ///
+        static constexpr void
+        add_usage(
+            bsl::safe_umx &mut_usage, bsl::safe_umx &mut_hwm, bsl::safe_umx const &pages) noexcept
+        {
+            mut_usage += pages;
+            if (mut_usage > mut_hwm) {
+                mut_hwm = mut_usage;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Executes the extension given an instruction pointer to
+        ///     execute the extension at, a stack pointer to execute the
+        ///     extension with, and a root page table defining the memory
+        ///     layout to execute the extension with.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///   @param ip the instruction pointer defining where in the
+        ///     extension to start execution at.
+        ///   @param arg0 the first argument to pass the extension
+        ///   @param arg1 the second argument to pass the extension
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        execute(
+            tls_t &mut_tls,
+            intrinsic_t &mut_intrinsic,
+            bsl::safe_u64 const &ip,
+            bsl::safe_u64 const &arg0 = {},
+            bsl::safe_u64 const &arg1 = {}) noexcept -> bsl::errc_type
+        {
+            bsl::expects(ip.is_valid_and_checked());
+            bsl::expects(ip.is_pos());
+            bsl::expects(arg0.is_valid_and_checked());
+            bsl::expects(arg1.is_valid_and_checked());
+
+            auto *const pmut_rpt{this->active_rpt(bsl::to_u16(mut_tls.active_vmid))};
+            if (pmut_rpt->is_inactive(mut_tls)) {
+                pmut_rpt->activate(mut_tls, mut_intrinsic);
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (mut_tls.ext != this) {
+                mut_tls.ext = this;
+                mut_tls.active_extid = this->id().get();
+            }
+            else {
+                bsl::touch();
+            }
+
+            trace(mut_tls, loader::TRACE_PROBE_CALL_EXT);
+            if (ip == m_fail_ip) {
+                return call_ext(ip.get(), mut_tls.ext_fail_sp, arg0.get(), arg1.get());
+            }
+
+            return call_ext(ip.get(), mut_tls.sp, arg0.get(), arg1.get());
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Initializes this ext_t
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param i the ID for this ext_t
+        ///   @param file the ELF file for this ext_t
+        ///   @param system_rpt the system RPT provided by the loader
+        ///   @param file_phys the physical address of each page of file. If
+        ///     empty, every segment is copied instead of being shared.
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        initialize(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            bsl::safe_u16 const &i,
+            loader::ext_elf_file_t const *const file,
+            root_page_table_t const &system_rpt,
+            bsl::span<bsl::uint64 const> const &file_phys = {}) noexcept -> bsl::errc_type
+        {
+            bsl::expects(i.is_valid_and_checked());
+            bsl::expects(i != syscall::BF_INVALID_ID);
+            bsl::expects(nullptr != file);
+
+            validate(file);
+            m_entry_ip = file->e_entry;
+
+            auto const ret{this->initialize_rpt(
+                mut_tls, mut_page_pool, m_main_rpt, system_rpt, file, file_phys)};
+
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            /// NOTE:
+            /// - The direct maps alias the tables of m_main_rpt, and other
+            ///   PPs might have what free_page() and free_huge() unmap in
+            ///   their TLBs, so m_main_rpt must never return memory to the
+            ///   page pool on its own. See free_page() for more details.
+            ///
+
+            m_main_rpt.set_defer_release(true);
+
+            m_id = ~i;
+            m_handle = syscall::BF_INVALID_HANDLE;
+            return ret;
+        }
+
+        /// <!-- description -->
+        ///   @brief Release the ext_t
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param mut_huge_pool the huge_pool_t to use
+        ///
+        constexpr void
+        release(tls_t &mut_tls, page_pool_t &mut_page_pool, huge_pool_t &mut_huge_pool) noexcept
+        {
+            for (bsl::safe_idx mut_i; mut_i < m_huge_allocs_idx; ++mut_i) {
+                auto *const pmut_huge{m_huge_allocs.at_if(mut_i)};
+                auto const huge_virt{huge_to_virt(mut_huge_pool, *pmut_huge)};
+
+                this->unmap_huge(mut_tls, mut_page_pool, huge_virt, pmut_huge->size_bytes());
+                mut_huge_pool.deallocate(mut_tls, *pmut_huge);
+            }
+
+            m_huge_allocs_idx = {};
+            for (auto &mut_elem : m_huge_allocs) {
+                mut_elem = {};
+            }
+
+            this->release_pending(
+                mut_tls, mut_page_pool, m_pending_pages, m_pending_pages_idx, true);
+            this->release_pending(
+                mut_tls, mut_huge_pool, m_pending_huge, m_pending_huge_idx, true);
+
+            m_tlb_gen = {};
+            for (auto &mut_elem : m_tlb_acks) {
+                mut_elem = {};
+            }
+
+            m_huge_hwm = {};
+            m_huge_usage = {};
+            m_page_hwm = {};
+            m_page_usage = {};
+
+            m_tick_period = {};
+            m_tick_ip = {};
+            m_fail_ip = {};
+            m_vmexit_ip = {};
+            m_bootstrap_ip = {};
+            m_entry_ip = {};
+
+            m_rpt_reclaim_pending = {};
+            m_rpt_reclaim_idx = {};
+            for (auto &mut_elem : m_rpt_reclaim) {
+                mut_elem = {};
+            }
+
+            m_rpt_cache_idx = {};
+            for (auto &mut_elem : m_rpt_cache) {
+                mut_elem = {};
+            }
+
+            for (auto &mut_elem : m_vm_rpts) {
+                mut_elem = {};
+            }
+
+            for (auto &mut_rpt : m_direct_map_rpts) {
+                mut_rpt.release(mut_tls, mut_page_pool);
+            }
+
+            m_main_rpt.release(mut_tls, mut_page_pool);
+
+            m_is_executing_fail = {};
+            m_has_executed_start = {};
+            m_handle = {};
+            m_id = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the ID of this ext_t
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the ID of this ext_t
+        ///
+        [[nodiscard]] constexpr auto
+        id() const noexcept -> bsl::safe_u16
+        {
+            bsl::ensures(m_id.is_valid_and_checked());
+            return ~m_id;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the bootstrap IP for this extension.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the bootstrap IP for this extension.
+        ///
+        [[nodiscard]] constexpr auto
+        bootstrap_ip() const noexcept -> bsl::safe_u64 const &
+        {
+            bsl::ensures(m_bootstrap_ip.is_valid_and_checked());
+            return m_bootstrap_ip;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the bootstrap IP for this extension. This should
+        ///     be called by the syscall dispatcher as the result of a
+        ///     syscall from the extension defining what IP the extension
+        ///     would like to use for bootstrapping.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ip the bootstrap IP to use
+        ///
+        constexpr void
+        set_bootstrap_ip(bsl::safe_u64 const &ip) noexcept
+        {
+            bsl::expects(ip.is_valid_and_checked());
+            bsl::expects(ip.is_pos());
 
             m_bootstrap_ip = ip;
         }
@@ -1195,6 +2085,65 @@ namespace mk
             m_fail_ip = ip;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the tick IP for this extension.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the tick IP for this extension.
+        ///
+        [[nodiscard]] constexpr auto
+        tick_ip() const noexcept -> bsl::safe_u64 const &
+        {
+            bsl::ensures(m_tick_ip.is_valid_and_checked());
+            return m_tick_ip;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the tick IP for this extension. This should
+        ///     be called by the syscall dispatcher as the result of a
+        ///     syscall from the extension defining what IP the extension
+        ///     would like to use for ticks.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ip the tick IP to use
+        ///
+        constexpr void
+        set_tick_ip(bsl::safe_u64 const &ip) noexcept
+        {
+            bsl::expects(ip.is_valid_and_checked());
+            bsl::expects(ip.is_pos());
+
+            m_tick_ip = ip;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of TSC ticks between each tick.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of TSC ticks between each tick.
+        ///
+        [[nodiscard]] constexpr auto
+        tick_period() const noexcept -> bsl::safe_u64 const &
+        {
+            bsl::ensures(m_tick_period.is_valid_and_checked());
+            return m_tick_period;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the number of TSC ticks between each tick.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param period the number of TSC ticks between each tick
+        ///
+        constexpr void
+        set_tick_period(bsl::safe_u64 const &period) noexcept
+        {
+            bsl::expects(period.is_valid_and_checked());
+            bsl::expects(period.is_pos());
+
+            m_tick_period = period;
+        }
+
         /// <!-- description -->
         ///   @brief Opens a handle and returns the resulting handle
         ///
@@ -1291,12 +2240,16 @@ namespace mk
         [[nodiscard]] constexpr auto
         alloc_page(tls_t &mut_tls, page_pool_t &mut_page_pool) noexcept -> alloc_page_t
         {
+            lock_guard_t mut_lock{mut_tls, m_alloc_lock};
+            this->release_pending(mut_tls, mut_page_pool, m_pending_pages, m_pending_pages_idx);
+
             auto const page{m_main_rpt.allocate_page<>(mut_tls, mut_page_pool)};
             if (bsl::unlikely(page.virt.is_invalid())) {
                 bsl::print<bsl::V>() << bsl::here();
                 return {bsl::safe_u64::failure(), bsl::safe_u64::failure()};
             }
 
+            add_usage(m_page_usage, m_page_hwm, bsl::safe_umx::magic_1());
             this->update_direct_map_rpts(mut_tls);
             return page;
         }
@@ -1324,6 +2277,9 @@ namespace mk
             bsl::expects(size.is_valid_and_checked());
             bsl::expects(size.is_pos());
 
+            lock_guard_t mut_lock{mut_tls, m_alloc_lock};
+            this->release_pending(mut_tls, mut_huge_pool, m_pending_huge, m_pending_huge_idx);
+
             if (bsl::unlikely(m_huge_allocs_idx >= HYPERVISOR_MAX_HUGE_ALLOCS)) {
                 bsl::error() << "ext out of huge allocation slots\n" << bsl::endl;
                 return {bsl::safe_u64::failure(), bsl::safe_u64::failure()};
@@ -1335,73 +2291,245 @@ namespace mk
                 return {bsl::safe_u64::failure(), bsl::safe_u64::failure()};
             }
 
-            auto mut_huge{mut_huge_pool.allocate(mut_tls, mut_pages)};
-            if (bsl::unlikely(mut_huge.is_invalid())) {
-                bsl::print<bsl::V>() << bsl::here();
-                return {bsl::safe_u64::failure(), bsl::safe_u64::failure()};
+            auto mut_huge{mut_huge_pool.allocate(mut_tls, mut_pages)};
+            if (bsl::unlikely(mut_huge.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return {bsl::safe_u64::failure(), bsl::safe_u64::failure()};
+            }
+
+            auto const huge_phys{mut_huge_pool.virt_to_phys(mut_huge.data())};
+            auto const huge_virt{huge_to_virt(mut_huge_pool, mut_huge)};
+
+            /// NOTE:
+            /// - Huge allocations come from the kernel's direct map, which
+            ///   is the same size as the extension's direct map, something
+            ///   that is validated by CMake. As a result, the virtual and
+            ///   physical addresses below can never overflow which is why
+            ///   they are marked as checked().
+            ///
+
+            constexpr auto inc{bsl::to_idx(HYPERVISOR_PAGE_SIZE)};
+            for (bsl::safe_idx mut_i{}; mut_i < mut_bytes; mut_i += inc) {
+                auto const page_virt{(huge_virt + bsl::to_u64(mut_i)).checked()};
+                auto const page_phys{(huge_phys + bsl::to_u64(mut_i)).checked()};
+
+                auto const ret{m_main_rpt.map(
+                    mut_tls, mut_page_pool, page_virt, page_phys, MAP_PAGE_RW, true)};
+
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+
+                    /// NOTE:
+                    /// - Unlike free_huge(), the memory can be given back
+                    ///   right away, as the extension was never told where
+                    ///   it is mapped, so no PP could have touched it.
+                    ///
+
+                    this->unmap_huge(mut_tls, mut_page_pool, huge_virt, bsl::to_umx(mut_i));
+                    mut_huge_pool.deallocate(mut_tls, mut_huge);
+
+                    return {bsl::safe_u64::failure(), bsl::safe_u64::failure()};
+                }
+
+                bsl::touch();
+            }
+
+            *m_huge_allocs.at_if(m_huge_allocs_idx) = mut_huge;
+            ++m_huge_allocs_idx;
+
+            add_usage(m_huge_usage, m_huge_hwm, mut_pages);
+            this->update_direct_map_rpts(mut_tls);
+            return {huge_virt, huge_phys};
+        }
+
+        /// <!-- description -->
+        ///   @brief Frees a page previously allocated with alloc_page().
+        ///     The page is unmapped from the extension's address space
+        ///     (including all of the direct maps, which alias the tables
+        ///     of m_main_rpt) and the TLB of the PP that executes this
+        ///     function is flushed. The page is only returned to the page
+        ///     pool once every other PP has flushed its TLB as well, which
+        ///     each PP does on its next VMExit (see flush_tlb()).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param page_virt the virtual address of the page to free
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        free_page(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u64 const &page_virt) noexcept -> bsl::errc_type
+        {
+            constexpr auto min_addr{HYPERVISOR_EXT_PAGE_POOL_ADDR};
+
+            bsl::expects(page_virt.is_valid_and_checked());
+            bsl::expects(page_virt.is_pos());
+
+            if (bsl::unlikely(page_virt < min_addr)) {
+                bsl::error() << "virt "                                  // --
+                             << bsl::hex(page_virt)                      // --
+                             << " was not allocated using alloc_page"    // --
+                             << bsl::endl                                // --
+                             << bsl::here();                             // --
+
+                return bsl::errc_failure;
+            }
+
+            lock_guard_t mut_lock{mut_tls, m_alloc_lock};
+            this->release_pending(mut_tls, mut_page_pool, m_pending_pages, m_pending_pages_idx);
+
+            if (bsl::unlikely(m_pending_pages_idx >= EXT_MAX_PENDING_FREES)) {
+                bsl::error() << "ext has too many pages waiting on a TLB flush\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            /// NOTE:
+            /// - Only pages that were allocated by alloc_page() can be
+            ///   freed. These pages are auto released, are never explicitly
+            ///   unmapped, are not aliases and are always mapped to the page
+            ///   pool address plus the page's physical address. This is what
+            ///   prevents an extension from freeing its own stacks, TLS
+            ///   blocks, ELF segments or huge allocations.
+            ///
+
+            auto const ents{m_main_rpt.entries(mut_tls, mut_page_pool, page_virt)};
+            if (bsl::unlikely(nullptr == ents.l0e)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!is_alloc_page(*ents.l0e, page_virt))) {
+                bsl::error() << "virt "                                  // --
+                             << bsl::hex(page_virt)                      // --
+                             << " was not allocated using alloc_page"    // --
+                             << bsl::endl                                // --
+                             << bsl::here();                             // --
+
+                return bsl::errc_failure;
+            }
+
+            auto const page_phys{bsl::to_umx(ents.l0e->phys) << HYPERVISOR_PAGE_SHIFT};
+            auto *const pmut_page{mut_page_pool.phys_to_virt<page_4k_t>(page_phys)};
+
+            /// NOTE:
+            /// - m_main_rpt defers releasing memory, so the unmap below
+            ///   neither returns the page nor any empty table to the page
+            ///   pool. The tables stay in place, which means that the
+            ///   aliases in the direct maps remain valid, and the page is
+            ///   added to the pending frees instead.
+            ///
+
+            auto const ret{m_main_rpt.unmap(mut_tls, mut_page_pool, page_virt)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            intrinsic.tlb_flush(page_virt);
+
+            bsl::span<page_4k_t> const page{pmut_page, bsl::safe_umx::magic_1()};
+            this->defer_free(m_pending_pages, m_pending_pages_idx, page);
+
+            m_page_usage -= bsl::safe_umx::magic_1();
+            return ret;
+        }
+
+        /// <!-- description -->
+        ///   @brief Frees memory previously allocated with alloc_huge(). The
+        ///     memory is unmapped from the extension's address space
+        ///     (including all of the direct maps, which alias the tables
+        ///     of m_main_rpt) and the TLB of the PP that executes this
+        ///     function is flushed. The memory is only returned to the huge
+        ///     pool once every other PP has flushed its TLB as well, which
+        ///     each PP does on its next VMExit (see flush_tlb()).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param mut_huge_pool the huge_pool_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param huge_virt the virtual address returned by alloc_huge()
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        free_huge(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            huge_pool_t &mut_huge_pool,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u64 const &huge_virt) noexcept -> bsl::errc_type
+        {
+            bsl::expects(huge_virt.is_valid_and_checked());
+            bsl::expects(huge_virt.is_pos());
+
+            lock_guard_t mut_lock{mut_tls, m_alloc_lock};
+            this->release_pending(mut_tls, mut_huge_pool, m_pending_huge, m_pending_huge_idx);
+
+            if (bsl::unlikely(m_pending_huge_idx >= EXT_MAX_PENDING_FREES)) {
+                bsl::error() << "ext has too many huge allocations waiting on a TLB flush\n"
+                             << bsl::here();
+                return bsl::errc_failure;
             }
 
-            /// TODO:
-            /// - We really should register the allocation at the end of this
-            ///   function, and on failure, we would just call free_huge()
-            ///   so that all of the memory can be unmapped and deallocated
-            ///   there. By registering here, if the map() below fails, we
-            ///   are not leaking memory, but the allocation is lost and can
-            ///   never be used again.
-            ///
-            /// - For now this works because if the allocation fails, there
-            ///   likely is no way to recover anyways as this is such a
-            ///   limited resource, but if free_huge() is ever implemented,
-            ///   this should be changed to "undo" what was done here so
-            ///   that the huge allocation can be used in the future.
-            ///
+            bsl::safe_idx mut_i{};
+            for (; mut_i < m_huge_allocs_idx; ++mut_i) {
+                if (huge_to_virt(mut_huge_pool, *m_huge_allocs.at_if(mut_i)) == huge_virt) {
+                    break;
+                }
 
-            *m_huge_allocs.at_if(m_huge_allocs_idx) = mut_huge;
-            ++m_huge_allocs_idx;
+                bsl::touch();
+            }
 
-            auto const huge_phys{mut_huge_pool.virt_to_phys(mut_huge.data())};
-            bsl::expects(huge_phys.is_valid_and_checked());
-            bsl::expects(huge_phys.is_pos());
+            if (bsl::unlikely(mut_i >= m_huge_allocs_idx)) {
+                bsl::error() << "virt "                                  // --
+                             << bsl::hex(huge_virt)                      // --
+                             << " was not allocated using alloc_huge"    // --
+                             << bsl::endl                                // --
+                             << bsl::here();                             // --
 
-            auto const huge_virt{(HYPERVISOR_EXT_HUGE_POOL_ADDR + huge_phys).checked()};
-            bsl::expects(huge_virt.is_valid_and_checked());
-            bsl::expects(huge_virt.is_pos());
+                return bsl::errc_failure;
+            }
 
-            /// NOTE:
-            /// - Huge allocations come from the kernel's direct map, which
-            ///   is the same size as the extension's direct map, something
-            ///   that is validated by CMake. As a result, the virtual and
-            ///   physical addresses below can never overflow which is why
-            ///   they are marked as checked().
-            ///
+            auto const huge{*m_huge_allocs.at_if(mut_i)};
+            this->unmap_huge(mut_tls, mut_page_pool, huge_virt, huge.size_bytes());
 
             constexpr auto inc{bsl::to_idx(HYPERVISOR_PAGE_SIZE)};
-            for (bsl::safe_idx mut_i{}; mut_i < mut_bytes; mut_i += inc) {
-                auto const page_virt{(huge_virt + bsl::to_u64(mut_i)).checked()};
-                auto const page_phys{(huge_phys + bsl::to_u64(mut_i)).checked()};
+            for (bsl::safe_idx mut_j{}; mut_j < huge.size_bytes(); mut_j += inc) {
+                intrinsic.tlb_flush((huge_virt + bsl::to_u64(mut_j)).checked());
+            }
 
-                auto const ret{m_main_rpt.map(
-                    mut_tls, mut_page_pool, page_virt, page_phys, MAP_PAGE_RW, true)};
+            this->defer_free(m_pending_huge, m_pending_huge_idx, huge);
 
-                if (bsl::unlikely(!ret)) {
-                    bsl::print<bsl::V>() << bsl::here();
-                    return {bsl::safe_u64::failure(), bsl::safe_u64::failure()};
-                }
+            /// NOTE:
+            /// - The order of m_huge_allocs does not matter, so the last
+            ///   allocation is moved into the slot that was just freed.
+            ///
 
-                bsl::touch();
-            }
+            --m_huge_allocs_idx;
+            *m_huge_allocs.at_if(mut_i) = *m_huge_allocs.at_if(m_huge_allocs_idx);
+            *m_huge_allocs.at_if(m_huge_allocs_idx) = {};
 
-            this->update_direct_map_rpts(mut_tls);
-            return {huge_virt, huge_phys};
+            m_huge_usage -= huge.size();
+            return bsl::errc_success;
         }
 
         /// <!-- description -->
         ///   @brief Maps a page into the direct map portion of the requested
-        ///     VM's direct map RPT given a physical address to map.
+        ///     VM's direct map RPT given a physical address to map. If the
+        ///     VM does not have a direct map RPT yet, one is created, and if
+        ///     the VM is active on this PP, it is activated.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_tls the current TLS block
         ///   @param mut_page_pool the page_pool_t to use
+        ///   @param mut_intrinsic the intrinsic_t to use
         ///   @param vmid the ID of the VM to map page_phys to
         ///   @param page_phys the physical address to map
         ///   @return Returns the virtual address the physical address was
@@ -1412,13 +2540,14 @@ namespace mk
         map_page_direct(
             tls_t &mut_tls,
             page_pool_t &mut_page_pool,
+            intrinsic_t &mut_intrinsic,
             bsl::safe_u16 const &vmid,
             bsl::safe_u64 const &page_phys) noexcept -> bsl::safe_u64
         {
             constexpr auto min_addr{HYPERVISOR_EXT_DIRECT_MAP_ADDR};
 
             bsl::expects(vmid.is_valid_and_checked());
-            bsl::expects(bsl::to_umx(vmid) < m_direct_map_rpts.size());
+            bsl::expects(bsl::to_umx(vmid) < m_vm_rpts.size());
             bsl::expects(page_phys.is_valid_and_checked());
             bsl::expects(page_phys.is_pos());
             bsl::expects(page_phys < min_addr);
@@ -1432,8 +2561,11 @@ namespace mk
             bsl::expects(page_virt.is_valid_and_checked());
             bsl::expects(page_virt.is_pos());
 
-            auto *const pmut_direct_map_rpt{m_direct_map_rpts.at_if(bsl::to_idx(vmid))};
-            bsl::expects(nullptr != pmut_direct_map_rpt);
+            auto *const pmut_direct_map_rpt{this->get_direct_map_rpt(mut_tls, mut_page_pool, vmid)};
+            if (bsl::unlikely(nullptr == pmut_direct_map_rpt)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_u64::failure();
+            }
 
             auto const ret{pmut_direct_map_rpt->map(
                 mut_tls, mut_page_pool, page_virt, page_phys, MAP_PAGE_RW)};
@@ -1442,6 +2574,7 @@ namespace mk
                 return bsl::safe_u64::failure();
             }
 
+            activate_direct_map_rpt(mut_tls, mut_intrinsic, vmid, pmut_direct_map_rpt);
             return page_virt;
         }
 
@@ -1470,14 +2603,23 @@ namespace mk
             constexpr auto max_addr{(min_addr + HYPERVISOR_EXT_DIRECT_MAP_SIZE).checked()};
 
             bsl::expects(vmid.is_valid_and_checked());
-            bsl::expects(bsl::to_umx(vmid) < m_direct_map_rpts.size());
+            bsl::expects(bsl::to_umx(vmid) < m_vm_rpts.size());
             bsl::expects(page_virt.is_valid_and_checked());
             bsl::expects(page_virt.is_pos());
             bsl::expects(page_virt >= min_addr);
             bsl::expects(page_virt <= max_addr);
 
-            auto *const pmut_direct_map_rpt{m_direct_map_rpts.at_if(bsl::to_idx(vmid))};
-            bsl::expects(nullptr != pmut_direct_map_rpt);
+            auto *const pmut_direct_map_rpt{*m_vm_rpts.at_if(bsl::to_idx(vmid))};
+            if (bsl::unlikely(nullptr == pmut_direct_map_rpt)) {
+                bsl::error() << "vm "                  // --
+                             << bsl::hex(vmid)         // --
+                             << " has nothing mapped into the direct map of ext "
+                             << bsl::hex(this->id())   // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return bsl::errc_failure;
+            }
 
             auto const ret{pmut_direct_map_rpt->unmap(mut_tls, mut_page_pool, page_virt)};
             if (bsl::unlikely(!ret)) {
@@ -1490,38 +2632,190 @@ namespace mk
         }
 
         /// <!-- description -->
-        ///   @brief Tells the extension that a VM was created so that it
-        ///     can initialize it's VM specific resources.
+        ///   @brief Maps a physically contiguous range into the direct map
+        ///     portion of the requested VM's direct map RPT. Unlike
+        ///     map_page_direct(), the range is mapped using 2M and 1G pages
+        ///     wherever the alignment of the range allows, with 4K pages
+        ///     used for whatever is left over at the start and end of the
+        ///     range. If the range cannot be mapped in its entirety, any
+        ///     portion of the range that was mapped is unmapped.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_tls the current TLS block
         ///   @param mut_page_pool the page_pool_t to use
-        ///   @param vmid the ID of the VM that was created.
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///   @param vmid the ID of the VM to map the range to
+        ///   @param phys the physical address of the start of the range
+        ///   @param bytes the total number of bytes to map
+        ///   @return Returns the virtual address the start of the range was
+        ///     mapped to in the direct map. On failure returns
+        ///     bsl::safe_u64::failure().
+        ///
+        [[nodiscard]] constexpr auto
+        map_range_direct(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            intrinsic_t &mut_intrinsic,
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u64 const &phys,
+            bsl::safe_u64 const &bytes) noexcept -> bsl::safe_u64
+        {
+            constexpr auto min_addr{HYPERVISOR_EXT_DIRECT_MAP_ADDR};
+
+            bsl::expects(vmid.is_valid_and_checked());
+            bsl::expects(bsl::to_umx(vmid) < m_vm_rpts.size());
+            bsl::expects(phys.is_valid_and_checked());
+            bsl::expects(phys.is_pos());
+            bsl::expects(bytes.is_valid_and_checked());
+            bsl::expects(bytes.is_pos());
+            bsl::expects((phys + bytes).checked() <= min_addr);
+
+            /// NOTE:
+            /// - CMake ensures that the addr and size make sense which is why
+            ///   the following is marked as checked.
+            ///
+
+            auto const virt{(phys + min_addr).checked()};
+            bsl::expects(virt.is_valid_and_checked());
+            bsl::expects(virt.is_pos());
+
+            auto *const pmut_direct_map_rpt{this->get_direct_map_rpt(mut_tls, mut_page_pool, vmid)};
+            if (bsl::unlikely(nullptr == pmut_direct_map_rpt)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_u64::failure();
+            }
+
+            bsl::safe_u64 mut_off{};
+            while (mut_off < bytes) {
+                auto const page_virt{(virt + mut_off).checked()};
+                auto const page_phys{(phys + mut_off).checked()};
+                auto const page_size{
+                    direct_map_page_size(mut_intrinsic, page_virt, (bytes - mut_off).checked())};
+
+                bsl::errc_type mut_ret{};
+                if (page_size == lib::BASIC_PAGE_1G_T_SIZE) {
+                    mut_ret = pmut_direct_map_rpt->map<lib::l2e_t>(
+                        mut_tls, mut_page_pool, page_virt, page_phys, MAP_PAGE_RW);
+                }
+                else if (page_size == lib::BASIC_PAGE_2M_T_SIZE) {
+                    mut_ret = pmut_direct_map_rpt->map<lib::l1e_t>(
+                        mut_tls, mut_page_pool, page_virt, page_phys, MAP_PAGE_RW);
+                }
+                else {
+                    mut_ret = pmut_direct_map_rpt->map(
+                        mut_tls, mut_page_pool, page_virt, page_phys, MAP_PAGE_RW);
+                }
+
+                if (bsl::unlikely(!mut_ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    bsl::discard(unmap_direct_map_range(
+                        mut_tls, mut_page_pool, mut_intrinsic, pmut_direct_map_rpt, virt, mut_off));
+
+                    return bsl::safe_u64::failure();
+                }
+
+                mut_off += page_size;
+            }
+
+            activate_direct_map_rpt(mut_tls, mut_intrinsic, vmid, pmut_direct_map_rpt);
+            return virt;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps a range from the direct map portion of the
+        ///     requested VM's direct map RPT. The range must match a range
+        ///     that was previously mapped using map_range_direct() as the
+        ///     range is broken up into 1G, 2M and 4K pages the same way
+        ///     map_range_direct() broke it up. Like unmap_page_direct(),
+        ///     the TLB is only flushed on this PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param vmid the ID of the VM to unmap the range from
+        ///   @param virt the virtual address of the start of the range
+        ///   @param bytes the total number of bytes to unmap
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     and friends otherwise
         ///
         [[nodiscard]] constexpr auto
-        signal_vm_created(
-            tls_t &mut_tls, page_pool_t &mut_page_pool, bsl::safe_u16 const &vmid) noexcept
-            -> bsl::errc_type
+        unmap_range_direct(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u64 const &virt,
+            bsl::safe_u64 const &bytes) noexcept -> bsl::errc_type
         {
+            constexpr auto min_addr{HYPERVISOR_EXT_DIRECT_MAP_ADDR};
+            constexpr auto max_addr{(min_addr + HYPERVISOR_EXT_DIRECT_MAP_SIZE).checked()};
+
             bsl::expects(vmid.is_valid_and_checked());
-            bsl::expects(bsl::to_umx(vmid) < m_direct_map_rpts.size());
+            bsl::expects(bsl::to_umx(vmid) < m_vm_rpts.size());
+            bsl::expects(virt.is_valid_and_checked());
+            bsl::expects(virt.is_pos());
+            bsl::expects(virt >= min_addr);
+            bsl::expects(bytes.is_valid_and_checked());
+            bsl::expects(bytes.is_pos());
+            bsl::expects((virt + bytes).checked() <= max_addr);
+
+            auto *const pmut_direct_map_rpt{*m_vm_rpts.at_if(bsl::to_idx(vmid))};
+            if (bsl::unlikely(nullptr == pmut_direct_map_rpt)) {
+                bsl::error() << "vm "                  // --
+                             << bsl::hex(vmid)         // --
+                             << " has nothing mapped into the direct map of ext "
+                             << bsl::hex(this->id())   // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
 
-            auto const ret{this->initialize_direct_map_rpt(
-                mut_tls, mut_page_pool, m_direct_map_rpts.at_if(bsl::to_idx(vmid)))};
+                return bsl::errc_failure;
+            }
 
+            auto const ret{unmap_direct_map_range(
+                mut_tls, mut_page_pool, intrinsic, pmut_direct_map_rpt, virt, bytes)};
             if (bsl::unlikely(!ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return ret;
             }
 
-            return ret;
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the extension that a VM was created so that it
+        ///     can initialize it's VM specific resources. The only VM
+        ///     specific resource is the VM's direct map RPT, which is
+        ///     created by map_page_direct() the first time it is needed,
+        ///     so there is nothing to do here.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param vmid the ID of the VM that was created.
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        signal_vm_created(
+            tls_t &mut_tls, page_pool_t &mut_page_pool, bsl::safe_u16 const &vmid) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(vmid.is_valid_and_checked());
+            bsl::expects(bsl::to_umx(vmid) < m_vm_rpts.size());
+            bsl::expects(nullptr == *m_vm_rpts.at_if(bsl::to_idx(vmid)));
+
+            bsl::discard(mut_tls);
+            bsl::discard(mut_page_pool);
+
+            return bsl::errc_success;
         }
 
         /// <!-- description -->
         ///   @brief Tells the extension that a VM was destroyed so that it
-        ///     can release it's VM specific resources.
+        ///     can release it's VM specific resources. If the VM has a
+        ///     direct map RPT, it is detached from the VM and added to
+        ///     m_rpt_reclaim, leaving the actual teardown to reclaim().
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_tls the current TLS block
@@ -1533,9 +2827,129 @@ namespace mk
             tls_t &mut_tls, page_pool_t &mut_page_pool, bsl::safe_u16 const &vmid) noexcept
         {
             bsl::expects(vmid.is_valid_and_checked());
-            bsl::expects(bsl::to_umx(vmid) < m_direct_map_rpts.size());
+            bsl::expects(bsl::to_umx(vmid) < m_vm_rpts.size());
+
+            auto *const pmut_vm_rpt{m_vm_rpts.at_if(bsl::to_idx(vmid))};
+            auto *const pmut_rpt{*pmut_vm_rpt};
+            if (nullptr == pmut_rpt) {
+                return;
+            }
+
+            *pmut_vm_rpt = {};
+
+            /// NOTE:
+            /// - Tearing down a direct map RPT can take a long time if the
+            ///   VM mapped a lot of memory, so it is not done here. Instead,
+            ///   the RPT is handed to reclaim(), which each PP calls between
+            ///   VMExits to tear it down a batch at a time. Since a VM can
+            ///   only own one direct map RPT, m_rpt_reclaim cannot overflow.
+            ///
+
+            bsl::discard(mut_page_pool);
+            lock_guard_t mut_lock{mut_tls, m_rpt_lock};
+
+            this->push_rpt_reclaim(pmut_rpt);
+            this->inc_rpt_reclaim_pending(bsl::safe_umx::magic_1());
+        }
+
+        /// <!-- description -->
+        ///   @brief Reclaims a single batch of the memory owned by the
+        ///     direct map RPTs of destroyed VMs. Once an RPT has been fully
+        ///     reclaimed, it is added to m_rpt_cache so that the next VM
+        ///     does not have to allocate a new one. If the cache is full,
+        ///     the RPT is released instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///
+        constexpr void
+        reclaim(tls_t &mut_tls, page_pool_t &mut_page_pool) noexcept
+        {
+            /// NOTE:
+            /// - This is called between VMExits, so we make sure there is
+            ///   work to do before taking the lock. If another PP adds work
+            ///   after this check, it is picked up by the next call.
+            /// - The RPT is removed from m_rpt_reclaim while a batch is
+            ///   torn down so that m_rpt_lock is only held long enough to
+            ///   pop it and to hand it back, and not while memory is being
+            ///   returned to the page pool.
+            ///
+
+            if (this->rpt_reclaim_pending().is_zero()) {
+                return;
+            }
+
+            root_page_table_t *pmut_mut_rpt{};
+            {
+                lock_guard_t mut_lock{mut_tls, m_rpt_lock};
+                pmut_mut_rpt = this->pop_rpt_reclaim();
+            }
+
+            if (nullptr == pmut_mut_rpt) {
+                return;
+            }
+
+            bool const done{pmut_mut_rpt->reclaim(mut_tls, mut_page_pool)};
+            lock_guard_t mut_lock{mut_tls, m_rpt_lock};
+
+            if (!done) {
+                this->push_rpt_reclaim(pmut_mut_rpt);
+                return;
+            }
+
+            if (m_rpt_cache_idx >= HYPERVISOR_MAX_CACHED_RPTS) {
+                pmut_mut_rpt->release(mut_tls, mut_page_pool);
+            }
+            else {
+                *m_rpt_cache.at_if(m_rpt_cache_idx) = pmut_mut_rpt;
+                ++m_rpt_cache_idx;
+            }
+
+            this->dec_rpt_reclaim_pending(bsl::safe_umx::magic_1());
+        }
+
+        /// <!-- description -->
+        ///   @brief Flushes this PP's TLB if free_page() or free_huge() has
+        ///     unmapped memory since the last time this PP flushed it, and
+        ///     records that this PP is done with that memory. Freed memory
+        ///     is only returned to the page pool (or huge pool) once every
+        ///     online PP has done this. This must be called on each VMExit
+        ///     before the extension is executed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        flush_tlb(tls_t &mut_tls, intrinsic_t &mut_intrinsic) noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                return;
+            }
+
+            auto *const pmut_ack{m_tlb_acks.at_if(bsl::to_idx(mut_tls.ppid))};
+            bsl::expects(nullptr != pmut_ack);
+
+            auto const gen{__atomic_load_n(&m_tlb_gen, __ATOMIC_ACQUIRE)};
+            if (gen == *pmut_ack) {
+                return;
+            }
+
+            /// NOTE:
+            /// - Activating the active RPT again flushes the TLB (as it is
+            ///   not tagged), no matter which RPT is active.
+            ///
 
-            m_direct_map_rpts.at_if(bsl::to_idx(vmid))->release(mut_tls, mut_page_pool);
+            auto *const pmut_rpt{static_cast<root_page_table_t *>(mut_tls.active_rpt)};
+            if (nullptr != pmut_rpt) {
+                pmut_rpt->activate(mut_tls, mut_intrinsic);
+            }
+            else {
+                bsl::touch();
+            }
+
+            __atomic_store_n(pmut_ack, gen, __ATOMIC_RELEASE);
         }
 
         /// <!-- description -->
@@ -1552,12 +2966,9 @@ namespace mk
             tls_t &mut_tls, intrinsic_t &mut_intrinsic, bsl::safe_u16 const &vmid) noexcept
         {
             bsl::expects(vmid.is_valid_and_checked());
-            bsl::expects(bsl::to_umx(mut_tls.active_vmid) < m_direct_map_rpts.size());
+            bsl::expects(bsl::to_umx(mut_tls.active_vmid) < m_vm_rpts.size());
 
-            auto *const pmut_rpt{m_direct_map_rpts.at_if(bsl::to_idx(mut_tls.active_vmid))};
-            bsl::expects(nullptr != pmut_rpt);
-
-            pmut_rpt->activate(mut_tls, mut_intrinsic);
+            this->active_rpt(bsl::to_u16(mut_tls.active_vmid))->activate(mut_tls, mut_intrinsic);
         }
 
         /// <!-- description -->
@@ -1647,6 +3058,30 @@ namespace mk
             return ret;
         }
 
+        /// <!-- description -->
+        ///   @brief Executes the extension's tick entry point. Like a
+        ///     VMExit, the extension is given the ID of the VS that was
+        ///     active when the tick fired, and must resume it when done.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        tick(tls_t &mut_tls, intrinsic_t &mut_intrinsic) noexcept -> bsl::errc_type
+        {
+            auto const arg{bsl::to_u64(mut_tls.active_vsid)};
+            auto const ret{this->execute(mut_tls, mut_intrinsic, m_tick_ip, arg)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            return ret;
+        }
+
         /// <!-- description -->
         ///   @brief Bootstraps the extension by executing it's bootstrap entry
         ///     point. If the extension has not been initialized, this function
@@ -1803,6 +3238,21 @@ namespace mk
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::endl;
 
+            /// Tick IP
+            ///
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<14s", "tick ip "};
+            bsl::print() << bsl::ylw << "| ";
+            if (m_tick_ip.is_pos()) {
+                bsl::print() << bsl::rst << bsl::hex(m_tick_ip) << ' ';
+            }
+            else {
+                bsl::print() << bsl::red << bsl::fmt{"^19s", "not registered "};
+            }
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
             /// Handle
             ///
 
@@ -1818,6 +3268,46 @@ namespace mk
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::endl;
 
+            /// Pages In Use
+            ///
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<14s", "pages in use "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::hex(m_page_usage) << ' ';
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Pages Peak
+            ///
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<14s", "pages peak "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::hex(m_page_hwm) << ' ';
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Huge In Use
+            ///
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<14s", "huge in use "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::hex(m_huge_usage) << ' ';
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Huge Peak
+            ///
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<14s", "huge peak "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::hex(m_huge_hwm) << ' ';
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
             /// Footer
             ///
 
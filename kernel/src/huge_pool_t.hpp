@@ -30,14 +30,16 @@
 #include <spinlock_t.hpp>
 #include <tls_t.hpp>
 
+#include <bsl/array.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/cstring.hpp>
 #include <bsl/debug.hpp>
-#include <bsl/discard.hpp>
 #include <bsl/ensures.hpp>
 #include <bsl/expects.hpp>
+#include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/span.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace mk
@@ -47,17 +49,31 @@ namespace mk
     ///     memory. The amount of memory that is available is really, really
     ///     small (likely no more than 1 MB), but some is needed for different
     ///     architectures that require it like AMD. This memory is only needed
-    ///     by the extensions, and we currently do not support the ability
-    ///     to free memory, so there is no need to over complicate how this
-    ///     allocator works. We simply use a cursor that is always increasing.
-    ///     Once you allocate all of the memory, that is it.
+    ///     by the extensions, so there is no need to over complicate how
+    ///     this allocator works. We use a cursor to hand out memory that has
+    ///     never been used, and a small list of coalesced runs to keep track
+    ///     of memory that has been given back. A free that ends at the
+    ///     cursor simply moves the cursor back.
     ///
     class huge_pool_t final
     {
+        /// @brief describes a run of pages that was given back to the pool
+        struct free_run_t final
+        {
+            /// @brief stores the index of the first page in the run
+            bsl::safe_umx first;
+            /// @brief stores the total number of pages in the run (0 if unused)
+            bsl::safe_umx pages;
+        };
+
         /// @brief stores the range of memory used by this allocator
         bsl::span<page_4k_t> m_pool{};
         /// @brief stores the huge pool's cursor
         bsl::safe_umx m_crsr{};
+        /// @brief stores the runs of free pages that sit below the cursor
+        bsl::array<free_run_t, HYPERVISOR_MAX_HUGE_ALLOCS.get()> m_runs{};
+        /// @brief stores the total number of pages stored in m_runs
+        bsl::safe_umx m_freed{};
         /// @brief safe guards operations on the pool.
         mutable spinlock_t m_lock{};
 
@@ -114,7 +130,7 @@ namespace mk
             ///   function ensures this math will never overflow.
             ///
 
-            return (m_crsr * HYPERVISOR_PAGE_SIZE).checked();
+            return ((m_crsr - m_freed) * HYPERVISOR_PAGE_SIZE).checked();
         }
 
         /// <!-- description -->
@@ -134,6 +150,29 @@ namespace mk
             return (this->size() - this->allocated()).checked();
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the index of the provided page in the pool, or
+        ///     bsl::safe_umx::failure() if the page is not in the pool.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param page the page to look up
+        ///   @return Returns the index of the provided page in the pool, or
+        ///     bsl::safe_umx::failure() if the page is not in the pool.
+        ///
+        [[nodiscard]] constexpr auto
+        index_of(page_4k_t const *const page) const noexcept -> bsl::safe_umx
+        {
+            for (bsl::safe_idx mut_i{}; mut_i < m_pool.size(); ++mut_i) {
+                if (m_pool.at_if(mut_i) == page) {
+                    return bsl::to_umx(mut_i);
+                }
+
+                bsl::touch();
+            }
+
+            return bsl::safe_umx::failure();
+        }
+
     public:
         /// <!-- description -->
         ///   @brief Creates the huge pool given a mutable_buffer_t to
@@ -166,6 +205,26 @@ namespace mk
             bsl::expects(pages.is_valid_and_checked());
             bsl::expects(pages.is_pos());
 
+            for (auto &mut_run : m_runs) {
+                if (mut_run.pages < pages) {
+                    continue;
+                }
+
+                /// NOTE:
+                /// - Runs only ever describe memory below the cursor, so the
+                ///   math below cannot overflow, which is why it is marked
+                ///   as checked.
+                ///
+
+                auto mut_buf{m_pool.subspan(bsl::to_idx(mut_run.first), pages)};
+                mut_run.first = (mut_run.first + pages).checked();
+                mut_run.pages = (mut_run.pages - pages).checked();
+                m_freed = (m_freed - pages).checked();
+
+                bsl::builtin_memset(mut_buf.data(), '\0', mut_buf.size_bytes());
+                return mut_buf;
+            }
+
             auto mut_buf{m_pool.subspan(bsl::to_idx(m_crsr), pages)};
             if (bsl::unlikely(mut_buf.size() != pages)) {
                 bsl::error() << "huge pool out of memory\n" << bsl::here();
@@ -186,7 +245,9 @@ namespace mk
         }
 
         /// <!-- description -->
-        ///   @brief Not supported
+        ///   @brief Returns memory previously allocated with allocate() back
+        ///     to the huge pool. The provided span must be exactly what was
+        ///     returned by allocate().
         ///
         /// <!-- inputs/outputs -->
         ///   @param tls the current TLS block
@@ -196,25 +257,64 @@ namespace mk
         deallocate(tls_t const &tls, bsl::span<page_4k_t> const &buf) noexcept
         {
             lock_guard_t mut_lock{tls, m_lock};
-            bsl::discard(buf);
+
+            if (buf.empty()) {
+                return;
+            }
+
+            auto mut_first{this->index_of(buf.data())};
+            bsl::expects(mut_first.is_valid_and_checked());
 
             /// NOTE:
-            /// - If this function is implemented, we will have to deal with
-            ///   deallocations being a page in size. Specifically, right now
-            ///   a huge page is allocated and mapped into the page tables
-            ///   one page at a time. When is is time to deallocate, this
-            ///   memory is released one page at a time. If the page tables
-            ///   are deallocating one page of a larger physically contiguous
-            ///   memory region, it should be assumed that the entire region
-            ///   will be freed, it will just happen in page increments.
-            /// - What this means is this function could see a free for the
-            ///   same physically contiguous block of memory (one for each
-            ///   page in the block). We could ignore the extras, or we
-            ///   could set up the allocator so that it frees one page at a
-            ///   time. Just depends on how we want to do this... but in
-            ///   general, I would suggest using the later as a buddy allocator
-            ///   can support this without any added overhead.
+            /// - The buffer came from allocate(), which means that it sits
+            ///   below the cursor, and as a result, none of the math below
+            ///   can overflow, which is why it is marked as checked.
             ///
+
+            auto mut_pages{buf.size()};
+            auto const last{(mut_first + mut_pages).checked()};
+            bsl::expects(last <= m_crsr);
+
+            for (auto &mut_run : m_runs) {
+                if (mut_run.pages.is_zero()) {
+                    continue;
+                }
+
+                if ((mut_run.first + mut_run.pages).checked() == mut_first) {
+                    mut_first = mut_run.first;
+                }
+                else if (mut_run.first != last) {
+                    continue;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                mut_pages = (mut_pages + mut_run.pages).checked();
+                m_freed = (m_freed - mut_run.pages).checked();
+                mut_run = {};
+            }
+
+            if ((mut_first + mut_pages).checked() == m_crsr) {
+                m_crsr = mut_first;
+                return;
+            }
+
+            for (auto &mut_run : m_runs) {
+                if (mut_run.pages.is_pos()) {
+                    continue;
+                }
+
+                mut_run = {mut_first, mut_pages};
+                m_freed = (m_freed + mut_pages).checked();
+                return;
+            }
+
+            bsl::alert() << "huge pool out of free runs. "     // --
+                         << bsl::hex(mut_pages)                // --
+                         << " pages were leaked"               // --
+                         << bsl::endl                          // --
+                         << bsl::here();                       // --
         }
 
         /// <!-- description -->
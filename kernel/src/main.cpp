@@ -27,11 +27,17 @@
 #include <ext_pool_t.hpp>
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
+#include <log_mask.hpp>
 #include <mk_args_t.hpp>
 #include <mk_main_t.hpp>
 #include <page_pool_t.hpp>
 #include <root_page_table_t.hpp>
+#include <serial_ring.hpp>
+#include <serial_ring_t.hpp>
+#include <syscall_stats_t.hpp>
 #include <tls_t.hpp>
+#include <trace.hpp>
+#include <trace_ring_t.hpp>
 #include <vm_pool_t.hpp>
 #include <vmexit_log_t.hpp>
 #include <vmexit_loop.hpp>
@@ -52,10 +58,27 @@ namespace mk
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
     extern "C" constinit loader::debug_ring_t *g_pmut_mut_debug_ring{};
 
+    /// @brief stores the serial rings used by the microkernel
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    extern "C" constinit serial_ring_t g_mut_serial_ring{};
+
+    /// @brief stores the runtime log mask used by the microkernel
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    extern "C" constinit bsl::uint64 g_mut_log_mask{HYPERVISOR_LOG_MASK.get()};
+
+    /// @brief stores a pointer to each PP's trace ring provided by the loader
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    extern "C" constinit bsl::array<loader::trace_ring_t *, HYPERVISOR_MAX_PPS.get()>
+        g_mut_trace_rings{};
+
     /// @brief stores the vmexit log used by the microkernel
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
     constinit inline vmexit_log_t g_mut_vmexit_log{};
 
+    /// @brief stores the syscall stats used by the microkernel
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    constinit inline syscall_stats_t g_mut_syscall_stats{};
+
     /// @brief stores the page_pool_t used by the microkernel
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
     constinit inline page_pool_t g_mut_page_pool{};
@@ -130,7 +153,8 @@ namespace mk
                    g_mut_vp_pool,
                    g_mut_vs_pool,
                    g_mut_ext_pool,
-                   g_mut_vmexit_log)
+                   g_mut_vmexit_log,
+                   g_mut_syscall_stats)
             .get();
     }
 
@@ -151,7 +175,10 @@ namespace mk
         bsl::expects(nullptr != pmut_tls);
         bsl::expects(nullptr != pmut_args);
 
-        return g_mut_mk_main.process(
+        refresh_log_mask(*pmut_tls);
+        trace_set_ring(bsl::to_u16(pmut_args->ppid), pmut_args->trace_ring);
+
+        auto const ret{g_mut_mk_main.process(
             *pmut_tls,
             g_mut_page_pool,
             g_mut_huge_pool,
@@ -162,6 +189,9 @@ namespace mk
             g_mut_ext_pool,
             g_mut_system_rpt,
             g_mut_vmexit_log,
-            *pmut_args);
+            *pmut_args)};
+
+        serial_ring_flush(*pmut_tls);
+        return ret;
     }
 }
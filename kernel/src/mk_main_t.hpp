@@ -44,6 +44,7 @@
 #include <bsl/ensures.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/expects.hpp>
+#include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/span.hpp>
 #include <bsl/touch.hpp>
@@ -68,6 +69,8 @@ namespace mk
         ext_t *m_ext_vmexit{};
         /// @brief stores the registered fast fail handler
         ext_t *m_ext_fail{};
+        /// @brief stores the registered tick handler (optional)
+        ext_t *m_ext_tick{};
 
         /// <!-- description -->
         ///   @brief Verifies that the mut_args and the resulting TLS block
@@ -109,7 +112,8 @@ namespace mk
             bsl::expects(nullptr != mut_args.ext_elf_files.front());
             bsl::expects(nullptr != mut_args.rpt);
             bsl::expects(bsl::safe_umx::magic_0() != mut_args.rpt_phys);
-            bsl::expects(mut_args.page_pool.is_valid());
+            bsl::expects(bsl::to_umx(mut_args.node) < HYPERVISOR_MAX_NUMA_NODES);
+            bsl::expects(mut_args.page_pool.front().is_valid());
             bsl::expects(mut_args.huge_pool.is_valid());
         }
 
@@ -385,7 +389,12 @@ namespace mk
         {
             bsl::errc_type mut_ret{};
 
-            mut_page_pool.initialize(mut_args.page_pool);
+            for (bsl::safe_idx mut_i{}; mut_i < mut_args.page_pool.size(); ++mut_i) {
+                mut_page_pool.initialize(*mut_args.page_pool.at_if(mut_i), mut_i);
+            }
+
+            mut_page_pool.initialize_reserve(mut_args.page_pool_reserve);
+
             mut_huge_pool.initialize(mut_args.huge_pool);
 
             mut_ret = mut_system_rpt.initialize(mut_tls, mut_page_pool);
@@ -401,7 +410,12 @@ namespace mk
             mut_vm_pool.initialize();
 
             mut_ret = mut_ext_pool.initialize(
-                mut_tls, mut_page_pool, mut_huge_pool, mut_system_rpt, mut_args.ext_elf_files);
+                mut_tls,
+                mut_page_pool,
+                mut_huge_pool,
+                mut_system_rpt,
+                mut_args.ext_elf_files,
+                mut_args.ext_elf_files_phys);
             if (bsl::unlikely(!mut_ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
@@ -433,6 +447,7 @@ namespace mk
 
             m_ext_vmexit = mut_tls.ext_vmexit;
             m_ext_fail = mut_tls.ext_fail;
+            m_ext_tick = mut_tls.ext_tick;
 
             bsl::ensures(m_root_vmid == syscall::BF_ROOT_VMID);
             bsl::ensures(nullptr != m_ext_vmexit);
@@ -458,6 +473,7 @@ namespace mk
             mut_vm_pool.set_active(mut_tls, m_root_vmid);
             mut_tls.ext_vmexit = m_ext_vmexit;
             mut_tls.ext_fail = m_ext_fail;
+            mut_tls.ext_tick = m_ext_tick;
         }
 
     public:
@@ -516,6 +532,13 @@ namespace mk
 
             verify_mut_args(mut_args, mut_tls);
 
+            /// NOTE:
+            /// - Record the NUMA node of this PP so that the page pool can
+            ///   hand out pages that are local to it.
+            ///
+
+            mut_tls.numa_node = mut_args.node;
+
             /// NOTE:
             /// - Print our logo. We do this after we verify the arguments
             ///   because if there is an error with the arguments, the logo
@@ -596,7 +619,8 @@ namespace mk
             /// - Start the hypervisor.
             ///
 
-            return vmexit_loop(mut_tls, mut_intrinsic, mut_vs_pool, mut_log);
+            return vmexit_loop(
+                mut_tls, mut_page_pool, mut_intrinsic, mut_vs_pool, mut_ext_pool, mut_log);
         }
     };
 }
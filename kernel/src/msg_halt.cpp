@@ -22,7 +22,11 @@
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 /// SOFTWARE.
 
+#include <get_current_tls.hpp>
+#include <serial_ring.hpp>
+
 #include <bsl/debug.hpp>
+#include <bsl/expects.hpp>
 
 namespace mk
 {
@@ -36,5 +40,10 @@ namespace mk
         bsl::print() << bsl::rst << "  --> ";
         bsl::print() << bsl::red << "Halting!!!";
         bsl::print() << bsl::rst << bsl::endl;
+
+        auto const *const tls{get_current_tls()};
+        bsl::expects(nullptr != tls);
+
+        serial_ring_flush(*tls);
     }
 }
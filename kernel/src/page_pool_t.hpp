@@ -25,22 +25,35 @@
 #ifndef PAGE_POOL_T_HPP
 #define PAGE_POOL_T_HPP
 
+#include <basic_bitmap_page_pool_t.hpp>
 #include <basic_page_pool_t.hpp>
 #include <page_pool_helpers.hpp>    // IWYU pragma: export
 #include <tls_t.hpp>
 
+#include <bsl/conditional.hpp>
 #include <bsl/dontcare_t.hpp>
 
 // IWYU pragma: no_include "page_pool_helpers.hpp"
 
 namespace mk
 {
-    /// @brief defines the page_pool_t used by the microkernel
-    using page_pool_t = lib::basic_page_pool_t<
+    /// @brief defines the list based page pool
+    using list_page_pool_t = lib::basic_page_pool_t<
+        tls_t,
+        bsl::dontcare_t,
+        HYPERVISOR_MK_DIRECT_MAP_ADDR.get(),
+        HYPERVISOR_MK_DIRECT_MAP_SIZE.get()>;
+
+    /// @brief defines the bitmap based page pool
+    using bitmap_page_pool_t = lib::basic_bitmap_page_pool_t<
         tls_t,
         bsl::dontcare_t,
         HYPERVISOR_MK_DIRECT_MAP_ADDR.get(),
         HYPERVISOR_MK_DIRECT_MAP_SIZE.get()>;
+
+    /// @brief defines the page_pool_t used by the microkernel
+    using page_pool_t =
+        bsl::conditional_t<HYPERVISOR_BITMAP_PAGE_POOL, bitmap_page_pool_t, list_page_pool_t>;
 }
 
 #endif
@@ -0,0 +1,80 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef SERIAL_RING_HPP
+#define SERIAL_RING_HPP
+
+#include <serial_ring_t.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
+
+namespace mk
+{
+    extern "C"
+    {
+        /// @brief stores the serial rings used by the microkernel
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        extern serial_ring_t g_mut_serial_ring;
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes as much of the current PP's serial ring to the
+    ///     serial port as it can take without waiting.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the current TLS block
+    ///
+    inline void
+    serial_ring_drain(tls_t const &tls) noexcept
+    {
+        if constexpr (HYPERVISOR_SERIAL_ASYNC) {
+            bsl::discard(g_mut_serial_ring.drain(bsl::to_u16(tls.ppid)));
+        }
+        else {
+            bsl::discard(tls);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes all of the current PP's serial ring to the serial
+    ///     port, waiting on the serial port as needed.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the current TLS block
+    ///
+    inline void
+    serial_ring_flush(tls_t const &tls) noexcept
+    {
+        if constexpr (HYPERVISOR_SERIAL_ASYNC) {
+            g_mut_serial_ring.flush(bsl::to_u16(tls.ppid));
+        }
+        else {
+            bsl::discard(tls);
+        }
+    }
+}
+
+#endif
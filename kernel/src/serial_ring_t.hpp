@@ -0,0 +1,309 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef SERIAL_RING_T_HPP
+#define SERIAL_RING_T_HPP
+
+#include <serial_ring_pp_t.hpp>
+#include <serial_write_fifo.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/char_type.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/cstr_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/is_constant_evaluated.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+
+namespace mk
+{
+    /// @brief defines the number of PPs that serial rings are stored for
+    constexpr auto SERIAL_RING_MAX_PPS{HYPERVISOR_SERIAL_ASYNC ? HYPERVISOR_MAX_PPS : 1_umx};
+    /// @brief defines the max number of bytes given to the serial device at once
+    constexpr auto SERIAL_FIFO_SIZE{0x10_umx};
+    /// @brief defines the number of hex digits used to report dropped bytes
+    constexpr auto SERIAL_DROPPED_DIGITS{0x10_u64};
+
+    /// <!-- description -->
+    ///   @brief Stores the microkernel's serial output until it can be
+    ///     written to the serial device. Printing only adds bytes to the
+    ///     current PP's ring, which means that a PP never has to wait on
+    ///     the serial device from the hot path. The rings are drained
+    ///     using drain(), which gives the serial device at most a FIFO's
+    ///     worth of bytes, and only if the FIFO is empty, so it never
+    ///     waits either. If a ring is full, bytes are dropped and counted,
+    ///     and the number of dropped bytes is reported in the serial
+    ///     output once the ring is drained. Each ring is only ever used
+    ///     by the PP that owns it, so the only state that is shared
+    ///     between PPs is the serial device itself.
+    ///
+    class serial_ring_t final
+    {
+        /// @brief stores the serial ring for each PP
+        bsl::array<serial_ring_pp_t, SERIAL_RING_MAX_PPS.get()> m_rings{};
+        /// @brief stores whether or not a PP is writing to the serial device
+        bool m_busy{};
+
+        /// <!-- description -->
+        ///   @brief Returns the serial ring associated with the provided PP
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP to get the serial ring for
+        ///   @return Returns the serial ring associated with the provided PP
+        ///
+        [[nodiscard]] constexpr auto
+        ring(bsl::safe_u16 const &ppid) noexcept -> serial_ring_pp_t &
+        {
+            auto *const pmut_ring{m_rings.at_if(bsl::to_idx(ppid))};
+            bsl::expects(nullptr != pmut_ring);
+
+            return *pmut_ring;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a character to the provided ring. If the ring is
+        ///     full, the character is dropped.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_ring the ring to add the character to
+        ///   @param c the character to add
+        ///
+        static constexpr void
+        push(serial_ring_pp_t &mut_ring, bsl::char_type const c) noexcept
+        {
+            if ((mut_ring.head - mut_ring.tail).checked() >= HYPERVISOR_SERIAL_RING_SIZE) {
+                ++mut_ring.dropped;
+                return;
+            }
+
+            auto const idx{bsl::to_idx((mut_ring.head % HYPERVISOR_SERIAL_RING_SIZE).checked())};
+            *mut_ring.buf.at_if(idx) = c;
+            ++mut_ring.head;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a string to the provided ring.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_ring the ring to add the string to
+        ///   @param str the string to add
+        ///   @param len the total number of bytes to add
+        ///
+        static constexpr void
+        push(serial_ring_pp_t &mut_ring, bsl::cstr_type const str, bsl::uintmx const len) noexcept
+        {
+            // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+            for (bsl::uintmx mut_i{}; mut_i < len; ++mut_i) {
+                bsl::char_type const c{str[mut_i]};
+                if ('\0' == c) {
+                    return;
+                }
+
+                push(mut_ring, c);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a message to the provided (empty) ring that
+        ///     reports how many bytes were dropped since the last report.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_ring the ring to report dropped bytes for
+        ///
+        static constexpr void
+        report_dropped(serial_ring_pp_t &mut_ring) noexcept
+        {
+            constexpr auto nibble_bits{4_u64};
+            constexpr auto nibble_mask{0xF_u64};
+            constexpr bsl::cstr_type digits{"0123456789ABCDEF"};
+
+            auto const dropped{(mut_ring.dropped - mut_ring.reported).checked()};
+            mut_ring.reported = mut_ring.dropped;
+
+            push(mut_ring, "\n[serial ring dropped 0x", HYPERVISOR_SERIAL_RING_SIZE.get());
+            for (auto mut_i{SERIAL_DROPPED_DIGITS}; mut_i.is_pos(); --mut_i) {
+                auto const shift{((mut_i - bsl::safe_u64::magic_1()) * nibble_bits).checked()};
+                auto const nibble{((dropped >> shift) & nibble_mask).checked()};
+
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                push(mut_ring, digits[nibble.get()]);
+            }
+            push(mut_ring, " bytes]\n", HYPERVISOR_SERIAL_RING_SIZE.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Attempts to take ownership of the serial device.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the serial device was acquired, false
+        ///     if another PP is currently writing to it.
+        ///
+        [[nodiscard]] constexpr auto
+        try_lock() noexcept -> bool
+        {
+            if (bsl::is_constant_evaluated()) {
+                bool const busy{m_busy};
+                m_busy = true;
+                return !busy;
+            }
+
+            return !__atomic_exchange_n(&m_busy, true, __ATOMIC_ACQUIRE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases ownership of the serial device.
+        ///
+        constexpr void
+        unlock() noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                m_busy = false;
+                return;
+            }
+
+            __atomic_store_n(&m_busy, false, __ATOMIC_RELEASE);
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Adds a character to the provided PP's serial ring
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP that is printing
+        ///   @param c the character to add
+        ///
+        constexpr void
+        write(bsl::safe_u16 const &ppid, bsl::char_type const c) noexcept
+        {
+            push(this->ring(ppid), c);
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a string to the provided PP's serial ring
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP that is printing
+        ///   @param str the string to add
+        ///   @param len the total number of bytes to add
+        ///
+        constexpr void
+        write(bsl::safe_u16 const &ppid, bsl::cstr_type const str, bsl::uintmx const len) noexcept
+        {
+            push(this->ring(ppid), str, len);
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives the serial device as many bytes from the provided
+        ///     PP's serial ring as it can take without waiting. If the
+        ///     serial device is busy (either its FIFO is not yet empty or
+        ///     another PP is writing to it), nothing is written.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP whose ring should be drained
+        ///   @return Returns true if the ring is empty, false otherwise
+        ///
+        [[maybe_unused]] constexpr auto
+        drain(bsl::safe_u16 const &ppid) noexcept -> bool
+        {
+            auto &mut_ring{this->ring(ppid)};
+
+            if (mut_ring.head == mut_ring.tail) {
+                if (mut_ring.dropped == mut_ring.reported) {
+                    return true;
+                }
+
+                report_dropped(mut_ring);
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (!this->try_lock()) {
+                return false;
+            }
+
+            auto const idx{(mut_ring.tail % HYPERVISOR_SERIAL_RING_SIZE).checked()};
+            auto mut_len{(mut_ring.head - mut_ring.tail).checked()};
+
+            if (mut_len > SERIAL_FIFO_SIZE) {
+                mut_len = SERIAL_FIFO_SIZE;
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const contiguous{(HYPERVISOR_SERIAL_RING_SIZE - idx).checked()};
+            if (mut_len > contiguous) {
+                mut_len = contiguous;
+            }
+            else {
+                bsl::touch();
+            }
+
+            bsl::safe_umx const written{
+                serial_write_fifo(mut_ring.buf.at_if(bsl::to_idx(idx)), mut_len.get())};
+
+            this->unlock();
+
+            mut_ring.tail = (mut_ring.tail + written).checked();
+            return mut_ring.head == mut_ring.tail;
+        }
+
+        /// <!-- description -->
+        ///   @brief Drains the provided PP's serial ring, waiting on the
+        ///     serial device until every byte has been written. This
+        ///     should only be used when the PP is about to stop (e.g.,
+        ///     halting or returning to the loader).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP whose ring should be flushed
+        ///
+        constexpr void
+        flush(bsl::safe_u16 const &ppid) noexcept
+        {
+            while (!this->drain(ppid)) {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of bytes the provided PP's
+        ///     serial ring has dropped because it was full.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP to query
+        ///   @return Returns the total number of bytes the provided PP's
+        ///     serial ring has dropped because it was full.
+        ///
+        [[nodiscard]] constexpr auto
+        dropped(bsl::safe_u16 const &ppid) noexcept -> bsl::safe_u64
+        {
+            return this->ring(ppid).dropped;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,56 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef SERIAL_RING_WRITE_HPP
+#define SERIAL_RING_WRITE_HPP
+
+#include <bsl/char_type.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/cstr_type.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Outputs a character to the serial port. If asynchronous
+    ///     serial output is enabled, the character is added to the current
+    ///     PP's serial ring and written later by serial_ring_drain().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param c the character to output
+    ///
+    extern "C" void serial_ring_write_c(bsl::char_type const c) noexcept;
+
+    /// <!-- description -->
+    ///   @brief Outputs a string to the serial port. If asynchronous
+    ///     serial output is enabled, the string is added to the current
+    ///     PP's serial ring and written later by serial_ring_drain().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str the string to output
+    ///   @param len the total number of bytes to output
+    ///
+    extern "C" void serial_ring_write(bsl::cstr_type const str, bsl::uintmx const len) noexcept;
+}
+
+#endif
@@ -0,0 +1,48 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+#ifndef SERIAL_WRITE_FIFO_HPP
+#define SERIAL_WRITE_FIFO_HPP
+
+#include <bsl/char_type.hpp>
+#include <bsl/cstdint.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Writes up to "len" characters from "buf" to the serial
+    ///     device's transmit FIFO without waiting. If the FIFO cannot
+    ///     accept any characters, nothing is written. The caller must not
+    ///     provide more characters than the FIFO can hold.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param buf the characters to write
+    ///   @param len the total number of characters to write
+    ///   @return Returns the number of characters that were written
+    ///
+    extern "C" [[nodiscard]] auto
+    serial_write_fifo(bsl::char_type const *const buf, bsl::uintmx const len) noexcept
+        -> bsl::uintmx;
+}
+
+#endif
@@ -0,0 +1,401 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef SYSCALL_STATS_T_HPP
+#define SYSCALL_STATS_T_HPP
+
+#include <bf_constants.hpp>
+#include <syscall_stats_pp_t.hpp>
+#include <syscall_stats_record_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+
+namespace mk
+{
+    /// @brief defines the number of PPs that syscall stats are stored for
+    constexpr auto SYSCALL_STATS_MAX_PPS{HYPERVISOR_SYSCALL_STATS ? HYPERVISOR_MAX_PPS : 1_umx};
+    /// @brief defines the status stored in a trace record that never returned
+    constexpr auto SYSCALL_STATS_NO_RETURN{bsl::safe_u64::max_value()};
+
+    /// <!-- description -->
+    ///   @brief Stores per-PP syscall statistics. For each syscall, the
+    ///     number of calls, the number of failures and the number of ticks
+    ///     (as reported by the TSC) spent in the microkernel are recorded,
+    ///     together with a log2 latency histogram for each opcode and a
+    ///     small trace of the most recent syscalls. Note that syscalls that
+    ///     never return to dispatch_syscall (e.g., bf_vs_op_run or
+    ///     bf_control_op_exit) are counted and traced, but not timed.
+    ///
+    class syscall_stats_t final
+    {
+        /// @brief stores the syscall stats for each PP
+        bsl::array<syscall_stats_pp_t, SYSCALL_STATS_MAX_PPS.get()> m_stats{};
+
+        /// <!-- description -->
+        ///   @brief Returns the opcode index of a syscall (i.e., the opcode
+        ///     without the signature, shifted down to start at 0).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param syscall the syscall to get the opcode index of
+        ///   @return Returns the opcode index of a syscall
+        ///
+        [[nodiscard]] static constexpr auto
+        opcode_idx(bsl::safe_u64 const &syscall) noexcept -> bsl::safe_idx
+        {
+            constexpr auto shift{16_u64};
+            return bsl::to_idx(syscall::bf_syscall_opcode_nosig(syscall.get()) >> shift);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the log2 histogram bucket that a latency of
+        ///     "ticks" belongs to. Latencies that are too large for the
+        ///     histogram are placed in the last bucket.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ticks the latency to get the bucket for
+        ///   @return Returns the log2 histogram bucket for "ticks"
+        ///
+        [[nodiscard]] static constexpr auto
+        bucket_idx(bsl::safe_u64 const &ticks) noexcept -> bsl::safe_idx
+        {
+            constexpr auto last{(SYSCALL_STATS_MAX_BUCKETS - bsl::safe_umx::magic_1()).checked()};
+
+            bsl::safe_idx mut_bucket{};
+            auto mut_ticks{ticks};
+            while (mut_ticks > bsl::safe_u64::magic_1()) {
+                mut_ticks >>= bsl::safe_u64::magic_1();
+                ++mut_bucket;
+            }
+
+            if (mut_bucket > bsl::to_idx(last)) {
+                return bsl::to_idx(last);
+            }
+
+            return mut_bucket;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the counter associated with the
+        ///     provided syscall, or a nullptr if the syscall's opcode or
+        ///     index is out of range and is not tracked.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_pp the per-PP stats to get the counter from
+        ///   @param syscall the syscall to get the counter for
+        ///   @return Returns a pointer to the counter associated with the
+        ///     provided syscall, or a nullptr if the syscall is not tracked.
+        ///
+        [[nodiscard]] static constexpr auto
+        counter(syscall_stats_pp_t &mut_pp, bsl::safe_u64 const &syscall) noexcept
+            -> syscall_stats_counter_t *
+        {
+            auto *const pmut_counters{mut_pp.counters.at_if(opcode_idx(syscall))};
+            if (nullptr == pmut_counters) {
+                return nullptr;
+            }
+
+            return pmut_counters->at_if(bsl::to_idx(syscall::bf_syscall_index(syscall.get())));
+        }
+
+        /// <!-- description -->
+        ///   @brief Prints a horizontal border for the dump tables
+        ///
+        static constexpr void
+        dump_border() noexcept
+        {
+            bsl::print() << bsl::ylw << "+---------------------------------";
+            bsl::print() << bsl::ylw << "-------------------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+        }
+
+        /// <!-- description -->
+        ///   @brief Dumps the syscall counters for the provided PP
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pp the per-PP stats to dump
+        ///
+        static constexpr void
+        dump_counters(syscall_stats_pp_t const &pp) noexcept
+        {
+            dump_border();
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << "op:idx    ";
+            bsl::print() << bsl::cyn << "             count";
+            bsl::print() << bsl::cyn << "     fails";
+            bsl::print() << bsl::cyn << "     avg ticks";
+            bsl::print() << bsl::cyn << "     max ticks";
+            bsl::print() << bsl::ylw << " |";
+            bsl::print() << bsl::rst << bsl::endl;
+            dump_border();
+
+            for (bsl::safe_idx mut_i{}; mut_i < pp.counters.size(); ++mut_i) {
+                auto const *const counters{pp.counters.at_if(mut_i)};
+                for (bsl::safe_idx mut_j{}; mut_j < counters->size(); ++mut_j) {
+                    auto const *const ctr{counters->at_if(mut_j)};
+                    if (ctr->count.is_zero()) {
+                        continue;
+                    }
+
+                    auto const avg{(ctr->total / ctr->count).checked()};
+
+                    bsl::print() << bsl::ylw << "| ";
+                    bsl::print() << bsl::rst << bsl::fmt{"04x", bsl::to_u16(mut_i)};
+                    bsl::print() << bsl::rst << ":";
+                    bsl::print() << bsl::rst << bsl::fmt{"04x", bsl::to_u16(mut_j)};
+                    bsl::print() << bsl::rst << " " << bsl::fmt{"18d", ctr->count};
+
+                    if (ctr->fails.is_zero()) {
+                        bsl::print() << bsl::blk << " " << bsl::fmt{"9d", ctr->fails};
+                    }
+                    else {
+                        bsl::print() << bsl::red << " " << bsl::fmt{"9d", ctr->fails};
+                    }
+
+                    bsl::print() << bsl::rst << " " << bsl::fmt{"13d", avg};
+                    bsl::print() << bsl::rst << " " << bsl::fmt{"13d", ctr->max};
+                    bsl::print() << bsl::ylw << " |";
+                    bsl::print() << bsl::rst << bsl::endl;
+                }
+            }
+
+            dump_border();
+        }
+
+        /// <!-- description -->
+        ///   @brief Dumps the per-opcode latency histograms for the
+        ///     provided PP. Only non-empty buckets are shown.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pp the per-PP stats to dump
+        ///
+        static constexpr void
+        dump_hists(syscall_stats_pp_t const &pp) noexcept
+        {
+            for (bsl::safe_idx mut_i{}; mut_i < pp.hists.size(); ++mut_i) {
+                auto const *const hist{pp.hists.at_if(mut_i)};
+                for (bsl::safe_idx mut_j{}; mut_j < hist->size(); ++mut_j) {
+                    auto const *const bucket{hist->at_if(mut_j)};
+                    if (bucket->is_zero()) {
+                        continue;
+                    }
+
+                    auto const bit{(bsl::to_u64(mut_j) + 1_u64).checked()};
+                    bsl::print() << bsl::ylw << "| ";
+                    bsl::print() << bsl::rst << bsl::fmt{"04x", bsl::to_u16(mut_i)};
+                    bsl::print() << bsl::rst << "      ticks < 2^";
+                    bsl::print() << bsl::rst << bsl::fmt{"<2d", bit};
+                    bsl::print() << bsl::rst << "             " << bsl::fmt{"18d", *bucket};
+                    bsl::print() << bsl::ylw << " |";
+                    bsl::print() << bsl::rst << bsl::endl;
+                }
+            }
+
+            dump_border();
+        }
+
+        /// <!-- description -->
+        ///   @brief Dumps the syscall trace for the provided PP, oldest
+        ///     record first.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pp the per-PP stats to dump
+        ///
+        static constexpr void
+        dump_trace(syscall_stats_pp_t const &pp) noexcept
+        {
+            bsl::safe_idx mut_crsr{pp.crsr};
+            for (bsl::safe_idx mut_i{}; mut_i < pp.trace.size(); ++mut_i) {
+                auto const *const rec{pp.trace.at_if(mut_crsr)};
+                if (rec->syscall.is_pos()) {
+                    bsl::print() << bsl::ylw << "| ";
+                    bsl::print() << bsl::rst << bsl::hex(rec->syscall);
+                    bsl::print() << bsl::rst << " " << bsl::hex(rec->reg0);
+
+                    if (SYSCALL_STATS_NO_RETURN == rec->status) {
+                        bsl::print() << bsl::blk << "              no return";
+                    }
+                    else if (rec->status.is_zero()) {
+                        bsl::print() << bsl::grn << "   " << bsl::fmt{"10d", rec->ticks};
+                        bsl::print() << bsl::grn << " success";
+                    }
+                    else {
+                        bsl::print() << bsl::red << "   " << bsl::fmt{"10d", rec->ticks};
+                        bsl::print() << bsl::red << " failure";
+                    }
+
+                    bsl::print() << bsl::ylw << " |";
+                    bsl::print() << bsl::rst << bsl::endl;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                ++mut_crsr;
+                if (mut_crsr >= pp.trace.size()) {
+                    mut_crsr = {};
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            dump_border();
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Records the start of a syscall. This counts the
+        ///     syscall and adds it to the trace.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP the syscall was executed on
+        ///   @param syscall the syscall that was executed (i.e., RAX)
+        ///   @param reg0 the first argument of the syscall
+        ///   @param tsc the TSC when the syscall was dispatched
+        ///
+        constexpr void
+        begin(
+            bsl::safe_u16 const &ppid,
+            bsl::safe_u64 const &syscall,
+            bsl::safe_u64 const &reg0,
+            bsl::safe_u64 const &tsc) noexcept
+        {
+            auto *const pmut_pp{m_stats.at_if(bsl::to_idx(ppid))};
+            bsl::expects(nullptr != pmut_pp);
+
+            *pmut_pp->trace.at_if(pmut_pp->crsr) =
+                {syscall, reg0, tsc, {}, SYSCALL_STATS_NO_RETURN};
+            pmut_pp->active = pmut_pp->crsr;
+
+            ++pmut_pp->crsr;
+            if (pmut_pp->crsr >= pmut_pp->trace.size()) {
+                pmut_pp->crsr = {};
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto *const pmut_ctr{counter(*pmut_pp, syscall)};
+            if (nullptr == pmut_ctr) {
+                return;
+            }
+
+            pmut_ctr->count = (pmut_ctr->count + bsl::safe_u64::magic_1()).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Records the end of the syscall that was last started
+        ///     on the provided PP using begin().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP the syscall was executed on
+        ///   @param status the status returned by the syscall
+        ///   @param tsc the TSC when the syscall completed
+        ///
+        constexpr void
+        end(
+            bsl::safe_u16 const &ppid,
+            bsl::safe_u64 const &status,
+            bsl::safe_u64 const &tsc) noexcept
+        {
+            auto *const pmut_pp{m_stats.at_if(bsl::to_idx(ppid))};
+            bsl::expects(nullptr != pmut_pp);
+
+            auto *const pmut_rec{pmut_pp->trace.at_if(pmut_pp->active)};
+            bsl::expects(nullptr != pmut_rec);
+
+            bsl::safe_u64 mut_ticks{};
+            if (bsl::likely(tsc > pmut_rec->tsc)) {
+                mut_ticks = (tsc - pmut_rec->tsc).checked();
+            }
+            else {
+                bsl::touch();
+            }
+
+            pmut_rec->ticks = mut_ticks;
+            pmut_rec->status = status;
+
+            auto *const pmut_ctr{counter(*pmut_pp, pmut_rec->syscall)};
+            if (nullptr == pmut_ctr) {
+                return;
+            }
+
+            if (!status.is_zero()) {
+                pmut_ctr->fails = (pmut_ctr->fails + bsl::safe_u64::magic_1()).checked();
+            }
+            else {
+                bsl::touch();
+            }
+
+            pmut_ctr->total = (pmut_ctr->total + mut_ticks).checked();
+            if (mut_ticks > pmut_ctr->max) {
+                pmut_ctr->max = mut_ticks;
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto *const pmut_hist{pmut_pp->hists.at_if(opcode_idx(pmut_rec->syscall))};
+            auto *const pmut_bucket{pmut_hist->at_if(bucket_idx(mut_ticks))};
+            *pmut_bucket = (*pmut_bucket + bsl::safe_u64::magic_1()).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Dumps the syscall stats for the requested PP
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP whose stats should be dumped
+        ///
+        constexpr void
+        dump(bsl::safe_u16 const &ppid) const noexcept
+        {
+            if constexpr (!HYPERVISOR_SYSCALL_STATS) {
+                bsl::print() << bsl::mag
+                             << "syscall stats are disabled (see HYPERVISOR_SYSCALL_STATS)";
+                bsl::print() << bsl::rst << bsl::endl;
+                return;
+            }
+
+            auto const *const pp{m_stats.at_if(bsl::to_idx(ppid))};
+            bsl::expects(nullptr != pp);
+
+            bsl::print() << bsl::mag << "syscall stats for pp [";
+            bsl::print() << bsl::rst << bsl::hex(ppid);
+            bsl::print() << bsl::mag << "]: ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            dump_counters(*pp);
+            dump_hists(*pp);
+            dump_trace(*pp);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,100 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <intrinsic_t.hpp>
+#include <tls_t.hpp>
+#include <trace_ring_t.hpp>
+#include <trace_ring_write.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    extern "C"
+    {
+        /// @brief stores a pointer to each PP's trace ring provided by the loader
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        extern bsl::array<loader::trace_ring_t *, HYPERVISOR_MAX_PPS.get()> g_mut_trace_rings;
+    }
+
+    /// <!-- description -->
+    ///   @brief Stores the trace ring the loader provided for a PP. A
+    ///     nullptr turns tracing off for that PP.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ppid the ID of the PP the trace ring belongs to
+    ///   @param pmut_ring the trace ring to use for this PP
+    ///
+    inline void
+    trace_set_ring(bsl::safe_u16 const &ppid, loader::trace_ring_t *const pmut_ring) noexcept
+    {
+        if constexpr (HYPERVISOR_TRACE) {
+            auto *const pmut_ptr{g_mut_trace_rings.at_if(bsl::to_idx(ppid))};
+            if (bsl::unlikely(nullptr == pmut_ptr)) {
+                return;
+            }
+
+            *pmut_ptr = pmut_ring;
+        }
+        else {
+            bsl::discard(ppid);
+            bsl::discard(pmut_ring);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Records that the current PP hit a probe, along with the
+    ///     current TSC. If HYPERVISOR_TRACE is disabled, this compiles to
+    ///     nothing.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the current TLS block
+    ///   @param probe the id of the probe (see loader::TRACE_PROBE_xxx)
+    ///
+    inline void
+    trace(tls_t const &tls, bsl::safe_u16 const &probe) noexcept
+    {
+        if constexpr (HYPERVISOR_TRACE) {
+            auto *const pmut_ring{*g_mut_trace_rings.at_if(bsl::to_idx(tls.ppid))};
+            if (nullptr == pmut_ring) {
+                return;
+            }
+
+            trace_ring_write(*pmut_ring, probe, bsl::to_u16(tls.ppid), intrinsic_t::rdtsc());
+        }
+        else {
+            bsl::discard(tls);
+            bsl::discard(probe);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,72 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef TRACE_RING_WRITE_HPP
+#define TRACE_RING_WRITE_HPP
+
+#include <trace_record_t.hpp>
+#include <trace_ring_t.hpp>
+
+#include <bsl/carray.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Adds a record to a trace ring. Once the ring is full, the
+    ///     oldest record is overwritten. The ring's epos is never wrapped
+    ///     so that the reader can tell how many records were lost.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_ring the trace ring to add the record to
+    ///   @param probe the id of the probe that was hit
+    ///   @param ppid the id of the PP that hit the probe
+    ///   @param tsc the TSC when the probe was hit
+    ///
+    constexpr void
+    trace_ring_write(
+        loader::trace_ring_t &mut_ring,
+        bsl::safe_u16 const &probe,
+        bsl::safe_u16 const &ppid,
+        bsl::safe_u64 const &tsc) noexcept
+    {
+        bsl::expects(probe.is_valid_and_checked());
+        bsl::expects(ppid.is_valid_and_checked());
+        bsl::expects(tsc.is_valid_and_checked());
+
+        bsl::uintmx mut_epos{mut_ring.epos};
+        auto *const pmut_rec{mut_ring.buf.at_if(mut_epos % mut_ring.buf.size())};
+
+        pmut_rec->tsc = tsc.get();
+        pmut_rec->probe = probe.get();
+        pmut_rec->ppid = ppid.get();
+
+        ++mut_epos;
+        mut_ring.epos = mut_epos;
+    }
+}
+
+#endif
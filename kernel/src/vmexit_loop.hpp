@@ -25,27 +25,80 @@
 #ifndef VMEXIT_LOOP_HPP
 #define VMEXIT_LOOP_HPP
 
+#include <bf_constants.hpp>
+#include <ext_pool_t.hpp>
 #include <ext_t.hpp>
 #include <intrinsic_t.hpp>
+#include <log_enabled.hpp>
+#include <log_mask.hpp>
+#include <page_pool_t.hpp>
+#include <serial_ring.hpp>
 #include <tls_t.hpp>
+#include <trace.hpp>
+#include <trace_record_t.hpp>
 #include <vmexit_log_t.hpp>
 #include <vs_pool_t.hpp>
 
+#include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace mk
 {
+    /// <!-- description -->
+    ///   @brief Executes the extension's tick handler if the current PP's
+    ///     tick deadline has passed, and then sets the next deadline.
+    ///     Ticks are always delivered before the VMExit that they are
+    ///     piggybacked on, which is why the tick handler must resume the
+    ///     active VS using bf_vs_op_run_current (which is enforced).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_intrinsic the intrinsic_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    dispatch_tick(tls_t &mut_tls, intrinsic_t &mut_intrinsic) noexcept -> bsl::errc_type
+    {
+        auto const now{mut_intrinsic.rdtsc()};
+        if (now < bsl::to_u64(mut_tls.tick_deadline)) {
+            return bsl::errc_success;
+        }
+
+        auto const deadline{(now + mut_tls.ext_tick->tick_period()).checked()};
+        bsl::expects(deadline.is_valid_and_checked());
+
+        mut_tls.tick_deadline = deadline.get();
+
+        /// NOTE:
+        /// - While in_tick is set, the bf_vs_op dispatcher rejects any
+        ///   syscall that would resume or change the active VS other than
+        ///   bf_vs_op_run_current, so that the VMExit is still delivered
+        ///   to the VS that caused it.
+        ///
+
+        mut_tls.in_tick = bsl::safe_u64::magic_1().get();
+        auto const ret{mut_tls.ext_tick->tick(mut_tls, mut_intrinsic)};
+        mut_tls.in_tick = {};
+
+        return ret;
+    }
+
     /// <!-- description -->
     ///   @brief Provides the main entry point for VMExits that occur
     ///     after a successful launch of the hypervisor.
     ///
     /// <!-- inputs/outputs -->
     ///   @param mut_tls the current TLS block
+    ///   @param mut_page_pool the page_pool_t to use
     ///   @param mut_intrinsic the intrinsic_t to use
     ///   @param mut_vs_pool the VPS pool to use
+    ///   @param mut_ext_pool the ext_pool_t to use
     ///   @param mut_log the VMExit log to use
     ///   @return Returns bsl::errc_success on success, bsl::errc_failure
     ///     otherwise
@@ -53,17 +106,69 @@ namespace mk
     [[nodiscard]] constexpr auto
     vmexit_loop(
         tls_t &mut_tls,
+        page_pool_t &mut_page_pool,
         intrinsic_t &mut_intrinsic,
         vs_pool_t &mut_vs_pool,
+        ext_pool_t &mut_ext_pool,
         vmexit_log_t &mut_log) noexcept -> bsl::errc_type
     {
         while (true) {
+            serial_ring_drain(mut_tls);
+
+            /// NOTE:
+            /// - Destroying a VM does not tear down the memory it owns.
+            ///   Instead, each PP reclaims a batch of that memory here,
+            ///   before it resumes the VM, so that the cost is spread out
+            ///   over many VMExits instead of being paid all at once.
+            ///
+
+            mut_ext_pool.reclaim(mut_tls, mut_page_pool);
+
+            /// NOTE:
+            /// - Memory freed by an extension is not given back until every
+            ///   PP has flushed its TLB, which each PP does here, before the
+            ///   extension can execute on this PP again.
+            ///
+
+            mut_ext_pool.flush_tlb(mut_tls, mut_intrinsic);
+
             auto const exit_reason{mut_vs_pool.run(mut_tls, mut_intrinsic, mut_log)};
             if (bsl::unlikely(exit_reason.is_invalid())) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
 
+            trace(mut_tls, loader::TRACE_PROBE_VMEXIT);
+            refresh_log_mask(mut_tls);
+            if (log_enabled(
+                    mut_tls.log_mask, syscall::BF_LOG_SUBSYSTEM_VS, syscall::BF_LOG_LEVEL_VVV)) {
+                bsl::print() << bsl::blu << "vs "                                         // --
+                             << bsl::rst << bsl::hex(bsl::to_u16(mut_tls.active_vsid))    // --
+                             << bsl::blu << " exit "                                      // --
+                             << bsl::rst << bsl::hex(exit_reason)                         // --
+                             << bsl::blu << " on pp "                                     // --
+                             << bsl::rst << bsl::hex(bsl::to_u16(mut_tls.ppid))           // --
+                             << bsl::endl;                                                // --
+            }
+
+            if (nullptr != mut_tls.ext_tick) {
+                auto const ret{dispatch_tick(mut_tls, mut_intrinsic)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                if (mut_vs_pool.is_tick_exit(exit_reason)) {
+                    mut_tls.first_launch_succeeded = bsl::safe_u64::magic_1().get();
+                    continue;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
             auto const ret{mut_tls.ext_vmexit->vmexit(mut_tls, mut_intrinsic, exit_reason)};
             if (bsl::unlikely(!ret)) {
                 bsl::print<bsl::V>() << bsl::here();
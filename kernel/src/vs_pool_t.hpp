@@ -507,6 +507,21 @@ namespace mk
             return this->get_vs(vsid)->run(mut_tls, mut_intrinsic, mut_log);
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if the provided exit reason was generated
+        ///     by the timer used to deliver ticks. Returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param exit_reason the exit reason to query
+        ///   @return Returns true if the provided exit reason was generated
+        ///     by the timer used to deliver ticks. Returns false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_tick_exit(bsl::safe_umx const &exit_reason) noexcept -> bool
+        {
+            return vs_t::is_tick_exit(exit_reason);
+        }
+
         /// <!-- description -->
         ///   @brief Advance the IP of the vs_t
         ///
@@ -35,9 +35,13 @@
 #include <missing_registers_t.hpp>
 #include <page_pool_t.hpp>
 #include <state_save_t.hpp>
+#include <tlb_tags.hpp>
 #include <tls_t.hpp>
+#include <trace.hpp>
+#include <trace_record_t.hpp>
 #include <vmcb_t.hpp>
 #include <vmexit_log_t.hpp>
+#include <xsave_area_t.hpp>
 
 #include <bsl/array.hpp>
 #include <bsl/convert.hpp>
@@ -55,6 +59,18 @@
 
 namespace mk
 {
+    /// @brief defines the XSAVE components that are managed per VS. This
+    ///   includes x87, SSE, AVX, MPX, AVX-512 and PKRU. AMX tile state is
+    ///   excluded as it does not fit in a single page. The loader checks
+    ///   that the rest does (this must match XSAVE_RFBM in the loader).
+    constexpr auto XSAVE_RFBM{0x00000000000002FF_u64};
+    /// @brief defines the initial value of MXCSR for a VS (all masked)
+    constexpr auto XSAVE_DEFAULT_MXCSR{0x1F80_u32};
+    /// @brief defines the VMCB clean bit that caches the guest ASID
+    constexpr auto VMCB_CLEAN_BITS_ASID{0x00000004_u32};
+    /// @brief defines the TLB control value that flushes every ASID
+    constexpr auto TLB_CONTROL_FLUSH_ALL{0x01_u8};
+
     /// <!-- description -->
     ///   @brief Defines the microkernel's notion of a VS.
     ///
@@ -85,6 +101,21 @@ namespace mk
         general_purpose_regs_t m_gprs{};
         /// @brief stores the VMCB missing registers
         missing_registers_t m_missing_registers{};
+        /// @brief stores the extended (FPU/SSE/AVX) state of this VS
+        xsave_area_t *m_xsave{};
+        /// @brief stores the ID of the PP whose registers hold m_xsave
+        bsl::safe_u16 m_xsave_ppid{};
+        /// @brief stores the XSAVE components saved for this VS
+        bsl::safe_u64 m_xsave_rfbm{};
+
+        /// @brief stores whether or not the microkernel manages the ASID
+        bool m_tlb_tagged{};
+        /// @brief stores the ASID currently given to this VS
+        bsl::safe_u16 m_tlb_tag{};
+        /// @brief stores the generation that m_tlb_tag was allocated from
+        bsl::safe_u64 m_tlb_tag_generation{};
+        /// @brief stores the ID of the PP that m_tlb_tag was allocated from
+        bsl::safe_u16 m_tlb_tag_ppid{};
 
         /// <!-- description -->
         ///   @brief Returns the row color based on the value of "val"
@@ -198,17 +229,124 @@ namespace mk
         }
 
         /// <!-- description -->
-        ///   @brief Returns a sanitized version of XCR0
+        ///   @brief Returns a sanitized version of XCR0. Besides x87 state
+        ///     always being enabled, XCR0 is limited to the components that
+        ///     are saved for this VS, as the state of any other component
+        ///     would not survive a switch to another VS.
         ///
         /// <!-- inputs/outputs -->
         ///   @param val the value to sanitize
         ///   @return Returns a sanitized version of XCR0
         ///
-        [[nodiscard]] static constexpr auto
-        sanitize_xcr0(bsl::safe_u64 const &val) noexcept -> bsl::safe_u64
+        [[nodiscard]] constexpr auto
+        sanitize_xcr0(bsl::safe_u64 const &val) const noexcept -> bsl::safe_u64
         {
-            constexpr auto efer_mask{0x0000000000000001_u64};
-            return val | efer_mask;
+            constexpr auto x87_mask{0x0000000000000001_u64};
+            return (val | x87_mask) & m_xsave_rfbm;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the extended (FPU/SSE/AVX) state that
+        ///     is currently loaded on this PP belongs to this VS, false
+        ///     otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns true if the extended (FPU/SSE/AVX) state that
+        ///     is currently loaded on this PP belongs to this VS, false
+        ///     otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        is_this_xsave_loaded(tls_t const &tls) const noexcept -> bool
+        {
+            if (this->id() != tls.xsave_vsid) {
+                return false;
+            }
+
+            return tls.ppid == ~m_xsave_ppid;
+        }
+
+        /// <!-- description -->
+        ///   @brief Ensures that the extended (FPU/SSE/AVX) state of this
+        ///     VS is loaded on this PP. The state is only restored when a
+        ///     different VS (or this VS on a different PP) was the last
+        ///     to load its state on this PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        ensure_this_xsave_is_loaded(tls_t &mut_tls, intrinsic_t const &intrinsic) noexcept
+        {
+            if (this->is_this_xsave_loaded(mut_tls)) {
+                return;
+            }
+
+            intrinsic.xrstor(m_xsave, m_xsave_rfbm);
+            m_xsave_ppid = ~bsl::to_u16(mut_tls.ppid);
+            mut_tls.xsave_vsid = this->id().get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the ASID given to this VS was allocated
+        ///     from this PP's current generation, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns true if the ASID given to this VS was allocated
+        ///     from this PP's current generation, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        is_tlb_tag_valid(tls_t const &tls) const noexcept -> bool
+        {
+            if (tls.ppid != ~m_tlb_tag_ppid) {
+                return false;
+            }
+
+            return tls.tag_generation == m_tlb_tag_generation;
+        }
+
+        /// <!-- description -->
+        ///   @brief Ensures that the ASID given to this VS is valid on this
+        ///     PP. An ASID is only valid on the PP and the generation that
+        ///     it was allocated from, so if this VS was just allocated,
+        ///     migrated, flushed, or this PP rolled over to a new
+        ///     generation, a fresh ASID is allocated. Every ASID on this PP
+        ///     is only flushed when the generation rolls over.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        ensure_tlb_tag(tls_t &mut_tls, intrinsic_t const &intrinsic) noexcept
+        {
+            if (this->is_tlb_tag_valid(mut_tls)) {
+                return;
+            }
+
+            if (bsl::unlikely(bsl::safe_u16::magic_0() == mut_tls.tag_max)) {
+                mut_tls.tag_max = intrinsic.max_asid().get();
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_tlb_tag = allocate_tlb_tag(mut_tls, bsl::to_u16(mut_tls.tag_max));
+            m_tlb_tag_generation = bsl::to_u64(mut_tls.tag_generation);
+            m_tlb_tag_ppid = ~bsl::to_u16(mut_tls.ppid);
+
+            if (TLB_TAG_FIRST == m_tlb_tag) {
+                m_guest_vmcb->tlb_control = TLB_CONTROL_FLUSH_ALL.get();
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const clean{bsl::to_u32(m_guest_vmcb->vmcb_clean_bits)};
+            m_guest_vmcb->vmcb_clean_bits = (clean & ~VMCB_CLEAN_BITS_ASID).get();
+            m_guest_vmcb->guest_asid = bsl::to_u32(m_tlb_tag).get();
         }
 
     public:
@@ -277,8 +415,6 @@ namespace mk
             bsl::safe_u16 const &vpid,
             bsl::safe_u16 const &ppid) noexcept -> bsl::safe_u16
         {
-            bsl::discard(intrinsic);
-
             bsl::expects(this->id() != syscall::BF_INVALID_ID);
             bsl::expects(allocated_status_t::deallocated == m_allocated);
 
@@ -311,6 +447,22 @@ namespace mk
             m_host_vmcb_phys = mut_page_pool.virt_to_phys(m_host_vmcb);
             bsl::expects(m_host_vmcb_phys.is_valid_and_checked());
 
+            m_xsave = mut_page_pool.template allocate<xsave_area_t>(mut_tls);
+            if (bsl::unlikely(nullptr == m_xsave)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_u16::failure();
+            }
+
+            m_xsave->mxcsr = XSAVE_DEFAULT_MXCSR.get();
+
+            /// NOTE:
+            /// - The microkernel runs with every XSAVE component the PP
+            ///   supports enabled in XCR0, but only the components in
+            ///   XSAVE_RFBM fit in m_xsave.
+            ///
+
+            m_xsave_rfbm = XSAVE_RFBM & intrinsic.supported_xcr0();
+
             m_assigned_vmid = ~vmid;
             m_assigned_vpid = ~vpid;
             m_assigned_ppid = ~ppid;
@@ -353,6 +505,22 @@ namespace mk
                 bsl::touch();
             }
 
+            if (nullptr != m_xsave) {
+                mut_page_pool.deallocate(mut_tls, m_xsave);
+                m_xsave = {};
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_xsave_ppid = {};
+            m_xsave_rfbm = {};
+
+            m_tlb_tagged = {};
+            m_tlb_tag = {};
+            m_tlb_tag_generation = {};
+            m_tlb_tag_ppid = {};
+
             m_assigned_ppid = {};
             m_assigned_vpid = {};
             m_assigned_vmid = {};
@@ -412,6 +580,8 @@ namespace mk
             mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_R14, bsl::to_u64(m_gprs.r14));
             mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_R15, bsl::to_u64(m_gprs.r15));
 
+            this->ensure_this_xsave_is_loaded(mut_tls, mut_intrinsic);
+
             m_active_ppid = ~bsl::to_u16(mut_tls.ppid);
             mut_tls.active_vsid = this->id().get();
         }
@@ -445,6 +615,14 @@ namespace mk
             m_gprs.r14 = intrinsic.tls_reg(syscall::TLS_OFFSET_R14).get();
             m_gprs.r15 = intrinsic.tls_reg(syscall::TLS_OFFSET_R15).get();
 
+            /// NOTE:
+            /// - XSAVEOPT only writes the components that were modified
+            ///   since the last XRSTOR from this area, so this is cheap
+            ///   when the VS did not touch its extended state.
+            ///
+
+            intrinsic.xsave(m_xsave, m_xsave_rfbm);
+
             m_active_ppid = {};
             mut_tls.active_vsid = syscall::BF_INVALID_ID.get();
         }
@@ -550,21 +728,21 @@ namespace mk
         ///   @brief Stores the provided state in the vs_t
         ///
         /// <!-- inputs/outputs -->
-        ///   @param tls the current TLS block
+        ///   @param mut_tls the current TLS block
         ///   @param mut_intrinsic the intrinsic_t to use
         ///   @param state the state to set the vs_t to
         ///
         constexpr void
         state_save_to_vs(
-            tls_t const &tls,
+            tls_t &mut_tls,
             intrinsic_t &mut_intrinsic,
             loader::state_save_t const *const state) noexcept
         {
             bsl::expects(allocated_status_t::allocated == m_allocated);
-            bsl::expects(tls.ppid == this->assigned_pp());
+            bsl::expects(mut_tls.ppid == this->assigned_pp());
             bsl::expects(nullptr != state);
 
-            if (tls.active_vsid == this->id()) {
+            if (mut_tls.active_vsid == this->id()) {
                 mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RAX, bsl::to_u64(state->rax));
                 mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RBX, bsl::to_u64(state->rbx));
                 mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RCX, bsl::to_u64(state->rcx));
@@ -654,7 +832,23 @@ namespace mk
             m_guest_vmcb->cr3 = state->cr3;
             m_guest_vmcb->cr4 = state->cr4;
             m_missing_registers.guest_cr8 = state->cr8;
-            m_missing_registers.guest_xcr0 = sanitize_xcr0(bsl::to_u64(state->xcr0)).get();
+            m_missing_registers.guest_xcr0 = this->sanitize_xcr0(bsl::to_u64(state->xcr0)).get();
+
+            /// NOTE:
+            /// - If no VS has been active on this PP yet, the extended
+            ///   state in the PP's registers still belongs to the root OS,
+            ///   which is what this VS is being initialized from. In this
+            ///   case, we take ownership of the state in place instead of
+            ///   restoring it from an empty XSAVE area.
+            ///
+
+            if (syscall::BF_INVALID_ID == mut_tls.active_vsid) {
+                m_xsave_ppid = ~bsl::to_u16(mut_tls.ppid);
+                mut_tls.xsave_vsid = this->id().get();
+            }
+            else {
+                bsl::touch();
+            }
 
             m_missing_registers.guest_dr0 = state->dr0;
             m_missing_registers.guest_dr1 = state->dr1;
@@ -788,6 +982,13 @@ namespace mk
             pmut_state->cr8 = m_missing_registers.guest_cr8;
             pmut_state->xcr0 = m_missing_registers.guest_xcr0;
 
+            if (!this->is_this_xsave_loaded(tls)) {
+                intrinsic.xrstor(m_xsave, m_xsave_rfbm);
+            }
+            else {
+                bsl::touch();
+            }
+
             pmut_state->dr0 = m_missing_registers.guest_dr0;
             pmut_state->dr1 = m_missing_registers.guest_dr1;
             pmut_state->dr2 = m_missing_registers.guest_dr2;
@@ -1706,8 +1907,14 @@ namespace mk
                     /// NOTE:
                     /// - To match Intel, and our use of 16bit IDs, the
                     ///   ASID must be 16bits instead of 32bits.
+                    /// - Writing a non-zero ASID tells the microkernel to
+                    ///   manage the ASID of this VS. The actual ASID is
+                    ///   allocated from the current PP when the VS is run.
                     ///
 
+                    m_tlb_tagged = val16.is_pos();
+                    m_tlb_tag_ppid = {};
+
                     m_guest_vmcb->guest_asid = bsl::to_u32(val16).get();
                     return bsl::errc_success;
                 }
@@ -2367,7 +2574,7 @@ namespace mk
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_xcr0: {
-                    m_missing_registers.guest_xcr0 = sanitize_xcr0(val).get();
+                    m_missing_registers.guest_xcr0 = this->sanitize_xcr0(val).get();
                     return bsl::errc_success;
                 }
 
@@ -2409,20 +2616,28 @@ namespace mk
         ///     will return the VMExit reason.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param tls the current TLS block
+        ///   @param mut_tls the current TLS block
         ///   @param mut_intrinsic the intrinsic_t to use
         ///   @param mut_log the VMExit log to use
         ///   @return Returns the VMExit reason on success, or
         ///     bsl::safe_umx::failure() on failure.
         ///
         [[nodiscard]] constexpr auto
-        run(tls_t const &tls, intrinsic_t &mut_intrinsic, vmexit_log_t &mut_log) noexcept
+        run(tls_t &mut_tls, intrinsic_t &mut_intrinsic, vmexit_log_t &mut_log) noexcept
             -> bsl::safe_umx
         {
             bsl::discard(mut_intrinsic);
             bsl::expects(allocated_status_t::allocated == m_allocated);
-            bsl::expects(tls.ppid == this->assigned_pp());
+            bsl::expects(mut_tls.ppid == this->assigned_pp());
 
+            if (m_tlb_tagged) {
+                this->ensure_tlb_tag(mut_tls, mut_intrinsic);
+            }
+            else {
+                bsl::touch();
+            }
+
+            trace(mut_tls, loader::TRACE_PROBE_VS_RUN);
             auto const exit_reason{mut_intrinsic.vmrun(
                 m_guest_vmcb,
                 m_guest_vmcb_phys,
@@ -2432,10 +2647,10 @@ namespace mk
 
             if constexpr (BSL_DEBUG_LEVEL >= bsl::VV) {
                 mut_log.add(
-                    bsl::to_u16(tls.ppid),
-                    {bsl::to_u16(tls.active_vmid),
-                     bsl::to_u16(tls.active_vpid),
-                     bsl::to_u16(tls.active_vsid),
+                    bsl::to_u16(mut_tls.ppid),
+                    {bsl::to_u16(mut_tls.active_vmid),
+                     bsl::to_u16(mut_tls.active_vpid),
+                     bsl::to_u16(mut_tls.active_vsid),
                      bsl::to_umx(exit_reason),
                      bsl::to_umx(m_guest_vmcb->exitinfo1),
                      bsl::to_umx(m_guest_vmcb->exitinfo2),
@@ -2463,6 +2678,31 @@ namespace mk
             return exit_reason;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if the provided exit reason was generated
+        ///     by the timer used to deliver ticks, in which case the VMExit
+        ///     is consumed by the microkernel and never reaches the
+        ///     extension's VMExit handler. Returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param exit_reason the exit reason to query
+        ///   @return Returns true if the provided exit reason was generated
+        ///     by the timer used to deliver ticks. Returns false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_tick_exit(bsl::safe_umx const &exit_reason) noexcept -> bool
+        {
+            /// NOTE:
+            /// - SVM does not provide an equivalent to the VMX-preemption
+            ///   timer, so on AMD, ticks are delivered on the first VMExit
+            ///   that occurs after the tick deadline has passed and no
+            ///   VMExit is ever generated just to deliver a tick.
+            ///
+
+            bsl::discard(exit_reason);
+            return false;
+        }
+
         /// <!-- description -->
         ///   @brief Advance the IP of the vs_t
         ///
@@ -2517,6 +2757,19 @@ namespace mk
             bsl::expects(allocated_status_t::allocated == m_allocated);
             bsl::expects(tls.ppid == this->assigned_pp());
 
+            /// NOTE:
+            /// - If the microkernel manages the ASID of this VS, the ASID
+            ///   is dropped instead, and a fresh ASID is allocated on the
+            ///   next run. ASIDs are never reused within a generation, so
+            ///   the fresh ASID cannot have any TLB entries, and no flush
+            ///   is needed.
+            ///
+
+            if (m_tlb_tagged) {
+                m_tlb_tag_ppid = {};
+                return;
+            }
+
             constexpr auto type{3_u8};
             m_guest_vmcb->tlb_control = type.get();
         }
@@ -2538,6 +2791,16 @@ namespace mk
             bsl::expects(allocated_status_t::allocated == m_allocated);
             bsl::expects(tls.ppid == this->assigned_pp());
 
+            /// NOTE:
+            /// - If the ASID of this VS is no longer valid on this PP, a
+            ///   fresh ASID is allocated on the next run, which cannot have
+            ///   any TLB entries for this GLA, so there is nothing to flush.
+            ///
+
+            if (m_tlb_tagged && !this->is_tlb_tag_valid(tls)) {
+                return;
+            }
+
             return intrinsic.tlb_flush(gla, bsl::to_u16(m_guest_vmcb->guest_asid));
         }
 
@@ -2700,6 +2963,16 @@ namespace mk
                 this->dump_field("r15 ", bsl::make_safe(m_gprs.r15));
             }
 
+            /// TLB Tags
+            ///
+
+            bsl::print() << bsl::ylw << "+----------------------------------------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            this->dump_field("asid generation ", m_tlb_tag_generation);
+            this->dump_field("pp asid flushes ", bsl::make_safe(tls.tag_flushes));
+            this->dump_field("pp asid flushes avoided ", bsl::make_safe(tls.tag_flushes_avoided));
+
             /// Guest Control Area Fields
             ///
 
@@ -25,10 +25,12 @@
 #ifndef DISPATCH_ESR_HPP
 #define DISPATCH_ESR_HPP
 
+#include <bf_constants.hpp>
 #include <dispatch_esr_nmi.hpp>
 #include <errc_types.hpp>
 #include <ext_t.hpp>
 #include <intrinsic_t.hpp>
+#include <log_enabled.hpp>
 #include <promote.hpp>
 #include <return_to_mk.hpp>
 #include <tls_t.hpp>
@@ -483,6 +485,17 @@ namespace mk
         auto const errc{(mut_tls.esr_error_code << ec_shft) | mut_tls.esr_vector};
         auto const addr{bsl::to_u64(mut_tls.esr_pf_addr)};
 
+        if (log_enabled(mut_tls.log_mask, syscall::BF_LOG_SUBSYSTEM_ESR, syscall::BF_LOG_LEVEL_V)) {
+            bsl::print() << bsl::mag << vector_to_name(bsl::to_umx(mut_tls.esr_vector))    // --
+                         << bsl::rst << " ip "                                             // --
+                         << bsl::hex(bsl::to_u64(mut_tls.esr_ip))                          // --
+                         << " addr "                                                       // --
+                         << bsl::hex(addr)                                                 // --
+                         << " on pp "                                                      // --
+                         << bsl::hex(bsl::to_u16(mut_tls.ppid))                            // --
+                         << bsl::endl;                                                     // --
+        }
+
         if (send_exception_to_ext(mut_tls, mut_intrinsic, errc, addr)) {
             return bsl::errc_success;
         }
@@ -25,7 +25,9 @@
 #ifndef DISPATCH_ESR_NMI_HPP
 #define DISPATCH_ESR_NMI_HPP
 
+#include <bf_constants.hpp>
 #include <intrinsic_t.hpp>
+#include <posted_events.hpp>
 #include <tls_t.hpp>
 
 #include <bsl/debug.hpp>
@@ -52,6 +54,7 @@ namespace mk
         constexpr auto vmcs_set_nmi_window_exiting{0x400000_u32};
 
         if (bsl::safe_umx::magic_0() != mut_tls.nmi_lock) {
+            post_event(mut_tls, syscall::BF_POSTED_EVENT_NMI);
             mut_tls.nmi_pending = bsl::safe_umx::magic_1().get();
             return;
         }
@@ -61,6 +64,7 @@ namespace mk
         bsl::expects(mut_intrinsic.vmwr32(vmcs_procbased_ctls_idx, mut_val));
 
         mut_tls.nmi_pending = bsl::safe_umx::magic_0().get();
+        discard_posted_events(mut_tls);
     }
 }
 
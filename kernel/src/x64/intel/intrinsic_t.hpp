@@ -26,6 +26,7 @@
 #define INTRINSIC_HPP
 
 #include <bf_constants.hpp>
+#include <intrinsic_cpuid.hpp>
 #include <intrinsic_cr0.hpp>
 #include <intrinsic_cr3.hpp>
 #include <intrinsic_cr4.hpp>
@@ -38,6 +39,7 @@
 #include <intrinsic_invlpg.hpp>
 #include <intrinsic_invvpid.hpp>
 #include <intrinsic_rdmsr.hpp>
+#include <intrinsic_rdtsc.hpp>
 #include <intrinsic_set_cr3.hpp>
 #include <intrinsic_set_tls_reg.hpp>
 #include <intrinsic_set_tp.hpp>
@@ -55,6 +57,8 @@
 #include <intrinsic_vmwr64.hpp>
 #include <intrinsic_vmwrfunc.hpp>
 #include <intrinsic_wrmsr.hpp>
+#include <intrinsic_xrstor.hpp>
+#include <intrinsic_xsave.hpp>
 #include <invept_descriptor_t.hpp>
 #include <invvpid_descriptor_t.hpp>
 #include <vmcs_t.hpp>
@@ -119,6 +123,19 @@ namespace mk
             return intrinsic_invvpid(&desc, type.get());
         }
 
+        /// <!-- description -->
+        ///   @brief Invalidates every TLB entry on this PP that is
+        ///     associated with a non-zero VPID. This is used when the
+        ///     VPIDs handed out on this PP roll over to a new generation.
+        ///
+        static constexpr void
+        tlb_flush_all_vpids() noexcept
+        {
+            constexpr auto type{2_u64};
+            invvpid_descriptor_t const desc{{}, {}, {}, {}, {}};
+            intrinsic_invvpid(&desc, type.get());
+        }
+
         /// <!-- description -->
         ///   @brief Returns the value of ES
         ///
@@ -239,6 +256,53 @@ namespace mk
             return bsl::to_u64(intrinsic_cr4());
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the XSAVE features this PP supports (i.e.,
+        ///     CPUID.(EAX=0Dh,ECX=0):EDX:EAX), which is also what the
+        ///     loader sets the microkernel's XCR0 to.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the XSAVE features this PP supports.
+        ///
+        [[nodiscard]] static constexpr auto
+        supported_xcr0() noexcept -> bsl::safe_u64
+        {
+            constexpr auto leaf{0x0000000D_u64};
+            constexpr auto edx_shft{32_u64};
+            constexpr auto eax_mask{0x00000000FFFFFFFF_u64};
+
+            bsl::safe_u64 mut_rax{leaf};
+            bsl::safe_u64 mut_rbx{};
+            bsl::safe_u64 mut_rcx{};
+            bsl::safe_u64 mut_rdx{};
+
+            intrinsic_cpuid(mut_rax.data(), mut_rbx.data(), mut_rcx.data(), mut_rdx.data());
+            return ((mut_rdx << edx_shft) | (mut_rax & eax_mask)).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if this PP supports 1G pages (i.e., an
+        ///     l2e_t can point to a block). Returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if this PP supports 1G pages. Returns
+        ///     false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_page_1g_supported() noexcept -> bool
+        {
+            constexpr auto leaf{0x80000001_u64};
+            constexpr auto page1gb{0x04000000_u64};
+
+            bsl::safe_u64 mut_rax{leaf};
+            bsl::safe_u64 mut_rbx{};
+            bsl::safe_u64 mut_rcx{};
+            bsl::safe_u64 mut_rdx{};
+
+            intrinsic_cpuid(mut_rax.data(), mut_rbx.data(), mut_rcx.data(), mut_rdx.data());
+            return (mut_rdx & page1gb).is_pos();
+        }
+
         /// <!-- description -->
         ///   @brief Sets the value of CR3
         ///
@@ -265,6 +329,54 @@ namespace mk
             intrinsic_set_tp(val.get());
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the value of the TSC (time stamp counter)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of the TSC (time stamp counter)
+        ///
+        [[nodiscard]] static constexpr auto
+        rdtsc() noexcept -> bsl::safe_u64
+        {
+            return bsl::to_u64(intrinsic_rdtsc());
+        }
+
+        /// <!-- description -->
+        ///   @brief Saves the extended processor state (FPU/SSE/AVX, etc.)
+        ///     selected by rfbm into the provided XSAVE area using
+        ///     XSAVEOPT. The area must be 64 byte aligned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_area the XSAVE area to save the state to
+        ///   @param rfbm the requested-feature bitmap to save
+        ///
+        static constexpr void
+        xsave(void *const pmut_area, bsl::safe_u64 const &rfbm) noexcept
+        {
+            bsl::expects(nullptr != pmut_area);
+            bsl::expects(rfbm.is_valid_and_checked());
+
+            intrinsic_xsave(pmut_area, rfbm.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Restores the extended processor state (FPU/SSE/AVX,
+        ///     etc.) selected by rfbm from the provided XSAVE area using
+        ///     XRSTOR. The area must be 64 byte aligned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param area the XSAVE area to restore the state from
+        ///   @param rfbm the requested-feature bitmap to restore
+        ///
+        static constexpr void
+        xrstor(void const *const area, bsl::safe_u64 const &rfbm) noexcept
+        {
+            bsl::expects(nullptr != area);
+            bsl::expects(rfbm.is_valid_and_checked());
+
+            intrinsic_xrstor(area, rfbm.get());
+        }
+
         /// <!-- description -->
         ///   @brief Returns the value of a requested TLS register
         ///
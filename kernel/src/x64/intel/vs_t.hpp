@@ -35,15 +35,20 @@
 #include <missing_registers_t.hpp>
 #include <page_pool_t.hpp>
 #include <state_save_t.hpp>
+#include <tlb_tags.hpp>
 #include <tls_t.hpp>
+#include <trace.hpp>
+#include <trace_record_t.hpp>
 #include <vmcs_t.hpp>
 #include <vmexit_log_t.hpp>
+#include <xsave_area_t.hpp>
 
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/ensures.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/expects.hpp>
+#include <bsl/finally.hpp>
 #include <bsl/is_same.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/string_view.hpp>
@@ -99,6 +104,21 @@ namespace mk
     constexpr auto MSR_VMX_TRUE_ENTRY_CTLS{0x00000490_u32};
     /// @brief defines the MSR_VMX_TRUE_PROC2_CTLS MSR
     constexpr auto MSR_VMX_TRUE_PROC2_CTLS{0x0000048B_u32};
+    /// @brief defines the MSR_VMX_MISC MSR
+    constexpr auto MSR_VMX_MISC{0x00000485_u32};
+
+    /// @brief defines the exit reason for the VMX-preemption timer
+    constexpr auto EXIT_REASON_PREEMPTION_TIMER{0x34_umx};
+
+    /// @brief defines the XSAVE components that are managed per VS. This
+    ///   includes x87, SSE, AVX, MPX, AVX-512 and PKRU. AMX tile state is
+    ///   excluded as it does not fit in a single page. The loader checks
+    ///   that the rest does (this must match XSAVE_RFBM in the loader).
+    constexpr auto XSAVE_RFBM{0x00000000000002FF_u64};
+    /// @brief defines the initial value of MXCSR for a VS (all masked)
+    constexpr auto XSAVE_DEFAULT_MXCSR{0x1F80_u32};
+    /// @brief defines the max VPID that can be handed out on a PP
+    constexpr auto MAX_VPID{0xFFFF_u16};
 
     /// <!-- description -->
     ///   @brief Defines the microkernel's notion of a VS.
@@ -126,6 +146,21 @@ namespace mk
         general_purpose_regs_t m_gprs{};
         /// @brief stores the rest of the state the vmcs doesn't
         missing_registers_t m_missing_registers{};
+        /// @brief stores the extended (FPU/SSE/AVX) state of this VS
+        xsave_area_t *m_xsave{};
+        /// @brief stores the ID of the PP whose registers hold m_xsave
+        bsl::safe_u16 m_xsave_ppid{};
+        /// @brief stores the XSAVE components saved for this VS
+        bsl::safe_u64 m_xsave_rfbm{};
+
+        /// @brief stores whether or not the microkernel manages the VPID
+        bool m_tlb_tagged{};
+        /// @brief stores the VPID currently given to this VS
+        bsl::safe_u16 m_tlb_tag{};
+        /// @brief stores the generation that m_tlb_tag was allocated from
+        bsl::safe_u64 m_tlb_tag_generation{};
+        /// @brief stores the ID of the PP that m_tlb_tag was allocated from
+        bsl::safe_u16 m_tlb_tag_ppid{};
 
         /// @brief stores the CR0 fixed0 values for sanitization
         bsl::safe_u64 m_vmx_cr0_fixed0{};
@@ -156,6 +191,8 @@ namespace mk
         bsl::safe_u64 m_vmx_proc2_fixed0{};
         /// @brief stores the proc2 ctls fixed1 values for sanitization
         bsl::safe_u64 m_vmx_proc2_fixed1{};
+        /// @brief stores the TSC to VMX-preemption timer shift
+        bsl::safe_u64 m_vmx_preemption_timer_rate{};
 
         /// <!-- description -->
         ///   @brief Returns the row color based on the value of "val"
@@ -436,17 +473,20 @@ namespace mk
         }
 
         /// <!-- description -->
-        ///   @brief Returns a sanitized version of XCR0
+        ///   @brief Returns a sanitized version of XCR0. Besides x87 state
+        ///     always being enabled, XCR0 is limited to the components that
+        ///     are saved for this VS, as the state of any other component
+        ///     would not survive a switch to another VS.
         ///
         /// <!-- inputs/outputs -->
         ///   @param val the value to sanitize
         ///   @return Returns a sanitized version of XCR0
         ///
-        [[nodiscard]] static constexpr auto
-        sanitize_xcr0(bsl::safe_u64 const &val) noexcept -> bsl::safe_u64
+        [[nodiscard]] constexpr auto
+        sanitize_xcr0(bsl::safe_u64 const &val) const noexcept -> bsl::safe_u64
         {
-            constexpr auto efer_mask{0x0000000000000001_u64};
-            return val | efer_mask;
+            constexpr auto x87_mask{0x0000000000000001_u64};
+            return (val | x87_mask) & m_xsave_rfbm;
         }
 
         /// <!-- description -->
@@ -470,6 +510,101 @@ namespace mk
             mut_tls.loaded_vsid = this->id().get();
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if the extended (FPU/SSE/AVX) state that
+        ///     is currently loaded on this PP belongs to this VS, false
+        ///     otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns true if the extended (FPU/SSE/AVX) state that
+        ///     is currently loaded on this PP belongs to this VS, false
+        ///     otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        is_this_xsave_loaded(tls_t const &tls) const noexcept -> bool
+        {
+            if (this->id() != tls.xsave_vsid) {
+                return false;
+            }
+
+            return tls.ppid == ~m_xsave_ppid;
+        }
+
+        /// <!-- description -->
+        ///   @brief Ensures that the extended (FPU/SSE/AVX) state of this
+        ///     VS is loaded on this PP. The state is only restored when a
+        ///     different VS (or this VS on a different PP) was the last
+        ///     to load its state on this PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        ensure_this_xsave_is_loaded(tls_t &mut_tls, intrinsic_t const &intrinsic) noexcept
+        {
+            if (this->is_this_xsave_loaded(mut_tls)) {
+                return;
+            }
+
+            intrinsic.xrstor(m_xsave, m_xsave_rfbm);
+            m_xsave_ppid = ~bsl::to_u16(mut_tls.ppid);
+            mut_tls.xsave_vsid = this->id().get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the VPID given to this VS was allocated
+        ///     from this PP's current generation, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns true if the VPID given to this VS was allocated
+        ///     from this PP's current generation, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        is_tlb_tag_valid(tls_t const &tls) const noexcept -> bool
+        {
+            if (tls.ppid != ~m_tlb_tag_ppid) {
+                return false;
+            }
+
+            return tls.tag_generation == m_tlb_tag_generation;
+        }
+
+        /// <!-- description -->
+        ///   @brief Ensures that the VPID given to this VS is valid on this
+        ///     PP. A VPID is only valid on the PP and the generation that
+        ///     it was allocated from, so if this VS was just allocated,
+        ///     migrated, or this PP rolled over to a new generation, a
+        ///     fresh VPID is allocated. Every VPID on this PP is only
+        ///     flushed when the generation rolls over.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        ensure_tlb_tag(tls_t &mut_tls, intrinsic_t &mut_intrinsic) noexcept
+        {
+            if (this->is_tlb_tag_valid(mut_tls)) {
+                return;
+            }
+
+            m_tlb_tag = allocate_tlb_tag(mut_tls, MAX_VPID);
+            m_tlb_tag_generation = bsl::to_u64(mut_tls.tag_generation);
+            m_tlb_tag_ppid = ~bsl::to_u16(mut_tls.ppid);
+
+            if (TLB_TAG_FIRST == m_tlb_tag) {
+                mut_intrinsic.tlb_flush_all_vpids();
+            }
+            else {
+                bsl::touch();
+            }
+
+            bsl::expects(mut_intrinsic.vmwr16(VMCS_VIRTUAL_PROCESSOR_IDENTIFIER, m_tlb_tag));
+        }
+
         /// <!-- description -->
         ///   @brief Initializes host specific information in the VMCS.
         ///
@@ -594,6 +729,64 @@ namespace mk
             m_vmx_proc2_fixed1 = (mut_ctls & fixed1_mask) >> fixed1_shft;
             bsl::expects(m_vmx_proc2_fixed0.is_valid_and_checked());
             bsl::expects(m_vmx_proc2_fixed1.is_valid_and_checked());
+
+            constexpr auto timer_rate_mask{0x1F_u64};
+            m_vmx_preemption_timer_rate = mut_intrinsic.rdmsr(MSR_VMX_MISC) & timer_rate_mask;
+            bsl::expects(m_vmx_preemption_timer_rate.is_valid_and_checked());
+        }
+
+        /// <!-- description -->
+        ///   @brief Arms the VMX-preemption timer so that a VMExit occurs
+        ///     once the current PP's tick deadline has been reached. If
+        ///     the deadline has already passed, the timer is armed with 0,
+        ///     which causes a VMExit before the guest executes anything.
+        ///     If the CPU does not support the VMX-preemption timer, ticks
+        ///     are instead delivered on the next VMExit after the deadline.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        arm_tick(tls_t const &tls, intrinsic_t &mut_intrinsic) noexcept
+        {
+            constexpr auto vmcs_pin_ctls_timer{0x40_u32};
+            constexpr auto max_timer_val{0xFFFFFFFF_u64};
+
+            if (bsl::unlikely((bsl::to_u32(m_vmx_pin_fixed1) & vmcs_pin_ctls_timer).is_zero())) {
+                return;
+            }
+
+            auto mut_pin_ctls{mut_intrinsic.vmrd32(VMCS_PIN_BASED_VM_EXECUTION_CTLS)};
+            bsl::expects(mut_pin_ctls.is_valid_and_checked());
+
+            if ((mut_pin_ctls & vmcs_pin_ctls_timer).is_zero()) {
+                mut_pin_ctls |= vmcs_pin_ctls_timer;
+                bsl::expects(mut_intrinsic.vmwr32(VMCS_PIN_BASED_VM_EXECUTION_CTLS, mut_pin_ctls));
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const now{mut_intrinsic.rdtsc()};
+            auto const deadline{bsl::to_u64(tls.tick_deadline)};
+
+            bsl::safe_u64 mut_timer_val{};
+            if (deadline > now) {
+                mut_timer_val = (deadline - now).checked() >> m_vmx_preemption_timer_rate;
+                if (mut_timer_val > max_timer_val) {
+                    mut_timer_val = max_timer_val;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const timer_val{bsl::to_u32_unsafe(mut_timer_val)};
+            bsl::expects(mut_intrinsic.vmwr32(VMCS_VMX_PREEMPTION_TIMER_VALUE, timer_val));
         }
 
     public:
@@ -672,6 +865,10 @@ namespace mk
             bsl::expects(ppid.is_valid_and_checked());
             bsl::expects(ppid != syscall::BF_INVALID_ID);
 
+            bsl::finally mut_cleanup_on_error{[this, &mut_tls, &mut_page_pool]() noexcept -> void {
+                this->deallocate(mut_tls, mut_page_pool);
+            }};
+
             m_vmcs = mut_page_pool.template allocate<vmcs_t>(mut_tls);
             if (bsl::unlikely(nullptr == m_vmcs)) {
                 bsl::print<bsl::V>() << bsl::here();
@@ -681,12 +878,30 @@ namespace mk
             m_vmcs_phys = mut_page_pool.virt_to_phys(m_vmcs);
             bsl::expects(m_vmcs_phys.is_valid_and_checked());
 
+            m_xsave = mut_page_pool.template allocate<xsave_area_t>(mut_tls);
+            if (bsl::unlikely(nullptr == m_xsave)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_u16::failure();
+            }
+
+            m_xsave->mxcsr = XSAVE_DEFAULT_MXCSR.get();
+
+            /// NOTE:
+            /// - The microkernel runs with every XSAVE component the PP
+            ///   supports enabled in XCR0, but only the components in
+            ///   XSAVE_RFBM fit in m_xsave.
+            ///
+
+            m_xsave_rfbm = XSAVE_RFBM & mut_intrinsic.supported_xcr0();
+
             m_assigned_vmid = ~vmid;
             m_assigned_vpid = ~vpid;
             m_assigned_ppid = ~ppid;
             m_allocated = allocated_status_t::allocated;
 
             this->init_vmcs(mut_tls, mut_intrinsic);
+
+            mut_cleanup_on_error.ignore();
             return this->id();
         }
 
@@ -714,6 +929,22 @@ namespace mk
                 bsl::touch();
             }
 
+            if (nullptr != m_xsave) {
+                mut_page_pool.deallocate(mut_tls, m_xsave);
+                m_xsave = {};
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_xsave_ppid = {};
+            m_xsave_rfbm = {};
+
+            m_tlb_tagged = {};
+            m_tlb_tag = {};
+            m_tlb_tag_generation = {};
+            m_tlb_tag_ppid = {};
+
             m_assigned_ppid = {};
             m_assigned_vpid = {};
             m_assigned_vmid = {};
@@ -773,6 +1004,8 @@ namespace mk
             mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_R14, bsl::to_u64(m_gprs.r14));
             mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_R15, bsl::to_u64(m_gprs.r15));
 
+            this->ensure_this_xsave_is_loaded(mut_tls, mut_intrinsic);
+
             m_active_ppid = ~bsl::to_u16(mut_tls.ppid);
             mut_tls.active_vsid = this->id().get();
         }
@@ -806,6 +1039,14 @@ namespace mk
             m_gprs.r14 = intrinsic.tls_reg(syscall::TLS_OFFSET_R14).get();
             m_gprs.r15 = intrinsic.tls_reg(syscall::TLS_OFFSET_R15).get();
 
+            /// NOTE:
+            /// - XSAVEOPT only writes the components that were modified
+            ///   since the last XRSTOR from this area, so this is cheap
+            ///   when the VS did not touch its extended state.
+            ///
+
+            intrinsic.xsave(m_xsave, m_xsave_rfbm);
+
             m_active_ppid = {};
             mut_tls.active_vsid = syscall::BF_INVALID_ID.get();
         }
@@ -1075,7 +1316,23 @@ namespace mk
             bsl::expects(mut_intrinsic.vmwr64(VMCS_GUEST_CR4, cr4));
 
             m_missing_registers.guest_cr8 = state->cr8;
-            m_missing_registers.guest_xcr0 = sanitize_xcr0(bsl::to_u64(state->xcr0)).get();
+            m_missing_registers.guest_xcr0 = this->sanitize_xcr0(bsl::to_u64(state->xcr0)).get();
+
+            /// NOTE:
+            /// - If no VS has been active on this PP yet, the extended
+            ///   state in the PP's registers still belongs to the root OS,
+            ///   which is what this VS is being initialized from. In this
+            ///   case, we take ownership of the state in place instead of
+            ///   restoring it from an empty XSAVE area.
+            ///
+
+            if (syscall::BF_INVALID_ID == mut_tls.active_vsid) {
+                m_xsave_ppid = ~bsl::to_u16(mut_tls.ppid);
+                mut_tls.xsave_vsid = this->id().get();
+            }
+            else {
+                bsl::touch();
+            }
 
             m_missing_registers.guest_dr0 = state->dr0;
             m_missing_registers.guest_dr1 = state->dr1;
@@ -1279,6 +1536,13 @@ namespace mk
             pmut_state->cr8 = m_missing_registers.guest_cr8;
             pmut_state->xcr0 = m_missing_registers.guest_xcr0;
 
+            if (!this->is_this_xsave_loaded(mut_tls)) {
+                intrinsic.xrstor(m_xsave, m_xsave_rfbm);
+            }
+            else {
+                bsl::touch();
+            }
+
             pmut_state->dr0 = m_missing_registers.guest_dr0;
             pmut_state->dr1 = m_missing_registers.guest_dr1;
             pmut_state->dr2 = m_missing_registers.guest_dr2;
@@ -2430,6 +2694,15 @@ namespace mk
                         break;
                     }
 
+                    /// NOTE:
+                    /// - Writing a non-zero VPID tells the microkernel to
+                    ///   manage the VPID of this VS. The actual VPID is
+                    ///   allocated from the current PP when the VS is run.
+                    ///
+
+                    m_tlb_tagged = val16.is_pos();
+                    m_tlb_tag_ppid = {};
+
                     mut_ret = mut_intrinsic.vmwr16(VMCS_VIRTUAL_PROCESSOR_IDENTIFIER, val16);
                     break;
                 }
@@ -3497,7 +3770,7 @@ namespace mk
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_xcr0: {
-                    m_missing_registers.guest_xcr0 = sanitize_xcr0(val).get();
+                    m_missing_registers.guest_xcr0 = this->sanitize_xcr0(val).get();
                     return bsl::errc_success;
                 }
 
@@ -3553,6 +3826,22 @@ namespace mk
             -> bsl::safe_umx
         {
             this->ensure_this_vs_is_loaded(mut_tls, mut_intrinsic);
+
+            if (m_tlb_tagged) {
+                this->ensure_tlb_tag(mut_tls, mut_intrinsic);
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (nullptr != mut_tls.ext_tick) {
+                this->arm_tick(mut_tls, mut_intrinsic);
+            }
+            else {
+                bsl::touch();
+            }
+
+            trace(mut_tls, loader::TRACE_PROBE_VS_RUN);
             auto const exit_reason{mut_intrinsic.vmrun(&m_missing_registers)};
 
             if constexpr (BSL_DEBUG_LEVEL >= bsl::VV) {
@@ -3587,6 +3876,23 @@ namespace mk
             return exit_reason;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if the provided exit reason was generated
+        ///     by the timer used to deliver ticks, in which case the VMExit
+        ///     is consumed by the microkernel and never reaches the
+        ///     extension's VMExit handler. Returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param exit_reason the exit reason to query
+        ///   @return Returns true if the provided exit reason was generated
+        ///     by the timer used to deliver ticks. Returns false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_tick_exit(bsl::safe_umx const &exit_reason) noexcept -> bool
+        {
+            return EXIT_REASON_PREEMPTION_TIMER == exit_reason;
+        }
+
         /// <!-- description -->
         ///   @brief Advance the IP of the vs_t
         ///
@@ -3664,6 +3970,16 @@ namespace mk
         constexpr void
         tlb_flush(tls_t &mut_tls, intrinsic_t const &intrinsic, bsl::safe_u64 const &gla) noexcept
         {
+            /// NOTE:
+            /// - If the VPID of this VS is no longer valid on this PP, a
+            ///   fresh VPID is allocated on the next run, which cannot have
+            ///   any TLB entries for this GLA, so there is nothing to flush.
+            ///
+
+            if (m_tlb_tagged && !this->is_tlb_tag_valid(mut_tls)) {
+                return;
+            }
+
             this->ensure_this_vs_is_loaded(mut_tls, intrinsic);
 
             auto const vpid{intrinsic.vmrd16(VMCS_VIRTUAL_PROCESSOR_IDENTIFIER)};
@@ -3814,6 +4130,17 @@ namespace mk
                 this->dump_field("r15 ", bsl::make_safe(m_gprs.r15));
             }
 
+            /// TLB Tags
+            ///
+
+            bsl::print() << bsl::ylw << "+--------------------------------------------------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            this->dump_field("vpid generation ", m_tlb_tag_generation);
+            this->dump_field("pp vpid flushes ", bsl::make_safe(mut_tls.tag_flushes));
+            this->dump_field(
+                "pp vpid flushes avoided ", bsl::make_safe(mut_tls.tag_flushes_avoided));
+
             /// 16 Bit Control Fields
             ///
 
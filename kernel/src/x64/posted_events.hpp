@@ -0,0 +1,109 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef POSTED_EVENTS_HPP
+#define POSTED_EVENTS_HPP
+
+#include <tls_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/is_constant_evaluated.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Posts an event to the current PP's posted events mask so
+    ///     that the extension can drain it with
+    ///     bf_vs_op_drain_posted_events instead of taking a VMExit for it.
+    ///     This is called from the ESR, which can interrupt a drain, so
+    ///     the mask is updated atomically. Posting the same event more
+    ///     than once before it is drained has no additional effect.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param event the BF_POSTED_EVENT bit to post
+    ///
+    constexpr void
+    post_event(tls_t &mut_tls, bsl::safe_u64 const &event) noexcept
+    {
+        if (bsl::is_constant_evaluated()) {
+            mut_tls.posted_events |= event.get();
+            return;
+        }
+
+        bsl::discard(__atomic_fetch_or(&mut_tls.posted_events, event.get(), __ATOMIC_RELAXED));
+    }
+
+    /// <!-- description -->
+    ///   @brief Drains the current PP's posted events mask, returning
+    ///     every event that was posted since the last drain. Once drained,
+    ///     the extension owns these events, so the pending NMI that the
+    ///     ESR recorded for the slow path is cleared. The NMI is cleared
+    ///     before the mask is read so that an NMI that fires while we
+    ///     drain is either seen here, or is left pending, and is never
+    ///     lost (at worst it is delivered twice).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @return Returns a mask of the BF_POSTED_EVENT bits that were
+    ///     drained, or 0 if nothing was posted.
+    ///
+    [[nodiscard]] constexpr auto
+    drain_posted_events(tls_t &mut_tls) noexcept -> bsl::safe_u64
+    {
+        mut_tls.nmi_pending = bsl::safe_u64::magic_0().get();
+
+        if (bsl::is_constant_evaluated()) {
+            bsl::safe_u64 const events{mut_tls.posted_events};
+            mut_tls.posted_events = bsl::safe_u64::magic_0().get();
+            return events;
+        }
+
+        return bsl::to_u64(__atomic_exchange_n(
+            &mut_tls.posted_events, bsl::safe_u64::magic_0().get(), __ATOMIC_ACQ_REL));
+    }
+
+    /// <!-- description -->
+    ///   @brief Discards any events left in the current PP's posted events
+    ///     mask. This is called once the slow path has delivered the
+    ///     pending events so that the extension does not see them twice.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///
+    constexpr void
+    discard_posted_events(tls_t &mut_tls) noexcept
+    {
+        if (bsl::is_constant_evaluated()) {
+            mut_tls.posted_events = bsl::safe_u64::magic_0().get();
+            return;
+        }
+
+        __atomic_store_n(&mut_tls.posted_events, bsl::safe_u64::magic_0().get(), __ATOMIC_RELAXED);
+    }
+}
+
+#endif
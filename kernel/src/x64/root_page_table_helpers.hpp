@@ -27,9 +27,13 @@
 
 #include <basic_entry_status_t.hpp>
 #include <basic_map_page_flags.hpp>
+#include <l0e_t.hpp>
 
+#include <bsl/discard.hpp>
 #include <bsl/ensures.hpp>
+#include <bsl/is_same.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
 
 namespace helpers
 {
@@ -80,6 +84,15 @@ namespace helpers
         pmut_entry->p = bsl::safe_u64::magic_1().get();
         pmut_entry->us = bsl::safe_u64::magic_1().get();
 
+        /// NOTE:
+        /// - Only the l0e_t is always a block. A l1e_t or l2e_t that points
+        ///   to a block is a 2M or 1G page, which requires the PS bit.
+        ///
+
+        if constexpr (!bsl::is_same<E, lib::l0e_t>::value) {
+            pmut_entry->ps = bsl::safe_u64::magic_1().get();
+        }
+
         if ((page_flgs & lib::BASIC_MAP_PAGE_WRITE).is_zero()) {
             pmut_entry->rw = bsl::safe_u64::magic_0().get();
         }
@@ -95,6 +108,77 @@ namespace helpers
         }
     }
 
+    /// <!-- description -->
+    ///   @brief Returns the flags that were given to
+    ///     configure_entry_as_ptr_to_block() for the provided entry.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam E the type of entry to query
+    ///   @param entry the entry to query
+    ///   @return Returns the flags that were given to
+    ///     configure_entry_as_ptr_to_block() for the provided entry.
+    ///
+    template<typename E>
+    [[nodiscard]] constexpr auto
+    entry_to_page_flgs(E const *const entry) noexcept -> bsl::safe_u64
+    {
+        bsl::expects(nullptr != entry);
+
+        bsl::safe_u64 mut_flgs{lib::BASIC_MAP_PAGE_READ};
+
+        if (bsl::safe_u64::magic_1() == entry->rw) {
+            mut_flgs |= lib::BASIC_MAP_PAGE_WRITE;
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (bsl::safe_u64::magic_0() == entry->nx) {
+            mut_flgs |= lib::BASIC_MAP_PAGE_EXECUTE;
+        }
+        else {
+            bsl::touch();
+        }
+
+        return mut_flgs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the hardware set the dirty flag of the
+    ///     provided block. The microkernel does not track dirty pages,
+    ///     so this always returns false.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam E the type of entry to query
+    ///   @param entry the entry to query
+    ///   @return Returns true if the dirty flag of the block is set.
+    ///
+    template<typename E>
+    [[nodiscard]] constexpr auto
+    entry_to_dirty(E const *const entry) noexcept -> bool
+    {
+        bsl::expects(nullptr != entry);
+        return false;
+    }
+
+    /// <!-- description -->
+    ///   @brief Sets or clears the dirty flag of the provided block.
+    ///     The microkernel does not track dirty pages, so this does
+    ///     nothing.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam E the type of entry to configure
+    ///   @param pmut_entry the entry to configure
+    ///   @param dirty the value to give the dirty flag
+    ///
+    template<typename E>
+    constexpr void
+    configure_entry_dirty(E *const pmut_entry, bool const dirty) noexcept
+    {
+        bsl::expects(nullptr != pmut_entry);
+        bsl::discard(dirty);
+    }
+
     /// <!-- description -->
     ///   @brief Configures an entry as a pointer to a table.
     ///
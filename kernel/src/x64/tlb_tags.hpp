@@ -0,0 +1,86 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef TLB_TAGS_HPP
+#define TLB_TAGS_HPP
+
+#include <tls_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    /// @brief defines the first tag handed out after a generation rollover
+    constexpr auto TLB_TAG_FIRST{1_u16};
+
+    /// <!-- description -->
+    ///   @brief Allocates a VPID/ASID from the current PP. Tags are handed
+    ///     out in order and are never reused within a generation, which
+    ///     means that a VS that is given a fresh tag cannot see stale
+    ///     translations, and no flush is needed. Once every tag has been
+    ///     handed out, the generation is incremented (invalidating every
+    ///     tag that was handed out on this PP) and allocation starts over
+    ///     at TLB_TAG_FIRST. When TLB_TAG_FIRST is returned, the caller
+    ///     must flush every guest TLB entry on this PP before using it.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param max_tag the max tag supported by this PP
+    ///   @return Returns the newly allocated tag. The generation the tag
+    ///     belongs to is stored in mut_tls.tag_generation.
+    ///
+    [[nodiscard]] constexpr auto
+    allocate_tlb_tag(tls_t &mut_tls, bsl::safe_u16 const &max_tag) noexcept -> bsl::safe_u16
+    {
+        bsl::expects(max_tag.is_pos());
+
+        bsl::safe_u16 mut_tag{mut_tls.tag_next};
+        if (bsl::unlikely(mut_tag.is_zero())) {
+            bsl::safe_u64 const generation{mut_tls.tag_generation};
+            bsl::safe_u64 const flushes{mut_tls.tag_flushes};
+
+            mut_tls.tag_generation = (generation + bsl::safe_u64::magic_1()).checked().get();
+            mut_tls.tag_flushes = (flushes + bsl::safe_u64::magic_1()).checked().get();
+            mut_tag = TLB_TAG_FIRST;
+        }
+        else {
+            bsl::safe_u64 const avoided{mut_tls.tag_flushes_avoided};
+            mut_tls.tag_flushes_avoided = (avoided + bsl::safe_u64::magic_1()).checked().get();
+        }
+
+        if (mut_tag < max_tag) {
+            mut_tls.tag_next = (mut_tag + bsl::safe_u16::magic_1()).checked().get();
+        }
+        else {
+            mut_tls.tag_next = {};
+        }
+
+        return mut_tag;
+    }
+}
+
+#endif
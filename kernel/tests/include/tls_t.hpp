@@ -109,6 +109,8 @@ namespace mk
         bsl::uint16 online_pps;
         /// @brief stores the VSID whose VMCS is loaded on Intel
         bsl::uint16 loaded_vsid;
+        /// @brief stores the VSID whose XSAVE state is loaded
+        bsl::uint16 xsave_vsid;
 
         /// @brief stores the currently active extension
         ext_t *ext;
@@ -116,6 +118,8 @@ namespace mk
         ext_t *ext_vmexit;
         /// @brief stores the extension registered for fast fail events
         ext_t *ext_fail;
+        /// @brief stores the extension registered for ticks
+        ext_t *ext_tick;
 
         /// @brief stores the loader provided state for the microkernel
         loader::state_save_t *mk_state;
@@ -142,6 +146,29 @@ namespace mk
         /// @brief stores the currently active root page table
         void *active_rpt;
 
+        /// @brief stores the TSC value at which the next tick is due
+        bsl::uint64 tick_deadline;
+
+        /// @brief stores the current VPID/ASID generation of this PP
+        bsl::uint64 tag_generation;
+        /// @brief stores the next VPID/ASID to hand out, 0 when exhausted
+        bsl::uint16 tag_next;
+        /// @brief stores the max VPID/ASID supported, 0 when unknown
+        bsl::uint16 tag_max;
+        /// @brief stores the number of generation rollover flushes
+        bsl::uint64 tag_flushes;
+        /// @brief stores the number of flushes avoided by a fresh tag
+        bsl::uint64 tag_flushes_avoided;
+
+        /// @brief stores this PP's cached copy of the runtime log mask
+        bsl::uint64 log_mask;
+
+        /// @brief stores the NUMA node this PP belongs to
+        bsl::uint16 numa_node;
+
+        /// @brief stores whether the extension's tick handler is executing
+        bsl::uint64 in_tick;
+
         /// --------------------------------------------------------------------
         /// Unit Test Only
         /// --------------------------------------------------------------------
@@ -32,11 +32,16 @@
 #include <l3e_t.hpp>
 #include <state_save_t.hpp>
 
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/safe_integral.hpp>
 
 namespace mk
 {
+    /// @brief defines the size of the posted_events_reserved field in the tls_t
+    constexpr auto TLS_T_POSTED_EVENTS_RESERVED_SIZE{0x048_umx};
+
     /// @brief ext_t prototype
     class ext_t;
 
@@ -204,8 +209,8 @@ namespace mk
         bsl::uint16 online_pps;
         /// @brief stores the VSID whose VMCS is loaded on Intel (0x20C)
         bsl::uint16 loaded_vsid;
-        /// @brief reserved (0x20E)
-        bsl::uint16 reserved_padding0;
+        /// @brief stores the VSID whose XSAVE state is loaded (0x20E)
+        bsl::uint16 xsave_vsid;
 
         /// @brief stores the currently active extension (0x210)
         ext_t *ext;
@@ -247,6 +252,38 @@ namespace mk
         /// @brief stores the currently active root page table (0x270)
         void *active_rpt;
 
+        /// @brief stores the mask of events posted to this PP (0x278)
+        bsl::uint64 posted_events;
+        /// @brief reserved so that the fields below keep their offsets (0x280)
+        bsl::array<bsl::uint8, TLS_T_POSTED_EVENTS_RESERVED_SIZE.get()> posted_events_reserved;
+
+        /// @brief stores the extension registered for ticks (0x2C8)
+        ext_t *ext_tick;
+        /// @brief stores the TSC value at which the next tick is due (0x2D0)
+        bsl::uint64 tick_deadline;
+
+        /// @brief stores the current VPID/ASID generation of this PP (0x2D8)
+        bsl::uint64 tag_generation;
+        /// @brief stores the next VPID/ASID to hand out, 0 when exhausted (0x2E0)
+        bsl::uint16 tag_next;
+        /// @brief stores the max VPID/ASID supported, 0 when unknown (0x2E2)
+        bsl::uint16 tag_max;
+        /// @brief reserved for alignment (0x2E4)
+        bsl::uint32 tag_reserved;
+        /// @brief stores the number of generation rollover flushes (0x2E8)
+        bsl::uint64 tag_flushes;
+        /// @brief stores the number of flushes avoided by a fresh tag (0x2F0)
+        bsl::uint64 tag_flushes_avoided;
+
+        /// @brief stores this PP's cached copy of the runtime log mask (0x2F8)
+        bsl::uint64 log_mask;
+
+        /// @brief stores the NUMA node this PP belongs to (0x300)
+        bsl::uint16 numa_node;
+
+        /// @brief stores whether the extension's tick handler is executing (0x308)
+        bsl::uint64 in_tick;
+
         /// --------------------------------------------------------------------
         /// Unit Test Only
         /// --------------------------------------------------------------------
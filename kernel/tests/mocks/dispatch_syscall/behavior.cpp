@@ -49,7 +49,7 @@ namespace mk
             bsl::ut_given{} = [&]() noexcept {
                 bsl::ut_then{} = [&]() noexcept {
                     bsl::ut_check(
-                        dispatch_syscall({}, {}, {}, {}, {}, {}, {}, {}, {}) ==
+                        dispatch_syscall({}, {}, {}, {}, {}, {}, {}, {}, {}, {}) ==
                         syscall::BF_STATUS_SUCCESS);
                 };
             };
@@ -62,7 +62,7 @@ namespace mk
                     mut_tls.test_ret = SYSCALL_FAILS;
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall(mut_tls, {}, {}, {}, {}, {}, {}, {}, {}) !=
+                            dispatch_syscall(mut_tls, {}, {}, {}, {}, {}, {}, {}, {}, {}) !=
                             syscall::BF_STATUS_SUCCESS);
                     };
                 };
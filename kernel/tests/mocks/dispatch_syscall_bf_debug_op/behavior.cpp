@@ -49,7 +49,7 @@ namespace mk
             bsl::ut_given{} = [&]() noexcept {
                 bsl::ut_then{} = [&]() noexcept {
                     bsl::ut_check(
-                        dispatch_syscall_bf_debug_op({}, {}, {}, {}, {}, {}, {}, {}, {}) ==
+                        dispatch_syscall_bf_debug_op({}, {}, {}, {}, {}, {}, {}, {}, {}, {}) ==
                         syscall::BF_STATUS_SUCCESS);
                 };
             };
@@ -61,9 +61,9 @@ namespace mk
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.test_ret = SYSCALL_BF_DEBUG_OP_FAILS;
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(
-                            dispatch_syscall_bf_debug_op(mut_tls, {}, {}, {}, {}, {}, {}, {}, {}) !=
-                            syscall::BF_STATUS_SUCCESS);
+                        auto const ret{dispatch_syscall_bf_debug_op(
+                            mut_tls, {}, {}, {}, {}, {}, {}, {}, {}, {})};
+                        bsl::ut_check(ret != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
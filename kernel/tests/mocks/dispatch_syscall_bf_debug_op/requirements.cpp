@@ -42,7 +42,7 @@ main() noexcept -> bsl::exit_code
     bsl::ut_scenario{"verify noexcept"} = []() noexcept {
         bsl::ut_then{} = []() noexcept {
             static_assert(
-                noexcept(mk::dispatch_syscall_bf_debug_op({}, {}, {}, {}, {}, {}, {}, {}, {})));
+                noexcept(mk::dispatch_syscall_bf_debug_op({}, {}, {}, {}, {}, {}, {}, {}, {}, {})));
         };
     };
 
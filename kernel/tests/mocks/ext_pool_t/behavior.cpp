@@ -105,6 +105,24 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"reclaim"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_pool_t mut_ext_pool{};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_ext_pool.reclaim({}, {});
+                };
+            };
+        };
+
+        bsl::ut_scenario{"flush_tlb"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_pool_t mut_ext_pool{};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_ext_pool.flush_tlb({}, {});
+                };
+            };
+        };
+
         bsl::ut_scenario{"signal_vm_active"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 ext_pool_t mut_ext_pool{};
@@ -183,6 +183,60 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"free_page"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                constexpr auto virt{23_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.free_page(mut_tls, {}, {}, virt));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"free_page fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                constexpr auto virt{23_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.test_ret = bsl::errc_failure;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.free_page(mut_tls, {}, {}, virt));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"free_huge"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                constexpr auto virt{23_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.free_huge(mut_tls, {}, {}, {}, virt));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"free_huge fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                constexpr auto virt{23_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.test_ret = bsl::errc_failure;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.free_huge(mut_tls, {}, {}, {}, virt));
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"map_page_direct"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 ext_t mut_ext{};
@@ -191,7 +245,7 @@ namespace mk
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.test_virt = virt;
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(virt == mut_ext.map_page_direct(mut_tls, {}, {}, {}));
+                        bsl::ut_check(virt == mut_ext.map_page_direct(mut_tls, {}, {}, {}, {}));
                     };
                 };
             };
@@ -219,6 +273,43 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"map_range_direct"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                constexpr auto virt{23_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.test_virt = virt;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            virt == mut_ext.map_range_direct(mut_tls, {}, {}, {}, {}, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_range_direct"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_ext.unmap_range_direct({}, {}, {}, {}, {}, {}));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_range_direct fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.test_ret = bsl::errc_failure;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.unmap_range_direct(mut_tls, {}, {}, {}, {}, {}));
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"signal_vm_created"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 ext_t mut_ext{};
@@ -250,6 +341,24 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"reclaim"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_ext.reclaim({}, {});
+                };
+            };
+        };
+
+        bsl::ut_scenario{"flush_tlb"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_ext.flush_tlb({}, {});
+                };
+            };
+        };
+
         bsl::ut_scenario{"signal_vm_active"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 ext_t mut_ext{};
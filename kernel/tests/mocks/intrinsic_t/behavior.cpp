@@ -52,6 +52,27 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"is_page_1g_supported"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t const intrinsic{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(intrinsic.is_page_1g_supported());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"set_page_1g_supported"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_intrinsic.set_page_1g_supported(false);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_intrinsic.is_page_1g_supported());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"set_rpt"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 intrinsic_t mut_intrinsic{};
@@ -70,6 +91,15 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"rdtsc"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t const intrinsic{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(intrinsic.rdtsc());
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
@@ -56,7 +56,12 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mk::intrinsic_t{}));
 
                 static_assert(noexcept(mut_intrinsic.tlb_flush({}, {})));
+                static_assert(noexcept(mut_intrinsic.rdtsc()));
+                static_assert(noexcept(mut_intrinsic.is_page_1g_supported()));
+                static_assert(noexcept(mut_intrinsic.set_page_1g_supported({})));
                 static_assert(noexcept(intrinsic.tlb_flush({}, {})));
+                static_assert(noexcept(intrinsic.is_page_1g_supported()));
+                static_assert(noexcept(intrinsic.rdtsc()));
             };
         };
     };
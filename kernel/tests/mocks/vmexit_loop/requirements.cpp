@@ -24,7 +24,9 @@
 
 #include "../../../mocks/vmexit_loop.hpp"
 
+#include <ext_pool_t.hpp>
 #include <intrinsic_t.hpp>
+#include <page_pool_t.hpp>
 #include <tls_t.hpp>
 #include <vmexit_log_t.hpp>
 #include <vs_pool_t.hpp>
@@ -47,12 +49,14 @@ main() noexcept -> bsl::exit_code
     bsl::ut_scenario{"verify noexcept"} = []() noexcept {
         bsl::ut_given{} = []() noexcept {
             mk::tls_t mut_tls{};
+            mk::page_pool_t mut_page_pool{};
             mk::intrinsic_t mut_intrinsic{};
             mk::vs_pool_t mut_vs_pool{};
+            mk::ext_pool_t mut_ext_pool{};
             mk::vmexit_log_t mut_log{};
             bsl::ut_then{} = []() noexcept {
-                static_assert(
-                    noexcept(mk::vmexit_loop(mut_tls, mut_intrinsic, mut_vs_pool, mut_log)));
+                static_assert(noexcept(mk::vmexit_loop(
+                    mut_tls, mut_page_pool, mut_intrinsic, mut_vs_pool, mut_ext_pool, mut_log)));
             };
         };
     };
@@ -73,6 +73,15 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"rdtsc"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t const intrinsic{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(intrinsic.rdtsc());
+                };
+            };
+        };
+
         bsl::ut_scenario{"set_tls_reg/tls_reg"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 intrinsic_t mut_intrinsic{};
@@ -58,12 +58,14 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_intrinsic.tlb_flush({}, {})));
                 static_assert(noexcept(mut_intrinsic.set_rpt({})));
                 static_assert(noexcept(mut_intrinsic.set_tp({})));
+                static_assert(noexcept(mut_intrinsic.rdtsc()));
                 static_assert(noexcept(mut_intrinsic.tls_reg({})));
                 static_assert(noexcept(mut_intrinsic.set_tls_reg({}, {})));
                 static_assert(noexcept(mut_intrinsic.rdmsr({})));
                 static_assert(noexcept(mut_intrinsic.wrmsr({}, {})));
                 static_assert(noexcept(mut_intrinsic.vmrun({}, {}, {}, {}, {})));
 
+                static_assert(noexcept(intrinsic.rdtsc()));
                 static_assert(noexcept(intrinsic.tls_reg({})));
                 static_assert(noexcept(intrinsic.rdmsr({})));
             };
@@ -68,6 +68,7 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_intrinsic.cr4()));
                 static_assert(noexcept(mut_intrinsic.set_rpt({})));
                 static_assert(noexcept(mut_intrinsic.set_tp({})));
+                static_assert(noexcept(mut_intrinsic.rdtsc()));
                 static_assert(noexcept(mut_intrinsic.tls_reg({})));
                 static_assert(noexcept(mut_intrinsic.set_tls_reg({}, {})));
                 static_assert(noexcept(mut_intrinsic.rdmsr({})));
@@ -96,6 +97,7 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(intrinsic.cr0()));
                 static_assert(noexcept(intrinsic.cr3()));
                 static_assert(noexcept(intrinsic.cr4()));
+                static_assert(noexcept(intrinsic.rdtsc()));
                 static_assert(noexcept(intrinsic.tls_reg({})));
                 static_assert(noexcept(intrinsic.rdmsr({})));
             };
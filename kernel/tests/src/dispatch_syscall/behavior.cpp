@@ -39,6 +39,7 @@
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
+#include <syscall_stats_t.hpp>
 #include <tls_t.hpp>
 #include <vm_pool_t.hpp>
 #include <vmexit_log_t.hpp>
@@ -75,6 +76,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{0xFFFFFFFFFFFFFFFF_u64};
                 bsl::ut_when{} = [&]() noexcept {
@@ -92,7 +94,46 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) != syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unknown syscall with syscall logging enabled"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
+                ext_t mut_ext{};
+                constexpr auto syscall{0xFFFFFFFFFFFFFFFF_u64};
+                constexpr auto mask{syscall::BF_LOG_LEVEL_VV << syscall::BF_LOG_SUBSYSTEM_SYSCALL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.log_mask = mask.checked().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mk::dispatch_syscall(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_huge_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool,
+                                mut_log,
+                                mut_stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -109,6 +150,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_CONTROL_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -126,7 +168,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) == syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -143,6 +186,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_CONTROL_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -161,7 +205,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) != syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -178,6 +223,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_HANDLE_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -195,7 +241,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) == syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -212,6 +259,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_HANDLE_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -230,7 +278,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) != syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -247,6 +296,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -264,7 +314,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) == syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -281,6 +332,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -299,7 +351,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) != syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -316,6 +369,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_CALLBACK_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -333,7 +387,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) == syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -350,6 +405,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_CALLBACK_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -368,7 +424,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) != syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -385,6 +442,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_VM_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -402,7 +460,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) == syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -419,6 +478,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_VM_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -437,7 +497,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) != syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -454,6 +515,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_VP_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -471,7 +533,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) == syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -488,6 +551,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_VP_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -506,7 +570,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) != syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -523,6 +588,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_VS_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -540,7 +606,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) == syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -557,6 +624,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_VS_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -575,7 +643,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) != syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -592,6 +661,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_INTRINSIC_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -609,7 +679,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) == syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -626,6 +697,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_INTRINSIC_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -644,7 +716,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) != syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -661,6 +734,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_MEM_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -678,7 +752,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) == syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -695,6 +770,7 @@ namespace mk
                 vs_pool_t mut_vs_pool{};
                 ext_pool_t mut_ext_pool{};
                 vmexit_log_t mut_log{};
+                syscall_stats_t mut_stats{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_MEM_OP_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -713,7 +789,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool,
-                                mut_log) != syscall::BF_STATUS_SUCCESS);
+                                mut_log,
+                                mut_stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -28,6 +28,7 @@
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
+#include <syscall_stats_t.hpp>
 #include <tls_t.hpp>
 #include <vm_pool_t.hpp>
 #include <vmexit_log_t.hpp>
@@ -60,6 +61,7 @@ main() noexcept -> bsl::exit_code
             mk::vs_pool_t mut_vs_pool{};
             mk::ext_pool_t mut_ext_pool{};
             mk::vmexit_log_t mut_log{};
+            mk::syscall_stats_t mut_stats{};
             bsl::ut_then{} = []() noexcept {
                 static_assert(noexcept(mk::dispatch_syscall(
                     mut_tls,
@@ -70,7 +72,8 @@ main() noexcept -> bsl::exit_code
                     mut_vp_pool,
                     mut_vs_pool,
                     mut_ext_pool,
-                    mut_log)));
+                    mut_log,
+                    mut_stats)));
             };
         };
     };
@@ -313,6 +313,141 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"REGISTER_TICK_IDX_VAL"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_CALLBACK_OP_REGISTER_TICK_IDX_VAL};
+                constexpr auto period{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = HYPERVISOR_EXT_CODE_ADDR.get();
+                    mut_tls.ext_reg2 = period.get();
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) == syscall::BF_STATUS_SUCCESS);
+                        bsl::ut_check(&mut_ext == mut_tls.ext_tick);
+                        bsl::ut_check(period == mut_ext.tick_period());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"REGISTER_TICK_IDX_VAL invalid callback #1"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_CALLBACK_OP_REGISTER_TICK_IDX_VAL};
+                constexpr auto period{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = {};
+                    mut_tls.ext_reg2 = period.get();
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"REGISTER_TICK_IDX_VAL invalid callback #2"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_CALLBACK_OP_REGISTER_TICK_IDX_VAL};
+                constexpr auto period{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = bsl::safe_u64::max_value().get();
+                    mut_tls.ext_reg2 = period.get();
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"REGISTER_TICK_IDX_VAL invalid period"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_CALLBACK_OP_REGISTER_TICK_IDX_VAL};
+                constexpr auto period{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = HYPERVISOR_EXT_CODE_ADDR.get();
+                    mut_tls.ext_reg2 = {};
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"REGISTER_TICK_IDX_VAL not the vmexit ext"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_CALLBACK_OP_REGISTER_TICK_IDX_VAL};
+                constexpr auto period{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = HYPERVISOR_EXT_CODE_ADDR.get();
+                    mut_tls.ext_reg2 = period.get();
+                    mut_tls.ext = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"REGISTER_TICK_IDX_VAL register twice"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_CALLBACK_OP_REGISTER_TICK_IDX_VAL};
+                constexpr auto period{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = HYPERVISOR_EXT_CODE_ADDR.get();
+                    mut_tls.ext_reg2 = period.get();
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) == syscall::BF_STATUS_SUCCESS);
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
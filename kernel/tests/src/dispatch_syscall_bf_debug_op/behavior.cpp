@@ -29,6 +29,7 @@
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
+#include <syscall_stats_t.hpp>
 #include <tls_t.hpp>
 #include <vm_pool_t.hpp>
 #include <vmexit_log_t.hpp>
@@ -65,6 +66,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{0xFFFFFFFFFFFFFFFF_u64};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.ext_syscall = syscall.get();
@@ -79,7 +81,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) != syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -96,6 +99,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_OUT_IDX_VAL};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.ext_syscall = syscall.get();
@@ -110,7 +114,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) == syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -127,6 +132,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_VM_IDX_VAL};
                 constexpr auto vmid{0x0_u16};
                 bsl::ut_when{} = [&]() noexcept {
@@ -143,7 +149,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) == syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -160,6 +167,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_VM_IDX_VAL};
                 constexpr auto vmid{syscall::BF_INVALID_ID};
                 bsl::ut_when{} = [&]() noexcept {
@@ -176,7 +184,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) != syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -193,6 +202,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_VM_IDX_VAL};
                 constexpr auto vmid{0x42_u16};
                 bsl::ut_when{} = [&]() noexcept {
@@ -209,7 +219,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) != syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -226,6 +237,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_VP_IDX_VAL};
                 constexpr auto vpid{0x0_u16};
                 bsl::ut_when{} = [&]() noexcept {
@@ -242,7 +254,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) == syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -259,6 +272,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_VP_IDX_VAL};
                 constexpr auto vpid{syscall::BF_INVALID_ID};
                 bsl::ut_when{} = [&]() noexcept {
@@ -275,7 +289,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) != syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -292,6 +307,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_VP_IDX_VAL};
                 constexpr auto vpid{0x42_u16};
                 bsl::ut_when{} = [&]() noexcept {
@@ -308,7 +324,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) != syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -325,6 +342,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_VS_IDX_VAL};
                 constexpr auto vsid{0x0_u16};
                 bsl::ut_when{} = [&]() noexcept {
@@ -341,7 +359,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) == syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -358,6 +377,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_VS_IDX_VAL};
                 constexpr auto vsid{syscall::BF_INVALID_ID};
                 bsl::ut_when{} = [&]() noexcept {
@@ -374,7 +394,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) != syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -391,6 +412,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_VS_IDX_VAL};
                 constexpr auto vsid{0x42_u16};
                 bsl::ut_when{} = [&]() noexcept {
@@ -407,7 +429,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) != syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -424,6 +447,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_VMEXIT_LOG_IDX_VAL};
                 constexpr auto online_pps{0x2_u16};
                 constexpr auto ppid{0x0_u16};
@@ -442,7 +466,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) == syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -459,6 +484,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_VMEXIT_LOG_IDX_VAL};
                 constexpr auto online_pps{0x2_u16};
                 constexpr auto ppid{syscall::BF_INVALID_ID};
@@ -477,7 +503,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) != syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -494,6 +521,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_VMEXIT_LOG_IDX_VAL};
                 constexpr auto online_pps{0x2_u16};
                 constexpr auto ppid{42_u16};
@@ -512,7 +540,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) != syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -529,6 +558,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_VMEXIT_LOG_IDX_VAL};
                 constexpr auto online_pps{0x0_u16};
                 constexpr auto ppid{0x1_u16};
@@ -547,7 +577,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) != syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -564,6 +595,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_WRITE_C_IDX_VAL};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.ext_syscall = syscall.get();
@@ -578,7 +610,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) == syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -595,6 +628,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_WRITE_STR_IDX_VAL};
                 bsl::string_view const msg{"the cow is blue for this is true\n"};
                 bsl::ut_when{} = [&]() noexcept {
@@ -613,7 +647,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) == syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -630,6 +665,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_WRITE_STR_IDX_VAL};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.ext_syscall = syscall.get();
@@ -647,7 +683,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) != syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -664,6 +701,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_WRITE_STR_IDX_VAL};
                 bsl::string_view const msg{"the cow is blue for this is true\n"};
                 bsl::ut_when{} = [&]() noexcept {
@@ -682,7 +720,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) == syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -699,6 +738,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_WRITE_STR_IDX_VAL};
                 bsl::string_view const msg{"the cow is blue for this is true\n"};
                 constexpr auto size{15_umx};
@@ -718,7 +758,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) == syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -735,6 +776,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_EXT_IDX_VAL};
                 constexpr auto extid{0x0_u16};
                 bsl::ut_when{} = [&]() noexcept {
@@ -751,7 +793,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) == syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -768,6 +811,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_EXT_IDX_VAL};
                 constexpr auto extid{syscall::BF_INVALID_ID};
                 bsl::ut_when{} = [&]() noexcept {
@@ -784,7 +828,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) != syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -801,6 +846,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_EXT_IDX_VAL};
                 constexpr auto extid{42_u16};
                 bsl::ut_when{} = [&]() noexcept {
@@ -817,7 +863,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) != syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) != syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -834,6 +881,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_PAGE_POOL_IDX_VAL};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.ext_syscall = syscall.get();
@@ -848,7 +896,8 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) == syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) == syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -865,6 +914,7 @@ namespace mk
                 vs_pool_t const vs_pool{};
                 ext_pool_t const ext_pool{};
                 vmexit_log_t const log{};
+                syscall_stats_t const stats{};
                 constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_HUGE_POOL_IDX_VAL};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.ext_syscall = syscall.get();
@@ -879,7 +929,118 @@ namespace mk
                                 vp_pool,
                                 vs_pool,
                                 ext_pool,
-                                log) == syscall::BF_STATUS_SUCCESS);
+                                log,
+                                stats) == syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"DUMP_SYSCALL_STATS_IDX_VAL"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t const page_pool{};
+                huge_pool_t const huge_pool{};
+                intrinsic_t const intrinsic{};
+                vm_pool_t const vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t const vs_pool{};
+                ext_pool_t const ext_pool{};
+                vmexit_log_t const log{};
+                syscall_stats_t const stats{};
+                constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_SYSCALL_STATS_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto ppid{0x0_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = online_pps.get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(ppid).get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mk::dispatch_syscall_bf_debug_op(
+                                mut_tls,
+                                page_pool,
+                                huge_pool,
+                                intrinsic,
+                                vm_pool,
+                                vp_pool,
+                                vs_pool,
+                                ext_pool,
+                                log,
+                                stats) == syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"DUMP_SYSCALL_STATS_IDX_VAL invalid ppid"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t const page_pool{};
+                huge_pool_t const huge_pool{};
+                intrinsic_t const intrinsic{};
+                vm_pool_t const vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t const vs_pool{};
+                ext_pool_t const ext_pool{};
+                vmexit_log_t const log{};
+                syscall_stats_t const stats{};
+                constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_SYSCALL_STATS_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto ppid{syscall::BF_INVALID_ID};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = online_pps.get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(ppid).get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mk::dispatch_syscall_bf_debug_op(
+                                mut_tls,
+                                page_pool,
+                                huge_pool,
+                                intrinsic,
+                                vm_pool,
+                                vp_pool,
+                                vs_pool,
+                                ext_pool,
+                                log,
+                                stats) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"SET_LOG_MASK_IDX_VAL"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t const page_pool{};
+                huge_pool_t const huge_pool{};
+                intrinsic_t const intrinsic{};
+                vm_pool_t const vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t const vs_pool{};
+                ext_pool_t const ext_pool{};
+                vmexit_log_t const log{};
+                syscall_stats_t const stats{};
+                constexpr auto syscall{syscall::BF_DEBUG_OP_SET_LOG_MASK_IDX_VAL};
+                constexpr auto mask{0x1230_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = mask.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mk::dispatch_syscall_bf_debug_op(
+                                mut_tls,
+                                page_pool,
+                                huge_pool,
+                                intrinsic,
+                                vm_pool,
+                                vp_pool,
+                                vs_pool,
+                                ext_pool,
+                                log,
+                                stats) == syscall::BF_STATUS_SUCCESS);
+                        bsl::ut_check(mask == mut_tls.log_mask);
                     };
                 };
             };
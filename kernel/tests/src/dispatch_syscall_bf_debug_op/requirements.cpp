@@ -28,6 +28,7 @@
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
+#include <syscall_stats_t.hpp>
 #include <tls_t.hpp>
 #include <vm_pool_t.hpp>
 #include <vmexit_log_t.hpp>
@@ -60,6 +61,7 @@ main() noexcept -> bsl::exit_code
             mk::vs_pool_t const vs_pool{};
             mk::ext_pool_t const ext_pool{};
             mk::vmexit_log_t const log{};
+            mk::syscall_stats_t const stats{};
             bsl::ut_then{} = []() noexcept {
                 static_assert(noexcept(mk::dispatch_syscall_bf_debug_op(
                     mut_tls,
@@ -70,7 +72,8 @@ main() noexcept -> bsl::exit_code
                     vp_pool,
                     vs_pool,
                     ext_pool,
-                    log)));
+                    log,
+                    stats)));
             };
         };
     };
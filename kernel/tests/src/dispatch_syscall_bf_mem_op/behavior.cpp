@@ -27,10 +27,12 @@
 #include <bf_constants.hpp>
 #include <ext_t.hpp>
 #include <huge_pool_t.hpp>
+#include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
 #include <tls_t.hpp>
 
 #include <bsl/convert.hpp>
+#include <bsl/errc_type.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
 
@@ -53,13 +55,15 @@ namespace mk
                 tls_t mut_tls{};
                 page_pool_t mut_page_pool{};
                 huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
                 ext_t mut_ext{};
                 bsl::ut_when{} = [&]() noexcept {
                     bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
                     mut_tls.ext = &mut_ext;
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall_bf_mem_op(mut_tls, mut_page_pool, mut_huge_pool) !=
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) !=
                             syscall::BF_STATUS_SUCCESS);
                     };
                 };
@@ -71,6 +75,7 @@ namespace mk
                 tls_t mut_tls{};
                 page_pool_t mut_page_pool{};
                 huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
                 ext_t mut_ext{};
                 constexpr auto syscall{0xFFFFFFFFFFFFFFFF_u64};
                 bsl::ut_when{} = [&]() noexcept {
@@ -80,7 +85,8 @@ namespace mk
                     mut_tls.ext = &mut_ext;
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall_bf_mem_op(mut_tls, mut_page_pool, mut_huge_pool) !=
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) !=
                             syscall::BF_STATUS_SUCCESS);
                     };
                 };
@@ -92,6 +98,7 @@ namespace mk
                 tls_t mut_tls{};
                 page_pool_t mut_page_pool{};
                 huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_MEM_OP_ALLOC_PAGE_IDX_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -101,7 +108,8 @@ namespace mk
                     mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall_bf_mem_op(mut_tls, mut_page_pool, mut_huge_pool) ==
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) ==
                             syscall::BF_STATUS_SUCCESS);
                     };
                 };
@@ -113,6 +121,7 @@ namespace mk
                 tls_t mut_tls{};
                 page_pool_t mut_page_pool{};
                 huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_MEM_OP_ALLOC_PAGE_IDX_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -124,7 +133,8 @@ namespace mk
                     mut_tls.test_phys = bsl::safe_u64::failure();
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall_bf_mem_op(mut_tls, mut_page_pool, mut_huge_pool) !=
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) !=
                             syscall::BF_STATUS_SUCCESS);
                     };
                 };
@@ -136,6 +146,7 @@ namespace mk
                 tls_t mut_tls{};
                 page_pool_t mut_page_pool{};
                 huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_MEM_OP_ALLOC_HUGE_IDX_VAL};
                 constexpr auto size{0x2000_u64};
@@ -147,7 +158,8 @@ namespace mk
                     mut_tls.ext_reg1 = size.get();
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall_bf_mem_op(mut_tls, mut_page_pool, mut_huge_pool) ==
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) ==
                             syscall::BF_STATUS_SUCCESS);
                     };
                 };
@@ -159,6 +171,7 @@ namespace mk
                 tls_t mut_tls{};
                 page_pool_t mut_page_pool{};
                 huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_MEM_OP_ALLOC_HUGE_IDX_VAL};
                 constexpr auto size{0x1000_u64};
@@ -170,7 +183,8 @@ namespace mk
                     mut_tls.ext_reg1 = size.get();
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall_bf_mem_op(mut_tls, mut_page_pool, mut_huge_pool) !=
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) !=
                             syscall::BF_STATUS_SUCCESS);
                     };
                 };
@@ -182,6 +196,7 @@ namespace mk
                 tls_t mut_tls{};
                 page_pool_t mut_page_pool{};
                 huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_MEM_OP_ALLOC_HUGE_IDX_VAL};
                 constexpr auto size{HYPERVISOR_MK_HUGE_POOL_SIZE};
@@ -193,7 +208,8 @@ namespace mk
                     mut_tls.ext_reg1 = size.get();
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall_bf_mem_op(mut_tls, mut_page_pool, mut_huge_pool) !=
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) !=
                             syscall::BF_STATUS_SUCCESS);
                     };
                 };
@@ -205,6 +221,7 @@ namespace mk
                 tls_t mut_tls{};
                 page_pool_t mut_page_pool{};
                 huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_MEM_OP_ALLOC_HUGE_IDX_VAL};
                 constexpr auto size{0x2042_u64};
@@ -216,7 +233,8 @@ namespace mk
                     mut_tls.ext_reg1 = size.get();
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall_bf_mem_op(mut_tls, mut_page_pool, mut_huge_pool) !=
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) !=
                             syscall::BF_STATUS_SUCCESS);
                     };
                 };
@@ -228,6 +246,7 @@ namespace mk
                 tls_t mut_tls{};
                 page_pool_t mut_page_pool{};
                 huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_MEM_OP_ALLOC_HUGE_IDX_VAL};
                 constexpr auto size{0x2000_u64};
@@ -241,7 +260,268 @@ namespace mk
                     mut_tls.test_phys = bsl::safe_u64::failure();
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall_bf_mem_op(mut_tls, mut_page_pool, mut_huge_pool) !=
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) !=
+                            syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"FREE_PAGE_IDX_VAL"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_MEM_OP_FREE_PAGE_IDX_VAL};
+                constexpr auto virt{
+                    (HYPERVISOR_EXT_PAGE_POOL_ADDR + HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = virt.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) ==
+                            syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"FREE_PAGE_IDX_VAL invalid virt #1"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_MEM_OP_FREE_PAGE_IDX_VAL};
+                constexpr auto virt{HYPERVISOR_PAGE_SIZE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = virt.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) !=
+                            syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"FREE_PAGE_IDX_VAL invalid virt #2"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_MEM_OP_FREE_PAGE_IDX_VAL};
+                constexpr auto virt{
+                    (HYPERVISOR_EXT_PAGE_POOL_ADDR + HYPERVISOR_EXT_PAGE_POOL_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = virt.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) !=
+                            syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"FREE_PAGE_IDX_VAL invalid virt #3"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_MEM_OP_FREE_PAGE_IDX_VAL};
+                constexpr auto virt{
+                    (HYPERVISOR_EXT_PAGE_POOL_ADDR + bsl::safe_u64::magic_1()).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = virt.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) !=
+                            syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"FREE_PAGE_IDX_VAL free fails"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_MEM_OP_FREE_PAGE_IDX_VAL};
+                constexpr auto virt{
+                    (HYPERVISOR_EXT_PAGE_POOL_ADDR + HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = virt.get();
+                    mut_tls.test_ret = bsl::errc_failure;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) !=
+                            syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"FREE_HUGE_IDX_VAL"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_MEM_OP_FREE_HUGE_IDX_VAL};
+                constexpr auto virt{
+                    (HYPERVISOR_EXT_HUGE_POOL_ADDR + HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = virt.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) ==
+                            syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"FREE_HUGE_IDX_VAL invalid virt #1"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_MEM_OP_FREE_HUGE_IDX_VAL};
+                constexpr auto virt{HYPERVISOR_PAGE_SIZE};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = virt.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) !=
+                            syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"FREE_HUGE_IDX_VAL invalid virt #2"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_MEM_OP_FREE_HUGE_IDX_VAL};
+                constexpr auto virt{
+                    (HYPERVISOR_EXT_HUGE_POOL_ADDR + HYPERVISOR_EXT_HUGE_POOL_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = virt.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) !=
+                            syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"FREE_HUGE_IDX_VAL invalid virt #3"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_MEM_OP_FREE_HUGE_IDX_VAL};
+                constexpr auto virt{
+                    (HYPERVISOR_EXT_HUGE_POOL_ADDR + bsl::safe_u64::magic_1()).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = virt.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) !=
+                            syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"FREE_HUGE_IDX_VAL free fails"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                intrinsic_t const intrinsic{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_MEM_OP_FREE_HUGE_IDX_VAL};
+                constexpr auto virt{
+                    (HYPERVISOR_EXT_HUGE_POOL_ADDR + HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = virt.get();
+                    mut_tls.test_ret = bsl::errc_failure;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_mem_op(
+                                mut_tls, mut_page_pool, mut_huge_pool, intrinsic) !=
                             syscall::BF_STATUS_SUCCESS);
                     };
                 };
@@ -25,6 +25,7 @@
 #include "../../../src/dispatch_syscall_bf_mem_op.hpp"
 
 #include <huge_pool_t.hpp>
+#include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
 #include <tls_t.hpp>
 
@@ -48,9 +49,10 @@ main() noexcept -> bsl::exit_code
             mk::tls_t mut_tls{};
             mk::page_pool_t mut_page_pool{};
             mk::huge_pool_t mut_huge_pool{};
+            mk::intrinsic_t const intrinsic{};
             bsl::ut_then{} = []() noexcept {
-                static_assert(noexcept(
-                    mk::dispatch_syscall_bf_mem_op(mut_tls, mut_page_pool, mut_huge_pool)));
+                static_assert(noexcept(mk::dispatch_syscall_bf_mem_op(
+                    mut_tls, mut_page_pool, mut_huge_pool, intrinsic)));
             };
         };
     };
@@ -1087,6 +1087,536 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"MAP_DIRECT_RANGE_IDX_VAL"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VM_OP_MAP_DIRECT_RANGE_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_tls.ext_reg3 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_vm_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vm_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) == syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"MAP_DIRECT_RANGE_IDX_VAL never allocated"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VM_OP_MAP_DIRECT_RANGE_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_tls.ext_reg3 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_vm_pool.initialize();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vm_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"MAP_DIRECT_RANGE_IDX_VAL invalid phys"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VM_OP_MAP_DIRECT_RANGE_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = {};
+                    mut_tls.ext_reg3 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_vm_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vm_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"MAP_DIRECT_RANGE_IDX_VAL invalid size #1"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VM_OP_MAP_DIRECT_RANGE_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_tls.ext_reg3 = {};
+                    mut_vm_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vm_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"MAP_DIRECT_RANGE_IDX_VAL invalid size #2"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VM_OP_MAP_DIRECT_RANGE_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_tls.ext_reg3 = 0x1001_u64.get();
+                    mut_vm_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vm_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"MAP_DIRECT_RANGE_IDX_VAL invalid size #3"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VM_OP_MAP_DIRECT_RANGE_IDX_VAL};
+                constexpr auto too_big{
+                    (HYPERVISOR_EXT_DIRECT_MAP_SIZE + HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_tls.ext_reg3 = too_big.get();
+                    mut_vm_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vm_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"MAP_DIRECT_RANGE_IDX_VAL out of range"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VM_OP_MAP_DIRECT_RANGE_IDX_VAL};
+                constexpr auto last{
+                    (HYPERVISOR_EXT_DIRECT_MAP_SIZE - HYPERVISOR_PAGE_SIZE).checked()};
+                constexpr auto size{(HYPERVISOR_PAGE_SIZE + HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = last.get();
+                    mut_tls.ext_reg3 = size.get();
+                    mut_vm_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vm_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"MAP_DIRECT_RANGE_IDX_VAL map_range_direct fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VM_OP_MAP_DIRECT_RANGE_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_tls.ext_reg3 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_vm_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    mut_tls.test_virt = bsl::safe_u64::failure();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vm_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"UNMAP_DIRECT_RANGE_IDX_VAL"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VM_OP_UNMAP_DIRECT_RANGE_IDX_VAL};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + 0x1000_u64).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = virt.get();
+                    mut_tls.ext_reg3 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_vm_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vm_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) == syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"UNMAP_DIRECT_RANGE_IDX_VAL never allocated"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VM_OP_UNMAP_DIRECT_RANGE_IDX_VAL};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + 0x1000_u64).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = virt.get();
+                    mut_tls.ext_reg3 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_vm_pool.initialize();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vm_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"UNMAP_DIRECT_RANGE_IDX_VAL invalid virt"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VM_OP_UNMAP_DIRECT_RANGE_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = {};
+                    mut_tls.ext_reg3 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_vm_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vm_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"UNMAP_DIRECT_RANGE_IDX_VAL invalid size"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VM_OP_UNMAP_DIRECT_RANGE_IDX_VAL};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + 0x1000_u64).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = virt.get();
+                    mut_tls.ext_reg3 = {};
+                    mut_vm_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vm_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"UNMAP_DIRECT_RANGE_IDX_VAL out of range"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VM_OP_UNMAP_DIRECT_RANGE_IDX_VAL};
+                constexpr auto last{
+                    (HYPERVISOR_EXT_DIRECT_MAP_ADDR + HYPERVISOR_EXT_DIRECT_MAP_SIZE -
+                     HYPERVISOR_PAGE_SIZE)
+                        .checked()};
+                constexpr auto size{(HYPERVISOR_PAGE_SIZE + HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = last.get();
+                    mut_tls.ext_reg3 = size.get();
+                    mut_vm_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vm_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"UNMAP_DIRECT_RANGE_IDX_VAL fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VM_OP_UNMAP_DIRECT_RANGE_IDX_VAL};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + 0x1000_u64).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = virt.get();
+                    mut_tls.ext_reg3 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_vm_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    mut_tls.test_ret = bsl::errc_failure;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vm_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"UNMAP_DIRECT_BROADCAST_IDX_VAL fails"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 tls_t mut_tls{};
@@ -2561,6 +2561,135 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"RUN_IDX_VAL from a tick"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_RUN_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.in_tick = bsl::safe_u64::magic_1().get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) == syscall::BF_STATUS_INVALID_PERM_DENIED);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"SET_ACTIVE_IDX_VAL from a tick"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_SET_ACTIVE_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.in_tick = bsl::safe_u64::magic_1().get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) == syscall::BF_STATUS_INVALID_PERM_DENIED);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"RUN_CURRENT_IDX_VAL from a tick"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_RUN_CURRENT_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.in_tick = bsl::safe_u64::magic_1().get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) == syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"RUN_CURRENT_IDX_VAL"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 tls_t mut_tls{};
@@ -6314,6 +6443,41 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"DRAIN_POSTED_EVENTS_IDX_VAL"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_DRAIN_POSTED_EVENTS_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) == syscall::BF_STATUS_SUCCESS);
+                        bsl::ut_check(syscall::BF_POSTED_EVENT_NMI == mut_tls.ext_reg0);
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
@@ -160,6 +160,28 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"reclaim"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_pool_t mut_ext_pool{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_ext_pool.reclaim(mut_tls, mut_page_pool);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"flush_tlb"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_pool_t mut_ext_pool{};
+                tls_t mut_tls{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_ext_pool.flush_tlb(mut_tls, mut_intrinsic);
+                };
+            };
+        };
+
         bsl::ut_scenario{"signal_vm_active"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 ext_pool_t mut_ext_pool{};
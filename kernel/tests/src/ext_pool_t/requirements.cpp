@@ -69,6 +69,8 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool)));
                 static_assert(noexcept(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {})));
                 static_assert(noexcept(mut_ext.signal_vm_destroyed(mut_tls, mut_page_pool, {})));
+                static_assert(noexcept(mut_ext.reclaim(mut_tls, mut_page_pool)));
+                static_assert(noexcept(mut_ext.flush_tlb(mut_tls, mut_intrinsic)));
                 static_assert(noexcept(mut_ext.signal_vm_active(mut_tls, mut_intrinsic, {})));
                 static_assert(noexcept(mut_ext.start(mut_tls, mut_intrinsic)));
                 static_assert(noexcept(mut_ext.bootstrap(mut_tls, mut_intrinsic)));
@@ -32,6 +32,7 @@
 #include <bfelf/elf64_phdr_t.hpp>
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
+#include <l0e_t.hpp>
 #include <mk_args_t.hpp>
 #include <page_pool_t.hpp>
 #include <root_page_table_t.hpp>
@@ -121,6 +122,25 @@ namespace mk
     /// @brief defines the memory size of our GNU_STACK segment
     constexpr auto PT_GNU_STACK_MEMSZ{0x0_u64};
 
+    /// @brief defines the size of the segment data in shared_elf_file_t
+    constexpr auto SHARED_ELF_FILE_DATA_SIZE{0x2000_umx};
+    /// @brief defines the number of pages in shared_elf_file_t
+    constexpr auto SHARED_ELF_FILE_PAGES{3_umx};
+
+    /// <!-- description -->
+    ///   @brief Defines an ELF file that is followed by its segment data
+    ///     in the same page aligned allocation, like the loader's copy of
+    ///     an extension's ELF file, so that segments can be shared.
+    ///
+    struct shared_elf_file_t final
+    {
+        /// @brief stores the ELF file header
+        loader::ext_elf_file_t file;
+        /// @brief stores the segment data, starting at the second page
+        alignas(HYPERVISOR_PAGE_SIZE.get())
+            bsl::array<bsl::uint8, SHARED_ELF_FILE_DATA_SIZE.get()> data;
+    };
+
     /// <!-- description -->
     ///   @brief Returns an allocated and initialized ELF file buffer for use
     ///     during testing.
@@ -322,6 +342,81 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"initialize with shared segments"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                auto *const pmut_shared{new shared_elf_file_t()};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                constexpr bsl::array<bsl::uint64, SHARED_ELF_FILE_PAGES.get()> file_phys{
+                    0x1000_u64.get(), 0x2000_u64.get(), 0x3000_u64.get()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(pmut_shared->file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    auto *const pmut_re{mut_phdr_table.at_if(PHDR_PT_LOAD_RE_IDX)};
+                    pmut_re->p_offset = pmut_shared->data.data();
+                    pmut_re->p_memsz = pmut_re->p_filesz;
+                    auto *const pmut_ro{mut_phdr_table.at_if(PHDR_PT_LOAD_RO_IDX)};
+                    pmut_ro->p_offset = pmut_shared->data.data();
+                    pmut_ro->p_memsz = pmut_ro->p_filesz;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.initialize(
+                            mut_tls,
+                            mut_page_pool,
+                            {},
+                            &pmut_shared->file,
+                            mut_rpt,
+                            {file_phys.data(), file_phys.size()}));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                        delete pmut_shared;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"initialize with a shared segment outside of file_phys"} =
+            [&]() noexcept {
+                bsl::ut_given{} = [&]() noexcept {
+                    auto const elf_file_buf{get_elf_file_buf()};
+                    loader::ext_elf_file_t mut_file{};
+                    phdr_table_t mut_phdr_table{};
+                    ext_t mut_ext{};
+                    tls_t mut_tls{};
+                    page_pool_t mut_page_pool{};
+                    huge_pool_t mut_huge_pool{};
+                    root_page_table_t mut_rpt{};
+                    constexpr bsl::array<bsl::uint64, 1U> file_phys{0x1000_u64.get()};
+                    bsl::ut_when{} = [&]() noexcept {
+                        mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                        load_elf_file(mut_file, mut_phdr_table);
+                        load_phdr_table(mut_phdr_table, elf_file_buf);
+                        auto *const pmut_phdr{mut_phdr_table.at_if(PHDR_PT_LOAD_RE_IDX)};
+                        pmut_phdr->p_memsz = pmut_phdr->p_filesz;
+                        bsl::ut_then{} = [&]() noexcept {
+                            bsl::ut_check(mut_ext.initialize(
+                                mut_tls,
+                                mut_page_pool,
+                                {},
+                                &mut_file,
+                                mut_rpt,
+                                {file_phys.data(), file_phys.size()}));
+                        };
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                            clr_elf_file_buf(elf_file_buf);
+                        };
+                    };
+                };
+            };
+
         bsl::ut_scenario{"initialize without tls"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
@@ -742,6 +837,68 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"tick_ip"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                constexpr auto ip{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.tick_ip().is_zero());
+                    };
+
+                    mut_ext.set_tick_ip(ip);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ip == mut_ext.tick_ip());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"tick_period"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                constexpr auto period{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.tick_period().is_zero());
+                    };
+
+                    mut_ext.set_tick_period(period);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(period == mut_ext.tick_period());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"handle"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
@@ -1038,7 +1195,7 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"map_page_direct"} = [&]() noexcept {
+        bsl::ut_scenario{"free_page"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1048,8 +1205,10 @@ namespace mk
                 page_pool_t mut_page_pool{};
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
+                intrinsic_t const intrinsic{};
+                lib::l0e_t mut_l0e{};
                 constexpr auto phys{0x1000_umx};
-                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                constexpr auto virt{(HYPERVISOR_EXT_PAGE_POOL_ADDR + phys).checked()};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
@@ -1057,9 +1216,11 @@ namespace mk
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
                     bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_l0e.auto_release = bsl::safe_u64::magic_1().get();
+                    mut_l0e.phys = bsl::safe_u64::magic_1().get();
+                    mut_tls.test_ents.l0e = &mut_l0e;
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(
-                            virt == mut_ext.map_page_direct(mut_tls, mut_page_pool, {}, phys));
+                        bsl::ut_check(mut_ext.free_page(mut_tls, mut_page_pool, intrinsic, virt));
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
@@ -1069,7 +1230,7 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"map_page_direct map fails"} = [&]() noexcept {
+        bsl::ut_scenario{"free_page virt out of range"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1079,8 +1240,10 @@ namespace mk
                 page_pool_t mut_page_pool{};
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
+                intrinsic_t const intrinsic{};
+                lib::l0e_t mut_l0e{};
                 constexpr auto phys{0x1000_umx};
-                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                constexpr auto virt{phys};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
@@ -1088,10 +1251,11 @@ namespace mk
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
                     bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
-                    mut_tls.test_virt = virt.get();
+                    mut_l0e.auto_release = bsl::safe_u64::magic_1().get();
+                    mut_l0e.phys = bsl::safe_u64::magic_1().get();
+                    mut_tls.test_ents.l0e = &mut_l0e;
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(
-                            mut_ext.map_page_direct(mut_tls, mut_page_pool, {}, phys).is_invalid());
+                        bsl::ut_check(!mut_ext.free_page(mut_tls, mut_page_pool, intrinsic, virt));
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
@@ -1101,7 +1265,7 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"unmap_page_direct"} = [&]() noexcept {
+        bsl::ut_scenario{"free_page not mapped"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1112,8 +1276,9 @@ namespace mk
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
                 intrinsic_t const intrinsic{};
+                lib::l0e_t mut_l0e{};
                 constexpr auto phys{0x1000_umx};
-                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                constexpr auto virt{(HYPERVISOR_EXT_PAGE_POOL_ADDR + phys).checked()};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
@@ -1121,11 +1286,10 @@ namespace mk
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
                     bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
-                    bsl::ut_required_step(
-                        mut_ext.map_page_direct(mut_tls, mut_page_pool, {}, phys));
+                    mut_l0e.auto_release = bsl::safe_u64::magic_1().get();
+                    mut_l0e.phys = bsl::safe_u64::magic_1().get();
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(
-                            mut_ext.unmap_page_direct(mut_tls, mut_page_pool, intrinsic, {}, virt));
+                        bsl::ut_check(!mut_ext.free_page(mut_tls, mut_page_pool, intrinsic, virt));
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
@@ -1135,7 +1299,7 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"unmap_page_direct unmap fails"} = [&]() noexcept {
+        bsl::ut_scenario{"free_page not auto released"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1146,8 +1310,9 @@ namespace mk
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
                 intrinsic_t const intrinsic{};
+                lib::l0e_t mut_l0e{};
                 constexpr auto phys{0x1000_umx};
-                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                constexpr auto virt{(HYPERVISOR_EXT_PAGE_POOL_ADDR + phys).checked()};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
@@ -1155,10 +1320,12 @@ namespace mk
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
                     bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
-                    mut_tls.test_virt = virt.get();
+                    mut_l0e.auto_release = bsl::safe_u64::magic_1().get();
+                    mut_l0e.phys = bsl::safe_u64::magic_1().get();
+                    mut_l0e.auto_release = bsl::safe_u64::magic_0().get();
+                    mut_tls.test_ents.l0e = &mut_l0e;
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(!mut_ext.unmap_page_direct(
-                            mut_tls, mut_page_pool, intrinsic, {}, virt));
+                        bsl::ut_check(!mut_ext.free_page(mut_tls, mut_page_pool, intrinsic, virt));
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
@@ -1168,7 +1335,7 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"signal_vm_created"} = [&]() noexcept {
+        bsl::ut_scenario{"free_page explicit unmap"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1178,14 +1345,23 @@ namespace mk
                 page_pool_t mut_page_pool{};
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
+                intrinsic_t const intrinsic{};
+                lib::l0e_t mut_l0e{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_PAGE_POOL_ADDR + phys).checked()};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
                     load_phdr_table(mut_phdr_table, elf_file_buf);
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_l0e.auto_release = bsl::safe_u64::magic_1().get();
+                    mut_l0e.phys = bsl::safe_u64::magic_1().get();
+                    mut_l0e.explicit_unmap = bsl::safe_u64::magic_1().get();
+                    mut_tls.test_ents.l0e = &mut_l0e;
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                        bsl::ut_check(!mut_ext.free_page(mut_tls, mut_page_pool, intrinsic, virt));
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
@@ -1195,7 +1371,7 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"signal_vm_created direct map initialize fails"} = [&]() noexcept {
+        bsl::ut_scenario{"free_page alias"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1205,15 +1381,23 @@ namespace mk
                 page_pool_t mut_page_pool{};
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
+                intrinsic_t const intrinsic{};
+                lib::l0e_t mut_l0e{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_PAGE_POOL_ADDR + phys).checked()};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
                     load_phdr_table(mut_phdr_table, elf_file_buf);
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
-                    mut_tls.test_ret = lib::UNIT_TEST_RPT_FAIL_INITIALIZE;
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_l0e.auto_release = bsl::safe_u64::magic_1().get();
+                    mut_l0e.phys = bsl::safe_u64::magic_1().get();
+                    mut_l0e.alias = bsl::safe_u64::magic_1().get();
+                    mut_tls.test_ents.l0e = &mut_l0e;
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(!mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                        bsl::ut_check(!mut_ext.free_page(mut_tls, mut_page_pool, intrinsic, virt));
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
@@ -1223,7 +1407,7 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"signal_vm_destroyed"} = [&]() noexcept {
+        bsl::ut_scenario{"free_page wrong phys"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1233,6 +1417,10 @@ namespace mk
                 page_pool_t mut_page_pool{};
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
+                intrinsic_t const intrinsic{};
+                lib::l0e_t mut_l0e{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_PAGE_POOL_ADDR + phys).checked()};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
@@ -1240,8 +1428,12 @@ namespace mk
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
                     bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_l0e.auto_release = bsl::safe_u64::magic_1().get();
+                    mut_l0e.phys = bsl::safe_u64::magic_1().get();
+                    mut_l0e.phys = bsl::safe_u64::magic_2().get();
+                    mut_tls.test_ents.l0e = &mut_l0e;
                     bsl::ut_then{} = [&]() noexcept {
-                        mut_ext.signal_vm_destroyed(mut_tls, mut_page_pool, {});
+                        bsl::ut_check(!mut_ext.free_page(mut_tls, mut_page_pool, intrinsic, virt));
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
@@ -1251,7 +1443,7 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"signal_vm_active"} = [&]() noexcept {
+        bsl::ut_scenario{"free_page unmap fails"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1261,7 +1453,10 @@ namespace mk
                 page_pool_t mut_page_pool{};
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
-                intrinsic_t mut_intrinsic{};
+                intrinsic_t const intrinsic{};
+                lib::l0e_t mut_l0e{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_PAGE_POOL_ADDR + phys).checked()};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
@@ -1269,8 +1464,12 @@ namespace mk
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
                     bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_l0e.auto_release = bsl::safe_u64::magic_1().get();
+                    mut_l0e.phys = bsl::safe_u64::magic_1().get();
+                    mut_tls.test_ents.l0e = &mut_l0e;
+                    mut_tls.test_virt = virt;
                     bsl::ut_then{} = [&]() noexcept {
-                        mut_ext.signal_vm_active(mut_tls, mut_intrinsic, {});
+                        bsl::ut_check(!mut_ext.free_page(mut_tls, mut_page_pool, intrinsic, virt));
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
@@ -1280,7 +1479,7 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"start"} = [&]() noexcept {
+        bsl::ut_scenario{"free_huge"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1290,7 +1489,8 @@ namespace mk
                 page_pool_t mut_page_pool{};
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
-                intrinsic_t mut_intrinsic{};
+                intrinsic_t const intrinsic{};
+                constexpr auto size{0x2000_umx};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
@@ -1298,10 +1498,13 @@ namespace mk
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
                     bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    auto const huge{
+                        mut_ext.alloc_huge(mut_tls, mut_page_pool, mut_huge_pool, size)};
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(!mut_ext.is_started());
-                        bsl::ut_check(mut_ext.start(mut_tls, mut_intrinsic));
-                        bsl::ut_check(mut_ext.is_started());
+                        bsl::ut_check(mut_ext.free_huge(
+                            mut_tls, mut_page_pool, mut_huge_pool, intrinsic, huge.virt));
+                        bsl::ut_check(!mut_ext.free_huge(
+                            mut_tls, mut_page_pool, mut_huge_pool, intrinsic, huge.virt));
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
@@ -1311,7 +1514,82 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"start call_ext fails"} = [&]() noexcept {
+        bsl::ut_scenario{"free_huge not allocated"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t const intrinsic{};
+                constexpr auto size{0x2000_umx};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    auto const huge{
+                        mut_ext.alloc_huge(mut_tls, mut_page_pool, mut_huge_pool, size)};
+                    auto const virt{(huge.virt + size).checked()};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.free_huge(
+                            mut_tls, mut_page_pool, mut_huge_pool, intrinsic, virt));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"free_huge releases a huge allocation slot"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t const intrinsic{};
+                constexpr auto size{0x2000_umx};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    auto const huge1{
+                        mut_ext.alloc_huge(mut_tls, mut_page_pool, mut_huge_pool, size)};
+                    auto const huge2{
+                        mut_ext.alloc_huge(mut_tls, mut_page_pool, mut_huge_pool, size)};
+                    bsl::ut_required_step(mut_ext.free_huge(
+                        mut_tls, mut_page_pool, mut_huge_pool, intrinsic, huge1.virt));
+                    auto const huge3{
+                        mut_ext.alloc_huge(mut_tls, mut_page_pool, mut_huge_pool, size)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(huge2.virt.is_valid());
+                        bsl::ut_check(huge3.virt.is_valid());
+                        bsl::ut_check(mut_ext.free_huge(
+                            mut_tls, mut_page_pool, mut_huge_pool, intrinsic, huge2.virt));
+                        bsl::ut_check(mut_ext.free_huge(
+                            mut_tls, mut_page_pool, mut_huge_pool, intrinsic, huge3.virt));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_page_direct"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1322,16 +1600,20 @@ namespace mk
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
                 intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
                     load_phdr_table(mut_phdr_table, elf_file_buf);
-                    mut_file.e_entry = bsl::safe_u64::magic_1().get();
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
                     bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(!mut_ext.start(mut_tls, mut_intrinsic));
+                        bsl::ut_check(
+                            virt == mut_ext.map_page_direct(
+                                        mut_tls, mut_page_pool, mut_intrinsic, {}, phys));
+                        bsl::ut_check(nullptr != mut_tls.active_rpt);
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
@@ -1341,7 +1623,7 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"start more than once"} = [&]() noexcept {
+        bsl::ut_scenario{"map_page_direct map fails"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1352,6 +1634,8 @@ namespace mk
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
                 intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
@@ -1359,10 +1643,11 @@ namespace mk
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
                     bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_tls.test_virt = virt.get();
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(mut_ext.start(mut_tls, mut_intrinsic));
-                        bsl::ut_check(mut_ext.start(mut_tls, mut_intrinsic));
-                        bsl::ut_check(mut_ext.start(mut_tls, mut_intrinsic));
+                        bsl::ut_check(
+                            mut_ext.map_page_direct(mut_tls, mut_page_pool, mut_intrinsic, {}, phys)
+                                .is_invalid());
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
@@ -1372,7 +1657,7 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"bootstrap"} = [&]() noexcept {
+        bsl::ut_scenario{"map_page_direct inactive vm"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1383,16 +1668,20 @@ namespace mk
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
                 intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
                     load_phdr_table(mut_phdr_table, elf_file_buf);
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
-                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
-                    mut_ext.set_bootstrap_ip(HYPERVISOR_PAGE_SIZE);
+                    mut_tls.active_vmid = bsl::to_u16(1).get();
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(mut_ext.bootstrap(mut_tls, mut_intrinsic));
+                        bsl::ut_check(
+                            virt == mut_ext.map_page_direct(
+                                        mut_tls, mut_page_pool, mut_intrinsic, {}, phys));
+                        bsl::ut_check(nullptr == mut_tls.active_rpt);
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
@@ -1402,7 +1691,7 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"bootstrap call_ext fails"} = [&]() noexcept {
+        bsl::ut_scenario{"map_page_direct more than once"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1413,16 +1702,22 @@ namespace mk
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
                 intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
                     load_phdr_table(mut_phdr_table, elf_file_buf);
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
-                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
-                    mut_ext.set_bootstrap_ip(bsl::safe_u64::magic_1());
+                    bsl::ut_required_step(
+                        mut_ext.map_page_direct(mut_tls, mut_page_pool, mut_intrinsic, {}, phys));
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(!mut_ext.bootstrap(mut_tls, mut_intrinsic));
+                        bsl::ut_check(mut_ext.unmap_page_direct(
+                            mut_tls, mut_page_pool, mut_intrinsic, {}, virt));
+                        bsl::ut_check(
+                            virt == mut_ext.map_page_direct(
+                                        mut_tls, mut_page_pool, mut_intrinsic, {}, phys));
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
@@ -1432,7 +1727,7 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"bootstrap more than once"} = [&]() noexcept {
+        bsl::ut_scenario{"map_page_direct direct map initialize fails"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1443,18 +1738,19 @@ namespace mk
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
                 intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
                     load_phdr_table(mut_phdr_table, elf_file_buf);
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
-                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
-                    mut_ext.set_bootstrap_ip(HYPERVISOR_PAGE_SIZE);
+                    mut_tls.test_ret = lib::UNIT_TEST_RPT_FAIL_INITIALIZE;
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(mut_ext.bootstrap(mut_tls, mut_intrinsic));
-                        bsl::ut_check(mut_ext.bootstrap(mut_tls, mut_intrinsic));
-                        bsl::ut_check(mut_ext.bootstrap(mut_tls, mut_intrinsic));
+                        bsl::ut_check(
+                            mut_ext.map_page_direct(mut_tls, mut_page_pool, mut_intrinsic, {}, phys)
+                                .is_invalid());
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
@@ -1464,7 +1760,7 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"bootstrap no ip"} = [&]() noexcept {
+        bsl::ut_scenario{"unmap_page_direct"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1475,6 +1771,8 @@ namespace mk
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
                 intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
@@ -1482,8 +1780,11 @@ namespace mk
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
                     bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    bsl::ut_required_step(
+                        mut_ext.map_page_direct(mut_tls, mut_page_pool, mut_intrinsic, {}, phys));
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(!mut_ext.bootstrap(mut_tls, mut_intrinsic));
+                        bsl::ut_check(mut_ext.unmap_page_direct(
+                            mut_tls, mut_page_pool, mut_intrinsic, {}, virt));
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
@@ -1493,7 +1794,7 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"vmexit"} = [&]() noexcept {
+        bsl::ut_scenario{"unmap_page_direct unmap fails"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1504,6 +1805,8 @@ namespace mk
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
                 intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
@@ -1511,9 +1814,12 @@ namespace mk
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
                     bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
-                    mut_ext.set_vmexit_ip(HYPERVISOR_PAGE_SIZE);
+                    bsl::ut_required_step(
+                        mut_ext.map_page_direct(mut_tls, mut_page_pool, mut_intrinsic, {}, phys));
+                    mut_tls.test_virt = virt.get();
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(mut_ext.vmexit(mut_tls, mut_intrinsic, {}));
+                        bsl::ut_check(!mut_ext.unmap_page_direct(
+                            mut_tls, mut_page_pool, mut_intrinsic, {}, virt));
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
@@ -1523,7 +1829,7 @@ namespace mk
             };
         };
 
-        bsl::ut_scenario{"vmexit call_ext fails"} = [&]() noexcept {
+        bsl::ut_scenario{"unmap_page_direct nothing mapped"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
                 loader::ext_elf_file_t mut_file{};
@@ -1534,6 +1840,8 @@ namespace mk
                 huge_pool_t mut_huge_pool{};
                 root_page_table_t mut_rpt{};
                 intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.online_pps = NUM_ONLINE_PPS.get();
                     load_elf_file(mut_file, mut_phdr_table);
@@ -1541,9 +1849,957 @@ namespace mk
                     bsl::ut_required_step(
                         mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
                     bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
-                    mut_ext.set_vmexit_ip(bsl::safe_u64::magic_1());
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(!mut_ext.vmexit(mut_tls, mut_intrinsic, {}));
+                        bsl::ut_check(!mut_ext.unmap_page_direct(
+                            mut_tls, mut_page_pool, mut_intrinsic, {}, virt));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_range_direct"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x3FDFF000_umx};
+                constexpr auto size{0x40402000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            virt == mut_ext.map_range_direct(
+                                        mut_tls, mut_page_pool, mut_intrinsic, {}, phys, size));
+                        bsl::ut_check(nullptr != mut_tls.active_rpt);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_range_direct 1g pages not supported"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x3FDFF000_umx};
+                constexpr auto size{0x40402000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    mut_intrinsic.set_page_1g_supported(false);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            virt == mut_ext.map_range_direct(
+                                        mut_tls, mut_page_pool, mut_intrinsic, {}, phys, size));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_range_direct map 4k fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x3FDFF000_umx};
+                constexpr auto size{0x40402000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    mut_tls.test_virt = virt.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext
+                                          .map_range_direct(
+                                              mut_tls, mut_page_pool, mut_intrinsic, {}, phys, size)
+                                          .is_invalid());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_range_direct map 1g fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x3FDFF000_umx};
+                constexpr auto size{0x40402000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    constexpr auto virt_1g{(virt + 0x201000_umx).checked()};
+                    mut_tls.test_virt = virt_1g.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext
+                                          .map_range_direct(
+                                              mut_tls, mut_page_pool, mut_intrinsic, {}, phys, size)
+                                          .is_invalid());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_range_direct direct map initialize fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x3FDFF000_umx};
+                constexpr auto size{0x40402000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    mut_tls.test_ret = lib::UNIT_TEST_RPT_FAIL_INITIALIZE;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext
+                                          .map_range_direct(
+                                              mut_tls, mut_page_pool, mut_intrinsic, {}, phys, size)
+                                          .is_invalid());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_range_direct"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x3FDFF000_umx};
+                constexpr auto size{0x40402000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.map_range_direct(
+                        mut_tls, mut_page_pool, mut_intrinsic, {}, phys, size));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.unmap_range_direct(
+                            mut_tls, mut_page_pool, mut_intrinsic, {}, virt, size));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_range_direct unmap 2m fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x3FDFF000_umx};
+                constexpr auto size{0x40402000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.map_range_direct(
+                        mut_tls, mut_page_pool, mut_intrinsic, {}, phys, size));
+                    constexpr auto virt_2m{(virt + HYPERVISOR_PAGE_SIZE).checked()};
+                    mut_tls.test_virt = virt_2m.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.unmap_range_direct(
+                            mut_tls, mut_page_pool, mut_intrinsic, {}, virt, size));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_range_direct nothing mapped"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x3FDFF000_umx};
+                constexpr auto size{0x40402000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.unmap_range_direct(
+                            mut_tls, mut_page_pool, mut_intrinsic, {}, virt, size));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"signal_vm_created"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"signal_vm_destroyed"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_ext.signal_vm_destroyed(mut_tls, mut_page_pool, {});
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"signal_vm_destroyed with direct map"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.map_page_direct(mut_tls, mut_page_pool, mut_intrinsic, {}, phys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_ext.signal_vm_destroyed(mut_tls, mut_page_pool, {});
+                        bsl::ut_check(!mut_ext.unmap_page_direct(
+                            mut_tls, mut_page_pool, mut_intrinsic, {}, virt));
+                        bsl::ut_check(
+                            virt == mut_ext.map_page_direct(
+                                        mut_tls, mut_page_pool, mut_intrinsic, {}, phys));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"signal_vm_destroyed cache full"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.map_page_direct(mut_tls, mut_page_pool, mut_intrinsic, {}, phys));
+                    bsl::ut_required_step(mut_ext.map_page_direct(
+                        mut_tls, mut_page_pool, mut_intrinsic, bsl::to_u16(1), phys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_ext.signal_vm_destroyed(mut_tls, mut_page_pool, {});
+                        mut_ext.signal_vm_destroyed(mut_tls, mut_page_pool, bsl::to_u16(1));
+                        bsl::ut_check(
+                            virt == mut_ext.map_page_direct(
+                                        mut_tls, mut_page_pool, mut_intrinsic, {}, phys));
+                        bsl::ut_check(
+                            virt == mut_ext.map_page_direct(
+                                        mut_tls,
+                                        mut_page_pool,
+                                        mut_intrinsic,
+                                        bsl::to_u16(1),
+                                        phys));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"reclaim nothing to reclaim"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_ext.reclaim(mut_tls, mut_page_pool);
+                        bsl::ut_check(
+                            virt == mut_ext.map_page_direct(
+                                        mut_tls, mut_page_pool, mut_intrinsic, {}, phys));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"reclaim"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.map_page_direct(mut_tls, mut_page_pool, mut_intrinsic, {}, phys));
+                    mut_ext.signal_vm_destroyed(mut_tls, mut_page_pool, {});
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_ext.reclaim(mut_tls, mut_page_pool);
+                        mut_ext.reclaim(mut_tls, mut_page_pool);
+                        bsl::ut_check(
+                            virt == mut_ext.map_page_direct(
+                                        mut_tls, mut_page_pool, mut_intrinsic, {}, phys));
+                        bsl::ut_check(
+                            virt == mut_ext.map_page_direct(
+                                        mut_tls,
+                                        mut_page_pool,
+                                        mut_intrinsic,
+                                        bsl::to_u16(1),
+                                        phys));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"flush_tlb"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_ext.flush_tlb(mut_tls, mut_intrinsic);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"reclaim cache full"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(
+                        mut_ext.map_page_direct(mut_tls, mut_page_pool, mut_intrinsic, {}, phys));
+                    bsl::ut_required_step(mut_ext.map_page_direct(
+                        mut_tls, mut_page_pool, mut_intrinsic, bsl::to_u16(1), phys));
+                    mut_ext.signal_vm_destroyed(mut_tls, mut_page_pool, {});
+                    mut_ext.signal_vm_destroyed(mut_tls, mut_page_pool, bsl::to_u16(1));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_ext.reclaim(mut_tls, mut_page_pool);
+                        mut_ext.reclaim(mut_tls, mut_page_pool);
+                        bsl::ut_check(
+                            virt == mut_ext.map_page_direct(
+                                        mut_tls, mut_page_pool, mut_intrinsic, {}, phys));
+                        bsl::ut_check(
+                            virt == mut_ext.map_page_direct(
+                                        mut_tls,
+                                        mut_page_pool,
+                                        mut_intrinsic,
+                                        bsl::to_u16(1),
+                                        phys));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"signal_vm_active"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_ext.signal_vm_active(mut_tls, mut_intrinsic, {});
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+                bsl::ut_scenario{"signal_vm_active with direct map"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    mut_tls.active_vmid = bsl::to_u16(1).get();
+                    bsl::ut_required_step(
+                        mut_ext.map_page_direct(mut_tls, mut_page_pool, mut_intrinsic, {}, phys));
+                    mut_ext.signal_vm_active(mut_tls, mut_intrinsic, bsl::to_u16(1));
+                    auto const *const main_rpt{mut_tls.active_rpt};
+                    mut_tls.active_vmid = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_ext.signal_vm_active(mut_tls, mut_intrinsic, {});
+                        bsl::ut_check(nullptr != mut_tls.active_rpt);
+                        bsl::ut_check(main_rpt != mut_tls.active_rpt);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+bsl::ut_scenario{"start"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.is_started());
+                        bsl::ut_check(mut_ext.start(mut_tls, mut_intrinsic));
+                        bsl::ut_check(mut_ext.is_started());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"start call_ext fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    mut_file.e_entry = bsl::safe_u64::magic_1().get();
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.start(mut_tls, mut_intrinsic));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"start more than once"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.start(mut_tls, mut_intrinsic));
+                        bsl::ut_check(mut_ext.start(mut_tls, mut_intrinsic));
+                        bsl::ut_check(mut_ext.start(mut_tls, mut_intrinsic));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bootstrap"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_ext.set_bootstrap_ip(HYPERVISOR_PAGE_SIZE);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.bootstrap(mut_tls, mut_intrinsic));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bootstrap call_ext fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_ext.set_bootstrap_ip(bsl::safe_u64::magic_1());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.bootstrap(mut_tls, mut_intrinsic));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bootstrap more than once"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_ext.set_bootstrap_ip(HYPERVISOR_PAGE_SIZE);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.bootstrap(mut_tls, mut_intrinsic));
+                        bsl::ut_check(mut_ext.bootstrap(mut_tls, mut_intrinsic));
+                        bsl::ut_check(mut_ext.bootstrap(mut_tls, mut_intrinsic));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bootstrap no ip"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.bootstrap(mut_tls, mut_intrinsic));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"vmexit"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_ext.set_vmexit_ip(HYPERVISOR_PAGE_SIZE);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.vmexit(mut_tls, mut_intrinsic, {}));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"vmexit call_ext fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_ext.set_vmexit_ip(bsl::safe_u64::magic_1());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.vmexit(mut_tls, mut_intrinsic, {}));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"tick"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_ext.set_tick_ip(HYPERVISOR_PAGE_SIZE);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.tick(mut_tls, mut_intrinsic));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"tick call_ext fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_ext.set_tick_ip(bsl::safe_u64::magic_1());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.tick(mut_tls, mut_intrinsic));
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
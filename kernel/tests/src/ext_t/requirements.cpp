@@ -73,6 +73,10 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_ext.set_vmexit_ip({})));
                 static_assert(noexcept(mut_ext.fail_ip()));
                 static_assert(noexcept(mut_ext.set_fail_ip({})));
+                static_assert(noexcept(mut_ext.tick_ip()));
+                static_assert(noexcept(mut_ext.set_tick_ip({})));
+                static_assert(noexcept(mut_ext.tick_period()));
+                static_assert(noexcept(mut_ext.set_tick_period({})));
                 static_assert(noexcept(mut_ext.open_handle()));
                 static_assert(noexcept(mut_ext.close_handle()));
                 static_assert(noexcept(mut_ext.is_handle_valid({})));
@@ -82,15 +86,26 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_ext.alloc_page(mut_tls, mut_page_pool)));
                 static_assert(
                     noexcept(mut_ext.alloc_huge(mut_tls, mut_page_pool, mut_huge_pool, {})));
-                static_assert(noexcept(mut_ext.map_page_direct(mut_tls, mut_page_pool, {}, {})));
+                static_assert(noexcept(mut_ext.free_page(mut_tls, mut_page_pool, {}, {})));
+                static_assert(noexcept(
+                    mut_ext.free_huge(mut_tls, mut_page_pool, mut_huge_pool, {}, {})));
+                static_assert(noexcept(
+                    mut_ext.map_page_direct(mut_tls, mut_page_pool, mut_intrinsic, {}, {})));
                 static_assert(
                     noexcept(mut_ext.unmap_page_direct(mut_tls, mut_page_pool, {}, {}, {})));
+                static_assert(noexcept(mut_ext.map_range_direct(
+                    mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {})));
+                static_assert(
+                    noexcept(mut_ext.unmap_range_direct(mut_tls, mut_page_pool, {}, {}, {}, {})));
                 static_assert(noexcept(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {})));
                 static_assert(noexcept(mut_ext.signal_vm_destroyed(mut_tls, mut_page_pool, {})));
+                static_assert(noexcept(mut_ext.reclaim(mut_tls, mut_page_pool)));
+                static_assert(noexcept(mut_ext.flush_tlb(mut_tls, mut_intrinsic)));
                 static_assert(noexcept(mut_ext.signal_vm_active(mut_tls, mut_intrinsic, {})));
                 static_assert(noexcept(mut_ext.start(mut_tls, mut_intrinsic)));
                 static_assert(noexcept(mut_ext.bootstrap(mut_tls, mut_intrinsic)));
                 static_assert(noexcept(mut_ext.vmexit(mut_tls, mut_intrinsic, {})));
+                static_assert(noexcept(mut_ext.tick(mut_tls, mut_intrinsic)));
                 static_assert(noexcept(mut_ext.fail(mut_tls, mut_intrinsic, {}, {})));
                 static_assert(noexcept(mut_ext.dump({})));
 
@@ -98,6 +113,8 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(ext.bootstrap_ip()));
                 static_assert(noexcept(ext.vmexit_ip()));
                 static_assert(noexcept(ext.fail_ip()));
+                static_assert(noexcept(ext.tick_ip()));
+                static_assert(noexcept(ext.tick_period()));
                 static_assert(noexcept(ext.is_handle_valid({})));
                 static_assert(noexcept(ext.handle()));
                 static_assert(noexcept(ext.is_started()));
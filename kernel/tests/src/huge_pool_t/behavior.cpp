@@ -93,6 +93,88 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"deallocate empty"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_4k_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    mut_huge_pool.deallocate({}, {});
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_huge_pool.allocated({}).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate reuses memory"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_4k_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                constexpr auto size{2_umx};
+                auto const expected{(2_umx * HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    auto const alloc1{mut_huge_pool.allocate({}, size)};
+                    auto const alloc2{mut_huge_pool.allocate({}, size)};
+                    mut_huge_pool.deallocate({}, alloc1);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_huge_pool.allocated({}) == expected);
+                        bsl::ut_check(mut_huge_pool.remaining({}) == expected);
+                    };
+
+                    auto const alloc3{mut_huge_pool.allocate({}, size)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(alloc3.data() == alloc1.data());
+                        bsl::ut_check(mut_huge_pool.remaining({}).is_zero());
+                    };
+
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_huge_pool.deallocate({}, alloc2);
+                        mut_huge_pool.deallocate({}, alloc3);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate coalesces"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_4k_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                constexpr auto size{1_umx};
+                auto const expected{(1_umx * HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    auto const alloc1{mut_huge_pool.allocate({}, size)};
+                    auto const alloc2{mut_huge_pool.allocate({}, size)};
+                    auto const alloc3{mut_huge_pool.allocate({}, size)};
+                    auto const alloc4{mut_huge_pool.allocate({}, size)};
+                    mut_huge_pool.deallocate({}, alloc1);
+                    mut_huge_pool.deallocate({}, alloc3);
+                    mut_huge_pool.deallocate({}, alloc2);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_huge_pool.allocated({}) == expected);
+                    };
+
+                    auto const alloc5{mut_huge_pool.allocate({}, 3_umx)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(alloc5.data() == alloc1.data());
+                        bsl::ut_check(mut_huge_pool.remaining({}).is_zero());
+                    };
+
+                    mut_huge_pool.deallocate({}, alloc5);
+                    mut_huge_pool.deallocate({}, alloc4);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_huge_pool.allocated({}).is_zero());
+                        bsl::ut_check(mut_huge_pool.allocate({}, 4_umx).is_valid());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"size"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 huge_pool_t mut_huge_pool{};
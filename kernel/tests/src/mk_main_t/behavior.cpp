@@ -111,7 +111,7 @@ namespace mk
         mut_args.ext_elf_files.front() = &g_ext_elf_file;
         mut_args.rpt = &g_mut_rpt;
         mut_args.rpt_phys = HYPERVISOR_PAGE_SIZE.get();
-        mut_args.page_pool = bsl::span{&g_mut_page_pool, bsl::safe_umx::magic_1()};
+        mut_args.page_pool.front() = bsl::span{&g_mut_page_pool, bsl::safe_umx::magic_1()};
         mut_args.huge_pool = bsl::span{&g_mut_huge_pool, bsl::safe_umx::magic_1()};
 
         return mut_args;
@@ -0,0 +1,161 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../src/serial_ring_t.hpp"
+
+#include <bsl/char_type.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        constexpr auto ppid0{0x0_u16};
+        constexpr auto ppid1{0x1_u16};
+        constexpr bsl::char_type c{'x'};
+
+        bsl::ut_scenario{"write/drain empty"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                serial_ring_t mut_ring{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_ring.drain(ppid0));
+                    bsl::ut_check(mut_ring.drain(ppid1));
+                    bsl::ut_check(mut_ring.dropped(ppid0).is_zero());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"write/drain"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                serial_ring_t mut_ring{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_ring.write(ppid0, c);
+                    mut_ring.write(ppid0, "hello", 5U);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ring.drain(ppid1));
+                        bsl::ut_check(mut_ring.drain(ppid0));
+                    };
+                };
+            };
+
+            bsl::ut_given{} = [&]() noexcept {
+                serial_ring_t mut_ring{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_ring.write(ppid0, "hello\0world", 11U);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ring.drain(ppid0));
+                    };
+                };
+            };
+
+            bsl::ut_given{} = [&]() noexcept {
+                serial_ring_t mut_ring{};
+                constexpr auto num{(SERIAL_FIFO_SIZE + SERIAL_FIFO_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < num; ++mut_i) {
+                        mut_ring.write(ppid0, c);
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ring.drain(ppid0));
+                        bsl::ut_check(mut_ring.drain(ppid0));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"write wraps around the ring"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                serial_ring_t mut_ring{};
+                constexpr auto num{(HYPERVISOR_SERIAL_RING_SIZE - 0x1_umx).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < num; ++mut_i) {
+                        mut_ring.write(ppid0, c);
+                    }
+                    mut_ring.flush(ppid0);
+
+                    for (bsl::safe_idx mut_i{}; mut_i < HYPERVISOR_SERIAL_RING_SIZE; ++mut_i) {
+                        mut_ring.write(ppid0, c);
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ring.dropped(ppid0).is_zero());
+                        bsl::ut_check(!mut_ring.drain(ppid0));
+                        mut_ring.flush(ppid0);
+                        bsl::ut_check(mut_ring.drain(ppid0));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"full ring drops and reports"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                serial_ring_t mut_ring{};
+                constexpr auto extra{0x3_umx};
+                constexpr auto num{(HYPERVISOR_SERIAL_RING_SIZE + extra).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < num; ++mut_i) {
+                        mut_ring.write(ppid0, c);
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::to_umx(mut_ring.dropped(ppid0)) == extra);
+                        bsl::ut_check(mut_ring.dropped(ppid1).is_zero());
+                        mut_ring.flush(ppid0);
+                        bsl::ut_check(mut_ring.drain(ppid0));
+                        bsl::ut_check(bsl::to_umx(mut_ring.dropped(ppid0)) == extra);
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(mk::tests() == bsl::ut_success());
+    return mk::tests();
+}
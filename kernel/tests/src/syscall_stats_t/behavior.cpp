@@ -0,0 +1,145 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../src/syscall_stats_t.hpp"
+
+#include <bf_constants.hpp>
+
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        constexpr auto ppid0{0x0_u16};
+        constexpr auto ppid1{0x1_u16};
+        constexpr auto syscall0{(syscall::BF_DEBUG_OP_VAL | syscall::BF_DEBUG_OP_DUMP_VM_IDX_VAL)};
+        constexpr auto syscall1{(syscall::BF_VS_OP_VAL | syscall::BF_VS_OP_RUN_IDX_VAL)};
+        constexpr auto unknown{0x66420000FFFFFFFF_u64};
+
+        bsl::ut_scenario{"begin/end"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                syscall_stats_t mut_stats{};
+                constexpr auto loops{10_umx};
+                constexpr auto tsc0{0x10_u64};
+                constexpr auto tsc1{0x20_u64};
+                bsl::ut_then{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < loops; ++mut_i) {
+                        mut_stats.begin(ppid0, syscall0, {}, tsc0);
+                        mut_stats.end(ppid0, syscall::BF_STATUS_SUCCESS, tsc1);
+                    }
+
+                    for (bsl::safe_idx mut_i{}; mut_i < loops; ++mut_i) {
+                        mut_stats.begin(ppid1, syscall0, {}, tsc0);
+                        mut_stats.end(ppid1, syscall::BF_STATUS_FAILURE_UNKNOWN, tsc1);
+                    }
+                };
+            };
+
+            bsl::ut_given{} = [&]() noexcept {
+                syscall_stats_t mut_stats{};
+                constexpr auto tsc0{0x20_u64};
+                constexpr auto tsc1{0x10_u64};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_stats.begin(ppid0, syscall0, {}, tsc0);
+                    mut_stats.end(ppid0, syscall::BF_STATUS_SUCCESS, tsc1);
+                };
+            };
+
+            bsl::ut_given{} = [&]() noexcept {
+                syscall_stats_t mut_stats{};
+                constexpr auto tsc0{0x0_u64};
+                constexpr auto tsc1{0xFFFFFFFFFFFFFFFF_u64};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_stats.begin(ppid0, syscall0, {}, tsc0);
+                    mut_stats.end(ppid0, syscall::BF_STATUS_SUCCESS, tsc1);
+                };
+            };
+
+            bsl::ut_given{} = [&]() noexcept {
+                syscall_stats_t mut_stats{};
+                constexpr auto tsc0{0x10_u64};
+                constexpr auto tsc1{0x20_u64};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_stats.begin(ppid0, unknown, {}, tsc0);
+                    mut_stats.end(ppid0, syscall::BF_STATUS_FAILURE_UNSUPPORTED, tsc1);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"dump"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                syscall_stats_t mut_stats{};
+                constexpr auto tsc0{0x10_u64};
+                constexpr auto tsc1{0x20_u64};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_stats.dump(ppid0);
+                    mut_stats.dump(ppid1);
+
+                    mut_stats.begin(ppid0, syscall0, {}, tsc0);
+                    mut_stats.end(ppid0, syscall::BF_STATUS_SUCCESS, tsc1);
+                    mut_stats.begin(ppid0, syscall0, {}, tsc0);
+                    mut_stats.end(ppid0, syscall::BF_STATUS_FAILURE_UNKNOWN, tsc1);
+                    mut_stats.begin(ppid0, unknown, {}, tsc0);
+                    mut_stats.end(ppid0, syscall::BF_STATUS_FAILURE_UNSUPPORTED, tsc1);
+                    mut_stats.begin(ppid0, syscall1, {}, tsc0);
+
+                    mut_stats.dump(ppid0);
+                    mut_stats.dump(ppid1);
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(mk::tests() == bsl::ut_success());
+    return mk::tests();
+}
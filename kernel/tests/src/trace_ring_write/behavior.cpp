@@ -0,0 +1,111 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../src/trace_ring_write.hpp"
+
+#include <trace_record_t.hpp>
+#include <trace_ring_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+        constexpr bsl::uintmx idx0{};
+        // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+        constexpr bsl::uintmx idx1{1U};
+
+        bsl::ut_scenario{"trace_ring_write"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                loader::trace_ring_t mut_ring{};
+                constexpr auto ppid{1_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    trace_ring_write(mut_ring, loader::TRACE_PROBE_VMEXIT, ppid, 42_u64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(1_u64 == bsl::to_u64(mut_ring.epos));
+                        auto const *const rec{mut_ring.buf.at_if(idx0)};
+                        bsl::ut_check(42_u64 == bsl::to_u64(rec->tsc));
+                        bsl::ut_check(loader::TRACE_PROBE_VMEXIT == bsl::to_u16(rec->probe));
+                        bsl::ut_check(ppid == bsl::to_u16(rec->ppid));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"trace_ring_write wraps"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                loader::trace_ring_t mut_ring{};
+                constexpr auto ppid{1_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    trace_ring_write(mut_ring, loader::TRACE_PROBE_VMEXIT, ppid, 1_u64);
+                    trace_ring_write(mut_ring, loader::TRACE_PROBE_CALL_EXT, ppid, 2_u64);
+                    trace_ring_write(mut_ring, loader::TRACE_PROBE_SYSCALL, ppid, 3_u64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(3_u64 == bsl::to_u64(mut_ring.epos));
+                        auto const *const rec0{mut_ring.buf.at_if(idx0)};
+                        auto const *const rec1{mut_ring.buf.at_if(idx1)};
+                        bsl::ut_check(3_u64 == bsl::to_u64(rec0->tsc));
+                        bsl::ut_check(loader::TRACE_PROBE_SYSCALL == bsl::to_u16(rec0->probe));
+                        bsl::ut_check(2_u64 == bsl::to_u64(rec1->tsc));
+                        bsl::ut_check(loader::TRACE_PROBE_CALL_EXT == bsl::to_u16(rec1->probe));
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(mk::tests() == bsl::ut_success());
+    return mk::tests();
+}
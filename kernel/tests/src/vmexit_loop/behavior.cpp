@@ -24,6 +24,7 @@
 
 #include "../../../src/vmexit_loop.hpp"
 
+#include <ext_pool_t.hpp>
 #include <ext_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
@@ -32,6 +33,7 @@
 #include <vs_pool_t.hpp>
 
 #include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
 
 namespace mk
@@ -55,6 +57,7 @@ namespace mk
                 intrinsic_t mut_intrinsic{};
                 vs_pool_t mut_vs_pool{};
                 vmexit_log_t mut_log{};
+                ext_pool_t mut_ext_pool{};
                 ext_t mut_ext{};
                 bsl::ut_when{} = [&]() noexcept {
                     bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
@@ -64,7 +67,13 @@ namespace mk
                         mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
                     mut_tls.test_ret = bsl::errc_failure;
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(!vmexit_loop(mut_tls, mut_intrinsic, mut_vs_pool, mut_log));
+                        bsl::ut_check(!vmexit_loop(
+                            mut_tls,
+                            mut_page_pool,
+                            mut_intrinsic,
+                            mut_vs_pool,
+                            mut_ext_pool,
+                            mut_log));
                     };
                 };
             };
@@ -77,6 +86,7 @@ namespace mk
                 intrinsic_t mut_intrinsic{};
                 vs_pool_t mut_vs_pool{};
                 vmexit_log_t mut_log{};
+                ext_pool_t mut_ext_pool{};
                 ext_t mut_ext{};
                 bsl::ut_when{} = [&]() noexcept {
                     bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
@@ -86,7 +96,80 @@ namespace mk
                         mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
                     mut_tls.test_ret = {};
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(!vmexit_loop(mut_tls, mut_intrinsic, mut_vs_pool, mut_log));
+                        bsl::ut_check(!vmexit_loop(
+                            mut_tls,
+                            mut_page_pool,
+                            mut_intrinsic,
+                            mut_vs_pool,
+                            mut_ext_pool,
+                            mut_log));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"vmexit_loop with tick"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vs_pool_t mut_vs_pool{};
+                vmexit_log_t mut_log{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.ext_tick = &mut_ext;
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_tls.test_ret = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!vmexit_loop(
+                            mut_tls,
+                            mut_page_pool,
+                            mut_intrinsic,
+                            mut_vs_pool,
+                            mut_ext_pool,
+                            mut_log));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"dispatch_tick deadline not reached"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                intrinsic_t mut_intrinsic{};
+                ext_t mut_ext{};
+                constexpr auto deadline{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.ext_tick = &mut_ext;
+                    mut_tls.tick_deadline = deadline.get();
+                    mut_tls.test_ret = bsl::errc_failure;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(dispatch_tick(mut_tls, mut_intrinsic));
+                        bsl::ut_check(deadline == mut_tls.tick_deadline);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"dispatch_tick deadline reached"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                intrinsic_t mut_intrinsic{};
+                ext_t mut_ext{};
+                constexpr auto period{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_ext.set_tick_period(period);
+                    mut_tls.ext_tick = &mut_ext;
+                    mut_tls.test_ret = bsl::errc_failure;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!dispatch_tick(mut_tls, mut_intrinsic));
+                        bsl::ut_check(period == mut_tls.tick_deadline);
+                        bsl::ut_check(bsl::safe_u64::magic_0() == mut_tls.in_tick);
                     };
                 };
             };
@@ -425,6 +425,14 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"is_tick_exit"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!vs_pool_t::is_tick_exit({}));
+                };
+            };
+        };
+
         bsl::ut_scenario{"advance_ip"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 vs_pool_t mut_vs_pool{};
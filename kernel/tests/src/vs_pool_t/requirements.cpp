@@ -91,6 +91,7 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_vs_pool.read(mut_tls, mut_intrinsic, {}, {})));
                 static_assert(noexcept(mut_vs_pool.write(mut_tls, mut_intrinsic, {}, {}, {})));
                 static_assert(noexcept(mut_vs_pool.run(mut_tls, mut_intrinsic, mut_log)));
+                static_assert(noexcept(vs_pool_t::is_tick_exit({})));
                 static_assert(noexcept(mut_vs_pool.advance_ip(mut_tls, mut_intrinsic, {})));
                 static_assert(noexcept(mut_vs_pool.clear(mut_tls, mut_intrinsic, {})));
                 static_assert(noexcept(mut_vs_pool.tlb_flush(mut_tls, mut_intrinsic, {})));
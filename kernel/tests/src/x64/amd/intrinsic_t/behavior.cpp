@@ -25,6 +25,7 @@
 #include "../../../../../src/x64/amd/intrinsic_t.hpp"
 
 #include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
@@ -56,6 +57,24 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"max_asid"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t const intrinsic{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(0x7FFF_u16 == intrinsic.max_asid());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"is_page_1g_supported"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t const intrinsic{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(intrinsic.is_page_1g_supported());
+                };
+            };
+        };
+
         bsl::ut_scenario{"set_rpt"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 intrinsic_t mut_intrinsic{};
@@ -74,6 +93,35 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"rdtsc"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t const intrinsic{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(intrinsic.rdtsc());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"xsave"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t mut_intrinsic{};
+                bsl::uint64 mut_area{};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_intrinsic.xsave(&mut_area, {});
+                };
+            };
+        };
+
+        bsl::ut_scenario{"xrstor"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t mut_intrinsic{};
+                bsl::uint64 const area{};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_intrinsic.xrstor(&area, {});
+                };
+            };
+        };
+
         bsl::ut_scenario{"tls_reg"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 intrinsic_t const intrinsic{};
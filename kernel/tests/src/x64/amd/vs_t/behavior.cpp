@@ -170,6 +170,28 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"allocate xsave area fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto max_pages{2_umx};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    mut_page_pool.set_max(max_pages);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {})
+                                .is_invalid());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"deallocate"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 vs_t mut_vs{};
@@ -287,6 +309,60 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"set_active restores xsave"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                constexpr auto vsid{1_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize(vsid);
+                    mut_tls.active_vsid = syscall::BF_INVALID_ID.get();
+                    mut_tls.xsave_vsid = syscall::BF_INVALID_ID.get();
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_vs.set_active(mut_tls, mut_intrinsic);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(vsid == mut_tls.xsave_vsid);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.set_inactive(mut_tls, mut_intrinsic);
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"state_save_to_vs takes ownership of xsave"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                loader::state_save_t mut_state{};
+                constexpr auto vsid{1_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize(vsid);
+                    mut_tls.active_vsid = syscall::BF_INVALID_ID.get();
+                    mut_tls.xsave_vsid = syscall::BF_INVALID_ID.get();
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_vs.state_save_to_vs(mut_tls, mut_intrinsic, &mut_state);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(vsid == mut_tls.xsave_vsid);
+                        mut_vs.set_active(mut_tls, mut_intrinsic);
+                        bsl::ut_check(vsid == mut_tls.xsave_vsid);
+                        mut_vs.set_inactive(mut_tls, mut_intrinsic);
+                        mut_vs.vs_to_state_save(mut_tls, mut_intrinsic, &mut_state);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"active status functions"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 vs_t mut_vs{};
@@ -664,6 +740,39 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"run with tlb tags"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vmexit_log_t mut_log{};
+                constexpr auto reg{syscall::bf_reg_t::bf_reg_t_guest_asid};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.write(mut_tls, mut_intrinsic, reg, 1_u64));
+                        bsl::ut_check(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(1_u64 == mut_vs.read(mut_tls, mut_intrinsic, reg));
+                        bsl::ut_check(mut_intrinsic.max_asid() == mut_tls.tag_max);
+                        bsl::ut_check(1_u64 == mut_tls.tag_flushes);
+                        mut_vs.tlb_flush(mut_tls, mut_intrinsic);
+                        mut_vs.tlb_flush(mut_tls, mut_intrinsic, HYPERVISOR_PAGE_SIZE);
+                        bsl::ut_check(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(2_u64 == mut_vs.read(mut_tls, mut_intrinsic, reg));
+                        bsl::ut_check(1_u64 == mut_tls.tag_flushes);
+                        bsl::ut_check(1_u64 == mut_tls.tag_flushes_avoided);
+                        mut_vs.tlb_flush(mut_tls, mut_intrinsic, HYPERVISOR_PAGE_SIZE);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"advance_ip"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 vs_t mut_vs{};
@@ -89,6 +89,7 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_vs.read(mut_tls, mut_intrinsic, {})));
                 static_assert(noexcept(mut_vs.write(mut_tls, mut_intrinsic, {}, {})));
                 static_assert(noexcept(mut_vs.run(mut_tls, mut_intrinsic, mut_log)));
+                static_assert(noexcept(vs_t::is_tick_exit({})));
                 static_assert(noexcept(mut_vs.advance_ip(mut_tls, mut_intrinsic)));
                 static_assert(noexcept(mut_vs.clear(mut_tls, mut_intrinsic)));
                 static_assert(noexcept(mut_vs.tlb_flush(mut_tls, mut_intrinsic)));
@@ -22,7 +22,7 @@
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 /// SOFTWARE.
 
-#include "../../../../../src/x64/amd/dispatch_esr_nmi.hpp"
+#include "../../../../../src/x64/intel/dispatch_esr_nmi.hpp"
 
 #include <intrinsic_t.hpp>
 #include <tls_t.hpp>
@@ -52,11 +52,13 @@ namespace mk
                     mut_tls.nmi_lock = bsl::safe_umx::magic_0().get();
                     bsl::ut_then{} = [&]() noexcept {
                         dispatch_esr_nmi(mut_tls, mut_intrinsic);
+                        bsl::ut_check(bsl::safe_umx::magic_0() == mut_tls.nmi_pending);
                     };
 
                     mut_tls.nmi_lock = bsl::safe_umx::magic_1().get();
                     bsl::ut_then{} = [&]() noexcept {
                         dispatch_esr_nmi(mut_tls, mut_intrinsic);
+                        bsl::ut_check(bsl::safe_umx::magic_1() == mut_tls.nmi_pending);
                     };
                 };
             };
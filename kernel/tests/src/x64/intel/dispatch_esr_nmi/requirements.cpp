@@ -22,7 +22,7 @@
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 /// SOFTWARE.
 
-#include "../../../../../src/x64/amd/dispatch_esr_nmi.hpp"
+#include "../../../../../src/x64/intel/dispatch_esr_nmi.hpp"
 
 #include <intrinsic_t.hpp>
 #include <tls_t.hpp>
@@ -27,6 +27,7 @@
 #include <vmcs_t.hpp>
 
 #include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
@@ -61,6 +62,24 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"tlb_flush_all_vpids"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t const intrinsic{};
+                bsl::ut_then{} = [&]() noexcept {
+                    intrinsic.tlb_flush_all_vpids();
+                };
+            };
+        };
+
+        bsl::ut_scenario{"is_page_1g_supported"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t const intrinsic{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(intrinsic.is_page_1g_supported());
+                };
+            };
+        };
+
         bsl::ut_scenario{"es_selector"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 intrinsic_t const intrinsic{};
@@ -169,6 +188,35 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"rdtsc"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t const intrinsic{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(intrinsic.rdtsc());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"xsave"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t mut_intrinsic{};
+                bsl::uint64 mut_area{};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_intrinsic.xsave(&mut_area, {});
+                };
+            };
+        };
+
+        bsl::ut_scenario{"xrstor"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t mut_intrinsic{};
+                bsl::uint64 const area{};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_intrinsic.xrstor(&area, {});
+                };
+            };
+        };
+
         bsl::ut_scenario{"tls_reg"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 intrinsic_t const intrinsic{};
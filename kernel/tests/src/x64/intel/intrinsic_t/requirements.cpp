@@ -56,6 +56,8 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mk::intrinsic_t{}));
 
                 static_assert(noexcept(mut_intrinsic.tlb_flush({}, {})));
+                static_assert(noexcept(mut_intrinsic.tlb_flush_all_vpids()));
+                static_assert(noexcept(mut_intrinsic.is_page_1g_supported()));
                 static_assert(noexcept(mut_intrinsic.es_selector()));
                 static_assert(noexcept(mut_intrinsic.cs_selector()));
                 static_assert(noexcept(mut_intrinsic.ss_selector()));
@@ -68,6 +70,9 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_intrinsic.cr4()));
                 static_assert(noexcept(mut_intrinsic.set_rpt({})));
                 static_assert(noexcept(mut_intrinsic.set_tp({})));
+                static_assert(noexcept(mut_intrinsic.rdtsc()));
+                static_assert(noexcept(mut_intrinsic.xsave({}, {})));
+                static_assert(noexcept(mut_intrinsic.xrstor({}, {})));
                 static_assert(noexcept(mut_intrinsic.tls_reg({})));
                 static_assert(noexcept(mut_intrinsic.set_tls_reg({}, {})));
                 static_assert(noexcept(mut_intrinsic.rdmsr({})));
@@ -96,6 +101,7 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(intrinsic.cr0()));
                 static_assert(noexcept(intrinsic.cr3()));
                 static_assert(noexcept(intrinsic.cr4()));
+                static_assert(noexcept(intrinsic.rdtsc()));
                 static_assert(noexcept(intrinsic.tls_reg({})));
                 static_assert(noexcept(intrinsic.rdmsr({})));
             };
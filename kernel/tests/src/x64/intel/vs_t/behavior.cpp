@@ -26,6 +26,7 @@
 
 #include <bf_constants.hpp>
 #include <bf_reg_t.hpp>
+#include <ext_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
 #include <state_save_t.hpp>
@@ -158,6 +159,29 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"allocate xsave area fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                loader::state_save_t mut_state{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    mut_tls.mk_state = &mut_state;
+                    mut_page_pool.set_max(bsl::safe_umx::magic_1());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {})
+                                .is_invalid());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"deallocate"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 vs_t mut_vs{};
@@ -282,6 +306,63 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"set_active restores xsave"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                loader::state_save_t mut_state{};
+                constexpr auto vsid{1_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize(vsid);
+                    mut_tls.mk_state = &mut_state;
+                    mut_tls.active_vsid = syscall::BF_INVALID_ID.get();
+                    mut_tls.xsave_vsid = syscall::BF_INVALID_ID.get();
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_vs.set_active(mut_tls, mut_intrinsic);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(vsid == mut_tls.xsave_vsid);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.set_inactive(mut_tls, mut_intrinsic);
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"state_save_to_vs takes ownership of xsave"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                loader::state_save_t mut_state{};
+                constexpr auto vsid{1_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize(vsid);
+                    mut_tls.mk_state = &mut_state;
+                    mut_tls.active_vsid = syscall::BF_INVALID_ID.get();
+                    mut_tls.xsave_vsid = syscall::BF_INVALID_ID.get();
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_vs.state_save_to_vs(mut_tls, mut_intrinsic, &mut_state);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(vsid == mut_tls.xsave_vsid);
+                        mut_vs.set_active(mut_tls, mut_intrinsic);
+                        bsl::ut_check(vsid == mut_tls.xsave_vsid);
+                        mut_vs.set_inactive(mut_tls, mut_intrinsic);
+                        mut_vs.vs_to_state_save(mut_tls, mut_intrinsic, &mut_state);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"active status functions"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 vs_t mut_vs{};
@@ -806,6 +887,182 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"run with tlb tags"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs0{};
+                vs_t mut_vs1{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                loader::state_save_t mut_state{};
+                vmexit_log_t mut_log{};
+                constexpr auto vsid0{0x0_u16};
+                constexpr auto vsid1{0x1_u16};
+                constexpr auto reg{syscall::bf_reg_t::bf_reg_t_virtual_processor_identifier};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs0.initialize(vsid0);
+                    mut_vs1.initialize(vsid1);
+                    mut_tls.mk_state = &mut_state;
+                    bsl::ut_required_step(
+                        mut_vs0.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(
+                        mut_vs1.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs0.write(mut_tls, mut_intrinsic, reg, 1_u64));
+                        bsl::ut_check(mut_vs0.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(1_u64 == mut_vs0.read(mut_tls, mut_intrinsic, reg));
+                        bsl::ut_check(mut_vs1.write(mut_tls, mut_intrinsic, reg, 1_u64));
+                        bsl::ut_check(mut_vs1.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(2_u64 == mut_vs1.read(mut_tls, mut_intrinsic, reg));
+                        bsl::ut_check(mut_vs0.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(1_u64 == mut_vs0.read(mut_tls, mut_intrinsic, reg));
+                        bsl::ut_check(1_u64 == mut_tls.tag_flushes);
+                        bsl::ut_check(1_u64 == mut_tls.tag_flushes_avoided);
+                        mut_vs0.tlb_flush(mut_tls, mut_intrinsic, HYPERVISOR_PAGE_SIZE);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs0.release(mut_tls, mut_page_pool);
+                        mut_vs1.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"recycled vs gets a fresh tlb tag"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                loader::state_save_t mut_state{};
+                vmexit_log_t mut_log{};
+                constexpr auto reg{syscall::bf_reg_t::bf_reg_t_virtual_processor_identifier};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    mut_tls.mk_state = &mut_state;
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(mut_vs.write(mut_tls, mut_intrinsic, reg, 1_u64));
+                    bsl::ut_required_step(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
+                    mut_vs.deallocate(mut_tls, mut_page_pool);
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.write(mut_tls, mut_intrinsic, reg, 1_u64));
+                        bsl::ut_check(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(2_u64 == mut_vs.read(mut_tls, mut_intrinsic, reg));
+                        bsl::ut_check(1_u64 == mut_tls.tag_flushes);
+                        bsl::ut_check(1_u64 == mut_tls.tag_flushes_avoided);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"run with tick"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                loader::state_save_t mut_state{};
+                vmexit_log_t mut_log{};
+                ext_t mut_ext{};
+                constexpr auto pin_ctls_allowed1{0x0000004000000000_u64};
+                constexpr auto pin_ctls_timer{0x40_u32};
+                constexpr auto deadline{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    mut_tls.mk_state = &mut_state;
+                    bsl::ut_required_step(
+                        mut_intrinsic.wrmsr(MSR_VMX_TRUE_PIN_CTLS, pin_ctls_allowed1));
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_tls.ext_tick = &mut_ext;
+                    mut_tls.tick_deadline = deadline.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
+                        auto const pin_ctls{
+                            mut_intrinsic.vmrd32(VMCS_PIN_BASED_VM_EXECUTION_CTLS)};
+                        bsl::ut_check((pin_ctls & pin_ctls_timer).is_pos());
+                        bsl::ut_check(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"run with tick deadline passed"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                loader::state_save_t mut_state{};
+                vmexit_log_t mut_log{};
+                ext_t mut_ext{};
+                constexpr auto pin_ctls_allowed1{0x0000004000000000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    mut_tls.mk_state = &mut_state;
+                    bsl::ut_required_step(
+                        mut_intrinsic.wrmsr(MSR_VMX_TRUE_PIN_CTLS, pin_ctls_allowed1));
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_tls.ext_tick = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"run with tick unsupported"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                loader::state_save_t mut_state{};
+                vmexit_log_t mut_log{};
+                ext_t mut_ext{};
+                constexpr auto pin_ctls_timer{0x40_u32};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    mut_tls.mk_state = &mut_state;
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_tls.ext_tick = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
+                        auto const pin_ctls{
+                            mut_intrinsic.vmrd32(VMCS_PIN_BASED_VM_EXECUTION_CTLS)};
+                        bsl::ut_check((pin_ctls & pin_ctls_timer).is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"is_tick_exit"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto exit_reason_cpuid{0xA_umx};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(vs_t::is_tick_exit(EXIT_REASON_PREEMPTION_TIMER));
+                    bsl::ut_check(!vs_t::is_tick_exit(exit_reason_cpuid));
+                };
+            };
+        };
+
         bsl::ut_scenario{"advance_ip"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 vs_t mut_vs{};
@@ -0,0 +1,122 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../../src/x64/posted_events.hpp"
+
+#include <bf_constants.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        constexpr auto event0{0x1_u64};
+        constexpr auto event1{0x4_u64};
+
+        bsl::ut_scenario{"drain empty"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(drain_posted_events(mut_tls).is_zero());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"post and drain"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    post_event(mut_tls, event0);
+                    post_event(mut_tls, event1);
+                    post_event(mut_tls, event0);
+                    mut_tls.nmi_pending = bsl::safe_u64::magic_1().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check((event0 | event1) == drain_posted_events(mut_tls));
+                        bsl::ut_check(bsl::safe_u64::magic_0() == mut_tls.nmi_pending);
+                        bsl::ut_check(drain_posted_events(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"post after drain"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    post_event(mut_tls, event0);
+                    bsl::ut_check(event0 == drain_posted_events(mut_tls));
+                    post_event(mut_tls, event1);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(event1 == drain_posted_events(mut_tls));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"discard"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    post_event(mut_tls, syscall::BF_POSTED_EVENT_NMI);
+                    discard_posted_events(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(drain_posted_events(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(mk::tests() == bsl::ut_success());
+    return mk::tests();
+}
@@ -0,0 +1,59 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BASIC_BITMAP_PAGE_POOL_LEAF_T_HPP
+#define BASIC_BITMAP_PAGE_POOL_LEAF_T_HPP
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace lib
+{
+    /// @brief defines the number of bits in each word of a leaf
+    constexpr auto BASIC_BITMAP_PAGE_POOL_WORD_BITS{64_umx};
+    /// @brief defines the number of words in each leaf
+    constexpr auto BASIC_BITMAP_PAGE_POOL_LEAF_WORDS{512_umx};
+    /// @brief defines the number of pages tracked by each leaf
+    constexpr auto BASIC_BITMAP_PAGE_POOL_LEAF_PAGES{
+        (BASIC_BITMAP_PAGE_POOL_LEAF_WORDS * BASIC_BITMAP_PAGE_POOL_WORD_BITS).checked()};
+
+    /// <!-- description -->
+    ///   @brief Defines one leaf of the basic_bitmap_page_pool_t's bitmap.
+    ///     Each bit tracks one page of physical memory, and is set if that
+    ///     page is free. Leaves are carved out of the pages that are given
+    ///     to the pool, so a leaf is always the size of a page.
+    ///
+    struct basic_bitmap_page_pool_leaf_t final
+    {
+        /// @brief stores the bits of the leaf
+        bsl::array<bsl::uint64, BASIC_BITMAP_PAGE_POOL_LEAF_WORDS.get()> words;
+    };
+
+    /// @brief make sure that a leaf is the size of a page.
+    static_assert(sizeof(basic_bitmap_page_pool_leaf_t) == HYPERVISOR_PAGE_SIZE);
+}
+
+#endif
@@ -0,0 +1,96 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BASIC_EPT_ENTRY_T_HPP
+#define BASIC_EPT_ENTRY_T_HPP
+
+#include <bsl/cstdint.hpp>
+
+#pragma pack(push, 1)
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Defines the layout of an Intel EPT entry. All four levels
+    ///     share the same layout, but each level is its own type so that
+    ///     the basic_root_page_table_t can tell them apart. The memory
+    ///     type, ignore PAT and dirty fields are only used by entries
+    ///     that point to a block, and the page size field is only used
+    ///     by level 1 and level 2 entries.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam LEVEL the level of the page table this entry is part of
+    ///
+    template<bsl::uintmx LEVEL>
+    struct basic_ept_entry_t final
+    {
+        /// @brief defines the "read access" field in the page
+        bsl::uint64 r : static_cast<bsl::uint64>(1);
+        /// @brief defines the "write access" field in the page
+        bsl::uint64 w : static_cast<bsl::uint64>(1);
+        /// @brief defines the "execute access" field in the page
+        bsl::uint64 x : static_cast<bsl::uint64>(1);
+        /// @brief defines the "memory type" field in the page
+        bsl::uint64 mt : static_cast<bsl::uint64>(3);
+        /// @brief defines the "ignore PAT" field in the page
+        bsl::uint64 ipat : static_cast<bsl::uint64>(1);
+        /// @brief defines the "page size" field in the page
+        bsl::uint64 ps : static_cast<bsl::uint64>(1);
+        /// @brief defines the "accessed" field in the page
+        bsl::uint64 a : static_cast<bsl::uint64>(1);
+        /// @brief defines the "dirty" field in the page
+        bsl::uint64 d : static_cast<bsl::uint64>(1);
+        /// @brief defines the "user-mode execute access" field in the page
+        bsl::uint64 xu : static_cast<bsl::uint64>(1);
+        /// @brief defines the "ignored" field in the page
+        bsl::uint64 ignored1 : static_cast<bsl::uint64>(1);
+        /// @brief defines the "physical address" field in the page
+        bsl::uint64 phys : static_cast<bsl::uint64>(40);
+        /// @brief defines our "auto_release" field in the page
+        bsl::uint64 auto_release : static_cast<bsl::uint64>(1);
+        /// @brief defines the "points_to_block" field in the page
+        bsl::uint64 points_to_block : static_cast<bsl::uint64>(1);
+        /// @brief defines our "aliased" field in the page
+        bsl::uint64 alias : static_cast<bsl::uint64>(1);
+        /// @brief defines our "explicit_unmap" field in the page
+        bsl::uint64 explicit_unmap : static_cast<bsl::uint64>(1);
+        /// @brief defines the "ignored" field in the page
+        bsl::uint64 ignored2 : static_cast<bsl::uint64>(7);
+        /// @brief defines the "suppress #VE" field in the page
+        bsl::uint64 sve : static_cast<bsl::uint64>(1);
+    };
+
+    /// @brief defines the layout of an EPT PML4 entry
+    using ept_l3e_t = basic_ept_entry_t<static_cast<bsl::uintmx>(3)>;
+    /// @brief defines the layout of an EPT PDPT entry
+    using ept_l2e_t = basic_ept_entry_t<static_cast<bsl::uintmx>(2)>;
+    /// @brief defines the layout of an EPT PD entry
+    using ept_l1e_t = basic_ept_entry_t<static_cast<bsl::uintmx>(1)>;
+    /// @brief defines the layout of an EPT PT entry
+    using ept_l0e_t = basic_ept_entry_t<static_cast<bsl::uintmx>(0)>;
+}
+
+#pragma pack(pop)
+
+#endif
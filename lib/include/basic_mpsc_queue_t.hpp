@@ -0,0 +1,387 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BASIC_MPSC_QUEUE_T_HPP
+#define BASIC_MPSC_QUEUE_T_HPP
+
+#include <basic_cache_line_size.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+#pragma clang diagnostic ignored "-Watomic-implicit-seq-cst"
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Provides a bounded, lock-free, multiple producer, single
+    ///     consumer queue using a static array. Any number of PPs may push
+    ///     to the queue at the same time while a single PP pops from it
+    ///     without the need for a lock. Like basic_queue_t, this queue has
+    ///     a fixed size, and once it is full, attempting to push to the
+    ///     queue will fail.
+    ///
+    /// <!-- notes -->
+    ///   @note Each slot has a sequence number that tells a producer when
+    ///     the slot is free and tells the consumer when the slot is full.
+    ///     Producers claim slots by moving the head with a compare and
+    ///     exchange, fill them in, and then publish each slot using its
+    ///     sequence number, so a slow producer only delays the consumer
+    ///     and never the other producers.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of element being encapsulated.
+    ///   @tparam N the total number of elements in the array. Must be a
+    ///     power of 2.
+    ///
+    template<typename T, bsl::uintmx N>
+    class basic_mpsc_queue_t final
+    {
+        /// @brief stores the mask used to convert an index into a slot
+        static constexpr auto mask{(bsl::to_umx(N) - bsl::safe_umx::magic_1()).checked()};
+
+        static_assert(bsl::to_umx(N).is_pos());
+        static_assert((bsl::to_umx(N) & mask).is_zero());
+
+        /// <!-- description -->
+        ///   @brief Defines a single slot in the queue. A slot whose
+        ///     sequence number is equal to its index is free, and a slot
+        ///     whose sequence number is equal to its index + 1 is full.
+        ///
+        struct cell_t final
+        {
+            /// @brief stores the sequence number of the slot
+            _Atomic bsl::uintmx seq;
+            /// @brief stores the element in the slot
+            T data;
+        };
+
+        /// @brief stores the total number of slots claimed by producers
+        alignas(BASIC_CACHE_LINE_SIZE.get()) _Atomic bsl::uintmx m_head;
+        /// @brief stores the total number of elements popped (consumer)
+        alignas(BASIC_CACHE_LINE_SIZE.get()) bsl::safe_umx m_tail;
+        /// @brief stores a circular buffer for the queue.
+        alignas(BASIC_CACHE_LINE_SIZE.get()) bsl::array<cell_t, N> m_cells;
+
+        /// <!-- description -->
+        ///   @brief Returns the sequence number of the slot that the
+        ///     provided index maps to.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index to get the sequence number for
+        ///   @return Returns the sequence number of the slot that the
+        ///     provided index maps to.
+        ///
+        [[nodiscard]] constexpr auto
+        seq(bsl::safe_umx const &idx) noexcept -> bsl::safe_umx
+        {
+            auto *const pmut_cell{m_cells.at_if(bsl::to_idx(idx & mask))};
+            return bsl::to_umx(__c11_atomic_load(&pmut_cell->seq, __ATOMIC_ACQUIRE));
+        }
+
+        /// <!-- description -->
+        ///   @brief Claims up to "wanted" free slots for a producer. The
+        ///     slots claimed are always contiguous, starting at mut_pos.
+        ///     Since the consumer frees slots in order, if the last slot
+        ///     in a range is free, every slot before it is free as well.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param wanted the number of slots the producer would like
+        ///   @param mut_pos returns the index of the first claimed slot
+        ///   @return Returns the number of slots that were claimed, which
+        ///     is 0 if the queue is full.
+        ///
+        [[nodiscard]] constexpr auto
+        claim(bsl::safe_umx const &wanted, bsl::safe_umx &mut_pos) noexcept -> bsl::safe_umx
+        {
+            mut_pos = bsl::to_umx(__c11_atomic_load(&m_head, __ATOMIC_RELAXED));
+            if (bsl::unlikely(wanted.is_zero())) {
+                return {};
+            }
+
+            while (true) {
+                auto mut_num{wanted};
+                while (mut_num.is_pos()) {
+                    auto const last{((mut_pos + mut_num) - bsl::safe_umx::magic_1()).checked()};
+                    if (this->seq(last) == last) {
+                        break;
+                    }
+
+                    --mut_num;
+                }
+
+                if (mut_num.is_zero()) {
+                    if (this->seq(mut_pos) < mut_pos) {
+                        return {};
+                    }
+
+                    mut_pos = bsl::to_umx(__c11_atomic_load(&m_head, __ATOMIC_RELAXED));
+                    continue;
+                }
+
+                bsl::uintmx mut_expected{mut_pos.get()};
+                auto const next{(mut_pos + mut_num).checked()};
+
+                if (__c11_atomic_compare_exchange_weak(
+                        &m_head, &mut_expected, next.get(), __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                    return mut_num;
+                }
+
+                mut_pos = bsl::to_umx(mut_expected);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Fills in a claimed slot and publishes it to the
+        ///     consumer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the claimed slot
+        ///   @param val the value to store in the slot
+        ///
+        constexpr void
+        publish(bsl::safe_umx const &idx, T const &val) noexcept
+        {
+            auto *const pmut_cell{m_cells.at_if(bsl::to_idx(idx & mask))};
+            auto const full{(idx + bsl::safe_umx::magic_1()).checked()};
+
+            pmut_cell->data = val;
+            __c11_atomic_store(&pmut_cell->seq, full.get(), __ATOMIC_RELEASE);
+        }
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+        /// @brief alias for: safe_umx
+        using size_type = bsl::safe_umx;
+        /// @brief alias for: safe_idx
+        using index_type = bsl::safe_idx;
+        /// @brief alias for: safe_umx
+        using difference_type = bsl::safe_umx;
+        /// @brief alias for: T &
+        using reference_type = T &;
+        /// @brief alias for: T const &
+        using const_reference_type = T const &;
+        /// @brief alias for: T *
+        using pointer_type = T *;
+        /// @brief alias for: T const *
+        using const_pointer_type = T const *;
+
+        /// <!-- description -->
+        ///   @brief Creates an empty basic_mpsc_queue_t
+        ///
+        // We cannot member initialize atomics so this is not possible
+        // NOLINTNEXTLINE(bsl-class-member-init)
+        constexpr basic_mpsc_queue_t() noexcept    // --
+            : m_tail{}, m_cells{}
+        {
+            // This is the only way to initialize this
+            // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+            m_head = bsl::safe_umx::magic_0().get();
+
+            for (bsl::safe_idx mut_i{}; mut_i < m_cells.size(); ++mut_i) {
+                // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+                m_cells.at_if(mut_i)->seq = mut_i.get();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Pushes an element to the queue and returns
+        ///     bsl::errc_success. If the queue is full, returns
+        ///     bsl::errc_failure. May be called by any PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to push to the queue
+        ///   @param sloc the source location of the push for debugging
+        ///   @return Returns bsl::errc_success on success, or
+        ///     bsl::errc_failure if the queue is full.
+        ///
+        [[nodiscard]] constexpr auto
+        push(T const &val, bsl::source_location const &sloc = bsl::here()) noexcept
+            -> bsl::errc_type
+        {
+            bsl::safe_umx mut_pos{};
+
+            if (bsl::unlikely(this->claim(bsl::safe_umx::magic_1(), mut_pos).is_zero())) {
+                bsl::error() << "queue is full\n" << sloc;
+                return bsl::errc_failure;
+            }
+
+            this->publish(mut_pos, val);
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Pushes as many of the provided elements to the queue
+        ///     as will fit. All of the slots are claimed at once, so the
+        ///     elements are never interleaved with the elements of other
+        ///     producers. May be called by any PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vals the values to push to the queue
+        ///   @return Returns the number of elements that were pushed,
+        ///     which is 0 if the queue is full.
+        ///
+        [[nodiscard]] constexpr auto
+        push_n(bsl::span<T const> const &vals) noexcept -> bsl::safe_umx
+        {
+            auto mut_wanted{vals.size()};
+            if (mut_wanted > N) {
+                mut_wanted = N;
+            }
+            else {
+                bsl::touch();
+            }
+
+            bsl::safe_umx mut_pos{};
+            auto const num{this->claim(mut_wanted, mut_pos)};
+
+            for (bsl::safe_idx mut_i{}; mut_i < num; ++mut_i) {
+                this->publish((mut_pos + bsl::to_umx(mut_i)).checked(), *vals.at_if(mut_i));
+            }
+
+            return num;
+        }
+
+        /// <!-- description -->
+        ///   @brief Pops an element from the queue and returns
+        ///     bsl::errc_success. If the queue is empty, returns
+        ///     bsl::errc_failure. Must only be called by the consumer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_val the value to pop from the queue
+        ///   @param sloc the source location of the pop for debugging
+        ///   @return Returns bsl::errc_success on success, or
+        ///     bsl::errc_failure if the queue is empty.
+        ///
+        [[nodiscard]] constexpr auto
+        pop(T &mut_val, bsl::source_location const &sloc = bsl::here()) noexcept -> bsl::errc_type
+        {
+            auto *const pmut_cell{m_cells.at_if(bsl::to_idx(m_tail & mask))};
+            auto const next{(m_tail + bsl::safe_umx::magic_1()).checked()};
+
+            if (bsl::unlikely(this->seq(m_tail) != next)) {
+                bsl::error() << "queue is empty\n" << sloc;
+                return bsl::errc_failure;
+            }
+
+            mut_val = pmut_cell->data;
+
+            auto const free{(m_tail + N).checked()};
+            __c11_atomic_store(&pmut_cell->seq, free.get(), __ATOMIC_RELEASE);
+
+            m_tail = next;
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Pops as many elements from the queue as are available
+        ///     and will fit in the provided buffer. Must only be called by
+        ///     the consumer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_vals the buffer to pop the elements into
+        ///   @return Returns the number of elements that were popped,
+        ///     which is 0 if the queue is empty.
+        ///
+        [[nodiscard]] constexpr auto
+        pop_n(bsl::span<T> &mut_vals) noexcept -> bsl::safe_umx
+        {
+            bsl::safe_idx mut_i{};
+            for (; mut_i < mut_vals.size(); ++mut_i) {
+                auto *const pmut_cell{m_cells.at_if(bsl::to_idx(m_tail & mask))};
+                auto const next{(m_tail + bsl::safe_umx::magic_1()).checked()};
+
+                if (this->seq(m_tail) != next) {
+                    break;
+                }
+
+                *mut_vals.at_if(mut_i) = pmut_cell->data;
+
+                auto const free{(m_tail + N).checked()};
+                __c11_atomic_store(&pmut_cell->seq, free.get(), __ATOMIC_RELEASE);
+
+                m_tail = next;
+            }
+
+            return bsl::to_umx(mut_i);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the queue is empty. Must only be
+        ///     called by the consumer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the queue is empty
+        ///
+        [[nodiscard]] constexpr auto
+        empty() const noexcept -> bool
+        {
+            auto const *const cell{m_cells.at_if(bsl::to_idx(m_tail & mask))};
+            bsl::safe_umx const seq{static_cast<bsl::uintmx>(cell->seq)};
+
+            return seq != (m_tail + bsl::safe_umx::magic_1()).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the queue is full. Note that the queue
+        ///     might not be full by the time this function returns.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the queue is full
+        ///
+        [[nodiscard]] constexpr auto
+        full() const noexcept -> bool
+        {
+            bsl::safe_umx const head{static_cast<bsl::uintmx>(m_head)};
+
+            auto const *const cell{m_cells.at_if(bsl::to_idx(head & mask))};
+            bsl::safe_umx const seq{static_cast<bsl::uintmx>(cell->seq)};
+
+            return seq < head;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max number of elements the queue can hold
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max number of elements the queue can hold
+        ///
+        [[nodiscard]] static constexpr auto
+        size() noexcept -> size_type
+        {
+            return size_type{N};
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,94 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BASIC_NPT_ENTRY_T_HPP
+#define BASIC_NPT_ENTRY_T_HPP
+
+#include <bsl/cstdint.hpp>
+
+#pragma pack(push, 1)
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Defines the layout of an AMD nested page table (NPT)
+    ///     entry. NPT entries use the same layout as the host's own
+    ///     page tables, except that every access is treated as a user
+    ///     access, so the user/supervisor field must always be set. All
+    ///     four levels share the same layout, but each level is its own
+    ///     type so that the basic_root_page_table_t can tell them apart.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam LEVEL the level of the page table this entry is part of
+    ///
+    template<bsl::uintmx LEVEL>
+    struct basic_npt_entry_t final
+    {
+        /// @brief defines the "present" field in the page
+        bsl::uint64 p : static_cast<bsl::uint64>(1);
+        /// @brief defines the "read/write" field in the page
+        bsl::uint64 rw : static_cast<bsl::uint64>(1);
+        /// @brief defines the "user/supervisor" field in the page
+        bsl::uint64 us : static_cast<bsl::uint64>(1);
+        /// @brief defines the "page-level writethrough" field in the page
+        bsl::uint64 pwt : static_cast<bsl::uint64>(1);
+        /// @brief defines the "page-level cache disable" field in the page
+        bsl::uint64 pcd : static_cast<bsl::uint64>(1);
+        /// @brief defines the "accessed" field in the page
+        bsl::uint64 a : static_cast<bsl::uint64>(1);
+        /// @brief defines the "dirty" field in the page
+        bsl::uint64 d : static_cast<bsl::uint64>(1);
+        /// @brief defines the "page size" field in the page
+        bsl::uint64 ps : static_cast<bsl::uint64>(1);
+        /// @brief defines the "global" field in the page
+        bsl::uint64 g : static_cast<bsl::uint64>(1);
+        /// @brief defines our "auto_release" field in the page
+        bsl::uint64 auto_release : static_cast<bsl::uint64>(1);
+        /// @brief defines the "points_to_block" field in the page
+        bsl::uint64 points_to_block : static_cast<bsl::uint64>(1);
+        /// @brief defines our "aliased" field in the page
+        bsl::uint64 alias : static_cast<bsl::uint64>(1);
+        /// @brief defines the "physical address" field in the page
+        bsl::uint64 phys : static_cast<bsl::uint64>(40);
+        /// @brief defines our "explicit_unmap" field in the page
+        bsl::uint64 explicit_unmap : static_cast<bsl::uint64>(1);
+        /// @brief defines the "available to software" field in the page
+        bsl::uint64 available1 : static_cast<bsl::uint64>(10);
+        /// @brief defines the "no-execute" field in the page
+        bsl::uint64 nx : static_cast<bsl::uint64>(1);
+    };
+
+    /// @brief defines the layout of an NPT PML4 entry
+    using npt_l3e_t = basic_npt_entry_t<static_cast<bsl::uintmx>(3)>;
+    /// @brief defines the layout of an NPT PDPT entry
+    using npt_l2e_t = basic_npt_entry_t<static_cast<bsl::uintmx>(2)>;
+    /// @brief defines the layout of an NPT PD entry
+    using npt_l1e_t = basic_npt_entry_t<static_cast<bsl::uintmx>(1)>;
+    /// @brief defines the layout of an NPT PT entry
+    using npt_l0e_t = basic_npt_entry_t<static_cast<bsl::uintmx>(0)>;
+}
+
+#pragma pack(pop)
+
+#endif
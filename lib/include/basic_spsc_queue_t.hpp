@@ -0,0 +1,343 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BASIC_SPSC_QUEUE_T_HPP
+#define BASIC_SPSC_QUEUE_T_HPP
+
+#include <basic_cache_line_size.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+#pragma clang diagnostic ignored "-Watomic-implicit-seq-cst"
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Provides a lock-free, single producer, single consumer
+    ///     queue using a static array. One PP may push to the queue while
+    ///     another PP pops from it without the need for a lock. Like
+    ///     basic_queue_t, this queue has a fixed size, and once it is
+    ///     full, attempting to push to the queue will fail.
+    ///
+    /// <!-- notes -->
+    ///   @note The head is only written by the producer and the tail is
+    ///     only written by the consumer. Each is placed on its own cache
+    ///     line, together with the producer/consumer's cached copy of the
+    ///     other index, so that the two PPs only share a cache line when
+    ///     the cached copy is out of date.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of element being encapsulated.
+    ///   @tparam N the total number of elements in the array. Must be a
+    ///     power of 2.
+    ///
+    template<typename T, bsl::uintmx N>
+    class basic_spsc_queue_t final
+    {
+        /// @brief stores the mask used to convert an index into a slot
+        static constexpr auto mask{(bsl::to_umx(N) - bsl::safe_umx::magic_1()).checked()};
+
+        static_assert(bsl::to_umx(N).is_pos());
+        static_assert((bsl::to_umx(N) & mask).is_zero());
+
+        /// @brief stores the total number of elements pushed (producer)
+        alignas(BASIC_CACHE_LINE_SIZE.get()) _Atomic bsl::uintmx m_head;
+        /// @brief stores the producer's cached copy of m_tail
+        bsl::safe_umx m_tail_cache;
+
+        /// @brief stores the total number of elements popped (consumer)
+        alignas(BASIC_CACHE_LINE_SIZE.get()) _Atomic bsl::uintmx m_tail;
+        /// @brief stores the consumer's cached copy of m_head
+        bsl::safe_umx m_head_cache;
+
+        /// @brief stores a circular buffer for the queue.
+        alignas(BASIC_CACHE_LINE_SIZE.get()) bsl::array<T, N> m_queue;
+
+        /// <!-- description -->
+        ///   @brief Returns the number of free slots the producer can
+        ///     push to, refreshing its cached copy of the tail if the
+        ///     cached copy says that there are fewer than wanted.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param head the current value of the head
+        ///   @param wanted the number of slots the producer would like
+        ///   @return Returns the number of free slots the producer can
+        ///     push to.
+        ///
+        [[nodiscard]] constexpr auto
+        free_slots(bsl::safe_umx const &head, bsl::safe_umx const &wanted) noexcept
+            -> bsl::safe_umx
+        {
+            auto mut_free{(bsl::to_umx(N) - (head - m_tail_cache)).checked()};
+            if (mut_free < wanted) {
+                m_tail_cache = bsl::to_umx(__c11_atomic_load(&m_tail, __ATOMIC_ACQUIRE));
+                mut_free = (bsl::to_umx(N) - (head - m_tail_cache)).checked();
+            }
+            else {
+                bsl::touch();
+            }
+
+            return mut_free;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of used slots the consumer can
+        ///     pop from, refreshing its cached copy of the head if the
+        ///     cached copy says that there are fewer than wanted.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tail the current value of the tail
+        ///   @param wanted the number of slots the consumer would like
+        ///   @return Returns the number of used slots the consumer can
+        ///     pop from.
+        ///
+        [[nodiscard]] constexpr auto
+        used_slots(bsl::safe_umx const &tail, bsl::safe_umx const &wanted) noexcept
+            -> bsl::safe_umx
+        {
+            auto mut_used{(m_head_cache - tail).checked()};
+            if (mut_used < wanted) {
+                m_head_cache = bsl::to_umx(__c11_atomic_load(&m_head, __ATOMIC_ACQUIRE));
+                mut_used = (m_head_cache - tail).checked();
+            }
+            else {
+                bsl::touch();
+            }
+
+            return mut_used;
+        }
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+        /// @brief alias for: safe_umx
+        using size_type = bsl::safe_umx;
+        /// @brief alias for: safe_idx
+        using index_type = bsl::safe_idx;
+        /// @brief alias for: safe_umx
+        using difference_type = bsl::safe_umx;
+        /// @brief alias for: T &
+        using reference_type = T &;
+        /// @brief alias for: T const &
+        using const_reference_type = T const &;
+        /// @brief alias for: T *
+        using pointer_type = T *;
+        /// @brief alias for: T const *
+        using const_pointer_type = T const *;
+
+        /// <!-- description -->
+        ///   @brief Creates an empty basic_spsc_queue_t
+        ///
+        // We cannot member initialize atomics so this is not possible
+        // NOLINTNEXTLINE(bsl-class-member-init)
+        constexpr basic_spsc_queue_t() noexcept    // --
+            : m_tail_cache{}, m_head_cache{}, m_queue{}
+        {
+            // This is the only way to initialize this
+            // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+            m_head = bsl::safe_umx::magic_0().get();
+            // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+            m_tail = bsl::safe_umx::magic_0().get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Pushes an element to the queue and returns
+        ///     bsl::errc_success. If the queue is full, returns
+        ///     bsl::errc_failure. Must only be called by the producer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to push to the queue
+        ///   @param sloc the source location of the push for debugging
+        ///   @return Returns bsl::errc_success on success, or
+        ///     bsl::errc_failure if the queue is full.
+        ///
+        [[nodiscard]] constexpr auto
+        push(T const &val, bsl::source_location const &sloc = bsl::here()) noexcept
+            -> bsl::errc_type
+        {
+            bsl::safe_umx const head{__c11_atomic_load(&m_head, __ATOMIC_RELAXED)};
+
+            if (bsl::unlikely(this->free_slots(head, bsl::safe_umx::magic_1()).is_zero())) {
+                bsl::error() << "queue is full\n" << sloc;
+                return bsl::errc_failure;
+            }
+
+            *m_queue.at_if(bsl::to_idx(head & mask)) = val;
+            auto const next{(head + bsl::safe_umx::magic_1()).checked()};
+            __c11_atomic_store(&m_head, next.get(), __ATOMIC_RELEASE);
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Pushes as many of the provided elements to the queue
+        ///     as will fit, publishing all of them to the consumer at once.
+        ///     Must only be called by the producer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vals the values to push to the queue
+        ///   @return Returns the number of elements that were pushed,
+        ///     which is 0 if the queue is full.
+        ///
+        [[nodiscard]] constexpr auto
+        push_n(bsl::span<T const> const &vals) noexcept -> bsl::safe_umx
+        {
+            bsl::safe_umx const head{__c11_atomic_load(&m_head, __ATOMIC_RELAXED)};
+
+            auto mut_num{this->free_slots(head, vals.size())};
+            if (mut_num > vals.size()) {
+                mut_num = vals.size();
+            }
+            else {
+                bsl::touch();
+            }
+
+            for (bsl::safe_idx mut_i{}; mut_i < mut_num; ++mut_i) {
+                auto const slot{bsl::to_idx((head + bsl::to_umx(mut_i)).checked() & mask)};
+                *m_queue.at_if(slot) = *vals.at_if(mut_i);
+            }
+
+            __c11_atomic_store(&m_head, (head + mut_num).checked().get(), __ATOMIC_RELEASE);
+            return mut_num;
+        }
+
+        /// <!-- description -->
+        ///   @brief Pops an element from the queue and returns
+        ///     bsl::errc_success. If the queue is empty, returns
+        ///     bsl::errc_failure. Must only be called by the consumer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_val the value to pop from the queue
+        ///   @param sloc the source location of the pop for debugging
+        ///   @return Returns bsl::errc_success on success, or
+        ///     bsl::errc_failure if the queue is empty.
+        ///
+        [[nodiscard]] constexpr auto
+        pop(T &mut_val, bsl::source_location const &sloc = bsl::here()) noexcept -> bsl::errc_type
+        {
+            bsl::safe_umx const tail{__c11_atomic_load(&m_tail, __ATOMIC_RELAXED)};
+
+            if (bsl::unlikely(this->used_slots(tail, bsl::safe_umx::magic_1()).is_zero())) {
+                bsl::error() << "queue is empty\n" << sloc;
+                return bsl::errc_failure;
+            }
+
+            mut_val = *m_queue.at_if(bsl::to_idx(tail & mask));
+            auto const next{(tail + bsl::safe_umx::magic_1()).checked()};
+            __c11_atomic_store(&m_tail, next.get(), __ATOMIC_RELEASE);
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Pops as many elements from the queue as are available
+        ///     and will fit in the provided buffer, releasing all of their
+        ///     slots back to the producer at once. Must only be called by
+        ///     the consumer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_vals the buffer to pop the elements into
+        ///   @return Returns the number of elements that were popped,
+        ///     which is 0 if the queue is empty.
+        ///
+        [[nodiscard]] constexpr auto
+        pop_n(bsl::span<T> &mut_vals) noexcept -> bsl::safe_umx
+        {
+            bsl::safe_umx const tail{__c11_atomic_load(&m_tail, __ATOMIC_RELAXED)};
+
+            auto mut_num{this->used_slots(tail, mut_vals.size())};
+            if (mut_num > mut_vals.size()) {
+                mut_num = mut_vals.size();
+            }
+            else {
+                bsl::touch();
+            }
+
+            for (bsl::safe_idx mut_i{}; mut_i < mut_num; ++mut_i) {
+                auto const slot{bsl::to_idx((tail + bsl::to_umx(mut_i)).checked() & mask)};
+                *mut_vals.at_if(mut_i) = *m_queue.at_if(slot);
+            }
+
+            __c11_atomic_store(&m_tail, (tail + mut_num).checked().get(), __ATOMIC_RELEASE);
+            return mut_num;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the queue is empty. Note that when
+        ///     called by the producer, the queue might not be empty by
+        ///     the time this function returns.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the queue is empty
+        ///
+        [[nodiscard]] constexpr auto
+        empty() const noexcept -> bool
+        {
+            bsl::safe_umx const tail{static_cast<bsl::uintmx>(m_tail)};
+            bsl::safe_umx const head{static_cast<bsl::uintmx>(m_head)};
+
+            return head == tail;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the queue is full. Note that when
+        ///     called by the consumer, the queue might not be full by
+        ///     the time this function returns.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the queue is full
+        ///
+        [[nodiscard]] constexpr auto
+        full() const noexcept -> bool
+        {
+            bsl::safe_umx const tail{static_cast<bsl::uintmx>(m_tail)};
+            bsl::safe_umx const head{static_cast<bsl::uintmx>(m_head)};
+
+            return (head - tail).checked() == N;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max number of elements the queue can hold
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max number of elements the queue can hold
+        ///
+        [[nodiscard]] static constexpr auto
+        size() noexcept -> size_type
+        {
+            return size_type{N};
+        }
+    };
+}
+
+#endif
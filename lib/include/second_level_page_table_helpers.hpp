@@ -0,0 +1,489 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef SECOND_LEVEL_PAGE_TABLE_HELPERS_HPP
+#define SECOND_LEVEL_PAGE_TABLE_HELPERS_HPP
+
+#include <basic_entry_status_t.hpp>
+#include <basic_ept_entry_t.hpp>
+#include <basic_map_page_flags.hpp>
+#include <basic_npt_entry_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/is_same.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+
+/// NOTE:
+/// - These are the helpers the basic_root_page_table_t uses when it is
+///   given EPT or NPT entries instead of the host's own entries. They are
+///   overloads (and not a replacement) of the generic helpers that the
+///   kernel and the unit tests provide, so both can be included at the
+///   same time. Overload resolution always prefers the more specialized
+///   overloads below for EPT and NPT entries.
+///
+/// - A block that is mapped without any access rights is still "present"
+///   as far as the basic_root_page_table_t is concerned (so that it can be
+///   given its access rights back later), even though the hardware treats
+///   it as not present. This is what the points_to_block field is used
+///   for, as no valid table entry ever has it set.
+///
+
+namespace helpers
+{
+    /// @brief defines the write-back memory type used by EPT
+    constexpr auto EPT_MEMORY_TYPE_WB{0x0000000000000006_u64};
+    /// @brief defines the EPTP's "page-walk length" field for 4 levels
+    constexpr auto EPTP_PAGE_WALK_LENGTH_4{0x0000000000000018_u64};
+    /// @brief defines the EPTP's "enable accessed and dirty flags" field
+    constexpr auto EPTP_ENABLE_ACCESSED_DIRTY{0x0000000000000040_u64};
+
+    /// <!-- description -->
+    ///   @brief Returns basic_entry_status_t::present if the entry is valid.
+    ///     Returns basic_entry_status_t::not_present if the entry is invalid.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam L the level of the entry to query
+    ///   @param entry the entry to query
+    ///   @return Returns basic_entry_status_t::present if the entry is valid.
+    ///     Returns basic_entry_status_t::not_present if the entry is invalid.
+    ///
+    template<bsl::uintmx L>
+    [[nodiscard]] constexpr auto
+    entry_status(lib::basic_ept_entry_t<L> const *const entry) noexcept
+        -> lib::basic_entry_status_t
+    {
+        bsl::expects(nullptr != entry);
+
+        if (bsl::safe_u64::magic_1() == entry->points_to_block) {
+            return lib::basic_entry_status_t::present;
+        }
+
+        if (bsl::safe_u64::magic_1() == entry->r) {
+            return lib::basic_entry_status_t::present;
+        }
+
+        if (bsl::safe_u64::magic_1() == entry->w) {
+            return lib::basic_entry_status_t::present;
+        }
+
+        if (bsl::safe_u64::magic_1() == entry->x) {
+            return lib::basic_entry_status_t::present;
+        }
+
+        return lib::basic_entry_status_t::not_present;
+    }
+
+    /// <!-- description -->
+    ///   @brief Same as entry_status() above. This overload is needed so
+    ///     that a non-const entry does not pick the generic helper.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam L the level of the entry to query
+    ///   @param pudm_entry the entry to query
+    ///   @return Returns basic_entry_status_t::present if the entry is valid.
+    ///     Returns basic_entry_status_t::not_present if the entry is invalid.
+    ///
+    template<bsl::uintmx L>
+    [[nodiscard]] constexpr auto
+    entry_status(lib::basic_ept_entry_t<L> *const pudm_entry) noexcept -> lib::basic_entry_status_t
+    {
+        lib::basic_ept_entry_t<L> const *const entry{pudm_entry};
+        return entry_status(entry);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns basic_entry_status_t::present if the entry is valid.
+    ///     Returns basic_entry_status_t::not_present if the entry is invalid.
+    ///     Returns basic_entry_status_t::reserved if the entry cannot be
+    ///     touched.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam L the level of the entry to query
+    ///   @param entry the entry to query
+    ///   @return Returns basic_entry_status_t::present if the entry is valid.
+    ///     Returns basic_entry_status_t::not_present if the entry is invalid.
+    ///     Returns basic_entry_status_t::reserved if the entry cannot be
+    ///     touched.
+    ///
+    template<bsl::uintmx L>
+    [[nodiscard]] constexpr auto
+    entry_status(lib::basic_npt_entry_t<L> const *const entry) noexcept
+        -> lib::basic_entry_status_t
+    {
+        bsl::expects(nullptr != entry);
+
+        if (bsl::safe_u64::magic_0() == entry->p) {
+            if (bsl::safe_u64::magic_0() == entry->points_to_block) {
+                return lib::basic_entry_status_t::not_present;
+            }
+
+            bsl::touch();
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (bsl::safe_u64::magic_0() == entry->us) {
+            return lib::basic_entry_status_t::reserved;
+        }
+
+        return lib::basic_entry_status_t::present;
+    }
+
+    /// <!-- description -->
+    ///   @brief Same as entry_status() above. This overload is needed so
+    ///     that a non-const entry does not pick the generic helper.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam L the level of the entry to query
+    ///   @param pudm_entry the entry to query
+    ///   @return Returns basic_entry_status_t::present if the entry is valid.
+    ///     Returns basic_entry_status_t::not_present if the entry is invalid.
+    ///     Returns basic_entry_status_t::reserved if the entry cannot be
+    ///     touched.
+    ///
+    template<bsl::uintmx L>
+    [[nodiscard]] constexpr auto
+    entry_status(lib::basic_npt_entry_t<L> *const pudm_entry) noexcept -> lib::basic_entry_status_t
+    {
+        lib::basic_npt_entry_t<L> const *const entry{pudm_entry};
+        return entry_status(entry);
+    }
+
+    /// <!-- description -->
+    ///   @brief Configures an entry as a pointer to a block. Write access
+    ///     without read access is not something EPT supports, so write
+    ///     access always implies read access. Execute-only access is only
+    ///     supported by some CPUs (and is a misconfiguration on the rest),
+    ///     so execute access implies read access as well. All blocks are
+    ///     mapped as write-back.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam L the level of the entry to configure
+    ///   @param pmut_entry the entry to configure
+    ///   @param page_flgs defines how memory should be mapped
+    ///
+    template<bsl::uintmx L>
+    constexpr void
+    configure_entry_as_ptr_to_block(
+        lib::basic_ept_entry_t<L> *const pmut_entry, bsl::safe_u64 const &page_flgs) noexcept
+    {
+        bsl::expects(nullptr != pmut_entry);
+        bsl::expects(page_flgs.is_valid_and_checked());
+
+        constexpr auto rwe{
+            lib::BASIC_MAP_PAGE_READ | lib::BASIC_MAP_PAGE_WRITE | lib::BASIC_MAP_PAGE_EXECUTE};
+
+        if ((page_flgs & rwe).is_zero()) {
+            pmut_entry->r = bsl::safe_u64::magic_0().get();
+        }
+        else {
+            pmut_entry->r = bsl::safe_u64::magic_1().get();
+        }
+
+        if ((page_flgs & lib::BASIC_MAP_PAGE_WRITE).is_zero()) {
+            pmut_entry->w = bsl::safe_u64::magic_0().get();
+        }
+        else {
+            pmut_entry->w = bsl::safe_u64::magic_1().get();
+        }
+
+        if ((page_flgs & lib::BASIC_MAP_PAGE_EXECUTE).is_zero()) {
+            pmut_entry->x = bsl::safe_u64::magic_0().get();
+        }
+        else {
+            pmut_entry->x = bsl::safe_u64::magic_1().get();
+        }
+
+        pmut_entry->mt = EPT_MEMORY_TYPE_WB.get();
+
+        /// NOTE:
+        /// - Only a level 0 entry is always a block. A level 1 or level 2
+        ///   entry that points to a block is a 2M or 1G page, which
+        ///   requires the PS bit.
+        ///
+
+        if constexpr (bsl::safe_umx::magic_0() != L) {
+            pmut_entry->ps = bsl::safe_u64::magic_1().get();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Configures an entry as a pointer to a block. NPT cannot
+    ///     map a page that is readable but not executable without also
+    ///     using the NX bit, and it cannot map a page that is writable
+    ///     but not readable, so any access right makes the page readable.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam L the level of the entry to configure
+    ///   @param pmut_entry the entry to configure
+    ///   @param page_flgs defines how memory should be mapped
+    ///
+    template<bsl::uintmx L>
+    constexpr void
+    configure_entry_as_ptr_to_block(
+        lib::basic_npt_entry_t<L> *const pmut_entry, bsl::safe_u64 const &page_flgs) noexcept
+    {
+        bsl::expects(nullptr != pmut_entry);
+        bsl::expects(page_flgs.is_valid_and_checked());
+
+        if (page_flgs.is_zero()) {
+            pmut_entry->p = bsl::safe_u64::magic_0().get();
+        }
+        else {
+            pmut_entry->p = bsl::safe_u64::magic_1().get();
+        }
+
+        pmut_entry->us = bsl::safe_u64::magic_1().get();
+
+        if ((page_flgs & lib::BASIC_MAP_PAGE_WRITE).is_zero()) {
+            pmut_entry->rw = bsl::safe_u64::magic_0().get();
+        }
+        else {
+            pmut_entry->rw = bsl::safe_u64::magic_1().get();
+        }
+
+        if ((page_flgs & lib::BASIC_MAP_PAGE_EXECUTE).is_zero()) {
+            pmut_entry->nx = bsl::safe_u64::magic_1().get();
+        }
+        else {
+            pmut_entry->nx = bsl::safe_u64::magic_0().get();
+        }
+
+        if constexpr (bsl::safe_umx::magic_0() != L) {
+            pmut_entry->ps = bsl::safe_u64::magic_1().get();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the flags that were given to
+    ///     configure_entry_as_ptr_to_block() for the provided entry.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam L the level of the entry to query
+    ///   @param entry the entry to query
+    ///   @return Returns the flags that were given to
+    ///     configure_entry_as_ptr_to_block() for the provided entry.
+    ///
+    template<bsl::uintmx L>
+    [[nodiscard]] constexpr auto
+    entry_to_page_flgs(lib::basic_ept_entry_t<L> const *const entry) noexcept -> bsl::safe_u64
+    {
+        bsl::expects(nullptr != entry);
+
+        bsl::safe_u64 mut_flgs{};
+
+        if (bsl::safe_u64::magic_1() == entry->r) {
+            mut_flgs |= lib::BASIC_MAP_PAGE_READ;
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (bsl::safe_u64::magic_1() == entry->w) {
+            mut_flgs |= lib::BASIC_MAP_PAGE_WRITE;
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (bsl::safe_u64::magic_1() == entry->x) {
+            mut_flgs |= lib::BASIC_MAP_PAGE_EXECUTE;
+        }
+        else {
+            bsl::touch();
+        }
+
+        return mut_flgs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the flags that were given to
+    ///     configure_entry_as_ptr_to_block() for the provided entry.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam L the level of the entry to query
+    ///   @param entry the entry to query
+    ///   @return Returns the flags that were given to
+    ///     configure_entry_as_ptr_to_block() for the provided entry.
+    ///
+    template<bsl::uintmx L>
+    [[nodiscard]] constexpr auto
+    entry_to_page_flgs(lib::basic_npt_entry_t<L> const *const entry) noexcept -> bsl::safe_u64
+    {
+        bsl::expects(nullptr != entry);
+
+        if (bsl::safe_u64::magic_0() == entry->p) {
+            return {};
+        }
+
+        bsl::safe_u64 mut_flgs{lib::BASIC_MAP_PAGE_READ};
+
+        if (bsl::safe_u64::magic_1() == entry->rw) {
+            mut_flgs |= lib::BASIC_MAP_PAGE_WRITE;
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (bsl::safe_u64::magic_0() == entry->nx) {
+            mut_flgs |= lib::BASIC_MAP_PAGE_EXECUTE;
+        }
+        else {
+            bsl::touch();
+        }
+
+        return mut_flgs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the hardware set the dirty flag of the
+    ///     provided block. Both EPT and NPT entries store this in d.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam E the type of entry to query
+    ///   @param entry the entry to query
+    ///   @return Returns true if the dirty flag of the block is set.
+    ///
+    template<typename E>
+    [[nodiscard]] constexpr auto
+    entry_to_dirty(E const *const entry) noexcept -> bool
+    {
+        bsl::expects(nullptr != entry);
+        return bsl::safe_u64::magic_1() == entry->d;
+    }
+
+    /// <!-- description -->
+    ///   @brief Sets or clears the dirty flag of the provided block. This
+    ///     is used when a block is replaced by a block of a different
+    ///     size, so that a write the hardware already logged is kept.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam E the type of entry to configure
+    ///   @param pmut_entry the entry to configure
+    ///   @param dirty the value to give the dirty flag
+    ///
+    template<typename E>
+    constexpr void
+    configure_entry_dirty(E *const pmut_entry, bool const dirty) noexcept
+    {
+        bsl::expects(nullptr != pmut_entry);
+
+        if (dirty) {
+            pmut_entry->d = bsl::safe_u64::magic_1().get();
+        }
+        else {
+            pmut_entry->d = bsl::safe_u64::magic_0().get();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Configures an entry as a pointer to a table. Tables always
+    ///     grant every access right, leaving the blocks to restrict them.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam L the level of the entry to configure
+    ///   @param pmut_entry the entry to configure
+    ///
+    template<bsl::uintmx L>
+    constexpr void
+    configure_entry_as_ptr_to_table(lib::basic_ept_entry_t<L> *const pmut_entry) noexcept
+    {
+        bsl::expects(nullptr != pmut_entry);
+
+        pmut_entry->r = bsl::safe_u64::magic_1().get();
+        pmut_entry->w = bsl::safe_u64::magic_1().get();
+        pmut_entry->x = bsl::safe_u64::magic_1().get();
+        pmut_entry->mt = bsl::safe_u64::magic_0().get();
+        pmut_entry->ps = bsl::safe_u64::magic_0().get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Configures an entry as a pointer to a table. Tables always
+    ///     grant every access right, leaving the blocks to restrict them.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam L the level of the entry to configure
+    ///   @param pmut_entry the entry to configure
+    ///
+    template<bsl::uintmx L>
+    constexpr void
+    configure_entry_as_ptr_to_table(lib::basic_npt_entry_t<L> *const pmut_entry) noexcept
+    {
+        bsl::expects(nullptr != pmut_entry);
+
+        pmut_entry->p = bsl::safe_u64::magic_1().get();
+        pmut_entry->rw = bsl::safe_u64::magic_1().get();
+        pmut_entry->us = bsl::safe_u64::magic_1().get();
+        pmut_entry->ps = bsl::safe_u64::magic_0().get();
+        pmut_entry->nx = bsl::safe_u64::magic_0().get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the value the hardware needs to locate a second
+    ///     level page table, given the system physical address of its
+    ///     level 3 table. For EPT this is the EPTP, which also encodes
+    ///     the memory type used to access the tables, the number of
+    ///     levels and whether or not the accessed and dirty flags are
+    ///     maintained by the hardware. For NPT this is the nCR3, which is
+    ///     the address itself, as AMD always maintains these flags.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam L3E_TYPE the type of level 3 entry the table uses
+    ///   @param spa the system physical address of the level 3 table
+    ///   @param accessed_dirty if true, the EPTP enables the accessed and
+    ///     dirty flags (which page-modification logging depends on)
+    ///   @return Returns the EPTP or nCR3 for the provided table
+    ///
+    template<typename L3E_TYPE>
+    [[nodiscard]] constexpr auto
+    second_level_root_pointer(bsl::safe_umx const &spa, bool const accessed_dirty) noexcept
+        -> bsl::safe_u64
+    {
+        bsl::expects(spa.is_valid_and_checked());
+
+        if constexpr (bsl::is_same<L3E_TYPE, lib::ept_l3e_t>::value) {
+            auto mut_eptp{bsl::to_u64(spa) | EPT_MEMORY_TYPE_WB | EPTP_PAGE_WALK_LENGTH_4};
+            if (accessed_dirty) {
+                mut_eptp |= EPTP_ENABLE_ACCESSED_DIRTY;
+            }
+            else {
+                bsl::touch();
+            }
+
+            return mut_eptp.checked();
+        }
+        else {
+            static_assert(bsl::is_same<L3E_TYPE, lib::npt_l3e_t>::value);
+            bsl::discard(accessed_dirty);
+
+            return bsl::to_u64(spa);
+        }
+    }
+}
+
+#endif
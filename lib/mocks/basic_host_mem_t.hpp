@@ -0,0 +1,59 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MOCKS_BASIC_HOST_MEM_T_HPP
+#define MOCKS_BASIC_HOST_MEM_T_HPP
+
+#include <bsl/safe_integral.hpp>
+
+namespace lib
+{
+    /// @brief defines the amount of host memory the mock reports (4 GB)
+    constexpr auto MOCK_HOST_MEM_SIZE{0x100000000_umx};
+
+    /// <!-- description -->
+    ///   @brief Provides information about the host's physical memory.
+    ///
+    class basic_host_mem_t final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Returns the total number of bytes of physical memory
+        ///     installed in the host. On failure, returns
+        ///     bsl::safe_umx::failure().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of bytes of physical memory
+        ///     installed in the host. On failure, returns
+        ///     bsl::safe_umx::failure().
+        ///
+        [[nodiscard]] static constexpr auto
+        total() noexcept -> bsl::safe_umx
+        {
+            return MOCK_HOST_MEM_SIZE;
+        }
+    };
+}
+
+#endif
@@ -42,6 +42,7 @@
 #include <bsl/dontcare_t.hpp>
 #include <bsl/expects.hpp>
 #include <bsl/is_pod.hpp>
+#include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/span.hpp>
 #include <bsl/touch.hpp>
@@ -120,11 +121,27 @@ namespace lib
         ///
         /// <!-- inputs/outputs -->
         ///   @param pool the mutable_buffer_t of the basic_page_pool_t
+        ///   @param node the NUMA node the provided pages belong to
         ///
         static constexpr void
-        initialize(bsl::span<basic_page_pool_node_t> const &pool) noexcept
+        initialize(
+            bsl::span<basic_page_pool_node_t> const &pool, bsl::safe_idx const &node = {}) noexcept
         {
             bsl::discard(pool);
+            bsl::discard(node);
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives the basic_page_pool_t a list of pages that it can
+        ///     grow into once every NUMA node's list is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param reserve the list of pages to grow into
+        ///
+        static constexpr void
+        initialize_reserve(bsl::span<basic_page_pool_node_t> const &reserve) noexcept
+        {
+            bsl::discard(reserve);
         }
 
         /// <!-- description -->
@@ -261,6 +278,24 @@ namespace lib
             m_phys_to_virt.at(phys) = {};
         }
 
+        /// <!-- description -->
+        ///   @brief Returns a batch of pages previously allocated using the
+        ///     allocate function to the basic_page_pool_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to deallocate
+        ///   @param tls the current TLS block
+        ///   @param virts the pointers to the pages to deallocate
+        ///
+        template<typename T>
+        constexpr void
+        deallocate_batch(TLS_TYPE const &tls, bsl::span<T *const> const &virts) noexcept
+        {
+            for (bsl::safe_idx mut_i{}; mut_i < virts.size(); ++mut_i) {
+                this->deallocate(tls, *virts.at_if(mut_i));
+            }
+        }
+
         /// <!-- description -->
         ///   @brief Returns the number of bytes in the pool.
         ///
@@ -306,6 +306,60 @@ namespace lib
             m_initialized = {};
         }
 
+        /// <!-- description -->
+        ///   @brief Releases all of the tables and memory mapped into the RPT
+        ///     while keeping the RPT itself initialized.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///
+        constexpr void
+        clear(TLS_TYPE const &tls, PAGE_POOL_TYPE &mut_page_pool) noexcept
+        {
+            bsl::expects(m_initialized);
+            bsl::discard(tls);
+
+            for (bsl::safe_idx mut_i; mut_i < m_allocations_idx; ++mut_i) {
+                auto *const pmut_store{m_allocations.at_if(mut_i)};
+
+                helpers::clr_page_pool_storage(mut_page_pool, *pmut_store);
+                *pmut_store = {};
+            }
+
+            m_allocations_idx = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Incrementally performs the same work as clear(). To
+        ///     allow unit tests to see more than one call, each call only
+        ///     releases a single allocation.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @return Returns true if there is nothing left to reclaim.
+        ///     Returns false if reclaim() needs to be called again.
+        ///
+        [[nodiscard]] constexpr auto
+        reclaim(TLS_TYPE const &tls, PAGE_POOL_TYPE &mut_page_pool) noexcept -> bool
+        {
+            bsl::expects(m_initialized);
+            bsl::discard(tls);
+
+            if (bsl::to_umx(m_allocations_idx).is_zero()) {
+                return true;
+            }
+
+            --m_allocations_idx;
+
+            auto *const pmut_store{m_allocations.at_if(m_allocations_idx)};
+            helpers::clr_page_pool_storage(mut_page_pool, *pmut_store);
+            *pmut_store = {};
+
+            return bsl::to_umx(m_allocations_idx).is_zero();
+        }
+
         /// <!-- description -->
         ///   @brief Returns true if this RPT is initialized.
         ///
@@ -360,6 +414,59 @@ namespace lib
             return HYPERVISOR_PAGE_SIZE;
         }
 
+        /// <!-- description -->
+        ///   @brief Tells map() whether it is allowed to promote tables.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param enable if true, map() is allowed to promote tables
+        ///
+        static constexpr void
+        set_promote(bool const enable) noexcept
+        {
+            bsl::discard(enable);
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells map() whether it is allowed to replace a table of
+        ///     2M blocks with a 1G block.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param enable if true, map() is allowed to create 1G blocks
+        ///
+        static constexpr void
+        set_promote_1g(bool const enable) noexcept
+        {
+            bsl::discard(enable);
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the RPT to hold on to the tables that are removed
+        ///     until flushed() is called.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param enable if true, removed tables are held until flushed()
+        ///
+        static constexpr void
+        set_hold_retired(bool const enable) noexcept
+        {
+            bsl::discard(enable);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the tables held because of set_hold_retired()
+        ///     to the page pool.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///
+        static constexpr void
+        flushed(TLS_TYPE const &tls, PAGE_POOL_TYPE const &page_pool) noexcept
+        {
+            bsl::discard(tls);
+            bsl::discard(page_pool);
+        }
+
         /// <!-- description -->
         ///   @brief Maps a 1g page into the root page table
         ///
@@ -529,6 +636,7 @@ namespace lib
         ///   @param tls the current TLS block
         ///   @param page_pool the page_pool_t to use
         ///   @param page_virt the virtual address to unmap
+        ///   @param sys the bf_syscall_t to use (optional)
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     and friends otherwise
         ///
@@ -537,15 +645,72 @@ namespace lib
         unmap(
             TLS_TYPE const &tls,
             PAGE_POOL_TYPE const &page_pool,
-            bsl::safe_u64 const &page_virt) noexcept -> bsl::errc_type
+            bsl::safe_u64 const &page_virt,
+            SYS_TYPE const &sys = bsl::dontcare) noexcept -> bsl::errc_type
         {
             static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE, L0E_TYPE>::value);
 
             bsl::discard(tls);
             bsl::discard(page_pool);
+            bsl::discard(sys);
+
+            bsl::expects(m_initialized);
+            bsl::expects(page_virt.is_valid_and_checked());
+
+            if constexpr (bsl::is_same<E, L2E_TYPE>::value) {
+                bsl::expects(is_page_1g_aligned(page_virt));
+            }
+
+            if constexpr (bsl::is_same<E, L1E_TYPE>::value) {
+                bsl::expects(is_page_2m_aligned(page_virt));
+            }
+
+            if constexpr (bsl::is_same<E, L0E_TYPE>::value) {
+                bsl::expects(is_page_4k_aligned(page_virt));
+            }
+
+            if (tls.test_virt == page_virt) {
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Changes the flags of a page that is already mapped into
+        ///     the root page table. It is the caller's responsibility to
+        ///     flush the TLB as needed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the entry type to use. Valid inputs are L2E_TYPE, L1E_TYPE
+        ///     and L0E_TYPE. If L2E_TYPE is provided, a 1G range is changed. If
+        ///     L1E_TYPE is provided, a 2M range is changed. If L0E_TYPE is
+        ///     provided, a 4K range is changed. Defaults to L0E_TYPE (i.e. 4k).
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address of the page to change
+        ///   @param page_flgs the new flags to give the page
+        ///   @param sys the bf_syscall_t to use (optional)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        template<typename E = L0E_TYPE>
+        [[nodiscard]] constexpr auto
+        set_page_flgs(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE const &page_pool,
+            bsl::safe_u64 const &page_virt,
+            bsl::safe_u64 const &page_flgs,
+            SYS_TYPE const &sys = bsl::dontcare) noexcept -> bsl::errc_type
+        {
+            static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE, L0E_TYPE>::value);
+
+            bsl::discard(page_pool);
+            bsl::discard(sys);
 
             bsl::expects(m_initialized);
             bsl::expects(page_virt.is_valid_and_checked());
+            bsl::expects(page_flgs.is_valid_and_checked());
 
             if constexpr (bsl::is_same<E, L2E_TYPE>::value) {
                 bsl::expects(is_page_1g_aligned(page_virt));
@@ -566,6 +731,97 @@ namespace lib
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the size of the page that maps the provided
+        ///     virtual address, or 0 if the address is not mapped.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address to look up
+        ///   @return Returns the size of the page that maps the provided
+        ///     virtual address, or 0 if the address is not mapped.
+        ///
+        [[nodiscard]] constexpr auto
+        page_size(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE const &page_pool,
+            bsl::safe_u64 const &page_virt) const noexcept -> bsl::safe_u64
+        {
+            bsl::discard(page_pool);
+
+            bsl::expects(m_initialized);
+            bsl::expects(page_virt.is_valid_and_checked());
+
+            if (tls.test_virt == page_virt) {
+                return {};
+            }
+
+            return bsl::to_u64(HYPERVISOR_PAGE_SIZE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Calls mut_func(virt, bytes, mut_entry) for every block
+        ///     that is mapped by the RPT. This version of the RPT does not
+        ///     map anything, so mut_func is never called.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FUNC the type of function to call
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param mut_func the function to call for each block
+        ///
+        template<typename FUNC>
+        constexpr void
+        for_each_block(
+            TLS_TYPE const &tls, PAGE_POOL_TYPE const &page_pool, FUNC &&mut_func) const noexcept
+        {
+            bsl::discard(tls);
+            bsl::discard(page_pool);
+            bsl::discard(mut_func);
+
+            bsl::expects(m_initialized);
+        }
+
+        /// <!-- description -->
+        ///   @brief Calls mut_func(virt, bytes, mut_entry) for the block that
+        ///     maps the provided virtual address. Returns 0 without calling
+        ///     mut_func if page_virt is tls.test_virt. Otherwise, mut_func
+        ///     is given an empty 4k entry.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FUNC the type of function to call
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address of the block to update
+        ///   @param mut_func the function to call for the block
+        ///   @return Returns the size of the block that maps the provided
+        ///     virtual address, or 0 if the address is not mapped.
+        ///
+        template<typename FUNC>
+        [[nodiscard]] constexpr auto
+        update_block(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE const &page_pool,
+            bsl::safe_u64 const &page_virt,
+            FUNC &&mut_func) const noexcept -> bsl::safe_u64
+        {
+            bsl::discard(page_pool);
+
+            bsl::expects(m_initialized);
+            bsl::expects(page_virt.is_valid_and_checked());
+
+            if (tls.test_virt == page_virt) {
+                return {};
+            }
+
+            L0E_TYPE mut_entry{};
+            auto const bytes{bsl::to_u64(HYPERVISOR_PAGE_SIZE)};
+            bsl::discard(mut_func(page_virt, bytes, mut_entry));
+
+            return bytes;
+        }
+
         /// <!-- description -->
         ///   @brief Returns all of the entries that are identified during the
         ///     translation of the provided virtual address.
@@ -646,6 +902,22 @@ namespace lib
             bsl::discard(tls);
             bsl::discard(rpt);
         }
+
+        /// <!-- description -->
+        ///   @brief Given a root page table, any aliased entries in this
+        ///     root page table that are no longer present in the provided
+        ///     root page table are removed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param rpt the root page table to remove stale aliases from
+        ///
+        constexpr void
+        remove_stale_tables(TLS_TYPE const &tls, basic_root_page_table_t const &rpt) noexcept
+        {
+            bsl::discard(tls);
+            bsl::discard(rpt);
+        }
     };
 }
 
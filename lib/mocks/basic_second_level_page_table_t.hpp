@@ -0,0 +1,556 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MOCK_BASIC_SECOND_LEVEL_PAGE_TABLE_T_HPP
+#define MOCK_BASIC_SECOND_LEVEL_PAGE_TABLE_T_HPP
+
+#include <basic_ept_entry_t.hpp>
+#include <basic_map_page_flags.hpp>
+#include <basic_npt_entry_t.hpp>
+#include <basic_page_4k_t.hpp>
+#include <second_level_page_table_helpers.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/dontcare_t.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+
+namespace lib
+{
+    /// @brief defines a unit testing specific error code
+    constexpr bsl::errc_type UNIT_TEST_SLPT_FAIL_INITIALIZE{-1101};
+
+    /// <!-- description -->
+    ///   @brief Builds second level page tables (EPT on Intel, NPT on AMD)
+    ///     for an extension's VMs. This version of the class does not
+    ///     build any tables. It fails any range that starts at
+    ///     tls.test_virt, and otherwise only tracks what would need to be
+    ///     flushed.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam TLS_TYPE the type of TLS block to use
+    ///   @tparam SYS_TYPE the type of bf_syscall_t to use (optional)
+    ///   @tparam PAGE_POOL_TYPE the type page_pool_t to use
+    ///   @tparam INTRINSIC_TYPE the type intrinsic_t to use
+    ///   @tparam L3E_TYPE the level-3 page table entry to use
+    ///   @tparam L2E_TYPE the level-2 page table entry to use
+    ///   @tparam L1E_TYPE the level-1 page table entry to use
+    ///   @tparam L0E_TYPE the level-0 page table entry to use
+    ///
+    template<
+        typename TLS_TYPE,
+        typename SYS_TYPE,
+        typename PAGE_POOL_TYPE,
+        typename INTRINSIC_TYPE,
+        typename L3E_TYPE,
+        typename L2E_TYPE,
+        typename L1E_TYPE,
+        typename L0E_TYPE>
+    class basic_second_level_page_table_t final
+    {
+        /// @brief stores whether or not the tables have been initialized
+        bool m_initialized{};
+        /// @brief stores whether or not 1G blocks can be used
+        bool m_page_1g{};
+        /// @brief stores whether or not the EPTP enables accessed/dirty flags
+        bool m_accessed_dirty{};
+        /// @brief stores the first GPA that changed since flushed()
+        bsl::safe_u64 m_flush_gpa{};
+        /// @brief stores the GPA after the last one that changed since flushed()
+        bsl::safe_u64 m_flush_end{};
+
+        /// <!-- description -->
+        ///   @brief Adds the provided range to the range that needs to be
+        ///     flushed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gpa the guest physical address of the range that changed
+        ///   @param bytes the number of bytes in the range that changed
+        ///
+        constexpr void
+        track(bsl::safe_u64 const &gpa, bsl::safe_u64 const &bytes) noexcept
+        {
+            auto const end{(gpa + bytes).checked()};
+
+            if (!this->needs_flush()) {
+                m_flush_gpa = gpa;
+                m_flush_end = end;
+                return;
+            }
+
+            if (gpa < m_flush_gpa) {
+                m_flush_gpa = gpa;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (end > m_flush_end) {
+                m_flush_end = end;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Fails if gpa is tls.test_virt, otherwise tracks the
+        ///     provided range.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param gpa the guest physical address of the range
+        ///   @param bytes the number of bytes in the range
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        change(TLS_TYPE const &tls, bsl::safe_u64 const &gpa, bsl::safe_u64 const &bytes) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(m_initialized);
+            bsl::expects(gpa.is_valid_and_checked());
+            bsl::expects(bytes.is_valid_and_checked());
+            bsl::expects(bytes.is_pos());
+
+            if (tls.test_virt == gpa) {
+                return bsl::errc_failure;
+            }
+
+            this->track(gpa, bytes);
+            return bsl::errc_success;
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Initializes this basic_second_level_page_table_t
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param page_1g_supported true if the CPU supports 1G blocks
+        ///     in its second level page tables
+        ///   @param sys the bf_syscall_t to use (optional)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        initialize(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE const &page_pool,
+            bool const page_1g_supported,
+            SYS_TYPE const &sys = bsl::dontcare) noexcept -> bsl::errc_type
+        {
+            bsl::discard(page_pool);
+            bsl::discard(sys);
+
+            if (UNIT_TEST_SLPT_FAIL_INITIALIZE == tls.test_ret) {
+                return bsl::errc_failure;
+            }
+
+            m_initialized = true;
+            m_page_1g = page_1g_supported;
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases all of the resources used by this
+        ///     basic_second_level_page_table_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///
+        constexpr void
+        release(TLS_TYPE const &tls, PAGE_POOL_TYPE const &page_pool) noexcept
+        {
+            bsl::discard(tls);
+            bsl::discard(page_pool);
+
+            m_initialized = {};
+            m_page_1g = {};
+            m_accessed_dirty = {};
+            m_flush_gpa = {};
+            m_flush_end = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if this basic_second_level_page_table_t
+        ///     is initialized. Returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if this basic_second_level_page_table_t
+        ///     is initialized. Returns false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        is_initialized() const noexcept -> bool
+        {
+            return m_initialized;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the EPTP or nCR3 for the tables, which is
+        ///     HYPERVISOR_PAGE_SIZE, with the EPTP's accessed/dirty bit set
+        ///     if set_accessed_dirty() was given true.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the EPTP or nCR3 for the tables.
+        ///
+        [[nodiscard]] constexpr auto
+        root_pointer() const noexcept -> bsl::safe_u64
+        {
+            bsl::expects(m_initialized);
+
+            if (m_accessed_dirty) {
+                return bsl::to_u64(HYPERVISOR_PAGE_SIZE) | helpers::EPTP_ENABLE_ACCESSED_DIRTY;
+            }
+
+            return bsl::to_u64(HYPERVISOR_PAGE_SIZE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the hardware to set the accessed and dirty flags
+        ///     of the tables.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val if true, the accessed and dirty flags are enabled
+        ///
+        constexpr void
+        set_accessed_dirty(bool const val) noexcept
+        {
+            m_accessed_dirty = val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps a range of guest physical memory to a range of
+        ///     system physical memory.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param gpa the guest physical address to map (4k aligned)
+        ///   @param spa the system physical address to map (4k aligned)
+        ///   @param bytes the number of bytes to map (a multiple of 4k)
+        ///   @param page_flgs defines how memory should be mapped
+        ///   @param sys the bf_syscall_t to use (optional)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        map(TLS_TYPE const &tls,
+            PAGE_POOL_TYPE const &page_pool,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &spa,
+            bsl::safe_u64 const &bytes,
+            bsl::safe_u64 const &page_flgs,
+            SYS_TYPE const &sys = bsl::dontcare) noexcept -> bsl::errc_type
+        {
+            bsl::discard(page_pool);
+            bsl::discard(sys);
+
+            bsl::expects(spa.is_valid_and_checked());
+            bsl::expects(page_flgs.is_valid_and_checked());
+
+            return this->change(tls, gpa, bytes);
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps a range of guest physical memory to the same range
+        ///     of system physical memory (i.e., an identity map).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param gpa the first address to map (4k aligned)
+        ///   @param bytes the number of bytes to map (a multiple of 4k)
+        ///   @param page_flgs defines how memory should be mapped
+        ///   @param sys the bf_syscall_t to use (optional)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        map_identity(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE const &page_pool,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &bytes,
+            bsl::safe_u64 const &page_flgs,
+            SYS_TYPE const &sys = bsl::dontcare) noexcept -> bsl::errc_type
+        {
+            return this->map(tls, page_pool, gpa, gpa, bytes, page_flgs, sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Changes the access rights of a range of guest physical
+        ///     memory that is already mapped.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param gpa the guest physical address to change (4k aligned)
+        ///   @param bytes the number of bytes to change (a multiple of 4k)
+        ///   @param page_flgs the new access rights of the range
+        ///   @param sys the bf_syscall_t to use (optional)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        set_flgs(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE const &page_pool,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &bytes,
+            bsl::safe_u64 const &page_flgs,
+            SYS_TYPE const &sys = bsl::dontcare) noexcept -> bsl::errc_type
+        {
+            bsl::discard(page_pool);
+            bsl::discard(sys);
+
+            bsl::expects(page_flgs.is_valid_and_checked());
+
+            return this->change(tls, gpa, bytes);
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps a range of guest physical memory.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param gpa the guest physical address to unmap (4k aligned)
+        ///   @param bytes the number of bytes to unmap (a multiple of 4k)
+        ///   @param sys the bf_syscall_t to use (optional)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        unmap(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE const &page_pool,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &bytes,
+            SYS_TYPE const &sys = bsl::dontcare) noexcept -> bsl::errc_type
+        {
+            bsl::discard(page_pool);
+            bsl::discard(sys);
+
+            return this->change(tls, gpa, bytes);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns 0 if gpa is tls.test_virt, otherwise returns
+        ///     the size of a 4k page.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param gpa the guest physical address to look up
+        ///   @return Returns the size of the block that maps the provided
+        ///     guest physical address, or 0 if it is not mapped.
+        ///
+        [[nodiscard]] constexpr auto
+        page_size(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE const &page_pool,
+            bsl::safe_u64 const &gpa) const noexcept -> bsl::safe_u64
+        {
+            bsl::discard(page_pool);
+            bsl::expects(m_initialized);
+
+            if (tls.test_virt == gpa) {
+                return {};
+            }
+
+            return bsl::to_u64(HYPERVISOR_PAGE_SIZE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns 0 if gpa is tls.test_virt, otherwise returns
+        ///     BASIC_MAP_PAGE_RW.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param gpa the guest physical address to look up
+        ///   @return Returns the access rights of the block that maps the
+        ///     provided guest physical address, or 0 if it is not mapped.
+        ///
+        [[nodiscard]] constexpr auto
+        page_flgs(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE const &page_pool,
+            bsl::safe_u64 const &gpa) const noexcept -> bsl::safe_u64
+        {
+            bsl::discard(page_pool);
+            bsl::expects(m_initialized);
+
+            if (tls.test_virt == gpa) {
+                return {};
+            }
+
+            return BASIC_MAP_PAGE_RW;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns 0 if gpa is tls.test_virt, otherwise tracks the
+        ///     4k page that gpa is part of and returns the size of a 4k page.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param gpa the guest physical address of the block to clear
+        ///   @return Returns the size of the block that was cleared, or 0
+        ///     if the provided guest physical address is not mapped.
+        ///
+        [[nodiscard]] constexpr auto
+        clear_dirty(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE const &page_pool,
+            bsl::safe_u64 const &gpa) noexcept -> bsl::safe_u64
+        {
+            bsl::discard(page_pool);
+            bsl::expects(m_initialized);
+
+            if (tls.test_virt == gpa) {
+                return {};
+            }
+
+            auto const size{bsl::to_u64(HYPERVISOR_PAGE_SIZE)};
+            this->track((gpa & ~BASIC_PAGE_4K_T_MASK).checked(), size);
+
+            return size;
+        }
+
+        /// <!-- description -->
+        ///   @brief The mocked tables never have a dirty block, so this
+        ///     never calls mut_func.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FUNC the type of function to call
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param mut_func the function to call for each dirty block
+        ///
+        template<typename FUNC>
+        constexpr void
+        harvest_dirty(
+            TLS_TYPE const &tls, PAGE_POOL_TYPE const &page_pool, FUNC &&mut_func) const noexcept
+        {
+            bsl::discard(tls);
+            bsl::discard(page_pool);
+            bsl::discard(mut_func);
+
+            bsl::expects(m_initialized);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the tables changed since the last call
+        ///     to flushed().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the tables need to be flushed.
+        ///
+        [[nodiscard]] constexpr auto
+        needs_flush() const noexcept -> bool
+        {
+            return m_flush_end.is_pos();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the first guest physical address that changed
+        ///     since the last call to flushed().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the first guest physical address that changed
+        ///     since the last call to flushed().
+        ///
+        [[nodiscard]] constexpr auto
+        flush_gpa() const noexcept -> bsl::safe_u64
+        {
+            return m_flush_gpa;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes, starting at flush_gpa(),
+        ///     that contain every change since the last call to flushed().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of bytes, starting at flush_gpa(),
+        ///     that contain every change since the last call to flushed().
+        ///
+        [[nodiscard]] constexpr auto
+        flush_bytes() const noexcept -> bsl::safe_u64
+        {
+            return (m_flush_end - m_flush_gpa).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells this basic_second_level_page_table_t that the
+        ///     extension flushed the tables, which resets the tracking.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///
+        constexpr void
+        flushed(TLS_TYPE const &tls, PAGE_POOL_TYPE const &page_pool) noexcept
+        {
+            bsl::discard(tls);
+            bsl::discard(page_pool);
+
+            m_flush_gpa = {};
+            m_flush_end = {};
+        }
+    };
+
+    /// @brief defines a basic_second_level_page_table_t that builds EPT
+    template<typename TLS_TYPE, typename SYS_TYPE, typename PAGE_POOL_TYPE, typename INTRINSIC_TYPE>
+    using basic_ept_t = basic_second_level_page_table_t<
+        TLS_TYPE,
+        SYS_TYPE,
+        PAGE_POOL_TYPE,
+        INTRINSIC_TYPE,
+        ept_l3e_t,
+        ept_l2e_t,
+        ept_l1e_t,
+        ept_l0e_t>;
+
+    /// @brief defines a basic_second_level_page_table_t that builds NPT
+    template<typename TLS_TYPE, typename SYS_TYPE, typename PAGE_POOL_TYPE, typename INTRINSIC_TYPE>
+    using basic_npt_t = basic_second_level_page_table_t<
+        TLS_TYPE,
+        SYS_TYPE,
+        PAGE_POOL_TYPE,
+        INTRINSIC_TYPE,
+        npt_l3e_t,
+        npt_l2e_t,
+        npt_l1e_t,
+        npt_l0e_t>;
+}
+
+#endif
@@ -0,0 +1,1304 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BASIC_BITMAP_PAGE_POOL_T_HPP
+#define BASIC_BITMAP_PAGE_POOL_T_HPP
+
+#if __has_include("page_pool_helpers.hpp")
+#include <page_pool_helpers.hpp>    // IWYU pragma: export
+#endif
+
+#if __has_include("basic_page_pool_helpers.hpp")
+#include <basic_page_pool_helpers.hpp>    // IWYU pragma: export
+#endif
+
+// IWYU pragma: no_include "page_pool_helpers.hpp"
+// IWYU pragma: no_include "basic_page_pool_helpers.hpp"
+// IWYU pragma: no_include "basic_page_pool_node_t.hpp"
+
+#include <basic_bitmap_page_pool_leaf_t.hpp>    // IWYU pragma: export
+#include <basic_lock_guard_t.hpp>               // IWYU pragma: keep
+#include <basic_page_pool_node_t.hpp>           // IWYU pragma: export
+#include <basic_spinlock_t.hpp>                 // IWYU pragma: keep
+
+#include <bsl/array.hpp>
+#include <bsl/construct_at.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/cstring.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/destroy_at.hpp>
+#include <bsl/dontcare_t.hpp>
+#include <bsl/ensures.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/is_pod.hpp>
+#include <bsl/likely.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace lib
+{
+    /// @brief defines the max number of leaves each NUMA node's bitmap can have
+    constexpr auto BITMAP_PAGE_POOL_MAX_LEAVES{256_umx};
+    /// @brief defines the number of words in each NUMA node's summary
+    constexpr auto BITMAP_PAGE_POOL_SUMMARY_WORDS{
+        (BITMAP_PAGE_POOL_MAX_LEAVES / BASIC_BITMAP_PAGE_POOL_WORD_BITS).checked()};
+    /// @brief defines the max number of pages allocate_n can return at once
+    constexpr auto BITMAP_PAGE_POOL_MAX_RUN{64_umx};
+    /// @brief defines the max number of pages the pool grows by at a time
+    constexpr auto BITMAP_PAGE_POOL_GROW_PAGES{512_umx};
+
+    /// <!-- description -->
+    ///   @brief the basic_bitmap_page_pool_t is a drop-in replacement for
+    ///     the basic_page_pool_t (selected using HYPERVISOR_BITMAP_PAGE_POOL)
+    ///     that tracks free pages using a bitmap instead of a linked list.
+    ///     Each NUMA node gets a two level bitmap. The bottom level is made
+    ///     up of leaves, where each bit is one page of physical memory. The
+    ///     top level (the summary) has one bit per leaf that is set if the
+    ///     leaf might have a free page. Free pages are found using tzcnt
+    ///     on the summary and then on the leaf.
+    ///
+    ///     Unlike the basic_page_pool_t, free pages are never written to
+    ///     once they have been given to the pool, and physically contiguous
+    ///     runs of up to BITMAP_PAGE_POOL_MAX_RUN pages can be allocated
+    ///     using allocate_n.
+    ///
+    ///     Leaves are carved out of the pages given to the pool. The first
+    ///     page that lands in a leaf's range becomes that leaf. Pages that
+    ///     fall outside of a node's bitmap (i.e., more than
+    ///     BITMAP_PAGE_POOL_MAX_LEAVES leaves away from the node's lowest
+    ///     page), or in a range another node already has a leaf for, are
+    ///     kept on an overflow list and are only used for single page
+    ///     allocations once the bitmaps are empty.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam TLS_TYPE the type of TLS block to use
+    ///   @tparam SYS_TYPE the type of bf_syscall_t to use
+    ///   @tparam MAP_ADDR the starting address of the address space
+    ///   @tparam MAP_SIZE the max size of the address space
+    ///
+    template<typename TLS_TYPE, typename SYS_TYPE, bsl::uintmx MAP_ADDR, bsl::uintmx MAP_SIZE>
+    class basic_bitmap_page_pool_t final
+    {
+        /// @brief stores the bitmap of a single NUMA node
+        struct bitmap_t final
+        {
+            /// @brief stores the page number (phys / page size) of leaf 0's first bit
+            bsl::safe_umx base;
+            /// @brief stores whether or not base has been set
+            bool has_base;
+            /// @brief stores the leaves, or a nullptr if no page was given for a leaf
+            bsl::array<basic_bitmap_page_pool_leaf_t *, BITMAP_PAGE_POOL_MAX_LEAVES.get()>
+                leaves;
+            /// @brief stores the first word of each leaf that might have a free page
+            bsl::array<bsl::safe_idx, BITMAP_PAGE_POOL_MAX_LEAVES.get()> hints;
+            /// @brief stores one bit per leaf that is set if the leaf might have a free page
+            bsl::array<bsl::uint64, BITMAP_PAGE_POOL_SUMMARY_WORDS.get()> summary;
+            /// @brief stores the number of free bytes in the bitmap
+            bsl::safe_umx free;
+        };
+
+        /// @brief stores the bitmap of each NUMA node.
+        bsl::array<bitmap_t, HYPERVISOR_MAX_NUMA_NODES.get()> m_bitmaps{};
+        /// @brief stores the number of NUMA nodes given to the basic_bitmap_page_pool_t.
+        bsl::safe_idx m_nodes{};
+        /// @brief stores the number of allocations served by a remote node.
+        bsl::safe_umx m_remote{};
+        /// @brief stores the head of the list of pages that are not in a bitmap.
+        basic_page_pool_node_t *m_overflow{};
+        /// @brief stores the number of free bytes on the overflow list.
+        bsl::safe_umx m_overflow_free{};
+        /// @brief stores the head of the reserve's list.
+        basic_page_pool_node_t *m_reserve{};
+        /// @brief stores the number of bytes left in the reserve.
+        bsl::safe_umx m_reserve_free{};
+        /// @brief stores the number of times the pool grew from the reserve.
+        bsl::safe_umx m_grown{};
+        /// @brief stores the number of bytes used by the leaves.
+        bsl::safe_umx m_leaves{};
+        /// @brief stores the total number of bytes given to the basic_bitmap_page_pool_t.
+        bsl::safe_umx m_size{};
+        /// @brief stores the total number of bytes allocated.
+        bsl::safe_umx m_used{};
+        /// @brief safe guards operations on the pool.
+        mutable basic_spinlock_t m_lock{};
+
+        /// <!-- description -->
+        ///   @brief Returns the number of trailing zeros in the provided
+        ///     value (i.e., the index of the lowest set bit).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to count the trailing zeros of. Cannot
+        ///     be 0.
+        ///   @return Returns the number of trailing zeros in val
+        ///
+        [[nodiscard]] static constexpr auto
+        tzcnt(bsl::safe_u64 const &val) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(val.is_pos());
+            return bsl::to_u64(static_cast<bsl::uint64>(__builtin_ctzll(val.get())));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the NUMA node of the PP that owns the provided
+        ///     TLS block. If the node is out of range, node 0 is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns the NUMA node of the PP that owns tls
+        ///
+        [[nodiscard]] constexpr auto
+        local_node(TLS_TYPE const &tls) const noexcept -> bsl::safe_idx
+        {
+            auto const node{bsl::to_idx(tls.numa_node)};
+            if (bsl::unlikely(node >= m_bitmaps.size())) {
+                return {};
+            }
+
+            return node;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the page number (phys / page size) of the
+        ///     provided page.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of page to get the page number of
+        ///   @param virt the virtual address of the page
+        ///   @return Returns the page number of the provided page
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        page_of(T const *const virt) const noexcept -> bsl::safe_umx
+        {
+            return (this->virt_to_phys(virt) / HYPERVISOR_PAGE_SIZE).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the leaf in the provided bitmap
+        ///     that tracks the provided page. If the page is outside of
+        ///     the bitmap, BITMAP_PAGE_POOL_MAX_LEAVES is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param bitmap the bitmap to look in
+        ///   @param page the page number to look up
+        ///   @return Returns the index of the leaf that tracks page
+        ///
+        [[nodiscard]] static constexpr auto
+        leaf_idx(bitmap_t const &bitmap, bsl::safe_umx const &page) noexcept -> bsl::safe_idx
+        {
+            if (page < bitmap.base) {
+                return bsl::to_idx(BITMAP_PAGE_POOL_MAX_LEAVES);
+            }
+
+            auto const idx{((page - bitmap.base) / BASIC_BITMAP_PAGE_POOL_LEAF_PAGES).checked()};
+            if (idx >= BITMAP_PAGE_POOL_MAX_LEAVES) {
+                return bsl::to_idx(BITMAP_PAGE_POOL_MAX_LEAVES);
+            }
+
+            return bsl::to_idx(idx);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the bitmap that has a leaf for the provided
+        ///     page, or a nullptr if no bitmap has a leaf for the page.
+        ///     insert() never gives two bitmaps a leaf for the same range
+        ///     of pages, so there is at most one such bitmap. The local
+        ///     node is checked first as it is the most likely owner.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param local the NUMA node of the current PP
+        ///   @param page the page number to look up
+        ///   @return Returns the bitmap that has a leaf for the provided
+        ///     page, or a nullptr if there is no such bitmap
+        ///
+        [[nodiscard]] constexpr auto
+        owner(bsl::safe_idx const &local, bsl::safe_umx const &page) noexcept -> bitmap_t *
+        {
+            auto *const pmut_local{m_bitmaps.at_if(local)};
+            if (has_leaf(*pmut_local, page)) {
+                return pmut_local;
+            }
+
+            /// NOTE:
+            /// - Every bitmap is checked, and not just the first m_nodes,
+            ///   as grow() gives pages to the node of the current PP even
+            ///   if that node was never given to initialize().
+            ///
+
+            for (auto &mut_bitmap : m_bitmaps) {
+                if (has_leaf(mut_bitmap, page)) {
+                    return &mut_bitmap;
+                }
+
+                bsl::touch();
+            }
+
+            return nullptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided bitmap has a leaf for the
+        ///     provided page. Returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param bitmap the bitmap to look in
+        ///   @param page the page number to look up
+        ///   @return Returns true if the provided bitmap has a leaf for
+        ///     the provided page. Returns false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        has_leaf(bitmap_t const &bitmap, bsl::safe_umx const &page) noexcept -> bool
+        {
+            if (!bitmap.has_base) {
+                return false;
+            }
+
+            auto const idx{leaf_idx(bitmap, page)};
+            if (idx >= bitmap.leaves.size()) {
+                return false;
+            }
+
+            return nullptr != *bitmap.leaves.at_if(idx);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if a bitmap other than the provided one
+        ///     has a leaf for the provided page. Returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param bitmap the bitmap to ignore
+        ///   @param page the page number to look up
+        ///   @return Returns true if a bitmap other than the provided one
+        ///     has a leaf for the provided page. Returns false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        is_claimed(bitmap_t const &bitmap, bsl::safe_umx const &page) const noexcept -> bool
+        {
+            for (auto const &other : m_bitmaps) {
+                if (&other == &bitmap) {
+                    continue;
+                }
+
+                if (has_leaf(other, page)) {
+                    return true;
+                }
+
+                bsl::touch();
+            }
+
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks the provided run of pages as free in the provided
+        ///     bitmap. The run cannot cross a leaf and every page in the
+        ///     run must currently be marked as allocated.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_bitmap the bitmap to mark the pages in
+        ///   @param page the page number of the first page in the run
+        ///   @param pages the number of pages in the run
+        ///
+        static constexpr void
+        mark_free(
+            bitmap_t &mut_bitmap, bsl::safe_umx const &page, bsl::safe_umx const &pages) noexcept
+        {
+            constexpr auto bits{BASIC_BITMAP_PAGE_POOL_WORD_BITS};
+
+            auto const idx{leaf_idx(mut_bitmap, page)};
+            auto *const pmut_leaf{*mut_bitmap.leaves.at_if(idx)};
+            bsl::expects(nullptr != pmut_leaf);
+
+            auto const rel{(page - mut_bitmap.base).checked()};
+            auto const first{(rel % BASIC_BITMAP_PAGE_POOL_LEAF_PAGES).checked()};
+            bsl::expects((first + pages).checked() <= BASIC_BITMAP_PAGE_POOL_LEAF_PAGES);
+
+            for (bsl::safe_umx mut_i{}; mut_i < pages; ++mut_i) {
+                auto const bit{(first + mut_i).checked()};
+                auto const mask{(bsl::safe_u64::magic_1() << bsl::to_u64(bit % bits)).checked()};
+                auto *const pmut_word{pmut_leaf->words.at_if(bsl::to_idx(bit / bits))};
+
+                bsl::expects((bsl::to_u64(*pmut_word) & mask).is_zero());
+                *pmut_word |= mask.get();
+            }
+
+            auto const word{bsl::to_idx(first / bits)};
+            auto *const pmut_hint{mut_bitmap.hints.at_if(idx)};
+            if (word < *pmut_hint) {
+                *pmut_hint = word;
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const leaf{bsl::to_umx(idx)};
+            auto const mask{(bsl::safe_u64::magic_1() << bsl::to_u64(leaf % bits)).checked()};
+            *mut_bitmap.summary.at_if(bsl::to_idx(leaf / bits)) |= mask.get();
+
+            mut_bitmap.free += (pages * HYPERVISOR_PAGE_SIZE).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks the provided run of pages as allocated in the
+        ///     provided bitmap. The run cannot cross a leaf and every page
+        ///     in the run must currently be marked as free.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_bitmap the bitmap to mark the pages in
+        ///   @param page the page number of the first page in the run
+        ///   @param pages the number of pages in the run
+        ///
+        static constexpr void
+        mark_used(
+            bitmap_t &mut_bitmap, bsl::safe_umx const &page, bsl::safe_umx const &pages) noexcept
+        {
+            constexpr auto bits{BASIC_BITMAP_PAGE_POOL_WORD_BITS};
+
+            auto *const pmut_leaf{*mut_bitmap.leaves.at_if(leaf_idx(mut_bitmap, page))};
+            bsl::expects(nullptr != pmut_leaf);
+
+            auto const rel{(page - mut_bitmap.base).checked()};
+            auto const first{(rel % BASIC_BITMAP_PAGE_POOL_LEAF_PAGES).checked()};
+            for (bsl::safe_umx mut_i{}; mut_i < pages; ++mut_i) {
+                auto const bit{(first + mut_i).checked()};
+                auto const mask{(bsl::safe_u64::magic_1() << bsl::to_u64(bit % bits)).checked()};
+                auto *const pmut_word{pmut_leaf->words.at_if(bsl::to_idx(bit / bits))};
+
+                bsl::expects((bsl::to_u64(*pmut_word) & mask).is_pos());
+                *pmut_word &= (~mask).checked().get();
+            }
+
+            mut_bitmap.free -= (pages * HYPERVISOR_PAGE_SIZE).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the first bit of the first run of
+        ///     free pages in the provided leaf that is at least as long
+        ///     as requested, starting the search at the provided word.
+        ///     Runs can span words, but not leaves. If no such run exists,
+        ///     bsl::safe_umx::failure() is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param leaf the leaf to search
+        ///   @param hint the first word in the leaf that might have a free page
+        ///   @param pages the number of pages in the run
+        ///   @return Returns the index of the first bit of the run, or
+        ///     bsl::safe_umx::failure() if no such run exists
+        ///
+        [[nodiscard]] static constexpr auto
+        find_run(
+            basic_bitmap_page_pool_leaf_t const *const leaf,
+            bsl::safe_idx const &hint,
+            bsl::safe_umx const &pages) noexcept -> bsl::safe_umx
+        {
+            constexpr auto bits{bsl::to_u64(BASIC_BITMAP_PAGE_POOL_WORD_BITS)};
+            bsl::safe_umx mut_run{};
+
+            for (auto mut_i{hint}; mut_i < leaf->words.size(); ++mut_i) {
+                auto const word{bsl::to_u64(*leaf->words.at_if(mut_i))};
+                if (word.is_zero()) {
+                    mut_run = {};
+                    continue;
+                }
+
+                /// NOTE:
+                /// - The word is walked one run at a time. tzcnt of what is
+                ///   left of the word skips a run of allocated pages, and
+                ///   tzcnt of its inverse skips a run of free pages. A run
+                ///   of free pages that reaches the top of the word carries
+                ///   over into the next word.
+                ///
+
+                bsl::safe_u64 mut_bit{};
+                while (mut_bit < bits) {
+                    auto const rest{(word >> mut_bit).checked()};
+                    if (rest.is_zero()) {
+                        mut_run = {};
+                        break;
+                    }
+
+                    auto const zeros{tzcnt(rest)};
+                    if (zeros.is_pos()) {
+                        mut_run = {};
+                        mut_bit += zeros;
+                        continue;
+                    }
+
+                    auto mut_ones{bits};
+                    auto const inverse{(~rest).checked()};
+                    if (inverse.is_pos()) {
+                        mut_ones = tzcnt(inverse);
+                    }
+                    else {
+                        bsl::touch();
+                    }
+
+                    mut_bit += mut_ones;
+                    mut_run += bsl::to_umx(mut_ones);
+
+                    if (mut_run >= pages) {
+                        auto const end{((bsl::to_u64(mut_i) * bits) + mut_bit).checked()};
+                        return (bsl::to_umx(end) - mut_run).checked();
+                    }
+
+                    bsl::touch();
+                }
+            }
+
+            return bsl::safe_umx::failure();
+        }
+
+        /// <!-- description -->
+        ///   @brief Allocates a run of pages from the provided bitmap and
+        ///     returns the page number of the first page in the run. If
+        ///     the bitmap does not have a long enough run of free pages,
+        ///     bsl::safe_umx::failure() is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_bitmap the bitmap to allocate from
+        ///   @param pages the number of pages in the run
+        ///   @return Returns the page number of the first page in the run,
+        ///     or bsl::safe_umx::failure() on failure
+        ///
+        [[nodiscard]] static constexpr auto
+        alloc_run(bitmap_t &mut_bitmap, bsl::safe_umx const &pages) noexcept -> bsl::safe_umx
+        {
+            constexpr auto bits{BASIC_BITMAP_PAGE_POOL_WORD_BITS};
+
+            if (mut_bitmap.free < (pages * HYPERVISOR_PAGE_SIZE).checked()) {
+                return bsl::safe_umx::failure();
+            }
+
+            for (bsl::safe_idx mut_i{}; mut_i < mut_bitmap.summary.size(); ++mut_i) {
+                auto *const pmut_summary{mut_bitmap.summary.at_if(mut_i)};
+                auto mut_leaves{bsl::to_u64(*pmut_summary)};
+
+                while (mut_leaves.is_pos()) {
+                    auto const low{tzcnt(mut_leaves)};
+                    auto const mask{(bsl::safe_u64::magic_1() << low).checked()};
+                    mut_leaves &= (~mask).checked();
+
+                    auto const leaf{((bsl::to_umx(mut_i) * bits) + bsl::to_umx(low)).checked()};
+                    auto const idx{bsl::to_idx(leaf)};
+                    auto *const pmut_hint{mut_bitmap.hints.at_if(idx)};
+
+                    auto const bit{find_run(*mut_bitmap.leaves.at_if(idx), *pmut_hint, pages)};
+                    if (bit.is_invalid()) {
+                        if (bsl::safe_umx::magic_1() == pages) {
+                            *pmut_summary &= (~mask).checked().get();
+                        }
+                        else {
+                            bsl::touch();
+                        }
+
+                        continue;
+                    }
+
+                    if (bsl::safe_umx::magic_1() == pages) {
+                        *pmut_hint = bsl::to_idx(bit / bits);
+                    }
+                    else {
+                        bsl::touch();
+                    }
+
+                    auto const first{(leaf * BASIC_BITMAP_PAGE_POOL_LEAF_PAGES).checked()};
+                    auto const page{(mut_bitmap.base + first + bit).checked()};
+
+                    mark_used(mut_bitmap, page, pages);
+                    return page;
+                }
+            }
+
+            return bsl::safe_umx::failure();
+        }
+
+        /// <!-- description -->
+        ///   @brief Allocates a run of pages from the local node's bitmap,
+        ///     falling back to any other node's bitmap, and returns the
+        ///     page number of the first page in the run. On failure,
+        ///     bsl::safe_umx::failure() is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param local the NUMA node of the current PP
+        ///   @param pages the number of pages in the run
+        ///   @return Returns the page number of the first page in the run,
+        ///     or bsl::safe_umx::failure() on failure
+        ///
+        [[nodiscard]] constexpr auto
+        alloc_any(bsl::safe_idx const &local, bsl::safe_umx const &pages) noexcept
+            -> bsl::safe_umx
+        {
+            auto const page{alloc_run(*m_bitmaps.at_if(local), pages)};
+            if (page.is_valid()) {
+                return page;
+            }
+
+            for (bsl::safe_idx mut_i{}; mut_i < m_nodes; ++mut_i) {
+                if (mut_i == local) {
+                    continue;
+                }
+
+                auto const remote{alloc_run(*m_bitmaps.at_if(mut_i), pages)};
+                if (remote.is_valid()) {
+                    ++m_remote;
+                    return remote;
+                }
+
+                bsl::touch();
+            }
+
+            return bsl::safe_umx::failure();
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a page to the overflow list.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_page the page to add to the overflow list
+        ///
+        constexpr void
+        push_overflow(basic_page_pool_node_t *const pmut_page) noexcept
+        {
+            pmut_page->next = m_overflow;
+            m_overflow = pmut_page;
+            m_overflow_free += HYPERVISOR_PAGE_SIZE;
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives a page that is new to the pool to the provided
+        ///     bitmap. If the bitmap does not have a leaf for the page
+        ///     yet, the page becomes that leaf. If the page is outside of
+        ///     the bitmap, or if another node's bitmap already has a leaf
+        ///     for the page, it is added to the overflow list. This keeps
+        ///     the leaves of different nodes from overlapping, so that
+        ///     release() always returns a page to the node it came from.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_bitmap the bitmap to give the page to
+        ///   @param pmut_page the page to give to the bitmap
+        ///
+        constexpr void
+        insert(bitmap_t &mut_bitmap, basic_page_pool_node_t *const pmut_page) noexcept
+        {
+            auto const page{this->page_of(pmut_page)};
+            auto const idx{leaf_idx(mut_bitmap, page)};
+
+            if (bsl::unlikely(idx >= mut_bitmap.leaves.size())) {
+                this->push_overflow(pmut_page);
+                m_size += HYPERVISOR_PAGE_SIZE;
+                return;
+            }
+
+            auto *const pmut_leaf{mut_bitmap.leaves.at_if(idx)};
+            if (nullptr == *pmut_leaf) {
+                if (this->is_claimed(mut_bitmap, page)) {
+                    this->push_overflow(pmut_page);
+                    m_size += HYPERVISOR_PAGE_SIZE;
+                    return;
+                }
+
+                bsl::destroy_at(pmut_page);
+                *pmut_leaf = bsl::builtin_memset(
+                    bsl::construct_at<basic_bitmap_page_pool_leaf_t>(pmut_page),
+                    '\0',
+                    HYPERVISOR_PAGE_SIZE);
+
+                m_leaves += HYPERVISOR_PAGE_SIZE;
+                return;
+            }
+
+            mark_free(mut_bitmap, page, bsl::safe_umx::magic_1());
+            m_size += HYPERVISOR_PAGE_SIZE;
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves up to BITMAP_PAGE_POOL_GROW_PAGES pages from the
+        ///     reserve to the bitmap of the provided NUMA node. Returns
+        ///     true if the reserve had any pages, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param node the NUMA node to give the pages to
+        ///   @return Returns true if the reserve had any pages, false
+        ///     otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        grow(bsl::safe_idx const &node) noexcept -> bool
+        {
+            if (nullptr == m_reserve) {
+                return false;
+            }
+
+            constexpr auto leaf_pages{BASIC_BITMAP_PAGE_POOL_LEAF_PAGES};
+
+            auto *const pmut_bitmap{m_bitmaps.at_if(node)};
+            bsl::safe_umx mut_pages{};
+
+            /// NOTE:
+            /// - If the node was never given any pages, its bitmap starts
+            ///   at the first page of the reserve.
+            ///
+
+            if (!pmut_bitmap->has_base) {
+                auto const first{this->page_of(m_reserve)};
+                pmut_bitmap->base = ((first / leaf_pages) * leaf_pages).checked();
+                pmut_bitmap->has_base = true;
+            }
+            else {
+                bsl::touch();
+            }
+
+            while (mut_pages < BITMAP_PAGE_POOL_GROW_PAGES) {
+                if (nullptr == m_reserve) {
+                    break;
+                }
+
+                auto *const pmut_page{m_reserve};
+                m_reserve = pmut_page->next;
+
+                this->insert(*pmut_bitmap, pmut_page);
+                ++mut_pages;
+            }
+
+            auto const size{(mut_pages * HYPERVISOR_PAGE_SIZE).checked()};
+
+            m_reserve_free = (m_reserve_free - size).checked();
+            ++m_grown;
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a zeroed, page aligned T * to the provided run
+        ///     of pages.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to return
+        ///   @param page the page number of the first page in the run
+        ///   @param pages the number of pages in the run
+        ///   @return Returns a zeroed, page aligned T * to the run of pages
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        zeroed(bsl::safe_umx const &page, bsl::safe_umx const &pages) const noexcept -> T *
+        {
+            auto *const pmut_virt{
+                this->template phys_to_virt<T>((page * HYPERVISOR_PAGE_SIZE).checked())};
+
+            return bsl::builtin_memset(pmut_virt, '\0', (pages * HYPERVISOR_PAGE_SIZE).checked());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a run of pages to the pool. The run is always
+        ///     returned to the bitmap it was allocated from, as only one
+        ///     bitmap can have a leaf for it. If no bitmap has a leaf for
+        ///     the run, it is added to the overflow list, which can only
+        ///     happen with single pages.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to deallocate
+        ///   @param local the NUMA node of the current PP
+        ///   @param pmut_virt the pointer to the first page of the run
+        ///   @param pages the number of pages in the run
+        ///
+        template<typename T>
+        constexpr void
+        release(bsl::safe_idx const &local, T *const pmut_virt, bsl::safe_umx const &pages) noexcept
+        {
+            bsl::expects(nullptr != pmut_virt);
+
+            auto const page{this->page_of(pmut_virt)};
+            m_used -= (pages * HYPERVISOR_PAGE_SIZE).checked();
+
+            auto *const pmut_bitmap{this->owner(local, page)};
+            if (nullptr != pmut_bitmap) {
+                mark_free(*pmut_bitmap, page, pages);
+                return;
+            }
+
+            bsl::expects(bsl::safe_umx::magic_1() == pages);
+
+            bsl::destroy_at(pmut_virt);
+            this->push_overflow(bsl::construct_at<basic_page_pool_node_t>(pmut_virt));
+        }
+
+        /// <!-- description -->
+        ///   @brief Converts a virtual address to a physical address.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param virt the virtual address to convert
+        ///   @return the resulting physical address
+        ///
+        [[nodiscard]] constexpr auto
+        virt_to_phys(bsl::safe_umx const &virt) const noexcept -> bsl::safe_umx
+        {
+            constexpr bsl::safe_umx min_addr{MAP_ADDR};
+            constexpr bsl::safe_umx max_addr{(min_addr + MAP_SIZE).checked()};
+
+            bsl::expects(virt.is_valid_and_checked());
+            bsl::expects(virt.is_pos());
+            bsl::expects(virt > min_addr);
+            bsl::expects(virt < max_addr);
+
+            return (virt - min_addr).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Converts a physical address to a virtual address.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param phys the physical address to convert
+        ///   @return the resulting virtual address
+        ///
+        [[nodiscard]] constexpr auto
+        phys_to_virt(bsl::safe_umx const &phys) const noexcept -> bsl::safe_umx
+        {
+            bsl::expects(phys.is_valid_and_checked());
+            bsl::expects(phys.is_pos());
+            bsl::expects(phys < MAP_SIZE);
+
+            return (phys + MAP_ADDR).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes allocated.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of bytes allocated.
+        ///
+        [[nodiscard]] constexpr auto
+        allocated() const noexcept -> bsl::safe_umx
+        {
+            /// NOTE:
+            /// - The following is marked checked because the allocation
+            ///   function ensures this math will never overflow.
+            ///
+
+            return m_used.checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns this->size() - this->allocated().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns this->size() - this->allocated().
+        ///
+        [[nodiscard]] constexpr auto
+        remaining() const noexcept -> bsl::safe_umx
+        {
+            /// NOTE:
+            /// - The following is marked checked because the allocation
+            ///   function ensures this math will never overflow.
+            ///
+
+            return (this->size() - this->allocated()).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs a row of the dump with the provided number of
+        ///     bytes in KB or MB.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param name the name of the row
+        ///   @param bytes the number of bytes to output
+        ///
+        static constexpr void
+        dump_bytes(bsl::string_view const &name, bsl::safe_umx const &bytes) noexcept
+        {
+            constexpr auto kb{1024_umx};
+            constexpr auto mb{kb * kb};
+
+            auto const bytes_kb{(bytes / kb).checked()};
+            auto const bytes_mb{(bytes / mb).checked()};
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<23s", name};
+            bsl::print() << bsl::ylw << "| ";
+            if (bytes_mb.is_zero()) {
+                bsl::print() << bsl::rst << bsl::fmt{"4d", bytes_kb} << " KB ";
+            }
+            else {
+                bsl::print() << bsl::rst << bsl::fmt{"4d", bytes_mb} << " MB ";
+            }
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Gives the basic_bitmap_page_pool_t the list of pages
+        ///     that belong to the provided NUMA node. Each node should only
+        ///     be given to the basic_bitmap_page_pool_t once. Empty lists
+        ///     are ignored. This is the only time the free pages are read,
+        ///     as the list is walked once to find the node's lowest page
+        ///     (where the node's bitmap starts) and once more to mark each
+        ///     page as free.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_pool the mutable_buffer_t of the basic_bitmap_page_pool_t
+        ///   @param node the NUMA node the provided pages belong to
+        ///
+        constexpr void
+        initialize(
+            bsl::span<basic_page_pool_node_t> &mut_pool, bsl::safe_idx const &node = {}) noexcept
+        {
+            constexpr auto leaf_pages{BASIC_BITMAP_PAGE_POOL_LEAF_PAGES};
+            bsl::expects(node < m_bitmaps.size());
+
+            if (mut_pool.empty()) {
+                return;
+            }
+
+            auto *const pmut_bitmap{m_bitmaps.at_if(node)};
+
+            auto mut_lowest{this->page_of(mut_pool.data())};
+            for (auto const *mut_page{mut_pool.data()->next}; nullptr != mut_page;
+                 mut_page = mut_page->next) {
+                auto const page{this->page_of(mut_page)};
+                if (page < mut_lowest) {
+                    mut_lowest = page;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            pmut_bitmap->base = ((mut_lowest / leaf_pages) * leaf_pages).checked();
+            pmut_bitmap->has_base = true;
+
+            auto *pmut_mut_page{mut_pool.data()};
+            while (nullptr != pmut_mut_page) {
+                auto *const pmut_next{pmut_mut_page->next};
+                this->insert(*pmut_bitmap, pmut_mut_page);
+                pmut_mut_page = pmut_next;
+            }
+
+            if (node >= m_nodes) {
+                m_nodes = node;
+                ++m_nodes;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives the basic_bitmap_page_pool_t a list of pages that
+        ///     it can grow into once every NUMA node's bitmap is empty. The
+        ///     reserve should only be given to the basic_bitmap_page_pool_t
+        ///     once. An empty reserve is ignored.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_reserve the list of pages to grow into
+        ///
+        constexpr void
+        initialize_reserve(bsl::span<basic_page_pool_node_t> &mut_reserve) noexcept
+        {
+            if (mut_reserve.empty()) {
+                return;
+            }
+
+            m_reserve = mut_reserve.data();
+            m_reserve_free = (mut_reserve.size() * HYPERVISOR_PAGE_SIZE).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Allocates a page from the basic_bitmap_page_pool_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to allocate
+        ///   @param tls the current TLS block
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @return Returns a pointer to the newly allocated page
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        allocate(TLS_TYPE const &tls, SYS_TYPE &mut_sys = bsl::dontcare) noexcept -> T *
+        {
+            static_assert(bsl::is_pod<T>::value);
+            static_assert(sizeof(T) == HYPERVISOR_PAGE_SIZE);
+
+            constexpr auto one{bsl::safe_umx::magic_1()};
+            basic_lock_guard_t mut_lock{tls, m_lock};
+
+            auto const local{this->local_node(tls)};
+            auto mut_page{this->alloc_any(local, one)};
+
+            if (bsl::unlikely(mut_page.is_invalid())) {
+                if ((nullptr == m_overflow) && this->grow(local)) {
+                    mut_page = alloc_run(*m_bitmaps.at_if(local), one);
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (bsl::likely(mut_page.is_valid())) {
+                m_used += HYPERVISOR_PAGE_SIZE;
+                return this->template zeroed<T>(mut_page, one);
+            }
+
+            basic_page_pool_node_t *pmut_mut_node{m_overflow};
+            if (nullptr != pmut_mut_node) {
+                m_overflow = pmut_mut_node->next;
+                m_overflow_free -= HYPERVISOR_PAGE_SIZE;
+            }
+            else {
+                pmut_mut_node = helpers::add_to_page_pool(mut_sys);
+                if (bsl::unlikely(nullptr == pmut_mut_node)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return {};
+                }
+
+                m_size += HYPERVISOR_PAGE_SIZE;
+            }
+
+            m_used += HYPERVISOR_PAGE_SIZE;
+
+            bsl::destroy_at(pmut_mut_node);
+            auto *const pmut_virt{bsl::construct_at<T>(pmut_mut_node)};
+
+            return bsl::builtin_memset(pmut_virt, '\0', HYPERVISOR_PAGE_SIZE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Allocates a physically contiguous run of pages from the
+        ///     basic_bitmap_page_pool_t and returns a pointer to the first
+        ///     page. Since the pool is in the direct map, the run is also
+        ///     virtually contiguous. Runs are only allocated from the
+        ///     bitmaps, so unlike allocate, this does not fall back to the
+        ///     overflow list or the bf_syscall_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to allocate
+        ///   @param tls the current TLS block
+        ///   @param pages the number of pages to allocate. Must be between 1
+        ///     and BITMAP_PAGE_POOL_MAX_RUN
+        ///   @return Returns a pointer to the first page of the newly
+        ///     allocated run on success, or a nullptr on failure
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        allocate_n(TLS_TYPE const &tls, bsl::safe_umx const &pages) noexcept -> T *
+        {
+            static_assert(bsl::is_pod<T>::value);
+            static_assert(sizeof(T) == HYPERVISOR_PAGE_SIZE);
+
+            bsl::expects(pages.is_valid_and_checked());
+            bsl::expects(pages.is_pos());
+            bsl::expects(pages <= BITMAP_PAGE_POOL_MAX_RUN);
+
+            basic_lock_guard_t mut_lock{tls, m_lock};
+
+            auto const local{this->local_node(tls)};
+            auto mut_page{this->alloc_any(local, pages)};
+
+            if (bsl::unlikely(mut_page.is_invalid())) {
+                if (this->grow(local)) {
+                    mut_page = alloc_run(*m_bitmaps.at_if(local), pages);
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (bsl::unlikely(mut_page.is_invalid())) {
+                bsl::error() << "page pool is out of runs of "    // --
+                             << bsl::hex(pages)                   // --
+                             << " pages"                          // --
+                             << bsl::endl                         // --
+                             << bsl::here();
+
+                return nullptr;
+            }
+
+            m_used += (pages * HYPERVISOR_PAGE_SIZE).checked();
+            return this->template zeroed<T>(mut_page, pages);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a page previously allocated using the allocate
+        ///     function to the basic_bitmap_page_pool_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to deallocate
+        ///   @param tls the current TLS block
+        ///   @param pmut_virt the pointer to the page to deallocate
+        ///
+        template<typename T>
+        constexpr void
+        deallocate(TLS_TYPE const &tls, T *const pmut_virt) noexcept
+        {
+            static_assert(bsl::is_pod<T>::value);
+            static_assert(sizeof(T) == HYPERVISOR_PAGE_SIZE);
+
+            basic_lock_guard_t mut_lock{tls, m_lock};
+            this->release(this->local_node(tls), pmut_virt, bsl::safe_umx::magic_1());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a run of pages previously allocated using the
+        ///     allocate_n function to the basic_bitmap_page_pool_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to deallocate
+        ///   @param tls the current TLS block
+        ///   @param pmut_virt the pointer to the first page of the run
+        ///   @param pages the number of pages that were given to allocate_n
+        ///
+        template<typename T>
+        constexpr void
+        deallocate_n(TLS_TYPE const &tls, T *const pmut_virt, bsl::safe_umx const &pages) noexcept
+        {
+            static_assert(bsl::is_pod<T>::value);
+            static_assert(sizeof(T) == HYPERVISOR_PAGE_SIZE);
+
+            bsl::expects(pages.is_valid_and_checked());
+            bsl::expects(pages.is_pos());
+            bsl::expects(pages <= BITMAP_PAGE_POOL_MAX_RUN);
+
+            basic_lock_guard_t mut_lock{tls, m_lock};
+            this->release(this->local_node(tls), pmut_virt, pages);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a batch of pages previously allocated using the
+        ///     allocate function to the basic_bitmap_page_pool_t. The lock
+        ///     is only acquired once for the whole batch.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to deallocate
+        ///   @param tls the current TLS block
+        ///   @param virts the pointers to the pages to deallocate
+        ///
+        template<typename T>
+        constexpr void
+        deallocate_batch(TLS_TYPE const &tls, bsl::span<T *const> const &virts) noexcept
+        {
+            static_assert(bsl::is_pod<T>::value);
+            static_assert(sizeof(T) == HYPERVISOR_PAGE_SIZE);
+
+            if (virts.empty()) {
+                return;
+            }
+
+            basic_lock_guard_t mut_lock{tls, m_lock};
+
+            auto const local{this->local_node(tls)};
+            for (bsl::safe_idx mut_i{}; mut_i < virts.size(); ++mut_i) {
+                this->release(local, *virts.at_if(mut_i), bsl::safe_umx::magic_1());
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes in the pool. This does not
+        ///     include the pages that were turned into leaves.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of bytes in the pool.
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> bsl::safe_umx
+        {
+            bsl::ensures(m_size.is_valid_and_checked());
+            return m_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes allocated.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns the number of bytes allocated.
+        ///
+        [[nodiscard]] constexpr auto
+        allocated(TLS_TYPE const &tls) const noexcept -> bsl::safe_umx
+        {
+            basic_lock_guard_t mut_lock{tls, m_lock};
+            return this->allocated();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns this->size() - this->allocated().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns this->size() - this->allocated().
+        ///
+        [[nodiscard]] constexpr auto
+        remaining(TLS_TYPE const &tls) const noexcept -> bsl::safe_umx
+        {
+            basic_lock_guard_t mut_lock{tls, m_lock};
+            return this->remaining();
+        }
+
+        /// <!-- description -->
+        ///   @brief Converts a virtual address to a physical address.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T defines the type of virtual address being converted
+        ///   @param virt the virtual address to convert
+        ///   @return the resulting physical address
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        virt_to_phys(T const *const virt) const noexcept -> bsl::safe_umx
+        {
+            static_assert(bsl::is_pod<T>::value);
+            static_assert(sizeof(T) == HYPERVISOR_PAGE_SIZE);
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            return this->virt_to_phys(bsl::to_umx(reinterpret_cast<bsl::uintmx>(virt)));
+        }
+
+        /// <!-- description -->
+        ///   @brief Converts a physical address to a virtual address.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T defines the type of virtual address to convert to
+        ///   @param phys the physical address to convert
+        ///   @return the resulting virtual address
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        phys_to_virt(bsl::safe_umx const &phys) const noexcept -> T *
+        {
+            static_assert(bsl::is_pod<T>::value);
+            static_assert(sizeof(T) == HYPERVISOR_PAGE_SIZE);
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            return reinterpret_cast<T *>(this->phys_to_virt(phys).get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Dumps the basic_bitmap_page_pool_t
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///
+        constexpr void
+        dump(TLS_TYPE const &tls) const noexcept
+        {
+            basic_lock_guard_t mut_lock{tls, m_lock};
+
+            bsl::print() << bsl::mag << "page pool dump (bitmap): ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Header
+            ///
+
+            bsl::print() << bsl::ylw << "+----------------------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::blu << bsl::fmt{"^33s", "overview "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "+----------------------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^23s", "description "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^8s", "value "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "+----------------------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Sizes
+            ///
+
+            dump_bytes("total ", this->size());
+            dump_bytes("used ", this->allocated());
+            dump_bytes("remaining ", this->remaining());
+            dump_bytes("leaves ", m_leaves);
+            dump_bytes("overflow ", m_overflow_free);
+            dump_bytes("reserve ", m_reserve_free);
+
+            /// Counters
+            ///
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<23s", "remote allocs "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"4d", m_remote} << "    ";
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<23s", "times grown "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"4d", m_grown} << "    ";
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Per Node
+            ///
+
+            constexpr auto kb{1024_umx};
+            constexpr auto mb{kb * kb};
+
+            for (bsl::safe_idx mut_i{}; mut_i < m_nodes; ++mut_i) {
+                auto const free{m_bitmaps.at_if(mut_i)->free};
+                auto const free_kb{(free / kb).checked()};
+                auto const free_mb{(free / mb).checked()};
+
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << "node ";
+                bsl::print() << bsl::rst << bsl::fmt{"<2d", bsl::to_u64(mut_i)};
+                bsl::print() << bsl::rst << bsl::fmt{"<16s", "remaining "};
+                bsl::print() << bsl::ylw << "| ";
+                if (free_mb.is_zero()) {
+                    bsl::print() << bsl::rst << bsl::fmt{"4d", free_kb} << " KB ";
+                }
+                else {
+                    bsl::print() << bsl::rst << bsl::fmt{"4d", free_mb} << " MB ";
+                }
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::endl;
+            }
+
+            /// Footer
+            ///
+
+            bsl::print() << bsl::ylw << "+----------------------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+        }
+    };
+}
+
+#endif
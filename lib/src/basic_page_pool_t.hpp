@@ -41,6 +41,7 @@
 #include <basic_page_pool_node_t.hpp>    // IWYU pragma: export
 #include <basic_spinlock_t.hpp>          // IWYU pragma: keep
 
+#include <bsl/array.hpp>
 #include <bsl/construct_at.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/cstring.hpp>
@@ -49,7 +50,9 @@
 #include <bsl/dontcare_t.hpp>
 #include <bsl/ensures.hpp>
 #include <bsl/expects.hpp>
+#include <bsl/is_constant_evaluated.hpp>
 #include <bsl/is_pod.hpp>
+#include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/span.hpp>
 #include <bsl/touch.hpp>
@@ -57,6 +60,9 @@
 
 namespace lib
 {
+    /// @brief defines the max number of pages the page pool grows by at a time
+    constexpr auto PAGE_POOL_GROW_PAGES{512_umx};
+
     /// <!-- description -->
     ///   @brief the basic_page_pool_t is responsible for allocating and freeing
     ///      pages. The loader provides a linked list with the pages that
@@ -64,6 +70,19 @@ namespace lib
     ///      direct map, so all virt to phys translations of allocated pages
     ///      can be done using simple arithmetic.
     ///
+    ///      The loader provides one linked list per NUMA node. Pages are
+    ///      allocated from the list that belongs to the PP's node (as
+    ///      stored in the TLS block), falling back to any other node
+    ///      when the local list is empty. Freed pages are returned to the
+    ///      list of the node they came from, which is found using the
+    ///      range of addresses each node gave to the pool, so that pages
+    ///      do not drift from one node to another over time.
+    ///
+    ///      The loader can also set aside a reserve of pages. The reserve is
+    ///      not part of the pool until every list is empty, at which point
+    ///      the pool grows by up to PAGE_POOL_GROW_PAGES pages at a time
+    ///      instead of failing the allocation.
+    ///
     /// <!-- template parameters -->
     ///   @tparam TLS_TYPE the type of TLS block to use
     ///   @tparam SYS_TYPE the type of bf_syscall_t to use
@@ -73,8 +92,24 @@ namespace lib
     template<typename TLS_TYPE, typename SYS_TYPE, bsl::uintmx MAP_ADDR, bsl::uintmx MAP_SIZE>
     class basic_page_pool_t final
     {
-        /// @brief stores the head of the basic_page_pool_t.
-        basic_page_pool_node_t *m_head{};
+        /// @brief stores the head of each NUMA node's list.
+        bsl::array<basic_page_pool_node_t *, HYPERVISOR_MAX_NUMA_NODES.get()> m_heads{};
+        /// @brief stores the number of free bytes on each NUMA node's list.
+        bsl::array<bsl::safe_umx, HYPERVISOR_MAX_NUMA_NODES.get()> m_free{};
+        /// @brief stores the lowest page address each NUMA node gave to the pool.
+        bsl::array<bsl::safe_umx, HYPERVISOR_MAX_NUMA_NODES.get()> m_lows{};
+        /// @brief stores the highest page address each NUMA node gave to the pool.
+        bsl::array<bsl::safe_umx, HYPERVISOR_MAX_NUMA_NODES.get()> m_highs{};
+        /// @brief stores the number of NUMA nodes given to the basic_page_pool_t.
+        bsl::safe_idx m_nodes{};
+        /// @brief stores the number of allocations served by a remote node.
+        bsl::safe_umx m_remote{};
+        /// @brief stores the head of the reserve's list.
+        basic_page_pool_node_t *m_reserve{};
+        /// @brief stores the number of bytes left in the reserve.
+        bsl::safe_umx m_reserve_free{};
+        /// @brief stores the number of times the pool grew from the reserve.
+        bsl::safe_umx m_grown{};
         /// @brief stores the total number of bytes given to the basic_page_pool_t.
         bsl::safe_umx m_size{};
         /// @brief stores the total number of bytes given to the basic_page_pool_t.
@@ -82,6 +117,157 @@ namespace lib
         /// @brief safe guards operations on the pool.
         mutable basic_spinlock_t m_lock{};
 
+        /// <!-- description -->
+        ///   @brief Returns the NUMA node of the PP that owns the provided
+        ///     TLS block. If the node is out of range, node 0 is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns the NUMA node of the PP that owns tls
+        ///
+        [[nodiscard]] constexpr auto
+        local_node(TLS_TYPE const &tls) const noexcept -> bsl::safe_idx
+        {
+            auto const node{bsl::to_idx(tls.numa_node)};
+            if (bsl::unlikely(node >= m_heads.size())) {
+                return {};
+            }
+
+            return node;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the NUMA node that the provided page should be
+        ///     returned to. This is the node whose range of addresses
+        ///     contains the page, starting with the local node in case the
+        ///     ranges of two nodes overlap. Pages that are not in any
+        ///     node's range (e.g., pages from the reserve) are returned to
+        ///     the local node.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of page to look up
+        ///   @param local the NUMA node of the current PP
+        ///   @param virt the virtual address of the page
+        ///   @return Returns the NUMA node that the page should be
+        ///     returned to
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        home_node(bsl::safe_idx const &local, T const *const virt) const noexcept -> bsl::safe_idx
+        {
+            /// NOTE:
+            /// - Addresses cannot be compared at compile-time, and the
+            ///   unit tests that run at compile-time only use one node's
+            ///   pages at a time, so the local node is used instead.
+            ///
+
+            if (bsl::is_constant_evaluated()) {
+                return local;
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto const addr{bsl::to_umx(reinterpret_cast<bsl::uintmx>(virt))};
+            if (this->in_node(local, addr)) {
+                return local;
+            }
+
+            for (bsl::safe_idx mut_i{}; mut_i < m_nodes; ++mut_i) {
+                if (this->in_node(mut_i, addr)) {
+                    return mut_i;
+                }
+
+                bsl::touch();
+            }
+
+            return local;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided address is inside of the
+        ///     range of addresses the provided NUMA node gave to the pool.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param node the NUMA node to check
+        ///   @param addr the address to check
+        ///   @return Returns true if addr is inside of the node's range
+        ///
+        [[nodiscard]] constexpr auto
+        in_node(bsl::safe_idx const &node, bsl::safe_umx const &addr) const noexcept -> bool
+        {
+            auto const high{*m_highs.at_if(node)};
+            if (high.is_zero()) {
+                return false;
+            }
+
+            return (addr >= *m_lows.at_if(node)) && (addr <= high);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the first NUMA node whose list is not empty. If
+        ///     all of the lists are empty, the provided node is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param node the node to return if all of the lists are empty
+        ///   @return Returns the first NUMA node whose list is not empty
+        ///
+        [[nodiscard]] constexpr auto
+        remote_node(bsl::safe_idx const &node) const noexcept -> bsl::safe_idx
+        {
+            for (bsl::safe_idx mut_i{}; mut_i < m_heads.size(); ++mut_i) {
+                if (nullptr != *m_heads.at_if(mut_i)) {
+                    return mut_i;
+                }
+
+                bsl::touch();
+            }
+
+            return node;
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves up to PAGE_POOL_GROW_PAGES pages from the reserve
+        ///     to the list of the provided NUMA node and returns the new
+        ///     head of that list. If the reserve is empty, a nullptr is
+        ///     returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param node the NUMA node to give the pages to
+        ///   @return Returns the new head of the node's list on success. On
+        ///     failure, a nullptr is returned.
+        ///
+        [[nodiscard]] constexpr auto
+        grow(bsl::safe_idx const &node) noexcept -> basic_page_pool_node_t *
+        {
+            if (nullptr == m_reserve) {
+                return nullptr;
+            }
+
+            auto *const pmut_head{m_reserve};
+            auto *pmut_mut_tail{m_reserve};
+            auto mut_pages{bsl::safe_umx::magic_1()};
+
+            while (mut_pages < PAGE_POOL_GROW_PAGES) {
+                if (nullptr == pmut_mut_tail->next) {
+                    break;
+                }
+
+                pmut_mut_tail = pmut_mut_tail->next;
+                ++mut_pages;
+            }
+
+            m_reserve = pmut_mut_tail->next;
+            pmut_mut_tail->next = nullptr;
+
+            auto const size{(mut_pages * HYPERVISOR_PAGE_SIZE).checked()};
+
+            m_reserve_free = (m_reserve_free - size).checked();
+            *m_free.at_if(node) += size;
+            m_size += size;
+            ++m_grown;
+
+            return pmut_head;
+        }
+
         /// <!-- description -->
         ///   @brief Converts a virtual address to a physical address.
         ///
@@ -156,19 +342,85 @@ namespace lib
 
     public:
         /// <!-- description -->
-        ///   @brief Creates the basic_page_pool_t given a mutable_buffer_t to
-        ///     the basic_page_pool_t as well as the virtual address base of the
-        ///     page pool which is used for virt to phys translations.
+        ///   @brief Gives the basic_page_pool_t the list of pages that belong
+        ///     to the provided NUMA node. Each node should only be given to
+        ///     the basic_page_pool_t once. Empty lists are ignored.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_pool the mutable_buffer_t of the basic_page_pool_t
+        ///   @param node the NUMA node the provided pages belong to
+        ///
+        constexpr void
+        initialize(
+            bsl::span<basic_page_pool_node_t> &mut_pool, bsl::safe_idx const &node = {}) noexcept
+        {
+            bsl::expects(node < m_heads.size());
+
+            if (mut_pool.empty()) {
+                return;
+            }
+
+            auto const size{(mut_pool.size() * HYPERVISOR_PAGE_SIZE).checked()};
+
+            *m_heads.at_if(node) = mut_pool.data();
+            *m_free.at_if(node) = size;
+            m_size = (m_size + size).checked();
+
+            if (!bsl::is_constant_evaluated()) {
+                auto *const pmut_low{m_lows.at_if(node)};
+                auto *const pmut_high{m_highs.at_if(node)};
+
+                *pmut_low = bsl::safe_umx::max_value();
+                for (auto const *mut_page{mut_pool.data()}; nullptr != mut_page;
+                     mut_page = mut_page->next) {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                    auto const addr{bsl::to_umx(reinterpret_cast<bsl::uintmx>(mut_page))};
+                    if (addr < *pmut_low) {
+                        *pmut_low = addr;
+                    }
+                    else {
+                        bsl::touch();
+                    }
+
+                    if (addr > *pmut_high) {
+                        *pmut_high = addr;
+                    }
+                    else {
+                        bsl::touch();
+                    }
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (node >= m_nodes) {
+                m_nodes = node;
+                ++m_nodes;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives the basic_page_pool_t a list of pages that it can
+        ///     grow into once every NUMA node's list is empty. The reserve
+        ///     should only be given to the basic_page_pool_t once. An empty
+        ///     reserve is ignored.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_reserve the list of pages to grow into
         ///
         constexpr void
-        initialize(bsl::span<basic_page_pool_node_t> &mut_pool) noexcept
+        initialize_reserve(bsl::span<basic_page_pool_node_t> &mut_reserve) noexcept
         {
-            m_head = mut_pool.data();
-            m_size = (mut_pool.size() * HYPERVISOR_PAGE_SIZE).checked();
-            m_used = {};
+            if (mut_reserve.empty()) {
+                return;
+            }
+
+            m_reserve = mut_reserve.data();
+            m_reserve_free = (mut_reserve.size() * HYPERVISOR_PAGE_SIZE).checked();
         }
 
         /// <!-- description -->
@@ -189,21 +441,50 @@ namespace lib
 
             basic_lock_guard_t mut_lock{tls, m_lock};
 
-            if (bsl::unlikely(nullptr == m_head)) {
-                m_head = helpers::add_to_page_pool(mut_sys);
-                if (bsl::unlikely(nullptr == m_head)) {
+            auto const local{this->local_node(tls)};
+            auto mut_node{local};
+
+            if (bsl::unlikely(nullptr == *m_heads.at_if(mut_node))) {
+                mut_node = this->remote_node(local);
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto *const pmut_head{m_heads.at_if(mut_node)};
+            auto *const pmut_free{m_free.at_if(mut_node)};
+
+            if (bsl::unlikely(nullptr == *pmut_head)) {
+                *pmut_head = this->grow(mut_node);
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (bsl::unlikely(nullptr == *pmut_head)) {
+                *pmut_head = helpers::add_to_page_pool(mut_sys);
+                if (bsl::unlikely(nullptr == *pmut_head)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return {};
                 }
 
                 m_size += HYPERVISOR_PAGE_SIZE;
+                *pmut_free += HYPERVISOR_PAGE_SIZE;
             }
             else {
                 bsl::touch();
             }
 
-            auto *const pmut_node{m_head};
-            m_head = m_head->next;
+            if (bsl::unlikely(mut_node != local)) {
+                ++m_remote;
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto *const pmut_node{*pmut_head};
+            *pmut_head = pmut_node->next;
+            *pmut_free -= HYPERVISOR_PAGE_SIZE;
             m_used += HYPERVISOR_PAGE_SIZE;
 
             /// NOTE:
@@ -254,11 +535,85 @@ namespace lib
             bsl::destroy_at(pmut_virt);
             auto *const pmut_node{bsl::construct_at<basic_page_pool_node_t>(pmut_virt)};
 
-            pmut_node->next = m_head;
-            m_head = pmut_node;
+            auto const node{this->home_node(this->local_node(tls), pmut_node)};
+            auto *const pmut_head{m_heads.at_if(node)};
+
+            pmut_node->next = *pmut_head;
+            *pmut_head = pmut_node;
+            *m_free.at_if(node) += HYPERVISOR_PAGE_SIZE;
             m_used -= HYPERVISOR_PAGE_SIZE;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns a batch of pages previously allocated using the
+        ///     allocate function to the basic_page_pool_t. The pages are
+        ///     linked into one list per NUMA node before the lock is
+        ///     acquired, so the lock is only held long enough to splice
+        ///     each resulting list into the list of the node that its pages
+        ///     came from, regardless of how large the batch is.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to deallocate
+        ///   @param tls the current TLS block
+        ///   @param virts the pointers to the pages to deallocate
+        ///
+        template<typename T>
+        constexpr void
+        deallocate_batch(TLS_TYPE const &tls, bsl::span<T *const> const &virts) noexcept
+        {
+            static_assert(bsl::is_pod<T>::value);
+            static_assert(sizeof(T) == HYPERVISOR_PAGE_SIZE);
+
+            if (virts.empty()) {
+                return;
+            }
+
+            bsl::array<basic_page_pool_node_t *, HYPERVISOR_MAX_NUMA_NODES.get()> mut_heads{};
+            bsl::array<basic_page_pool_node_t *, HYPERVISOR_MAX_NUMA_NODES.get()> mut_tails{};
+            bsl::array<bsl::safe_umx, HYPERVISOR_MAX_NUMA_NODES.get()> mut_bytes{};
+
+            auto const local{this->local_node(tls)};
+            for (bsl::safe_idx mut_i{}; mut_i < virts.size(); ++mut_i) {
+                auto *const pmut_virt{*virts.at_if(mut_i)};
+                bsl::expects(nullptr != pmut_virt);
+
+                bsl::destroy_at(pmut_virt);
+                auto *const pmut_node{bsl::construct_at<basic_page_pool_node_t>(pmut_virt)};
+
+                auto const node{this->home_node(local, pmut_node)};
+                auto *const pmut_batch_head{mut_heads.at_if(node)};
+                auto *const pmut_batch_tail{mut_tails.at_if(node)};
+
+                if (nullptr == *pmut_batch_tail) {
+                    *pmut_batch_tail = pmut_node;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                pmut_node->next = *pmut_batch_head;
+                *pmut_batch_head = pmut_node;
+                *mut_bytes.at_if(node) += HYPERVISOR_PAGE_SIZE;
+            }
+
+            basic_lock_guard_t mut_lock{tls, m_lock};
+
+            for (bsl::safe_idx mut_i{}; mut_i < mut_heads.size(); ++mut_i) {
+                auto *const pmut_batch_tail{*mut_tails.at_if(mut_i)};
+                if (nullptr == pmut_batch_tail) {
+                    continue;
+                }
+
+                auto *const pmut_head{m_heads.at_if(mut_i)};
+                auto const bytes{mut_bytes.at_if(mut_i)->checked()};
+
+                pmut_batch_tail->next = *pmut_head;
+                *pmut_head = *mut_heads.at_if(mut_i);
+                *m_free.at_if(mut_i) += bytes;
+                m_used -= bytes;
+            }
+        }
+
         /// <!-- description -->
         ///   @brief Returns the number of bytes in the pool.
         ///
@@ -433,6 +788,67 @@ namespace lib
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::endl;
 
+            /// Remote
+            ///
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<23s", "remote allocs "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"4d", m_remote} << "    ";
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Reserve
+            ///
+
+            auto const reserve_kb{(m_reserve_free / kb).checked()};
+            auto const reserve_mb{(m_reserve_free / mb).checked()};
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<23s", "reserve "};
+            bsl::print() << bsl::ylw << "| ";
+            if (reserve_mb.is_zero()) {
+                bsl::print() << bsl::rst << bsl::fmt{"4d", reserve_kb} << " KB ";
+            }
+            else {
+                bsl::print() << bsl::rst << bsl::fmt{"4d", reserve_mb} << " MB ";
+            }
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Grown
+            ///
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<23s", "times grown "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"4d", m_grown} << "    ";
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Per Node
+            ///
+
+            for (bsl::safe_idx mut_i{}; mut_i < m_nodes; ++mut_i) {
+                auto const free{*m_free.at_if(mut_i)};
+                auto const free_kb{(free / kb).checked()};
+                auto const free_mb{(free / mb).checked()};
+
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << "node ";
+                bsl::print() << bsl::rst << bsl::fmt{"<2d", bsl::to_u64(mut_i)};
+                bsl::print() << bsl::rst << bsl::fmt{"<16s", "remaining "};
+                bsl::print() << bsl::ylw << "| ";
+                if (free_mb.is_zero()) {
+                    bsl::print() << bsl::rst << bsl::fmt{"4d", free_kb} << " KB ";
+                }
+                else {
+                    bsl::print() << bsl::rst << bsl::fmt{"4d", free_mb} << " MB ";
+                }
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::endl;
+            }
+
             /// Footer
             ///
 
@@ -53,25 +53,37 @@
 #include <basic_page_table_t.hpp>
 #include <basic_spinlock_t.hpp>    // IWYU pragma: keep
 
+#include <bsl/array.hpp>
 #include <bsl/construct_at.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
 #include <bsl/dontcare_t.hpp>
 #include <bsl/ensures.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/expects.hpp>
 #include <bsl/finally.hpp>
+#include <bsl/is_constant_evaluated.hpp>
 #include <bsl/is_one_of.hpp>
 #include <bsl/is_pod.hpp>
 #include <bsl/is_same.hpp>
 #include <bsl/remove_const.hpp>
 #include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
 #include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace lib
 {
+    /// @brief defines the max number of pages reclaim() releases per call
+    constexpr auto RPT_RECLAIM_BATCH_PAGES{64_umx};
+    /// @brief defines the max number of tables of each type that can be
+    ///   waiting for in-flight queries to finish before being released
+    constexpr auto RPT_RETIRE_TABLES{8_umx};
+    /// @brief defines the number of epochs queries are counted against
+    constexpr auto RPT_QUERY_EPOCHS{2_umx};
+
     /// <!-- description -->
     ///   @brief Implements an interface to a root page table. The root page
     ///     table (RPT) is the highest level page table, and provides an
@@ -212,12 +224,65 @@ namespace lib
         /// @brief define the type entries_t to use
         using entries_t = basic_entries_t<L3E_TYPE, L2E_TYPE, L1E_TYPE, L0E_TYPE>;
 
+        /// @brief stores a list of same-typed pages for reclaim() to release
+        template<typename T, bsl::uintmx N = RPT_RECLAIM_BATCH_PAGES.get()>
+        struct reclaim_list_t final
+        {
+            /// @brief stores the pages to release
+            bsl::array<T *, N> virts;
+            /// @brief stores the number of pages in virts
+            bsl::safe_umx size;
+        };
+
+        /// @brief stores the pages a single call to reclaim() releases
+        struct reclaim_batch_t final
+        {
+            /// @brief stores the l2ts to release
+            reclaim_list_t<l2t_t> l2ts;
+            /// @brief stores the l1ts to release
+            reclaim_list_t<l1t_t> l1ts;
+            /// @brief stores the l0ts to release
+            reclaim_list_t<l0t_t> l0ts;
+            /// @brief stores the auto_release pages to release
+            reclaim_list_t<basic_page_4k_t> pages;
+            /// @brief stores the total number of pages in the batch
+            bsl::safe_umx size;
+        };
+
+        /// @brief stores the tables that were removed from the RPT while
+        ///   a query might still have been walking them
+        struct retired_tables_t final
+        {
+            /// @brief stores the retired l2ts
+            reclaim_list_t<l2t_t, RPT_RETIRE_TABLES.get()> l2ts;
+            /// @brief stores the retired l1ts
+            reclaim_list_t<l1t_t, RPT_RETIRE_TABLES.get()> l1ts;
+            /// @brief stores the retired l0ts
+            reclaim_list_t<l0t_t, RPT_RETIRE_TABLES.get()> l0ts;
+            /// @brief stores the total number of retired tables
+            bsl::safe_umx size;
+        };
+
         /// @brief stores a pointer to the l3t
         l3t_t *m_l3t{};
         /// @brief stores the physical address of the l3t
         bsl::safe_umx m_l3t_spa{};
         /// @brief safe guards operations on the RPT.
         mutable basic_spinlock_t m_lock{};
+        /// @brief stores the number of queries walking the RPT, per epoch
+        bsl::array<bsl::uintmx, RPT_QUERY_EPOCHS.get()> m_queries{};
+        /// @brief stores the epoch new queries are counted against
+        bsl::uintmx m_epoch{};
+        /// @brief stores the tables waiting for in-flight queries to finish
+        retired_tables_t m_retired{};
+        /// @brief stores whether map() is allowed to promote tables
+        bool m_promote{};
+        /// @brief stores whether map() is allowed to create 1G blocks
+        bool m_promote_1g{};
+        /// @brief stores whether unmap() leaves releasing memory to the caller
+        bool m_defer_release{};
+        /// @brief stores whether retired tables are held until flushed()
+        bool m_hold_retired{};
 
         /// <!-- description -->
         ///   @brief Returns reserved if the entry is marked as an alias.
@@ -242,6 +307,92 @@ namespace lib
             return helpers::entry_status(pudm_entry);
         }
 
+        /// <!-- description -->
+        ///   @brief Returns a copy of the provided entry, read with a single
+        ///     acquire load. Queries walk the RPT without m_lock, so each
+        ///     entry has to be read all at once, and anything the entry
+        ///     points to has to be read after the entry itself.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to load
+        ///   @param entry the entry to load
+        ///   @return Returns a copy of the provided entry
+        ///
+        template<typename E>
+        [[nodiscard]] static constexpr auto
+        load_entry(E const *const entry) noexcept -> E
+        {
+            bsl::expects(nullptr != entry);
+
+            if (bsl::is_constant_evaluated()) {
+                return *entry;
+            }
+
+            E mut_ret{};
+            __atomic_load(entry, &mut_ret, __ATOMIC_ACQUIRE);
+            return mut_ret;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes the provided value to an entry with a single
+        ///     release store. Entries are always built on the stack and
+        ///     then stored using this function so that a query never sees
+        ///     a partially written entry, or an entry that points to a
+        ///     table whose contents are not yet visible.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to store
+        ///   @param pmut_entry the entry to store to
+        ///   @param val the value to store
+        ///
+        template<typename E>
+        static constexpr void
+        store_entry(E *const pmut_entry, E const &val) noexcept
+        {
+            bsl::expects(nullptr != pmut_entry);
+
+            if (bsl::is_constant_evaluated()) {
+                *pmut_entry = val;
+                return;
+            }
+
+            E mut_val{val};
+            __atomic_store(pmut_entry, &mut_val, __ATOMIC_RELEASE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Replaces an entry with the provided value using a single
+        ///     compare and exchange, but only if the entry still matches
+        ///     mut_old. This is used to change an entry that the CPU might
+        ///     be writing to at the same time (i.e., to set the accessed
+        ///     and dirty bits), so that those writes are never lost. If the
+        ///     entry no longer matches, mut_old is updated with what the
+        ///     entry holds now.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to exchange
+        ///   @param pmut_entry the entry to exchange
+        ///   @param mut_old the value the entry is expected to hold
+        ///   @param val the value to store
+        ///   @return Returns true if the entry was replaced. Returns false
+        ///     if the entry no longer matched mut_old.
+        ///
+        template<typename E>
+        [[nodiscard]] static constexpr auto
+        exchange_entry(E *const pmut_entry, E &mut_old, E const &val) noexcept -> bool
+        {
+            bsl::expects(nullptr != pmut_entry);
+
+            if (bsl::is_constant_evaluated()) {
+                *pmut_entry = val;
+                return true;
+            }
+
+            E mut_val{val};
+            return __atomic_compare_exchange(
+                pmut_entry, &mut_old, &mut_val, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+        }
+
         /// <!-- description -->
         ///   @brief Returns the level-3 table (L3T) offset given a
         ///     virtual address.
@@ -475,18 +626,23 @@ namespace lib
             bsl::expects(mut_table_phys.is_valid_and_checked());
             bsl::expects(mut_table_phys.is_pos());
 
-            pmut_entry->auto_release = bsl::safe_u64::magic_0().get();
-            pmut_entry->points_to_block = bsl::safe_u64::magic_0().get();
-            pmut_entry->alias = bsl::safe_u64::magic_0().get();
-            pmut_entry->phys = (mut_table_phys >> BASIC_PAGE_4K_T_SHFT).get();
-            pmut_entry->explicit_unmap = bsl::safe_u64::magic_0().get();
-            helpers::configure_entry_as_ptr_to_table(pmut_entry);
+            E mut_entry{*pmut_entry};
+            mut_entry.auto_release = bsl::safe_u64::magic_0().get();
+            mut_entry.points_to_block = bsl::safe_u64::magic_0().get();
+            mut_entry.alias = bsl::safe_u64::magic_0().get();
+            mut_entry.phys = (mut_table_phys >> BASIC_PAGE_4K_T_SHFT).get();
+            mut_entry.explicit_unmap = bsl::safe_u64::magic_0().get();
+            helpers::configure_entry_as_ptr_to_table(&mut_entry);
 
+            store_entry(pmut_entry, mut_entry);
             return pmut_table;
         }
 
         /// <!-- description -->
-        ///   @brief Given a table, recursively deallocates the table.
+        ///   @brief Given a table, recursively releases the table's entries.
+        ///     The table itself is not deallocated, as it is still linked
+        ///     into the RPT. It is up to the caller to unlink the table and
+        ///     then retire it if this function returns true.
         ///
         /// <!-- inputs/outputs -->
         ///   @tparam T the type of table to release
@@ -499,7 +655,7 @@ namespace lib
         ///     false otherwise.
         ///
         template<typename T>
-        [[maybe_unused]] static constexpr auto
+        [[maybe_unused]] constexpr auto
         release_table(
             TLS_TYPE const &tls,
             PAGE_POOL_TYPE &mut_page_pool,
@@ -510,7 +666,7 @@ namespace lib
 
             for (bsl::safe_idx mut_i{}; mut_i < pmut_table->entries.size(); ++mut_i) {
                 auto *const pmut_entry{pmut_table->entries.at_if(mut_i)};
-                if (!release_entry(tls, mut_page_pool, pmut_entry, cleanup)) {
+                if (!this->release_entry(tls, mut_page_pool, pmut_entry, cleanup)) {
                     mut_empty = false;
                     break;
                 }
@@ -518,12 +674,7 @@ namespace lib
                 bsl::touch();
             }
 
-            if (!mut_empty) {
-                return false;
-            }
-
-            mut_page_pool.deallocate(tls, pmut_table);
-            return true;
+            return mut_empty;
         }
 
         /// <!-- description -->
@@ -615,7 +766,7 @@ namespace lib
                 }
             }
 
-            *pmut_entry = {};
+            store_entry(pmut_entry, {});
             return true;
         }
 
@@ -635,15 +786,13 @@ namespace lib
         ///     or table. Returns false otherwise.
         ///
         template<typename E>
-        [[maybe_unused]] static constexpr auto
+        [[maybe_unused]] constexpr auto
         release_entry_to_table(
             TLS_TYPE const &tls,
             PAGE_POOL_TYPE &mut_page_pool,
             E *const pmut_entry,
             bool const cleanup) noexcept -> bool
         {
-            bool mut_empty{};
-
             /// NOTE:
             /// - There are two different ways that this function could be
             ///   called, cleanup is true or false.
@@ -661,34 +810,42 @@ namespace lib
             ///   cleanup empty tables. This will be the case for when the
             ///   unmap() and map() functions are called (with map only
             ///   calling this function on error). If the table is empty, it
-            ///   will tell us, in which case we are free to deallocate the
-            ///   table and mark the entry as 0. This will allow the parent
+            ///   will tell us, in which case we are free to mark the entry
+            ///   as 0 and retire the table. This will allow the parent
             ///   table to cleanup itself if it is also empty now that it's
             ///   child has be released. If any entry is still marked present
             ///   no cleanup will occur.
             ///
+            /// - The entry is marked as 0 before the table is retired. Once
+            ///   the entry is 0, a new query can no longer find the table,
+            ///   so the only queries that might still be reading it are the
+            ///   ones that are already in flight, which is what
+            ///   retire_table() waits on.
+            ///
+            /// - If set_hold_retired() was used, an empty table is only
+            ///   unlinked if there is room to hold it until flushed() is
+            ///   called. Otherwise it is left in place, just like a table
+            ///   that still has entries in it.
+            ///
 
-            if constexpr (bsl::is_same<E, L3E_TYPE>::value) {
-                mut_empty = release_table(
-                    tls, mut_page_pool, entry_to_table(mut_page_pool, pmut_entry), cleanup);
-            }
+            if constexpr (bsl::is_one_of<E, L3E_TYPE, L2E_TYPE, L1E_TYPE>::value) {
+                if (!cleanup && m_hold_retired && this->is_retired_full()) {
+                    return false;
+                }
 
-            if constexpr (bsl::is_same<E, L2E_TYPE>::value) {
-                mut_empty = release_table(
-                    tls, mut_page_pool, entry_to_table(mut_page_pool, pmut_entry), cleanup);
-            }
+                auto *const pmut_table{entry_to_table(mut_page_pool, pmut_entry)};
+                if (!this->release_table(tls, mut_page_pool, pmut_table, cleanup)) {
+                    return false;
+                }
 
-            if constexpr (bsl::is_same<E, L1E_TYPE>::value) {
-                mut_empty = release_table(
-                    tls, mut_page_pool, entry_to_table(mut_page_pool, pmut_entry), cleanup);
-            }
+                store_entry(pmut_entry, {});
+                this->retire_table(tls, mut_page_pool, pmut_table);
 
-            if (!mut_empty) {
+                return true;
+            }
+            else {
                 return false;
             }
-
-            *pmut_entry = {};
-            return true;
         }
 
         /// <!-- description -->
@@ -707,7 +864,7 @@ namespace lib
         ///     or table. Returns false otherwise.
         ///
         template<typename E>
-        [[maybe_unused]] static constexpr auto
+        [[maybe_unused]] constexpr auto
         release_entry(
             TLS_TYPE const &tls,
             PAGE_POOL_TYPE &mut_page_pool,
@@ -742,196 +899,435 @@ namespace lib
                 bsl::touch();
             }
 
-            return release_entry_to_table(tls, mut_page_pool, pmut_entry, cleanup);
+            return this->release_entry_to_table(tls, mut_page_pool, pmut_entry, cleanup);
         }
 
         /// <!-- description -->
-        ///   @brief Returns all of the entries that are identified during the
-        ///     translation of the provided virtual address.
+        ///   @brief Marks the start of a query that walks the RPT without
+        ///     m_lock. Until query_end() is called, no table that is removed
+        ///     from the RPT will be returned to the page pool.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param mut_page_pool the page_pool_t to use
-        ///   @param page_virt the virtual address to decode
-        ///   @return Returns all of the entries that are identified during the
-        ///     translation of the provided virtual address.
+        ///   @return Returns the epoch the query was counted against, which
+        ///     must be given to query_end().
         ///
         [[nodiscard]] constexpr auto
-        get_4k_for_query(PAGE_POOL_TYPE &mut_page_pool, bsl::safe_u64 const &page_virt) noexcept
-            -> entries_t
+        query_begin() noexcept -> bsl::safe_idx
         {
-            entries_t mut_ret{};
-            l2t_t *pmut_mut_l2t{};
-            l1t_t *pmut_mut_l1t{};
-            l0t_t *pmut_mut_l0t{};
+            if (bsl::is_constant_evaluated()) {
+                return {};
+            }
 
-            // -----------------------------------------------------------------
-            // Get L3 Entry
-            // -----------------------------------------------------------------
+            auto const epoch{bsl::to_idx(__atomic_load_n(&m_epoch, __ATOMIC_ACQUIRE))};
+            auto *const pmut_queries{m_queries.at_if(epoch)};
 
-            mut_ret.l3e = m_l3t->entries.at_if(virt_to_l3to(page_virt));
-            switch (entry_status(mut_ret.l3e)) {
-                case basic_entry_status_t::not_present: {
-                    bsl::error() << "l3t_t entry for the virtual address "    // --
-                                 << bsl::hex(page_virt)                       // --
-                                 << " is not marked present"                  // --
-                                 << bsl::endl                                 // --
-                                 << bsl::here();                              // --
+            bsl::discard(
+                __atomic_add_fetch(pmut_queries, bsl::safe_umx::magic_1().get(), __ATOMIC_SEQ_CST));
 
-                    break;
-                }
+            return epoch;
+        }
 
-                case basic_entry_status_t::present: {
-                    pmut_mut_l2t = entry_to_table(mut_page_pool, mut_ret.l3e);
-                    break;
-                }
+        /// <!-- description -->
+        ///   @brief Marks the end of a query started with query_begin().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param epoch the epoch returned by query_begin()
+        ///
+        constexpr void
+        query_end(bsl::safe_idx const &epoch) noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                return;
+            }
 
-                case basic_entry_status_t::reserved:
-                    [[fallthrough]];
-                default: {
-                    bsl::error() << "l3t_t entry for the virtual address "             // --
-                                 << bsl::hex(page_virt)                                // --
-                                 << " is not marked reserved and cannot be queried"    // --
-                                 << bsl::endl                                          // --
-                                 << bsl::here();                                       // --
+            auto *const pmut_queries{m_queries.at_if(epoch)};
 
-                    break;
-                }
-            }
+            bsl::discard(
+                __atomic_sub_fetch(pmut_queries, bsl::safe_umx::magic_1().get(), __ATOMIC_RELEASE));
+        }
 
-            if (bsl::unlikely(nullptr == pmut_mut_l2t)) {
-                return {};
+        /// <!-- description -->
+        ///   @brief Returns true if no query is walking the RPT. If this
+        ///     returns true, any table that was unlinked from the RPT before
+        ///     this function was called can no longer be reached by a query
+        ///     and is safe to return to the page pool.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if no query is walking the RPT
+        ///
+        [[nodiscard]] constexpr auto
+        is_quiescent() const noexcept -> bool
+        {
+            if (bsl::is_constant_evaluated()) {
+                return true;
             }
 
-            // -----------------------------------------------------------------
-            // Get L2 Entry
-            // -----------------------------------------------------------------
+            /// NOTE:
+            /// - The fence orders the store that unlinked the table before
+            ///   the loads of m_queries. Together with the SEQ_CST increment
+            ///   in query_begin(), this ensures that either we see the
+            ///   query, or the query sees the unlinked entry.
+            ///
 
-            mut_ret.l2e = pmut_mut_l2t->entries.at_if(virt_to_l2to(page_virt));
-            switch (entry_status(mut_ret.l2e)) {
-                case basic_entry_status_t::not_present: {
-                    bsl::error() << "l2t_t entry for the virtual address "    // --
-                                 << bsl::hex(page_virt)                       // --
-                                 << " is not marked present"                  // --
-                                 << bsl::endl                                 // --
-                                 << bsl::here();                              // --
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
 
-                    break;
+            for (bsl::safe_idx mut_i{}; mut_i < m_queries.size(); ++mut_i) {
+                auto const *const queries{m_queries.at_if(mut_i)};
+                if (!bsl::to_umx(__atomic_load_n(queries, __ATOMIC_ACQUIRE)).is_zero()) {
+                    return false;
                 }
 
-                case basic_entry_status_t::present: {
-                    if (bsl::safe_u64::magic_0() == mut_ret.l2e->points_to_block) {
-                        pmut_mut_l1t = entry_to_table(mut_page_pool, mut_ret.l2e);
-                        break;
-                    }
+                bsl::touch();
+            }
 
-                    bsl::error() << "l2t_t entry for the virtual address "    // --
-                                 << bsl::hex(page_virt)                       // --
-                                 << " was mapped as an entry, not a table"    // --
-                                 << bsl::endl                                 // --
-                                 << bsl::here();                              // --
+            return true;
+        }
 
-                    break;
-                }
+        /// <!-- description -->
+        ///   @brief Waits until every query that was in flight when this
+        ///     function was called has finished. Only a writer holding
+        ///     m_lock (or the owner of an RPT that can no longer be
+        ///     queried) may call this function.
+        ///
+        constexpr void
+        synchronize() noexcept
+        {
+            if (this->is_quiescent()) {
+                return;
+            }
 
-                case basic_entry_status_t::reserved:
-                    [[fallthrough]];
-                default: {
-                    bsl::error() << "l2t_t entry for the virtual address "             // --
-                                 << bsl::hex(page_virt)                                // --
-                                 << " is not marked reserved and cannot be queried"    // --
-                                 << bsl::endl                                          // --
-                                 << bsl::here();                                       // --
+            /// NOTE:
+            /// - Waiting for a single count of in-flight queries to reach
+            ///   0 could take forever if PPs keep starting new queries. So
+            ///   instead, queries are counted against the current epoch. We
+            ///   flip the epoch, so that new queries are counted against the
+            ///   other count, and only wait for the old count to drain.
+            /// - A query that read the epoch right before a previous flip
+            ///   might have added itself to what is now the current count,
+            ///   so waiting on the old count alone is not enough. Flipping
+            ///   twice (the same as SRCU) waits on both counts, while still
+            ///   only waiting on queries that started before each flip.
+            ///
 
-                    break;
+            for (bsl::safe_idx mut_i{}; mut_i < m_queries.size(); ++mut_i) {
+                auto const old{bsl::to_umx(__atomic_load_n(&m_epoch, __ATOMIC_RELAXED))};
+                auto const next{(old ^ bsl::safe_umx::magic_1()).checked()};
+
+                __atomic_store_n(&m_epoch, next.get(), __ATOMIC_SEQ_CST);
+
+                auto const *const queries{m_queries.at_if(bsl::to_idx(old))};
+                while (!bsl::to_umx(__atomic_load_n(queries, __ATOMIC_ACQUIRE)).is_zero()) {
+                    bsl::touch();
                 }
             }
+        }
 
-            if (bsl::unlikely(nullptr == pmut_mut_l1t)) {
-                return {};
+        /// <!-- description -->
+        ///   @brief Returns all of the retired tables to the page pool. The
+        ///     caller must ensure that the RPT is quiescent.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///
+        constexpr void
+        release_retired(TLS_TYPE const &tls, PAGE_POOL_TYPE &mut_page_pool) noexcept
+        {
+            if (m_retired.size.is_zero()) {
+                return;
             }
 
-            // -----------------------------------------------------------------
-            // Get L1 Entry
-            // -----------------------------------------------------------------
+            release_list(tls, mut_page_pool, m_retired.l0ts);
+            release_list(tls, mut_page_pool, m_retired.l1ts);
+            release_list(tls, mut_page_pool, m_retired.l2ts);
 
-            mut_ret.l1e = pmut_mut_l1t->entries.at_if(virt_to_l1to(page_virt));
-            switch (entry_status(mut_ret.l1e)) {
-                case basic_entry_status_t::not_present: {
-                    bsl::error() << "l1t_t entry for the virtual address "    // --
-                                 << bsl::hex(page_virt)                       // --
-                                 << " is not marked present"                  // --
-                                 << bsl::endl                                 // --
-                                 << bsl::here();                              // --
+            m_retired = {};
+        }
 
-                    break;
-                }
+        /// <!-- description -->
+        ///   @brief Returns true if any of the retired lists is full,
+        ///     meaning retire_table() might not be able to hold on to
+        ///     another table.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if any of the retired lists is full.
+        ///     Returns false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        is_retired_full() const noexcept -> bool
+        {
+            if (m_retired.l2ts.size >= RPT_RETIRE_TABLES) {
+                return true;
+            }
 
-                case basic_entry_status_t::present: {
-                    if (bsl::safe_u64::magic_0() == mut_ret.l1e->points_to_block) {
-                        pmut_mut_l0t = entry_to_table(mut_page_pool, mut_ret.l1e);
-                        break;
-                    }
+            if (m_retired.l1ts.size >= RPT_RETIRE_TABLES) {
+                return true;
+            }
 
-                    bsl::error() << "l1t_t entry for the virtual address "    // --
-                                 << bsl::hex(page_virt)                       // --
-                                 << " was mapped as an entry, not a table"    // --
-                                 << bsl::endl                                 // --
-                                 << bsl::here();                              // --
+            return m_retired.l0ts.size >= RPT_RETIRE_TABLES;
+        }
 
-                    break;
-                }
+        /// <!-- description -->
+        ///   @brief Given a table that has already been unlinked from the
+        ///     RPT, returns the table to the page pool. If a query might
+        ///     still be walking the table, or set_hold_retired() was used,
+        ///     the table is added to the retired list instead, and is
+        ///     returned to the page pool by a later writer once the RPT is
+        ///     quiescent (or by flushed()). If the retired list is full,
+        ///     this function waits for the in-flight queries to finish
+        ///     instead, which only happens with set_hold_retired() when the
+        ///     RPT is being released.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of table to retire
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param pmut_table the table to retire
+        ///
+        template<typename T>
+        constexpr void
+        retire_table(
+            TLS_TYPE const &tls, PAGE_POOL_TYPE &mut_page_pool, T *const pmut_table) noexcept
+        {
+            static_assert(bsl::is_one_of<T, l2t_t, l1t_t, l0t_t>::value);
+            reclaim_list_t<T, RPT_RETIRE_TABLES.get()> *pmut_mut_list{};
 
-                case basic_entry_status_t::reserved:
-                    [[fallthrough]];
-                default: {
-                    bsl::error() << "l1t_t entry for the virtual address "             // --
-                                 << bsl::hex(page_virt)                                // --
-                                 << " is not marked reserved and cannot be queried"    // --
-                                 << bsl::endl                                          // --
-                                 << bsl::here();                                       // --
+            if constexpr (bsl::is_same<T, l2t_t>::value) {
+                pmut_mut_list = &m_retired.l2ts;
+            }
 
-                    break;
-                }
+            if constexpr (bsl::is_same<T, l1t_t>::value) {
+                pmut_mut_list = &m_retired.l1ts;
             }
 
-            if (bsl::unlikely(nullptr == pmut_mut_l0t)) {
-                return {};
+            if constexpr (bsl::is_same<T, l0t_t>::value) {
+                pmut_mut_list = &m_retired.l0ts;
             }
 
-            // -----------------------------------------------------------------
-            // Get L0 Entry
-            // -----------------------------------------------------------------
+            if (m_hold_retired || !this->is_quiescent()) {
+                if (pmut_mut_list->size < RPT_RETIRE_TABLES) {
+                    *pmut_mut_list->virts.at_if(bsl::to_idx(pmut_mut_list->size)) = pmut_table;
+                    ++pmut_mut_list->size;
+                    ++m_retired.size;
+                    return;
+                }
 
-            mut_ret.l0e = pmut_mut_l0t->entries.at_if(virt_to_l0to(page_virt));
-            switch (entry_status(mut_ret.l0e)) {
-                case basic_entry_status_t::not_present: {
-                    bsl::error() << "l0t_t entry for the virtual address "    // --
-                                 << bsl::hex(page_virt)                       // --
-                                 << " is not marked present"                  // --
-                                 << bsl::endl                                 // --
-                                 << bsl::here();                              // --
+                this->synchronize();
+            }
+            else {
+                bsl::touch();
+            }
 
-                    break;
+            this->release_retired(tls, mut_page_pool);
+            mut_page_pool.deallocate(tls, pmut_table);
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a page to a reclaim batch. If the batch is full,
+        ///     the page is not added and false is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of page to add
+        ///   @param mut_batch the batch to add the page to
+        ///   @param pmut_virt the page to add
+        ///   @return Returns true if the page was added to the batch.
+        ///     Returns false if the batch is full.
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        add_to_batch(reclaim_batch_t &mut_batch, T *const pmut_virt) noexcept -> bool
+        {
+            if (mut_batch.size >= RPT_RECLAIM_BATCH_PAGES) {
+                return false;
+            }
+
+            reclaim_list_t<T> *pmut_mut_list{};
+
+            if constexpr (bsl::is_same<T, l2t_t>::value) {
+                pmut_mut_list = &mut_batch.l2ts;
+            }
+
+            if constexpr (bsl::is_same<T, l1t_t>::value) {
+                pmut_mut_list = &mut_batch.l1ts;
+            }
+
+            if constexpr (bsl::is_same<T, l0t_t>::value) {
+                pmut_mut_list = &mut_batch.l0ts;
+            }
+
+            if constexpr (bsl::is_same<T, basic_page_4k_t>::value) {
+                pmut_mut_list = &mut_batch.pages;
+            }
+
+            *pmut_mut_list->virts.at_if(bsl::to_idx(pmut_mut_list->size)) = pmut_virt;
+            ++pmut_mut_list->size;
+            ++mut_batch.size;
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns all of the pages in a reclaim list to the
+        ///     page pool using a single call to deallocate_batch().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pages in the list
+        ///   @tparam N the max number of pages in the list
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param list the list of pages to return to the page pool
+        ///
+        template<typename T, bsl::uintmx N>
+        static constexpr void
+        release_list(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            reclaim_list_t<T, N> const &list) noexcept
+        {
+            mut_page_pool.template deallocate_batch<T>(
+                tls, bsl::span<T *const>{list.virts.data(), list.size});
+        }
+
+        /// <!-- description -->
+        ///   @brief Given an entry that points to a block, adds the block to
+        ///     the reclaim batch if it is an auto_release 4k page and zeros
+        ///     the entry. Just like release(), entries marked as
+        ///     explicit_unmap are left in place.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to reclaim
+        ///   @param page_pool the page_pool_t to use
+        ///   @param mut_batch the batch to add the block to
+        ///   @param pmut_entry the entry that points to the block to reclaim
+        ///   @return Returns false if the batch filled up before the entry
+        ///     could be reclaimed. Returns true otherwise.
+        ///
+        template<typename E>
+        [[nodiscard]] static constexpr auto
+        reclaim_entry_to_block(
+            PAGE_POOL_TYPE const &page_pool,
+            reclaim_batch_t &mut_batch,
+            E *const pmut_entry) noexcept -> bool
+        {
+            if (bsl::safe_u64::magic_1() == pmut_entry->explicit_unmap) {
+                return true;
+            }
+
+            if constexpr (bsl::is_same<E, L0E_TYPE>::value) {
+                if (bsl::safe_u64::magic_1() == pmut_entry->auto_release) {
+                    if (!add_to_batch(mut_batch, entry_to_block(page_pool, pmut_entry))) {
+                        return false;
+                    }
+
+                    bsl::touch();
+                }
+                else {
+                    bsl::touch();
                 }
+            }
 
-                case basic_entry_status_t::present: {
-                    return mut_ret;
+            store_entry(pmut_entry, {});
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Given an entry that points to a table, reclaims each
+        ///     entry in the table, and if the table ends up empty, adds the
+        ///     table to the reclaim batch and zeros the entry. If the batch
+        ///     fills up part way through, everything reclaimed so far has
+        ///     already been zero'd, so the next call to reclaim() simply
+        ///     picks up where this one left off.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to reclaim
+        ///   @param page_pool the page_pool_t to use
+        ///   @param mut_batch the batch to add the table to
+        ///   @param pmut_entry the entry that points to the table to reclaim
+        ///   @return Returns false if the batch filled up before the entry
+        ///     could be reclaimed. Returns true otherwise.
+        ///
+        template<typename E>
+        [[nodiscard]] static constexpr auto
+        reclaim_entry_to_table(
+            PAGE_POOL_TYPE const &page_pool,
+            reclaim_batch_t &mut_batch,
+            E *const pmut_entry) noexcept -> bool
+        {
+            bool mut_empty{true};
+            auto *const pmut_table{entry_to_table(page_pool, pmut_entry)};
+
+            for (bsl::safe_idx mut_i{}; mut_i < pmut_table->entries.size(); ++mut_i) {
+                auto *const pmut_child{pmut_table->entries.at_if(mut_i)};
+                if (!reclaim_entry(page_pool, mut_batch, pmut_child)) {
+                    return false;
                 }
 
-                case basic_entry_status_t::reserved:
-                    [[fallthrough]];
-                default: {
-                    bsl::error() << "l0t_t entry for the virtual address "             // --
-                                 << bsl::hex(page_virt)                                // --
-                                 << " is not marked reserved and cannot be queried"    // --
-                                 << bsl::endl                                          // --
-                                 << bsl::here();                                       // --
+                if (basic_entry_status_t::present == entry_status(pmut_child)) {
+                    mut_empty = false;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
 
-                    break;
+            if (!mut_empty) {
+                return true;
+            }
+
+            if (!add_to_batch(mut_batch, pmut_table)) {
+                return false;
+            }
+
+            store_entry(pmut_entry, {});
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Given an entry, calls reclaim_entry_to_block if the
+        ///     entry points to a block and calls reclaim_entry_to_table if
+        ///     the entry points to a table.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to reclaim
+        ///   @param page_pool the page_pool_t to use
+        ///   @param mut_batch the batch to add the entry's memory to
+        ///   @param pmut_entry the entry to reclaim
+        ///   @return Returns false if the batch filled up before the entry
+        ///     could be reclaimed. Returns true otherwise.
+        ///
+        template<typename E>
+        [[nodiscard]] static constexpr auto
+        reclaim_entry(
+            PAGE_POOL_TYPE const &page_pool,
+            reclaim_batch_t &mut_batch,
+            E *const pmut_entry) noexcept -> bool
+        {
+            if (entry_status(pmut_entry) != basic_entry_status_t::present) {
+                return true;
+            }
+
+            if constexpr (bsl::is_same<E, L2E_TYPE>::value) {
+                if (bsl::safe_u64::magic_1() == pmut_entry->points_to_block) {
+                    return reclaim_entry_to_block(page_pool, mut_batch, pmut_entry);
+                }
+
+                bsl::touch();
+            }
+
+            if constexpr (bsl::is_same<E, L1E_TYPE>::value) {
+                if (bsl::safe_u64::magic_1() == pmut_entry->points_to_block) {
+                    return reclaim_entry_to_block(page_pool, mut_batch, pmut_entry);
                 }
+
+                bsl::touch();
             }
 
-            return {};
+            if constexpr (bsl::is_same<E, L0E_TYPE>::value) {
+                return reclaim_entry_to_block(page_pool, mut_batch, pmut_entry);
+            }
+            else {
+                return reclaim_entry_to_table(page_pool, mut_batch, pmut_entry);
+            }
         }
 
         /// <!-- description -->
@@ -945,19 +1341,21 @@ namespace lib
         ///     translation of the provided virtual address.
         ///
         [[nodiscard]] constexpr auto
-        get_2m_for_query(PAGE_POOL_TYPE &mut_page_pool, bsl::safe_u64 const &page_virt) noexcept
+        get_4k_for_query(PAGE_POOL_TYPE &mut_page_pool, bsl::safe_u64 const &page_virt) noexcept
             -> entries_t
         {
             entries_t mut_ret{};
             l2t_t *pmut_mut_l2t{};
             l1t_t *pmut_mut_l1t{};
+            l0t_t *pmut_mut_l0t{};
 
             // -----------------------------------------------------------------
             // Get L3 Entry
             // -----------------------------------------------------------------
 
             mut_ret.l3e = m_l3t->entries.at_if(virt_to_l3to(page_virt));
-            switch (entry_status(mut_ret.l3e)) {
+            auto const l3e{load_entry(mut_ret.l3e)};
+            switch (entry_status(&l3e)) {
                 case basic_entry_status_t::not_present: {
                     bsl::error() << "l3t_t entry for the virtual address "    // --
                                  << bsl::hex(page_virt)                       // --
@@ -969,7 +1367,7 @@ namespace lib
                 }
 
                 case basic_entry_status_t::present: {
-                    pmut_mut_l2t = entry_to_table(mut_page_pool, mut_ret.l3e);
+                    pmut_mut_l2t = entry_to_table(mut_page_pool, &l3e);
                     break;
                 }
 
@@ -995,7 +1393,8 @@ namespace lib
             // -----------------------------------------------------------------
 
             mut_ret.l2e = pmut_mut_l2t->entries.at_if(virt_to_l2to(page_virt));
-            switch (entry_status(mut_ret.l2e)) {
+            auto const l2e{load_entry(mut_ret.l2e)};
+            switch (entry_status(&l2e)) {
                 case basic_entry_status_t::not_present: {
                     bsl::error() << "l2t_t entry for the virtual address "    // --
                                  << bsl::hex(page_virt)                       // --
@@ -1007,8 +1406,8 @@ namespace lib
                 }
 
                 case basic_entry_status_t::present: {
-                    if (bsl::safe_u64::magic_0() == mut_ret.l2e->points_to_block) {
-                        pmut_mut_l1t = entry_to_table(mut_page_pool, mut_ret.l2e);
+                    if (bsl::safe_u64::magic_0() == l2e.points_to_block) {
+                        pmut_mut_l1t = entry_to_table(mut_page_pool, &l2e);
                         break;
                     }
 
@@ -1043,7 +1442,8 @@ namespace lib
             // -----------------------------------------------------------------
 
             mut_ret.l1e = pmut_mut_l1t->entries.at_if(virt_to_l1to(page_virt));
-            switch (entry_status(mut_ret.l1e)) {
+            auto const l1e{load_entry(mut_ret.l1e)};
+            switch (entry_status(&l1e)) {
                 case basic_entry_status_t::not_present: {
                     bsl::error() << "l1t_t entry for the virtual address "    // --
                                  << bsl::hex(page_virt)                       // --
@@ -1055,13 +1455,14 @@ namespace lib
                 }
 
                 case basic_entry_status_t::present: {
-                    if (bsl::safe_u64::magic_0() != mut_ret.l1e->points_to_block) {
-                        return mut_ret;
+                    if (bsl::safe_u64::magic_0() == l1e.points_to_block) {
+                        pmut_mut_l0t = entry_to_table(mut_page_pool, &l1e);
+                        break;
                     }
 
                     bsl::error() << "l1t_t entry for the virtual address "    // --
                                  << bsl::hex(page_virt)                       // --
-                                 << " was mapped as a table, not an entry"    // --
+                                 << " was mapped as an entry, not a table"    // --
                                  << bsl::endl                                 // --
                                  << bsl::here();                              // --
 
@@ -1081,6 +1482,44 @@ namespace lib
                 }
             }
 
+            if (bsl::unlikely(nullptr == pmut_mut_l0t)) {
+                return {};
+            }
+
+            // -----------------------------------------------------------------
+            // Get L0 Entry
+            // -----------------------------------------------------------------
+
+            mut_ret.l0e = pmut_mut_l0t->entries.at_if(virt_to_l0to(page_virt));
+            auto const l0e{load_entry(mut_ret.l0e)};
+            switch (entry_status(&l0e)) {
+                case basic_entry_status_t::not_present: {
+                    bsl::error() << "l0t_t entry for the virtual address "    // --
+                                 << bsl::hex(page_virt)                       // --
+                                 << " is not marked present"                  // --
+                                 << bsl::endl                                 // --
+                                 << bsl::here();                              // --
+
+                    break;
+                }
+
+                case basic_entry_status_t::present: {
+                    return mut_ret;
+                }
+
+                case basic_entry_status_t::reserved:
+                    [[fallthrough]];
+                default: {
+                    bsl::error() << "l0t_t entry for the virtual address "             // --
+                                 << bsl::hex(page_virt)                                // --
+                                 << " is not marked reserved and cannot be queried"    // --
+                                 << bsl::endl                                          // --
+                                 << bsl::here();                                       // --
+
+                    break;
+                }
+            }
+
             return {};
         }
 
@@ -1095,18 +1534,20 @@ namespace lib
         ///     translation of the provided virtual address.
         ///
         [[nodiscard]] constexpr auto
-        get_1g_for_query(PAGE_POOL_TYPE &mut_page_pool, bsl::safe_u64 const &page_virt) noexcept
+        get_2m_for_query(PAGE_POOL_TYPE &mut_page_pool, bsl::safe_u64 const &page_virt) noexcept
             -> entries_t
         {
             entries_t mut_ret{};
             l2t_t *pmut_mut_l2t{};
+            l1t_t *pmut_mut_l1t{};
 
             // -----------------------------------------------------------------
             // Get L3 Entry
             // -----------------------------------------------------------------
 
             mut_ret.l3e = m_l3t->entries.at_if(virt_to_l3to(page_virt));
-            switch (entry_status(mut_ret.l3e)) {
+            auto const l3e{load_entry(mut_ret.l3e)};
+            switch (entry_status(&l3e)) {
                 case basic_entry_status_t::not_present: {
                     bsl::error() << "l3t_t entry for the virtual address "    // --
                                  << bsl::hex(page_virt)                       // --
@@ -1118,7 +1559,7 @@ namespace lib
                 }
 
                 case basic_entry_status_t::present: {
-                    pmut_mut_l2t = entry_to_table(mut_page_pool, mut_ret.l3e);
+                    pmut_mut_l2t = entry_to_table(mut_page_pool, &l3e);
                     break;
                 }
 
@@ -1144,7 +1585,8 @@ namespace lib
             // -----------------------------------------------------------------
 
             mut_ret.l2e = pmut_mut_l2t->entries.at_if(virt_to_l2to(page_virt));
-            switch (entry_status(mut_ret.l2e)) {
+            auto const l2e{load_entry(mut_ret.l2e)};
+            switch (entry_status(&l2e)) {
                 case basic_entry_status_t::not_present: {
                     bsl::error() << "l2t_t entry for the virtual address "    // --
                                  << bsl::hex(page_virt)                       // --
@@ -1156,13 +1598,14 @@ namespace lib
                 }
 
                 case basic_entry_status_t::present: {
-                    if (bsl::safe_u64::magic_0() != mut_ret.l2e->points_to_block) {
-                        return mut_ret;
+                    if (bsl::safe_u64::magic_0() == l2e.points_to_block) {
+                        pmut_mut_l1t = entry_to_table(mut_page_pool, &l2e);
+                        break;
                     }
 
                     bsl::error() << "l2t_t entry for the virtual address "    // --
                                  << bsl::hex(page_virt)                       // --
-                                 << " was mapped as a table, not an entry"    // --
+                                 << " was mapped as an entry, not a table"    // --
                                  << bsl::endl                                 // --
                                  << bsl::here();                              // --
 
@@ -1182,6 +1625,54 @@ namespace lib
                 }
             }
 
+            if (bsl::unlikely(nullptr == pmut_mut_l1t)) {
+                return {};
+            }
+
+            // -----------------------------------------------------------------
+            // Get L1 Entry
+            // -----------------------------------------------------------------
+
+            mut_ret.l1e = pmut_mut_l1t->entries.at_if(virt_to_l1to(page_virt));
+            auto const l1e{load_entry(mut_ret.l1e)};
+            switch (entry_status(&l1e)) {
+                case basic_entry_status_t::not_present: {
+                    bsl::error() << "l1t_t entry for the virtual address "    // --
+                                 << bsl::hex(page_virt)                       // --
+                                 << " is not marked present"                  // --
+                                 << bsl::endl                                 // --
+                                 << bsl::here();                              // --
+
+                    break;
+                }
+
+                case basic_entry_status_t::present: {
+                    if (bsl::safe_u64::magic_0() != l1e.points_to_block) {
+                        return mut_ret;
+                    }
+
+                    bsl::error() << "l1t_t entry for the virtual address "    // --
+                                 << bsl::hex(page_virt)                       // --
+                                 << " was mapped as a table, not an entry"    // --
+                                 << bsl::endl                                 // --
+                                 << bsl::here();                              // --
+
+                    break;
+                }
+
+                case basic_entry_status_t::reserved:
+                    [[fallthrough]];
+                default: {
+                    bsl::error() << "l1t_t entry for the virtual address "             // --
+                                 << bsl::hex(page_virt)                                // --
+                                 << " is not marked reserved and cannot be queried"    // --
+                                 << bsl::endl                                          // --
+                                 << bsl::here();                                       // --
+
+                    break;
+                }
+            }
+
             return {};
         }
 
@@ -1190,23 +1681,126 @@ namespace lib
         ///     translation of the provided virtual address.
         ///
         /// <!-- inputs/outputs -->
-        ///   @tparam E the entry type requested. For example, if a 1G
-        ///     map/unmap request is made, E should be L2E_TYPE.
         ///   @param mut_page_pool the page_pool_t to use
         ///   @param page_virt the virtual address to decode
         ///   @return Returns all of the entries that are identified during the
         ///     translation of the provided virtual address.
         ///
-        template<typename E>
         [[nodiscard]] constexpr auto
-        get_for_query(PAGE_POOL_TYPE &mut_page_pool, bsl::safe_u64 const &page_virt) noexcept
+        get_1g_for_query(PAGE_POOL_TYPE &mut_page_pool, bsl::safe_u64 const &page_virt) noexcept
             -> entries_t
         {
-            static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE, L0E_TYPE>::value);
-
-            if constexpr (bsl::is_same<E, L0E_TYPE>::value) {
-                return get_4k_for_query(mut_page_pool, page_virt);
-            }
+            entries_t mut_ret{};
+            l2t_t *pmut_mut_l2t{};
+
+            // -----------------------------------------------------------------
+            // Get L3 Entry
+            // -----------------------------------------------------------------
+
+            mut_ret.l3e = m_l3t->entries.at_if(virt_to_l3to(page_virt));
+            auto const l3e{load_entry(mut_ret.l3e)};
+            switch (entry_status(&l3e)) {
+                case basic_entry_status_t::not_present: {
+                    bsl::error() << "l3t_t entry for the virtual address "    // --
+                                 << bsl::hex(page_virt)                       // --
+                                 << " is not marked present"                  // --
+                                 << bsl::endl                                 // --
+                                 << bsl::here();                              // --
+
+                    break;
+                }
+
+                case basic_entry_status_t::present: {
+                    pmut_mut_l2t = entry_to_table(mut_page_pool, &l3e);
+                    break;
+                }
+
+                case basic_entry_status_t::reserved:
+                    [[fallthrough]];
+                default: {
+                    bsl::error() << "l3t_t entry for the virtual address "             // --
+                                 << bsl::hex(page_virt)                                // --
+                                 << " is not marked reserved and cannot be queried"    // --
+                                 << bsl::endl                                          // --
+                                 << bsl::here();                                       // --
+
+                    break;
+                }
+            }
+
+            if (bsl::unlikely(nullptr == pmut_mut_l2t)) {
+                return {};
+            }
+
+            // -----------------------------------------------------------------
+            // Get L2 Entry
+            // -----------------------------------------------------------------
+
+            mut_ret.l2e = pmut_mut_l2t->entries.at_if(virt_to_l2to(page_virt));
+            auto const l2e{load_entry(mut_ret.l2e)};
+            switch (entry_status(&l2e)) {
+                case basic_entry_status_t::not_present: {
+                    bsl::error() << "l2t_t entry for the virtual address "    // --
+                                 << bsl::hex(page_virt)                       // --
+                                 << " is not marked present"                  // --
+                                 << bsl::endl                                 // --
+                                 << bsl::here();                              // --
+
+                    break;
+                }
+
+                case basic_entry_status_t::present: {
+                    if (bsl::safe_u64::magic_0() != l2e.points_to_block) {
+                        return mut_ret;
+                    }
+
+                    bsl::error() << "l2t_t entry for the virtual address "    // --
+                                 << bsl::hex(page_virt)                       // --
+                                 << " was mapped as a table, not an entry"    // --
+                                 << bsl::endl                                 // --
+                                 << bsl::here();                              // --
+
+                    break;
+                }
+
+                case basic_entry_status_t::reserved:
+                    [[fallthrough]];
+                default: {
+                    bsl::error() << "l2t_t entry for the virtual address "             // --
+                                 << bsl::hex(page_virt)                                // --
+                                 << " is not marked reserved and cannot be queried"    // --
+                                 << bsl::endl                                          // --
+                                 << bsl::here();                                       // --
+
+                    break;
+                }
+            }
+
+            return {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns all of the entries that are identified during the
+        ///     translation of the provided virtual address.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the entry type requested. For example, if a 1G
+        ///     map/unmap request is made, E should be L2E_TYPE.
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address to decode
+        ///   @return Returns all of the entries that are identified during the
+        ///     translation of the provided virtual address.
+        ///
+        template<typename E>
+        [[nodiscard]] constexpr auto
+        get_for_query(PAGE_POOL_TYPE &mut_page_pool, bsl::safe_u64 const &page_virt) noexcept
+            -> entries_t
+        {
+            static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE, L0E_TYPE>::value);
+
+            if constexpr (bsl::is_same<E, L0E_TYPE>::value) {
+                return get_4k_for_query(mut_page_pool, page_virt);
+            }
 
             if constexpr (bsl::is_same<E, L1E_TYPE>::value) {
                 return get_2m_for_query(mut_page_pool, page_virt);
@@ -1246,13 +1840,13 @@ namespace lib
             // -----------------------------------------------------------------
 
             bsl::finally mut_release_l2t_on_error{
-                bsl::dormant, [&tls, &mut_page_pool, &mut_ret]() noexcept -> void {
-                    release_entry(tls, mut_page_pool, mut_ret.l3e, false);
+                bsl::dormant, [this, &tls, &mut_page_pool, &mut_ret]() noexcept -> void {
+                    this->release_entry(tls, mut_page_pool, mut_ret.l3e, false);
                 }};
 
             bsl::finally mut_release_l1t_on_error{
-                bsl::dormant, [&tls, &mut_page_pool, &mut_ret]() noexcept -> void {
-                    release_entry(tls, mut_page_pool, mut_ret.l2e, false);
+                bsl::dormant, [this, &tls, &mut_page_pool, &mut_ret]() noexcept -> void {
+                    this->release_entry(tls, mut_page_pool, mut_ret.l2e, false);
                 }};
 
             // -----------------------------------------------------------------
@@ -1457,8 +2051,8 @@ namespace lib
             // -----------------------------------------------------------------
 
             bsl::finally mut_release_l2t_on_error{
-                bsl::dormant, [&tls, &mut_page_pool, &mut_ret]() noexcept -> void {
-                    release_entry(tls, mut_page_pool, mut_ret.l3e, false);
+                bsl::dormant, [this, &tls, &mut_page_pool, &mut_ret]() noexcept -> void {
+                    this->release_entry(tls, mut_page_pool, mut_ret.l3e, false);
                 }};
 
             // -----------------------------------------------------------------
@@ -1766,6 +2360,663 @@ namespace lib
             }
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if the hardware set the dirty flag of any
+        ///     of the blocks in the provided table.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of table to check
+        ///   @param table the table to check
+        ///   @return Returns true if any of the blocks in the provided
+        ///     table are dirty. Returns false otherwise.
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        is_table_dirty(T const *const table) noexcept -> bool
+        {
+            for (auto const &elem : table->entries) {
+                auto const entry{load_entry(&elem)};
+                if (helpers::entry_to_dirty(&entry)) {
+                    return true;
+                }
+
+                bsl::touch();
+            }
+
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the dirty flag of the provided block without
+        ///     losing the accessed or dirty flags the CPU might be setting
+        ///     at the same time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to mark as dirty
+        ///   @param pmut_entry the entry to mark as dirty
+        ///
+        template<typename E>
+        static constexpr void
+        mark_entry_dirty(E *const pmut_entry) noexcept
+        {
+            E mut_old{load_entry(pmut_entry)};
+            E mut_entry{mut_old};
+            helpers::configure_entry_dirty(&mut_entry, true);
+
+            while (!exchange_entry(pmut_entry, mut_old, mut_entry)) {
+                mut_entry = mut_old;
+                helpers::configure_entry_dirty(&mut_entry, true);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided entry is a block that
+        ///     promote_table() is allowed to fold into a larger block,
+        ///     given the phys and flags the entry is expected to have.
+        ///     Pages that have to be released or explicitly unmapped
+        ///     on their own are never folded.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to check
+        ///   @param entry the entry to check
+        ///   @param phys the phys field the entry must have
+        ///   @param page_flgs the flags the entry must have been mapped with
+        ///   @return Returns true if the provided entry can be folded into
+        ///     a larger block. Returns false otherwise.
+        ///
+        template<typename E>
+        [[nodiscard]] static constexpr auto
+        is_promotable(
+            E const *const entry,
+            bsl::safe_u64 const &phys,
+            bsl::safe_u64 const &page_flgs) noexcept -> bool
+        {
+            if (entry_status(entry) != basic_entry_status_t::present) {
+                return false;
+            }
+
+            if (bsl::safe_u64::magic_0() == entry->points_to_block) {
+                return false;
+            }
+
+            if (bsl::safe_u64::magic_1() == entry->auto_release) {
+                return false;
+            }
+
+            if (bsl::safe_u64::magic_1() == entry->explicit_unmap) {
+                return false;
+            }
+
+            if (phys != entry->phys) {
+                return false;
+            }
+
+            return helpers::entry_to_page_flgs(entry) == page_flgs;
+        }
+
+        /// <!-- description -->
+        ///   @brief If every entry in the table the provided entry points
+        ///     to maps one contiguous, aligned and identically flagged
+        ///     range, the entry is turned into a single block that maps
+        ///     the same range, and the table is retired.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to promote. L1E_TYPE turns a l0t_t
+        ///     into a 2M block, and L2E_TYPE turns a l1t_t into a 1G block.
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param pmut_entry the entry that points to the table to fold
+        ///   @return Returns true if the entry was promoted. Returns false
+        ///     otherwise.
+        ///
+        template<typename E>
+        [[nodiscard]] constexpr auto
+        promote_table(
+            TLS_TYPE const &tls, PAGE_POOL_TYPE &mut_page_pool, E *const pmut_entry) noexcept
+            -> bool
+        {
+            static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE>::value);
+            bsl::expects(nullptr != pmut_entry);
+
+            if (!m_promote) {
+                return false;
+            }
+
+            if (m_defer_release) {
+                return false;
+            }
+
+            if (m_hold_retired && this->is_retired_full()) {
+                return false;
+            }
+
+            if (entry_status(pmut_entry) != basic_entry_status_t::present) {
+                return false;
+            }
+
+            if (bsl::safe_u64::magic_1() == pmut_entry->points_to_block) {
+                return false;
+            }
+
+            auto *const pmut_table{entry_to_table(mut_page_pool, pmut_entry)};
+            auto const *const first{pmut_table->entries.front_if()};
+            auto const *const last{pmut_table->entries.back_if()};
+
+            /// NOTE:
+            /// - The phys field is always in units of 4k pages, so each
+            ///   entry in a l1t_t maps 512 of them, and each entry in a
+            ///   l0t_t maps 1.
+            ///
+
+            bsl::safe_u64 mut_step{bsl::safe_u64::magic_1()};
+            if constexpr (bsl::is_same<E, L2E_TYPE>::value) {
+                mut_step = bsl::to_u64(BASIC_PAGE_2M_T_SIZE >> BASIC_PAGE_4K_T_SHFT);
+                if (!is_page_1g_aligned(bsl::to_u64(first->phys) << BASIC_PAGE_4K_T_SHFT)) {
+                    return false;
+                }
+
+                bsl::touch();
+            }
+            else {
+                if (!is_page_2m_aligned(bsl::to_u64(first->phys) << BASIC_PAGE_4K_T_SHFT)) {
+                    return false;
+                }
+
+                bsl::touch();
+            }
+
+            auto const base{bsl::to_u64(first->phys)};
+            auto const flgs{helpers::entry_to_page_flgs(first)};
+
+            /// NOTE:
+            /// - map() calls this every time a table gains an entry, which
+            ///   is why the last entry is checked before the loop. When a
+            ///   range is filled in order (which is almost always the case),
+            ///   this fails until the very last page is mapped, so only the
+            ///   call that actually promotes pays for the whole loop.
+            ///
+
+            auto const last_idx{(pmut_table->entries.size() - bsl::safe_umx::magic_1()).checked()};
+            auto const last_phys{(base + (mut_step * bsl::to_u64(last_idx))).checked()};
+            if (!is_promotable(last, last_phys, flgs)) {
+                return false;
+            }
+
+            for (bsl::safe_idx mut_i{}; mut_i < pmut_table->entries.size(); ++mut_i) {
+                auto const *const entry{pmut_table->entries.at_if(mut_i)};
+                auto const phys{(base + (mut_step * bsl::to_u64(mut_i))).checked()};
+                if (!is_promotable(entry, phys, flgs)) {
+                    return false;
+                }
+
+                bsl::touch();
+            }
+
+            E mut_entry{};
+            mut_entry.auto_release = bsl::safe_u64::magic_0().get();
+            mut_entry.points_to_block = bsl::safe_u64::magic_1().get();
+            mut_entry.alias = bsl::safe_u64::magic_0().get();
+            mut_entry.phys = base.get();
+            mut_entry.explicit_unmap = bsl::safe_u64::magic_0().get();
+            helpers::configure_entry_as_ptr_to_block(&mut_entry, flgs);
+            helpers::configure_entry_dirty(&mut_entry, is_table_dirty(pmut_table));
+
+            store_entry(pmut_entry, mut_entry);
+
+            /// NOTE:
+            /// - The CPU might have written to the range through the old
+            ///   table after it was checked above, so it is checked again
+            ///   now that the block is in place, making sure that a write
+            ///   the old table recorded is never lost.
+            ///
+
+            if (!helpers::entry_to_dirty(&mut_entry) && is_table_dirty(pmut_table)) {
+                mark_entry_dirty(pmut_entry);
+            }
+            else {
+                bsl::touch();
+            }
+
+            this->retire_table(tls, mut_page_pool, pmut_table);
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Called by map() after a block is added to the RPT. If
+        ///     the table the block was added to is now full of blocks that
+        ///     can be folded into a single larger block, the table is
+        ///     promoted, which might in turn fill the table above it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry that was mapped
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param ents the entries that were returned by get_for_map()
+        ///
+        template<typename E>
+        constexpr void
+        promote(TLS_TYPE const &tls, PAGE_POOL_TYPE &mut_page_pool, entries_t const &ents) noexcept
+        {
+            static_assert(bsl::is_one_of<E, L1E_TYPE, L0E_TYPE>::value);
+
+            if constexpr (bsl::is_same<E, L0E_TYPE>::value) {
+                if (!this->promote_table(tls, mut_page_pool, ents.l1e)) {
+                    return;
+                }
+
+                bsl::touch();
+            }
+
+            if (!m_promote_1g) {
+                return;
+            }
+
+            bsl::discard(this->promote_table(tls, mut_page_pool, ents.l2e));
+        }
+
+        /// <!-- description -->
+        ///   @brief Turns a block into a table of smaller blocks that map
+        ///     the same range with the same flags. The new table is filled
+        ///     in before the entry is pointed at it, so a query that is
+        ///     walking the RPT at the same time sees either the block or the
+        ///     complete table.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to split. L2E_TYPE turns a 1G block
+        ///     into a l1t_t of 2M blocks, and L1E_TYPE turns a 2M block into
+        ///     a l0t_t of 4k blocks.
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param pmut_entry the block to split
+        ///   @param mut_sys the bf_syscall_t to use (optional)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        template<typename E>
+        [[nodiscard]] static constexpr auto
+        split_block(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            E *const pmut_entry,
+            SYS_TYPE &mut_sys) noexcept -> bsl::errc_type
+        {
+            static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE>::value);
+            bsl::expects(nullptr != pmut_entry);
+
+            auto *const pmut_table{allocate_table<E>(tls, mut_page_pool, mut_sys)};
+            if (bsl::unlikely(nullptr == pmut_table)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            bsl::safe_u64 mut_step{bsl::safe_u64::magic_1()};
+            if constexpr (bsl::is_same<E, L2E_TYPE>::value) {
+                mut_step = bsl::to_u64(BASIC_PAGE_2M_T_SIZE >> BASIC_PAGE_4K_T_SHFT);
+            }
+
+            E mut_old{load_entry(pmut_entry)};
+            auto const base{bsl::to_u64(mut_old.phys)};
+            auto const flgs{helpers::entry_to_page_flgs(&mut_old)};
+            auto const dirty{helpers::entry_to_dirty(&mut_old)};
+
+            for (bsl::safe_idx mut_i{}; mut_i < pmut_table->entries.size(); ++mut_i) {
+                auto *const pmut_block{pmut_table->entries.at_if(mut_i)};
+                pmut_block->auto_release = bsl::safe_u64::magic_0().get();
+                pmut_block->points_to_block = bsl::safe_u64::magic_1().get();
+                pmut_block->alias = bsl::safe_u64::magic_0().get();
+                pmut_block->phys = (base + (mut_step * bsl::to_u64(mut_i))).checked().get();
+                pmut_block->explicit_unmap = mut_old.explicit_unmap;
+                helpers::configure_entry_as_ptr_to_block(pmut_block, flgs);
+                helpers::configure_entry_dirty(pmut_block, dirty);
+            }
+
+            auto mut_table_phys{mut_page_pool.virt_to_phys(pmut_table)};
+            bsl::expects(mut_table_phys.is_valid_and_checked());
+            bsl::expects(mut_table_phys.is_pos());
+
+            E mut_entry{};
+            mut_entry.auto_release = bsl::safe_u64::magic_0().get();
+            mut_entry.points_to_block = bsl::safe_u64::magic_0().get();
+            mut_entry.alias = bsl::safe_u64::magic_0().get();
+            mut_entry.phys = (mut_table_phys >> BASIC_PAGE_4K_T_SHFT).get();
+            mut_entry.explicit_unmap = bsl::safe_u64::magic_0().get();
+            helpers::configure_entry_as_ptr_to_table(&mut_entry);
+
+            /// NOTE:
+            /// - The new table is not visible yet, so if the CPU wrote to
+            ///   the block (setting its dirty flag) after it was read
+            ///   above, the exchange fails and every block in the new
+            ///   table is marked as dirty before trying again.
+            ///
+
+            while (!exchange_entry(pmut_entry, mut_old, mut_entry)) {
+                auto const now_dirty{helpers::entry_to_dirty(&mut_old)};
+                for (auto &mut_block : pmut_table->entries) {
+                    helpers::configure_entry_dirty(&mut_block, now_dirty);
+                }
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Called by unmap() and set_page_flgs() before they look
+        ///     up the entry to change. If the address is part of a block
+        ///     that is larger than the change being asked for (for example
+        ///     because map() promoted it), the block is split until an entry
+        ///     of the requested size exists. Anything else is left for the
+        ///     caller to report.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the entry type being changed
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address being changed
+        ///   @param mut_sys the bf_syscall_t to use (optional)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        template<typename E>
+        [[nodiscard]] constexpr auto
+        split_to(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &page_virt,
+            SYS_TYPE &mut_sys) noexcept -> bsl::errc_type
+        {
+            static_assert(bsl::is_one_of<E, L1E_TYPE, L0E_TYPE>::value);
+
+            auto *const pmut_l3e{m_l3t->entries.at_if(virt_to_l3to(page_virt))};
+            if (entry_status(pmut_l3e) != basic_entry_status_t::present) {
+                return bsl::errc_success;
+            }
+
+            auto *const pmut_l2t{entry_to_table(mut_page_pool, pmut_l3e)};
+            auto *const pmut_l2e{pmut_l2t->entries.at_if(virt_to_l2to(page_virt))};
+            if (entry_status(pmut_l2e) != basic_entry_status_t::present) {
+                return bsl::errc_success;
+            }
+
+            if (bsl::safe_u64::magic_1() == pmut_l2e->points_to_block) {
+                auto const ret{split_block(tls, mut_page_pool, pmut_l2e, mut_sys)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
+            if constexpr (bsl::is_same<E, L0E_TYPE>::value) {
+                auto *const pmut_l1t{entry_to_table(mut_page_pool, pmut_l2e)};
+                auto *const pmut_l1e{pmut_l1t->entries.at_if(virt_to_l1to(page_virt))};
+                if (entry_status(pmut_l1e) != basic_entry_status_t::present) {
+                    return bsl::errc_success;
+                }
+
+                if (bsl::safe_u64::magic_1() == pmut_l1e->points_to_block) {
+                    return split_block(tls, mut_page_pool, pmut_l1e, mut_sys);
+                }
+
+                bsl::touch();
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the entries that lead to the provided address,
+        ///     down to the entry of type E. Unlike get_for_query(), the
+        ///     entry of type E is allowed to point to a table, as
+        ///     set_page_flgs() changes every block that table maps. The
+        ///     caller must hold m_lock and must have already called
+        ///     split_to().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the entry type being changed
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address being changed
+        ///   @return Returns the entries that lead to the provided address.
+        ///     If the address is not mapped, the entry of type E is a nullptr.
+        ///
+        template<typename E>
+        [[nodiscard]] constexpr auto
+        get_for_update(PAGE_POOL_TYPE &mut_page_pool, bsl::safe_u64 const &page_virt) noexcept
+            -> entries_t
+        {
+            static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE, L0E_TYPE>::value);
+
+            entries_t mut_ret{};
+
+            mut_ret.l3e = m_l3t->entries.at_if(virt_to_l3to(page_virt));
+            if (entry_status(mut_ret.l3e) != basic_entry_status_t::present) {
+                return {};
+            }
+
+            auto *const pmut_l2t{entry_to_table(mut_page_pool, mut_ret.l3e)};
+            mut_ret.l2e = pmut_l2t->entries.at_if(virt_to_l2to(page_virt));
+            if (entry_status(mut_ret.l2e) != basic_entry_status_t::present) {
+                return {};
+            }
+
+            if constexpr (!bsl::is_same<E, L2E_TYPE>::value) {
+                auto *const pmut_l1t{entry_to_table(mut_page_pool, mut_ret.l2e)};
+                mut_ret.l1e = pmut_l1t->entries.at_if(virt_to_l1to(page_virt));
+                if (entry_status(mut_ret.l1e) != basic_entry_status_t::present) {
+                    return {};
+                }
+
+                bsl::touch();
+            }
+
+            if constexpr (bsl::is_same<E, L0E_TYPE>::value) {
+                auto *const pmut_l0t{entry_to_table(mut_page_pool, mut_ret.l1e)};
+                mut_ret.l0e = pmut_l0t->entries.at_if(virt_to_l0to(page_virt));
+                if (entry_status(mut_ret.l0e) != basic_entry_status_t::present) {
+                    return {};
+                }
+
+                bsl::touch();
+            }
+
+            return mut_ret;
+        }
+
+        /// <!-- description -->
+        ///   @brief Changes the flags of the provided block. If the entry
+        ///     points to a table instead, the flags of every block in that
+        ///     table (and the tables below it) are changed. Entries that
+        ///     are not present, or that are aliases, are left alone.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to change
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param pmut_entry the entry to change
+        ///   @param page_flgs the new flags to give the block(s)
+        ///
+        template<typename E>
+        static constexpr void
+        set_entry_flgs(
+            PAGE_POOL_TYPE &mut_page_pool,
+            E *const pmut_entry,
+            bsl::safe_u64 const &page_flgs) noexcept
+        {
+            if (entry_status(pmut_entry) != basic_entry_status_t::present) {
+                return;
+            }
+
+            if constexpr (!bsl::is_same<E, L0E_TYPE>::value) {
+                if (bsl::safe_u64::magic_0() == pmut_entry->points_to_block) {
+                    auto *const pmut_table{entry_to_table(mut_page_pool, pmut_entry)};
+                    for (bsl::safe_idx mut_i{}; mut_i < pmut_table->entries.size(); ++mut_i) {
+                        set_entry_flgs(mut_page_pool, pmut_table->entries.at_if(mut_i), page_flgs);
+                    }
+
+                    return;
+                }
+
+                bsl::touch();
+            }
+
+            /// NOTE:
+            /// - The CPU might set the accessed or dirty bits of this entry
+            ///   while its flags are being changed, so only the flags are
+            ///   changed, and the write is retried if the entry changed
+            ///   after it was read.
+            ///
+
+            E mut_old{load_entry(pmut_entry)};
+            E mut_entry{mut_old};
+            helpers::configure_entry_as_ptr_to_block(&mut_entry, page_flgs);
+
+            while (!exchange_entry(pmut_entry, mut_old, mut_entry)) {
+                mut_entry = mut_old;
+                helpers::configure_entry_as_ptr_to_block(&mut_entry, page_flgs);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the size of the block that maps the provided
+        ///     virtual address, or 0 if the address is not mapped. Like
+        ///     get_for_query(), this is safe to call without m_lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address to look up
+        ///   @return Returns the size of the block that maps the provided
+        ///     virtual address, or 0 if the address is not mapped.
+        ///
+        [[nodiscard]] constexpr auto
+        get_page_size(PAGE_POOL_TYPE &mut_page_pool, bsl::safe_u64 const &page_virt) noexcept
+            -> bsl::safe_u64
+        {
+            auto const l3e{load_entry(m_l3t->entries.at_if(virt_to_l3to(page_virt)))};
+            if (entry_status(&l3e) != basic_entry_status_t::present) {
+                return {};
+            }
+
+            auto const *const l2t{entry_to_table(mut_page_pool, &l3e)};
+            auto const l2e{load_entry(l2t->entries.at_if(virt_to_l2to(page_virt)))};
+            if (entry_status(&l2e) != basic_entry_status_t::present) {
+                return {};
+            }
+
+            if (bsl::safe_u64::magic_1() == l2e.points_to_block) {
+                return bsl::to_u64(BASIC_PAGE_1G_T_SIZE);
+            }
+
+            auto const *const l1t{entry_to_table(mut_page_pool, &l2e)};
+            auto const l1e{load_entry(l1t->entries.at_if(virt_to_l1to(page_virt)))};
+            if (entry_status(&l1e) != basic_entry_status_t::present) {
+                return {};
+            }
+
+            if (bsl::safe_u64::magic_1() == l1e.points_to_block) {
+                return bsl::to_u64(BASIC_PAGE_2M_T_SIZE);
+            }
+
+            auto const *const l0t{entry_to_table(mut_page_pool, &l1e)};
+            auto const l0e{load_entry(l0t->entries.at_if(virt_to_l0to(page_virt)))};
+            if (entry_status(&l0e) != basic_entry_status_t::present) {
+                return {};
+            }
+
+            return bsl::to_u64(BASIC_PAGE_4K_T_SIZE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes mapped by an entry of the
+        ///     provided type.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to query
+        ///   @return Returns the number of bytes mapped by an entry of the
+        ///     provided type.
+        ///
+        template<typename E>
+        [[nodiscard]] static constexpr auto
+        entry_bytes() noexcept -> bsl::safe_u64
+        {
+            static_assert(bsl::is_one_of<E, L3E_TYPE, L2E_TYPE, L1E_TYPE, L0E_TYPE>::value);
+
+            if constexpr (bsl::is_same<E, L3E_TYPE>::value) {
+                constexpr auto l3e_bytes{0x0000008000000000_u64};
+                return l3e_bytes;
+            }
+
+            if constexpr (bsl::is_same<E, L2E_TYPE>::value) {
+                return bsl::to_u64(BASIC_PAGE_1G_T_SIZE);
+            }
+
+            if constexpr (bsl::is_same<E, L1E_TYPE>::value) {
+                return bsl::to_u64(BASIC_PAGE_2M_T_SIZE);
+            }
+
+            if constexpr (bsl::is_same<E, L0E_TYPE>::value) {
+                return bsl::to_u64(BASIC_PAGE_4K_T_SIZE);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Calls mut_func for the block that the provided entry
+        ///     maps. If the entry points to a table instead, mut_func is
+        ///     called for every block in that table (and the tables below
+        ///     it). Entries that are not present, or that are aliases, are
+        ///     skipped. See for_each_block() for how mut_func is called.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to walk
+        ///   @tparam FUNC the type of function to call
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param pmut_entry the entry to walk
+        ///   @param virt the virtual address that the entry maps
+        ///   @param mut_func the function to call for each block
+        ///
+        template<typename E, typename FUNC>
+        static constexpr void
+        for_each_block_in_entry(
+            PAGE_POOL_TYPE &mut_page_pool,
+            E *const pmut_entry,
+            bsl::safe_u64 const &virt,
+            FUNC &mut_func) noexcept
+        {
+            if (entry_status(pmut_entry) != basic_entry_status_t::present) {
+                return;
+            }
+
+            auto const bytes{entry_bytes<E>()};
+
+            if constexpr (!bsl::is_same<E, L0E_TYPE>::value) {
+                if (bsl::safe_u64::magic_0() == pmut_entry->points_to_block) {
+                    auto *const pmut_table{entry_to_table(mut_page_pool, pmut_entry)};
+                    auto const num{bsl::to_u64(pmut_table->entries.size())};
+                    auto const child_bytes{(bytes / num).checked()};
+
+                    for (bsl::safe_idx mut_i{}; mut_i < pmut_table->entries.size(); ++mut_i) {
+                        auto const offs{(bsl::to_u64(mut_i) * child_bytes).checked()};
+                        auto const child_virt{(virt + offs).checked()};
+                        for_each_block_in_entry(
+                            mut_page_pool, pmut_table->entries.at_if(mut_i), child_virt, mut_func);
+                    }
+
+                    return;
+                }
+
+                bsl::touch();
+            }
+
+            E mut_entry{load_entry(pmut_entry)};
+            if (mut_func(virt, bytes, mut_entry)) {
+                store_entry(pmut_entry, mut_entry);
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
     public:
         /// <!-- description -->
         ///   @brief Initializes this basic_root_page_table_t
@@ -1809,10 +3060,113 @@ namespace lib
                 return;
             }
 
-            this->release_table(tls, mut_page_pool, m_l3t, true);
+            if (this->release_table(tls, mut_page_pool, m_l3t, true)) {
+                mut_page_pool.deallocate(tls, m_l3t);
+            }
+            else {
+                bsl::touch();
+            }
+
+            this->synchronize();
+            this->release_retired(tls, mut_page_pool);
+
+            m_l3t_spa = {};
+            m_l3t = {};
+            m_promote = {};
+            m_promote_1g = {};
+            m_defer_release = {};
+            m_hold_retired = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases all of the tables and memory mapped into the RPT
+        ///     while keeping the RPT itself initialized. Once complete, the
+        ///     RPT's root table is zero'd (aside from any entry that could
+        ///     not be released because explicit_unmap is still set) and the
+        ///     RPT can be reused without having to allocate a new root table.
+        ///     Aliased entries are removed but not released.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///
+        constexpr void
+        clear(TLS_TYPE const &tls, PAGE_POOL_TYPE &mut_page_pool) noexcept
+        {
+            bsl::expects(nullptr != m_l3t);
+
+            basic_lock_guard_t mut_lock{tls, m_lock};
+
+            for (bsl::safe_idx mut_i{}; mut_i < m_l3t->entries.size(); ++mut_i) {
+                auto *const pmut_l3e{m_l3t->entries.at_if(mut_i)};
+
+                if (bsl::safe_u64::magic_0() != pmut_l3e->alias) {
+                    store_entry(pmut_l3e, {});
+                    continue;
+                }
+
+                bsl::discard(this->release_entry(tls, mut_page_pool, pmut_l3e, true));
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Incrementally performs the same work as clear(). Each
+        ///     call releases at most RPT_RECLAIM_BATCH_PAGES tables and
+        ///     auto_release pages, returning them to the page pool with a
+        ///     single call to deallocate_batch() per page type instead of
+        ///     one deallocate() (and one lock acquisition) per page. This
+        ///     allows the teardown of a large RPT to be spread out over
+        ///     time instead of stalling the PP that is doing the teardown.
+        ///     Once this function returns true, the RPT is in the same
+        ///     state clear() would have left it in.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @return Returns true if there is nothing left to reclaim.
+        ///     Returns false if reclaim() needs to be called again.
+        ///
+        [[nodiscard]] constexpr auto
+        reclaim(TLS_TYPE const &tls, PAGE_POOL_TYPE &mut_page_pool) noexcept -> bool
+        {
+            bsl::expects(nullptr != m_l3t);
+
+            bool mut_done{true};
+            reclaim_batch_t mut_batch{};
+
+            basic_lock_guard_t mut_lock{tls, m_lock};
+
+            for (bsl::safe_idx mut_i{}; mut_i < m_l3t->entries.size(); ++mut_i) {
+                auto *const pmut_l3e{m_l3t->entries.at_if(mut_i)};
+
+                if (bsl::safe_u64::magic_0() != pmut_l3e->alias) {
+                    store_entry(pmut_l3e, {});
+                    continue;
+                }
+
+                if (!reclaim_entry(mut_page_pool, mut_batch, pmut_l3e)) {
+                    mut_done = false;
+                    break;
+                }
+
+                bsl::touch();
+            }
+
+            /// NOTE:
+            /// - Just like retire_table(), the tables in the batch have
+            ///   already been unlinked, but a query might still be walking
+            ///   them, so we have to wait for any in-flight queries first.
+            ///
 
-            m_l3t_spa = {};
-            m_l3t = {};
+            this->synchronize();
+            this->release_retired(tls, mut_page_pool);
+
+            release_list(tls, mut_page_pool, mut_batch.pages);
+            release_list(tls, mut_page_pool, mut_batch.l0ts);
+            release_list(tls, mut_page_pool, mut_batch.l1ts);
+            release_list(tls, mut_page_pool, mut_batch.l2ts);
+
+            return mut_done;
         }
 
         /// <!-- description -->
@@ -1873,7 +3227,111 @@ namespace lib
         }
 
         /// <!-- description -->
-        ///   @brief Maps a 1g page into the root page table
+        ///   @brief Tells map() whether it is allowed to replace a table
+        ///     that maps one contiguous, aligned and identically flagged
+        ///     range with a single block. This is disabled by default as a
+        ///     promoted table is returned to the page pool while a CPU
+        ///     walking this RPT might still have it in its paging structure
+        ///     caches. Only enable this if every CPU that walks this RPT is
+        ///     flushed before the page pool can hand the table out again.
+        ///     Promotion is also disabled by set_defer_release().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param enable if true, map() is allowed to promote tables
+        ///
+        constexpr void
+        set_promote(bool const enable) noexcept
+        {
+            m_promote = enable;
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells map() whether it is allowed to replace a table of
+        ///     2M blocks with a 1G block. This is disabled by default as not
+        ///     all CPUs support 1G pages, which is not something the RPT can
+        ///     check on its own. Has no effect unless set_promote() is also
+        ///     used.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param enable if true, map() is allowed to create 1G blocks
+        ///
+        constexpr void
+        set_promote_1g(bool const enable) noexcept
+        {
+            m_promote_1g = enable;
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells unmap() to leave releasing memory to the caller.
+        ///     Once enabled, unmap() only clears the entry that maps the
+        ///     page: the page itself is not returned to the page pool, even
+        ///     if it was allocated using allocate_page(), and tables that
+        ///     become empty are left in place (which also disables the
+        ///     promotion of tables by map(), even if set_promote() was
+        ///     used). This is needed when other PPs might still have the
+        ///     translation cached, or when another RPT aliases this RPT's
+        ///     tables using add_tables(), as in both cases, nothing can be
+        ///     returned to the page pool until the caller knows that
+        ///     nothing can reach it anymore. Empty tables are still
+        ///     released by release().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param enable if true, unmap() does not release any memory
+        ///
+        constexpr void
+        set_defer_release(bool const enable) noexcept
+        {
+            m_defer_release = enable;
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the RPT to hold on to the tables that unmap() and
+        ///     promotion remove, instead of returning them to the page pool
+        ///     once no query is walking them. This is needed when the RPT
+        ///     is in use by hardware that caches the tables themselves (for
+        ///     example, EPT or NPT), in which case a table cannot be handed
+        ///     out again until the caller has flushed those caches, which
+        ///     it tells the RPT by calling flushed(). Only a few tables can
+        ///     be held at a time, so once that limit is reached, empty
+        ///     tables are left in place and tables are not promoted until
+        ///     flushed() is called.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param enable if true, removed tables are held until flushed()
+        ///
+        constexpr void
+        set_hold_retired(bool const enable) noexcept
+        {
+            m_hold_retired = enable;
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the RPT that the caller has flushed any cache that
+        ///     might have held on to the tables that were removed, which
+        ///     returns the tables held because of set_hold_retired() to the
+        ///     page pool.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///
+        constexpr void
+        flushed(TLS_TYPE const &tls, PAGE_POOL_TYPE &mut_page_pool) noexcept
+        {
+            basic_lock_guard_t mut_lock{tls, m_lock};
+
+            this->synchronize();
+            this->release_retired(tls, mut_page_pool);
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps a page into the root page table. If set_promote()
+        ///     was used, and this fills a table with blocks that map one
+        ///     contiguous, aligned and identically flagged range, the table
+        ///     is replaced with a single 2M block (or 1G block if
+        ///     set_promote_1g() was also used), and the table is returned
+        ///     to the page pool just like it would be by unmap(). Pages
+        ///     mapped with explicit_unmap set are never promoted.
         ///
         /// <!-- inputs/outputs -->
         ///   @tparam E the entry type to use. Valid inputs are L2E_TYPE, L1E_TYPE
@@ -1927,26 +3385,38 @@ namespace lib
 
             basic_lock_guard_t mut_lock{tls, m_lock};
 
-            auto *const pmut_entry{get_entry_from_entries<E>(
-                this->get_for_map<E>(tls, mut_page_pool, page_virt, mut_sys))};
+            auto const ents{this->get_for_map<E>(tls, mut_page_pool, page_virt, mut_sys)};
+            auto *const pmut_entry{get_entry_from_entries<E>(ents)};
 
             if (bsl::unlikely(nullptr == pmut_entry)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
 
+            E mut_entry{*pmut_entry};
             if (explicit_unmap) {
-                pmut_entry->explicit_unmap = bsl::safe_u64::magic_1().get();
+                mut_entry.explicit_unmap = bsl::safe_u64::magic_1().get();
             }
             else {
-                pmut_entry->explicit_unmap = bsl::safe_u64::magic_0().get();
+                mut_entry.explicit_unmap = bsl::safe_u64::magic_0().get();
             }
 
-            pmut_entry->auto_release = bsl::safe_u64::magic_0().get();
-            pmut_entry->points_to_block = bsl::safe_u64::magic_1().get();
-            pmut_entry->alias = bsl::safe_u64::magic_0().get();
-            pmut_entry->phys = (page_phys >> BASIC_PAGE_4K_T_SHFT).get();
-            helpers::configure_entry_as_ptr_to_block(pmut_entry, page_flgs);
+            mut_entry.auto_release = bsl::safe_u64::magic_0().get();
+            mut_entry.points_to_block = bsl::safe_u64::magic_1().get();
+            mut_entry.alias = bsl::safe_u64::magic_0().get();
+            mut_entry.phys = (page_phys >> BASIC_PAGE_4K_T_SHFT).get();
+            helpers::configure_entry_as_ptr_to_block(&mut_entry, page_flgs);
+
+            store_entry(pmut_entry, mut_entry);
+
+            if constexpr (!bsl::is_same<E, L2E_TYPE>::value) {
+                if (!explicit_unmap) {
+                    this->promote<E>(tls, mut_page_pool, ents);
+                }
+                else {
+                    bsl::touch();
+                }
+            }
 
             return bsl::errc_success;
         }
@@ -2006,12 +3476,14 @@ namespace lib
                 return nullptr;
             }
 
-            pmut_entry->auto_release = bsl::safe_u64::magic_1().get();
-            pmut_entry->points_to_block = bsl::safe_u64::magic_1().get();
-            pmut_entry->alias = bsl::safe_u64::magic_0().get();
-            pmut_entry->phys = (mut_page_pool.virt_to_phys(pmut_ptr) >> BASIC_PAGE_4K_T_SHFT).get();
-            pmut_entry->explicit_unmap = bsl::safe_u64::magic_0().get();
-            helpers::configure_entry_as_ptr_to_block(pmut_entry, page_flgs);
+            L0E_TYPE mut_entry{*pmut_entry};
+            mut_entry.auto_release = bsl::safe_u64::magic_1().get();
+            mut_entry.points_to_block = bsl::safe_u64::magic_1().get();
+            mut_entry.alias = bsl::safe_u64::magic_0().get();
+            mut_entry.phys = (mut_page_pool.virt_to_phys(pmut_ptr) >> BASIC_PAGE_4K_T_SHFT).get();
+            mut_entry.explicit_unmap = bsl::safe_u64::magic_0().get();
+            helpers::configure_entry_as_ptr_to_block(&mut_entry, page_flgs);
+            store_entry(pmut_entry, mut_entry);
 
             mut_deallocate_on_error.ignore();
             return bsl::construct_at<T>(pmut_ptr);
@@ -2073,12 +3545,14 @@ namespace lib
 
             bsl::expects(entry_status(pmut_entry) != basic_entry_status_t::present);
 
-            pmut_entry->auto_release = bsl::safe_u64::magic_1().get();
-            pmut_entry->points_to_block = bsl::safe_u64::magic_1().get();
-            pmut_entry->alias = bsl::safe_u64::magic_0().get();
-            pmut_entry->phys = (page_phys >> BASIC_PAGE_4K_T_SHFT).get();
-            pmut_entry->explicit_unmap = bsl::safe_u64::magic_0().get();
-            helpers::configure_entry_as_ptr_to_block(pmut_entry, BASIC_MAP_PAGE_RW);
+            L0E_TYPE mut_entry{*pmut_entry};
+            mut_entry.auto_release = bsl::safe_u64::magic_1().get();
+            mut_entry.points_to_block = bsl::safe_u64::magic_1().get();
+            mut_entry.alias = bsl::safe_u64::magic_0().get();
+            mut_entry.phys = (page_phys >> BASIC_PAGE_4K_T_SHFT).get();
+            mut_entry.explicit_unmap = bsl::safe_u64::magic_0().get();
+            helpers::configure_entry_as_ptr_to_block(&mut_entry, BASIC_MAP_PAGE_RW);
+            store_entry(pmut_entry, mut_entry);
 
             mut_deallocate_on_error.ignore();
             return {page_virt, page_phys};
@@ -2089,7 +3563,11 @@ namespace lib
         ///     list of all of the entries associated with the map. It is
         ///     the caller's responsibility to flush the TLB as needed. This
         ///     might include the need to flush the unmapped page on all PPs
-        ///     that have touched the page.
+        ///     that have touched the page. If the page is part of a larger
+        ///     block (for example, one that map() promoted), the block is
+        ///     first split into smaller blocks, which needs a table from the
+        ///     page pool. If set_defer_release() was used, nothing is
+        ///     returned to the page pool.
         ///
         /// <!-- inputs/outputs -->
         ///   @tparam E the entry type to use. Valid inputs are L2E_TYPE, L1E_TYPE
@@ -2099,6 +3577,7 @@ namespace lib
         ///   @param tls the current TLS block
         ///   @param mut_page_pool the page_pool_t to use
         ///   @param page_virt the virtual address to unmap
+        ///   @param mut_sys the bf_syscall_t to use (optional)
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     and friends otherwise
         ///
@@ -2107,7 +3586,8 @@ namespace lib
         unmap(
             TLS_TYPE const &tls,
             PAGE_POOL_TYPE &mut_page_pool,
-            bsl::safe_u64 const &page_virt) noexcept -> bsl::errc_type
+            bsl::safe_u64 const &page_virt,
+            SYS_TYPE &mut_sys = bsl::dontcare) noexcept -> bsl::errc_type
         {
             static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE, L0E_TYPE>::value);
 
@@ -2127,6 +3607,17 @@ namespace lib
             }
 
             basic_lock_guard_t mut_lock{tls, m_lock};
+
+            if constexpr (!bsl::is_same<E, L2E_TYPE>::value) {
+                auto const ret{this->split_to<E>(tls, mut_page_pool, page_virt, mut_sys)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                bsl::touch();
+            }
+
             auto const ents{this->get_for_query<E>(mut_page_pool, page_virt)};
 
             if (bsl::unlikely(nullptr == ents.l3e)) {
@@ -2136,32 +3627,166 @@ namespace lib
 
             if constexpr (bsl::is_same<E, L2E_TYPE>::value) {
                 ents.l2e->explicit_unmap = bsl::safe_u64::magic_0().get();
-                release_entry(tls, mut_page_pool, ents.l2e, true);
-                release_entry(tls, mut_page_pool, ents.l3e, false);
-                return bsl::errc_success;
+                this->release_entry(tls, mut_page_pool, ents.l2e, true);
             }
 
             if constexpr (bsl::is_same<E, L1E_TYPE>::value) {
                 ents.l1e->explicit_unmap = bsl::safe_u64::magic_0().get();
-                release_entry(tls, mut_page_pool, ents.l1e, true);
-                release_entry(tls, mut_page_pool, ents.l2e, false);
-                release_entry(tls, mut_page_pool, ents.l3e, false);
-                return bsl::errc_success;
+                this->release_entry(tls, mut_page_pool, ents.l1e, true);
             }
 
             if constexpr (bsl::is_same<E, L0E_TYPE>::value) {
                 ents.l0e->explicit_unmap = bsl::safe_u64::magic_0().get();
-                release_entry(tls, mut_page_pool, ents.l0e, true);
-                release_entry(tls, mut_page_pool, ents.l1e, false);
-                release_entry(tls, mut_page_pool, ents.l2e, false);
-                release_entry(tls, mut_page_pool, ents.l3e, false);
+                if (m_defer_release) {
+                    ents.l0e->auto_release = bsl::safe_u64::magic_0().get();
+                }
+                else {
+                    bsl::touch();
+                }
+
+                this->release_entry(tls, mut_page_pool, ents.l0e, true);
+            }
+
+            if (m_defer_release) {
                 return bsl::errc_success;
             }
+
+            if constexpr (bsl::is_same<E, L0E_TYPE>::value) {
+                this->release_entry(tls, mut_page_pool, ents.l1e, false);
+            }
+
+            if constexpr (!bsl::is_same<E, L2E_TYPE>::value) {
+                this->release_entry(tls, mut_page_pool, ents.l2e, false);
+            }
+
+            this->release_entry(tls, mut_page_pool, ents.l3e, false);
+
+            /// NOTE:
+            /// - Tables retired by a previous unmap() while a query was in
+            ///   flight are released here if that query has since finished,
+            ///   unless they are being held until flushed() is called.
+            ///
+
+            if (!m_hold_retired && this->is_quiescent()) {
+                this->release_retired(tls, mut_page_pool);
+            }
+            else {
+                bsl::touch();
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Changes the flags of a page that is already mapped into
+        ///     the root page table, without ever unmapping it. If the page
+        ///     is part of a larger block, the block is first split (just
+        ///     like unmap() does), which needs a table from the page pool.
+        ///     If the page was instead mapped using smaller pages, all of
+        ///     them are changed. Once changed, tables that map one
+        ///     contiguous, aligned and identically flagged range are
+        ///     promoted the same way map() promotes them. It is the
+        ///     caller's responsibility to flush the TLB as needed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the entry type to use. Valid inputs are L2E_TYPE, L1E_TYPE
+        ///     and L0E_TYPE. If L2E_TYPE is provided, a 1G range is changed. If
+        ///     L1E_TYPE is provided, a 2M range is changed. If L0E_TYPE is
+        ///     provided, a 4K range is changed. Defaults to L0E_TYPE (i.e. 4k).
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address of the page to change
+        ///   @param page_flgs the new flags to give the page
+        ///   @param mut_sys the bf_syscall_t to use (optional)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        template<typename E = L0E_TYPE>
+        [[nodiscard]] constexpr auto
+        set_page_flgs(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &page_virt,
+            bsl::safe_u64 const &page_flgs,
+            SYS_TYPE &mut_sys = bsl::dontcare) noexcept -> bsl::errc_type
+        {
+            static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE, L0E_TYPE>::value);
+
+            bsl::expects(nullptr != m_l3t);
+            bsl::expects(page_virt.is_valid_and_checked());
+            bsl::expects(page_flgs.is_valid_and_checked());
+
+            if constexpr (bsl::is_same<E, L2E_TYPE>::value) {
+                bsl::expects(is_page_1g_aligned(page_virt));
+            }
+
+            if constexpr (bsl::is_same<E, L1E_TYPE>::value) {
+                bsl::expects(is_page_2m_aligned(page_virt));
+            }
+
+            if constexpr (bsl::is_same<E, L0E_TYPE>::value) {
+                bsl::expects(is_page_4k_aligned(page_virt));
+            }
+
+            basic_lock_guard_t mut_lock{tls, m_lock};
+
+            if constexpr (!bsl::is_same<E, L2E_TYPE>::value) {
+                auto const ret{this->split_to<E>(tls, mut_page_pool, page_virt, mut_sys)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                bsl::touch();
+            }
+
+            auto const ents{this->get_for_update<E>(mut_page_pool, page_virt)};
+            auto *const pmut_entry{get_entry_from_entries<E>(ents)};
+
+            if (bsl::unlikely(nullptr == pmut_entry)) {
+                bsl::error() << "virtual address "     // --
+                             << bsl::hex(page_virt)    // --
+                             << " is not mapped"       // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return bsl::errc_failure;
+            }
+
+            set_entry_flgs(mut_page_pool, pmut_entry, page_flgs);
+
+            if constexpr (bsl::is_same<E, L0E_TYPE>::value) {
+                this->promote<E>(tls, mut_page_pool, ents);
+            }
+
+            if constexpr (bsl::is_same<E, L1E_TYPE>::value) {
+                bsl::discard(this->promote_table(tls, mut_page_pool, ents.l1e));
+                this->promote<E>(tls, mut_page_pool, ents);
+            }
+
+            if constexpr (bsl::is_same<E, L2E_TYPE>::value) {
+                if (m_promote_1g) {
+                    bsl::discard(this->promote_table(tls, mut_page_pool, ents.l2e));
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            return bsl::errc_success;
         }
 
         /// <!-- description -->
         ///   @brief Returns all of the entries that are identified during the
-        ///     translation of the provided virtual address.
+        ///     translation of the provided virtual address. Unlike map() and
+        ///     unmap(), this does not acquire the RPT's lock, meaning any
+        ///     number of PPs can query the RPT at the same time, even while
+        ///     another PP is modifying it. Tables that are removed from the
+        ///     RPT while a query is in flight are not returned to the page
+        ///     pool until the query is done walking them. Note that, just
+        ///     like before, the entries that are returned are only stable
+        ///     so long as the caller does not race with an unmap() of the
+        ///     same address.
         ///
         /// <!-- inputs/outputs -->
         ///   @tparam E the entry type requested. L2E_TYPE for a 1G request,
@@ -2196,8 +3821,142 @@ namespace lib
                 bsl::expects(is_page_4k_aligned(page_virt));
             }
 
+            bsl::discard(tls);
+
+            auto const epoch{this->query_begin()};
+            auto const ents{this->get_for_query<E>(mut_page_pool, page_virt)};
+            this->query_end(epoch);
+
+            return ents;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the size of the page that maps the provided
+        ///     virtual address (which might have been promoted by map() or
+        ///     split by unmap()), or 0 if the address is not mapped. Like
+        ///     entries(), this does not acquire the RPT's lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address to look up
+        ///   @return Returns the size of the page that maps the provided
+        ///     virtual address, or 0 if the address is not mapped.
+        ///
+        [[nodiscard]] constexpr auto
+        page_size(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &page_virt) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(nullptr != m_l3t);
+            bsl::expects(page_virt.is_valid_and_checked());
+
+            bsl::discard(tls);
+
+            auto const epoch{this->query_begin()};
+            auto const size{this->get_page_size(mut_page_pool, page_virt)};
+            this->query_end(epoch);
+
+            return size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Calls mut_func(virt, bytes, mut_entry) for every block
+        ///     that is mapped by the RPT, where virt and bytes describe the
+        ///     block and mut_entry is a copy of the entry that maps it. If
+        ///     mut_func returns true, the copy is written back to the RPT.
+        ///     This is how the accessed/dirty flags that the hardware sets
+        ///     are collected and cleared. Aliases are skipped, and virt is
+        ///     never sign extended. The RPT's lock is held while the blocks
+        ///     are visited, so mut_func must not call back into the RPT.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FUNC the type of function to call
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param mut_func the function to call for each block
+        ///
+        template<typename FUNC>
+        constexpr void
+        for_each_block(TLS_TYPE const &tls, PAGE_POOL_TYPE &mut_page_pool, FUNC &&mut_func) noexcept
+        {
+            bsl::expects(nullptr != m_l3t);
+
+            basic_lock_guard_t mut_lock{tls, m_lock};
+
+            auto const bytes{entry_bytes<L3E_TYPE>()};
+            for (bsl::safe_idx mut_i{}; mut_i < m_l3t->entries.size(); ++mut_i) {
+                auto const virt{(bsl::to_u64(mut_i) * bytes).checked()};
+                for_each_block_in_entry(mut_page_pool, m_l3t->entries.at_if(mut_i), virt, mut_func);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Same as for_each_block(), but only for the block that
+        ///     maps the provided virtual address.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FUNC the type of function to call
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address of the block to update
+        ///   @param mut_func the function to call for the block
+        ///   @return Returns the size of the block that maps the provided
+        ///     virtual address, or 0 if the address is not mapped (in which
+        ///     case mut_func is not called).
+        ///
+        template<typename FUNC>
+        [[nodiscard]] constexpr auto
+        update_block(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &page_virt,
+            FUNC &&mut_func) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(nullptr != m_l3t);
+            bsl::expects(page_virt.is_valid_and_checked());
+
             basic_lock_guard_t mut_lock{tls, m_lock};
-            return this->get_for_query<E>(mut_page_pool, page_virt);
+
+            auto *const pmut_l3e{m_l3t->entries.at_if(virt_to_l3to(page_virt))};
+            if (entry_status(pmut_l3e) != basic_entry_status_t::present) {
+                return {};
+            }
+
+            auto *const pmut_l2t{entry_to_table(mut_page_pool, pmut_l3e)};
+            auto *const pmut_l2e{pmut_l2t->entries.at_if(virt_to_l2to(page_virt))};
+            if (entry_status(pmut_l2e) != basic_entry_status_t::present) {
+                return {};
+            }
+
+            if (bsl::safe_u64::magic_1() == pmut_l2e->points_to_block) {
+                auto const virt{(page_virt & ~BASIC_PAGE_1G_T_MASK).checked()};
+                for_each_block_in_entry(mut_page_pool, pmut_l2e, virt, mut_func);
+                return bsl::to_u64(BASIC_PAGE_1G_T_SIZE);
+            }
+
+            auto *const pmut_l1t{entry_to_table(mut_page_pool, pmut_l2e)};
+            auto *const pmut_l1e{pmut_l1t->entries.at_if(virt_to_l1to(page_virt))};
+            if (entry_status(pmut_l1e) != basic_entry_status_t::present) {
+                return {};
+            }
+
+            if (bsl::safe_u64::magic_1() == pmut_l1e->points_to_block) {
+                auto const virt{(page_virt & ~BASIC_PAGE_2M_T_MASK).checked()};
+                for_each_block_in_entry(mut_page_pool, pmut_l1e, virt, mut_func);
+                return bsl::to_u64(BASIC_PAGE_2M_T_SIZE);
+            }
+
+            auto *const pmut_l0t{entry_to_table(mut_page_pool, pmut_l1e)};
+            auto *const pmut_l0e{pmut_l0t->entries.at_if(virt_to_l0to(page_virt))};
+            if (entry_status(pmut_l0e) != basic_entry_status_t::present) {
+                return {};
+            }
+
+            auto const virt{(page_virt & ~BASIC_PAGE_4K_T_MASK).checked()};
+            for_each_block_in_entry(mut_page_pool, pmut_l0e, virt, mut_func);
+            return bsl::to_u64(BASIC_PAGE_4K_T_SIZE);
         }
 
         /// <!-- description -->
@@ -2228,8 +3987,9 @@ namespace lib
                     continue;
                 }
 
-                *pmut_dst_l3e = *src_l3e;
-                pmut_dst_l3e->alias = bsl::safe_u64::magic_1().get();
+                L3E_TYPE mut_l3e{*src_l3e};
+                mut_l3e.alias = bsl::safe_u64::magic_1().get();
+                store_entry(pmut_dst_l3e, mut_l3e);
             }
         }
 
@@ -2250,6 +4010,43 @@ namespace lib
         {
             this->add_tables(tls, rpt.m_l3t);
         }
+
+        /// <!-- description -->
+        ///   @brief Given a root page table, any aliased entries in this
+        ///     root page table that are no longer present in the provided
+        ///     root page table are removed. This should be called after
+        ///     memory is unmapped from the provided root page table, as the
+        ///     unmap might have returned a table that was previously aliased
+        ///     by add_tables() back to the page_pool_t. Only entries with the
+        ///     alias bit set are removed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param rpt the root page table to remove stale aliases from
+        ///
+        constexpr void
+        remove_stale_tables(TLS_TYPE const &tls, basic_root_page_table_t const &rpt) noexcept
+        {
+            bsl::expects(nullptr != m_l3t);
+            bsl::expects(nullptr != rpt.m_l3t);
+
+            basic_lock_guard_t mut_lock{tls, m_lock};
+
+            for (bsl::safe_idx mut_i{}; mut_i < rpt.m_l3t->entries.size(); ++mut_i) {
+                auto const *const src_l3e{rpt.m_l3t->entries.at_if(mut_i)};
+                auto *const pmut_dst_l3e{m_l3t->entries.at_if(mut_i)};
+
+                if (bsl::safe_u64::magic_0() == pmut_dst_l3e->alias) {
+                    continue;
+                }
+
+                if (entry_status(src_l3e) != basic_entry_status_t::not_present) {
+                    continue;
+                }
+
+                store_entry(pmut_dst_l3e, {});
+            }
+        }
     };
 }
 
@@ -0,0 +1,896 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BASIC_SECOND_LEVEL_PAGE_TABLE_T_HPP
+#define BASIC_SECOND_LEVEL_PAGE_TABLE_T_HPP
+
+#include <basic_ept_entry_t.hpp>
+#include <basic_npt_entry_t.hpp>
+#include <basic_page_1g_t.hpp>
+#include <basic_page_2m_t.hpp>
+#include <basic_page_4k_t.hpp>
+#include <basic_root_page_table_t.hpp>
+#include <second_level_page_table_helpers.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/dontcare_t.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Builds second level page tables (EPT on Intel, NPT on AMD)
+    ///     for an extension's VMs. The tables themselves are stored in a
+    ///     basic_root_page_table_t that is given EPT or NPT entries. What
+    ///     this adds on top of the RPT is the ability to work with ranges
+    ///     of guest physical memory instead of individual pages:
+    ///     - map() uses the largest blocks the alignment of a range allows
+    ///       (1G blocks only if the CPU supports them), and the RPT will
+    ///       promote smaller blocks on its own when a table fills up.
+    ///     - set_flgs() changes the access rights of a range, splitting
+    ///       blocks only where the range does not cover all of them.
+    ///     - unmap() removes a range no matter how it ended up being
+    ///       mapped (promoted, split, or a mix of both).
+    ///     - root_pointer() returns the EPTP or nCR3 for the tables.
+    ///     - clear_dirty() and harvest_dirty() collect and clear the dirty
+    ///       flags the hardware sets, which is how dirty pages are tracked
+    ///       on AMD, and how PML is re-armed for a page on Intel.
+    ///     - Every change is tracked so that the extension knows whether it
+    ///       has to flush the tables (INVEPT on Intel, a TLB flush of the
+    ///       VM on AMD), and which range of guest physical memory changed.
+    ///     - Tables that are removed (by promotion or unmap()) are not
+    ///       returned to the page pool until flushed() is called, as the
+    ///       hardware might still have them cached until then.
+    ///
+    ///     Just like the RPT, the tables can be changed by more than one PP
+    ///     at the same time, but the flush tracking is not atomic, so an
+    ///     extension that does this has to serialize its use of
+    ///     needs_flush() and flushed() itself.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam TLS_TYPE the type of TLS block to use
+    ///   @tparam SYS_TYPE the type of bf_syscall_t to use (optional)
+    ///   @tparam PAGE_POOL_TYPE the type page_pool_t to use
+    ///   @tparam INTRINSIC_TYPE the type intrinsic_t to use
+    ///   @tparam L3E_TYPE the level-3 page table entry to use
+    ///   @tparam L2E_TYPE the level-2 page table entry to use
+    ///   @tparam L1E_TYPE the level-1 page table entry to use
+    ///   @tparam L0E_TYPE the level-0 page table entry to use
+    ///
+    template<
+        typename TLS_TYPE,
+        typename SYS_TYPE,
+        typename PAGE_POOL_TYPE,
+        typename INTRINSIC_TYPE,
+        typename L3E_TYPE,
+        typename L2E_TYPE,
+        typename L1E_TYPE,
+        typename L0E_TYPE>
+    class basic_second_level_page_table_t final
+    {
+        /// @brief defines the type of RPT that stores the tables
+        using rpt_t = basic_root_page_table_t<
+            TLS_TYPE,
+            SYS_TYPE,
+            PAGE_POOL_TYPE,
+            INTRINSIC_TYPE,
+            L3E_TYPE,
+            L2E_TYPE,
+            L1E_TYPE,
+            L0E_TYPE>;
+
+        /// @brief stores the RPT that stores the tables
+        rpt_t m_rpt{};
+        /// @brief stores whether or not 1G blocks can be used
+        bool m_page_1g{};
+        /// @brief stores whether or not the EPTP enables accessed/dirty flags
+        bool m_accessed_dirty{};
+        /// @brief stores the first GPA that changed since flushed()
+        bsl::safe_u64 m_flush_gpa{};
+        /// @brief stores the GPA after the last one that changed since flushed()
+        bsl::safe_u64 m_flush_end{};
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided address is aligned to the
+        ///     provided block size.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param addr the address to check
+        ///   @param size the size of the block to check against
+        ///   @return Returns true if the provided address is aligned to the
+        ///     provided block size.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_aligned(bsl::safe_u64 const &addr, bsl::safe_umx const &size) noexcept -> bool
+        {
+            auto const mask{(bsl::to_u64(size) - bsl::safe_u64::magic_1()).checked()};
+            return (addr & mask).is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the largest block size that can be used to map
+        ///     the start of a range given its alignment and the number of
+        ///     bytes that are left.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gpa the guest physical address of the block
+        ///   @param spa the system physical address of the block
+        ///   @param bytes the number of bytes left in the range
+        ///   @return Returns the largest block size that can be used.
+        ///
+        [[nodiscard]] constexpr auto
+        block_size(
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &spa,
+            bsl::safe_u64 const &bytes) const noexcept -> bsl::safe_u64
+        {
+            if (m_page_1g && (bytes >= BASIC_PAGE_1G_T_SIZE)) {
+                if (is_aligned(gpa | spa, BASIC_PAGE_1G_T_SIZE)) {
+                    return bsl::to_u64(BASIC_PAGE_1G_T_SIZE);
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (bytes >= BASIC_PAGE_2M_T_SIZE) {
+                if (is_aligned(gpa | spa, BASIC_PAGE_2M_T_SIZE)) {
+                    return bsl::to_u64(BASIC_PAGE_2M_T_SIZE);
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
+            return bsl::to_u64(BASIC_PAGE_4K_T_SIZE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds the provided range to the range that needs to be
+        ///     flushed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gpa the guest physical address of the range that changed
+        ///   @param bytes the number of bytes in the range that changed
+        ///
+        constexpr void
+        track(bsl::safe_u64 const &gpa, bsl::safe_u64 const &bytes) noexcept
+        {
+            auto const end{(gpa + bytes).checked()};
+
+            if (!this->needs_flush()) {
+                m_flush_gpa = gpa;
+                m_flush_end = end;
+                return;
+            }
+
+            if (gpa < m_flush_gpa) {
+                m_flush_gpa = gpa;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (end > m_flush_end) {
+                m_flush_end = end;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps a single block of the provided size.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param gpa the guest physical address to map
+        ///   @param spa the system physical address to map
+        ///   @param size the size of the block to map
+        ///   @param page_flgs defines how memory should be mapped
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        map_block(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &spa,
+            bsl::safe_u64 const &size,
+            bsl::safe_u64 const &page_flgs,
+            SYS_TYPE &mut_sys) noexcept -> bsl::errc_type
+        {
+            if (size == BASIC_PAGE_1G_T_SIZE) {
+                return m_rpt.template map<L2E_TYPE>(
+                    tls, mut_page_pool, gpa, spa, page_flgs, false, mut_sys);
+            }
+
+            if (size == BASIC_PAGE_2M_T_SIZE) {
+                return m_rpt.template map<L1E_TYPE>(
+                    tls, mut_page_pool, gpa, spa, page_flgs, false, mut_sys);
+            }
+
+            return m_rpt.template map<L0E_TYPE>(
+                tls, mut_page_pool, gpa, spa, page_flgs, false, mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Changes the flags of a single block of the provided size.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param gpa the guest physical address of the block
+        ///   @param size the size of the block to change
+        ///   @param page_flgs the new flags to give the block
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        set_block_flgs(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &size,
+            bsl::safe_u64 const &page_flgs,
+            SYS_TYPE &mut_sys) noexcept -> bsl::errc_type
+        {
+            if (size == BASIC_PAGE_1G_T_SIZE) {
+                return m_rpt.template set_page_flgs<L2E_TYPE>(
+                    tls, mut_page_pool, gpa, page_flgs, mut_sys);
+            }
+
+            if (size == BASIC_PAGE_2M_T_SIZE) {
+                return m_rpt.template set_page_flgs<L1E_TYPE>(
+                    tls, mut_page_pool, gpa, page_flgs, mut_sys);
+            }
+
+            return m_rpt.template set_page_flgs<L0E_TYPE>(
+                tls, mut_page_pool, gpa, page_flgs, mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps a single block of the provided size.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param gpa the guest physical address of the block
+        ///   @param size the size of the block to unmap
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        unmap_block(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &size,
+            SYS_TYPE &mut_sys) noexcept -> bsl::errc_type
+        {
+            if (size == BASIC_PAGE_1G_T_SIZE) {
+                return m_rpt.template unmap<L2E_TYPE>(tls, mut_page_pool, gpa, mut_sys);
+            }
+
+            if (size == BASIC_PAGE_2M_T_SIZE) {
+                return m_rpt.template unmap<L1E_TYPE>(tls, mut_page_pool, gpa, mut_sys);
+            }
+
+            return m_rpt.template unmap<L0E_TYPE>(tls, mut_page_pool, gpa, mut_sys);
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Initializes this basic_second_level_page_table_t
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_1g_supported true if the CPU supports 1G blocks
+        ///     in its second level page tables
+        ///   @param mut_sys the bf_syscall_t to use (optional)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        initialize(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bool const page_1g_supported,
+            SYS_TYPE &mut_sys = bsl::dontcare) noexcept -> bsl::errc_type
+        {
+            auto const ret{m_rpt.initialize(tls, mut_page_pool, mut_sys)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            m_page_1g = page_1g_supported;
+            m_rpt.set_promote(true);
+            m_rpt.set_promote_1g(page_1g_supported);
+            m_rpt.set_hold_retired(true);
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases all of the resources used by this
+        ///     basic_second_level_page_table_t. The tables must no longer
+        ///     be in use by any VM when this is called.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///
+        constexpr void
+        release(TLS_TYPE const &tls, PAGE_POOL_TYPE &mut_page_pool) noexcept
+        {
+            m_rpt.release(tls, mut_page_pool);
+
+            m_page_1g = {};
+            m_accessed_dirty = {};
+            m_flush_gpa = {};
+            m_flush_end = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if this basic_second_level_page_table_t
+        ///     is initialized. Returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if this basic_second_level_page_table_t
+        ///     is initialized. Returns false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        is_initialized() const noexcept -> bool
+        {
+            return m_rpt.is_initialized();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value that tells the hardware where the
+        ///     tables are. For EPT this is the EPTP (write-back, 4-level,
+        ///     accessed/dirty flags only if set_accessed_dirty() was given
+        ///     true), which is written to the VMCS. For NPT this is the
+        ///     nCR3, which is written to the VMCB.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the EPTP or nCR3 for the tables.
+        ///
+        [[nodiscard]] constexpr auto
+        root_pointer() const noexcept -> bsl::safe_u64
+        {
+            return helpers::second_level_root_pointer<L3E_TYPE>(m_rpt.spa(), m_accessed_dirty);
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the hardware to set the accessed and dirty flags
+        ///     of the tables (by way of root_pointer(), so the EPTP has to
+        ///     be written again after this is called). Intel needs this for
+        ///     page-modification logging. AMD always sets these flags, so
+        ///     for NPT this does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val if true, the accessed and dirty flags are enabled
+        ///
+        constexpr void
+        set_accessed_dirty(bool const val) noexcept
+        {
+            m_accessed_dirty = val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps a range of guest physical memory to a range of
+        ///     system physical memory, using the largest blocks that the
+        ///     alignment of both ranges allows. If any part of the range
+        ///     fails to map, the parts that were already mapped are
+        ///     unmapped before returning.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param gpa the guest physical address to map (4k aligned)
+        ///   @param spa the system physical address to map (4k aligned)
+        ///   @param bytes the number of bytes to map (a multiple of 4k)
+        ///   @param page_flgs defines how memory should be mapped
+        ///   @param mut_sys the bf_syscall_t to use (optional)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        map(TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &spa,
+            bsl::safe_u64 const &bytes,
+            bsl::safe_u64 const &page_flgs,
+            SYS_TYPE &mut_sys = bsl::dontcare) noexcept -> bsl::errc_type
+        {
+            bsl::expects(this->is_initialized());
+            bsl::expects(gpa.is_valid_and_checked());
+            bsl::expects(is_aligned(gpa, BASIC_PAGE_4K_T_SIZE));
+            bsl::expects(spa.is_valid_and_checked());
+            bsl::expects(is_aligned(spa, BASIC_PAGE_4K_T_SIZE));
+            bsl::expects(bytes.is_valid_and_checked());
+            bsl::expects(bytes.is_pos());
+            bsl::expects(is_aligned(bytes, BASIC_PAGE_4K_T_SIZE));
+            bsl::expects(page_flgs.is_valid_and_checked());
+
+            bsl::safe_u64 mut_off{};
+            while (mut_off < bytes) {
+                auto const block_gpa{(gpa + mut_off).checked()};
+                auto const block_spa{(spa + mut_off).checked()};
+                auto const left{(bytes - mut_off).checked()};
+                auto const size{this->block_size(block_gpa, block_spa, left)};
+
+                auto const ret{this->map_block(
+                    tls, mut_page_pool, block_gpa, block_spa, size, page_flgs, mut_sys)};
+
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+
+                    if (mut_off.is_pos()) {
+                        bsl::discard(this->unmap(tls, mut_page_pool, gpa, mut_off, mut_sys));
+                    }
+                    else {
+                        bsl::touch();
+                    }
+
+                    return ret;
+                }
+
+                mut_off += size;
+            }
+
+            /// NOTE:
+            /// - Adding a translation does not need a flush on its own, but
+            ///   map() might have promoted tables that the hardware still
+            ///   has cached, so the range is tracked anyway.
+            ///
+
+            this->track(gpa, bytes);
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps a range of guest physical memory to the same range
+        ///     of system physical memory (i.e., an identity map), which is
+        ///     what the root VM usually needs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param gpa the first address to map (4k aligned)
+        ///   @param bytes the number of bytes to map (a multiple of 4k)
+        ///   @param page_flgs defines how memory should be mapped
+        ///   @param mut_sys the bf_syscall_t to use (optional)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        map_identity(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &bytes,
+            bsl::safe_u64 const &page_flgs,
+            SYS_TYPE &mut_sys = bsl::dontcare) noexcept -> bsl::errc_type
+        {
+            return this->map(tls, mut_page_pool, gpa, gpa, bytes, page_flgs, mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Changes the access rights of a range of guest physical
+        ///     memory that is already mapped. Blocks that are only partly
+        ///     covered by the range are split, and tables whose blocks end
+        ///     up with the same access rights again are promoted by the RPT.
+        ///     The translations are never removed, and tables that are
+        ///     promoted away are held until flushed() is called, so a VM
+        ///     can keep running while this is called, but the change is not
+        ///     guaranteed to be seen by the VM until the tables are flushed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param gpa the guest physical address to change (4k aligned)
+        ///   @param bytes the number of bytes to change (a multiple of 4k)
+        ///   @param page_flgs the new access rights of the range. A value of
+        ///     0 leaves the range mapped, but without any access rights.
+        ///   @param mut_sys the bf_syscall_t to use (optional)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        set_flgs(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &bytes,
+            bsl::safe_u64 const &page_flgs,
+            SYS_TYPE &mut_sys = bsl::dontcare) noexcept -> bsl::errc_type
+        {
+            bsl::expects(this->is_initialized());
+            bsl::expects(gpa.is_valid_and_checked());
+            bsl::expects(is_aligned(gpa, BASIC_PAGE_4K_T_SIZE));
+            bsl::expects(bytes.is_valid_and_checked());
+            bsl::expects(bytes.is_pos());
+            bsl::expects(is_aligned(bytes, BASIC_PAGE_4K_T_SIZE));
+            bsl::expects(page_flgs.is_valid_and_checked());
+
+            /// NOTE:
+            /// - The range is tracked before anything is changed, as a
+            ///   failure part way through still leaves the first part of
+            ///   the range changed.
+            ///
+
+            this->track(gpa, bytes);
+
+            bsl::safe_u64 mut_off{};
+            while (mut_off < bytes) {
+                auto const block_gpa{(gpa + mut_off).checked()};
+                auto const left{(bytes - mut_off).checked()};
+                auto const size{this->block_size(block_gpa, block_gpa, left)};
+
+                auto const ret{
+                    this->set_block_flgs(tls, mut_page_pool, block_gpa, size, page_flgs, mut_sys)};
+
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                mut_off += size;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps a range of guest physical memory. The range does
+        ///     not have to match how it was mapped. Blocks that are only
+        ///     partly covered by the range are split, and blocks that are
+        ///     smaller than the range's alignment allows (for example
+        ///     because set_flgs() split them) are unmapped one by one.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param gpa the guest physical address to unmap (4k aligned)
+        ///   @param bytes the number of bytes to unmap (a multiple of 4k)
+        ///   @param mut_sys the bf_syscall_t to use (optional)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        unmap(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &bytes,
+            SYS_TYPE &mut_sys = bsl::dontcare) noexcept -> bsl::errc_type
+        {
+            bsl::expects(this->is_initialized());
+            bsl::expects(gpa.is_valid_and_checked());
+            bsl::expects(is_aligned(gpa, BASIC_PAGE_4K_T_SIZE));
+            bsl::expects(bytes.is_valid_and_checked());
+            bsl::expects(bytes.is_pos());
+            bsl::expects(is_aligned(bytes, BASIC_PAGE_4K_T_SIZE));
+
+            this->track(gpa, bytes);
+
+            bsl::safe_u64 mut_off{};
+            while (mut_off < bytes) {
+                auto const block_gpa{(gpa + mut_off).checked()};
+                auto const left{(bytes - mut_off).checked()};
+                auto mut_size{this->block_size(block_gpa, block_gpa, left)};
+
+                auto const mapped{m_rpt.page_size(tls, mut_page_pool, block_gpa)};
+                if (bsl::unlikely(mapped.is_zero())) {
+                    bsl::error() << "gpa "                 // --
+                                 << bsl::hex(block_gpa)    // --
+                                 << " is not mapped"       // --
+                                 << bsl::endl              // --
+                                 << bsl::here();           // --
+
+                    return bsl::errc_failure;
+                }
+
+                if (mapped < mut_size) {
+                    mut_size = mapped;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                auto const ret{this->unmap_block(tls, mut_page_pool, block_gpa, mut_size, mut_sys)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                mut_off += mut_size;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the size of the block that maps the provided
+        ///     guest physical address, or 0 if it is not mapped.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param gpa the guest physical address to look up
+        ///   @return Returns the size of the block that maps the provided
+        ///     guest physical address, or 0 if it is not mapped.
+        ///
+        [[nodiscard]] constexpr auto
+        page_size(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &gpa) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(this->is_initialized());
+            return m_rpt.page_size(tls, mut_page_pool, gpa);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the access rights of the block that maps the
+        ///     provided guest physical address, or 0 if it is not mapped
+        ///     (or if it is mapped without any access rights).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param gpa the guest physical address to look up
+        ///   @return Returns the access rights of the block that maps the
+        ///     provided guest physical address, or 0 if it is not mapped.
+        ///
+        [[nodiscard]] constexpr auto
+        page_flgs(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &gpa) noexcept -> bsl::safe_u64
+        {
+            auto const size{this->page_size(tls, mut_page_pool, gpa)};
+
+            if (size == BASIC_PAGE_1G_T_SIZE) {
+                auto const block{(gpa & ~BASIC_PAGE_1G_T_MASK).checked()};
+                auto const ents{m_rpt.template entries<L2E_TYPE>(tls, mut_page_pool, block)};
+                return helpers::entry_to_page_flgs(ents.l2e);
+            }
+
+            if (size == BASIC_PAGE_2M_T_SIZE) {
+                auto const block{(gpa & ~BASIC_PAGE_2M_T_MASK).checked()};
+                auto const ents{m_rpt.template entries<L1E_TYPE>(tls, mut_page_pool, block)};
+                return helpers::entry_to_page_flgs(ents.l1e);
+            }
+
+            if (size == BASIC_PAGE_4K_T_SIZE) {
+                auto const block{(gpa & ~BASIC_PAGE_4K_T_MASK).checked()};
+                auto const ents{m_rpt.template entries<L0E_TYPE>(tls, mut_page_pool, block)};
+                return helpers::entry_to_page_flgs(ents.l0e);
+            }
+
+            return {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Clears the dirty flag of the block that maps the
+        ///     provided guest physical address. Intel only logs a write to
+        ///     PML when it sets a dirty flag, so this is how a page that
+        ///     was drained from a PML buffer is armed again. Like any other
+        ///     change, the block is tracked, and the hardware might keep
+        ///     using its cached copy of the flag until the tables are
+        ///     flushed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param gpa the guest physical address of the block to clear
+        ///   @return Returns the size of the block that was cleared, or 0
+        ///     if the provided guest physical address is not mapped. A
+        ///     2M or 1G block is only logged once, so the extension has to
+        ///     treat the whole block as dirty.
+        ///
+        [[nodiscard]] constexpr auto
+        clear_dirty(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &gpa) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(this->is_initialized());
+            bsl::expects(gpa.is_valid_and_checked());
+
+            auto const size{m_rpt.update_block(
+                tls,
+                mut_page_pool,
+                gpa,
+                [](bsl::safe_u64 const &, bsl::safe_u64 const &, auto &mut_entry) noexcept -> bool {
+                    if (bsl::safe_u64::magic_0() == mut_entry.d) {
+                        return false;
+                    }
+
+                    mut_entry.d = bsl::safe_u64::magic_0().get();
+                    return true;
+                })};
+
+            if (size.is_pos()) {
+                auto const mask{(size - bsl::safe_u64::magic_1()).checked()};
+                this->track((gpa & ~mask).checked(), size);
+            }
+            else {
+                bsl::touch();
+            }
+
+            return size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Calls mut_func(gpa, bytes) for every block whose dirty
+        ///     flag is set, and clears the flag. This is how dirty pages
+        ///     are tracked when PML is not available (i.e., on AMD). Every
+        ///     block that is reported is tracked, so the tables have to be
+        ///     flushed before the next call can be relied on. mut_func is
+        ///     called while the tables are locked, so it must not call back
+        ///     into this basic_second_level_page_table_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FUNC the type of function to call
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param mut_func the function to call for each dirty block
+        ///
+        template<typename FUNC>
+        constexpr void
+        harvest_dirty(TLS_TYPE const &tls, PAGE_POOL_TYPE &mut_page_pool, FUNC &&mut_func) noexcept
+        {
+            bsl::expects(this->is_initialized());
+
+            m_rpt.for_each_block(
+                tls,
+                mut_page_pool,
+                [this, &mut_func](
+                    bsl::safe_u64 const &gpa, bsl::safe_u64 const &bytes, auto &mut_entry) noexcept
+                -> bool {
+                    if (bsl::safe_u64::magic_0() == mut_entry.d) {
+                        return false;
+                    }
+
+                    mut_entry.d = bsl::safe_u64::magic_0().get();
+                    this->track(gpa, bytes);
+                    mut_func(gpa, bytes);
+
+                    return true;
+                });
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the tables changed since the last call
+        ///     to flushed(), meaning the extension has to flush the VM's
+        ///     second level translations (INVEPT on Intel, a TLB flush of
+        ///     the VM on AMD) before it relies on the change.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the tables need to be flushed.
+        ///
+        [[nodiscard]] constexpr auto
+        needs_flush() const noexcept -> bool
+        {
+            return m_flush_end.is_pos();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the first guest physical address that changed
+        ///     since the last call to flushed(). Neither INVEPT nor AMD's
+        ///     TLB control can invalidate a single guest physical address,
+        ///     but an extension can use this (along with flush_bytes()) to
+        ///     skip a flush if the range does not matter to it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the first guest physical address that changed
+        ///     since the last call to flushed().
+        ///
+        [[nodiscard]] constexpr auto
+        flush_gpa() const noexcept -> bsl::safe_u64
+        {
+            return m_flush_gpa;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes, starting at flush_gpa(),
+        ///     that contain every change since the last call to flushed().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of bytes, starting at flush_gpa(),
+        ///     that contain every change since the last call to flushed().
+        ///
+        [[nodiscard]] constexpr auto
+        flush_bytes() const noexcept -> bsl::safe_u64
+        {
+            return (m_flush_end - m_flush_gpa).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells this basic_second_level_page_table_t that the
+        ///     extension flushed the tables on every PP the VM might be
+        ///     running on, which resets the tracking and returns any table
+        ///     that was removed since the last call to the page pool.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///
+        constexpr void
+        flushed(TLS_TYPE const &tls, PAGE_POOL_TYPE &mut_page_pool) noexcept
+        {
+            m_rpt.flushed(tls, mut_page_pool);
+
+            m_flush_gpa = {};
+            m_flush_end = {};
+        }
+    };
+
+    /// @brief defines a basic_second_level_page_table_t that builds EPT
+    template<typename TLS_TYPE, typename SYS_TYPE, typename PAGE_POOL_TYPE, typename INTRINSIC_TYPE>
+    using basic_ept_t = basic_second_level_page_table_t<
+        TLS_TYPE,
+        SYS_TYPE,
+        PAGE_POOL_TYPE,
+        INTRINSIC_TYPE,
+        ept_l3e_t,
+        ept_l2e_t,
+        ept_l1e_t,
+        ept_l0e_t>;
+
+    /// @brief defines a basic_second_level_page_table_t that builds NPT
+    template<typename TLS_TYPE, typename SYS_TYPE, typename PAGE_POOL_TYPE, typename INTRINSIC_TYPE>
+    using basic_npt_t = basic_second_level_page_table_t<
+        TLS_TYPE,
+        SYS_TYPE,
+        PAGE_POOL_TYPE,
+        INTRINSIC_TYPE,
+        npt_l3e_t,
+        npt_l2e_t,
+        npt_l1e_t,
+        npt_l0e_t>;
+}
+
+#endif
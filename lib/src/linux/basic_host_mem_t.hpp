@@ -0,0 +1,74 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BASIC_HOST_MEM_T_HPP
+#define BASIC_HOST_MEM_T_HPP
+
+#include <unistd.h>    // IWYU pragma: export
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Provides information about the host's physical memory.
+    ///
+    class basic_host_mem_t final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Returns the total number of bytes of physical memory
+        ///     installed in the host. On failure, returns
+        ///     bsl::safe_umx::failure().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of bytes of physical memory
+        ///     installed in the host. On failure, returns
+        ///     bsl::safe_umx::failure().
+        ///
+        [[nodiscard]] static auto
+        total() noexcept -> bsl::safe_umx
+        {
+            auto const pages{bsl::to_i64(sysconf(_SC_PHYS_PAGES))};
+            auto const page_size{bsl::to_i64(sysconf(_SC_PAGESIZE))};
+
+            if (bsl::unlikely(!pages.is_pos())) {
+                bsl::error() << "sysconf failed\n" << bsl::here();
+                return bsl::safe_umx::failure();
+            }
+
+            if (bsl::unlikely(!page_size.is_pos())) {
+                bsl::error() << "sysconf failed\n" << bsl::here();
+                return bsl::safe_umx::failure();
+            }
+
+            return (bsl::to_umx(pages) * bsl::to_umx(page_size)).checked();
+        }
+    };
+}
+
+#endif
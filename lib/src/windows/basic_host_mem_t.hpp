@@ -0,0 +1,81 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BASIC_HOST_MEM_T_HPP
+#define BASIC_HOST_MEM_T_HPP
+
+// clang-format off
+
+/// NOTE:
+/// - The windows includes that we use here need to remain in this order.
+///   Otherwise the code will not compile. Also, when using CPP, we need
+///   to remove the max/min macros as they are used by the C++ standard.
+///
+
+#include <Windows.h>
+#undef max
+#undef min
+
+// clang-format on
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Provides information about the host's physical memory.
+    ///
+    class basic_host_mem_t final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Returns the total number of bytes of physical memory
+        ///     installed in the host. On failure, returns
+        ///     bsl::safe_umx::failure().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of bytes of physical memory
+        ///     installed in the host. On failure, returns
+        ///     bsl::safe_umx::failure().
+        ///
+        [[nodiscard]] static auto
+        total() noexcept -> bsl::safe_umx
+        {
+            MEMORYSTATUSEX mut_status{};
+            mut_status.dwLength = sizeof(mut_status);
+
+            if (bsl::unlikely(!GlobalMemoryStatusEx(&mut_status))) {
+                bsl::error() << "GlobalMemoryStatusEx failed\n" << bsl::here();
+                return bsl::safe_umx::failure();
+            }
+
+            return bsl::to_umx(mut_status.ullTotalPhys);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,197 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <atomic>
+#include <chrono>
+#include <initialize_page_pool.hpp>
+#include <thread>
+#include <tls_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/touch.hpp>
+
+namespace lib
+{
+    /// @brief defines the max number of host threads used to emulate PPs
+    constexpr auto BENCHMARK_MAX_THREADS{64_umx};
+    /// @brief defines how much the number of host threads grows each run
+    constexpr auto BENCHMARK_THREADS_SCALE{2_umx};
+
+    /// @brief defines the direct map used by the benchmarks. Pages come
+    ///   from the host's own memory, so the direct map is the lower half
+    ///   of the host's address space (minus the first and last page).
+    constexpr auto BENCHMARK_MAP_ADDR{0x0000000000001000_umx};
+    /// @brief defines the size of the direct map used by the benchmarks
+    constexpr auto BENCHMARK_MAP_SIZE{0x00007FFFFFFFE000_umx};
+
+    /// @brief stores the TLS block for each host thread
+    constinit bsl::array<tls_t, BENCHMARK_MAX_THREADS.get()> g_mut_benchmark_tls{};
+    /// @brief stores how many host threads are ready to run
+    constinit std::atomic<bsl::uint64> g_mut_benchmark_ready{};
+    /// @brief set to true once all of the host threads are ready to run
+    constinit std::atomic<bool> g_mut_benchmark_go{};
+
+    /// <!-- description -->
+    ///   @brief Returns the current time in nanoseconds from a monotonic
+    ///     host clock.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the current time in nanoseconds from a monotonic
+    ///     host clock.
+    ///
+    [[nodiscard]] inline auto
+    benchmark_now() noexcept -> bsl::safe_u64
+    {
+        auto const now{std::chrono::steady_clock::now().time_since_epoch()};
+        auto const ns{std::chrono::duration_cast<std::chrono::nanoseconds>(now).count()};
+
+        return bsl::to_u64(static_cast<bsl::uint64>(ns));
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the number of host threads that should be used
+    ///     to emulate PPs, which is the number of host CPUs, capped at
+    ///     BENCHMARK_MAX_THREADS.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the number of host threads that should be used
+    ///     to emulate PPs.
+    ///
+    [[nodiscard]] inline auto
+    benchmark_max_threads() noexcept -> bsl::safe_umx
+    {
+        auto const cpus{bsl::to_umx(static_cast<bsl::uintmx>(std::thread::hardware_concurrency()))};
+
+        if (cpus.is_zero()) {
+            return bsl::safe_umx::magic_1();
+        }
+
+        if (cpus > BENCHMARK_MAX_THREADS) {
+            return BENCHMARK_MAX_THREADS;
+        }
+
+        return cpus;
+    }
+
+    /// <!-- description -->
+    ///   @brief Outputs the result of a benchmark as a single line of JSON
+    ///     so that results can be collected and tracked over time. All
+    ///     times are in nanoseconds.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param name the name of the benchmark
+    ///   @param size the granularity of the operation (e.g., 4k, 2m or 1g)
+    ///   @param threads the number of host threads that were used
+    ///   @param ops the total number of operations performed
+    ///   @param ns the total number of nanoseconds it took to perform ops
+    ///
+    inline void
+    benchmark_report(
+        bsl::string_view const &name,
+        bsl::string_view const &size,
+        bsl::safe_umx const &threads,
+        bsl::safe_u64 const &ops,
+        bsl::safe_u64 const &ns) noexcept
+    {
+        bsl::safe_u64 mut_ns_per_op{};
+        if (ops.is_pos()) {
+            mut_ns_per_op = (ns / ops).checked();
+        }
+        else {
+            bsl::touch();
+        }
+
+        bsl::print() << "{\"benchmark\":\"" << name << "\"";
+        bsl::print() << ",\"size\":\"" << size << "\"";
+        bsl::print() << ",\"threads\":" << threads;
+        bsl::print() << ",\"ops\":" << ops;
+        bsl::print() << ",\"ns\":" << ns;
+        bsl::print() << ",\"ns_per_op\":" << mut_ns_per_op;
+        bsl::print() << "}" << bsl::endl;
+    }
+
+    /// <!-- description -->
+    ///   @brief Runs func on the requested number of host threads, each
+    ///     of which is given its own TLS block with a unique ppid so that
+    ///     the threads look like PPs to the code being measured. The
+    ///     threads are released at the same time so that they contend
+    ///     with each other for as long as possible.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam FUNC the type of function to run
+    ///   @param threads the number of host threads to run func on
+    ///   @param func the function to run. Must have the signature
+    ///     void(tls_t &mut_tls, bsl::safe_idx const &i)
+    ///   @return Returns the number of nanoseconds it took for all of
+    ///     the host threads to finish.
+    ///
+    template<typename FUNC>
+    [[nodiscard]] auto
+    benchmark_threads(bsl::safe_umx const &threads, FUNC const &func) noexcept -> bsl::safe_u64
+    {
+        bsl::array<std::thread, BENCHMARK_MAX_THREADS.get()> mut_threads{};
+
+        g_mut_benchmark_ready = {};
+        g_mut_benchmark_go = false;
+
+        for (bsl::safe_idx mut_i{}; mut_i < threads; ++mut_i) {
+            auto *const pmut_tls{g_mut_benchmark_tls.at_if(mut_i)};
+            pmut_tls->ppid = bsl::to_u16(mut_i).get();
+            pmut_tls->online_pps = bsl::to_u16(threads).get();
+
+            *mut_threads.at_if(mut_i) = std::thread{[pmut_tls, mut_i, &func]() noexcept {
+                ++g_mut_benchmark_ready;
+                while (!g_mut_benchmark_go) {
+                    std::this_thread::yield();
+                }
+
+                func(*pmut_tls, mut_i);
+            }};
+        }
+
+        while (static_cast<bsl::uint64>(g_mut_benchmark_ready) < threads) {
+            std::this_thread::yield();
+        }
+
+        auto const start{benchmark_now()};
+        g_mut_benchmark_go = true;
+
+        for (bsl::safe_idx mut_i{}; mut_i < threads; ++mut_i) {
+            mut_threads.at_if(mut_i)->join();
+        }
+
+        return (benchmark_now() - start).checked();
+    }
+}
+
+#endif
@@ -0,0 +1,253 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "benchmark.hpp"
+
+#include <basic_bitmap_page_pool_t.hpp>
+#include <basic_page_4k_t.hpp>
+#include <basic_page_pool_node_t.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/touch.hpp>
+
+namespace lib
+{
+    /// @brief defines the number of pages in the page pool
+    constexpr auto POOL_PAGES{4096_umx};
+    /// @brief defines how many times the pool is drained and refilled
+    constexpr auto DRAIN_ITERATIONS{16_u64};
+    /// @brief defines the number of allocate/deallocate pairs per thread
+    constexpr auto CONTENTION_OPS{0x10000_u64};
+
+    /// @brief defines the page pool being measured. This uses the same
+    ///   pages and workloads as the page_pool benchmark so that the
+    ///   results of the two can be compared directly.
+    using page_pool_t = basic_bitmap_page_pool_t<
+        tls_t,
+        bool,
+        BENCHMARK_MAP_ADDR.get(),
+        BENCHMARK_MAP_SIZE.get()>;
+
+    /// @brief stores the pages given to the page pool
+    alignas(HYPERVISOR_PAGE_SIZE.get())
+        constinit bsl::array<basic_page_pool_node_t, POOL_PAGES.get()> g_mut_pool_pages{};
+    /// @brief stores the pages that are allocated while draining the pool
+    constinit bsl::array<basic_page_4k_t *, POOL_PAGES.get()> g_mut_allocated{};
+    /// @brief the page pool being measured
+    constinit page_pool_t g_mut_page_pool{};
+
+    /// <!-- description -->
+    ///   @brief Gives every page in g_mut_allocated back to the page pool
+    ///     in a single batch. Entries that are a nullptr (because some of
+    ///     the pool's pages were turned into leaves) are skipped.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param count the number of entries in g_mut_allocated to give back
+    ///
+    inline void
+    deallocate_all(bsl::safe_umx const &count) noexcept
+    {
+        tls_t mut_tls{};
+
+        bsl::safe_umx mut_valid{};
+        for (bsl::safe_idx mut_i{}; mut_i < count; ++mut_i) {
+            auto *const pmut_page{*g_mut_allocated.at_if(mut_i)};
+            if (nullptr != pmut_page) {
+                *g_mut_allocated.at_if(bsl::to_idx(mut_valid)) = pmut_page;
+                ++mut_valid;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        bsl::span<basic_page_4k_t *const> const pages{g_mut_allocated.data(), mut_valid};
+        g_mut_page_pool.deallocate_batch(mut_tls, pages);
+    }
+
+    /// <!-- description -->
+    ///   @brief Measures how long it takes to drain the entire page pool
+    ///     one page at a time, and then how long it takes to give every
+    ///     page back one at a time and as a single batch, using a single PP.
+    ///
+    inline void
+    benchmark_drain() noexcept
+    {
+        tls_t mut_tls{};
+        bool mut_sys{true};
+
+        bsl::safe_u64 mut_alloc_ns{};
+        bsl::safe_u64 mut_dealloc_ns{};
+        bsl::safe_u64 mut_batch_ns{};
+
+        for (bsl::safe_u64 mut_iter{}; mut_iter < DRAIN_ITERATIONS; ++mut_iter) {
+            auto const alloc_start{benchmark_now()};
+            for (bsl::safe_idx mut_i{}; mut_i < POOL_PAGES; ++mut_i) {
+                *g_mut_allocated.at_if(mut_i) =
+                    g_mut_page_pool.allocate<basic_page_4k_t>(mut_tls, mut_sys);
+            }
+            mut_alloc_ns += (benchmark_now() - alloc_start).checked();
+
+            auto const dealloc_start{benchmark_now()};
+            for (bsl::safe_idx mut_i{}; mut_i < POOL_PAGES; ++mut_i) {
+                auto *const pmut_page{*g_mut_allocated.at_if(mut_i)};
+                if (nullptr != pmut_page) {
+                    g_mut_page_pool.deallocate(mut_tls, pmut_page);
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            mut_dealloc_ns += (benchmark_now() - dealloc_start).checked();
+
+            for (bsl::safe_idx mut_i{}; mut_i < POOL_PAGES; ++mut_i) {
+                *g_mut_allocated.at_if(mut_i) =
+                    g_mut_page_pool.allocate<basic_page_4k_t>(mut_tls, mut_sys);
+            }
+
+            auto const batch_start{benchmark_now()};
+            deallocate_all(POOL_PAGES);
+            mut_batch_ns += (benchmark_now() - batch_start).checked();
+        }
+
+        auto const ops{(POOL_PAGES * DRAIN_ITERATIONS).checked()};
+        auto const threads{bsl::safe_umx::magic_1()};
+
+        benchmark_report("bitmap_page_pool.allocate", "4k", threads, ops, mut_alloc_ns.checked());
+        benchmark_report(
+            "bitmap_page_pool.deallocate", "4k", threads, ops, mut_dealloc_ns.checked());
+        benchmark_report(
+            "bitmap_page_pool.deallocate_batch", "4k", threads, ops, mut_batch_ns.checked());
+    }
+
+    /// <!-- description -->
+    ///   @brief Measures how long it takes to drain the entire page pool
+    ///     using physically contiguous runs of pages, which is something
+    ///     that the list based page pool cannot do at all.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pages the number of pages in each run
+    ///   @param size the size of each run, used to label the results
+    ///
+    inline void
+    benchmark_runs(bsl::safe_umx const &pages, bsl::string_view const &size) noexcept
+    {
+        tls_t mut_tls{};
+
+        auto const runs{(POOL_PAGES / pages).checked()};
+        bsl::safe_u64 mut_alloc_ns{};
+        bsl::safe_u64 mut_dealloc_ns{};
+
+        for (bsl::safe_u64 mut_iter{}; mut_iter < DRAIN_ITERATIONS; ++mut_iter) {
+            auto const alloc_start{benchmark_now()};
+            for (bsl::safe_idx mut_i{}; mut_i < runs; ++mut_i) {
+                *g_mut_allocated.at_if(mut_i) =
+                    g_mut_page_pool.allocate_n<basic_page_4k_t>(mut_tls, pages);
+            }
+            mut_alloc_ns += (benchmark_now() - alloc_start).checked();
+
+            auto const dealloc_start{benchmark_now()};
+            for (bsl::safe_idx mut_i{}; mut_i < runs; ++mut_i) {
+                auto *const pmut_run{*g_mut_allocated.at_if(mut_i)};
+                if (nullptr != pmut_run) {
+                    g_mut_page_pool.deallocate_n(mut_tls, pmut_run, pages);
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            mut_dealloc_ns += (benchmark_now() - dealloc_start).checked();
+        }
+
+        auto const ops{(bsl::to_u64(runs) * DRAIN_ITERATIONS).checked()};
+        auto const threads{bsl::safe_umx::magic_1()};
+
+        benchmark_report("bitmap_page_pool.allocate_n", size, threads, ops, mut_alloc_ns.checked());
+        benchmark_report(
+            "bitmap_page_pool.deallocate_n", size, threads, ops, mut_dealloc_ns.checked());
+    }
+
+    /// <!-- description -->
+    ///   @brief Measures allocate/deallocate pairs with 1, 2, 4, ... host
+    ///     threads, all of which share the same page pool and therefore
+    ///     contend for the same lock, the same way that PPs do.
+    ///
+    inline void
+    benchmark_contention() noexcept
+    {
+        auto const max{benchmark_max_threads()};
+        for (auto mut_threads{bsl::safe_umx::magic_1()}; mut_threads <= max;
+             mut_threads *= BENCHMARK_THREADS_SCALE) {
+            auto const ns{benchmark_threads(
+                mut_threads, [](tls_t &mut_tls, bsl::safe_idx const &i) noexcept {
+                    bool mut_sys{true};
+                    bsl::discard(i);
+
+                    for (bsl::safe_u64 mut_op{}; mut_op < CONTENTION_OPS; ++mut_op) {
+                        auto *const pmut_page{
+                            g_mut_page_pool.allocate<basic_page_4k_t>(mut_tls, mut_sys)};
+                        if (nullptr != pmut_page) {
+                            g_mut_page_pool.deallocate(mut_tls, pmut_page);
+                        }
+                        else {
+                            bsl::touch();
+                        }
+                    }
+                })};
+
+            auto const ops{(CONTENTION_OPS * bsl::to_u64(mut_threads)).checked()};
+            benchmark_report("bitmap_page_pool.allocate_deallocate", "4k", mut_threads, ops, ns);
+        }
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for the bitmap page pool benchmarks. Each result
+///     is written to the console as a single line of JSON.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    lib::initialize_page_pool(lib::g_mut_pool_pages, lib::g_mut_page_pool);
+
+    lib::benchmark_drain();
+    lib::benchmark_runs(2_umx, "8k");
+    lib::benchmark_runs(4_umx, "16k");
+    lib::benchmark_runs(8_umx, "32k");
+    lib::benchmark_contention();
+
+    return bsl::exit_success;
+}
@@ -0,0 +1,92 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "benchmark.hpp"
+
+#include <basic_queue_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace lib
+{
+    /// @brief defines the number of entries in the queue
+    constexpr auto QUEUE_SIZE{1024_umx};
+    /// @brief defines how many times the queue is filled and emptied
+    constexpr auto QUEUE_ITERATIONS{1024_u64};
+
+    /// @brief the queue being measured
+    constinit basic_queue_t<bsl::safe_u64, QUEUE_SIZE.get()> g_mut_queue{};
+
+    /// <!-- description -->
+    ///   @brief Measures how long it takes to fill the queue and then
+    ///     empty it again. basic_queue_t is not thread safe, so this is
+    ///     only measured with a single PP.
+    ///
+    inline void
+    benchmark_push_pop() noexcept
+    {
+        bsl::safe_u64 mut_push_ns{};
+        bsl::safe_u64 mut_pop_ns{};
+        bsl::safe_u64 mut_val{};
+
+        auto const entries{(QUEUE_SIZE - bsl::safe_umx::magic_1()).checked()};
+
+        for (bsl::safe_u64 mut_iter{}; mut_iter < QUEUE_ITERATIONS; ++mut_iter) {
+            auto const push_start{benchmark_now()};
+            for (bsl::safe_u64 mut_i{}; mut_i < entries; ++mut_i) {
+                bsl::discard(g_mut_queue.push(mut_i));
+            }
+            mut_push_ns += (benchmark_now() - push_start).checked();
+
+            auto const pop_start{benchmark_now()};
+            for (bsl::safe_u64 mut_i{}; mut_i < entries; ++mut_i) {
+                bsl::discard(g_mut_queue.pop(mut_val));
+            }
+            mut_pop_ns += (benchmark_now() - pop_start).checked();
+        }
+
+        auto const ops{(bsl::to_u64(entries) * QUEUE_ITERATIONS).checked()};
+        auto const threads{bsl::safe_umx::magic_1()};
+
+        benchmark_report("queue.push", "u64", threads, ops, mut_push_ns.checked());
+        benchmark_report("queue.pop", "u64", threads, ops, mut_pop_ns.checked());
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for the queue benchmarks. Each result is
+///     written to the console as a single line of JSON.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    lib::benchmark_push_pop();
+    return bsl::exit_success;
+}
@@ -0,0 +1,243 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "benchmark.hpp"
+
+#include <basic_map_page_flags.hpp>
+#include <basic_page_pool_node_t.hpp>
+#include <basic_page_pool_t.hpp>
+#include <basic_root_page_table_t.hpp>
+#include <intrinsic_t.hpp>
+#include <l0e_t.hpp>
+#include <l1e_t.hpp>
+#include <l2e_t.hpp>
+#include <l3e_t.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace lib
+{
+    /// @brief defines the number of pages in the page pool
+    constexpr auto POOL_PAGES{1024_umx};
+    /// @brief defines how many times each map/query/unmap pass is run
+    constexpr auto PASS_ITERATIONS{16_u64};
+    /// @brief defines how many times each thread maps/unmaps its pages
+    constexpr auto CONTENTION_ITERATIONS{64_u64};
+
+    /// @brief defines the virtual address where the benchmarks map memory
+    constexpr auto MAP_BASE{0x0000008000000000_u64};
+    /// @brief defines the number of pages mapped by each pass or thread
+    constexpr auto MAP_PAGES{512_u64};
+    /// @brief defines the number of 1g pages mapped by each pass
+    constexpr auto MAP_PAGES_1G{64_u64};
+
+    /// @brief defines the size of a 4k page
+    constexpr auto SIZE_4K{0x1000_u64};
+    /// @brief defines the size of a 2m page
+    constexpr auto SIZE_2M{0x200000_u64};
+    /// @brief defines the size of a 1g page
+    constexpr auto SIZE_1G{0x40000000_u64};
+
+    /// @brief defines the page pool used by the root page table
+    using page_pool_t = basic_page_pool_t<
+        tls_t,
+        bool,
+        BENCHMARK_MAP_ADDR.get(),
+        BENCHMARK_MAP_SIZE.get()>;
+
+    /// @brief defines the root page table being measured
+    using root_page_table_t = basic_root_page_table_t<
+        tls_t,
+        bool,
+        page_pool_t,
+        intrinsic_t,
+        l3e_t,
+        l2e_t,
+        l1e_t,
+        l0e_t>;
+
+    /// @brief stores the pages given to the page pool
+    alignas(HYPERVISOR_PAGE_SIZE.get())
+        constinit bsl::array<basic_page_pool_node_t, POOL_PAGES.get()> g_mut_pool_pages{};
+    /// @brief the page pool used by the root page table
+    constinit page_pool_t g_mut_page_pool{};
+    /// @brief the root page table used by the contention benchmark
+    constinit root_page_table_t g_mut_rpt{};
+
+    /// <!-- description -->
+    ///   @brief Measures the latency of mapping, querying and unmapping
+    ///     pages of a given granularity using a single PP. Each pass
+    ///     starts with an empty root page table, so the cost of adding
+    ///     and removing page tables is included.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam E the entry type to map with. l2e_t is a 1g map, l1e_t
+    ///     is a 2m map and l0e_t is a 4k map.
+    ///   @param size the name of the granularity being measured
+    ///   @param page_size the number of bytes in each page
+    ///   @param pages the number of pages to map in each pass
+    ///
+    template<typename E>
+    void
+    benchmark_pass(
+        bsl::string_view const &size,
+        bsl::safe_u64 const &page_size,
+        bsl::safe_u64 const &pages) noexcept
+    {
+        tls_t mut_tls{};
+        bool mut_sys{true};
+        root_page_table_t mut_rpt{};
+
+        bsl::safe_u64 mut_map_ns{};
+        bsl::safe_u64 mut_query_ns{};
+        bsl::safe_u64 mut_unmap_ns{};
+
+        if (bsl::unlikely(!mut_rpt.initialize(mut_tls, g_mut_page_pool, mut_sys))) {
+            bsl::print<bsl::V>() << bsl::here();
+            return;
+        }
+
+        /// NOTE:
+        /// - Every page is mapped to MAP_BASE. If the pages were mapped to
+        ///   a contiguous range instead, map() would promote the tables they
+        ///   fill into larger pages, and the queries and unmaps below would
+        ///   no longer measure the page size they are meant to.
+        ///
+
+        for (bsl::safe_u64 mut_iter{}; mut_iter < PASS_ITERATIONS; ++mut_iter) {
+            auto const map_start{benchmark_now()};
+            for (bsl::safe_u64 mut_i{}; mut_i < pages; ++mut_i) {
+                auto const virt{(MAP_BASE + (mut_i * page_size)).checked()};
+                bsl::discard(mut_rpt.map<E>(
+                    mut_tls, g_mut_page_pool, virt, MAP_BASE, BASIC_MAP_PAGE_RW, false, mut_sys));
+            }
+            mut_map_ns += (benchmark_now() - map_start).checked();
+
+            auto const query_start{benchmark_now()};
+            for (bsl::safe_u64 mut_i{}; mut_i < pages; ++mut_i) {
+                auto const virt{(MAP_BASE + (mut_i * page_size)).checked()};
+                bsl::discard(mut_rpt.entries<E>(mut_tls, g_mut_page_pool, virt));
+            }
+            mut_query_ns += (benchmark_now() - query_start).checked();
+
+            auto const unmap_start{benchmark_now()};
+            for (bsl::safe_u64 mut_i{}; mut_i < pages; ++mut_i) {
+                auto const virt{(MAP_BASE + (mut_i * page_size)).checked()};
+                bsl::discard(mut_rpt.unmap<E>(mut_tls, g_mut_page_pool, virt));
+            }
+            mut_unmap_ns += (benchmark_now() - unmap_start).checked();
+        }
+
+        mut_rpt.release(mut_tls, g_mut_page_pool);
+
+        auto const ops{(pages * PASS_ITERATIONS).checked()};
+        auto const threads{bsl::safe_umx::magic_1()};
+
+        benchmark_report("root_page_table.map", size, threads, ops, mut_map_ns.checked());
+        benchmark_report("root_page_table.query", size, threads, ops, mut_query_ns.checked());
+        benchmark_report("root_page_table.unmap", size, threads, ops, mut_unmap_ns.checked());
+    }
+
+    /// <!-- description -->
+    ///   @brief Measures 4k map/unmap pairs with 1, 2, 4, ... host
+    ///     threads, all of which share the same root page table and
+    ///     page pool. Each thread maps its own 1g region so that the
+    ///     threads only contend for locks and not for entries.
+    ///
+    inline void
+    benchmark_contention() noexcept
+    {
+        tls_t mut_tls{};
+        bool mut_sys{true};
+
+        if (bsl::unlikely(!g_mut_rpt.initialize(mut_tls, g_mut_page_pool, mut_sys))) {
+            bsl::print<bsl::V>() << bsl::here();
+            return;
+        }
+
+        auto const max{benchmark_max_threads()};
+        for (auto mut_threads{bsl::safe_umx::magic_1()}; mut_threads <= max;
+             mut_threads *= BENCHMARK_THREADS_SCALE) {
+            auto const ns{benchmark_threads(
+                mut_threads, [](tls_t &mut_tls, bsl::safe_idx const &i) noexcept {
+                    bool mut_sys{true};
+                    auto const base{(MAP_BASE + (bsl::to_u64(i) * SIZE_1G)).checked()};
+
+                    for (bsl::safe_u64 mut_iter{}; mut_iter < CONTENTION_ITERATIONS; ++mut_iter) {
+                        for (bsl::safe_u64 mut_j{}; mut_j < MAP_PAGES; ++mut_j) {
+                            auto const virt{(base + (mut_j * SIZE_4K)).checked()};
+                            bsl::discard(g_mut_rpt.map(
+                                mut_tls,
+                                g_mut_page_pool,
+                                virt,
+                                base,
+                                BASIC_MAP_PAGE_RW,
+                                false,
+                                mut_sys));
+                        }
+
+                        for (bsl::safe_u64 mut_j{}; mut_j < MAP_PAGES; ++mut_j) {
+                            auto const virt{(base + (mut_j * SIZE_4K)).checked()};
+                            bsl::discard(g_mut_rpt.unmap(mut_tls, g_mut_page_pool, virt));
+                        }
+                    }
+                })};
+
+            auto const pairs{(CONTENTION_ITERATIONS * MAP_PAGES).checked()};
+            auto const ops{(pairs * bsl::to_u64(mut_threads)).checked()};
+            benchmark_report("root_page_table.map_unmap", "4k", mut_threads, ops, ns);
+        }
+
+        g_mut_rpt.release(mut_tls, g_mut_page_pool);
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for the root page table benchmarks. Each result
+///     is written to the console as a single line of JSON.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    lib::initialize_page_pool(lib::g_mut_pool_pages, lib::g_mut_page_pool);
+
+    lib::benchmark_pass<lib::l0e_t>("4k", lib::SIZE_4K, lib::MAP_PAGES);
+    lib::benchmark_pass<lib::l1e_t>("2m", lib::SIZE_2M, lib::MAP_PAGES);
+    lib::benchmark_pass<lib::l2e_t>("1g", lib::SIZE_1G, lib::MAP_PAGES_1G);
+    lib::benchmark_contention();
+
+    return bsl::exit_success;
+}
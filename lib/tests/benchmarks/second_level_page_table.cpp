@@ -0,0 +1,161 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "benchmark.hpp"
+
+#include <basic_map_page_flags.hpp>
+#include <basic_page_pool_node_t.hpp>
+#include <basic_page_pool_t.hpp>
+#include <basic_second_level_page_table_t.hpp>
+#include <intrinsic_t.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace lib
+{
+    /// @brief defines the number of pages in the page pool. A 512 GB
+    ///   identity map made of 2m blocks needs 514 tables.
+    constexpr auto POOL_PAGES{1024_umx};
+    /// @brief defines how many times each identity map is built
+    constexpr auto PASS_ITERATIONS_1G{64_u64};
+    /// @brief defines how many times each identity map is built
+    constexpr auto PASS_ITERATIONS_2M{4_u64};
+
+    /// @brief defines the number of bytes in the identity map (512 GB)
+    constexpr auto MAP_BYTES{0x0000008000000000_u64};
+
+    /// @brief defines the page pool used by the tables
+    using page_pool_t = basic_page_pool_t<
+        tls_t,
+        bool,
+        BENCHMARK_MAP_ADDR.get(),
+        BENCHMARK_MAP_SIZE.get()>;
+
+    /// @brief defines the EPT builder being measured
+    using ept_t = basic_ept_t<tls_t, bool, page_pool_t, intrinsic_t>;
+    /// @brief defines the NPT builder being measured
+    using npt_t = basic_npt_t<tls_t, bool, page_pool_t, intrinsic_t>;
+
+    /// @brief stores the pages given to the page pool
+    alignas(HYPERVISOR_PAGE_SIZE.get())
+        constinit bsl::array<basic_page_pool_node_t, POOL_PAGES.get()> g_mut_pool_pages{};
+    /// @brief the page pool used by the tables
+    constinit page_pool_t g_mut_page_pool{};
+
+    /// <!-- description -->
+    ///   @brief Measures how long it takes to build (and to tear down) a
+    ///     512 GB identity map, which is what an extension does for the
+    ///     root VM at boot. Each op is one complete identity map.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of second level page table to build
+    ///   @param name_map the name to report the map_identity() results as
+    ///   @param name_unmap the name to report the unmap() results as
+    ///   @param size the name of the block size being measured
+    ///   @param page_1g true to build the map out of 1g blocks, false to
+    ///     build it out of 2m blocks
+    ///   @param iterations the number of identity maps to build
+    ///
+    template<typename T>
+    void
+    benchmark_identity(
+        bsl::string_view const &name_map,
+        bsl::string_view const &name_unmap,
+        bsl::string_view const &size,
+        bool const page_1g,
+        bsl::safe_u64 const &iterations) noexcept
+    {
+        tls_t mut_tls{};
+        bool mut_sys{true};
+        T mut_slpt{};
+
+        bsl::safe_u64 mut_map_ns{};
+        bsl::safe_u64 mut_unmap_ns{};
+
+        for (bsl::safe_u64 mut_iter{}; mut_iter < iterations; ++mut_iter) {
+            auto const ret{mut_slpt.initialize(mut_tls, g_mut_page_pool, page_1g, mut_sys)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return;
+            }
+
+            auto const map_start{benchmark_now()};
+            auto const map_ret{mut_slpt.map_identity(
+                mut_tls, g_mut_page_pool, {}, MAP_BYTES, BASIC_MAP_PAGE_RWE, mut_sys)};
+            mut_map_ns += (benchmark_now() - map_start).checked();
+
+            if (bsl::unlikely(!map_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                mut_slpt.release(mut_tls, g_mut_page_pool);
+                return;
+            }
+
+            auto const unmap_start{benchmark_now()};
+            auto const unmap_ret{mut_slpt.unmap(mut_tls, g_mut_page_pool, {}, MAP_BYTES, mut_sys)};
+            mut_slpt.release(mut_tls, g_mut_page_pool);
+            mut_unmap_ns += (benchmark_now() - unmap_start).checked();
+
+            if (bsl::unlikely(!unmap_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return;
+            }
+        }
+
+        auto const threads{bsl::safe_umx::magic_1()};
+        benchmark_report(name_map, size, threads, iterations, mut_map_ns.checked());
+        benchmark_report(name_unmap, size, threads, iterations, mut_unmap_ns.checked());
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for the second level page table benchmarks. Each
+///     result is written to the console as a single line of JSON.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    constexpr auto ept_map{"second_level_page_table.ept.map_identity"};
+    constexpr auto ept_unmap{"second_level_page_table.ept.unmap"};
+    constexpr auto npt_map{"second_level_page_table.npt.map_identity"};
+    constexpr auto npt_unmap{"second_level_page_table.npt.unmap"};
+
+    lib::initialize_page_pool(lib::g_mut_pool_pages, lib::g_mut_page_pool);
+
+    lib::benchmark_identity<lib::ept_t>(ept_map, ept_unmap, "1g", true, lib::PASS_ITERATIONS_1G);
+    lib::benchmark_identity<lib::ept_t>(ept_map, ept_unmap, "2m", false, lib::PASS_ITERATIONS_2M);
+    lib::benchmark_identity<lib::npt_t>(npt_map, npt_unmap, "1g", true, lib::PASS_ITERATIONS_1G);
+    lib::benchmark_identity<lib::npt_t>(npt_map, npt_unmap, "2m", false, lib::PASS_ITERATIONS_2M);
+
+    return bsl::exit_success;
+}
@@ -0,0 +1,272 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../include/basic_mpsc_queue_t.hpp"
+
+#include <thread>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/ut.hpp>
+
+namespace lib
+{
+    /// @brief defines the size of the queue used by the tests
+    constexpr auto QUEUE_SIZE{4_umx};
+    /// @brief defines the number of elements sent by the thread tests
+    constexpr auto NUM_ELEMENTS{0x10000_u64};
+    /// @brief defines the size of each batch sent by the thread tests
+    constexpr auto BATCH_SIZE{3_umx};
+    /// @brief defines the number of elements pushed by the push_n tests
+    constexpr auto NUM_VALS{6_umx};
+
+    /// @brief defines the number of producer threads used by the thread tests
+    constexpr auto NUM_PRODUCERS{4_umx};
+    /// @brief defines the number of bits used to store the element number
+    constexpr auto PRODUCER_SHIFT{32_u64};
+
+    /// @brief defines the queue used by the thread tests
+    constinit basic_mpsc_queue_t<bsl::safe_u64, QUEUE_SIZE.get()> g_mut_queue{};
+
+    /// <!-- description -->
+    ///   @brief Pushes NUM_ELEMENTS elements, in order, to g_mut_queue
+    ///     in batches of BATCH_SIZE elements. Each element stores the
+    ///     producer's id in its upper bits so that the consumer can
+    ///     check that each producer's elements arrive in order.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param id the id of the producer
+    ///
+    void
+    producer_func(bsl::safe_u64 const &id) noexcept
+    {
+        bsl::array<bsl::safe_u64, BATCH_SIZE.get()> mut_batch{};
+        bsl::safe_u64 mut_next{};
+
+        auto const tag{(id << PRODUCER_SHIFT).checked()};
+
+        while (mut_next < NUM_ELEMENTS) {
+            auto mut_count{BATCH_SIZE};
+            auto const left{bsl::to_umx((NUM_ELEMENTS - mut_next).checked())};
+            if (left < mut_count) {
+                mut_count = left;
+            }
+            else {
+                bsl::touch();
+            }
+
+            for (bsl::safe_idx mut_i{}; mut_i < mut_count; ++mut_i) {
+                *mut_batch.at_if(mut_i) = (tag | (mut_next + bsl::to_u64(mut_i))).checked();
+            }
+
+            bsl::span<bsl::safe_u64 const> const vals{mut_batch.data(), mut_count};
+            auto const num{g_mut_queue.push_n(vals)};
+            if (num.is_zero()) {
+                std::this_thread::yield();
+            }
+
+            mut_next += bsl::to_u64(num);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        using queue_t = basic_mpsc_queue_t<bool, QUEUE_SIZE.get()>;
+
+        bsl::ut_scenario{"initial state"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                queue_t mut_queue{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_queue.empty());
+                    bsl::ut_check(!mut_queue.full());
+                    bsl::ut_check(mut_queue.size() == QUEUE_SIZE);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"push until full"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                queue_t mut_queue{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_queue.push(true));
+                    bsl::ut_required_step(mut_queue.push(true));
+                    bsl::ut_required_step(mut_queue.push(true));
+                    bsl::ut_required_step(mut_queue.push(true));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_queue.push(true));
+                        bsl::ut_check(!mut_queue.empty());
+                        bsl::ut_check(mut_queue.full());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"pop until empty"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                queue_t mut_queue{};
+                bool mut_val{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_queue.push(true));
+                    bsl::ut_required_step(mut_queue.push(false));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_queue.pop(mut_val));
+                        bsl::ut_check(mut_val);
+                        bsl::ut_check(mut_queue.pop(mut_val));
+                        bsl::ut_check(!mut_val);
+                        bsl::ut_check(!mut_queue.pop(mut_val));
+                        bsl::ut_check(mut_queue.empty());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"push/pop wraps"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                queue_t mut_queue{};
+                bool mut_val{};
+                bsl::ut_when{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < QUEUE_SIZE; ++mut_i) {
+                        bsl::ut_required_step(mut_queue.push(true));
+                        bsl::ut_required_step(mut_queue.pop(mut_val));
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_queue.push(true));
+                        bsl::ut_check(mut_queue.pop(mut_val));
+                        bsl::ut_check(mut_val);
+                        bsl::ut_check(mut_queue.empty());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"push_n/pop_n"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                queue_t mut_queue{};
+                bsl::array<bool, NUM_VALS.get()> const vals{true, false, true, false, true, false};
+                bsl::span<bool const> const view{vals.data(), vals.size()};
+                bsl::array<bool, BATCH_SIZE.get()> mut_out{};
+                bsl::span mut_out_view{mut_out};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_queue.push_n(view) == QUEUE_SIZE);
+                        bsl::ut_check(mut_queue.full());
+                        bsl::ut_check(mut_queue.push_n(view).is_zero());
+                        bsl::ut_check(mut_queue.pop_n(mut_out_view) == mut_out.size());
+                        bsl::ut_check(*mut_out.at_if(0_idx));
+                        bsl::ut_check(!*mut_out.at_if(1_idx));
+                        bsl::ut_check(*mut_out.at_if(2_idx));
+                        bsl::ut_check(mut_queue.pop_n(mut_out_view) == 1_umx);
+                        bsl::ut_check(!*mut_out.at_if(0_idx));
+                        bsl::ut_check(mut_queue.pop_n(mut_out_view).is_zero());
+                        bsl::ut_check(mut_queue.empty());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"multiple producers on different threads"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<std::thread, NUM_PRODUCERS.get()> mut_producers{};
+                bsl::array<bsl::safe_u64, NUM_PRODUCERS.get()> mut_expected{};
+                bsl::array<bsl::safe_u64, BATCH_SIZE.get()> mut_out{};
+                bsl::span mut_out_view{mut_out};
+                auto const total{(NUM_ELEMENTS * bsl::to_u64(NUM_PRODUCERS)).checked()};
+                auto const mask{((bsl::safe_u64::magic_1() << PRODUCER_SHIFT) - 1_u64).checked()};
+                bsl::safe_u64 mut_received{};
+                bool mut_in_order{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < NUM_PRODUCERS; ++mut_i) {
+                        auto const id{bsl::to_u64(mut_i)};
+                        *mut_producers.at_if(mut_i) = std::thread{&producer_func, id};
+                    }
+
+                    while (mut_received < total) {
+                        auto const num{g_mut_queue.pop_n(mut_out_view)};
+                        if (num.is_zero()) {
+                            std::this_thread::yield();
+                        }
+
+                        for (bsl::safe_idx mut_i{}; mut_i < num; ++mut_i) {
+                            auto const val{*mut_out.at_if(mut_i)};
+                            auto *const pmut_expected{
+                                mut_expected.at_if(bsl::to_idx(val >> PRODUCER_SHIFT))};
+
+                            if ((nullptr == pmut_expected) || ((val & mask) != *pmut_expected)) {
+                                mut_in_order = false;
+                                break;
+                            }
+
+                            ++*pmut_expected;
+                        }
+
+                        mut_received += bsl::to_u64(num);
+                    }
+
+                    for (bsl::safe_idx mut_i{}; mut_i < NUM_PRODUCERS; ++mut_i) {
+                        mut_producers.at_if(mut_i)->join();
+                    }
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_in_order);
+                        bsl::ut_check(g_mut_queue.empty());
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(lib::tests() == bsl::ut_success());
+    return lib::tests();
+}
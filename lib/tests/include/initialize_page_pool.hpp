@@ -0,0 +1,65 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef INITIALIZE_PAGE_POOL_HPP
+#define INITIALIZE_PAGE_POOL_HPP
+
+#include <basic_page_pool_node_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Links the provided pages together, the same way that the
+    ///     loader would, and gives them to the provided page pool.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam POOL_TYPE the type of page pool to initialize
+    ///   @tparam N the number of pages to give to the page pool
+    ///   @param mut_pages the pages to give to the page pool
+    ///   @param mut_pool the page pool to initialize
+    ///
+    template<typename POOL_TYPE, bsl::uintmx N>
+    constexpr void
+    initialize_page_pool(
+        bsl::array<basic_page_pool_node_t, N> &mut_pages, POOL_TYPE &mut_pool) noexcept
+    {
+        bsl::span mut_view{mut_pages};
+
+        auto const size{(mut_view.size() - bsl::safe_umx::magic_1()).checked()};
+        for (bsl::safe_idx mut_i{}; mut_i < size; ++mut_i) {
+            mut_view.at_if(mut_i)->next = mut_view.at_if(mut_i + bsl::safe_idx::magic_1());
+        }
+
+        mut_view.back_if()->next = nullptr;
+        mut_pool.initialize(mut_view);
+    }
+}
+
+#endif
@@ -51,6 +51,8 @@ namespace lib
         bsl::uint16 ppid;
         /// @brief stores the total number of online PPs
         bsl::uint16 online_pps;
+        /// @brief stores the NUMA node this PP belongs to
+        bsl::uint16 numa_node;
 
         /// @brief stores the currently active root page table
         void *active_rpt;
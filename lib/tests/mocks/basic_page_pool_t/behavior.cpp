@@ -31,6 +31,7 @@
 #include <vmcb_t.hpp>
 #include <vmcs_t.hpp>
 
+#include <bsl/array.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/safe_idx.hpp>
@@ -99,6 +100,22 @@ namespace lib
             };
         };
 
+        bsl::ut_scenario{"allocate/deallocate_batch"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                basic_page_pool_t<tls_t> mut_page_pool{};
+                bsl::array<T *, 2_umx.get()> mut_batch{};
+                bsl::ut_when{} = [&]() noexcept {
+                    *mut_batch.at_if(0_idx) = mut_page_pool.allocate<T>({});
+                    *mut_batch.at_if(1_idx) = mut_page_pool.allocate<T>({});
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_page_pool.deallocate_batch<T>(
+                            {}, bsl::span<T *const>{mut_batch.data(), mut_batch.size()});
+                        bsl::ut_check(mut_page_pool.allocated({}).is_zero());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"allocate/deallocate set_allocate"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 basic_page_pool_t<tls_t> mut_page_pool{};
@@ -146,6 +146,60 @@ namespace lib
             };
         };
 
+        bsl::ut_scenario{"clear"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x1000_u64};
+                constexpr auto flgs{0x0_u64};
+                bsl::dontcare_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        nullptr != mut_rpt.allocate_page<basic_page_4k_t>(
+                                       mut_tls, mut_page_pool, virt, flgs, mut_sys));
+                    mut_rpt.clear(mut_tls, mut_page_pool);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.is_initialized());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"reclaim"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt0{0x1000_u64};
+                constexpr auto virt1{0x2000_u64};
+                constexpr auto flgs{0x0_u64};
+                bsl::dontcare_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        nullptr != mut_rpt.allocate_page<basic_page_4k_t>(
+                                       mut_tls, mut_page_pool, virt0, flgs, mut_sys));
+                    bsl::ut_required_step(
+                        nullptr != mut_rpt.allocate_page<basic_page_4k_t>(
+                                       mut_tls, mut_page_pool, virt1, flgs, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_rpt.reclaim(mut_tls, mut_page_pool));
+                        bsl::ut_check(mut_rpt.reclaim(mut_tls, mut_page_pool));
+                        bsl::ut_check(mut_rpt.reclaim(mut_tls, mut_page_pool));
+                        bsl::ut_check(mut_rpt.is_initialized());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"activate"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 root_page_table_t mut_rpt{};
@@ -503,6 +557,133 @@ namespace lib
             };
         };
 
+        bsl::ut_scenario{"set_page_flgs"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto virt1{0x1000_u64};
+                constexpr auto virt2{0x200000_u64};
+                constexpr auto virt3{0x40000000_u64};
+                constexpr auto phys1{0x1000_u64};
+                constexpr auto phys2{0x200000_u64};
+                constexpr auto phys3{0x40000000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map<l0e_t>(mut_tls, mut_page_pool, virt1, phys1, {}, {}, mut_sys));
+                    bsl::ut_required_step(
+                        mut_rpt.map<l1e_t>(mut_tls, mut_page_pool, virt2, phys2, {}, {}, mut_sys));
+                    bsl::ut_required_step(
+                        mut_rpt.map<l2e_t>(mut_tls, mut_page_pool, virt3, phys3, {}, {}, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_rpt.set_page_flgs<l0e_t>(mut_tls, mut_page_pool, virt1, {}));
+                        bsl::ut_check(
+                            mut_rpt.set_page_flgs<l1e_t>(mut_tls, mut_page_pool, virt2, {}));
+                        bsl::ut_check(
+                            mut_rpt.set_page_flgs<l2e_t>(mut_tls, mut_page_pool, virt3, {}));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"set_page_flgs fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto virt1{0x1000_u64};
+                constexpr auto virt2{0x200000_u64};
+                constexpr auto virt3{0x40000000_u64};
+                constexpr auto phys1{0x1000_u64};
+                constexpr auto phys2{0x200000_u64};
+                constexpr auto phys3{0x40000000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map<l0e_t>(mut_tls, mut_page_pool, virt1, phys1, {}, {}, mut_sys));
+                    bsl::ut_required_step(
+                        mut_rpt.map<l1e_t>(mut_tls, mut_page_pool, virt2, phys2, {}, {}, mut_sys));
+                    bsl::ut_required_step(
+                        mut_rpt.map<l2e_t>(mut_tls, mut_page_pool, virt3, phys3, {}, {}, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            !mut_rpt.set_page_flgs<l0e_t>(mut_tls, mut_page_pool, {}, {}));
+                        bsl::ut_check(
+                            !mut_rpt.set_page_flgs<l1e_t>(mut_tls, mut_page_pool, {}, {}));
+                        bsl::ut_check(
+                            !mut_rpt.set_page_flgs<l2e_t>(mut_tls, mut_page_pool, {}, {}));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"page_size"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const size{mut_rpt.page_size(mut_tls, mut_page_pool, virt)};
+                        bsl::ut_check(size == HYPERVISOR_PAGE_SIZE);
+                        mut_tls.test_virt = virt;
+                        bsl::ut_check(mut_rpt.page_size(mut_tls, mut_page_pool, virt).is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"for_each_block and update_block"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x1000_u64};
+                bsl::safe_u64 mut_calls{};
+                auto const func{[&](bsl::safe_u64 const &block_virt,
+                                    bsl::safe_u64 const &bytes,
+                                    auto &mut_entry) noexcept -> bool {
+                    bsl::discard(block_virt);
+                    bsl::discard(bytes);
+                    bsl::discard(mut_entry);
+                    ++mut_calls;
+                    return true;
+                }};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_rpt.for_each_block(mut_tls, mut_page_pool, func);
+                        bsl::ut_check(mut_calls.is_zero());
+                        auto const size{mut_rpt.update_block(mut_tls, mut_page_pool, virt, func)};
+                        bsl::ut_check(size == HYPERVISOR_PAGE_SIZE);
+                        bsl::ut_check(bsl::safe_u64::magic_1() == mut_calls);
+                        mut_tls.test_virt = virt;
+                        auto const none{mut_rpt.update_block(mut_tls, mut_page_pool, virt, func)};
+                        bsl::ut_check(none.is_zero());
+                        bsl::ut_check(bsl::safe_u64::magic_1() == mut_calls);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"entries"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 root_page_table_t mut_rpt{};
@@ -543,6 +724,7 @@ namespace lib
                 bsl::ut_then{} = [&]() noexcept {
                     mut_rpt.add_tables({}, rpt_src);
                     mut_rpt.add_tables({}, &l3e_src);
+                    mut_rpt.remove_stale_tables({}, rpt_src);
                 };
             };
         };
@@ -0,0 +1,263 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../mocks/basic_second_level_page_table_t.hpp"
+
+#include <basic_map_page_flags.hpp>
+#include <basic_page_pool_t.hpp>
+#include <intrinsic_t.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/dontcare_t.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace lib
+{
+    /// @brief defines the page_pool_t used by the microkernel
+    using page_pool_t = lib::basic_page_pool_t<tls_t>;
+
+    /// @brief defines the EPT builder used by the tests
+    using ept_t = lib::basic_ept_t<tls_t, bsl::dontcare_t, page_pool_t, intrinsic_t>;
+    /// @brief defines the NPT builder used by the tests
+    using npt_t = lib::basic_npt_t<tls_t, bsl::dontcare_t, page_pool_t, intrinsic_t>;
+
+    /// @brief defines the guest physical address used by the tests
+    constexpr auto GPA{0x40000000_u64};
+    /// @brief defines the number of bytes used by the tests
+    constexpr auto BYTES{0x200000_u64};
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"initialize fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                ept_t mut_ept{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.test_ret = UNIT_TEST_SLPT_FAIL_INITIALIZE;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ept.initialize(mut_tls, mut_page_pool, true));
+                        bsl::ut_check(!mut_ept.is_initialized());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"initialize success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                npt_t mut_npt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_npt.initialize(mut_tls, mut_page_pool, true));
+                    bsl::ut_check(mut_npt.is_initialized());
+                    bsl::ut_check(mut_npt.root_pointer().is_pos());
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_npt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"release"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                ept_t mut_ept{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ept.initialize(mut_tls, mut_page_pool, true));
+                    bsl::ut_required_step(mut_ept.map_identity(
+                        mut_tls, mut_page_pool, GPA, BYTES, BASIC_MAP_PAGE_RW));
+                    mut_ept.release(mut_tls, mut_page_pool);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ept.is_initialized());
+                        bsl::ut_check(!mut_ept.needs_flush());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map, set_flgs and unmap"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                ept_t mut_ept{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto spa{0x80000000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ept.initialize(mut_tls, mut_page_pool, true));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ept.needs_flush());
+                        bsl::ut_check(mut_ept.map(
+                            mut_tls, mut_page_pool, GPA, spa, BYTES, BASIC_MAP_PAGE_RW));
+                        bsl::ut_check(mut_ept.set_flgs(
+                            mut_tls, mut_page_pool, GPA, BYTES, BASIC_MAP_PAGE_READ));
+                        bsl::ut_check(mut_ept.unmap(mut_tls, mut_page_pool, GPA, BYTES));
+                        bsl::ut_check(mut_ept.needs_flush());
+                        bsl::ut_check(GPA == mut_ept.flush_gpa());
+                        bsl::ut_check(BYTES == mut_ept.flush_bytes());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ept.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                npt_t mut_npt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_npt.initialize(mut_tls, mut_page_pool, false));
+                    mut_tls.test_virt = GPA;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_npt.map_identity(
+                            mut_tls, mut_page_pool, GPA, BYTES, BASIC_MAP_PAGE_RW));
+                        bsl::ut_check(!mut_npt.set_flgs(
+                            mut_tls, mut_page_pool, GPA, BYTES, BASIC_MAP_PAGE_READ));
+                        bsl::ut_check(!mut_npt.unmap(mut_tls, mut_page_pool, GPA, BYTES));
+                        bsl::ut_check(!mut_npt.needs_flush());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_npt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"page_size and page_flgs"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                ept_t mut_ept{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ept.initialize(mut_tls, mut_page_pool, true));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ept.page_size(mut_tls, mut_page_pool, GPA).is_pos());
+                        bsl::ut_check(mut_ept.page_flgs(mut_tls, mut_page_pool, GPA).is_pos());
+                        mut_tls.test_virt = GPA;
+                        bsl::ut_check(mut_ept.page_size(mut_tls, mut_page_pool, GPA).is_zero());
+                        bsl::ut_check(mut_ept.page_flgs(mut_tls, mut_page_pool, GPA).is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ept.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"dirty tracking"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                ept_t mut_ept{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto mask{0xFFF_u64};
+                bool mut_called{};
+                auto const mark{[&](bsl::safe_u64 const &, bsl::safe_u64 const &) noexcept {
+                    mut_called = true;
+                }};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ept.initialize(mut_tls, mut_page_pool, true));
+                    mut_ept.set_accessed_dirty(true);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check((mut_ept.root_pointer() & mask).is_pos());
+                        bsl::ut_check(mut_ept.clear_dirty(mut_tls, mut_page_pool, GPA).is_pos());
+                        bsl::ut_check(GPA == mut_ept.flush_gpa());
+                        mut_ept.harvest_dirty(mut_tls, mut_page_pool, mark);
+                        bsl::ut_check(!mut_called);
+                        mut_tls.test_virt = GPA;
+                        bsl::ut_check(mut_ept.clear_dirty(mut_tls, mut_page_pool, GPA).is_zero());
+                        mut_ept.set_accessed_dirty(false);
+                        bsl::ut_check((mut_ept.root_pointer() & mask).is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ept.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"flush tracking"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                npt_t mut_npt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto low{0x1000_u64};
+                constexpr auto high{0x80000000_u64};
+                constexpr auto expected{(high + BYTES - low).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_npt.initialize(mut_tls, mut_page_pool, true));
+                    bsl::ut_required_step(mut_npt.map_identity(
+                        mut_tls, mut_page_pool, GPA, BYTES, BASIC_MAP_PAGE_RW));
+                    bsl::ut_required_step(mut_npt.map_identity(
+                        mut_tls, mut_page_pool, high, BYTES, BASIC_MAP_PAGE_RW));
+                    bsl::ut_required_step(mut_npt.map_identity(
+                        mut_tls, mut_page_pool, low, BYTES, BASIC_MAP_PAGE_RW));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(low == mut_npt.flush_gpa());
+                        bsl::ut_check(expected == mut_npt.flush_bytes());
+                        mut_npt.flushed(mut_tls, mut_page_pool);
+                        bsl::ut_check(!mut_npt.needs_flush());
+                        bsl::ut_check(mut_npt.flush_bytes().is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_npt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(lib::tests() == bsl::ut_success());
+    return lib::tests();
+}
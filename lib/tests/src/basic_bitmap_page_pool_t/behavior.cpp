@@ -0,0 +1,544 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../src/basic_bitmap_page_pool_t.hpp"
+
+#include <tls_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace lib
+{
+    /// @brief defines the number of pages in most of the test pools
+    constexpr auto POOL_PAGES{16_umx};
+    /// @brief defines the alignment of the test pools (so they never cross a leaf)
+    constexpr auto POOL_ALIGN{0x10000_umx};
+    /// @brief defines the number of pages in the pool used to test long runs
+    constexpr auto LARGE_POOL_PAGES{256_umx};
+    /// @brief defines the alignment of the pool used to test long runs
+    constexpr auto LARGE_POOL_ALIGN{0x100000_umx};
+
+    /// @brief defines the page pool's direct map address. The pages come
+    ///   from the test's own memory, so the direct map is the lower half
+    ///   of the address space (minus the first and last page).
+    constexpr auto POOL_MAP_ADDR{0x0000000000001000_umx};
+    /// @brief defines the page pool's direct map size
+    constexpr auto POOL_MAP_SIZE{0x00007FFFFFFFE000_umx};
+
+    /// @brief reduce the verbosity of the tests.
+    using nd_t = basic_page_pool_node_t;
+
+    /// @brief defines the basic_bitmap_page_pool_t being tested
+    using pool_t = basic_bitmap_page_pool_t<tls_t, bool, POOL_MAP_ADDR.get(), POOL_MAP_SIZE.get()>;
+
+    /// @brief stores the pages given to node 0
+    alignas(POOL_ALIGN.get()) constinit bsl::array<nd_t, POOL_PAGES.get()> g_mut_pool0{};
+    /// @brief stores the pages given to node 1
+    alignas(POOL_ALIGN.get()) constinit bsl::array<nd_t, POOL_PAGES.get()> g_mut_pool1{};
+    /// @brief stores the pages given to the reserve
+    alignas(POOL_ALIGN.get()) constinit bsl::array<nd_t, POOL_PAGES.get()> g_mut_reserve{};
+    /// @brief stores the pages used to test runs that span more than one word
+    alignas(LARGE_POOL_ALIGN.get()) constinit bsl::array<nd_t, LARGE_POOL_PAGES.get()>
+        g_mut_large{};
+
+    /// <!-- description -->
+    ///   @brief Links the pages in mut_pool together, the same way that
+    ///     the loader would.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_pool the pool to initialize
+    ///
+    constexpr void
+    initialize_pool(bsl::span<nd_t> &mut_pool) noexcept
+    {
+        auto const size{(mut_pool.size() - bsl::safe_umx::magic_1()).checked()};
+        for (bsl::safe_idx mut_i{}; mut_i < size; ++mut_i) {
+            mut_pool.at_if(mut_i)->next = mut_pool.at_if(mut_i + bsl::safe_idx::magic_1());
+        }
+
+        mut_pool.back_if()->next = nullptr;
+    }
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    ///     The pool converts every page it is given to a physical address,
+    ///     which cannot be done at compile-time, so all of these tests are
+    ///     run at run-time. The first page given to the pool always becomes
+    ///     the pool's leaf, so page 0 of each test pool is never allocated.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"allocate empty"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::span<nd_t> mut_view{};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_page_pool.initialize(mut_view);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const *const nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(nd == nullptr);
+                        bsl::ut_check(mut_page_pool.size().is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate until empty"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::span mut_view{g_mut_pool0};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    bsl::ut_then{} = [&]() noexcept {
+                        for (bsl::safe_idx mut_i{1_idx}; mut_i < POOL_PAGES; ++mut_i) {
+                            auto const *const nd{
+                                mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                            bsl::ut_check(nd == mut_view.at_if(mut_i));
+                        }
+
+                        auto const *const nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(nd == nullptr);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate until empty, then alloc more"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::span mut_view{g_mut_pool0};
+                tls_t mut_tls{};
+                bool mut_return_nd{false};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    for (bsl::safe_idx mut_i{1_idx}; mut_i < POOL_PAGES; ++mut_i) {
+                        bsl::discard(mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nd));
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto *const pmut_nd{mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nd)};
+                        bsl::ut_check(pmut_nd != nullptr);
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+                            delete pmut_nd;    // GRCOV_EXCLUDE_BR
+                        };
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::span mut_view{g_mut_pool0};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    auto *const pmut_nd1{mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                    auto *const pmut_nd2{mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                    auto *const pmut_nd3{mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                    bsl::ut_required_step(pmut_nd1 == mut_view.at_if(1_idx));
+                    bsl::ut_required_step(pmut_nd2 == mut_view.at_if(2_idx));
+                    bsl::ut_required_step(pmut_nd3 == mut_view.at_if(3_idx));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_nd2);
+                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_nd1);
+                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_nd3);
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls).is_zero());
+
+                        auto const *const nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(nd == mut_view.at_if(1_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate_n"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::span mut_view{g_mut_pool0};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                constexpr auto pages{4_umx};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto *const pmut_run{mut_page_pool.allocate_n<nd_t>(mut_tls, pages)};
+                        bsl::ut_check(pmut_run == mut_view.at_if(1_idx));
+                        bsl::ut_check(
+                            (pages * HYPERVISOR_PAGE_SIZE) == mut_page_pool.allocated(mut_tls));
+
+                        auto const *const nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(nd == mut_view.at_if(5_idx));
+
+                        mut_page_pool.deallocate_n<nd_t>(mut_tls, pmut_run, pages);
+                        bsl::ut_check(HYPERVISOR_PAGE_SIZE == mut_page_pool.allocated(mut_tls));
+                        bsl::ut_check(
+                            mut_page_pool.allocate_n<nd_t>(mut_tls, pages) ==
+                            mut_view.at_if(1_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate_n across words"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::span mut_view{g_mut_large};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_page_pool.allocate_n<nd_t>(mut_tls, 60_umx) ==
+                            mut_view.at_if(1_idx));
+                        bsl::ut_check(
+                            mut_page_pool.allocate_n<nd_t>(mut_tls, 8_umx) ==
+                            mut_view.at_if(61_idx));
+                        bsl::ut_check(
+                            mut_page_pool.allocate_n<nd_t>(mut_tls, BITMAP_PAGE_POOL_MAX_RUN) ==
+                            mut_view.at_if(69_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate_n skips runs that are too short"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::span mut_view{g_mut_pool0};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    for (bsl::safe_idx mut_i{1_idx}; mut_i < POOL_PAGES; ++mut_i) {
+                        bsl::discard(mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr));
+                    }
+                    mut_page_pool.deallocate<nd_t>(mut_tls, mut_view.at_if(3_idx));
+                    mut_page_pool.deallocate<nd_t>(mut_tls, mut_view.at_if(5_idx));
+                    mut_page_pool.deallocate<nd_t>(mut_tls, mut_view.at_if(6_idx));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_page_pool.allocate_n<nd_t>(mut_tls, 2_umx) ==
+                            mut_view.at_if(5_idx));
+                        bsl::ut_check(mut_page_pool.allocate_n<nd_t>(mut_tls, 2_umx) == nullptr);
+
+                        auto const *const nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(nd == mut_view.at_if(3_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate_n empty"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                tls_t mut_tls{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_page_pool.allocate_n<nd_t>(mut_tls, 2_umx) == nullptr);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate from a remote node"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::span mut_view0{g_mut_pool0};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view0);
+                    mut_page_pool.initialize(mut_view0, 0_idx);
+                    mut_tls.numa_node = 1_u16.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const *const nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(nd == mut_view0.at_if(1_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate from the local node"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::span mut_view0{g_mut_pool0};
+                bsl::span mut_view1{g_mut_pool1};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view0);
+                    initialize_pool(mut_view1);
+                    mut_page_pool.initialize(mut_view0, 0_idx);
+                    mut_page_pool.initialize(mut_view1, 1_idx);
+                    mut_tls.numa_node = 1_u16.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const *const nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(nd == mut_view1.at_if(1_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate with an invalid node"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::span mut_view0{g_mut_pool0};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view0);
+                    mut_page_pool.initialize(mut_view0, 0_idx);
+                    mut_tls.numa_node = 0xFFFF_u16.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const *const nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(nd == mut_view0.at_if(1_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"nodes never share a leaf"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                constexpr auto half{(POOL_PAGES / 2_umx).checked()};
+                bsl::span mut_view{g_mut_pool0};
+                auto mut_view0{mut_view.subspan({}, half)};
+                auto mut_view1{mut_view.subspan(bsl::to_idx(half), half)};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                constexpr auto size{((POOL_PAGES - 1_umx) * HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view0);
+                    initialize_pool(mut_view1);
+                    mut_page_pool.initialize(mut_view0, 0_idx);
+                    mut_page_pool.initialize(mut_view1, 1_idx);
+                    mut_tls.numa_node = 1_u16.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(size == mut_page_pool.size());
+                        auto *const pmut_nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(pmut_nd == mut_view.at_if(1_idx));
+                        mut_page_pool.deallocate<nd_t>(mut_tls, pmut_nd);
+                        mut_tls.numa_node = 0_u16.get();
+                        auto const *const nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(nd == mut_view.at_if(1_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate_batch"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::span mut_view{g_mut_pool0};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::array<nd_t *, 3_umx.get()> mut_batch{};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    for (bsl::safe_idx mut_i{}; mut_i < mut_batch.size(); ++mut_i) {
+                        *mut_batch.at_if(mut_i) =
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr);
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::span<nd_t *const> const batch{mut_batch.data(), mut_batch.size()};
+                        mut_page_pool.deallocate_batch<nd_t>(mut_tls, batch);
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls).is_zero());
+                        mut_page_pool.deallocate_batch<nd_t>(mut_tls, {});
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate from the reserve"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::span mut_reserve{g_mut_reserve};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_reserve);
+                    mut_page_pool.initialize_reserve(mut_reserve);
+                    bsl::ut_then{} = [&]() noexcept {
+                        for (bsl::safe_idx mut_i{1_idx}; mut_i < POOL_PAGES; ++mut_i) {
+                            auto const *const nd{
+                                mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                            bsl::ut_check(nd == mut_reserve.at_if(mut_i));
+                        }
+
+                        auto const *const nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(nd == nullptr);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"grow once the bitmap is empty"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::span mut_view{g_mut_pool0};
+                bsl::span mut_reserve{g_mut_reserve};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    initialize_pool(mut_reserve);
+                    mut_page_pool.initialize(mut_view);
+                    mut_page_pool.initialize_reserve(mut_reserve);
+                    for (bsl::safe_idx mut_i{1_idx}; mut_i < POOL_PAGES; ++mut_i) {
+                        bsl::discard(mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr));
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_page_pool.remaining(mut_tls).is_zero());
+                        bsl::ut_check(
+                            mut_page_pool.allocate_n<nd_t>(mut_tls, 2_umx) != nullptr);
+                        bsl::ut_check(mut_page_pool.remaining(mut_tls).is_pos());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"size, allocated and remaining"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::span mut_view{g_mut_pool0};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                constexpr auto size{((POOL_PAGES - 1_umx) * HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    bsl::discard(mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(size == mut_page_pool.size());
+                        bsl::ut_check(HYPERVISOR_PAGE_SIZE == mut_page_pool.allocated(mut_tls));
+                        bsl::ut_check(
+                            (size - HYPERVISOR_PAGE_SIZE) == mut_page_pool.remaining(mut_tls));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"virt_to_phys"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t const page_pool{};
+                bsl::safe_umx const virt{(POOL_MAP_ADDR + HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::safe_umx const phys{(virt - POOL_MAP_ADDR).checked()};
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                nd_t const *const addr{reinterpret_cast<nd_t const *>(virt.get())};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(page_pool.virt_to_phys<nd_t>(addr) == phys);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"phys_to_virt"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t const page_pool{};
+                bsl::safe_umx const virt{(POOL_MAP_ADDR + HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::safe_umx const phys{(virt - POOL_MAP_ADDR).checked()};
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                nd_t const *const addr{reinterpret_cast<nd_t const *>(virt.get())};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(page_pool.phys_to_virt<nd_t>(phys) == addr);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"dump"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::span mut_view0{g_mut_pool0};
+                bsl::span mut_view1{g_mut_pool1};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view0);
+                    initialize_pool(mut_view1);
+                    mut_page_pool.initialize(mut_view0, 0_idx);
+                    mut_page_pool.initialize(mut_view1, 1_idx);
+                    bsl::discard(mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_page_pool.dump(mut_tls);
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(lib::tests() == bsl::ut_success());
+    return lib::tests();
+}
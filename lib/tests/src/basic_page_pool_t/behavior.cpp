@@ -184,6 +184,269 @@ namespace lib
             };
         };
 
+        bsl::ut_scenario{"allocate from the local node"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool0{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool1{};
+                bsl::span mut_view0{mut_pool0};
+                bsl::span mut_view1{mut_pool1};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view0);
+                    initialize_pool(mut_view1);
+                    mut_page_pool.initialize(mut_view0, 0_idx);
+                    mut_page_pool.initialize(mut_view1, 1_idx);
+                    mut_tls.numa_node = 1_u16.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto *const pmut_nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(pmut_nd == mut_pool1.at_if(0_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate from a remote node"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view, 0_idx);
+                    mut_tls.numa_node = 1_u16.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto *const pmut_nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(pmut_nd == mut_pool.at_if(0_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate with an invalid node"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool0{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool1{};
+                bsl::span mut_view0{mut_pool0};
+                bsl::span mut_view1{mut_pool1};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view0);
+                    initialize_pool(mut_view1);
+                    mut_page_pool.initialize(mut_view0, 0_idx);
+                    mut_page_pool.initialize(mut_view1, 1_idx);
+                    mut_tls.numa_node = 0xFFFF_u16.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto *const pmut_nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(pmut_nd == mut_pool0.at_if(0_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate to the local node"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls0{};
+                tls_t mut_tls1{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view, 0_idx);
+                    mut_tls1.numa_node = 1_u16.get();
+                    auto *const pmut_nd0{
+                        mut_page_pool.allocate<nd_t>(mut_tls0, mut_return_nullptr)};
+                    bsl::ut_required_step(pmut_nd0 == mut_pool.at_if(0_idx));
+                    mut_page_pool.deallocate<nd_t>(mut_tls1, pmut_nd0);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto *const pmut_nd1{
+                            mut_page_pool.allocate<nd_t>(mut_tls1, mut_return_nullptr)};
+                        bsl::ut_check(pmut_nd1 == mut_pool.at_if(0_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate to the home node"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool0{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool1{};
+                bsl::span mut_view0{mut_pool0};
+                bsl::span mut_view1{mut_pool1};
+                tls_t mut_tls0{};
+                tls_t mut_tls1{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view0);
+                    initialize_pool(mut_view1);
+                    mut_page_pool.initialize(mut_view0, 0_idx);
+                    mut_page_pool.initialize(mut_view1, 1_idx);
+                    mut_tls1.numa_node = 1_u16.get();
+                    auto *const pmut_nd0{
+                        mut_page_pool.allocate<nd_t>(mut_tls0, mut_return_nullptr)};
+                    bsl::ut_required_step(pmut_nd0 == mut_pool0.at_if(0_idx));
+                    mut_page_pool.deallocate<nd_t>(mut_tls1, pmut_nd0);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto *const pmut_nd1{
+                            mut_page_pool.allocate<nd_t>(mut_tls1, mut_return_nullptr)};
+                        bsl::ut_check(pmut_nd1 == mut_pool1.at_if(0_idx));
+                        auto *const pmut_nd2{
+                            mut_page_pool.allocate<nd_t>(mut_tls0, mut_return_nullptr)};
+                        bsl::ut_check(pmut_nd2 == mut_pool0.at_if(0_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate_batch to the home node"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool0{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool1{};
+                bsl::array<nd_t *, 2_umx.get()> mut_batch{};
+                bsl::span mut_view0{mut_pool0};
+                bsl::span mut_view1{mut_pool1};
+                tls_t mut_tls0{};
+                tls_t mut_tls1{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view0);
+                    initialize_pool(mut_view1);
+                    mut_page_pool.initialize(mut_view0, 0_idx);
+                    mut_page_pool.initialize(mut_view1, 1_idx);
+                    mut_tls1.numa_node = 1_u16.get();
+                    *mut_batch.at_if(0_idx) =
+                        mut_page_pool.allocate<nd_t>(mut_tls0, mut_return_nullptr);
+                    *mut_batch.at_if(1_idx) =
+                        mut_page_pool.allocate<nd_t>(mut_tls1, mut_return_nullptr);
+                    mut_page_pool.deallocate_batch<nd_t>(
+                        mut_tls1, bsl::span<nd_t *const>{mut_batch.data(), mut_batch.size()});
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls0).is_zero());
+                        auto *const pmut_nd0{
+                            mut_page_pool.allocate<nd_t>(mut_tls0, mut_return_nullptr)};
+                        bsl::ut_check(pmut_nd0 == mut_pool0.at_if(0_idx));
+                        auto *const pmut_nd1{
+                            mut_page_pool.allocate<nd_t>(mut_tls1, mut_return_nullptr)};
+                        bsl::ut_check(pmut_nd1 == mut_pool1.at_if(0_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate_batch"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool{};
+                bsl::array<nd_t *, POOL_SIZE.get()> mut_batch{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    for (bsl::safe_idx mut_i{}; mut_i < POOL_SIZE; ++mut_i) {
+                        *mut_batch.at_if(mut_i) =
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr);
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_page_pool.deallocate_batch<nd_t>(
+                            mut_tls, bsl::span<nd_t *const>{mut_batch.data(), POOL_SIZE});
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls).is_zero());
+                        bsl::ut_check(mut_page_pool.remaining(mut_tls) == mut_page_pool.size());
+                        auto *const pmut_nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(pmut_nd == mut_pool.at_if(2_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate_batch empty"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    bsl::discard(mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_page_pool.deallocate_batch<nd_t>(mut_tls, {});
+                        bsl::ut_check(
+                            mut_page_pool.allocated(mut_tls) == HYPERVISOR_PAGE_SIZE);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate from the reserve"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_reserve{};
+                bsl::span mut_view{mut_pool};
+                bsl::span mut_reserve_view{mut_reserve};
+                auto const expected_size{(POOL_SIZE * HYPERVISOR_PAGE_SIZE * 2_umx).checked()};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    initialize_pool(mut_reserve_view);
+                    mut_page_pool.initialize(mut_view);
+                    mut_page_pool.initialize_reserve(mut_reserve_view);
+                    for (bsl::safe_idx mut_i{}; mut_i < POOL_SIZE; ++mut_i) {
+                        bsl::discard(mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr));
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto *const pmut_nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(pmut_nd == mut_reserve.at_if(0_idx));
+                        bsl::ut_check(mut_page_pool.size() == expected_size);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate until the reserve is empty"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_reserve{};
+                bsl::span mut_view{mut_pool};
+                bsl::span mut_reserve_view{mut_reserve};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    initialize_pool(mut_reserve_view);
+                    mut_page_pool.initialize(mut_view);
+                    mut_page_pool.initialize_reserve(mut_reserve_view);
+                    for (bsl::safe_idx mut_i{}; mut_i < (POOL_SIZE * 2_umx).checked(); ++mut_i) {
+                        bsl::discard(mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr));
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto *const pmut_nd{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(nullptr == pmut_nd);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"size"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 pool_t mut_page_pool{};
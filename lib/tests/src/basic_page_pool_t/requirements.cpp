@@ -73,6 +73,8 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_pool.initialize(mut_view)));
                 static_assert(noexcept(mut_pool.allocate<lib::basic_page_4k_t>(mut_tls)));
                 static_assert(noexcept(mut_pool.deallocate<lib::basic_page_4k_t>(mut_tls, {})));
+                static_assert(
+                    noexcept(mut_pool.deallocate_batch<lib::basic_page_4k_t>(mut_tls, {})));
                 static_assert(noexcept(mut_pool.size()));
                 static_assert(noexcept(mut_pool.allocated(mut_tls)));
                 static_assert(noexcept(mut_pool.remaining(mut_tls)));
@@ -28,6 +28,7 @@
 #include <basic_entry_status_t.hpp>
 
 #include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
 #include <bsl/expects.hpp>
 #include <bsl/safe_integral.hpp>
 
@@ -79,6 +80,61 @@ namespace helpers
         bsl::expects(page_flgs.is_valid_and_checked());
 
         pmut_entry->p = bsl::safe_u64::magic_1().get();
+        pmut_entry->reserved1 = page_flgs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the flags that were given to
+    ///     configure_entry_as_ptr_to_block() for the provided entry.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam E the type of entry to query
+    ///   @param entry the entry to query
+    ///   @return Returns the flags that were given to
+    ///     configure_entry_as_ptr_to_block() for the provided entry.
+    ///
+    template<typename E>
+    [[nodiscard]] constexpr auto
+    entry_to_page_flgs(E const *const entry) noexcept -> bsl::safe_u64
+    {
+        bsl::expects(nullptr != entry);
+        return bsl::to_u64(entry->reserved1);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the hardware set the dirty flag of the
+    ///     provided block. The entries used by the unit tests do not
+    ///     have a dirty flag, so this always returns false.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam E the type of entry to query
+    ///   @param entry the entry to query
+    ///   @return Returns true if the dirty flag of the block is set.
+    ///
+    template<typename E>
+    [[nodiscard]] constexpr auto
+    entry_to_dirty(E const *const entry) noexcept -> bool
+    {
+        bsl::expects(nullptr != entry);
+        return false;
+    }
+
+    /// <!-- description -->
+    ///   @brief Sets or clears the dirty flag of the provided block.
+    ///     The entries used by the unit tests do not have a dirty flag,
+    ///     so this does nothing.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam E the type of entry to configure
+    ///   @param pmut_entry the entry to configure
+    ///   @param dirty the value to give the dirty flag
+    ///
+    template<typename E>
+    constexpr void
+    configure_entry_dirty(E *const pmut_entry, bool const dirty) noexcept
+    {
+        bsl::expects(nullptr != pmut_entry);
+        bsl::discard(dirty);
     }
 
     /// <!-- description -->
@@ -26,6 +26,9 @@
 
 #include <basic_alloc_page_t.hpp>
 #include <basic_entries_t.hpp>
+#include <basic_map_page_flags.hpp>
+#include <basic_page_1g_t.hpp>
+#include <basic_page_2m_t.hpp>
 #include <basic_page_4k_t.hpp>
 #include <basic_page_pool_t.hpp>
 #include <intrinsic_t.hpp>
@@ -37,8 +40,10 @@
 
 #include <bsl/array.hpp>
 #include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
 #include <bsl/dontcare_t.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
 
@@ -1611,6 +1616,32 @@ namespace lib
             };
         };
 
+        bsl::ut_scenario{"unmap allocated 4k with deferred release"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::dontcare_t mut_sys{};
+                basic_page_4k_t *pmut_mut_page{};
+                constexpr auto bytes{(5_umx * HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    pmut_mut_page = mut_rpt.allocate_page<basic_page_4k_t>(
+                        mut_tls, mut_page_pool, {}, {}, mut_sys);
+                    bsl::ut_required_step(nullptr != pmut_mut_page);
+                    mut_rpt.set_defer_release(true);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.unmap<l0e_t>(mut_tls, mut_page_pool, {}));
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls) == bytes);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_page_pool.deallocate(mut_tls, pmut_mut_page);
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"unmap 1 of 2 4k"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 root_page_table_t mut_rpt{};
@@ -1744,6 +1775,37 @@ namespace lib
         };
 
         bsl::ut_scenario{"map 2m, unmap 4k"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto phys{0x200000_u64};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto virt{0x1000_u64};
+                constexpr auto expected_phys{0x201_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_rpt.map<l1e_t>(
+                        mut_tls, mut_page_pool, {}, phys, flgs, explicit_unmap, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.unmap<l0e_t>(mut_tls, mut_page_pool, {}));
+                        auto const ents{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, virt)};
+                        bsl::ut_check(nullptr != ents.l0e);
+                        bsl::ut_check(ents.l0e->points_to_block == enabled);
+                        bsl::ut_check(ents.l0e->phys == expected_phys);
+                        bsl::ut_check(nullptr != ents.l1e);
+                        bsl::ut_check(ents.l1e->points_to_block == disabled);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map 2m, unmap 4k split fails"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 root_page_table_t mut_rpt{};
                 tls_t mut_tls{};
@@ -1753,8 +1815,12 @@ namespace lib
                     bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
                     bsl::ut_required_step(
                         mut_rpt.map<l1e_t>(mut_tls, mut_page_pool, {}, {}, {}, {}, mut_sys));
+                    mut_page_pool.set_allocate<helpers::l0t_t>(nullptr, {});
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(!mut_rpt.unmap<l0e_t>(mut_tls, mut_page_pool, {}));
+                        auto const ents{mut_rpt.entries<l1e_t>(mut_tls, mut_page_pool, {})};
+                        bsl::ut_check(nullptr != ents.l1e);
+                        bsl::ut_check(ents.l1e->points_to_block == enabled);
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_rpt.release(mut_tls, mut_page_pool);
@@ -1768,13 +1834,24 @@ namespace lib
                 root_page_table_t mut_rpt{};
                 tls_t mut_tls{};
                 page_pool_t mut_page_pool{};
+                constexpr auto phys{0x40000000_u64};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{};
                 bsl::dontcare_t mut_sys{};
+                constexpr auto virt{0x200000_u64};
+                constexpr auto expected_phys{0x40200_u64};
                 bsl::ut_when{} = [&]() noexcept {
                     bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
-                    bsl::ut_required_step(
-                        mut_rpt.map<l2e_t>(mut_tls, mut_page_pool, {}, {}, {}, {}, mut_sys));
+                    bsl::ut_required_step(mut_rpt.map<l2e_t>(
+                        mut_tls, mut_page_pool, {}, phys, flgs, explicit_unmap, mut_sys));
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(!mut_rpt.unmap<l1e_t>(mut_tls, mut_page_pool, {}));
+                        bsl::ut_check(mut_rpt.unmap<l1e_t>(mut_tls, mut_page_pool, {}));
+                        auto const ents{mut_rpt.entries<l1e_t>(mut_tls, mut_page_pool, virt)};
+                        bsl::ut_check(nullptr != ents.l1e);
+                        bsl::ut_check(ents.l1e->points_to_block == enabled);
+                        bsl::ut_check(ents.l1e->phys == expected_phys);
+                        bsl::ut_check(nullptr != ents.l2e);
+                        bsl::ut_check(ents.l2e->points_to_block == disabled);
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_rpt.release(mut_tls, mut_page_pool);
@@ -1784,6 +1861,369 @@ namespace lib
         };
 
         bsl::ut_scenario{"map 1g, unmap 4k"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto phys{0x40000000_u64};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto virt_4k{0x1000_u64};
+                constexpr auto virt_2m{0x200000_u64};
+                constexpr auto expected_phys_4k{0x40001_u64};
+                constexpr auto expected_phys_2m{0x40200_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_rpt.map<l2e_t>(
+                        mut_tls, mut_page_pool, {}, phys, flgs, explicit_unmap, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.unmap<l0e_t>(mut_tls, mut_page_pool, {}));
+                        auto const ents_4k{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, virt_4k)};
+                        bsl::ut_check(nullptr != ents_4k.l0e);
+                        bsl::ut_check(ents_4k.l0e->phys == expected_phys_4k);
+                        auto const ents_2m{mut_rpt.entries<l1e_t>(mut_tls, mut_page_pool, virt_2m)};
+                        bsl::ut_check(nullptr != ents_2m.l1e);
+                        bsl::ut_check(ents_2m.l1e->points_to_block == enabled);
+                        bsl::ut_check(ents_2m.l1e->phys == expected_phys_2m);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map 4k until a l0t is full promotes it to 2m"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto phys{0x200000_u64};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto pages{512_u64};
+                constexpr auto virt{0x2000_u64};
+                constexpr auto expected_phys_2m{0x200_u64};
+                constexpr auto expected_phys_4k{0x202_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    mut_rpt.set_promote(true);
+                    for (bsl::safe_u64 mut_i{}; mut_i < pages; ++mut_i) {
+                        auto const off{(mut_i * HYPERVISOR_PAGE_SIZE).checked()};
+                        bsl::ut_required_step(mut_rpt.map<l0e_t>(
+                            mut_tls,
+                            mut_page_pool,
+                            off,
+                            (phys + off).checked(),
+                            flgs,
+                            explicit_unmap,
+                            mut_sys));
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const ents_2m{mut_rpt.entries<l1e_t>(mut_tls, mut_page_pool, {})};
+                        bsl::ut_check(nullptr != ents_2m.l1e);
+                        bsl::ut_check(ents_2m.l1e->points_to_block == enabled);
+                        bsl::ut_check(ents_2m.l1e->phys == expected_phys_2m);
+
+                        bsl::ut_check(mut_rpt.unmap<l0e_t>(mut_tls, mut_page_pool, {}));
+                        auto const ents_4k{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, virt)};
+                        bsl::ut_check(nullptr != ents_4k.l0e);
+                        bsl::ut_check(ents_4k.l0e->phys == expected_phys_4k);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map 4k does not promote by default"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto phys{0x200000_u64};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto pages{512_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    for (bsl::safe_u64 mut_i{}; mut_i < pages; ++mut_i) {
+                        auto const off{(mut_i * HYPERVISOR_PAGE_SIZE).checked()};
+                        bsl::ut_required_step(mut_rpt.map<l0e_t>(
+                            mut_tls,
+                            mut_page_pool,
+                            off,
+                            (phys + off).checked(),
+                            flgs,
+                            explicit_unmap,
+                            mut_sys));
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const ents{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, {})};
+                        bsl::ut_check(nullptr != ents.l0e);
+                        bsl::ut_check(ents.l1e->points_to_block == disabled);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map 4k with different flags does not promote"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto phys{0x200000_u64};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto pages{511_u64};
+                constexpr auto last_virt{0x1FF000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    mut_rpt.set_promote(true);
+                    for (bsl::safe_u64 mut_i{}; mut_i < pages; ++mut_i) {
+                        auto const off{(mut_i * HYPERVISOR_PAGE_SIZE).checked()};
+                        bsl::ut_required_step(mut_rpt.map<l0e_t>(
+                            mut_tls,
+                            mut_page_pool,
+                            off,
+                            (phys + off).checked(),
+                            flgs,
+                            explicit_unmap,
+                            mut_sys));
+                    }
+                    bsl::ut_required_step(mut_rpt.map<l0e_t>(
+                        mut_tls,
+                        mut_page_pool,
+                        last_virt,
+                        (phys + last_virt).checked(),
+                        BASIC_MAP_PAGE_RW,
+                        explicit_unmap,
+                        mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const ents{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, {})};
+                        bsl::ut_check(nullptr != ents.l0e);
+                        bsl::ut_check(ents.l1e->points_to_block == disabled);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map 4k as explicit unmap does not promote"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto phys{0x200000_u64};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{true};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto pages{512_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    mut_rpt.set_promote(true);
+                    for (bsl::safe_u64 mut_i{}; mut_i < pages; ++mut_i) {
+                        auto const off{(mut_i * HYPERVISOR_PAGE_SIZE).checked()};
+                        bsl::ut_required_step(mut_rpt.map<l0e_t>(
+                            mut_tls,
+                            mut_page_pool,
+                            off,
+                            (phys + off).checked(),
+                            flgs,
+                            explicit_unmap,
+                            mut_sys));
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const ents{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, {})};
+                        bsl::ut_check(nullptr != ents.l0e);
+                        bsl::ut_check(ents.l1e->points_to_block == disabled);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        for (bsl::safe_u64 mut_i{}; mut_i < pages; ++mut_i) {
+                            auto const off{(mut_i * HYPERVISOR_PAGE_SIZE).checked()};
+                            bsl::ut_check(mut_rpt.unmap<l0e_t>(mut_tls, mut_page_pool, off));
+                        }
+
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map 2m until a l1t is full promotes it to 1g"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto phys{0x40000000_u64};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto pages{512_u64};
+                constexpr auto page_size{0x200000_u64};
+                constexpr auto expected_phys{0x40000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    mut_rpt.set_promote(true);
+                    mut_rpt.set_promote_1g(true);
+                    for (bsl::safe_u64 mut_i{}; mut_i < pages; ++mut_i) {
+                        auto const off{(mut_i * page_size).checked()};
+                        bsl::ut_required_step(mut_rpt.map<l1e_t>(
+                            mut_tls,
+                            mut_page_pool,
+                            off,
+                            (phys + off).checked(),
+                            flgs,
+                            explicit_unmap,
+                            mut_sys));
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const ents{mut_rpt.entries<l2e_t>(mut_tls, mut_page_pool, {})};
+                        bsl::ut_check(nullptr != ents.l2e);
+                        bsl::ut_check(ents.l2e->points_to_block == enabled);
+                        bsl::ut_check(ents.l2e->phys == expected_phys);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map 2m does not promote to 1g by default"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto phys{0x40000000_u64};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto pages{512_u64};
+                constexpr auto page_size{0x200000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    mut_rpt.set_promote(true);
+                    for (bsl::safe_u64 mut_i{}; mut_i < pages; ++mut_i) {
+                        auto const off{(mut_i * page_size).checked()};
+                        bsl::ut_required_step(mut_rpt.map<l1e_t>(
+                            mut_tls,
+                            mut_page_pool,
+                            off,
+                            (phys + off).checked(),
+                            flgs,
+                            explicit_unmap,
+                            mut_sys));
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const ents{mut_rpt.entries<l1e_t>(mut_tls, mut_page_pool, {})};
+                        bsl::ut_check(nullptr != ents.l1e);
+                        bsl::ut_check(ents.l2e->points_to_block == disabled);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"set_page_flgs never mapped"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            !mut_rpt.set_page_flgs<l0e_t>(mut_tls, mut_page_pool, {}, {}));
+                        bsl::ut_check(
+                            !mut_rpt.set_page_flgs<l1e_t>(mut_tls, mut_page_pool, {}, {}));
+                        bsl::ut_check(
+                            !mut_rpt.set_page_flgs<l2e_t>(mut_tls, mut_page_pool, {}, {}));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"set_page_flgs 4k"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto phys{0x1000_u64};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto new_flgs{BASIC_MAP_PAGE_RW};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_rpt.map<l0e_t>(
+                        mut_tls, mut_page_pool, {}, phys, flgs, explicit_unmap, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_rpt.set_page_flgs<l0e_t>(mut_tls, mut_page_pool, {}, new_flgs));
+                        auto const ents{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, {})};
+                        bsl::ut_check(nullptr != ents.l0e);
+                        bsl::ut_check(ents.l0e->reserved1 == new_flgs);
+                        bsl::ut_check(ents.l0e->phys == (phys >> BASIC_PAGE_4K_T_SHFT));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map 2m, set_page_flgs 4k"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto phys{0x200000_u64};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto virt{0x1000_u64};
+                constexpr auto new_flgs{BASIC_MAP_PAGE_RW};
+                constexpr auto expected_phys{0x201_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_rpt.map<l1e_t>(
+                        mut_tls, mut_page_pool, {}, phys, flgs, explicit_unmap, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_rpt.set_page_flgs<l0e_t>(mut_tls, mut_page_pool, virt, new_flgs));
+                        auto const ents{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, virt)};
+                        bsl::ut_check(nullptr != ents.l0e);
+                        bsl::ut_check(ents.l0e->reserved1 == new_flgs);
+                        bsl::ut_check(ents.l0e->phys == expected_phys);
+                        bsl::ut_check(ents.l1e->points_to_block == disabled);
+                        auto const other{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, {})};
+                        bsl::ut_check(nullptr != other.l0e);
+                        bsl::ut_check(other.l0e->reserved1 == flgs);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map 2m, set_page_flgs 4k split fails"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 root_page_table_t mut_rpt{};
                 tls_t mut_tls{};
@@ -1792,9 +2232,189 @@ namespace lib
                 bsl::ut_when{} = [&]() noexcept {
                     bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
                     bsl::ut_required_step(
-                        mut_rpt.map<l2e_t>(mut_tls, mut_page_pool, {}, {}, {}, {}, mut_sys));
+                        mut_rpt.map<l1e_t>(mut_tls, mut_page_pool, {}, {}, {}, {}, mut_sys));
+                    mut_page_pool.set_allocate<helpers::l0t_t>(nullptr, {});
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(!mut_rpt.unmap<l0e_t>(mut_tls, mut_page_pool, {}));
+                        bsl::ut_check(
+                            !mut_rpt.set_page_flgs<l0e_t>(mut_tls, mut_page_pool, {}, {}));
+                        auto const ents{mut_rpt.entries<l1e_t>(mut_tls, mut_page_pool, {})};
+                        bsl::ut_check(nullptr != ents.l1e);
+                        bsl::ut_check(ents.l1e->points_to_block == enabled);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map 4k, set_page_flgs 2m changes every 4k"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x1000_u64};
+                constexpr auto phys1{0x1000_u64};
+                constexpr auto phys2{0x5000_u64};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto new_flgs{BASIC_MAP_PAGE_RW};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_rpt.map<l0e_t>(
+                        mut_tls, mut_page_pool, {}, phys1, flgs, explicit_unmap, mut_sys));
+                    bsl::ut_required_step(mut_rpt.map<l0e_t>(
+                        mut_tls, mut_page_pool, virt, phys2, flgs, explicit_unmap, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_rpt.set_page_flgs<l1e_t>(mut_tls, mut_page_pool, {}, new_flgs));
+                        auto const ents1{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, {})};
+                        bsl::ut_check(nullptr != ents1.l0e);
+                        bsl::ut_check(ents1.l0e->reserved1 == new_flgs);
+                        auto const ents2{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, virt)};
+                        bsl::ut_check(nullptr != ents2.l0e);
+                        bsl::ut_check(ents2.l0e->reserved1 == new_flgs);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"set_page_flgs back to the same flags promotes"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto phys{0x200000_u64};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto virt{0x1000_u64};
+                constexpr auto new_flgs{BASIC_MAP_PAGE_RW};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    mut_rpt.set_promote(true);
+                    bsl::ut_required_step(mut_rpt.map<l1e_t>(
+                        mut_tls, mut_page_pool, {}, phys, flgs, explicit_unmap, mut_sys));
+                    bsl::ut_required_step(
+                        mut_rpt.set_page_flgs<l0e_t>(mut_tls, mut_page_pool, virt, new_flgs));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_rpt.set_page_flgs<l0e_t>(mut_tls, mut_page_pool, virt, flgs));
+                        auto const ents{mut_rpt.entries<l1e_t>(mut_tls, mut_page_pool, {})};
+                        bsl::ut_check(nullptr != ents.l1e);
+                        bsl::ut_check(ents.l1e->points_to_block == enabled);
+                        bsl::ut_check(ents.l1e->reserved1 == flgs);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"page_size"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto virt_4k{0x1000_u64};
+                constexpr auto virt_2m{0x200000_u64};
+                constexpr auto virt_1g{0x40000000_u64};
+                constexpr auto virt_none{0x80000000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_rpt.map<l0e_t>(
+                        mut_tls, mut_page_pool, virt_4k, {}, flgs, explicit_unmap, mut_sys));
+                    bsl::ut_required_step(mut_rpt.map<l1e_t>(
+                        mut_tls, mut_page_pool, virt_2m, {}, flgs, explicit_unmap, mut_sys));
+                    bsl::ut_required_step(mut_rpt.map<l2e_t>(
+                        mut_tls, mut_page_pool, virt_1g, {}, flgs, explicit_unmap, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const size_4k{mut_rpt.page_size(mut_tls, mut_page_pool, virt_4k)};
+                        bsl::ut_check(size_4k == BASIC_PAGE_4K_T_SIZE);
+                        auto const size_2m{mut_rpt.page_size(mut_tls, mut_page_pool, virt_2m)};
+                        bsl::ut_check(size_2m == BASIC_PAGE_2M_T_SIZE);
+                        auto const size_1g{mut_rpt.page_size(mut_tls, mut_page_pool, virt_1g)};
+                        bsl::ut_check(size_1g == BASIC_PAGE_1G_T_SIZE);
+                        auto const none{mut_rpt.page_size(mut_tls, mut_page_pool, virt_none)};
+                        bsl::ut_check(none.is_zero());
+                        bsl::ut_check(mut_rpt.page_size(mut_tls, mut_page_pool, {}).is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"for_each_block and update_block"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto virt_4k{0x1000_u64};
+                constexpr auto virt_2m{0x200000_u64};
+                constexpr auto virt_1g{0x40000000_u64};
+                constexpr auto virt_none{0x80000000_u64};
+                constexpr auto total{(virt_1g + virt_2m + virt_4k).checked()};
+                bsl::safe_u64 mut_blocks{};
+                bsl::safe_u64 mut_bytes{};
+                bsl::safe_u64 mut_marked{};
+                bsl::safe_u64 mut_block_virt{};
+                auto const count{[&](bsl::safe_u64 const &virt,
+                                     bsl::safe_u64 const &bytes,
+                                     auto const &entry) noexcept -> bool {
+                    bsl::discard(virt);
+                    ++mut_blocks;
+                    mut_bytes += bytes;
+                    mut_marked += bsl::to_u64(entry.reserved1);
+                    return false;
+                }};
+                auto const mark{[&](bsl::safe_u64 const &virt,
+                                    bsl::safe_u64 const &bytes,
+                                    auto &mut_entry) noexcept -> bool {
+                    bsl::discard(bytes);
+                    mut_block_virt = virt;
+                    mut_entry.reserved1 = bsl::safe_u64::magic_1().get();
+                    return true;
+                }};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_rpt.map<l0e_t>(
+                        mut_tls, mut_page_pool, virt_4k, {}, flgs, explicit_unmap, mut_sys));
+                    bsl::ut_required_step(mut_rpt.map<l1e_t>(
+                        mut_tls, mut_page_pool, virt_2m, {}, flgs, explicit_unmap, mut_sys));
+                    bsl::ut_required_step(mut_rpt.map<l2e_t>(
+                        mut_tls, mut_page_pool, virt_1g, {}, flgs, explicit_unmap, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_rpt.for_each_block(mut_tls, mut_page_pool, count);
+                        bsl::ut_check(3_u64 == mut_blocks);
+                        bsl::ut_check(total == mut_bytes);
+                        bsl::ut_check(mut_marked.is_zero());
+
+                        auto const inside{(virt_2m + virt_4k).checked()};
+                        auto const size{mut_rpt.update_block(mut_tls, mut_page_pool, inside, mark)};
+                        bsl::ut_check(BASIC_PAGE_2M_T_SIZE == size);
+                        bsl::ut_check(virt_2m == mut_block_virt);
+
+                        mut_block_virt = {};
+                        auto const none{
+                            mut_rpt.update_block(mut_tls, mut_page_pool, virt_none, mark)};
+                        bsl::ut_check(none.is_zero());
+                        bsl::ut_check(mut_block_virt.is_zero());
+
+                        mut_rpt.for_each_block(mut_tls, mut_page_pool, count);
+                        bsl::ut_check(bsl::safe_u64::magic_1() == mut_marked);
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_rpt.release(mut_tls, mut_page_pool);
@@ -3475,6 +4095,180 @@ namespace lib
             };
         };
 
+        bsl::ut_scenario{"add_tables and remove_stale_tables"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_src{};
+                root_page_table_t mut_dst{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::dontcare_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_src.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_dst.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_src.map<l0e_t>(mut_tls, mut_page_pool, {}, {}, {}, {}, mut_sys));
+                    mut_dst.add_tables(mut_tls, mut_src);
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_dst.remove_stale_tables(mut_tls, mut_src);
+                        bsl::ut_check(!mut_dst.map<l0e_t>(
+                            mut_tls, mut_page_pool, {}, {}, {}, {}, mut_sys));
+                    };
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_src.unmap<l0e_t>(mut_tls, mut_page_pool, {}));
+                        mut_dst.remove_stale_tables(mut_tls, mut_src);
+                        bsl::ut_check(mut_dst.map<l0e_t>(
+                            mut_tls, mut_page_pool, {}, {}, {}, {}, mut_sys));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_dst.release(mut_tls, mut_page_pool);
+                        mut_src.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"clear"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_src{};
+                root_page_table_t mut_dst{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto virt{0x0000008000000000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_src.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_dst.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_src.map<l0e_t>(mut_tls, mut_page_pool, {}, {}, {}, {}, mut_sys));
+                    bsl::ut_required_step(
+                        mut_dst.map<l0e_t>(mut_tls, mut_page_pool, virt, {}, {}, {}, mut_sys));
+                    mut_dst.add_tables(mut_tls, mut_src);
+                    mut_dst.clear(mut_tls, mut_page_pool);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_dst.is_initialized());
+                        bsl::ut_check(mut_dst.map<l0e_t>(
+                            mut_tls, mut_page_pool, {}, {}, {}, {}, mut_sys));
+                        bsl::ut_check(mut_dst.map<l0e_t>(
+                            mut_tls, mut_page_pool, virt, {}, {}, {}, mut_sys));
+                        bsl::ut_check(mut_src.unmap<l0e_t>(mut_tls, mut_page_pool, {}));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_dst.release(mut_tls, mut_page_pool);
+                        mut_src.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"clear with explicit unmap"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::dontcare_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map<l0e_t>(mut_tls, mut_page_pool, {}, {}, {}, true, mut_sys));
+                    mut_rpt.clear(mut_tls, mut_page_pool);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_rpt.map<l0e_t>(
+                            mut_tls, mut_page_pool, {}, {}, {}, {}, mut_sys));
+                        bsl::ut_check(mut_rpt.unmap<l0e_t>(mut_tls, mut_page_pool, {}));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"reclaim"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_src{};
+                root_page_table_t mut_dst{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::dontcare_t mut_sys{};
+                constexpr auto virt{0x0000008000000000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_src.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_dst.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_src.map<l0e_t>(mut_tls, mut_page_pool, {}, {}, {}, {}, mut_sys));
+                    bsl::ut_required_step(
+                        mut_dst.map<l0e_t>(mut_tls, mut_page_pool, virt, {}, {}, {}, mut_sys));
+                    mut_dst.add_tables(mut_tls, mut_src);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_dst.reclaim(mut_tls, mut_page_pool));
+                        bsl::ut_check(mut_dst.is_initialized());
+                        bsl::ut_check(mut_dst.map<l0e_t>(
+                            mut_tls, mut_page_pool, {}, {}, {}, {}, mut_sys));
+                        bsl::ut_check(mut_dst.map<l0e_t>(
+                            mut_tls, mut_page_pool, virt, {}, {}, {}, mut_sys));
+                        bsl::ut_check(mut_src.unmap<l0e_t>(mut_tls, mut_page_pool, {}));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_dst.release(mut_tls, mut_page_pool);
+                        mut_src.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"reclaim in batches"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto flgs{0x0_u64};
+                bsl::dontcare_t mut_sys{};
+                auto const pages{(RPT_RECLAIM_BATCH_PAGES + 1_umx).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    for (bsl::safe_idx mut_i{}; mut_i < pages; ++mut_i) {
+                        auto const virt{(bsl::to_u64(mut_i) * HYPERVISOR_PAGE_SIZE).checked()};
+                        bsl::ut_required_step(
+                            nullptr != mut_rpt.allocate_page<basic_page_4k_t>(
+                                           mut_tls, mut_page_pool, virt, flgs, mut_sys));
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_rpt.reclaim(mut_tls, mut_page_pool));
+                        bsl::ut_check(mut_rpt.reclaim(mut_tls, mut_page_pool));
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls) == HYPERVISOR_PAGE_SIZE);
+                        bsl::ut_check(nullptr != mut_rpt.allocate_page<basic_page_4k_t>(
+                                                     mut_tls, mut_page_pool, {}, flgs, mut_sys));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"reclaim with explicit unmap"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::dontcare_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map<l0e_t>(mut_tls, mut_page_pool, {}, {}, {}, true, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.reclaim(mut_tls, mut_page_pool));
+                        bsl::ut_check(!mut_rpt.map<l0e_t>(
+                            mut_tls, mut_page_pool, {}, {}, {}, {}, mut_sys));
+                        bsl::ut_check(mut_rpt.unmap<l0e_t>(mut_tls, mut_page_pool, {}));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
@@ -0,0 +1,277 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../src/basic_root_page_table_t.hpp"
+
+#include <atomic>
+#include <basic_map_page_flags.hpp>
+#include <basic_page_pool_node_t.hpp>
+#include <basic_page_pool_t.hpp>
+#include <initialize_page_pool.hpp>
+#include <intrinsic_t.hpp>
+#include <l0e_t.hpp>
+#include <l1e_t.hpp>
+#include <l2e_t.hpp>
+#include <l3e_t.hpp>
+#include <thread>
+#include <tls_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace lib
+{
+    /// @brief defines the number of pages in the page pool
+    constexpr auto POOL_PAGES{64_umx};
+    /// @brief defines the number of reader threads
+    constexpr auto NUM_READERS{4_umx};
+    /// @brief defines how many times the writer unmaps/maps the churn page
+    constexpr auto WRITER_ITERATIONS{0x4000_u64};
+
+    /// @brief defines the page pool's direct map address
+    constexpr auto POOL_MAP_ADDR{0x0000000000001000_umx};
+    /// @brief defines the page pool's direct map size
+    constexpr auto POOL_MAP_SIZE{0x00007FFFFFFFE000_umx};
+
+    /// @brief defines the address that stays mapped for the whole test
+    constexpr auto ANCHOR_VIRT{0x0000008000000000_u64};
+    /// @brief defines the physical address ANCHOR_VIRT is mapped to
+    constexpr auto ANCHOR_PHYS{0x0000000000042000_u64};
+    /// @brief defines the address the writer keeps unmapping and mapping.
+    ///   It is the only address in its l3t entry, so each unmap() removes
+    ///   (and each map() adds) an l2t, l1t and l0t. Its l0t offset is not
+    ///   0, as that is where the page pool links free pages together.
+    constexpr auto CHURN_VIRT{0x0000010000007000_u64};
+    /// @brief defines the physical address CHURN_VIRT is mapped to
+    constexpr auto CHURN_PHYS{0x0000000000024000_u64};
+
+    /// @brief defines the page_pool_t used by the test
+    using page_pool_t = basic_page_pool_t<tls_t, bool, POOL_MAP_ADDR.get(), POOL_MAP_SIZE.get()>;
+
+    /// @brief defines the root_page_table_t used by the test
+    using root_page_table_t = basic_root_page_table_t<
+        tls_t,
+        bool,
+        page_pool_t,
+        intrinsic_t,
+        l3e_t,
+        l2e_t,
+        l1e_t,
+        l0e_t>;
+
+    /// @brief stores the pages given to the page pool
+    alignas(HYPERVISOR_PAGE_SIZE.get())
+        constinit bsl::array<basic_page_pool_node_t, POOL_PAGES.get()> g_mut_pool_pages{};
+    /// @brief the page pool used by the root page table
+    constinit page_pool_t g_mut_page_pool{};
+    /// @brief the root page table shared by the writer and the readers
+    constinit root_page_table_t g_mut_rpt{};
+
+    /// @brief set by the writer while CHURN_VIRT is mapped
+    constinit std::atomic<bool> g_mut_churn_mapped{};
+    /// @brief set by the writer once it is done
+    constinit std::atomic<bool> g_mut_writer_done{};
+    /// @brief set by a reader if a query returned the wrong result
+    constinit std::atomic<bool> g_mut_reader_failed{};
+    /// @brief stores how many queries of CHURN_VIRT succeeded
+    constinit std::atomic<bsl::uint64> g_mut_churn_hits{};
+
+    /// <!-- description -->
+    ///   @brief Repeatedly unmaps and maps CHURN_VIRT. Every unmap()
+    ///     removes three tables from the RPT that the readers might be
+    ///     walking at the same time.
+    ///
+    void
+    writer_func() noexcept
+    {
+        tls_t mut_tls{};
+        bool mut_sys{true};
+
+        for (bsl::safe_u64 mut_i{}; mut_i < WRITER_ITERATIONS; ++mut_i) {
+            g_mut_churn_mapped = false;
+            bsl::discard(g_mut_rpt.unmap(mut_tls, g_mut_page_pool, CHURN_VIRT));
+            bsl::discard(g_mut_rpt.map(
+                mut_tls,
+                g_mut_page_pool,
+                CHURN_VIRT,
+                CHURN_PHYS,
+                BASIC_MAP_PAGE_RW,
+                false,
+                mut_sys));
+            g_mut_churn_mapped = true;
+        }
+
+        g_mut_writer_done = true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Queries ANCHOR_VIRT and CHURN_VIRT until the writer is
+    ///     done. ANCHOR_VIRT must always be found. CHURN_VIRT is only
+    ///     queried while the writer says it is mapped, which means most
+    ///     queries finish before the writer unmaps it, but some will still
+    ///     be walking the RPT when the writer removes its tables.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ppid the ID of the PP this reader pretends to be
+    ///
+    void
+    reader_func(bsl::safe_u16 const &ppid) noexcept
+    {
+        tls_t mut_tls{};
+        mut_tls.ppid = ppid.get();
+
+        while (!g_mut_writer_done) {
+            auto const anchor{g_mut_rpt.entries(mut_tls, g_mut_page_pool, ANCHOR_VIRT)};
+            if (nullptr == anchor.l0e) {
+                g_mut_reader_failed = true;
+                return;
+            }
+
+            if ((ANCHOR_PHYS >> BASIC_PAGE_4K_T_SHFT) != anchor.l0e->phys) {
+                g_mut_reader_failed = true;
+                return;
+            }
+
+            if (!g_mut_churn_mapped) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            auto const churn{g_mut_rpt.entries(mut_tls, g_mut_page_pool, CHURN_VIRT)};
+            if (nullptr == churn.l0e) {
+                continue;
+            }
+
+            if ((nullptr == churn.l3e) || (nullptr == churn.l2e) || (nullptr == churn.l1e)) {
+                g_mut_reader_failed = true;
+                return;
+            }
+
+            /// NOTE:
+            /// - Once entries() returns, the writer is free to unmap the
+            ///   page, so the entry is allowed to be 0, but it must never
+            ///   contain anything other than what the writer mapped.
+            ///
+
+            auto const phys{bsl::to_u64(churn.l0e->phys)};
+            if (phys.is_pos() && ((CHURN_PHYS >> BASIC_PAGE_4K_T_SHFT) != phys)) {
+                g_mut_reader_failed = true;
+                return;
+            }
+
+            ++g_mut_churn_hits;
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"queries while another PP maps and unmaps"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                bool mut_sys{true};
+                bsl::array<std::thread, NUM_READERS.get()> mut_readers{};
+                initialize_page_pool(g_mut_pool_pages, g_mut_page_pool);
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_check(g_mut_rpt.initialize(mut_tls, g_mut_page_pool, mut_sys));
+                    bsl::ut_check(g_mut_rpt.map(
+                        mut_tls,
+                        g_mut_page_pool,
+                        ANCHOR_VIRT,
+                        ANCHOR_PHYS,
+                        BASIC_MAP_PAGE_RW,
+                        false,
+                        mut_sys));
+                    bsl::ut_check(g_mut_rpt.map(
+                        mut_tls,
+                        g_mut_page_pool,
+                        CHURN_VIRT,
+                        CHURN_PHYS,
+                        BASIC_MAP_PAGE_RW,
+                        false,
+                        mut_sys));
+
+                    g_mut_churn_mapped = true;
+
+                    for (bsl::safe_idx mut_i{}; mut_i < NUM_READERS; ++mut_i) {
+                        auto const ppid{bsl::to_u16(mut_i)};
+                        *mut_readers.at_if(mut_i) = std::thread{&reader_func, ppid};
+                    }
+
+                    writer_func();
+
+                    for (bsl::safe_idx mut_i{}; mut_i < NUM_READERS; ++mut_i) {
+                        mut_readers.at_if(mut_i)->join();
+                    }
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!g_mut_reader_failed);
+                        bsl::ut_check(static_cast<bsl::uint64>(g_mut_churn_hits) > 0_u64);
+
+                        /// NOTE:
+                        /// - Any table that was retired while a query was
+                        ///   in flight has to be given back by release(),
+                        ///   otherwise it would be leaked.
+                        ///
+
+                        g_mut_rpt.release(mut_tls, g_mut_page_pool);
+                        bsl::ut_check(g_mut_page_pool.allocated(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(lib::tests() == bsl::ut_success());
+    return lib::tests();
+}
@@ -81,23 +81,37 @@ main() noexcept -> bsl::exit_code
             page_pool_t mut_page_pool{};
             lib::intrinsic_t mut_intrinsic{};
             lib::basic_page_table_t<lib::l3e_t> const l3e{};
+            auto const func{[](bsl::safe_u64 const &, bsl::safe_u64 const &, auto &) noexcept {
+                return false;
+            }};
             bsl::ut_then{} = []() noexcept {
                 static_assert(noexcept(root_page_table_t{}));
 
                 static_assert(noexcept(mut_rpt.initialize(mut_tls, mut_page_pool)));
                 static_assert(noexcept(mut_rpt.release(mut_tls, mut_page_pool)));
+                static_assert(noexcept(mut_rpt.clear(mut_tls, mut_page_pool)));
+                static_assert(noexcept(mut_rpt.reclaim(mut_tls, mut_page_pool)));
                 static_assert(noexcept(mut_rpt.is_initialized()));
                 static_assert(noexcept(mut_rpt.activate(mut_tls, mut_intrinsic)));
                 static_assert(noexcept(mut_rpt.is_inactive(mut_tls)));
                 static_assert(noexcept(mut_rpt.spa()));
+                static_assert(noexcept(mut_rpt.set_promote({})));
+                static_assert(noexcept(mut_rpt.set_promote_1g({})));
+                static_assert(noexcept(mut_rpt.set_defer_release({})));
+                static_assert(noexcept(mut_rpt.set_hold_retired({})));
                 static_assert(noexcept(mut_rpt.map(mut_tls, mut_page_pool, {}, {}, {})));
                 static_assert(noexcept(
                     mut_rpt.allocate_page<lib::basic_page_4k_t>(mut_tls, mut_page_pool, {}, {})));
                 static_assert(noexcept(mut_rpt.allocate_page<>(mut_tls, mut_page_pool)));
                 static_assert(noexcept(mut_rpt.unmap(mut_tls, mut_page_pool, {})));
+                static_assert(noexcept(mut_rpt.set_page_flgs(mut_tls, mut_page_pool, {}, {})));
                 static_assert(noexcept(mut_rpt.entries(mut_tls, mut_page_pool, {})));
+                static_assert(noexcept(mut_rpt.page_size(mut_tls, mut_page_pool, {})));
+                static_assert(noexcept(mut_rpt.for_each_block(mut_tls, mut_page_pool, func)));
+                static_assert(noexcept(mut_rpt.update_block(mut_tls, mut_page_pool, {}, func)));
                 static_assert(noexcept(mut_rpt.add_tables(mut_tls, &l3e)));
                 static_assert(noexcept(mut_rpt.add_tables(mut_tls, rpt)));
+                static_assert(noexcept(mut_rpt.remove_stale_tables(mut_tls, rpt)));
 
                 static_assert(noexcept(rpt.is_initialized()));
                 static_assert(noexcept(rpt.is_inactive(mut_tls)));
@@ -0,0 +1,525 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../src/basic_second_level_page_table_t.hpp"
+
+#include <basic_map_page_flags.hpp>
+#include <basic_npt_entry_t.hpp>
+#include <basic_page_1g_t.hpp>
+#include <basic_page_2m_t.hpp>
+#include <basic_page_4k_t.hpp>
+#include <basic_page_pool_node_t.hpp>
+#include <basic_page_pool_t.hpp>
+#include <basic_page_table_t.hpp>
+#include <initialize_page_pool.hpp>
+#include <intrinsic_t.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace lib
+{
+    /// @brief defines the number of pages in the page pool
+    constexpr auto POOL_PAGES{64_umx};
+
+    /// @brief defines the page pool's direct map address
+    constexpr auto POOL_MAP_ADDR{0x0000000000001000_umx};
+    /// @brief defines the page pool's direct map size
+    constexpr auto POOL_MAP_SIZE{0x00007FFFFFFFE000_umx};
+
+    /// @brief defines a 1G aligned guest physical address used by the tests
+    constexpr auto GPA{0x0000000040000000_u64};
+    /// @brief defines the size of a 1g block as a bsl::safe_u64
+    constexpr auto SIZE_1G{bsl::to_u64(BASIC_PAGE_1G_T_SIZE)};
+    /// @brief defines the size of a 2m block as a bsl::safe_u64
+    constexpr auto SIZE_2M{bsl::to_u64(BASIC_PAGE_2M_T_SIZE)};
+    /// @brief defines the size of a 4k page as a bsl::safe_u64
+    constexpr auto SIZE_4K{bsl::to_u64(BASIC_PAGE_4K_T_SIZE)};
+
+    /// @brief defines the page_pool_t used by the test
+    using page_pool_t = basic_page_pool_t<tls_t, bool, POOL_MAP_ADDR.get(), POOL_MAP_SIZE.get()>;
+    /// @brief defines the EPT builder used by the test
+    using ept_t = basic_ept_t<tls_t, bool, page_pool_t, intrinsic_t>;
+    /// @brief defines the NPT builder used by the test
+    using npt_t = basic_npt_t<tls_t, bool, page_pool_t, intrinsic_t>;
+
+    /// @brief stores the pages given to the page pool
+    alignas(HYPERVISOR_PAGE_SIZE.get())
+        constinit bsl::array<basic_page_pool_node_t, POOL_PAGES.get()> g_mut_pool_pages{};
+    /// @brief the page pool used by the tables
+    constinit page_pool_t g_mut_pool{};
+    /// @brief the EPT used by the test
+    constinit ept_t g_mut_ept{};
+    /// @brief the NPT used by the test
+    constinit npt_t g_mut_npt{};
+
+    /// <!-- description -->
+    ///   @brief Walks g_mut_npt starting from its nCR3, the same way the
+    ///     hardware does, and sets the dirty flag of the block that maps
+    ///     the provided guest physical address, which is what the hardware
+    ///     does when a VM writes to it.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param gpa the guest physical address the VM writes to
+    ///
+    inline void
+    set_npt_dirty(bsl::safe_u64 const &gpa) noexcept
+    {
+        constexpr auto mask{0x1FF_u64};
+        constexpr auto l3_shft{39_u64};
+        constexpr auto ps{bsl::safe_u64::magic_1()};
+
+        auto const ncr3{bsl::to_umx(g_mut_npt.root_pointer())};
+        auto const *const l3t{g_mut_pool.phys_to_virt<basic_page_table_t<npt_l3e_t>>(ncr3)};
+        auto const *const l3e{l3t->entries.at_if(bsl::to_idx((gpa >> l3_shft) & mask))};
+
+        auto const l2t_phys{bsl::to_umx(l3e->phys) << BASIC_PAGE_4K_T_SHFT};
+        auto *const pmut_l2t{g_mut_pool.phys_to_virt<basic_page_table_t<npt_l2e_t>>(l2t_phys)};
+        auto *const pmut_l2e{
+            pmut_l2t->entries.at_if(bsl::to_idx((gpa >> BASIC_PAGE_1G_T_SHFT) & mask))};
+        if (ps == pmut_l2e->ps) {
+            pmut_l2e->d = bsl::safe_u64::magic_1().get();
+            return;
+        }
+
+        auto const l1t_phys{bsl::to_umx(pmut_l2e->phys) << BASIC_PAGE_4K_T_SHFT};
+        auto *const pmut_l1t{g_mut_pool.phys_to_virt<basic_page_table_t<npt_l1e_t>>(l1t_phys)};
+        auto *const pmut_l1e{
+            pmut_l1t->entries.at_if(bsl::to_idx((gpa >> BASIC_PAGE_2M_T_SHFT) & mask))};
+        if (ps == pmut_l1e->ps) {
+            pmut_l1e->d = bsl::safe_u64::magic_1().get();
+            return;
+        }
+
+        auto const l0t_phys{bsl::to_umx(pmut_l1e->phys) << BASIC_PAGE_4K_T_SHFT};
+        auto *const pmut_l0t{g_mut_pool.phys_to_virt<basic_page_table_t<npt_l0e_t>>(l0t_phys)};
+        auto *const pmut_l0e{
+            pmut_l0t->entries.at_if(bsl::to_idx((gpa >> BASIC_PAGE_4K_T_SHFT) & mask))};
+        pmut_l0e->d = bsl::safe_u64::magic_1().get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"root_pointer"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                bool mut_sys{true};
+                constexpr auto eptp_flgs{0x1E_u64};
+                constexpr auto mask{0xFFF_u64};
+                initialize_page_pool(g_mut_pool_pages, g_mut_pool);
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(g_mut_ept.initialize(mut_tls, g_mut_pool, true, mut_sys));
+                    bsl::ut_required_step(g_mut_npt.initialize(mut_tls, g_mut_pool, true, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const eptp{g_mut_ept.root_pointer()};
+                        auto const ncr3{g_mut_npt.root_pointer()};
+                        bsl::ut_check(eptp_flgs == (eptp & mask));
+                        bsl::ut_check((eptp & ~mask).is_pos());
+                        bsl::ut_check((ncr3 & mask).is_zero());
+                        bsl::ut_check(ncr3.is_pos());
+                        bsl::ut_check((eptp & ~mask) != ncr3);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_ept.release(mut_tls, g_mut_pool);
+                        g_mut_npt.release(mut_tls, g_mut_pool);
+                        bsl::ut_check(g_mut_pool.allocated(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"root_pointer with accessed and dirty flags"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                bool mut_sys{true};
+                constexpr auto eptp_flgs{0x1E_u64};
+                constexpr auto eptp_ad_flgs{0x5E_u64};
+                constexpr auto mask{0xFFF_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(g_mut_ept.initialize(mut_tls, g_mut_pool, true, mut_sys));
+                    bsl::ut_required_step(g_mut_npt.initialize(mut_tls, g_mut_pool, true, mut_sys));
+                    g_mut_ept.set_accessed_dirty(true);
+                    g_mut_npt.set_accessed_dirty(true);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(eptp_ad_flgs == (g_mut_ept.root_pointer() & mask));
+                        bsl::ut_check((g_mut_npt.root_pointer() & mask).is_zero());
+                        g_mut_ept.set_accessed_dirty(false);
+                        bsl::ut_check(eptp_flgs == (g_mut_ept.root_pointer() & mask));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_ept.release(mut_tls, g_mut_pool);
+                        g_mut_npt.release(mut_tls, g_mut_pool);
+                        bsl::ut_check(g_mut_pool.allocated(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"harvest_dirty and clear_dirty"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                bool mut_sys{true};
+                constexpr auto in_2m{0x0000000040005000_u64};
+                constexpr auto page{0x0000000040201000_u64};
+                bsl::safe_u64 mut_blocks{};
+                bsl::safe_u64 mut_bytes{};
+                auto const count{
+                    [&](bsl::safe_u64 const &gpa, bsl::safe_u64 const &bytes) noexcept {
+                        bsl::discard(gpa);
+                        ++mut_blocks;
+                        mut_bytes += bytes;
+                    }};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(g_mut_npt.initialize(mut_tls, g_mut_pool, true, mut_sys));
+                    bsl::ut_required_step(g_mut_npt.map_identity(
+                        mut_tls, g_mut_pool, GPA, SIZE_2M, BASIC_MAP_PAGE_RW, mut_sys));
+                    bsl::ut_required_step(g_mut_npt.map_identity(
+                        mut_tls, g_mut_pool, page, SIZE_4K, BASIC_MAP_PAGE_RW, mut_sys));
+                    g_mut_npt.flushed(mut_tls, g_mut_pool);
+                    bsl::ut_then{} = [&]() noexcept {
+                        g_mut_npt.harvest_dirty(mut_tls, g_mut_pool, count);
+                        bsl::ut_check(mut_blocks.is_zero());
+                        bsl::ut_check(!g_mut_npt.needs_flush());
+
+                        set_npt_dirty(in_2m);
+                        set_npt_dirty(page);
+                        g_mut_npt.harvest_dirty(mut_tls, g_mut_pool, count);
+                        bsl::ut_check(2_u64 == mut_blocks);
+                        bsl::ut_check((SIZE_2M + SIZE_4K).checked() == mut_bytes);
+                        bsl::ut_check(GPA == g_mut_npt.flush_gpa());
+                        bsl::ut_check((page + SIZE_4K - GPA).checked() == g_mut_npt.flush_bytes());
+
+                        mut_blocks = {};
+                        g_mut_npt.harvest_dirty(mut_tls, g_mut_pool, count);
+                        bsl::ut_check(mut_blocks.is_zero());
+
+                        set_npt_dirty(page);
+                        bsl::ut_check(SIZE_4K == g_mut_npt.clear_dirty(mut_tls, g_mut_pool, page));
+                        bsl::ut_check(SIZE_2M == g_mut_npt.clear_dirty(mut_tls, g_mut_pool, in_2m));
+                        bsl::ut_check(g_mut_npt.clear_dirty(mut_tls, g_mut_pool, {}).is_zero());
+                        g_mut_npt.harvest_dirty(mut_tls, g_mut_pool, count);
+                        bsl::ut_check(mut_blocks.is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_npt.release(mut_tls, g_mut_pool);
+                        bsl::ut_check(g_mut_pool.allocated(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_identity uses 1g blocks"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                bool mut_sys{true};
+                constexpr auto bytes{0x80000000_u64};
+                constexpr auto last{0xBFFFF000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(g_mut_ept.initialize(mut_tls, g_mut_pool, true, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(g_mut_ept.map_identity(
+                            mut_tls, g_mut_pool, GPA, bytes, BASIC_MAP_PAGE_RW, mut_sys));
+                        bsl::ut_check(SIZE_1G == g_mut_ept.page_size(mut_tls, g_mut_pool, GPA));
+                        bsl::ut_check(SIZE_1G == g_mut_ept.page_size(mut_tls, g_mut_pool, last));
+                        bsl::ut_check(g_mut_ept.page_size(mut_tls, g_mut_pool, {}).is_zero());
+                        bsl::ut_check(
+                            BASIC_MAP_PAGE_RW == g_mut_ept.page_flgs(mut_tls, g_mut_pool, last));
+                        bsl::ut_check(g_mut_ept.needs_flush());
+                        bsl::ut_check(GPA == g_mut_ept.flush_gpa());
+                        bsl::ut_check(bytes == g_mut_ept.flush_bytes());
+
+                        g_mut_ept.flushed(mut_tls, g_mut_pool);
+                        bsl::ut_check(!g_mut_ept.needs_flush());
+
+                        bsl::ut_check(g_mut_ept.unmap(mut_tls, g_mut_pool, GPA, bytes, mut_sys));
+                        bsl::ut_check(g_mut_ept.page_size(mut_tls, g_mut_pool, GPA).is_zero());
+                        bsl::ut_check(g_mut_ept.needs_flush());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_ept.release(mut_tls, g_mut_pool);
+                        bsl::ut_check(g_mut_pool.allocated(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map without 1g support uses 2m and 4k blocks"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                bool mut_sys{true};
+                constexpr auto gpa{0x0000000000001000_u64};
+                constexpr auto spa{0x0000000080001000_u64};
+                constexpr auto bytes{0x00000000003FF000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(
+                        g_mut_npt.initialize(mut_tls, g_mut_pool, false, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(g_mut_npt.map_identity(
+                            mut_tls, g_mut_pool, GPA, SIZE_1G, BASIC_MAP_PAGE_RWE, mut_sys));
+                        bsl::ut_check(SIZE_2M == g_mut_npt.page_size(mut_tls, g_mut_pool, GPA));
+                        bsl::ut_check(
+                            BASIC_MAP_PAGE_RWE == g_mut_npt.page_flgs(mut_tls, g_mut_pool, GPA));
+
+                        bsl::ut_check(g_mut_npt.map(
+                            mut_tls, g_mut_pool, gpa, spa, bytes, BASIC_MAP_PAGE_READ, mut_sys));
+                        bsl::ut_check(SIZE_4K == g_mut_npt.page_size(mut_tls, g_mut_pool, gpa));
+                        bsl::ut_check(SIZE_2M == g_mut_npt.page_size(mut_tls, g_mut_pool, SIZE_2M));
+                        bsl::ut_check(
+                            BASIC_MAP_PAGE_READ == g_mut_npt.page_flgs(mut_tls, g_mut_pool, gpa));
+
+                        bsl::ut_check(g_mut_npt.unmap(mut_tls, g_mut_pool, gpa, bytes, mut_sys));
+                        bsl::ut_check(g_mut_npt.unmap(mut_tls, g_mut_pool, GPA, SIZE_1G, mut_sys));
+                        bsl::ut_check(g_mut_npt.page_size(mut_tls, g_mut_pool, gpa).is_zero());
+                        bsl::ut_check(g_mut_npt.page_size(mut_tls, g_mut_pool, GPA).is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_npt.release(mut_tls, g_mut_pool);
+                        bsl::ut_check(g_mut_pool.allocated(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"set_flgs splits and promotes"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                bool mut_sys{true};
+                constexpr auto page{0x0000000040001000_u64};
+                constexpr auto next{0x0000000040002000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(g_mut_ept.initialize(mut_tls, g_mut_pool, true, mut_sys));
+                    bsl::ut_required_step(g_mut_ept.map_identity(
+                        mut_tls, g_mut_pool, GPA, SIZE_2M, BASIC_MAP_PAGE_RW, mut_sys));
+                    g_mut_ept.flushed(mut_tls, g_mut_pool);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SIZE_2M == g_mut_ept.page_size(mut_tls, g_mut_pool, GPA));
+
+                        bsl::ut_check(g_mut_ept.set_flgs(
+                            mut_tls, g_mut_pool, page, SIZE_4K, BASIC_MAP_PAGE_READ, mut_sys));
+                        bsl::ut_check(SIZE_4K == g_mut_ept.page_size(mut_tls, g_mut_pool, GPA));
+                        bsl::ut_check(
+                            BASIC_MAP_PAGE_READ == g_mut_ept.page_flgs(mut_tls, g_mut_pool, page));
+                        bsl::ut_check(
+                            BASIC_MAP_PAGE_RW == g_mut_ept.page_flgs(mut_tls, g_mut_pool, GPA));
+                        bsl::ut_check(page == g_mut_ept.flush_gpa());
+                        bsl::ut_check(SIZE_4K == g_mut_ept.flush_bytes());
+
+                        bsl::ut_check(g_mut_ept.set_flgs(
+                            mut_tls, g_mut_pool, page, SIZE_4K, BASIC_MAP_PAGE_RW, mut_sys));
+                        bsl::ut_check(SIZE_2M == g_mut_ept.page_size(mut_tls, g_mut_pool, GPA));
+
+                        bsl::ut_check(
+                            g_mut_ept.set_flgs(mut_tls, g_mut_pool, next, SIZE_4K, {}, mut_sys));
+                        bsl::ut_check(SIZE_4K == g_mut_ept.page_size(mut_tls, g_mut_pool, next));
+                        bsl::ut_check(g_mut_ept.page_flgs(mut_tls, g_mut_pool, next).is_zero());
+
+                        bsl::ut_check(g_mut_ept.unmap(mut_tls, g_mut_pool, GPA, SIZE_2M, mut_sys));
+                        bsl::ut_check(g_mut_ept.page_size(mut_tls, g_mut_pool, next).is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_ept.release(mut_tls, g_mut_pool);
+                        bsl::ut_check(g_mut_pool.allocated(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"promoted tables are held until flushed"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                bool mut_sys{true};
+                constexpr auto page{0x0000000040001000_u64};
+                bsl::safe_umx mut_mapped{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(g_mut_ept.initialize(mut_tls, g_mut_pool, true, mut_sys));
+                    bsl::ut_required_step(g_mut_ept.map_identity(
+                        mut_tls, g_mut_pool, GPA, SIZE_2M, BASIC_MAP_PAGE_RW, mut_sys));
+                    g_mut_ept.flushed(mut_tls, g_mut_pool);
+                    mut_mapped = g_mut_pool.allocated(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(g_mut_ept.set_flgs(
+                            mut_tls, g_mut_pool, page, SIZE_4K, BASIC_MAP_PAGE_READ, mut_sys));
+                        bsl::ut_check(SIZE_4K == g_mut_ept.page_size(mut_tls, g_mut_pool, GPA));
+                        bsl::ut_check(mut_mapped < g_mut_pool.allocated(mut_tls));
+                        g_mut_ept.flushed(mut_tls, g_mut_pool);
+
+                        auto const split{g_mut_pool.allocated(mut_tls)};
+                        bsl::ut_check(g_mut_ept.set_flgs(
+                            mut_tls, g_mut_pool, page, SIZE_4K, BASIC_MAP_PAGE_RW, mut_sys));
+                        bsl::ut_check(SIZE_2M == g_mut_ept.page_size(mut_tls, g_mut_pool, GPA));
+                        bsl::ut_check(split == g_mut_pool.allocated(mut_tls));
+                        bsl::ut_check(g_mut_ept.needs_flush());
+
+                        g_mut_ept.flushed(mut_tls, g_mut_pool);
+                        bsl::ut_check(mut_mapped == g_mut_pool.allocated(mut_tls));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_ept.release(mut_tls, g_mut_pool);
+                        bsl::ut_check(g_mut_pool.allocated(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"split and promote keep the dirty flag"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                bool mut_sys{true};
+                constexpr auto page{0x0000000040001000_u64};
+                constexpr auto other{0x0000000040005000_u64};
+                bsl::safe_u64 mut_blocks{};
+                bsl::safe_u64 mut_bytes{};
+                auto const count{
+                    [&](bsl::safe_u64 const &gpa, bsl::safe_u64 const &bytes) noexcept {
+                        bsl::discard(gpa);
+                        ++mut_blocks;
+                        mut_bytes += bytes;
+                    }};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(g_mut_npt.initialize(mut_tls, g_mut_pool, true, mut_sys));
+                    bsl::ut_required_step(g_mut_npt.map_identity(
+                        mut_tls, g_mut_pool, GPA, SIZE_2M, BASIC_MAP_PAGE_RW, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        set_npt_dirty(GPA);
+                        bsl::ut_check(g_mut_npt.set_flgs(
+                            mut_tls, g_mut_pool, page, SIZE_4K, BASIC_MAP_PAGE_READ, mut_sys));
+                        bsl::ut_check(SIZE_4K == g_mut_npt.page_size(mut_tls, g_mut_pool, GPA));
+                        g_mut_npt.harvest_dirty(mut_tls, g_mut_pool, count);
+                        bsl::ut_check((SIZE_2M / SIZE_4K).checked() == mut_blocks);
+                        bsl::ut_check(SIZE_2M == mut_bytes);
+
+                        mut_blocks = {};
+                        mut_bytes = {};
+                        set_npt_dirty(other);
+                        bsl::ut_check(g_mut_npt.set_flgs(
+                            mut_tls, g_mut_pool, page, SIZE_4K, BASIC_MAP_PAGE_RW, mut_sys));
+                        bsl::ut_check(SIZE_2M == g_mut_npt.page_size(mut_tls, g_mut_pool, GPA));
+                        g_mut_npt.harvest_dirty(mut_tls, g_mut_pool, count);
+                        bsl::ut_check(1_u64 == mut_blocks);
+                        bsl::ut_check(SIZE_2M == mut_bytes);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_npt.release(mut_tls, g_mut_pool);
+                        bsl::ut_check(g_mut_pool.allocated(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"execute only ept maps are readable"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                bool mut_sys{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(g_mut_ept.initialize(mut_tls, g_mut_pool, true, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(g_mut_ept.map_identity(
+                            mut_tls, g_mut_pool, GPA, SIZE_4K, BASIC_MAP_PAGE_EXECUTE, mut_sys));
+                        bsl::ut_check(
+                            BASIC_MAP_PAGE_RE == g_mut_ept.page_flgs(mut_tls, g_mut_pool, GPA));
+                        bsl::ut_check(g_mut_ept.unmap(mut_tls, g_mut_pool, GPA, SIZE_4K, mut_sys));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_ept.release(mut_tls, g_mut_pool);
+                        bsl::ut_check(g_mut_pool.allocated(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"set_flgs and unmap of memory that is not mapped"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                bool mut_sys{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(g_mut_npt.initialize(mut_tls, g_mut_pool, true, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!g_mut_npt.set_flgs(
+                            mut_tls, g_mut_pool, GPA, SIZE_4K, BASIC_MAP_PAGE_READ, mut_sys));
+                        bsl::ut_check(!g_mut_npt.unmap(mut_tls, g_mut_pool, GPA, SIZE_2M, mut_sys));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_npt.release(mut_tls, g_mut_pool);
+                        bsl::ut_check(g_mut_pool.allocated(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map is rolled back when the pool runs out"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                bool mut_sys{true};
+                constexpr auto bytes{0x0000001000000000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(
+                        g_mut_ept.initialize(mut_tls, g_mut_pool, false, mut_sys));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!g_mut_ept.map_identity(
+                            mut_tls, g_mut_pool, {}, bytes, BASIC_MAP_PAGE_RW, mut_sys));
+                        bsl::ut_check(g_mut_ept.page_size(mut_tls, g_mut_pool, {}).is_zero());
+                        bsl::ut_check(g_mut_ept.page_size(mut_tls, g_mut_pool, GPA).is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_ept.release(mut_tls, g_mut_pool);
+                        bsl::ut_check(g_mut_pool.allocated(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(lib::tests() == bsl::ut_success());
+    return lib::tests();
+}
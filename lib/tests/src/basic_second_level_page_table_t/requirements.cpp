@@ -0,0 +1,115 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../src/basic_second_level_page_table_t.hpp"
+
+#include <basic_page_pool_t.hpp>
+#include <intrinsic_t.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/discard.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the page pool's direct map address
+    constexpr auto POOL_MAP_ADDR{0x0000000000001000_umx};
+    /// @brief defines the page pool's direct map size
+    constexpr auto POOL_MAP_SIZE{0x00007FFFFFFFE000_umx};
+
+    /// @brief defines the page_pool_t used by the test
+    using page_pool_t =
+        lib::basic_page_pool_t<lib::tls_t, bool, POOL_MAP_ADDR.get(), POOL_MAP_SIZE.get()>;
+
+    /// @brief defines the EPT builder used by the test
+    using ept_t = lib::basic_ept_t<lib::tls_t, bool, page_pool_t, lib::intrinsic_t>;
+    /// @brief defines the NPT builder used by the test
+    using npt_t = lib::basic_npt_t<lib::tls_t, bool, page_pool_t, lib::intrinsic_t>;
+
+    /// @brief verify constinit it supported
+    constinit ept_t const g_verify_constinit_ept{};
+    /// @brief verify constinit it supported
+    constinit npt_t const g_verify_constinit_npt{};
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"verify supports constinit/constexpr"} = []() noexcept {
+        bsl::discard(g_verify_constinit_ept);
+        bsl::discard(g_verify_constinit_npt);
+    };
+
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            ept_t mut_ept{};
+            npt_t const npt{};
+            lib::tls_t mut_tls{};
+            page_pool_t mut_page_pool{};
+            bool mut_sys{};
+            auto const count{[](bsl::safe_u64 const &, bsl::safe_u64 const &) noexcept {}};
+            bsl::ut_then{} = []() noexcept {
+                static_assert(noexcept(ept_t{}));
+                static_assert(noexcept(npt_t{}));
+
+                static_assert(noexcept(mut_ept.initialize(mut_tls, mut_page_pool, {}, mut_sys)));
+                static_assert(noexcept(mut_ept.release(mut_tls, mut_page_pool)));
+                static_assert(noexcept(mut_ept.is_initialized()));
+                static_assert(noexcept(mut_ept.root_pointer()));
+                static_assert(noexcept(mut_ept.set_accessed_dirty({})));
+                static_assert(
+                    noexcept(mut_ept.map(mut_tls, mut_page_pool, {}, {}, {}, {}, mut_sys)));
+                static_assert(
+                    noexcept(mut_ept.map_identity(mut_tls, mut_page_pool, {}, {}, {}, mut_sys)));
+                static_assert(
+                    noexcept(mut_ept.set_flgs(mut_tls, mut_page_pool, {}, {}, {}, mut_sys)));
+                static_assert(noexcept(mut_ept.unmap(mut_tls, mut_page_pool, {}, {}, mut_sys)));
+                static_assert(noexcept(mut_ept.page_size(mut_tls, mut_page_pool, {})));
+                static_assert(noexcept(mut_ept.page_flgs(mut_tls, mut_page_pool, {})));
+                static_assert(noexcept(mut_ept.clear_dirty(mut_tls, mut_page_pool, {})));
+                static_assert(noexcept(mut_ept.harvest_dirty(mut_tls, mut_page_pool, count)));
+                static_assert(noexcept(mut_ept.needs_flush()));
+                static_assert(noexcept(mut_ept.flush_gpa()));
+                static_assert(noexcept(mut_ept.flush_bytes()));
+                static_assert(noexcept(mut_ept.flushed(mut_tls, mut_page_pool)));
+
+                static_assert(noexcept(npt.is_initialized()));
+                static_assert(noexcept(npt.root_pointer()));
+                static_assert(noexcept(npt.needs_flush()));
+                static_assert(noexcept(npt.flush_gpa()));
+                static_assert(noexcept(npt.flush_bytes()));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
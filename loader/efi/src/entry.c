@@ -251,6 +251,8 @@ load_images_and_start(void)
 
     start_args.ver = ((uint64_t)1);
     start_args.num_pages_in_page_pool = ((uint32_t)0);
+    start_args.num_pages_in_huge_pool = ((uint32_t)0);
+    start_args.num_pages_in_page_pool_reserve = ((uint32_t)0);
 
     if (start_vmm(&start_args)) {
         bferror("start_vmm failed");
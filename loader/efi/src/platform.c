@@ -137,6 +137,29 @@ platform_alloc_contiguous(uint64_t const size)
     return platform_alloc(size);
 }
 
+/**
+ * <!-- description -->
+ *   @brief This function allocates read/write virtual memory from the
+ *     kernel, preferring physical pages that belong to the provided
+ *     NUMA node. This memory is not physically contiguous. If the
+ *     platform does not support NUMA, this is the same as calling
+ *     platform_alloc(). Use platform_free() to release this memory.
+ *
+ *   @note This function must zero the allocated memory
+ *
+ * <!-- inputs/outputs -->
+ *   @param size the number of bytes to allocate
+ *   @param node the NUMA node to allocate the memory from
+ *   @return Returns a pointer to the newly allocated memory on success.
+ *     Returns a nullptr on failure.
+ */
+NODISCARD void *
+platform_alloc_node(uint64_t const size, uint32_t const node)
+{
+    (void)node;
+    return platform_alloc(size);
+}
+
 /**
  * <!-- description -->
  *   @brief This function frees memory previously allocated using the
@@ -299,6 +322,45 @@ platform_num_online_cpus(void) NOEXCEPT
     return arch_num_online_cpus();
 }
 
+/**
+ * <!-- description -->
+ *   @brief Returns 1 if the provided NUMA node is online, and 0
+ *     otherwise. NUMA node IDs do not have to be contiguous, so
+ *     callers should check each ID instead of assuming that nodes
+ *     0 through N - 1 are online. Platforms that do not support NUMA
+ *     only report node 0 as online.
+ *
+ * <!-- inputs/outputs -->
+ *   @param node the NUMA node to query
+ *   @return Returns 1 if the provided NUMA node is online, and 0
+ *     otherwise
+ */
+NODISCARD uint32_t
+platform_numa_node_online(uint32_t const node) NOEXCEPT
+{
+    if (0U == node) {
+        return 1U;
+    }
+
+    return 0U;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Returns the NUMA node that the provided CPU (i.e. PP)
+ *     belongs to. Platforms that do not support NUMA always return 0.
+ *
+ * <!-- inputs/outputs -->
+ *   @param cpu the CPU (i.e. PP) to query
+ *   @return Returns the NUMA node that the provided CPU belongs to
+ */
+NODISCARD uint32_t
+platform_numa_node_of_cpu(uint32_t const cpu) NOEXCEPT
+{
+    (void)cpu;
+    return 0U;
+}
+
 /**
  * <!-- description -->
  *   @brief Executes a callback on a specific PP.
@@ -0,0 +1,59 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ALLOC_EXT_ELF_FILES_PHYS_H
+#define ALLOC_EXT_ELF_FILES_PHYS_H
+
+#include <elf_file_t.h>
+#include <mutable_span_t.h>
+#include <types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * <!-- description -->
+     *   @brief Allocates a table for each provided extension ELF file that
+     *     stores the physical address of each page of the ELF file. The
+     *     microkernel uses these tables to map the read-only segments of
+     *     an extension directly from the ELF file instead of copying them.
+     *
+     * <!-- inputs/outputs -->
+     *   @param ext_elf_files the ELF files to create the tables for
+     *   @param pmut_ext_elf_files_phys where to store the resulting tables
+     *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+     */
+    NODISCARD int64_t alloc_ext_elf_files_phys(
+        struct elf_file_t const *const ext_elf_files,
+        struct mutable_span_t *const pmut_ext_elf_files_phys) NOEXCEPT;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -44,11 +44,14 @@ extern "C"
      *
      * <!-- inputs/outputs -->
      *   @param size the total number of pages (not bytes) to allocate
+     *   @param node the NUMA node to allocate the pages from
      *   @param pmut_page_pool the mutable_span_t to store the page pool addr/size.
      *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
      */
-    NODISCARD int64_t
-    alloc_mk_page_pool(uint32_t const size, struct mutable_span_t *const pmut_page_pool) NOEXCEPT;
+    NODISCARD int64_t alloc_mk_page_pool(
+        uint32_t const size,
+        uint32_t const node,
+        struct mutable_span_t *const pmut_page_pool) NOEXCEPT;
 
 #ifdef __cplusplus
 }
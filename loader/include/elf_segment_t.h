@@ -52,6 +52,8 @@ extern "C"
         uint64_t virt;
         /** @brief stores the segment's flags (e.g., access rights) */
         uint32_t flags;
+        /** @brief stores 1 if addr points into the ELF file (i.e., not owned) */
+        uint32_t shared;
     };
 
 #pragma pack(pop)
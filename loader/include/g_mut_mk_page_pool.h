@@ -27,6 +27,7 @@
 #ifndef G_MK_PAGE_POOL_H
 #define G_MK_PAGE_POOL_H
 
+#include <constants.h>
 #include <mutable_span_t.h>
 
 #ifdef __cplusplus
@@ -34,8 +35,8 @@ extern "C"
 {
 #endif
 
-    /** @brief stores the page pool used by the microkernel */
-    extern struct mutable_span_t g_mut_mk_page_pool;
+    /** @brief stores the page pool used by the microkernel (one slice per NUMA node) */
+    extern struct mutable_span_t g_mut_mk_page_pool[HYPERVISOR_MAX_NUMA_NODES];
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,62 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DUMP_TRACE_ARGS_T_HPP
+#define DUMP_TRACE_ARGS_T_HPP
+
+#include <trace_ring_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+
+#pragma pack(push, 1)
+
+namespace loader
+{
+    /// @brief defines the IOCTL index for dumping a PP's trace ring
+    constexpr auto DUMP_TRACE_CMD{0xBF06_u32};
+
+    /// <!-- description -->
+    ///   @brief Defines the information that a userspace application needs to
+    ///     provide to dump the trace ring of a PP.
+    ///
+    struct dump_trace_args_t final
+    {
+        /// @brief set to loader::version
+        bsl::uint64 ver;
+        /// @brief the PP whose trace ring should be dumped
+        bsl::uint16 ppid;
+        /// @brief returns the number of online PPs
+        bsl::uint16 online_pps;
+        /// @brief reserved
+        bsl::uint32 reserved;
+
+        /// @brief stores the contents of the trace ring upon request
+        trace_ring_t trace_ring;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
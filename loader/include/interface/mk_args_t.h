@@ -31,7 +31,9 @@
 #include <constants.h>
 #include <debug_ring_t.h>
 #include <mutable_span_t.h>
+#include <span_t.h>
 #include <state_save_t.h>
+#include <trace_ring_t.h>
 #include <types.h>
 
 #ifdef __cplusplus
@@ -54,8 +56,10 @@ extern "C"
         uint16_t ppid;
         /** @brief stores the number of online pps (0x002) */
         uint16_t online_pps;
-        /** @brief reserved (0x004) */
-        uint32_t reserved;
+        /** @brief stores the NUMA node of the current ppid (0x004) */
+        uint16_t node;
+        /** @brief reserved (0x006) */
+        uint16_t reserved;
         /** @brief stores the location of the microkernel's state (0x008) */
         struct state_save_t *mk_state;
         /** @brief stores the location of the root vp state (0x010) */
@@ -70,10 +74,16 @@ extern "C"
         void *rpt;
         /** @brief stores the physical address of the MK's RPT for this CPU */
         uint64_t rpt_phys;
-        /** @brief stores the location of the microkernel's page pool */
-        struct mutable_span_t page_pool;
+        /** @brief stores the microkernel's page pool, one slice per NUMA node */
+        struct mutable_span_t page_pool[HYPERVISOR_MAX_NUMA_NODES];
         /** @brief stores the location of the microkernel's huge pool */
         struct mutable_span_t huge_pool;
+        /** @brief stores the pages the microkernel may grow its page pool with */
+        struct mutable_span_t page_pool_reserve;
+        /** @brief stores the physical address of each page of each extension's ELF file */
+        struct span_t ext_elf_files_phys[HYPERVISOR_MAX_EXTENSIONS];
+        /** @brief stores the location of this PP's trace ring (or NULL) */
+        struct trace_ring_t *trace_ring;
     };
 
 #pragma pack(pop)
@@ -32,6 +32,7 @@
 #include <debug_ring_t.hpp>
 #include <l3e_t.hpp>
 #include <state_save_t.hpp>
+#include <trace_ring_t.hpp>
 
 #include <bsl/array.hpp>
 #include <bsl/convert.hpp>    // IWYU pragma: keep
@@ -46,6 +47,12 @@ namespace loader
     using ext_elf_file_t = bfelf::elf64_ehdr_t;
     /// @brief defines the ext_elf_files type
     using ext_elf_files_t = bsl::array<ext_elf_file_t const *, HYPERVISOR_MAX_EXTENSIONS.get()>;
+    /// @brief defines the ext_elf_files_phys type (one physical address per page)
+    using ext_elf_files_phys_t =
+        bsl::array<bsl::span<bsl::uint64 const>, HYPERVISOR_MAX_EXTENSIONS.get()>;
+    /// @brief defines the page_pool type (one slice per NUMA node)
+    using page_pools_t =
+        bsl::array<bsl::span<lib::basic_page_pool_node_t>, HYPERVISOR_MAX_NUMA_NODES.get()>;
 
     /// <!-- description -->
     ///   @brief Defines the arguments sent to the _start function of the
@@ -59,8 +66,10 @@ namespace loader
         bsl::uint16 ppid;
         /// @brief stores the number of online pps (0x002)
         bsl::uint16 online_pps;
-        /// @brief reserved (0x004)
-        bsl::uint32 reserved0;
+        /// @brief stores the NUMA node of the current ppid (0x004)
+        bsl::uint16 node;
+        /// @brief reserved (0x006)
+        bsl::uint16 reserved0;
         /// @brief stores the location of the microkernel's state (0x008)
         state_save_t *mk_state;
         /// @brief stores the location of the root vp state (0x010)
@@ -75,10 +84,16 @@ namespace loader
         lib::basic_page_table_t<lib::l3e_t> *rpt;
         /// @brief stores the physical address of the MK's RPT for this CPU
         bsl::uint64 rpt_phys;
-        /// @brief stores the location of the microkernel's page pool
-        bsl::span<lib::basic_page_pool_node_t> page_pool;
+        /// @brief stores the microkernel's page pool, one slice per NUMA node
+        page_pools_t page_pool;
         /// @brief stores the location of the microkernel's huge pool
         bsl::span<lib::basic_page_4k_t> huge_pool;
+        /// @brief stores the pages the microkernel may grow its page pool with
+        bsl::span<lib::basic_page_pool_node_t> page_pool_reserve;
+        /// @brief stores the physical address of each page of each extension's ELF file
+        ext_elf_files_phys_t ext_elf_files_phys;
+        /// @brief stores the location of this PP's trace ring (or nullptr)
+        trace_ring_t *trace_ring;
     };
 }
 
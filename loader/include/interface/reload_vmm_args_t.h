@@ -0,0 +1,66 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef RELOAD_VMM_ARGS_T_H
+#define RELOAD_VMM_ARGS_T_H
+
+#include <constants.h>
+#include <span_t.h>
+#include <types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#pragma pack(push, 1)
+
+/** @brief defines the IOCTL index for reloading the VMM's extensions */
+#define LOADER_RELOAD_VMM_CMD ((uint32_t)0xBF05)
+
+    /**
+     * <!-- description -->
+     *   @brief Defines the information that a userspace application needs to
+     *     provide to reload the VMM's extensions. The microkernel and the
+     *     page/huge pools that were provided when the VMM was started are
+     *     kept resident, only the extensions are replaced.
+     */
+    struct reload_vmm_args_t
+    {
+        /** @brief set to HYPERVISOR_VERSION */
+        uint64_t ver;
+
+        /** @brief stores the ELF files associated with the extensions */
+        struct span_t ext_elf_files[HYPERVISOR_MAX_EXTENSIONS];
+    };
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
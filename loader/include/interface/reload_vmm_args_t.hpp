@@ -0,0 +1,58 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef RELOAD_VMM_ARGS_T_HPP
+#define RELOAD_VMM_ARGS_T_HPP
+
+#include <start_vmm_args_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace loader
+{
+    /// @brief defines the IOCTL index for reloading the VMM's extensions
+    constexpr auto RELOAD_VMM_CMD{0xBF05_u32};
+
+    /// <!-- description -->
+    ///   @brief Defines the information that a userspace application needs to
+    ///     provide to reload the VMM's extensions. The microkernel and the
+    ///     page/huge pools that were provided when the VMM was started are
+    ///     kept resident, only the extensions are replaced.
+    ///
+    struct reload_vmm_args_t final
+    {
+        /// @brief set to HYPERVISOR_VERSION
+        bsl::uint64 ver;
+
+        /// @brief stores the ELF files associated with the extensions
+        ext_elf_files_type ext_elf_files;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
@@ -40,6 +40,9 @@ extern "C"
 
 /** @brief defines the IOCTL index for starting the VMM */
 #define LOADER_START_VMM_CMD ((uint32_t)0xBF01)
+/** @brief defines the version of the start_vmm_args_t ABI. Version 2
+    added num_pages_in_huge_pool and num_pages_in_page_pool_reserve. */
+#define LOADER_START_VMM_ARGS_VER ((uint64_t)2)
 
     /**
      * <!-- description -->
@@ -48,7 +51,7 @@ extern "C"
      */
     struct start_vmm_args_t
     {
-        /** @brief set to HYPERVISOR_VERSION */
+        /** @brief set to LOADER_START_VMM_ARGS_VER */
         uint64_t ver;
 
         /** @brief stores the number of pages the kernel should reserve for
@@ -56,7 +59,18 @@ extern "C"
      *    will reserve the default number of pages. */
         uint32_t num_pages_in_page_pool;
 
-        /** @brief reserved */
+        /** @brief stores the number of pages the kernel should reserve for
+     *    the microkernel's huge pool. If this is set to 0, the loader
+     *    will reserve the default number of pages. */
+        uint32_t num_pages_in_huge_pool;
+
+        /** @brief stores the number of pages the kernel should set aside
+     *    for the microkernel to grow its page pool with once the page
+     *    pool runs out of pages. If this is set to 0, no pages are set
+     *    aside. */
+        uint32_t num_pages_in_page_pool_reserve;
+
+        /** @brief reserved (keeps mk_elf_file 8 byte aligned) */
         uint32_t reserved;
 
         /** @brief stores the ELF file associated with the microkernel */
@@ -36,6 +36,9 @@ namespace loader
 {
     /// @brief defines the IOCTL index for starting the VMM
     constexpr auto START_VMM_CMD{0xBF01_u32};
+    /// @brief defines the version of the start_vmm_args_t ABI. Version 2
+    ///   added num_pages_in_huge_pool and num_pages_in_page_pool_reserve.
+    constexpr auto START_VMM_ARGS_VER{2_u64};
 
     /// @brief defines the type used for passing the ext ELF files
     using elf_file_type = bsl::span<bsl::uint8 const>;
@@ -49,7 +52,7 @@ namespace loader
     ///
     struct start_vmm_args_t final
     {
-        /// @brief set to HYPERVISOR_VERSION
+        /// @brief set to START_VMM_ARGS_VER
         bsl::uint64 ver;
 
         /// @brief stores the number of pages the kernel should reserve for
@@ -57,7 +60,18 @@ namespace loader
         ///   will reserve the default number of pages.
         bsl::uint32 num_pages_in_page_pool;
 
-        /// @brief reserved.
+        /// @brief stores the number of pages the kernel should reserve for
+        ///   the microkernel's huge pool. If this is set to 0, the loader
+        ///   will reserve the default number of pages.
+        bsl::uint32 num_pages_in_huge_pool;
+
+        /// @brief stores the number of pages the kernel should set aside
+        ///   for the microkernel to grow its page pool with once the page
+        ///   pool runs out of pages. If this is set to 0, no pages are set
+        ///   aside.
+        bsl::uint32 num_pages_in_page_pool_reserve;
+
+        /// @brief reserved (keeps mk_elf_file 8 byte aligned).
         bsl::uint32 reserved;
 
         /// @brief stores the ELF file associated with the microkernel
@@ -0,0 +1,81 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TRACE_RECORD_T_H
+#define TRACE_RECORD_T_H
+
+#include <types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#pragma pack(push, 1)
+
+/** @brief probe id: the VS returned to the microkernel with a VMExit */
+#define TRACE_PROBE_VMEXIT ((uint16_t)0x0000)
+/** @brief probe id: the microkernel is about to call into an extension */
+#define TRACE_PROBE_CALL_EXT ((uint16_t)0x0001)
+/** @brief probe id: an extension made a syscall */
+#define TRACE_PROBE_SYSCALL ((uint16_t)0x0002)
+/** @brief probe id: the microkernel is returning from a syscall */
+#define TRACE_PROBE_SYSCALL_RET ((uint16_t)0x0003)
+/** @brief probe id: the microkernel is about to run a VS */
+#define TRACE_PROBE_VS_RUN ((uint16_t)0x0004)
+/** @brief probe id: the microkernel is about to allocate from a pool */
+#define TRACE_PROBE_PAGE_ALLOC ((uint16_t)0x0005)
+/** @brief probe id: the microkernel finished allocating from a pool */
+#define TRACE_PROBE_PAGE_ALLOC_RET ((uint16_t)0x0006)
+/** @brief defines the total number of probe ids */
+#define TRACE_PROBE_MAX ((uint16_t)0x0007)
+
+    /**
+     * <!-- description -->
+     *   @brief Defines a single record in a trace ring. Each record marks
+     *     the point in time that a PP hit a probe. The time spent in the
+     *     phase a probe starts is the difference between its TSC and the
+     *     TSC of the next record on the same PP.
+     */
+    struct trace_record_t
+    {
+        /** @brief stores the TSC when the probe was hit */
+        uint64_t tsc;
+        /** @brief stores the id of the probe (see TRACE_PROBE_xxx) */
+        uint16_t probe;
+        /** @brief stores the id of the PP that hit the probe */
+        uint16_t ppid;
+        /** @brief reserved */
+        uint32_t reserved;
+    };
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,74 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef TRACE_RECORD_T_HPP
+#define TRACE_RECORD_T_HPP
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace loader
+{
+    /// @brief probe id: the VS returned to the microkernel with a VMExit
+    constexpr auto TRACE_PROBE_VMEXIT{0x0000_u16};
+    /// @brief probe id: the microkernel is about to call into an extension
+    constexpr auto TRACE_PROBE_CALL_EXT{0x0001_u16};
+    /// @brief probe id: an extension made a syscall
+    constexpr auto TRACE_PROBE_SYSCALL{0x0002_u16};
+    /// @brief probe id: the microkernel is returning from a syscall
+    constexpr auto TRACE_PROBE_SYSCALL_RET{0x0003_u16};
+    /// @brief probe id: the microkernel is about to run a VS
+    constexpr auto TRACE_PROBE_VS_RUN{0x0004_u16};
+    /// @brief probe id: the microkernel is about to allocate from a pool
+    constexpr auto TRACE_PROBE_PAGE_ALLOC{0x0005_u16};
+    /// @brief probe id: the microkernel finished allocating from a pool
+    constexpr auto TRACE_PROBE_PAGE_ALLOC_RET{0x0006_u16};
+    /// @brief defines the total number of probe ids
+    constexpr auto TRACE_PROBE_MAX{0x0007_u16};
+
+    /// <!-- description -->
+    ///   @brief Defines a single record in a trace ring. Each record marks
+    ///     the point in time that a PP hit a probe. The time spent in the
+    ///     phase a probe starts is the difference between its TSC and the
+    ///     TSC of the next record on the same PP.
+    ///
+    struct trace_record_t final
+    {
+        /// @brief stores the TSC when the probe was hit
+        bsl::uint64 tsc;
+        /// @brief stores the id of the probe (see TRACE_PROBE_xxx)
+        bsl::uint16 probe;
+        /// @brief stores the id of the PP that hit the probe
+        bsl::uint16 ppid;
+        /// @brief reserved
+        bsl::uint32 reserved;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
@@ -0,0 +1,63 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TRACE_RING_T_H
+#define TRACE_RING_T_H
+
+#include <trace_record_t.h>
+#include <types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#pragma pack(push, 1)
+
+    /**
+     * <!-- description -->
+     *   @brief Defines the structure of a PP's trace ring. The microkernel
+     *     only ever writes to this ring from the PP that owns it, so no
+     *     locking is needed. epos is never wrapped, which means the oldest
+     *     valid record is at epos - HYPERVISOR_TRACE_RING_SIZE once the
+     *     ring is full.
+     */
+    struct trace_ring_t
+    {
+        /** @brief stores the total number of records written to the ring */
+        uint64_t epos;
+
+        /** @brief stores the records in the trace ring */
+        struct trace_record_t buf[HYPERVISOR_TRACE_RING_SIZE];
+    };
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
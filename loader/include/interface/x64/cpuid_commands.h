@@ -43,6 +43,10 @@ extern "C"
 #define CPUID_COMMAND_ECX_REPORT_ON ((uint32_t)0xBF000001U)
 /** @brief defines the value of ECX for the CPUID report off command */
 #define CPUID_COMMAND_ECX_REPORT_OFF ((uint32_t)0xBF000002U)
+/** @brief defines the value of ECX for the CPUID dump syscall stats command */
+#define CPUID_COMMAND_ECX_DUMP_SYSCALL_STATS ((uint32_t)0xBF000003U)
+/** @brief defines the value of ECX for the CPUID set log mask command (EBX = mask) */
+#define CPUID_COMMAND_ECX_SET_LOG_MASK ((uint32_t)0xBF000004U)
 
 /** @brief defines the value of RAX on success */
 #define CPUID_COMMAND_RAX_SUCCESS ((uint64_t)0x0U)
@@ -37,6 +37,10 @@ namespace loader
     constexpr auto CPUID_COMMAND_ECX_REPORT_ON{0xBF000001_u32};
     /// @brief defines the value of ECX for the CPUID report off command
     constexpr auto CPUID_COMMAND_ECX_REPORT_OFF{0xBF000002_u32};
+    /// @brief defines the value of ECX for the CPUID dump syscall stats command
+    constexpr auto CPUID_COMMAND_ECX_DUMP_SYSCALL_STATS{0xBF000003_u32};
+    /// @brief defines the value of ECX for the CPUID set log mask command (EBX = mask)
+    constexpr auto CPUID_COMMAND_ECX_SET_LOG_MASK{0xBF000004_u32};
 
     /// @brief defines the value of RAX on success
     constexpr auto CPUID_COMMAND_RAX_SUCCESS{0x0_u64};
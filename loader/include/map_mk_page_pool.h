@@ -51,7 +51,9 @@ extern "C"
      *     address of the next page in the page pool (using the direct map
      *     address). This way, all we need to do is pass virt to the
      *     microkernel, and it will have the HEAD of a linked list of pages
-     *     that can be used as a page pool.
+     *     that can be used as a page pool. The last page's next pointer is
+     *     always cleared as the page pool might be reused (i.e., on a reload),
+     *     in which case its contents are no longer zero.
      *
      * <!-- inputs/outputs -->
      *   @param page_pool a pointer to a mutable_span_t that stores the page pool
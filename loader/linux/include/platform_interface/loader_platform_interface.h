@@ -29,8 +29,11 @@
 #ifndef LOADER_PLATFORM_INTERFACE_H
 #define LOADER_PLATFORM_INTERFACE_H
 
+#include <dump_trace_args_t.h>
 #include <dump_vmm_args_t.h>
 #include <linux/ioctl.h>
+#include <reload_vmm_args_t.h>
+#include <set_log_mask_args_t.h>
 #include <start_vmm_args_t.h>
 #include <stop_vmm_args_t.h>
 
@@ -47,5 +50,11 @@
 #define LOADER_STOP_VMM _IOW(0U, LOADER_STOP_VMM_CMD, struct stop_vmm_args_t *)
 /** @brief defines IOCTL for dumping a VMs debug ring */
 #define LOADER_DUMP_VMM _IOWR(0U, LOADER_DUMP_VMM_CMD, struct dump_vmm_args_t *)
+/** @brief defines IOCTL for setting a VMs runtime log mask */
+#define LOADER_SET_LOG_MASK _IOW(0U, LOADER_SET_LOG_MASK_CMD, struct set_log_mask_args_t *)
+/** @brief defines IOCTL for reloading a VMs extensions */
+#define LOADER_RELOAD_VMM _IOW(0U, LOADER_RELOAD_VMM_CMD, struct reload_vmm_args_t *)
+/** @brief defines IOCTL for dumping a PP's trace ring */
+#define LOADER_DUMP_TRACE _IOWR(0U, LOADER_DUMP_TRACE_CMD, struct dump_trace_args_t *)
 
 #endif
@@ -30,7 +30,10 @@
 #define LOADER_PLATFORM_INTERFACE_HPP
 
 #include <asm/ioctl.h>
+#include <dump_trace_args_t.hpp>
 #include <dump_vmm_args_t.hpp>
+#include <reload_vmm_args_t.hpp>
+#include <set_log_mask_args_t.hpp>
 #include <start_vmm_args_t.hpp>
 #include <stop_vmm_args_t.hpp>
 
@@ -53,6 +56,15 @@ namespace loader
     /// @brief defines IOCTL for dumping a VMs debug ring
     constexpr bsl::safe_umx DUMP_VMM{static_cast<bsl::uintmx>(
         _IOWR(0U, DUMP_VMM_CMD.get(), dump_vmm_args_t *))};
+    /// @brief defines IOCTL for setting a VMs runtime log mask
+    constexpr bsl::safe_umx SET_LOG_MASK{static_cast<bsl::uintmx>(
+        _IOW(0U, SET_LOG_MASK_CMD.get(), set_log_mask_args_t *))};
+    /// @brief defines IOCTL for reloading a VMs extensions
+    constexpr bsl::safe_umx RELOAD_VMM{static_cast<bsl::uintmx>(
+        _IOW(0U, RELOAD_VMM_CMD.get(), reload_vmm_args_t *))};
+    /// @brief defines IOCTL for dumping a PP's trace ring
+    constexpr bsl::safe_umx DUMP_TRACE{static_cast<bsl::uintmx>(
+        _IOWR(0U, DUMP_TRACE_CMD.get(), dump_trace_args_t *))};
 }
 
 #endif
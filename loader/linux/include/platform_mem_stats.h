@@ -0,0 +1,51 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef PLATFORM_MEM_STATS_H
+#define PLATFORM_MEM_STATS_H
+
+#include <types.h>
+
+/**
+ * <!-- description -->
+ *   @brief Resets the loader's peak memory usage to the amount of memory
+ *     that is currently allocated. This is used to measure the peak
+ *     memory usage of a single operation (e.g., start_vmm).
+ */
+void platform_mem_reset_peak(void) NOEXCEPT;
+
+/**
+ * <!-- description -->
+ *   @brief Returns the largest number of bytes that the loader had
+ *     allocated at the same time since the last call to
+ *     platform_mem_reset_peak.
+ *
+ * <!-- inputs/outputs -->
+ *   @return Returns the loader's peak memory usage in bytes.
+ */
+NODISCARD uint64_t platform_mem_peak(void) NOEXCEPT;
+
+#endif
@@ -27,6 +27,8 @@
  */
 
 #include <debug.h>
+#include <dump_trace.h>
+#include <dump_trace_args_t.h>
 #include <dump_vmm.h>
 #include <dump_vmm_args_t.h>
 #include <linux/kernel.h>
@@ -39,9 +41,14 @@
 #include <loader_init.h>
 #include <loader_platform_interface.h>
 #include <platform.h>
+#include <platform_mem_stats.h>
+#include <reload_vmm.h>
+#include <reload_vmm_args_t.h>
 #include <serial_init.h>
 #include <start_vmm.h>
 #include <start_vmm_args_t.h>
+#include <set_log_mask.h>
+#include <set_log_mask_args_t.h>
 #include <stop_vmm.h>
 #include <stop_vmm_args_t.h>
 #include <types.h>
@@ -71,12 +78,15 @@ dispatch_start_vmm(void *const ioctl_args)
         return -EPERM;
     }
 
+    platform_mem_reset_peak();
+
     ret = start_vmm(&args);
     if (ret) {
         bferror("start_vmm failed");
         return -EPERM;
     }
 
+    bfdebug_x64("start_vmm peak loader memory", platform_mem_peak());
     return 0;
 }
 
@@ -102,6 +112,53 @@ dispatch_stop_vmm(void *const ioctl_args)
     return 0;
 }
 
+static long
+dispatch_reload_vmm(void *const ioctl_args)
+{
+    int64_t ret;
+    struct reload_vmm_args_t args;
+
+    ret = platform_copy_from_user(
+        &args, ioctl_args, sizeof(struct reload_vmm_args_t));
+    if (ret) {
+        bferror("platform_copy_from_user failed");
+        return -EPERM;
+    }
+
+    platform_mem_reset_peak();
+
+    ret = reload_vmm(&args);
+    if (ret) {
+        bferror("reload_vmm failed");
+        return -EPERM;
+    }
+
+    bfdebug_x64("reload_vmm peak loader memory", platform_mem_peak());
+    return 0;
+}
+
+static long
+dispatch_set_log_mask(void *const ioctl_args)
+{
+    int64_t ret;
+    struct set_log_mask_args_t args;
+
+    ret = platform_copy_from_user(
+        &args, ioctl_args, sizeof(struct set_log_mask_args_t));
+    if (ret) {
+        bferror("platform_copy_from_user failed");
+        return -EPERM;
+    }
+
+    ret = set_log_mask(&args);
+    if (ret) {
+        bferror("set_log_mask failed");
+        return -EPERM;
+    }
+
+    return 0;
+}
+
 static long
 dispatch_dump_vmm(void *const ioctl_args)
 {
@@ -146,6 +203,50 @@ platform_copy_from_user_failed:
     return -EPERM;
 }
 
+static long
+dispatch_dump_trace(void *const ioctl_args)
+{
+    int64_t ret;
+    struct dump_trace_args_t *args;
+
+    args = (struct dump_trace_args_t *)platform_alloc(
+        sizeof(struct dump_trace_args_t));
+    if (NULLPTR == args) {
+        bferror("platform_alloc failed");
+        return LOADER_FAILURE;
+    }
+
+    ret = platform_copy_from_user(
+        args, ioctl_args, sizeof(struct dump_trace_args_t));
+    if (ret) {
+        bferror("platform_copy_from_user failed");
+        goto platform_copy_from_user_failed;
+    }
+
+    ret = dump_trace(args);
+    if (ret) {
+        bferror("dump_trace failed");
+        goto dump_trace_failed;
+    }
+
+    ret = platform_copy_to_user(
+        ioctl_args, args, sizeof(struct dump_trace_args_t));
+    if (ret) {
+        bferror("platform_copy_to_user failed");
+        goto platform_copy_to_user_failed;
+    }
+
+    platform_free(args, sizeof(struct dump_trace_args_t));
+    return 0;
+
+platform_copy_to_user_failed:
+dump_trace_failed:
+platform_copy_from_user_failed:
+
+    platform_free(args, sizeof(struct dump_trace_args_t));
+    return -EPERM;
+}
+
 static long
 dev_unlocked_ioctl(
     struct file *file, unsigned int cmd, unsigned long ioctl_args)
@@ -160,6 +261,15 @@ dev_unlocked_ioctl(
         case LOADER_DUMP_VMM: {
             return dispatch_dump_vmm((void *)ioctl_args);
         }
+        case LOADER_SET_LOG_MASK: {
+            return dispatch_set_log_mask((void *)ioctl_args);
+        }
+        case LOADER_RELOAD_VMM: {
+            return dispatch_reload_vmm((void *)ioctl_args);
+        }
+        case LOADER_DUMP_TRACE: {
+            return dispatch_dump_trace((void *)ioctl_args);
+        }
         default: {
             bferror_x64("invalid ioctl cmd", cmd);
             return -EINVAL;
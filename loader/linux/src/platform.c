@@ -30,13 +30,56 @@
 #include <debug.h>
 #include <linux/cpu.h>
 #include <linux/mm.h>
+#include <linux/nodemask.h>
 #include <linux/slab.h>
 #include <linux/smp.h>
+#include <linux/topology.h>
 #include <linux/vmalloc.h>
 #include <platform.h>
+#include <platform_mem_stats.h>
 #include <types.h>
 #include <work_on_cpu_callback_args.h>
 
+/** @brief stores the number of bytes currently allocated by the loader */
+static uint64_t g_mut_mem_usage;
+/** @brief stores the peak of g_mut_mem_usage since the last reset */
+static uint64_t g_mut_mem_peak;
+
+/**
+ * <!-- description -->
+ *   @brief Records an allocation of size bytes, updating the peak
+ *     memory usage as needed.
+ *
+ * <!-- inputs/outputs -->
+ *   @param size the number of bytes that were allocated
+ */
+static void
+mem_stats_alloc(uint64_t const size) NOEXCEPT
+{
+    g_mut_mem_usage += size;
+    if (g_mut_mem_usage > g_mut_mem_peak) {
+        g_mut_mem_peak = g_mut_mem_usage;
+    }
+}
+
+/**
+ * <!-- description -->
+ *   @brief Records a free of size bytes.
+ *
+ * <!-- inputs/outputs -->
+ *   @param size the number of bytes that were freed
+ */
+static void
+mem_stats_free(uint64_t const size) NOEXCEPT
+{
+    if (size > g_mut_mem_usage) {
+        g_mut_mem_usage = ((uint64_t)0);
+    }
+    else {
+        g_mut_mem_usage -= size;
+    }
+}
+
 /**
  * <!-- description -->
  *   @brief If test is false, a contract violation has occurred. This
@@ -102,6 +145,7 @@ platform_alloc(uint64_t const size) NOEXCEPT
         return NULLPTR;
     }
 
+    mem_stats_alloc(size);
     return memset(mut_ret, 0, size);
 }
 
@@ -136,6 +180,47 @@ platform_alloc_contiguous(uint64_t const size) NOEXCEPT
         return NULLPTR;
     }
 
+    mem_stats_alloc(size);
+    return memset(mut_ret, 0, size);
+}
+
+/**
+ * <!-- description -->
+ *   @brief This function allocates read/write virtual memory from the
+ *     kernel, preferring physical pages that belong to the provided
+ *     NUMA node. This memory is not physically contiguous. If the
+ *     platform does not support NUMA, this is the same as calling
+ *     platform_alloc(). Use platform_free() to release this memory.
+ *
+ *   @note This function must zero the allocated memory
+ *
+ * <!-- inputs/outputs -->
+ *   @param size the number of bytes to allocate
+ *   @param node the NUMA node to allocate the memory from
+ *   @return Returns a pointer to the newly allocated memory on success.
+ *     Returns a nullptr on failure.
+ */
+NODISCARD void *
+platform_alloc_node(uint64_t const size, uint32_t const node) NOEXCEPT
+{
+    void *mut_ret;
+
+    if (0 == size) {
+        bferror("invalid number of bytes (i.e., size)");
+        return NULLPTR;
+    }
+
+    if (!node_online((int)node)) {
+        return platform_alloc(size);
+    }
+
+    mut_ret = vmalloc_node(size, (int)node);
+    if (NULLPTR == mut_ret) {
+        bferror("vmalloc_node failed");
+        return NULLPTR;
+    }
+
+    mem_stats_alloc(size);
     return memset(mut_ret, 0, size);
 }
 
@@ -154,9 +239,8 @@ platform_alloc_contiguous(uint64_t const size) NOEXCEPT
 void
 platform_free(void const *const ptr, uint64_t const size) NOEXCEPT
 {
-    (void)size;
-
     if (NULLPTR != ptr) {
+        mem_stats_free(size);
         vfree(ptr);
     }
 }
@@ -176,13 +260,38 @@ platform_free(void const *const ptr, uint64_t const size) NOEXCEPT
 void
 platform_free_contiguous(void const *const ptr, uint64_t const size) NOEXCEPT
 {
-    (void)size;
-
     if (NULLPTR != ptr) {
+        mem_stats_free(size);
         kfree(ptr);
     }
 }
 
+/**
+ * <!-- description -->
+ *   @brief Resets the loader's peak memory usage to the amount of memory
+ *     that is currently allocated.
+ */
+void
+platform_mem_reset_peak(void) NOEXCEPT
+{
+    g_mut_mem_peak = g_mut_mem_usage;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Returns the largest number of bytes that the loader had
+ *     allocated at the same time since the last call to
+ *     platform_mem_reset_peak.
+ *
+ * <!-- inputs/outputs -->
+ *   @return Returns the loader's peak memory usage in bytes.
+ */
+NODISCARD uint64_t
+platform_mem_peak(void) NOEXCEPT
+{
+    return g_mut_mem_peak;
+}
+
 /**
  * <!-- description -->
  *   @brief Given a virtual address, this function returns the virtual
@@ -314,6 +423,48 @@ platform_num_online_cpus(void) NOEXCEPT
     return num_online_cpus();
 }
 
+/**
+ * <!-- description -->
+ *   @brief Returns 1 if the provided NUMA node is online, and 0
+ *     otherwise. NUMA node IDs do not have to be contiguous, so
+ *     callers should check each ID instead of assuming that nodes
+ *     0 through N - 1 are online. Platforms that do not support NUMA
+ *     only report node 0 as online.
+ *
+ * <!-- inputs/outputs -->
+ *   @param node the NUMA node to query
+ *   @return Returns 1 if the provided NUMA node is online, and 0
+ *     otherwise
+ */
+NODISCARD uint32_t
+platform_numa_node_online(uint32_t const node) NOEXCEPT
+{
+    if (((uint64_t)node) >= ((uint64_t)MAX_NUMNODES)) {
+        return 0U;
+    }
+
+    if (node_online((int)node)) {
+        return 1U;
+    }
+
+    return 0U;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Returns the NUMA node that the provided CPU (i.e. PP)
+ *     belongs to. Platforms that do not support NUMA always return 0.
+ *
+ * <!-- inputs/outputs -->
+ *   @param cpu the CPU (i.e. PP) to query
+ *   @return Returns the NUMA node that the provided CPU belongs to
+ */
+NODISCARD uint32_t
+platform_numa_node_of_cpu(uint32_t const cpu) NOEXCEPT
+{
+    return (uint32_t)cpu_to_node((int)cpu);
+}
+
 /**
  * <!-- description -->
  *   @brief This function is called when the user calls platform_on_each_cpu.
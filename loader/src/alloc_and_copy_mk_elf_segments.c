@@ -34,6 +34,40 @@
 #include <platform.h>
 #include <types.h>
 
+/**
+ * <!-- description -->
+ *   @brief Returns 1 if the provided ELF segment can be mapped directly
+ *     from the ELF file instead of being copied. This is true for any
+ *     read-only segment that is fully backed by the ELF file and starts
+ *     on a page boundary. The microkernel's ELF file stays resident for
+ *     as long as the VMM is loaded (reload_vmm needs it), so mapping these
+ *     segments from the ELF file means that the bulk of the microkernel
+ *     (i.e., its code and read-only data) only exists in memory once.
+ *
+ * <!-- inputs/outputs -->
+ *   @param phdr the program header describing the ELF segment to check
+ *   @return Returns 1 if the ELF segment can be shared, 0 otherwise.
+ */
+NODISCARD static int
+is_shareable_mk_elf_segment(struct bfelf_elf64_phdr_t const *const phdr) NOEXCEPT
+{
+    uint64_t const mask = HYPERVISOR_PAGE_SIZE - ((uint64_t)1);
+
+    if (((uint32_t)0) != (phdr->p_flags & bfelf_pf_w)) {
+        return 0;
+    }
+
+    if (phdr->p_filesz != phdr->p_memsz) {
+        return 0;
+    }
+
+    if (((uint64_t)0) != (((uint64_t)phdr->p_offset) & mask)) {
+        return 0;
+    }
+
+    return 1;
+}
+
 /**
  * <!-- description -->
  *   @brief This function provides the guts of the
@@ -52,19 +86,33 @@ alloc_and_copy_mk_elf_segment(
 {
     uint8_t const *const src_addr = phdr->p_offset;
     uint64_t const dst_size = phdr->p_memsz;
+    uint8_t *mut_dst_addr;
+
+    if (is_shareable_mk_elf_segment(phdr)) {
+        pmut_mk_elf_segment->addr = src_addr;
+        pmut_mk_elf_segment->size = dst_size;
+        pmut_mk_elf_segment->virt = phdr->p_vaddr;
+        pmut_mk_elf_segment->flags = phdr->p_flags;
+        pmut_mk_elf_segment->shared = ((uint32_t)1);
+
+        return LOADER_SUCCESS;
+    }
+
+    bf_touch();
 
-    uint8_t *const pmut_dst_addr = (uint8_t *)platform_alloc(dst_size);
-    if (NULLPTR == pmut_dst_addr) {
+    mut_dst_addr = (uint8_t *)platform_alloc(dst_size);
+    if (NULLPTR == mut_dst_addr) {
         bferror("platform_alloc failed");
         return LOADER_FAILURE;
     }
 
-    platform_memcpy(pmut_dst_addr, src_addr, phdr->p_filesz);
+    platform_memcpy(mut_dst_addr, src_addr, phdr->p_filesz);
 
-    pmut_mk_elf_segment->addr = pmut_dst_addr;
+    pmut_mk_elf_segment->addr = mut_dst_addr;
     pmut_mk_elf_segment->size = dst_size;
     pmut_mk_elf_segment->virt = phdr->p_vaddr;
     pmut_mk_elf_segment->flags = phdr->p_flags;
+    pmut_mk_elf_segment->shared = ((uint32_t)0);
 
     return LOADER_SUCCESS;
 }
@@ -78,9 +126,12 @@ alloc_and_copy_mk_elf_segment(
  *     and copy the contents of each ELF segment into the newly allocated
  *     memory. This is because we cannot execute directly from the ELF file
  *     itself, but instead of execute from the "loaded" version of the ELF
- *     file. Later, we will take each ELF segment and map it into the
- *     microkernel's memory space, ensuring the microkernel is capable of
- *     being executed given it's memory space.
+ *     file. The exception is read-only segments that are page aligned and
+ *     fully backed by the ELF file, which are used in place (see
+ *     is_shareable_mk_elf_segment for more details). Later, we will take
+ *     each ELF segment and map it into the microkernel's memory space,
+ *     ensuring the microkernel is capable of being executed given it's
+ *     memory space.
  *
  * <!-- inputs/outputs -->
  *   @param mk_elf_file the ELF file to copy the segments from
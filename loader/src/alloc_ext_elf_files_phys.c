@@ -0,0 +1,124 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <alloc_ext_elf_files_phys.h>
+#include <constants.h>
+#include <debug.h>
+#include <elf_file_t.h>
+#include <free_ext_elf_files_phys.h>
+#include <mutable_span_t.h>
+#include <platform.h>
+#include <types.h>
+
+/**
+ * <!-- description -->
+ *   @brief This function provides the guts of the alloc_ext_elf_files_phys
+ *     function, by creating the table for a single elf file.
+ *
+ * <!-- inputs/outputs -->
+ *   @param ext_elf_file the ELF file to create the table for
+ *   @param pmut_ext_elf_file_phys where to store the resulting table
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+NODISCARD static int64_t
+alloc_ext_elf_file_phys(
+    struct elf_file_t const *const ext_elf_file,
+    struct mutable_span_t *const pmut_ext_elf_file_phys) NOEXCEPT
+{
+    uint64_t mut_i;
+    uint64_t *pmut_mut_table;
+    uint8_t const *const file = ((uint8_t const *)ext_elf_file->addr);
+    uint64_t const pages = (ext_elf_file->size + (HYPERVISOR_PAGE_SIZE - ((uint64_t)1))) /
+                           HYPERVISOR_PAGE_SIZE;
+
+    if (NULLPTR == file) {
+        return LOADER_SUCCESS;
+    }
+
+    pmut_ext_elf_file_phys->size = pages * ((uint64_t)sizeof(uint64_t));
+    pmut_ext_elf_file_phys->addr = (uint8_t *)platform_alloc(pmut_ext_elf_file_phys->size);
+    if (NULLPTR == pmut_ext_elf_file_phys->addr) {
+        bferror("platform_alloc failed");
+        goto platform_alloc_failed;
+    }
+
+    pmut_mut_table = (uint64_t *)pmut_ext_elf_file_phys->addr;
+    for (mut_i = ((uint64_t)0); mut_i < pages; ++mut_i) {
+        pmut_mut_table[mut_i] = platform_virt_to_phys(file + (mut_i * HYPERVISOR_PAGE_SIZE));
+        if (((uint64_t)0) == pmut_mut_table[mut_i]) {
+            bferror("platform_virt_to_phys failed");
+            goto platform_virt_to_phys_failed;
+        }
+
+        bf_touch();
+    }
+
+    return LOADER_SUCCESS;
+
+platform_virt_to_phys_failed:
+
+    platform_free(pmut_ext_elf_file_phys->addr, pmut_ext_elf_file_phys->size);
+platform_alloc_failed:
+
+    platform_memset(pmut_ext_elf_file_phys, ((uint8_t)0), sizeof(struct mutable_span_t));
+    return LOADER_FAILURE;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Allocates a table for each provided extension ELF file that
+ *     stores the physical address of each page of the ELF file. The
+ *     microkernel uses these tables to map the read-only segments of
+ *     an extension directly from the ELF file instead of copying them.
+ *
+ * <!-- inputs/outputs -->
+ *   @param ext_elf_files the ELF files to create the tables for
+ *   @param pmut_ext_elf_files_phys where to store the resulting tables
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+NODISCARD int64_t
+alloc_ext_elf_files_phys(
+    struct elf_file_t const *const ext_elf_files,
+    struct mutable_span_t *const pmut_ext_elf_files_phys) NOEXCEPT
+{
+    uint64_t mut_i;
+
+    for (mut_i = ((uint64_t)0); mut_i < HYPERVISOR_MAX_EXTENSIONS; ++mut_i) {
+        if (alloc_ext_elf_file_phys(&ext_elf_files[mut_i], &pmut_ext_elf_files_phys[mut_i])) {
+            bferror_d32("alloc_ext_elf_file_phys failed", (uint32_t)mut_i);
+            goto alloc_ext_elf_file_phys_failed;
+        }
+
+        bf_touch();
+    }
+
+    return LOADER_SUCCESS;
+
+alloc_ext_elf_file_phys_failed:
+
+    free_ext_elf_files_phys(pmut_ext_elf_files_phys);
+    return LOADER_FAILURE;
+}
@@ -39,11 +39,13 @@
  *
  * <!-- inputs/outputs -->
  *   @param size the total number of pages (not bytes) to allocate
+ *   @param node the NUMA node to allocate the pages from
  *   @param pmut_page_pool the mutable_span_t to store the page pool addr/size.
  *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
  */
 NODISCARD int64_t
-alloc_mk_page_pool(uint32_t const size, struct mutable_span_t *const pmut_page_pool) NOEXCEPT
+alloc_mk_page_pool(
+    uint32_t const size, uint32_t const node, struct mutable_span_t *const pmut_page_pool) NOEXCEPT
 {
     if (0U == size) {
         pmut_page_pool->size = HYPERVISOR_MK_PAGE_POOL_SIZE;
@@ -52,15 +54,15 @@ alloc_mk_page_pool(uint32_t const size, struct mutable_span_t *const pmut_page_p
         pmut_page_pool->size = HYPERVISOR_PAGE_SIZE * (uint64_t)size;
     }
 
-    pmut_page_pool->addr = platform_alloc(pmut_page_pool->size);
+    pmut_page_pool->addr = platform_alloc_node(pmut_page_pool->size, node);
     if (NULLPTR == pmut_page_pool->addr) {
-        bferror("platform_alloc failed");
-        goto platform_alloc_failed;
+        bferror("platform_alloc_node failed");
+        goto platform_alloc_node_failed;
     }
 
     return LOADER_SUCCESS;
 
-platform_alloc_failed:
+platform_alloc_node_failed:
 
     platform_memset(pmut_page_pool, ((uint8_t)0), sizeof(struct mutable_span_t));
     return LOADER_FAILURE;
@@ -0,0 +1,61 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <alloc_mk_trace_rings.h>
+#include <debug.h>
+#include <platform.h>
+#include <trace_ring_t.h>
+#include <types.h>
+
+/**
+ * <!-- description -->
+ *   @brief Allocates the trace rings that will be used by the
+ *     microkernel, one for each PP. If HYPERVISOR_TRACE is disabled,
+ *     no memory is allocated and pmut_trace_rings is set to NULL.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_trace_rings returns the newly allocated trace rings
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+NODISCARD int64_t
+alloc_mk_trace_rings(struct trace_ring_t **const pmut_trace_rings) NOEXCEPT
+{
+    platform_expects(NULLPTR != pmut_trace_rings);
+
+    if (((uint64_t)0) == HYPERVISOR_TRACE) {
+        *pmut_trace_rings = NULLPTR;
+        return LOADER_SUCCESS;
+    }
+
+    *pmut_trace_rings = (struct trace_ring_t *)platform_alloc(
+        HYPERVISOR_MAX_PPS * ((uint64_t)sizeof(struct trace_ring_t)));
+    if (NULLPTR == *pmut_trace_rings) {
+        bferror("platform_alloc failed");
+        return LOADER_FAILURE;
+    }
+
+    return LOADER_SUCCESS;
+}
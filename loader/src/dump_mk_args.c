@@ -48,9 +48,11 @@ dump_mk_args(struct mk_args_t const *const args, uint32_t const cpu) NOEXCEPT
 
     bfdebug_d32("mk args on cpu", cpu);
     bfdebug_x16(" - online_pps", args->online_pps);
+    bfdebug_x16(" - node", args->node);
     bfdebug_ptr(" - mk_state", args->mk_state);
     bfdebug_ptr(" - root_vp_state", args->root_vp_state);
     bfdebug_ptr(" - debug_ring", args->debug_ring);
+    bfdebug_ptr(" - trace_ring", args->trace_ring);
     bfdebug_ptr(" - mk_elf_file", args->mk_elf_file);
 
     for (mut_i = ((uint64_t)0); mut_i < HYPERVISOR_MAX_EXTENSIONS; ++mut_i) {
@@ -64,8 +66,29 @@ dump_mk_args(struct mk_args_t const *const args, uint32_t const cpu) NOEXCEPT
 
     bfdebug_ptr(" - rpt", args->rpt);
     bfdebug_x64(" - rpt_phys", args->rpt_phys);
-    bfdebug_ptr(" - page_pool.addr", args->page_pool.addr);
-    bfdebug_x64(" - page_pool.size", args->page_pool.size);
+
+    for (mut_i = ((uint64_t)0); mut_i < HYPERVISOR_MAX_NUMA_NODES; ++mut_i) {
+        if (NULLPTR != args->page_pool[mut_i].addr) {
+            bfdebug_ptr(" - page_pool.addr", args->page_pool[mut_i].addr);
+            bfdebug_x64(" - page_pool.size", args->page_pool[mut_i].size);
+        }
+        else {
+            bf_touch();
+        }
+    }
+
     bfdebug_ptr(" - huge_pool.addr", args->huge_pool.addr);
     bfdebug_x64(" - huge_pool.size", args->huge_pool.size);
+    bfdebug_ptr(" - page_pool_reserve.addr", args->page_pool_reserve.addr);
+    bfdebug_x64(" - page_pool_reserve.size", args->page_pool_reserve.size);
+
+    for (mut_i = ((uint64_t)0); mut_i < HYPERVISOR_MAX_EXTENSIONS; ++mut_i) {
+        if (NULLPTR != args->ext_elf_files_phys[mut_i].addr) {
+            bfdebug_ptr(" - ext_elf_files_phys.addr", args->ext_elf_files_phys[mut_i].addr);
+            bfdebug_x64(" - ext_elf_files_phys.size", args->ext_elf_files_phys[mut_i].size);
+        }
+        else {
+            bf_touch();
+        }
+    }
 }
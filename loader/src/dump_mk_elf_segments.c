@@ -50,6 +50,7 @@ dump_mk_elf_segments(struct elf_segment_t const *const segments) NOEXCEPT
             bfdebug_x64(" - size", segments[mut_i].size);
             bfdebug_x64(" - virt", segments[mut_i].virt);
             bfdebug_x32(" - flgs", segments[mut_i].flags);
+            bfdebug_x32(" - shrd", segments[mut_i].shared);
         }
         else {
             bf_touch();
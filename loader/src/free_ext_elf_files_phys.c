@@ -0,0 +1,52 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <constants.h>
+#include <free_ext_elf_files_phys.h>
+#include <mutable_span_t.h>
+#include <platform.h>
+#include <types.h>
+
+/**
+ * <!-- description -->
+ *   @brief Releases the tables previously allocated using the
+ *     alloc_ext_elf_files_phys function.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_ext_elf_files_phys the tables to free.
+ */
+void
+free_ext_elf_files_phys(struct mutable_span_t *const pmut_ext_elf_files_phys) NOEXCEPT
+{
+    uint64_t mut_i;
+    platform_expects(NULLPTR != pmut_ext_elf_files_phys);
+
+    for (mut_i = ((uint64_t)0); mut_i < HYPERVISOR_MAX_EXTENSIONS; ++mut_i) {
+        struct mutable_span_t *const pmut_phys = &pmut_ext_elf_files_phys[mut_i];
+        platform_free(pmut_phys->addr, pmut_phys->size);
+        platform_memset(pmut_phys, ((uint8_t)0), sizeof(struct mutable_span_t));
+    }
+}
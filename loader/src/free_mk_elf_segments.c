@@ -32,7 +32,8 @@
 /**
  * <!-- description -->
  *   @brief Releases a previously allocated elf_segment_t that was allocated
- *     using the alloc_and_copy_mk_elf_segments function.
+ *     using the alloc_and_copy_mk_elf_segments function. Segments that
+ *     are shared with the ELF file are not owned, and are only cleared.
  *
  * <!-- inputs/outputs -->
  *   @param pmut_mk_elf_segments the elf_segment_t to free.
@@ -45,7 +46,14 @@ free_mk_elf_segments(struct elf_segment_t *const pmut_mk_elf_segments) NOEXCEPT
 
     for (mut_i = ((uint64_t)0); mut_i < HYPERVISOR_MAX_SEGMENTS; ++mut_i) {
         struct elf_segment_t *const pmut_segment = &pmut_mk_elf_segments[mut_i];
-        platform_free(pmut_segment->addr, pmut_segment->size);
+
+        if (((uint32_t)0) == pmut_segment->shared) {
+            platform_free(pmut_segment->addr, pmut_segment->size);
+        }
+        else {
+            bf_touch();
+        }
+
         platform_memset(pmut_segment, ((uint8_t)0), sizeof(struct elf_segment_t));
     }
 }
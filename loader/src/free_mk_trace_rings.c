@@ -0,0 +1,51 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <free_mk_trace_rings.h>
+#include <platform.h>
+#include <trace_ring_t.h>
+#include <types.h>
+
+/**
+ * <!-- description -->
+ *   @brief Releases the trace rings that were allocated using the
+ *     alloc_mk_trace_rings function.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_trace_rings the trace rings to free.
+ */
+void
+free_mk_trace_rings(struct trace_ring_t **const pmut_trace_rings) NOEXCEPT
+{
+    platform_expects(NULLPTR != pmut_trace_rings);
+
+    if (NULLPTR == *pmut_trace_rings) {
+        return;
+    }
+
+    platform_free(*pmut_trace_rings, HYPERVISOR_MAX_PPS * ((uint64_t)sizeof(struct trace_ring_t)));
+    *pmut_trace_rings = NULLPTR;
+}
@@ -24,8 +24,9 @@
  * SOFTWARE.
  */
 
+#include <constants.h>
 #include <g_mut_mk_page_pool.h>
 #include <mutable_span_t.h>
 
-/** @brief stores the page pool used by the microkernel */
-struct mutable_span_t g_mut_mk_page_pool = {0};
+/** @brief stores the page pool used by the microkernel (one slice per NUMA node) */
+struct mutable_span_t g_mut_mk_page_pool[HYPERVISOR_MAX_NUMA_NODES] = {0};
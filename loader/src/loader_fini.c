@@ -27,9 +27,11 @@
 #include <debug.h>
 #include <free_mk_code_aliases.h>
 #include <free_mk_debug_ring.h>
+#include <free_mk_trace_rings.h>
 #include <g_mut_mk_code_aliases.h>
 #include <g_mut_vmm_status.h>
 #include <g_pmut_mut_mk_debug_ring.h>
+#include <g_pmut_mut_mk_trace_rings.h>
 #include <stop_and_free_the_vmm.h>
 #include <types.h>
 
@@ -54,6 +56,7 @@ loader_fini(void) NOEXCEPT
     stop_and_free_the_vmm();
 
     free_mk_code_aliases(&g_mut_mk_code_aliases);
+    free_mk_trace_rings(&g_pmut_mut_mk_trace_rings);
     free_mk_debug_ring(&g_pmut_mut_mk_debug_ring);
 
     return LOADER_SUCCESS;
@@ -26,10 +26,12 @@
 
 #include <alloc_and_copy_mk_code_aliases.h>
 #include <alloc_mk_debug_ring.h>
+#include <alloc_mk_trace_rings.h>
 #include <debug.h>
 #include <g_mut_mk_code_aliases.h>
 #include <g_mut_vmm_status.h>
 #include <g_pmut_mut_mk_debug_ring.h>
+#include <g_pmut_mut_mk_trace_rings.h>
 #include <loader_fini.h>
 #include <types.h>
 
@@ -61,6 +63,11 @@ loader_init(void) NOEXCEPT
         goto alloc_mk_debug_ring_failed;
     }
 
+    if (alloc_mk_trace_rings(&g_pmut_mut_mk_trace_rings)) {
+        bferror("alloc_mk_trace_rings failed");
+        goto alloc_mk_trace_rings_failed;
+    }
+
     if (alloc_and_copy_mk_code_aliases(&g_mut_mk_code_aliases)) {
         bferror("alloc_and_copy_mk_code_aliases failed");
         goto alloc_and_copy_mk_code_aliases_failed;
@@ -74,6 +81,7 @@ loader_init(void) NOEXCEPT
     return LOADER_SUCCESS;
 
 alloc_and_copy_mk_code_aliases_failed:
+alloc_mk_trace_rings_failed:
 alloc_mk_debug_ring_failed:
 
     (void)loader_fini();
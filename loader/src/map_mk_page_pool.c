@@ -46,7 +46,9 @@
  *     address of the next page in the page pool (using the direct map
  *     address). This way, all we need to do is pass virt to the
  *     microkernel, and it will have the HEAD of a linked list of pages
- *     that can be used as a page pool.
+ *     that can be used as a page pool. The last page's next pointer is
+ *     always cleared as the page pool might be reused (i.e., on a reload),
+ *     in which case its contents are no longer zero.
  *
  * <!-- inputs/outputs -->
  *   @param page_pool a pointer to a mutable_span_t that stores the page pool
@@ -85,5 +87,12 @@ map_mk_page_pool(
         pmut_mut_prev = ((uint64_t *)(page_pool->addr + mut_i));
     }
 
+    if (NULLPTR != pmut_mut_prev) {
+        pmut_mut_prev[0] = ((uint64_t)0);
+    }
+    else {
+        bf_touch();
+    }
+
     return LOADER_SUCCESS;
 }
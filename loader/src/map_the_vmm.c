@@ -0,0 +1,153 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <debug.h>
+#include <g_mut_ext_elf_files.h>
+#include <g_mut_ext_elf_files_phys.h>
+#include <g_mut_mk_code_aliases.h>
+#include <g_mut_mk_elf_file.h>
+#include <g_mut_mk_elf_segments.h>
+#include <g_mut_mk_huge_pool.h>
+#include <g_mut_mk_page_pool.h>
+#include <g_mut_mk_page_pool_reserve.h>
+#include <g_pmut_mut_mk_debug_ring.h>
+#include <g_pmut_mut_mk_trace_rings.h>
+#include <g_pmut_mut_mk_root_page_table.h>
+#include <map_ext_elf_files.h>
+#include <map_ext_elf_files_phys.h>
+#include <map_mk_code_aliases.h>
+#include <map_mk_debug_ring.h>
+#include <map_mk_trace_rings.h>
+#include <map_mk_elf_file.h>
+#include <map_mk_elf_segments.h>
+#include <map_mk_huge_pool.h>
+#include <map_mk_page_pool.h>
+#include <types.h>
+
+/**
+ * <!-- description -->
+ *   @brief Maps each NUMA node's slice of the microkernel's page pool
+ *     into the microkernel's root page table.
+ *
+ * <!-- inputs/outputs -->
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+NODISCARD static int64_t
+map_mk_page_pool_per_node(void) NOEXCEPT
+{
+    uint64_t mut_i;
+
+    for (mut_i = ((uint64_t)0); mut_i < HYPERVISOR_MAX_NUMA_NODES; ++mut_i) {
+        if (NULLPTR == g_mut_mk_page_pool[mut_i].addr) {
+            continue;
+        }
+
+        if (map_mk_page_pool(&g_mut_mk_page_pool[mut_i], g_pmut_mut_mk_root_page_table)) {
+            bferror_d32("map_mk_page_pool failed", (uint32_t)mut_i);
+            return LOADER_FAILURE;
+        }
+
+        bf_touch();
+    }
+
+    return LOADER_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Maps all of the memory that is shared by every CPU (i.e., the
+ *     debug ring, the trace rings, the code aliases, the ELF files, the
+ *     microkernel's ELF segments and the page/huge pools) into the
+ *     microkernel's root page table. This function is used by both the
+ *     start_vmm() function and the reload_vmm() function. Note that mapping
+ *     the page pool also rebuilds the page pool's free list, so this
+ *     function must not be called while the microkernel is running.
+ *
+ * <!-- inputs/outputs -->
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+NODISCARD int64_t
+map_the_vmm(void) NOEXCEPT
+{
+    if (map_mk_debug_ring(g_pmut_mut_mk_debug_ring, g_pmut_mut_mk_root_page_table)) {
+        bferror("map_mk_debug_ring failed");
+        return LOADER_FAILURE;
+    }
+
+    if (map_mk_trace_rings(g_pmut_mut_mk_trace_rings, g_pmut_mut_mk_root_page_table)) {
+        bferror("map_mk_trace_rings failed");
+        return LOADER_FAILURE;
+    }
+
+    if (map_mk_code_aliases(&g_mut_mk_code_aliases, g_pmut_mut_mk_root_page_table)) {
+        bferror("map_mk_code_aliases failed");
+        return LOADER_FAILURE;
+    }
+
+    if (map_mk_elf_file(&g_mut_mk_elf_file, g_pmut_mut_mk_root_page_table)) {
+        bferror("map_mk_elf_file failed");
+        return LOADER_FAILURE;
+    }
+
+    if (map_ext_elf_files(g_mut_ext_elf_files, g_pmut_mut_mk_root_page_table)) {
+        bferror("map_ext_elf_files failed");
+        return LOADER_FAILURE;
+    }
+
+    if (map_ext_elf_files_phys(g_mut_ext_elf_files_phys, g_pmut_mut_mk_root_page_table)) {
+        bferror("map_ext_elf_files_phys failed");
+        return LOADER_FAILURE;
+    }
+
+    if (map_mk_elf_segments(g_mut_mk_elf_segments, g_pmut_mut_mk_root_page_table)) {
+        bferror("map_mk_elf_segments failed");
+        return LOADER_FAILURE;
+    }
+
+    if (map_mk_page_pool_per_node()) {
+        bferror("map_mk_page_pool_per_node failed");
+        return LOADER_FAILURE;
+    }
+
+    if (map_mk_huge_pool(&g_mut_mk_huge_pool, g_pmut_mut_mk_root_page_table)) {
+        bferror("map_mk_huge_pool failed");
+        return LOADER_FAILURE;
+    }
+
+    if (NULLPTR != g_mut_mk_page_pool_reserve.addr) {
+        if (map_mk_page_pool(&g_mut_mk_page_pool_reserve, g_pmut_mut_mk_root_page_table)) {
+            bferror("map_mk_page_pool failed");
+            return LOADER_FAILURE;
+        }
+
+        bf_touch();
+    }
+    else {
+        bf_touch();
+    }
+
+    return LOADER_SUCCESS;
+}
@@ -0,0 +1,238 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <alloc_and_copy_ext_elf_files_from_user.h>
+#include <alloc_and_copy_mk_elf_segments.h>
+#include <alloc_ext_elf_files_phys.h>
+#include <alloc_mk_root_page_table.h>
+#include <debug.h>
+#include <dump_ext_elf_files.h>
+#include <dump_mk_elf_segments.h>
+#include <dump_mk_root_page_table.h>
+#include <elf_file_t.h>
+#include <free_ext_elf_files.h>
+#include <free_ext_elf_files_phys.h>
+#include <free_mk_elf_segments.h>
+#include <free_mk_root_page_table.h>
+#include <g_mut_ext_elf_files.h>
+#include <g_mut_ext_elf_files_phys.h>
+#include <g_mut_mk_elf_file.h>
+#include <g_mut_mk_elf_segments.h>
+#include <g_mut_vmm_status.h>
+#include <g_pmut_mut_mk_root_page_table.h>
+#include <map_the_vmm.h>
+#include <platform.h>
+#include <reload_vmm_args_t.h>
+#include <span_t.h>
+#include <start_vmm_per_cpu.h>
+#include <stop_and_free_the_vmm.h>
+#include <stop_vmm_per_cpu.h>
+#include <types.h>
+
+/**
+ * <!-- description -->
+ *   @brief Reloads the VMM's extensions. The new extensions are copied from
+ *     userspace before the VMM is stopped so that the time the VMM is not
+ *     running is kept to a minimum. Once the VMM is stopped, the per-CPU
+ *     state and the root page table are released, the microkernel's ELF
+ *     segments are reloaded from the resident copy of the microkernel's
+ *     ELF file, and everything is mapped again, which also rebuilds the
+ *     page pool's free list in place. The page/huge pools themselves are
+ *     never freed or allocated again.
+ *
+ * <!-- inputs/outputs -->
+ *   @param args the arguments to verify
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+NODISCARD static int64_t
+reload_the_vmm(struct reload_vmm_args_t const *const args) NOEXCEPT
+{
+    struct elf_file_t mut_ext_elf_files[HYPERVISOR_MAX_EXTENSIONS];
+
+    if (VMM_STATUS_RUNNING != g_mut_vmm_status) {
+        bferror("Unable to reload, the VMM is not running");
+        return LOADER_FAILURE;
+    }
+
+    if (alloc_and_copy_ext_elf_files_from_user(args->ext_elf_files, mut_ext_elf_files)) {
+        bferror("alloc_and_copy_ext_elf_files_from_user failed");
+        return LOADER_FAILURE;
+    }
+
+    if (platform_on_each_cpu(stop_vmm_per_cpu, PLATFORM_REVERSE)) {
+        bferror("stop_vmm_per_cpu failed");
+        goto stop_vmm_per_cpu_failed;
+    }
+
+    free_mk_root_page_table(&g_pmut_mut_mk_root_page_table);
+    free_mk_elf_segments(g_mut_mk_elf_segments);
+    free_ext_elf_files_phys(g_mut_ext_elf_files_phys);
+    free_ext_elf_files(g_mut_ext_elf_files);
+
+    platform_memcpy(g_mut_ext_elf_files, mut_ext_elf_files, sizeof(mut_ext_elf_files));
+
+    if (alloc_ext_elf_files_phys(g_mut_ext_elf_files, g_mut_ext_elf_files_phys)) {
+        bferror("alloc_ext_elf_files_phys failed");
+        goto alloc_ext_elf_files_phys_failed;
+    }
+
+    if (alloc_mk_root_page_table(&g_pmut_mut_mk_root_page_table)) {
+        bferror("alloc_mk_root_page_table failed");
+        goto alloc_mk_root_page_table_failed;
+    }
+
+    if (alloc_and_copy_mk_elf_segments(&g_mut_mk_elf_file, g_mut_mk_elf_segments)) {
+        bferror("alloc_and_copy_mk_elf_segments failed");
+        goto alloc_and_copy_mk_elf_segments_failed;
+    }
+
+    if (map_the_vmm()) {
+        bferror("map_the_vmm failed");
+        goto map_the_vmm_failed;
+    }
+
+#ifdef DEBUG_LOADER
+    dump_mk_root_page_table(g_pmut_mut_mk_root_page_table);
+    dump_ext_elf_files(g_mut_ext_elf_files);
+    dump_mk_elf_segments(g_mut_mk_elf_segments);
+#endif
+
+    if (platform_on_each_cpu(start_vmm_per_cpu, PLATFORM_FORWARD)) {
+        bferror("start_vmm_per_cpu failed");
+        goto start_vmm_per_cpu_failed;
+    }
+
+    return LOADER_SUCCESS;
+
+start_vmm_per_cpu_failed:
+map_the_vmm_failed:
+alloc_and_copy_mk_elf_segments_failed:
+alloc_mk_root_page_table_failed:
+alloc_ext_elf_files_phys_failed:
+
+    stop_and_free_the_vmm();
+    return LOADER_FAILURE;
+
+stop_vmm_per_cpu_failed:
+
+    free_ext_elf_files(mut_ext_elf_files);
+    g_mut_vmm_status = VMM_STATUS_CORRUPT;
+    return LOADER_FAILURE;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Verifies that the arguments from the IOCTL are valid.
+ *
+ * <!-- inputs/outputs -->
+ *   @param args the arguments to verify
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+NODISCARD static int64_t
+verify_reload_vmm_args(struct reload_vmm_args_t const *const args) NOEXCEPT
+{
+    uint64_t mut_i;
+
+    if (((uint64_t)1) != args->ver) {
+        bferror("IOCTL ABI version not supported");
+        return LOADER_FAILURE;
+    }
+
+    if (NULLPTR == args->ext_elf_files[((uint64_t)0)].addr) {
+        bferror("at least one extension is required");
+        return LOADER_FAILURE;
+    }
+
+    for (mut_i = ((uint64_t)0); mut_i < HYPERVISOR_MAX_EXTENSIONS; ++mut_i) {
+        if (NULLPTR == args->ext_elf_files[mut_i].addr) {
+            if (((uint64_t)0) != args->ext_elf_files[mut_i].size) {
+                bferror("invalid extension address/size combination");
+                return LOADER_FAILURE;
+            }
+
+            bf_touch();
+        }
+        else {
+            bf_touch();
+        }
+
+        if (((uint64_t)0) == args->ext_elf_files[mut_i].size) {
+            if (NULLPTR != args->ext_elf_files[mut_i].addr) {
+                bferror("invalid extension address/size combination");
+                return LOADER_FAILURE;
+            }
+
+            bf_touch();
+        }
+        else {
+            bf_touch();
+        }
+
+        if (HYPERVISOR_MAX_ELF_FILE_SIZE <= args->ext_elf_files[mut_i].size) {
+            bferror_d32("ext_elf_files.size is invalid", (uint32_t)mut_i);
+            return LOADER_FAILURE;
+        }
+
+        bf_touch();
+    }
+
+    return LOADER_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief This function contains all of the code that is common between
+ *     all archiectures and all platforms for reloading the VMM's
+ *     extensions. Unlike start_vmm(), the microkernel's ELF file and the
+ *     page/huge pools are kept resident, so a reload does not need to
+ *     copy the microkernel from userspace or allocate the pools again.
+ *     This function will call platform and architecture specific
+ *     functions as needed.
+ *
+ * <!-- inputs/outputs -->
+ *   @param args arguments from the ioctl
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+NODISCARD int64_t
+reload_vmm(struct reload_vmm_args_t const *const args) NOEXCEPT
+{
+    if (NULLPTR == args) {
+        bferror("args was NULL");
+        return LOADER_FAILURE;
+    }
+
+    if (verify_reload_vmm_args(args)) {
+        bferror("verify_reload_vmm_args failed");
+        return LOADER_FAILURE;
+    }
+
+    if (reload_the_vmm(args)) {
+        bferror("reload_the_vmm failed");
+        return LOADER_FAILURE;
+    }
+
+    return LOADER_SUCCESS;
+}
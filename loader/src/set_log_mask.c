@@ -0,0 +1,96 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <debug.h>
+#include <g_mut_vmm_status.h>
+#include <send_command_set_log_mask.h>
+#include <set_log_mask.h>
+#include <set_log_mask_args_t.h>
+#include <types.h>
+
+/** @brief defines the largest log mask a CPUID command can carry */
+#define MAX_LOG_MASK ((uint64_t)0xFFFFFFFFU)
+
+/**
+ * <!-- description -->
+ *   @brief Verifies that the arguments from the IOCTL are valid.
+ *
+ * <!-- inputs/outputs -->
+ *   @param args the arguments to verify
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+NODISCARD static int64_t
+verify_set_log_mask_args(struct set_log_mask_args_t const *const args) NOEXCEPT
+{
+    if (((uint64_t)1) != args->ver) {
+        bferror("IOCTL ABI version not supported");
+        return LOADER_FAILURE;
+    }
+
+    if (args->mask > MAX_LOG_MASK) {
+        bferror_x64("log mask is out of range", args->mask);
+        return LOADER_FAILURE;
+    }
+
+    return LOADER_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief This function contains all of the code that is common between
+ *     all archiectures and all platforms for setting the VMM's runtime
+ *     log mask. The log mask is shared by all PPs in the microkernel, so
+ *     the command only needs to be sent from the current CPU.
+ *
+ * <!-- inputs/outputs -->
+ *   @param args arguments from the ioctl
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+NODISCARD int64_t
+set_log_mask(struct set_log_mask_args_t const *const args) NOEXCEPT
+{
+    if (NULLPTR == args) {
+        bferror("args was NULL");
+        return LOADER_FAILURE;
+    }
+
+    if (verify_set_log_mask_args(args)) {
+        bferror("verify_set_log_mask_args failed");
+        return LOADER_FAILURE;
+    }
+
+    if (VMM_STATUS_RUNNING != g_mut_vmm_status) {
+        bferror("unable to set the log mask as the VMM is not running");
+        return LOADER_FAILURE;
+    }
+
+    if (send_command_set_log_mask((uint32_t)args->mask)) {
+        bferror("send_command_set_log_mask failed");
+        return LOADER_FAILURE;
+    }
+
+    return LOADER_SUCCESS;
+}
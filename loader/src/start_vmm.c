@@ -27,6 +27,7 @@
 #include <alloc_and_copy_ext_elf_files_from_user.h>
 #include <alloc_and_copy_mk_elf_file_from_user.h>
 #include <alloc_and_copy_mk_elf_segments.h>
+#include <alloc_ext_elf_files_phys.h>
 #include <alloc_mk_huge_pool.h>
 #include <alloc_mk_page_pool.h>
 #include <alloc_mk_root_page_table.h>
@@ -39,28 +40,106 @@
 #include <dump_mk_page_pool.h>
 #include <dump_mk_root_page_table.h>
 #include <g_mut_ext_elf_files.h>
-#include <g_mut_mk_code_aliases.h>
+#include <g_mut_ext_elf_files_phys.h>
 #include <g_mut_mk_elf_file.h>
 #include <g_mut_mk_elf_segments.h>
 #include <g_mut_mk_huge_pool.h>
 #include <g_mut_mk_page_pool.h>
+#include <g_mut_mk_page_pool_reserve.h>
 #include <g_mut_vmm_status.h>
 #include <g_pmut_mut_mk_debug_ring.h>
 #include <g_pmut_mut_mk_root_page_table.h>
-#include <map_ext_elf_files.h>
-#include <map_mk_code_aliases.h>
-#include <map_mk_debug_ring.h>
-#include <map_mk_elf_file.h>
-#include <map_mk_elf_segments.h>
-#include <map_mk_huge_pool.h>
-#include <map_mk_page_pool.h>
+#include <g_pmut_mut_mk_trace_rings.h>
+#include <map_the_vmm.h>
 #include <platform.h>
 #include <span_t.h>
 #include <start_vmm_args_t.h>
 #include <start_vmm_per_cpu.h>
 #include <stop_and_free_the_vmm.h>
+#include <trace_ring_t.h>
 #include <types.h>
 
+/**
+ * <!-- description -->
+ *   @brief Allocates the microkernel's page pool. The requested number of
+ *     pages is split evenly across each online NUMA node whose ID is less
+ *     than HYPERVISOR_MAX_NUMA_NODES, with any remaining pages given to
+ *     the last node, so that each PP can allocate from memory that is
+ *     local to it. Node IDs do not have to be contiguous, so each node's
+ *     pages are stored using its real ID, which is the same ID the PPs on
+ *     that node are given. Note that the "size" parameter is in total
+ *     pages and not in bytes. If the provided size is 0, a default number
+ *     of pages is used.
+ *
+ * <!-- inputs/outputs -->
+ *   @param size the total number of pages (not bytes) to allocate
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+NODISCARD static int64_t
+alloc_mk_page_pool_per_node(uint32_t const size) NOEXCEPT
+{
+    uint32_t mut_node;
+    uint32_t mut_pages;
+    uint32_t mut_done = 0U;
+    uint32_t mut_nodes = 0U;
+    uint32_t mut_total = size;
+
+    if (0U == mut_total) {
+        mut_total = ((uint32_t)(HYPERVISOR_MK_PAGE_POOL_SIZE / HYPERVISOR_PAGE_SIZE));
+    }
+    else {
+        bf_touch();
+    }
+
+    for (mut_node = 0U; ((uint64_t)mut_node) < HYPERVISOR_MAX_NUMA_NODES; ++mut_node) {
+        if (0U != platform_numa_node_online(mut_node)) {
+            ++mut_nodes;
+        }
+        else {
+            bf_touch();
+        }
+    }
+
+    if (mut_nodes > mut_total) {
+        mut_nodes = mut_total;
+    }
+    else {
+        bf_touch();
+    }
+
+    if (0U == mut_nodes) {
+        if (alloc_mk_page_pool(mut_total, 0U, &g_mut_mk_page_pool[0])) {
+            bferror("alloc_mk_page_pool failed");
+            return LOADER_FAILURE;
+        }
+
+        return LOADER_SUCCESS;
+    }
+
+    for (mut_node = 0U; mut_done < mut_nodes; ++mut_node) {
+        if (0U == platform_numa_node_online(mut_node)) {
+            continue;
+        }
+
+        mut_pages = mut_total / mut_nodes;
+        if ((mut_done + 1U) == mut_nodes) {
+            mut_pages += mut_total % mut_nodes;
+        }
+        else {
+            bf_touch();
+        }
+
+        if (alloc_mk_page_pool(mut_pages, mut_node, &g_mut_mk_page_pool[mut_node])) {
+            bferror_d32("alloc_mk_page_pool failed", mut_node);
+            return LOADER_FAILURE;
+        }
+
+        ++mut_done;
+    }
+
+    return LOADER_SUCCESS;
+}
+
 /**
  * <!-- description -->
  *   @brief Allocates and starts the VMM
@@ -72,6 +151,10 @@
 NODISCARD static int64_t
 alloc_and_start_the_vmm(struct start_vmm_args_t const *const args) NOEXCEPT
 {
+#ifdef DEBUG_LOADER
+    uint64_t mut_i;
+#endif
+
     if (VMM_STATUS_CORRUPT == g_mut_vmm_status) {
         bferror("Unable to start, previous VMM failed to properly stop");
         return LOADER_FAILURE;
@@ -87,6 +170,16 @@ alloc_and_start_the_vmm(struct start_vmm_args_t const *const args) NOEXCEPT
     g_pmut_mut_mk_debug_ring->epos = ((uint64_t)0);
     g_pmut_mut_mk_debug_ring->spos = ((uint64_t)0);
 
+    if (NULLPTR != g_pmut_mut_mk_trace_rings) {
+        platform_memset(
+            g_pmut_mut_mk_trace_rings,
+            ((uint8_t)0),
+            HYPERVISOR_MAX_PPS * ((uint64_t)sizeof(struct trace_ring_t)));
+    }
+    else {
+        bf_touch();
+    }
+
     if (alloc_mk_root_page_table(&g_pmut_mut_mk_root_page_table)) {
         bferror("alloc_mk_root_page_table failed");
         goto alloc_mk_root_page_table_failed;
@@ -107,49 +200,37 @@ alloc_and_start_the_vmm(struct start_vmm_args_t const *const args) NOEXCEPT
         goto alloc_and_copy_mk_elf_segments_failed;
     }
 
-    if (alloc_mk_page_pool(args->num_pages_in_page_pool, &g_mut_mk_page_pool)) {
-        bferror("alloc_mk_page_pool failed");
+    if (alloc_mk_page_pool_per_node(args->num_pages_in_page_pool)) {
+        bferror("alloc_mk_page_pool_per_node failed");
         goto alloc_mk_page_pool_failed;
     }
 
-    if (alloc_mk_huge_pool(0U, &g_mut_mk_huge_pool)) {
+    if (alloc_mk_huge_pool(args->num_pages_in_huge_pool, &g_mut_mk_huge_pool)) {
         bferror("alloc_mk_huge_pool failed");
         goto alloc_mk_huge_pool_failed;
     }
 
-    if (map_mk_debug_ring(g_pmut_mut_mk_debug_ring, g_pmut_mut_mk_root_page_table)) {
-        bferror("map_mk_debug_ring failed");
-        goto map_mk_debug_ring_failed;
-    }
-
-    if (map_mk_code_aliases(&g_mut_mk_code_aliases, g_pmut_mut_mk_root_page_table)) {
-        bferror("map_mk_code_aliases failed");
-        goto map_mk_code_aliases_failed;
-    }
-
-    if (map_mk_elf_file(&g_mut_mk_elf_file, g_pmut_mut_mk_root_page_table)) {
-        bferror("map_mk_elf_file failed");
-        goto map_mk_elf_file_failed;
-    }
+    if (0U != args->num_pages_in_page_pool_reserve) {
+        if (alloc_mk_page_pool(
+                args->num_pages_in_page_pool_reserve, 0U, &g_mut_mk_page_pool_reserve)) {
+            bferror("alloc_mk_page_pool failed");
+            goto alloc_mk_page_pool_reserve_failed;
+        }
 
-    if (map_ext_elf_files(g_mut_ext_elf_files, g_pmut_mut_mk_root_page_table)) {
-        bferror("map_ext_elf_files failed");
-        goto map_ext_elf_files_failed;
+        bf_touch();
     }
-
-    if (map_mk_elf_segments(g_mut_mk_elf_segments, g_pmut_mut_mk_root_page_table)) {
-        bferror("map_mk_elf_segments failed");
-        goto map_mk_elf_segments_failed;
+    else {
+        bf_touch();
     }
 
-    if (map_mk_page_pool(&g_mut_mk_page_pool, g_pmut_mut_mk_root_page_table)) {
-        bferror("map_mk_page_pool failed");
-        goto map_mk_page_pool_failed;
+    if (alloc_ext_elf_files_phys(g_mut_ext_elf_files, g_mut_ext_elf_files_phys)) {
+        bferror("alloc_ext_elf_files_phys failed");
+        goto alloc_ext_elf_files_phys_failed;
     }
 
-    if (map_mk_huge_pool(&g_mut_mk_huge_pool, g_pmut_mut_mk_root_page_table)) {
-        bferror("map_mk_huge_pool failed");
-        goto map_mk_huge_pool_failed;
+    if (map_the_vmm()) {
+        bferror("map_the_vmm failed");
+        goto map_the_vmm_failed;
     }
 
 #ifdef DEBUG_LOADER
@@ -157,8 +238,21 @@ alloc_and_start_the_vmm(struct start_vmm_args_t const *const args) NOEXCEPT
     dump_mk_elf_file(&g_mut_mk_elf_file);
     dump_ext_elf_files(g_mut_ext_elf_files);
     dump_mk_elf_segments(g_mut_mk_elf_segments);
-    dump_mk_page_pool(&g_mut_mk_page_pool);
+    for (mut_i = ((uint64_t)0); mut_i < HYPERVISOR_MAX_NUMA_NODES; ++mut_i) {
+        if (NULLPTR != g_mut_mk_page_pool[mut_i].addr) {
+            dump_mk_page_pool(&g_mut_mk_page_pool[mut_i]);
+        }
+        else {
+            bf_touch();
+        }
+    }
     dump_mk_huge_pool(&g_mut_mk_huge_pool);
+    if (NULLPTR != g_mut_mk_page_pool_reserve.addr) {
+        dump_mk_page_pool(&g_mut_mk_page_pool_reserve);
+    }
+    else {
+        bf_touch();
+    }
 #endif
 
     if (platform_on_each_cpu(start_vmm_per_cpu, PLATFORM_FORWARD)) {
@@ -170,13 +264,9 @@ alloc_and_start_the_vmm(struct start_vmm_args_t const *const args) NOEXCEPT
     return LOADER_SUCCESS;
 
 start_vmm_per_cpu_failed:
-map_mk_huge_pool_failed:
-map_mk_page_pool_failed:
-map_mk_elf_segments_failed:
-map_ext_elf_files_failed:
-map_mk_elf_file_failed:
-map_mk_code_aliases_failed:
-map_mk_debug_ring_failed:
+map_the_vmm_failed:
+alloc_ext_elf_files_phys_failed:
+alloc_mk_page_pool_reserve_failed:
 alloc_mk_huge_pool_failed:
 alloc_mk_page_pool_failed:
 alloc_and_copy_mk_elf_segments_failed:
@@ -201,7 +291,7 @@ verify_start_vmm_args(struct start_vmm_args_t const *const args) NOEXCEPT
 {
     uint64_t mut_i;
 
-    if (((uint64_t)1) != args->ver) {
+    if (LOADER_START_VMM_ARGS_VER != args->ver) {
         bferror("IOCTL ABI version not supported");
         return LOADER_FAILURE;
     }
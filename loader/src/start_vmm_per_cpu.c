@@ -39,14 +39,17 @@
 #include <elf_file_t.h>
 #include <g_mut_cpu_status.h>
 #include <g_mut_ext_elf_files.h>
+#include <g_mut_ext_elf_files_phys.h>
 #include <g_mut_mk_args.h>
 #include <g_mut_mk_elf_file.h>
 #include <g_mut_mk_huge_pool.h>
 #include <g_mut_mk_page_pool.h>
+#include <g_mut_mk_page_pool_reserve.h>
 #include <g_mut_mk_stack.h>
 #include <g_mut_mk_state.h>
 #include <g_mut_root_vp_state.h>
 #include <g_pmut_mut_mk_debug_ring.h>
+#include <g_pmut_mut_mk_trace_rings.h>
 #include <g_pmut_mut_mk_root_page_table.h>
 #include <get_mk_huge_pool_addr.h>
 #include <get_mk_page_pool_addr.h>
@@ -169,27 +172,54 @@ start_vmm_per_cpu(uint32_t const cpu) NOEXCEPT
         g_mut_mk_args[cpu]->online_pps = g_mut_mk_args[0]->online_pps;
     }
 
+    g_mut_mk_args[cpu]->node = ((uint16_t)platform_numa_node_of_cpu(cpu));
+    if (((uint64_t)g_mut_mk_args[cpu]->node) >= HYPERVISOR_MAX_NUMA_NODES) {
+        g_mut_mk_args[cpu]->node = ((uint16_t)0);
+    }
+    else {
+        bf_touch();
+    }
+
     g_mut_mk_args[cpu]->mk_state = g_mut_mk_state[cpu];
     g_mut_mk_args[cpu]->root_vp_state = g_mut_root_vp_state[cpu];
     g_mut_mk_args[cpu]->debug_ring = g_pmut_mut_mk_debug_ring;
 
+    if (NULLPTR != g_pmut_mut_mk_trace_rings) {
+        g_mut_mk_args[cpu]->trace_ring = &g_pmut_mut_mk_trace_rings[cpu];
+    }
+    else {
+        g_mut_mk_args[cpu]->trace_ring = NULLPTR;
+    }
+
     g_mut_mk_args[cpu]->mk_elf_file = g_mut_mk_elf_file.addr;
     for (mut_i = ((uint64_t)0); mut_i < HYPERVISOR_MAX_EXTENSIONS; ++mut_i) {
         g_mut_mk_args[cpu]->ext_elf_files[mut_i] = g_mut_ext_elf_files[mut_i].addr;
+        g_mut_mk_args[cpu]->ext_elf_files_phys[mut_i].addr = g_mut_ext_elf_files_phys[mut_i].addr;
+        g_mut_mk_args[cpu]->ext_elf_files_phys[mut_i].size =
+            g_mut_ext_elf_files_phys[mut_i].size / ((uint64_t)sizeof(uint64_t));
     }
 
     g_mut_mk_args[cpu]->rpt = g_pmut_mut_mk_root_page_table;
     g_mut_mk_args[cpu]->rpt_phys = platform_virt_to_phys(g_pmut_mut_mk_root_page_table);
 
-    mut_ret =
-        get_mk_page_pool_addr(&g_mut_mk_page_pool, HYPERVISOR_MK_PAGE_POOL_ADDR, &pmut_mut_addr);
-    if (mut_ret) {
-        bferror("get_mk_page_pool_addr failed");
-        goto get_mk_page_pool_addr_failed;
-    }
+    for (mut_i = ((uint64_t)0); mut_i < HYPERVISOR_MAX_NUMA_NODES; ++mut_i) {
+        struct mutable_span_t const *const page_pool = &g_mut_mk_page_pool[mut_i];
+
+        if (NULLPTR == page_pool->addr) {
+            g_mut_mk_args[cpu]->page_pool[mut_i].addr = NULLPTR;
+            g_mut_mk_args[cpu]->page_pool[mut_i].size = ((uint64_t)0);
+            continue;
+        }
 
-    g_mut_mk_args[cpu]->page_pool.addr = pmut_mut_addr;
-    g_mut_mk_args[cpu]->page_pool.size = g_mut_mk_page_pool.size / HYPERVISOR_PAGE_SIZE;
+        mut_ret = get_mk_page_pool_addr(page_pool, HYPERVISOR_MK_PAGE_POOL_ADDR, &pmut_mut_addr);
+        if (mut_ret) {
+            bferror("get_mk_page_pool_addr failed");
+            goto get_mk_page_pool_addr_failed;
+        }
+
+        g_mut_mk_args[cpu]->page_pool[mut_i].addr = pmut_mut_addr;
+        g_mut_mk_args[cpu]->page_pool[mut_i].size = page_pool->size / HYPERVISOR_PAGE_SIZE;
+    }
 
     mut_ret =
         get_mk_huge_pool_addr(&g_mut_mk_huge_pool, HYPERVISOR_MK_HUGE_POOL_ADDR, &pmut_mut_addr);
@@ -201,6 +231,23 @@ start_vmm_per_cpu(uint32_t const cpu) NOEXCEPT
     g_mut_mk_args[cpu]->huge_pool.addr = pmut_mut_addr;
     g_mut_mk_args[cpu]->huge_pool.size = g_mut_mk_huge_pool.size / HYPERVISOR_PAGE_SIZE;
 
+    if (NULLPTR != g_mut_mk_page_pool_reserve.addr) {
+        mut_ret = get_mk_page_pool_addr(
+            &g_mut_mk_page_pool_reserve, HYPERVISOR_MK_PAGE_POOL_ADDR, &pmut_mut_addr);
+        if (mut_ret) {
+            bferror("get_mk_page_pool_addr failed");
+            goto get_mk_page_pool_reserve_addr_failed;
+        }
+
+        g_mut_mk_args[cpu]->page_pool_reserve.addr = pmut_mut_addr;
+        g_mut_mk_args[cpu]->page_pool_reserve.size =
+            g_mut_mk_page_pool_reserve.size / HYPERVISOR_PAGE_SIZE;
+    }
+    else {
+        g_mut_mk_args[cpu]->page_pool_reserve.addr = NULLPTR;
+        g_mut_mk_args[cpu]->page_pool_reserve.size = ((uint64_t)0);
+    }
+
 #ifdef DEBUG_LOADER
     dump_mk_stack(&g_mut_mk_stack[cpu], cpu);
     dump_mk_state(g_mut_mk_state[cpu], cpu);
@@ -222,6 +269,7 @@ start_vmm_per_cpu(uint32_t const cpu) NOEXCEPT
     return LOADER_SUCCESS;
 
 demote_failed:
+get_mk_page_pool_reserve_addr_failed:
 get_mk_huge_pool_addr_failed:
 get_mk_page_pool_addr_failed:
 map_mk_args_failed:
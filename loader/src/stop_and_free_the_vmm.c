@@ -26,16 +26,19 @@
 
 #include <debug.h>
 #include <free_ext_elf_files.h>
+#include <free_ext_elf_files_phys.h>
 #include <free_mk_elf_file.h>
 #include <free_mk_elf_segments.h>
 #include <free_mk_huge_pool.h>
 #include <free_mk_page_pool.h>
 #include <free_mk_root_page_table.h>
 #include <g_mut_ext_elf_files.h>
+#include <g_mut_ext_elf_files_phys.h>
 #include <g_mut_mk_elf_file.h>
 #include <g_mut_mk_elf_segments.h>
 #include <g_mut_mk_huge_pool.h>
 #include <g_mut_mk_page_pool.h>
+#include <g_mut_mk_page_pool_reserve.h>
 #include <g_mut_vmm_status.h>
 #include <g_pmut_mut_mk_root_page_table.h>
 #include <platform.h>
@@ -53,6 +56,8 @@
 void
 stop_and_free_the_vmm(void) NOEXCEPT
 {
+    uint64_t mut_i;
+
     if (VMM_STATUS_CORRUPT == g_mut_vmm_status) {
         bferror("Unable to stop, previous VMM stopped in a corrupt state");
         return;
@@ -63,9 +68,25 @@ stop_and_free_the_vmm(void) NOEXCEPT
         goto stop_vmm_per_cpu_failed;
     }
 
+    if (NULLPTR != g_mut_mk_page_pool_reserve.addr) {
+        free_mk_page_pool(&g_mut_mk_page_pool_reserve);
+    }
+    else {
+        bf_touch();
+    }
+
     free_mk_huge_pool(&g_mut_mk_huge_pool);
-    free_mk_page_pool(&g_mut_mk_page_pool);
+    for (mut_i = ((uint64_t)0); mut_i < HYPERVISOR_MAX_NUMA_NODES; ++mut_i) {
+        if (NULLPTR != g_mut_mk_page_pool[mut_i].addr) {
+            free_mk_page_pool(&g_mut_mk_page_pool[mut_i]);
+        }
+        else {
+            bf_touch();
+        }
+    }
+
     free_mk_elf_segments(g_mut_mk_elf_segments);
+    free_ext_elf_files_phys(g_mut_ext_elf_files_phys);
     free_ext_elf_files(g_mut_ext_elf_files);
     free_mk_elf_file(&g_mut_mk_elf_file);
     free_mk_root_page_table(&g_pmut_mut_mk_root_page_table);
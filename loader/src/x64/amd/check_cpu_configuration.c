@@ -46,6 +46,19 @@
 /** @brief define the CPUID feature bit for AVX */
 #define CPUID_FEATURE_ECX_AVX (((uint32_t)1) << ((uint32_t)28))
 
+/** @brief defines the CPUID leaf for XSAVE information */
+#define CPUID_LEAF_XSAVE ((uint32_t)0xD)
+/** @brief defines the CPUID sub-leaf for XSAVE extended features */
+#define CPUID_SUBLEAF_XSAVE_EXT ((uint32_t)0x1)
+/** @brief define the CPUID feature bit for XSAVEOPT */
+#define CPUID_XSAVE_EAX_XSAVEOPT (((uint32_t)1) << ((uint32_t)0))
+/** @brief defines the XSAVE components the microkernel saves per VS */
+#define XSAVE_RFBM ((uint32_t)0x2FF)
+/** @brief defines the first XSAVE component stored past the legacy area */
+#define XSAVE_FIRST_EXT_COMPONENT ((uint32_t)2)
+/** @brief defines the last XSAVE component the microkernel saves per VS */
+#define XSAVE_LAST_COMPONENT ((uint32_t)9)
+
 /** @brief defines the CPUID leaf for feature information */
 #define CPUID_LEAF_EXT_FEATURE ((uint32_t)0x80000001)
 /** @brief define the CPUID feature bit for VMX */
@@ -175,7 +188,60 @@ check_the_configuration_of_efer(void) NOEXCEPT
 
 /**
  * <!-- description -->
- *   @brief Check if the cpu supports XSAVE.
+ *   @brief Check if the XSAVE components the microkernel saves for each
+ *     VS fit in the single page that each VS is given to save them in.
+ *
+ * <!-- inputs/outputs -->
+ *   @return Returns 0 on success, LOADER_FAILURE otherwise.
+ */
+NODISCARD static inline int64_t
+check_xsave_area_size(void) NOEXCEPT
+{
+    uint32_t eax;
+    uint32_t ebx;
+    uint32_t ecx;
+    uint32_t edx;
+    uint32_t mut_features;
+    uint32_t mut_i;
+
+    eax = CPUID_LEAF_XSAVE;
+    ecx = 0U;
+    intrinsic_cpuid(&eax, &ebx, &ecx, &edx);
+
+    if (((uint64_t)ebx) <= HYPERVISOR_PAGE_SIZE) {
+        return LOADER_SUCCESS;
+    }
+
+    /**
+     * NOTE:
+     * - EBX is the size needed by every component enabled in XCR0, which
+     *   might include components the microkernel does not save (e.g.,
+     *   AMX), so the size is checked again using only the components in
+     *   XSAVE_RFBM, each of which reports its own offset and size.
+     */
+
+    mut_features = eax & XSAVE_RFBM;
+    for (mut_i = XSAVE_FIRST_EXT_COMPONENT; mut_i <= XSAVE_LAST_COMPONENT; ++mut_i) {
+        if (((mut_features >> mut_i) & 1U) == 0U) {
+            continue;
+        }
+
+        eax = CPUID_LEAF_XSAVE;
+        ecx = mut_i;
+        intrinsic_cpuid(&eax, &ebx, &ecx, &edx);
+
+        if ((((uint64_t)ebx) + ((uint64_t)eax)) > HYPERVISOR_PAGE_SIZE) {
+            bferror_x32("XSAVE component does not fit in a page", mut_i);
+            return LOADER_FAILURE;
+        }
+    }
+
+    return LOADER_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Check if the cpu supports XSAVE, XSAVEOPT and AVX.
  *
  * <!-- inputs/outputs -->
  *   @return Returns 0 on success, LOADER_FAILURE otherwise.
@@ -202,6 +268,20 @@ check_for_xsave(void) NOEXCEPT
         return LOADER_FAILURE;
     }
 
+    eax = CPUID_LEAF_XSAVE;
+    ecx = CPUID_SUBLEAF_XSAVE_EXT;
+    intrinsic_cpuid(&eax, &ebx, &ecx, &edx);
+
+    if ((eax & CPUID_XSAVE_EAX_XSAVEOPT) == 0U) {
+        bferror_x32("cpu does not support XSAVEOPT", eax);
+        return LOADER_FAILURE;
+    }
+
+    if (check_xsave_area_size()) {
+        bferror("check_xsave_area_size failed");
+        return LOADER_FAILURE;
+    }
+
     return LOADER_SUCCESS;
 }
 
@@ -36,10 +36,14 @@
 #define HYPERVISOR_SERIAL_PORT 0x03F8
 #define HYPERVISOR_DEBUG_RING_SIZE ((uint64_t)10)
 #define HYPERVISOR_VMEXIT_LOG_SIZE ((uint64_t)2)
+#define HYPERVISOR_SYSCALL_TRACE_SIZE ((uint64_t)2)
+#define HYPERVISOR_TRACE ((uint64_t)1)
+#define HYPERVISOR_TRACE_RING_SIZE ((uint64_t)2)
 #define HYPERVISOR_MAX_ELF_FILE_SIZE ((uint64_t)0x800000)
 #define HYPERVISOR_MAX_SEGMENTS ((uint64_t)3)
 #define HYPERVISOR_MAX_EXTENSIONS ((uint64_t)2)
 #define HYPERVISOR_MAX_PPS ((uint64_t)2)
+#define HYPERVISOR_MAX_NUMA_NODES ((uint64_t)2)
 #define HYPERVISOR_MAX_VMS ((uint64_t)2)
 #define HYPERVISOR_MAX_VPS ((uint64_t)2)
 #define HYPERVISOR_MAX_VSS ((uint64_t)2)
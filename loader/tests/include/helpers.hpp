@@ -60,6 +60,8 @@ namespace helpers
         extern bsl::int32 g_mut_map_4k_page;
         /// @brief unit test control for send_command_stop
         extern bsl::int32 g_mut_send_command_stop;
+        /// @brief unit test control for send_command_set_log_mask
+        extern bsl::int32 g_mut_send_command_set_log_mask;
 
         /// @brief return value for demote
         constinit inline bsl::safe_i32 g_mut_demote{};
@@ -110,6 +112,7 @@ namespace helpers
         g_mut_check_cpu_configuration = 0;
         g_mut_map_4k_page = 0;
         g_mut_send_command_stop = 0;
+        g_mut_send_command_set_log_mask = 0;
 
         g_mut_demote = 0;
     }
@@ -404,6 +404,85 @@ namespace loader
             };
         };
 
+        bsl::ut_scenario{"read-only segments are shared with the ELF file"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                elf_file_t mut_file{};
+                bsl::array<elf_segment_t, HYPERVISOR_MAX_SEGMENTS> mut_segments{};
+                bfelf_elf64_ehdr_t mut_ehdr{};
+                constexpr auto num_segments{42_umx};
+                bsl::array<bfelf_elf64_phdr_t, num_segments.get()> mut_phdrtbl{};
+                alignas(HYPERVISOR_PAGE_SIZE)
+                    bsl::array<bsl::uint8, HYPERVISOR_PAGE_SIZE> mut_buf{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_file.addr = &mut_ehdr;
+                    mut_file.size = sizeof(bfelf_elf64_ehdr_t);
+                    mut_ehdr.e_ident[bfelf_ei_mag0] = bfelf_elfmag0;
+                    mut_ehdr.e_ident[bfelf_ei_mag1] = bfelf_elfmag1;
+                    mut_ehdr.e_ident[bfelf_ei_mag2] = bfelf_elfmag2;
+                    mut_ehdr.e_ident[bfelf_ei_mag3] = bfelf_elfmag3;
+                    mut_ehdr.e_ident[bfelf_ei_class] = bfelf_elfclass64;
+                    mut_ehdr.e_ident[bfelf_ei_osabi] = bfelf_elfosabi_sysv;
+                    mut_ehdr.e_type = bfelf_et_exec;
+                    mut_ehdr.e_phdr = mut_phdrtbl.data();
+                    mut_ehdr.e_phnum = bsl::to_u16(num_segments).get();
+                    mut_phdrtbl.front().p_type = bfelf_pt_load;
+                    mut_phdrtbl.front().p_flags = bfelf_pf_r | bfelf_pf_x;
+                    mut_phdrtbl.front().p_offset = mut_buf.data();
+                    mut_phdrtbl.front().p_filesz = mut_buf.size().get();
+                    mut_phdrtbl.front().p_memsz = mut_buf.size().get();
+                    helpers::g_mut_platform_alloc = 1;
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_check(func(&mut_file, mut_segments.data()));
+                        bsl::ut_check(mut_buf.data() == mut_segments.front().addr);
+                        bsl::ut_check(1U == mut_segments.front().shared);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        free_mk_elf_segments(mut_segments.data());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"writable segments are copied"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                elf_file_t mut_file{};
+                bsl::array<elf_segment_t, HYPERVISOR_MAX_SEGMENTS> mut_segments{};
+                bfelf_elf64_ehdr_t mut_ehdr{};
+                constexpr auto num_segments{42_umx};
+                bsl::array<bfelf_elf64_phdr_t, num_segments.get()> mut_phdrtbl{};
+                alignas(HYPERVISOR_PAGE_SIZE)
+                    bsl::array<bsl::uint8, HYPERVISOR_PAGE_SIZE> mut_buf{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_file.addr = &mut_ehdr;
+                    mut_file.size = sizeof(bfelf_elf64_ehdr_t);
+                    mut_ehdr.e_ident[bfelf_ei_mag0] = bfelf_elfmag0;
+                    mut_ehdr.e_ident[bfelf_ei_mag1] = bfelf_elfmag1;
+                    mut_ehdr.e_ident[bfelf_ei_mag2] = bfelf_elfmag2;
+                    mut_ehdr.e_ident[bfelf_ei_mag3] = bfelf_elfmag3;
+                    mut_ehdr.e_ident[bfelf_ei_class] = bfelf_elfclass64;
+                    mut_ehdr.e_ident[bfelf_ei_osabi] = bfelf_elfosabi_sysv;
+                    mut_ehdr.e_type = bfelf_et_exec;
+                    mut_ehdr.e_phdr = mut_phdrtbl.data();
+                    mut_ehdr.e_phnum = bsl::to_u16(num_segments).get();
+                    mut_phdrtbl.front().p_type = bfelf_pt_load;
+                    mut_phdrtbl.front().p_flags = bfelf_pf_r | bfelf_pf_w;
+                    mut_phdrtbl.front().p_offset = mut_buf.data();
+                    mut_phdrtbl.front().p_filesz = mut_buf.size().get();
+                    mut_phdrtbl.front().p_memsz = mut_buf.size().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_check(func(&mut_file, mut_segments.data()));
+                        bsl::ut_check(mut_buf.data() != mut_segments.front().addr);
+                        bsl::ut_check(0U == mut_segments.front().shared);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        free_mk_elf_segments(mut_segments.data());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"success"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 elf_file_t mut_file{};
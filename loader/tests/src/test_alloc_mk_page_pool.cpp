@@ -53,7 +53,7 @@ namespace loader
             bsl::ut_given{} = [&]() noexcept {
                 mutable_span_t mut_pool{};
                 bsl::ut_then{} = [&]() noexcept {
-                    helpers::ut_check(func({}, &mut_pool));
+                    helpers::ut_check(func({}, {}, &mut_pool));
                 };
                 bsl::ut_cleanup{} = [&]() noexcept {
                     free_mk_page_pool(&mut_pool);
@@ -67,7 +67,7 @@ namespace loader
                 mutable_span_t mut_pool{};
                 constexpr auto pages{5_u32};
                 bsl::ut_then{} = [&]() noexcept {
-                    helpers::ut_check(func(pages.get(), &mut_pool));
+                    helpers::ut_check(func(pages.get(), {}, &mut_pool));
                 };
                 bsl::ut_cleanup{} = [&]() noexcept {
                     free_mk_page_pool(&mut_pool);
@@ -82,7 +82,7 @@ namespace loader
                 bsl::ut_when{} = [&]() noexcept {
                     helpers::g_mut_platform_alloc = 1;
                     bsl::ut_then{} = [&]() noexcept {
-                        helpers::ut_fails(func({}, &mut_pool));
+                        helpers::ut_fails(func({}, {}, &mut_pool));
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         helpers::reset();
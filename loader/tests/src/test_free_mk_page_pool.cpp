@@ -51,7 +51,7 @@ namespace loader
             bsl::ut_given{} = [&]() noexcept {
                 mutable_span_t mut_pool{};
                 bsl::ut_then{} = [&]() noexcept {
-                    helpers::ut_check(func({}, &mut_pool));
+                    helpers::ut_check(func({}, {}, &mut_pool));
                 };
                 bsl::ut_cleanup{} = [&]() noexcept {
                     free_mk_page_pool(&mut_pool);
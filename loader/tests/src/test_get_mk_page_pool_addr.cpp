@@ -56,7 +56,7 @@ namespace loader
             bsl::uint8 *pmut_mut_addr{};
             bsl::ut_given{} = [&]() noexcept {
                 bsl::ut_then{} = [&]() noexcept {
-                    helpers::ut_check(alloc_mk_page_pool({}, &mut_pool));
+                    helpers::ut_check(alloc_mk_page_pool({}, {}, &mut_pool));
                     helpers::ut_check(func(&mut_pool, addr.get(), &pmut_mut_addr));
                 };
                 bsl::ut_cleanup{} = [&]() noexcept {
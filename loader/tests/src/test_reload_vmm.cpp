@@ -0,0 +1,410 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../include/g_mut_vmm_status.h"
+#include "../../include/loader_fini.h"
+#include "../../include/loader_init.h"
+#include "../../include/reload_vmm.h"
+#include "../../include/start_vmm.h"
+
+#include <constants.h>
+#include <helpers.hpp>
+#include <reload_vmm_args_t.h>
+#include <span_t.h>
+#include <start_vmm_args_t.h>
+
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace loader
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        helpers::init();
+        constexpr auto func{&reload_vmm};
+
+        bsl::ut_scenario{"success"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                reload_vmm_args_t mut_reload_args{};
+                start_vmm_args_t mut_start_args{};
+                helpers::file_t mut_mk_elf_file{};
+                helpers::file_t mut_ext_elf_files{};
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::init_file(mut_mk_elf_file);
+                    helpers::init_file(mut_ext_elf_files);
+                    mut_reload_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_reload_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_reload_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    mut_start_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_start_args.num_pages_in_page_pool = bsl::safe_u32::magic_1().get();
+                    mut_start_args.mk_elf_file.addr = helpers::to_u8_ptr(&mut_mk_elf_file);
+                    mut_start_args.mk_elf_file.size = sizeof(mut_mk_elf_file);
+                    mut_start_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_start_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    helpers::ut_check(loader_init());
+                    helpers::ut_check(start_vmm(&mut_start_args));
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_check(func(&mut_reload_args));
+                        bsl::ut_check(VMM_STATUS_RUNNING == g_mut_vmm_status);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"reload twice"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                reload_vmm_args_t mut_reload_args{};
+                start_vmm_args_t mut_start_args{};
+                helpers::file_t mut_mk_elf_file{};
+                helpers::file_t mut_ext_elf_files{};
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::init_file(mut_mk_elf_file);
+                    helpers::init_file(mut_ext_elf_files);
+                    mut_reload_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_reload_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_reload_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    mut_start_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_start_args.num_pages_in_page_pool = bsl::safe_u32::magic_1().get();
+                    mut_start_args.mk_elf_file.addr = helpers::to_u8_ptr(&mut_mk_elf_file);
+                    mut_start_args.mk_elf_file.size = sizeof(mut_mk_elf_file);
+                    mut_start_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_start_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    helpers::ut_check(loader_init());
+                    helpers::ut_check(start_vmm(&mut_start_args));
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_check(func(&mut_reload_args));
+                        helpers::ut_check(func(&mut_reload_args));
+                        bsl::ut_check(VMM_STATUS_RUNNING == g_mut_vmm_status);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"alloc_and_copy_ext_elf_files_from_user fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                reload_vmm_args_t mut_reload_args{};
+                start_vmm_args_t mut_start_args{};
+                helpers::file_t mut_mk_elf_file{};
+                helpers::file_t mut_ext_elf_files{};
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::init_file(mut_mk_elf_file);
+                    helpers::init_file(mut_ext_elf_files);
+                    mut_reload_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_reload_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_reload_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    mut_start_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_start_args.num_pages_in_page_pool = bsl::safe_u32::magic_1().get();
+                    mut_start_args.mk_elf_file.addr = helpers::to_u8_ptr(&mut_mk_elf_file);
+                    mut_start_args.mk_elf_file.size = sizeof(mut_mk_elf_file);
+                    mut_start_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_start_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    helpers::ut_check(loader_init());
+                    helpers::ut_check(start_vmm(&mut_start_args));
+                    helpers::g_mut_platform_copy_from_user = 1;
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_reload_args));
+                        bsl::ut_check(VMM_STATUS_RUNNING == g_mut_vmm_status);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"stop_vmm_per_cpu fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                reload_vmm_args_t mut_reload_args{};
+                start_vmm_args_t mut_start_args{};
+                helpers::file_t mut_mk_elf_file{};
+                helpers::file_t mut_ext_elf_files{};
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::init_file(mut_mk_elf_file);
+                    helpers::init_file(mut_ext_elf_files);
+                    mut_reload_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_reload_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_reload_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    mut_start_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_start_args.num_pages_in_page_pool = bsl::safe_u32::magic_1().get();
+                    mut_start_args.mk_elf_file.addr = helpers::to_u8_ptr(&mut_mk_elf_file);
+                    mut_start_args.mk_elf_file.size = sizeof(mut_mk_elf_file);
+                    mut_start_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_start_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    helpers::ut_check(loader_init());
+                    helpers::ut_check(start_vmm(&mut_start_args));
+                    helpers::g_mut_send_command_stop = 1;
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_reload_args));
+                        bsl::ut_check(VMM_STATUS_CORRUPT == g_mut_vmm_status);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_vmm_status = VMM_STATUS_RUNNING;
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"alloc_mk_root_page_table fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                reload_vmm_args_t mut_reload_args{};
+                start_vmm_args_t mut_start_args{};
+                helpers::file_t mut_mk_elf_file{};
+                helpers::file_t mut_ext_elf_files{};
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::init_file(mut_mk_elf_file);
+                    helpers::init_file(mut_ext_elf_files);
+                    mut_reload_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_reload_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_reload_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    mut_start_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_start_args.num_pages_in_page_pool = bsl::safe_u32::magic_1().get();
+                    mut_start_args.mk_elf_file.addr = helpers::to_u8_ptr(&mut_mk_elf_file);
+                    mut_start_args.mk_elf_file.size = sizeof(mut_mk_elf_file);
+                    mut_start_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_start_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    helpers::ut_check(loader_init());
+                    helpers::ut_check(start_vmm(&mut_start_args));
+                    helpers::g_mut_platform_alloc = 2;
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_reload_args));
+                        bsl::ut_check(VMM_STATUS_STOPPED == g_mut_vmm_status);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_the_vmm fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                reload_vmm_args_t mut_reload_args{};
+                start_vmm_args_t mut_start_args{};
+                helpers::file_t mut_mk_elf_file{};
+                helpers::file_t mut_ext_elf_files{};
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::init_file(mut_mk_elf_file);
+                    helpers::init_file(mut_ext_elf_files);
+                    mut_reload_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_reload_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_reload_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    mut_start_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_start_args.num_pages_in_page_pool = bsl::safe_u32::magic_1().get();
+                    mut_start_args.mk_elf_file.addr = helpers::to_u8_ptr(&mut_mk_elf_file);
+                    mut_start_args.mk_elf_file.size = sizeof(mut_mk_elf_file);
+                    mut_start_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_start_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    helpers::ut_check(loader_init());
+                    helpers::ut_check(start_vmm(&mut_start_args));
+                    helpers::g_mut_map_4k_page = 1;
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_reload_args));
+                        bsl::ut_check(VMM_STATUS_STOPPED == g_mut_vmm_status);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"vmm not running"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                reload_vmm_args_t mut_args{};
+                helpers::file_t mut_ext_elf_files{};
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::init_file(mut_ext_elf_files);
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    helpers::ut_check(loader_init());
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"invalid version"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                reload_vmm_args_t mut_args{};
+                helpers::file_t mut_ext_elf_files{};
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::init_file(mut_ext_elf_files);
+                    mut_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    helpers::ut_check(loader_init());
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"missing ext_elf_files[0]"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                reload_vmm_args_t mut_args{};
+                helpers::file_t mut_ext_elf_files{};
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::init_file(mut_ext_elf_files);
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    helpers::ut_check(loader_init());
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"invalid ext_elf_files[1].addr"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                reload_vmm_args_t mut_args{};
+                helpers::file_t mut_ext_elf_files{};
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::init_file(mut_ext_elf_files);
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    mut_args.ext_elf_files[1].size = sizeof(mut_ext_elf_files);
+                    helpers::ut_check(loader_init());
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"invalid ext_elf_files[0].size #1"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                reload_vmm_args_t mut_args{};
+                helpers::file_t mut_ext_elf_files{};
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::init_file(mut_ext_elf_files);
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    helpers::ut_check(loader_init());
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"invalid ext_elf_files[0].size #2"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                reload_vmm_args_t mut_args{};
+                helpers::file_t mut_ext_elf_files{};
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::init_file(mut_ext_elf_files);
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_args.ext_elf_files[0].size = HYPERVISOR_MAX_ELF_FILE_SIZE;
+                    helpers::ut_check(loader_init());
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"null args"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::ut_check(loader_init());
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func({}));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        return helpers::fini();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    return loader::tests();
+}
@@ -485,6 +485,119 @@ namespace loader
             };
         };
 
+        bsl::ut_scenario{"success with huge pool and page pool reserve"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                start_vmm_args_t mut_args{};
+                helpers::file_t mut_mk_elf_file{};
+                helpers::file_t mut_ext_elf_files{};
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::init_file(mut_mk_elf_file);
+                    helpers::init_file(mut_ext_elf_files);
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_args.num_pages_in_page_pool = bsl::safe_u32::magic_1().get();
+                    mut_args.num_pages_in_huge_pool = bsl::safe_u32::magic_1().get();
+                    mut_args.num_pages_in_page_pool_reserve = bsl::safe_u32::magic_1().get();
+                    mut_args.mk_elf_file.addr = helpers::to_u8_ptr(&mut_mk_elf_file);
+                    mut_args.mk_elf_file.size = sizeof(mut_mk_elf_file);
+                    mut_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    helpers::ut_check(loader_init());
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_check(func(&mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"alloc_mk_page_pool for the page pool reserve fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                start_vmm_args_t mut_args{};
+                helpers::file_t mut_mk_elf_file{};
+                helpers::file_t mut_ext_elf_files{};
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::init_file(mut_mk_elf_file);
+                    helpers::init_file(mut_ext_elf_files);
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_args.num_pages_in_page_pool = bsl::safe_u32::magic_1().get();
+                    mut_args.num_pages_in_huge_pool = bsl::safe_u32::magic_1().get();
+                    mut_args.num_pages_in_page_pool_reserve = bsl::safe_u32::magic_1().get();
+                    mut_args.mk_elf_file.addr = helpers::to_u8_ptr(&mut_mk_elf_file);
+                    mut_args.mk_elf_file.size = sizeof(mut_mk_elf_file);
+                    mut_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    helpers::ut_check(loader_init());
+                    helpers::g_mut_platform_alloc = 6;
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"alloc_ext_elf_files_phys fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                start_vmm_args_t mut_args{};
+                helpers::file_t mut_mk_elf_file{};
+                helpers::file_t mut_ext_elf_files{};
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::init_file(mut_mk_elf_file);
+                    helpers::init_file(mut_ext_elf_files);
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_args.num_pages_in_page_pool = bsl::safe_u32::magic_1().get();
+                    mut_args.mk_elf_file.addr = helpers::to_u8_ptr(&mut_mk_elf_file);
+                    mut_args.mk_elf_file.size = sizeof(mut_mk_elf_file);
+                    mut_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    helpers::ut_check(loader_init());
+                    helpers::g_mut_platform_alloc = 6;
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_mk_page_pool for the page pool reserve fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                start_vmm_args_t mut_args{};
+                helpers::file_t mut_mk_elf_file{};
+                helpers::file_t mut_ext_elf_files{};
+                bsl::ut_when{} = [&]() noexcept {
+                    helpers::init_file(mut_mk_elf_file);
+                    helpers::init_file(mut_ext_elf_files);
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_args.num_pages_in_page_pool = bsl::safe_u32::magic_1().get();
+                    mut_args.num_pages_in_huge_pool = bsl::safe_u32::magic_1().get();
+                    mut_args.num_pages_in_page_pool_reserve = bsl::safe_u32::magic_1().get();
+                    mut_args.mk_elf_file.addr = helpers::to_u8_ptr(&mut_mk_elf_file);
+                    mut_args.mk_elf_file.size = sizeof(mut_mk_elf_file);
+                    mut_args.ext_elf_files[0].addr = helpers::to_u8_ptr(&mut_ext_elf_files);
+                    mut_args.ext_elf_files[0].size = sizeof(mut_ext_elf_files);
+                    helpers::ut_check(loader_init());
+                    helpers::g_mut_map_4k_page = 14;
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::ut_check(loader_fini());
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"platform_on_each_cpu fails"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 start_vmm_args_t mut_args{};
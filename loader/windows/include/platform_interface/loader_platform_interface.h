@@ -39,7 +39,10 @@
 
 /* clang-format on */
 
+#include <dump_trace_args_t.h>
 #include <dump_vmm_args_t.h>
+#include <reload_vmm_args_t.h>
+#include <set_log_mask_args_t.h>
 #include <start_vmm_args_t.h>
 #include <stop_vmm_args_t.h>
 
@@ -74,4 +77,20 @@ DEFINE_GUID(
         METHOD_BUFFERED,                                                                           \
         FILE_READ_DATA | FILE_WRITE_DATA)
 
+/** @brief defines IOCTL for setting a VMs runtime log mask */
+#define LOADER_SET_LOG_MASK                                                                        \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, LOADER_SET_LOG_MASK_CMD, METHOD_BUFFERED, FILE_READ_DATA)
+
+/** @brief defines IOCTL for reloading a VMs extensions */
+#define LOADER_RELOAD_VMM                                                                          \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, LOADER_RELOAD_VMM_CMD, METHOD_BUFFERED, FILE_READ_DATA)
+
+/** @brief defines IOCTL for dumping a PP's trace ring */
+#define LOADER_DUMP_TRACE                                                                          \
+    CTL_CODE(                                                                                      \
+        FILE_DEVICE_UNKNOWN,                                                                       \
+        LOADER_DUMP_TRACE_CMD,                                                                     \
+        METHOD_BUFFERED,                                                                           \
+        FILE_READ_DATA | FILE_WRITE_DATA)
+
 #endif
@@ -43,7 +43,10 @@
 
 // clang-format on
 
+#include <dump_trace_args_t.hpp>
 #include <dump_vmm_args_t.hpp>
+#include <reload_vmm_args_t.hpp>
+#include <set_log_mask_args_t.hpp>
 #include <start_vmm_args_t.hpp>
 #include <stop_vmm_args_t.hpp>
 
@@ -80,6 +83,18 @@ namespace loader
     /// @brief defines IOCTL for dumping a VMs debug ring
     constexpr bsl::safe_umx DUMP_VMM{static_cast<bsl::uintmx>(
         CTL_CODE(FILE_DEVICE_UNKNOWN, DUMP_VMM_CMD.get(), METHOD_BUFFERED, FILE_READ_DATA | FILE_WRITE_DATA))};
+
+    /// @brief defines IOCTL for setting a VMs runtime log mask
+    constexpr bsl::safe_umx SET_LOG_MASK{static_cast<bsl::uintmx>(
+        CTL_CODE(FILE_DEVICE_UNKNOWN, SET_LOG_MASK_CMD.get(), METHOD_BUFFERED, FILE_READ_DATA))};
+
+    /// @brief defines IOCTL for reloading a VMs extensions
+    constexpr bsl::safe_umx RELOAD_VMM{static_cast<bsl::uintmx>(
+        CTL_CODE(FILE_DEVICE_UNKNOWN, RELOAD_VMM_CMD.get(), METHOD_BUFFERED, FILE_READ_DATA))};
+
+    /// @brief defines IOCTL for dumping a PP's trace ring
+    constexpr bsl::safe_umx DUMP_TRACE{static_cast<bsl::uintmx>(
+        CTL_CODE(FILE_DEVICE_UNKNOWN, DUMP_TRACE_CMD.get(), METHOD_BUFFERED, FILE_READ_DATA | FILE_WRITE_DATA))};
 }
 
 #endif
@@ -25,8 +25,14 @@ Environment:
 #include "queue.tmh"
 
 #include <debug.h>
+#include <dump_trace.h>
+#include <dump_trace_args_t.h>
 #include <dump_vmm.h>
 #include <dump_vmm_args_t.h>
+#include <reload_vmm.h>
+#include <reload_vmm_args_t.h>
+#include <set_log_mask.h>
+#include <set_log_mask_args_t.h>
 #include <start_vmm.h>
 #include <start_vmm_args_t.h>
 #include <stop_vmm.h>
@@ -183,6 +189,30 @@ Return Value:
             }
             break;
         }
+        case LOADER_SET_LOG_MASK: {
+            if (set_log_mask((struct set_log_mask_args_t const *)in)) {
+                bferror("set_log_mask failed");
+                WdfRequestComplete(Request, STATUS_UNSUCCESSFUL);
+                return;
+            }
+            break;
+        }
+        case LOADER_RELOAD_VMM: {
+            if (reload_vmm((struct reload_vmm_args_t const *)in)) {
+                bferror("reload_vmm failed");
+                WdfRequestComplete(Request, STATUS_UNSUCCESSFUL);
+                return;
+            }
+            break;
+        }
+        case LOADER_DUMP_TRACE: {
+            if (dump_trace((struct dump_trace_args_t *)out)) {
+                bferror("dump_trace failed");
+                WdfRequestComplete(Request, STATUS_UNSUCCESSFUL);
+                return;
+            }
+            break;
+        }
         default: {
             bferror_x64("invalid ioctl cmd", IoControlCode);
             WdfRequestComplete(Request, STATUS_ACCESS_DENIED);
@@ -74,6 +74,7 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
     if(HYPERVISOR_TARGET_ARCH STREQUAL "GenuineIntel")
         list(APPEND HEADERS
             ${CMAKE_CURRENT_LIST_DIR}/include/x64/intel/bf_reg_t.hpp
+            ${CMAKE_CURRENT_LIST_DIR}/src/x64/intel/bf_pml_t.hpp
         )
     endif()
 endif()
@@ -89,6 +90,9 @@ list(APPEND HEADERS
     ${CMAKE_CURRENT_LIST_DIR}/include/bf_types.hpp
     ${CMAKE_CURRENT_LIST_DIR}/src/bf_control_ops.hpp
     ${CMAKE_CURRENT_LIST_DIR}/src/bf_debug_ops.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/src/bf_dirty_bitmap_t.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/src/bf_guest_tlb_entry_t.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/src/bf_guest_walker_t.hpp
     ${CMAKE_CURRENT_LIST_DIR}/src/bf_syscall_impl.hpp
     ${CMAKE_CURRENT_LIST_DIR}/src/bf_syscall_t.hpp
 )
@@ -100,6 +104,7 @@ list(APPEND HEADERS
 if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STREQUAL "GenuineIntel")
     hypervisor_target_source(syscall src/x64/bf_callback_op_register_bootstrap_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_callback_op_register_fail_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_callback_op_register_tick_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_callback_op_register_vmexit_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_control_op_exit_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_control_op_wait_impl.S ${HEADERS})
@@ -107,11 +112,13 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_ext_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_huge_pool_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_page_pool_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_debug_op_dump_syscall_stats_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_vm_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_vmexit_log_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_vp_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_vs_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_out_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_debug_op_set_log_mask_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_write_c_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_write_str_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_handle_op_close_handle_impl.S ${HEADERS})
@@ -120,6 +127,8 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
     hypervisor_target_source(syscall src/x64/bf_intrinsic_op_wrmsr_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_mem_op_alloc_huge_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_mem_op_alloc_page_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_mem_op_free_huge_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_mem_op_free_page_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_extid_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_online_pps_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_ppid_impl.S ${HEADERS})
@@ -163,6 +172,8 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
     hypervisor_target_source(syscall src/x64/bf_vm_op_unmap_direct_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vm_op_unmap_direct_broadcast_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vm_op_tlb_flush_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_vm_op_map_direct_range_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_vm_op_unmap_direct_range_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vp_op_create_vp_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vp_op_destroy_vp_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vs_op_advance_ip_and_run_current_impl.S ${HEADERS})
@@ -171,6 +182,7 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
     hypervisor_target_source(syscall src/x64/bf_vs_op_clear_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vs_op_create_vs_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vs_op_destroy_vs_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_vs_op_drain_posted_events_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vs_op_init_as_root_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vs_op_migrate_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vs_op_promote_impl.S ${HEADERS})
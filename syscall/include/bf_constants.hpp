@@ -80,6 +80,37 @@ namespace syscall
     /// @brief Defines the root virtual machine ID
     constexpr auto BF_ROOT_VMID{0x0_u16};
 
+    // -------------------------------------------------------------------------
+    // Posted Events
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the posted event bit for an NMI
+    constexpr auto BF_POSTED_EVENT_NMI{0x0000000000000001_u64};
+
+    // -------------------------------------------------------------------------
+    // Log Masks
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the log level that disables a subsystem's messages
+    constexpr auto BF_LOG_LEVEL_OFF{0x0000000000000000_u64};
+    /// @brief Defines the log level that enables a subsystem's V messages
+    constexpr auto BF_LOG_LEVEL_V{0x0000000000000001_u64};
+    /// @brief Defines the log level that enables a subsystem's VV messages
+    constexpr auto BF_LOG_LEVEL_VV{0x0000000000000002_u64};
+    /// @brief Defines the log level that enables a subsystem's VVV messages
+    constexpr auto BF_LOG_LEVEL_VVV{0x0000000000000003_u64};
+    /// @brief Defines the bits in a log mask used by each subsystem
+    constexpr auto BF_LOG_LEVEL_MASK{0x000000000000000F_u64};
+
+    /// @brief Defines the shift of the page pool's level in a log mask
+    constexpr auto BF_LOG_SUBSYSTEM_PAGE_POOL{0x0000000000000000_u64};
+    /// @brief Defines the shift of the VS ops' level in a log mask
+    constexpr auto BF_LOG_SUBSYSTEM_VS{0x0000000000000004_u64};
+    /// @brief Defines the shift of the syscall dispatcher's level in a log mask
+    constexpr auto BF_LOG_SUBSYSTEM_SYSCALL{0x0000000000000008_u64};
+    /// @brief Defines the shift of the exception handlers' level in a log mask
+    constexpr auto BF_LOG_SUBSYSTEM_ESR{0x000000000000000C_u64};
+
     // -------------------------------------------------------------------------
     // Syscall Status Codes
     // -------------------------------------------------------------------------
@@ -407,6 +438,10 @@ namespace syscall
     constexpr auto BF_DEBUG_OP_DUMP_PAGE_POOL_IDX_VAL{0x0000000000000008_u64};
     /// @brief Defines the index for bf_debug_op_dump_huge_pool
     constexpr auto BF_DEBUG_OP_DUMP_HUGE_POOL_IDX_VAL{0x0000000000000009_u64};
+    /// @brief Defines the index for bf_debug_op_dump_syscall_stats
+    constexpr auto BF_DEBUG_OP_DUMP_SYSCALL_STATS_IDX_VAL{0x000000000000000A_u64};
+    /// @brief Defines the index for bf_debug_op_set_log_mask
+    constexpr auto BF_DEBUG_OP_SET_LOG_MASK_IDX_VAL{0x000000000000000B_u64};
 
     /// @brief Defines the index for bf_callback_op_register_bootstrap
     constexpr auto BF_CALLBACK_OP_REGISTER_BOOTSTRAP_IDX_VAL{0x0000000000000000_u64};
@@ -414,6 +449,8 @@ namespace syscall
     constexpr auto BF_CALLBACK_OP_REGISTER_VMEXIT_IDX_VAL{0x0000000000000001_u64};
     /// @brief Defines the index for bf_callback_op_register_fail
     constexpr auto BF_CALLBACK_OP_REGISTER_FAIL_IDX_VAL{0x0000000000000002_u64};
+    /// @brief Defines the index for bf_callback_op_register_tick
+    constexpr auto BF_CALLBACK_OP_REGISTER_TICK_IDX_VAL{0x0000000000000003_u64};
 
     /// @brief Defines the index for bf_vm_op_create_vm
     constexpr auto BF_VM_OP_CREATE_VM_IDX_VAL{0x0000000000000000_u64};
@@ -427,6 +464,10 @@ namespace syscall
     constexpr auto BF_VM_OP_UNMAP_DIRECT_BROADCAST_IDX_VAL{0x0000000000000004_u64};
     /// @brief Defines the index for bf_vm_op_tlb_flush
     constexpr auto BF_VM_OP_TLB_FLUSH_IDX_VAL{0x0000000000000005_u64};
+    /// @brief Defines the index for bf_vm_op_map_direct_range
+    constexpr auto BF_VM_OP_MAP_DIRECT_RANGE_IDX_VAL{0x0000000000000006_u64};
+    /// @brief Defines the index for bf_vm_op_unmap_direct_range
+    constexpr auto BF_VM_OP_UNMAP_DIRECT_RANGE_IDX_VAL{0x0000000000000007_u64};
 
     /// @brief Defines the index for bf_vp_op_create_vp
     constexpr auto BF_VP_OP_CREATE_VP_IDX_VAL{0x0000000000000000_u64};
@@ -463,6 +504,8 @@ namespace syscall
     constexpr auto BF_VS_OP_ADVANCE_IP_AND_SET_ACTIVE_IDX_VAL{0x000000000000000D_u64};
     /// @brief Defines the index for bf_vs_op_tlb_flush
     constexpr auto BF_VS_OP_TLB_FLUSH_IDX_VAL{0x000000000000000E_u64};
+    /// @brief Defines the index for bf_vs_op_drain_posted_events
+    constexpr auto BF_VS_OP_DRAIN_POSTED_EVENTS_IDX_VAL{0x000000000000000F_u64};
 
     /// @brief Defines the index for bf_intrinsic_op_rdmsr
     constexpr auto BF_INTRINSIC_OP_RDMSR_IDX_VAL{0x0000000000000000_u64};
@@ -471,8 +514,12 @@ namespace syscall
 
     /// @brief Defines the index for bf_mem_op_alloc_page
     constexpr auto BF_MEM_OP_ALLOC_PAGE_IDX_VAL{0x0000000000000000_u64};
+    /// @brief Defines the index for bf_mem_op_free_page
+    constexpr auto BF_MEM_OP_FREE_PAGE_IDX_VAL{0x0000000000000001_u64};
     /// @brief Defines the index for bf_mem_op_alloc_huge
     constexpr auto BF_MEM_OP_ALLOC_HUGE_IDX_VAL{0x0000000000000002_u64};
+    /// @brief Defines the index for bf_mem_op_free_huge
+    constexpr auto BF_MEM_OP_FREE_HUGE_IDX_VAL{0x0000000000000003_u64};
 }
 
 #endif
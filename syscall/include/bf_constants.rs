@@ -83,6 +83,37 @@ pub const BF_BS_PPID: bsl::SafeU16 = bsl::SafeU16::new(0x0);
 /// @brief Defines the root virtual machine ID
 pub const BF_ROOT_VMID: bsl::SafeU16 = bsl::SafeU16::new(0x0);
 
+// -----------------------------------------------------------------------------
+// Posted Events
+// -----------------------------------------------------------------------------
+
+/// @brief Defines the posted event bit for an NMI
+pub const BF_POSTED_EVENT_NMI: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000001);
+
+// -----------------------------------------------------------------------------
+// Log Masks
+// -----------------------------------------------------------------------------
+
+/// @brief Defines the log level that disables a subsystem's messages
+pub const BF_LOG_LEVEL_OFF: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000000);
+/// @brief Defines the log level that enables a subsystem's V messages
+pub const BF_LOG_LEVEL_V: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000001);
+/// @brief Defines the log level that enables a subsystem's VV messages
+pub const BF_LOG_LEVEL_VV: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000002);
+/// @brief Defines the log level that enables a subsystem's VVV messages
+pub const BF_LOG_LEVEL_VVV: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000003);
+/// @brief Defines the bits in a log mask used by each subsystem
+pub const BF_LOG_LEVEL_MASK: bsl::SafeU64 = bsl::SafeU64::new(0x000000000000000F);
+
+/// @brief Defines the shift of the page pool's level in a log mask
+pub const BF_LOG_SUBSYSTEM_PAGE_POOL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000000);
+/// @brief Defines the shift of the VS ops' level in a log mask
+pub const BF_LOG_SUBSYSTEM_VS: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000004);
+/// @brief Defines the shift of the syscall dispatcher's level in a log mask
+pub const BF_LOG_SUBSYSTEM_SYSCALL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000008);
+/// @brief Defines the shift of the exception handlers' level in a log mask
+pub const BF_LOG_SUBSYSTEM_ESR: bsl::SafeU64 = bsl::SafeU64::new(0x000000000000000C);
+
 // -----------------------------------------------------------------------------
 // Syscall Status Codes
 // -----------------------------------------------------------------------------
@@ -453,6 +484,11 @@ pub const BF_DEBUG_OP_DUMP_EXT_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x00000
 pub const BF_DEBUG_OP_DUMP_PAGE_POOL_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000008);
 /// @brief Defines the index for bf_debug_op_dump_huge_pool
 pub const BF_DEBUG_OP_DUMP_HUGE_POOL_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000009);
+/// @brief Defines the index for bf_debug_op_dump_syscall_stats
+pub const BF_DEBUG_OP_DUMP_SYSCALL_STATS_IDX_VAL: bsl::SafeU64 =
+    bsl::SafeU64::new(0x000000000000000A);
+/// @brief Defines the index for bf_debug_op_set_log_mask
+pub const BF_DEBUG_OP_SET_LOG_MASK_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x000000000000000B);
 
 /// @brief Defines the index for bf_callback_op_register_bootstrap
 pub const BF_CALLBACK_OP_REGISTER_BOOTSTRAP_IDX_VAL: bsl::SafeU64 =
@@ -463,6 +499,9 @@ pub const BF_CALLBACK_OP_REGISTER_VMEXIT_IDX_VAL: bsl::SafeU64 =
 /// @brief Defines the index for bf_callback_op_register_fail
 pub const BF_CALLBACK_OP_REGISTER_FAIL_IDX_VAL: bsl::SafeU64 =
     bsl::SafeU64::new(0x0000000000000002);
+/// @brief Defines the index for bf_callback_op_register_tick
+pub const BF_CALLBACK_OP_REGISTER_TICK_IDX_VAL: bsl::SafeU64 =
+    bsl::SafeU64::new(0x0000000000000003);
 
 /// @brief Defines the index for bf_vm_op_create_vm
 pub const BF_VM_OP_CREATE_VM_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000000);
@@ -477,6 +516,11 @@ pub const BF_VM_OP_UNMAP_DIRECT_BROADCAST_IDX_VAL: bsl::SafeU64 =
     bsl::SafeU64::new(0x0000000000000004);
 /// @brief Defines the index for bf_vm_op_tlb_flush
 pub const BF_VM_OP_TLB_FLUSH_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000005);
+/// @brief Defines the index for bf_vm_op_map_direct_range
+pub const BF_VM_OP_MAP_DIRECT_RANGE_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000006);
+/// @brief Defines the index for bf_vm_op_unmap_direct_range
+pub const BF_VM_OP_UNMAP_DIRECT_RANGE_IDX_VAL: bsl::SafeU64 =
+    bsl::SafeU64::new(0x0000000000000007);
 
 /// @brief Defines the index for bf_vp_op_create_vp
 pub const BF_VP_OP_CREATE_VP_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000000);
@@ -515,6 +559,9 @@ pub const BF_VS_OP_ADVANCE_IP_AND_SET_ACTIVE_IDX_VAL: bsl::SafeU64 =
     bsl::SafeU64::new(0x000000000000000D);
 /// @brief Defines the index for bf_vs_op_tlb_flush
 pub const BF_VS_OP_TLB_FLUSH_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x000000000000000E);
+/// @brief Defines the index for bf_vs_op_drain_posted_events
+pub const BF_VS_OP_DRAIN_POSTED_EVENTS_IDX_VAL: bsl::SafeU64 =
+    bsl::SafeU64::new(0x000000000000000F);
 
 /// @brief Defines the index for bf_intrinsic_op_rdmsr
 pub const BF_INTRINSIC_OP_RDMSR_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000000);
@@ -523,5 +570,9 @@ pub const BF_INTRINSIC_OP_WRMSR_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000
 
 /// @brief Defines the index for bf_mem_op_alloc_page
 pub const BF_MEM_OP_ALLOC_PAGE_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000000);
+/// @brief Defines the index for bf_mem_op_free_page
+pub const BF_MEM_OP_FREE_PAGE_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000001);
 /// @brief Defines the index for bf_mem_op_alloc_huge
 pub const BF_MEM_OP_ALLOC_HUGE_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000002);
+/// @brief Defines the index for bf_mem_op_free_huge
+pub const BF_MEM_OP_FREE_HUGE_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000003);
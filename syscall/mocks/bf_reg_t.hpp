@@ -31,7 +31,7 @@ namespace syscall
 {
     /// @brief stores the max value for a bf_reg_t
     // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
-    constexpr bsl::uint64 BF_MAX_REG_T{static_cast<bsl::uint64>(2)};
+    constexpr bsl::uint64 BF_MAX_REG_T{static_cast<bsl::uint64>(9)};
 
     /// <!-- description -->
     ///   @brief Defines which register to use for read/write
@@ -42,6 +42,20 @@ namespace syscall
         bf_reg_t_unsupported = static_cast<bsl::uint64>(0),
         /// @brief defines as dummy bf_reg_t
         bf_reg_t_dummy = static_cast<bsl::uint64>(1),
+        /// @brief defines the cr0 register
+        bf_reg_t_cr0 = static_cast<bsl::uint64>(2),
+        /// @brief defines the cr3 register
+        bf_reg_t_cr3 = static_cast<bsl::uint64>(3),
+        /// @brief defines the cr4 register
+        bf_reg_t_cr4 = static_cast<bsl::uint64>(4),
+        /// @brief defines the efer register
+        bf_reg_t_efer = static_cast<bsl::uint64>(5),
+        /// @brief defines the pml_index register
+        bf_reg_t_pml_index = static_cast<bsl::uint64>(6),
+        /// @brief defines the pml_address register
+        bf_reg_t_pml_address = static_cast<bsl::uint64>(7),
+        /// @brief defines the secondary_proc_based_vm_execution_ctls register
+        bf_reg_t_secondary_proc_based_vm_execution_ctls = static_cast<bsl::uint64>(8),
         /// @brief defines an invalid bf_reg_t
         bf_reg_t_invalid = static_cast<bsl::uint64>(BF_MAX_REG_T)
     };
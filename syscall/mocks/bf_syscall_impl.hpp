@@ -107,6 +107,10 @@ namespace syscall
     constinit inline bool g_mut_bf_debug_op_dump_page_pool_impl_executed{};
     /// @brief stores whether or not bf_debug_op_dump_huge_pool_impl was executed
     constinit inline bool g_mut_bf_debug_op_dump_huge_pool_impl_executed{};
+    /// @brief stores whether or not bf_debug_op_dump_syscall_stats_impl was executed
+    constinit inline bool g_mut_bf_debug_op_dump_syscall_stats_impl_executed{};
+    /// @brief stores whether or not bf_debug_op_set_log_mask_impl was executed
+    constinit inline bool g_mut_bf_debug_op_set_log_mask_impl_executed{};
 
     // -------------------------------------------------------------------------
     // Bootstrap Callback Handler Type
@@ -132,6 +136,14 @@ namespace syscall
     // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
     using bf_callback_handler_fail_t = void (*)(bsl::uint64, bsl::uint64);
 
+    // -------------------------------------------------------------------------
+    // Tick Callback Handler Type
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the signature of the tick callback handler
+    // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+    using bf_callback_handler_tick_t = void (*)(bsl::uint16);
+
     // -------------------------------------------------------------------------
     // dummy callbacks
     // -------------------------------------------------------------------------
@@ -181,6 +193,18 @@ namespace syscall
         bsl::discard(addr);
     }
 
+    /// <!-- description -->
+    ///   @brief Implements a dummy tick entry function.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param vsid the ID of the VS that was running when the tick fired
+    ///
+    extern "C" inline void
+    dummy_tick_entry(bsl::uint16 const vsid) noexcept
+    {
+        bsl::discard(vsid);
+    }
+
     // -------------------------------------------------------------------------
     // TLS ops
     // -------------------------------------------------------------------------
@@ -831,6 +855,34 @@ namespace syscall
         std::cout << "huge pool dump: mock empty\n";
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_dump_syscall_stats.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///
+    extern "C" inline void
+    bf_debug_op_dump_syscall_stats_impl(bsl::uint16 const reg0_in) noexcept
+    {
+        g_mut_bf_debug_op_dump_syscall_stats_impl_executed = true;
+        // NOLINTNEXTLINE(bsl-function-name-use)
+        std::cout << std::hex << "syscall stats for pp [0x" << reg0_in << "]: mock empty\n";
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_set_log_mask.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///
+    extern "C" inline void
+    bf_debug_op_set_log_mask_impl(bsl::uint64 const reg0_in) noexcept
+    {
+        g_mut_bf_debug_op_set_log_mask_impl_executed = true;
+        // NOLINTNEXTLINE(bsl-function-name-use)
+        std::cout << std::hex << "log mask: 0x" << reg0_in << '\n';
+    }
+
     // -------------------------------------------------------------------------
     // bf_callback_ops
     // -------------------------------------------------------------------------
@@ -892,6 +944,28 @@ namespace syscall
         return g_mut_errc.at("bf_callback_op_register_fail_impl").get();
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_callback_op_register_tick.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param pmut_reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_callback_op_register_tick_impl(
+        bsl::uint64 const reg0_in,
+        bf_callback_handler_tick_t const pmut_reg1_in,
+        bsl::uint64 const reg2_in) noexcept -> bsl::uint64
+    {
+        bsl::discard(reg0_in);
+        bsl::discard(pmut_reg1_in);
+        bsl::discard(reg2_in);
+
+        return g_mut_errc.at("bf_callback_op_register_tick_impl").get();
+    }
+
     // -------------------------------------------------------------------------
     // bf_vm_ops
     // -------------------------------------------------------------------------
@@ -1038,6 +1112,70 @@ namespace syscall
         return g_mut_errc.at("bf_vm_op_tlb_flush_impl").get();
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vm_op_map_direct_range.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @param pmut_reg0_out n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_vm_op_map_direct_range_impl(
+        bsl::uint64 const reg0_in,
+        bsl::uint16 const reg1_in,
+        bsl::uint64 const reg2_in,
+        bsl::uint64 const reg3_in,
+        void **const pmut_reg0_out) noexcept -> bsl::uint64
+    {
+        bsl::discard(reg0_in);
+        bsl::discard(reg1_in);
+        bsl::discard(reg2_in);
+        bsl::discard(reg3_in);
+        bsl::discard(pmut_reg0_out);
+
+        if (bsl::unlikely(nullptr == pmut_reg0_out)) {
+            return BF_STATUS_FAILURE_UNKNOWN.get();
+        }
+
+        if (g_mut_errc.at("bf_vm_op_map_direct_range_impl") == BF_STATUS_SUCCESS) {
+            *pmut_reg0_out = g_mut_ptrs.at("bf_vm_op_map_direct_range_impl_reg0_out");
+        }
+        else {
+            bsl::touch();
+        }
+
+        return g_mut_errc.at("bf_vm_op_map_direct_range_impl").get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vm_op_unmap_direct_range.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_vm_op_unmap_direct_range_impl(
+        bsl::uint64 const reg0_in,
+        bsl::uint16 const reg1_in,
+        bsl::uint64 const reg2_in,
+        bsl::uint64 const reg3_in) noexcept -> bsl::uint64
+    {
+        bsl::discard(reg0_in);
+        bsl::discard(reg1_in);
+        bsl::discard(reg2_in);
+        bsl::discard(reg3_in);
+
+        return g_mut_errc.at("bf_vm_op_unmap_direct_range_impl").get();
+    }
+
     // -------------------------------------------------------------------------
     // bf_vp_ops
     // -------------------------------------------------------------------------
@@ -1439,6 +1577,34 @@ namespace syscall
         return g_mut_errc.at("bf_vs_op_tlb_flush_impl").get();
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vs_op_drain_posted_events.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param pmut_reg0_out n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_vs_op_drain_posted_events_impl(
+        bsl::uint64 const reg0_in, bsl::uint64 *const pmut_reg0_out) noexcept -> bsl::uint64
+    {
+        bsl::discard(reg0_in);
+
+        if (bsl::unlikely(nullptr == pmut_reg0_out)) {
+            return BF_STATUS_FAILURE_UNKNOWN.get();
+        }
+
+        if (g_mut_errc.at("bf_vs_op_drain_posted_events_impl") == BF_STATUS_SUCCESS) {
+            *pmut_reg0_out = g_mut_data.at("bf_vs_op_drain_posted_events_impl_reg0_out").get();
+        }
+        else {
+            bsl::touch();
+        }
+
+        return g_mut_errc.at("bf_vs_op_drain_posted_events_impl").get();
+    }
+
     // -------------------------------------------------------------------------
     // bf_intrinsic_ops
     // -------------------------------------------------------------------------
@@ -1542,6 +1708,24 @@ namespace syscall
         return g_mut_errc.at("bf_mem_op_alloc_page_impl").get();
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_mem_op_free_page.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_mem_op_free_page_impl(bsl::uint64 const reg0_in, bsl::uint64 const reg1_in) noexcept
+        -> bsl::uint64
+    {
+        bsl::discard(reg0_in);
+        bsl::discard(reg1_in);
+
+        return g_mut_errc.at("bf_mem_op_free_page_impl").get();
+    }
+
     /// <!-- description -->
     ///   @brief Implements the ABI for bf_mem_op_alloc_huge.
     ///
@@ -1580,6 +1764,24 @@ namespace syscall
 
         return g_mut_errc.at("bf_mem_op_alloc_huge_impl").get();
     }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_mem_op_free_huge.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_mem_op_free_huge_impl(bsl::uint64 const reg0_in, bsl::uint64 const reg1_in) noexcept
+        -> bsl::uint64
+    {
+        bsl::discard(reg0_in);
+        bsl::discard(reg1_in);
+
+        return g_mut_errc.at("bf_mem_op_free_huge_impl").get();
+    }
 }
 
 #endif
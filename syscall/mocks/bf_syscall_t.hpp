@@ -35,6 +35,7 @@
 // IWYU pragma: no_include "bf_types.hpp"
 // IWYU pragma: no_include "bf_syscall_impl.hpp"
 
+#include <basic_page_4k_t.hpp>
 #include <tuple>
 
 #include <bsl/convert.hpp>
@@ -42,6 +43,7 @@
 #include <bsl/errc_type.hpp>
 #include <bsl/expects.hpp>
 #include <bsl/is_pod.hpp>
+#include <bsl/is_same.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/touch.hpp>
 #include <bsl/unordered_map.hpp>
@@ -60,6 +62,10 @@ namespace syscall
 
         /// @brief stores the results for initialize
         bsl::errc_type m_initialize{};
+        /// @brief stores the results for bf_callback_op_register_tick
+        bsl::errc_type m_bf_callback_op_register_tick{};
+        /// @brief stores the call count for bf_callback_op_register_tick
+        bsl::safe_umx m_bf_callback_op_register_tick_count{};
 
         /// @brief stores TLS data
         bsl::unordered_map<bsl::safe_u64, bsl::safe_u64> m_tls{};
@@ -76,6 +82,10 @@ namespace syscall
         bsl::unordered_map<bsl::safe_u16, bsl::errc_type> m_bf_vm_op_unmap_direct_broadcast{};
         /// @brief stores the results for bf_vm_op_tlb_flush
         bsl::unordered_map<bsl::safe_u16, bsl::errc_type> m_bf_vm_op_tlb_flush{};
+        /// @brief stores the results for bf_vm_op_map_direct_range
+        bsl::unordered_map<bsl::safe_u16, bsl::errc_type> m_bf_vm_op_map_direct_range{};
+        /// @brief stores the results for bf_vm_op_unmap_direct_range
+        bsl::unordered_map<bsl::safe_u16, bsl::errc_type> m_bf_vm_op_unmap_direct_range{};
         /// @brief stores the results for bf_vp_op_create_vp
         bsl::unordered_map<bsl::safe_u16, bsl::safe_u16> m_bf_vp_op_create_vp{};
         /// @brief stores the results for bf_vp_op_destroy_vp
@@ -110,14 +120,20 @@ namespace syscall
         bsl::unordered_map<std::tuple<bsl::safe_u16, bsl::safe_u16, bsl::safe_u16>, bsl::errc_type> m_bf_vs_op_advance_ip_and_set_active{};
         /// @brief stores the results for bf_vs_op_tlb_flush
         bsl::unordered_map<std::tuple<bsl::safe_u16, bsl::safe_u64>, bsl::errc_type> m_bf_vs_op_tlb_flush{};
+        /// @brief stores the results for bf_vs_op_drain_posted_events
+        bsl::safe_u64 m_bf_vs_op_drain_posted_events{};
         /// @brief stores the results for bf_intrinsic_op_rdmsr
         bsl::unordered_map<bsl::safe_u32, bsl::safe_u64> m_bf_intrinsic_op_rdmsr{};
         /// @brief stores the results for bf_intrinsic_op_wrmsr
         bsl::unordered_map<std::tuple<bsl::safe_u32, bsl::safe_u64>, bsl::errc_type> m_bf_intrinsic_op_wrmsr{};
         /// @brief stores the results for bf_mem_op_alloc_page
         bsl::errc_type m_bf_mem_op_alloc_page{};
+        /// @brief stores the results for bf_mem_op_free_page
+        bsl::errc_type m_bf_mem_op_free_page{};
         /// @brief stores the results for bf_mem_op_alloc_huge
         bsl::errc_type m_bf_mem_op_alloc_huge{};
+        /// @brief stores the results for bf_mem_op_free_huge
+        bsl::errc_type m_bf_mem_op_free_huge{};
 
         /// @brief stores the call count for initialize
         bsl::safe_umx m_initialize_count{};
@@ -165,6 +181,10 @@ namespace syscall
         bsl::safe_umx m_bf_vm_op_unmap_direct_broadcast_count{};
         /// @brief stores the call count for bf_vm_op_tlb_flush
         bsl::safe_umx m_bf_vm_op_tlb_flush_count{};
+        /// @brief stores the call count for bf_vm_op_map_direct_range
+        bsl::safe_umx m_bf_vm_op_map_direct_range_count{};
+        /// @brief stores the call count for bf_vm_op_unmap_direct_range
+        bsl::safe_umx m_bf_vm_op_unmap_direct_range_count{};
         /// @brief stores the call count for bf_vp_op_create_vp
         bsl::safe_umx m_bf_vp_op_create_vp_count{};
         /// @brief stores the call count for bf_vp_op_destroy_vp
@@ -199,20 +219,28 @@ namespace syscall
         bsl::safe_umx m_bf_vs_op_advance_ip_and_set_active_count{};
         /// @brief stores the call count for bf_vs_op_tlb_flush
         bsl::safe_umx m_bf_vs_op_tlb_flush_count{};
+        /// @brief stores the call count for bf_vs_op_drain_posted_events
+        bsl::safe_umx m_bf_vs_op_drain_posted_events_count{};
         /// @brief stores the call count for bf_intrinsic_op_rdmsr
         bsl::safe_umx m_bf_intrinsic_op_rdmsr_count{};
         /// @brief stores the call count for bf_intrinsic_op_wrmsr
         bsl::safe_umx m_bf_intrinsic_op_wrmsr_count{};
         /// @brief stores the call count for bf_mem_op_alloc_page
         bsl::safe_umx m_bf_mem_op_alloc_page_count{};
+        /// @brief stores the call count for bf_mem_op_free_page
+        bsl::safe_umx m_bf_mem_op_free_page_count{};
         /// @brief stores the call count for bf_mem_op_alloc_huge
         bsl::safe_umx m_bf_mem_op_alloc_huge_count{};
+        /// @brief stores the call count for bf_mem_op_free_huge
+        bsl::safe_umx m_bf_mem_op_free_huge_count{};
 
 
         /// @brief stores the direct map with a phys to virt relationship
         bsl::unordered_map<std::tuple<bsl::safe_u16, bsl::safe_u64>, void *> m_direct_map_phys_to_virt{};
         /// @brief stores the direct map with a virt to phys relationship
         bsl::unordered_map<std::tuple<bsl::safe_u16, void *>, bsl::safe_u64> m_direct_map_virt_to_phys{};
+        /// @brief stores the contents of the memory mapped using bf_vm_op_map_direct
+        bsl::unordered_map<std::tuple<bsl::safe_u16, bsl::safe_u64>, lib::basic_page_4k_t> m_direct_map_data{};
 
         /// @brief stores the alloc page with a phys to virt relationship
         bsl::unordered_map<bsl::safe_u64, void *> m_alloc_page_phys_to_virt{};
@@ -315,6 +343,57 @@ namespace syscall
             return m_release_count.checked();
         }
 
+        /// <!-- description -->
+        ///   @brief Registers a tick handler that the microkernel will call
+        ///     on each PP roughly once every "period" TSC ticks.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_tick_handler the tick handler to register
+        ///   @param period the number of TSC ticks between each tick
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_callback_op_register_tick(
+            bf_callback_handler_tick_t const pmut_tick_handler,
+            bsl::safe_u64 const &period) noexcept -> bsl::errc_type
+        {
+            bsl::expects(nullptr != pmut_tick_handler);
+            bsl::expects(period.is_valid_and_checked());
+            bsl::expects(period.is_pos());
+
+            ++m_bf_callback_op_register_tick_count;
+            return m_bf_callback_op_register_tick;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the return value of bf_callback_op_register_tick.
+        ///     (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param errc the bsl::errc_type to return when executing
+        ///     bf_callback_op_register_tick
+        ///
+        constexpr void
+        set_bf_callback_op_register_tick(bsl::errc_type const &errc) noexcept
+        {
+            m_bf_callback_op_register_tick = errc;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of times
+        ///     bf_callback_op_register_tick has been called (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of times
+        ///     bf_callback_op_register_tick has been called
+        ///
+        [[nodiscard]] constexpr auto
+        bf_callback_op_register_tick_count() const noexcept -> bsl::safe_umx
+        {
+            return m_bf_callback_op_register_tick_count.checked();
+        }
+
         // ---------------------------------------------------------------------
         // TLS ops
         // ---------------------------------------------------------------------
@@ -1288,6 +1367,15 @@ namespace syscall
             m_direct_map_phys_to_virt.at({vmid, phys}) = pmut_virt;
             m_direct_map_virt_to_phys.at({vmid, pmut_virt}) = phys;
 
+            if constexpr (bsl::is_same<T, lib::basic_page_4k_t>::value) {
+                if (m_direct_map_data.contains({vmid, phys})) {
+                    *pmut_virt = m_direct_map_data.at({vmid, phys});
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
             return pmut_virt;
         }
 
@@ -1321,6 +1409,66 @@ namespace syscall
             return m_bf_vm_op_map_direct_count.checked();
         }
 
+        /// <!-- description -->
+        ///   @brief Sets the 64bit value stored at the provided physical
+        ///     address. Any lib::basic_page_4k_t mapped at this physical
+        ///     address using bf_vm_op_map_direct will contain this value, and
+        ///     anything written to the page is stored back when the page is
+        ///     unmapped. (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid The ID of the VM the physical address is mapped to
+        ///   @param phys The physical address to write to. Must be 8 byte
+        ///     aligned.
+        ///   @param val the value to store at phys
+        ///
+        constexpr void
+        set_direct_map_data(
+            bsl::safe_u16 const &vmid, bsl::safe_u64 const &phys, bsl::safe_u64 const &val) noexcept
+        {
+            constexpr auto bits_per_byte{8_u64};
+            constexpr auto bytes_per_u64{8_umx};
+            auto const page{bf_page_aligned(phys)};
+            auto *const pmut_page{&m_direct_map_data.at({vmid, page})};
+
+            auto mut_val{val};
+            for (bsl::safe_idx mut_i{}; mut_i < bytes_per_u64; ++mut_i) {
+                auto const offs{bsl::to_idx((phys - page + bsl::to_u64(mut_i)).checked())};
+                *pmut_page->data.at_if(offs) = bsl::to_u8_unsafe(mut_val).get();
+                mut_val >>= bits_per_byte;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the 64bit value stored at the provided physical
+        ///     address. (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid The ID of the VM the physical address is mapped to
+        ///   @param phys The physical address to read from. Must be 8 byte
+        ///     aligned.
+        ///   @return Returns the 64bit value stored at the provided physical
+        ///     address.
+        ///
+        [[nodiscard]] constexpr auto
+        direct_map_data(bsl::safe_u16 const &vmid, bsl::safe_u64 const &phys) const noexcept
+            -> bsl::safe_u64
+        {
+            constexpr auto bits_per_byte{8_u64};
+            constexpr auto bytes_per_u64{8_umx};
+            auto const page{bf_page_aligned(phys)};
+            auto const &data{m_direct_map_data.at({vmid, page}).data};
+
+            bsl::safe_u64 mut_val{};
+            for (bsl::safe_idx mut_i{}; mut_i < bytes_per_u64; ++mut_i) {
+                auto const offs{bsl::to_idx((phys - page + bsl::to_u64(mut_i)).checked())};
+                auto const byte{bsl::to_u64(*data.at_if(offs))};
+                mut_val |= byte << (bsl::to_u64(mut_i) * bits_per_byte).checked();
+            }
+
+            return mut_val;
+        }
+
         /// <!-- description -->
         ///   @brief This syscall tells the microkernel to unmap a previously
         ///     mapped virtual address in the direct map. Unlike
@@ -1366,6 +1514,10 @@ namespace syscall
                 return m_bf_vm_op_unmap_direct.at(vmid);
             }
 
+            if constexpr (bsl::is_same<T, lib::basic_page_4k_t>::value) {
+                m_direct_map_data.at({vmid, phys}) = *pmut_virt;
+            }
+
             // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
             delete pmut_virt;    // GRCOV_EXCLUDE_BR
             bsl::discard(m_direct_map_phys_to_virt.erase({vmid, phys}));
@@ -1442,6 +1594,10 @@ namespace syscall
                 return m_bf_vm_op_unmap_direct_broadcast.at(vmid);
             }
 
+            if constexpr (bsl::is_same<T, lib::basic_page_4k_t>::value) {
+                m_direct_map_data.at({vmid, phys}) = *pmut_virt;
+            }
+
             // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
             delete pmut_virt;    // GRCOV_EXCLUDE_BR
             bsl::discard(m_direct_map_phys_to_virt.erase({vmid, phys}));
@@ -1529,6 +1685,173 @@ namespace syscall
             return m_bf_vm_op_tlb_flush_count.checked();
         }
 
+        /// <!-- description -->
+        ///   @brief This syscall tells the microkernel to map a physically
+        ///     contiguous range into the VM's direct map using a single
+        ///     syscall. Unlike bf_vm_op_map_direct, the microkernel will use
+        ///     2M and 1G pages wherever the alignment of the range allows,
+        ///     which reduces both the number of syscalls and the TLB
+        ///     pressure needed to access large buffers.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to return. Must be a POD type.
+        ///   @param vmid The ID of the VM to map the physical range to
+        ///   @param phys The physical address of the start of the range
+        ///   @param bytes The total number of bytes to map. Must be page
+        ///     aligned.
+        ///   @return Returns a pointer to the start of the map on success,
+        ///     returns a nullptr on failure.
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        bf_vm_op_map_direct_range(
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u64 const &phys,
+            bsl::safe_u64 const &bytes) noexcept -> T *
+        {
+            /// NOTE:
+            /// - Like bf_vm_op_map_direct, only a single T is allocated to
+            ///   represent the start of the range. Unit tests should not
+            ///   access anything past the first T.
+            ///
+
+            bsl::expects(vmid.is_valid_and_checked());
+            bsl::expects(vmid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vmid) < HYPERVISOR_MAX_VMS);
+            bsl::expects(phys.is_valid_and_checked());
+            bsl::expects(phys.is_pos());
+            bsl::expects(bf_is_page_aligned(phys));
+            bsl::expects(bytes.is_valid_and_checked());
+            bsl::expects(bytes.is_pos());
+            bsl::expects(bf_is_page_aligned(bytes));
+            bsl::expects((phys + bytes).checked() <= HYPERVISOR_EXT_DIRECT_MAP_SIZE);
+            bsl::expects(!m_direct_map_phys_to_virt.contains({vmid, phys}));
+
+            static_assert(bsl::is_pod<T>::value);
+
+            ++m_bf_vm_op_map_direct_range_count;
+            if (!m_bf_vm_op_map_direct_range.at(vmid)) {
+                return nullptr;
+            }
+
+            auto *const pmut_virt{new T()};
+            m_direct_map_phys_to_virt.at({vmid, phys}) = pmut_virt;
+            m_direct_map_virt_to_phys.at({vmid, pmut_virt}) = phys;
+
+            return pmut_virt;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the return value of bf_vm_op_map_direct_range.
+        ///     (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid The ID of the VM to map the physical range to
+        ///   @param errc if set to any "failure" error code,
+        ///     bf_vm_op_map_direct_range will return a nullptr. Otherwise,
+        ///     the use of this function is ignored.
+        ///
+        constexpr void
+        set_bf_vm_op_map_direct_range(
+            bsl::safe_u16 const &vmid, bsl::errc_type const errc) noexcept
+        {
+            m_bf_vm_op_map_direct_range.at(vmid) = errc;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of times bf_vm_op_map_direct_range
+        ///     has been called (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of times bf_vm_op_map_direct_range
+        ///     has been called
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vm_op_map_direct_range_count() const noexcept -> bsl::safe_umx
+        {
+            return m_bf_vm_op_map_direct_range_count.checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief This syscall tells the microkernel to unmap a range that
+        ///     was previously mapped using bf_vm_op_map_direct_range. The
+        ///     provided pointer and size must match the pointer returned by
+        ///     and the size given to bf_vm_op_map_direct_range. Like
+        ///     bf_vm_op_unmap_direct, the TLB is only flushed on the PP this
+        ///     syscall is executed on.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to unmap. Must be a POD type.
+        ///   @param vmid The ID of the VM to unmap the range from
+        ///   @param pmut_virt The virtual address of the start of the range
+        ///   @param bytes The total number of bytes to unmap. Must be page
+        ///     aligned.
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        bf_vm_op_unmap_direct_range(
+            bsl::safe_u16 const &vmid, T *const pmut_virt, bsl::safe_u64 const &bytes) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(vmid.is_valid_and_checked());
+            bsl::expects(vmid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vmid) < HYPERVISOR_MAX_VMS);
+            bsl::expects(nullptr != pmut_virt);
+            bsl::expects(bytes.is_valid_and_checked());
+            bsl::expects(bytes.is_pos());
+            bsl::expects(bf_is_page_aligned(bytes));
+
+            auto const phys{m_direct_map_virt_to_phys.at({vmid, pmut_virt})};
+            bsl::expects(phys.is_valid_and_checked());
+            bsl::expects(phys.is_pos());
+
+            static_assert(bsl::is_pod<T>::value);
+
+            ++m_bf_vm_op_unmap_direct_range_count;
+            if (!m_bf_vm_op_unmap_direct_range.at(vmid)) {
+                return m_bf_vm_op_unmap_direct_range.at(vmid);
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+            delete pmut_virt;    // GRCOV_EXCLUDE_BR
+            bsl::discard(m_direct_map_phys_to_virt.erase({vmid, phys}));
+            bsl::discard(m_direct_map_virt_to_phys.erase({vmid, pmut_virt}));
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the return value of bf_vm_op_unmap_direct_range.
+        ///     (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid The ID of the VM to unmap the range from
+        ///   @param errc the bsl::errc_type to return when executing
+        ///     bf_vm_op_unmap_direct_range
+        ///
+        constexpr void
+        set_bf_vm_op_unmap_direct_range(
+            bsl::safe_u16 const &vmid, bsl::errc_type const errc) noexcept
+        {
+            m_bf_vm_op_unmap_direct_range.at(vmid) = errc;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of times bf_vm_op_unmap_direct_range
+        ///     has been called (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of times bf_vm_op_unmap_direct_range
+        ///     has been called
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vm_op_unmap_direct_range_count() const noexcept -> bsl::safe_umx
+        {
+            return m_bf_vm_op_unmap_direct_range_count.checked();
+        }
+
         // ---------------------------------------------------------------------
         // bf_vp_ops
         // ---------------------------------------------------------------------
@@ -2457,6 +2780,63 @@ namespace syscall
             return m_bf_vs_op_tlb_flush_count.checked();
         }
 
+        /// <!-- description -->
+        ///   @brief Drains the events that the microkernel posted to the PP
+        ///     that this is executed on while the extension was executing
+        ///     (e.g., NMIs), allowing the extension to handle all of them
+        ///     in the same invocation instead of taking a VMExit for each.
+        ///     Any event returned is owned by the extension, meaning the
+        ///     microkernel will no longer deliver it on its own.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a mask of the BF_POSTED_EVENT bits that were
+        ///     drained (0 if nothing was posted), or
+        ///     bsl::safe_u64::failure() on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vs_op_drain_posted_events() noexcept -> bsl::safe_u64
+        {
+            ++m_bf_vs_op_drain_posted_events_count;
+
+            auto const events{m_bf_vs_op_drain_posted_events};
+            if (events.is_valid()) {
+                m_bf_vs_op_drain_posted_events = {};
+            }
+            else {
+                bsl::touch();
+            }
+
+            return events;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the events returned by the next call to
+        ///     bf_vs_op_drain_posted_events. (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param events the mask of BF_POSTED_EVENT bits to return
+        ///     when executing bf_vs_op_drain_posted_events
+        ///
+        constexpr void
+        set_bf_vs_op_drain_posted_events(bsl::safe_u64 const &events) noexcept
+        {
+            m_bf_vs_op_drain_posted_events = events;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of times
+        ///     bf_vs_op_drain_posted_events has been called (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of times
+        ///     bf_vs_op_drain_posted_events has been called
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vs_op_drain_posted_events_count() const noexcept -> bsl::safe_umx
+        {
+            return m_bf_vs_op_drain_posted_events_count.checked();
+        }
+
         // ---------------------------------------------------------------------
         // bf_intrinsic_ops
         // ---------------------------------------------------------------------
@@ -2646,6 +3026,92 @@ namespace syscall
             return m_bf_mem_op_alloc_page_count.checked();
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the virtual address of a page that was
+        ///     allocated using bf_mem_op_alloc_page, given the physical
+        ///     address that bf_mem_op_alloc_page returned. This is how a
+        ///     test plays the role of hardware that is given the physical
+        ///     address of a page (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to return
+        ///   @param phys the physical address returned by
+        ///     bf_mem_op_alloc_page
+        ///   @return Returns the virtual address of the page, or a nullptr
+        ///     if no page was allocated at the provided address.
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        alloc_page_virt(bsl::safe_u64 const &phys) noexcept -> T *
+        {
+            return static_cast<T *>(m_alloc_page_phys_to_virt.at(phys));
+        }
+
+        /// <!-- description -->
+        ///   @brief bf_mem_op_free_page frees memory previously allocated
+        ///     by bf_mem_op_alloc_page.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to free.
+        ///   @param pmut_virt The virtual address returned by
+        ///     bf_mem_op_alloc_page
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        bf_mem_op_free_page(T *const pmut_virt) noexcept -> bsl::errc_type
+        {
+            bsl::expects(nullptr != pmut_virt);
+
+            auto const phys{m_alloc_page_virt_to_phys.at(pmut_virt)};
+            bsl::expects(phys.is_valid_and_checked());
+            bsl::expects(phys.is_pos());
+
+            static_assert(bsl::is_pod<T>::value);
+            static_assert(sizeof(T) <= HYPERVISOR_PAGE_SIZE);
+
+            ++m_bf_mem_op_free_page_count;
+            if (!m_bf_mem_op_free_page) {
+                return m_bf_mem_op_free_page;
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+            delete pmut_virt;    // GRCOV_EXCLUDE_BR
+            bsl::discard(m_alloc_page_phys_to_virt.erase(phys));
+            bsl::discard(m_alloc_page_virt_to_phys.erase(pmut_virt));
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the return value of bf_mem_op_free_page.
+        ///     (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param errc the bsl::errc_type to return when executing
+        ///     bf_mem_op_free_page
+        ///
+        constexpr void
+        set_bf_mem_op_free_page(bsl::errc_type const errc) noexcept
+        {
+            m_bf_mem_op_free_page = errc;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of times bf_mem_op_free_page
+        ///     has been called (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of times bf_mem_op_free_page
+        ///     has been called
+        ///
+        [[nodiscard]] constexpr auto
+        bf_mem_op_free_page_count() const noexcept -> bsl::safe_umx
+        {
+            return m_bf_mem_op_free_page_count.checked();
+        }
+
         /// <!-- description -->
         ///   @brief bf_mem_op_alloc_huge allocates a physically contiguous block
         ///     of memory. When allocating a page, the extension should keep in
@@ -2775,6 +3241,71 @@ namespace syscall
         {
             return m_bf_mem_op_alloc_huge_count.checked();
         }
+
+        /// <!-- description -->
+        ///   @brief bf_mem_op_free_huge frees memory previously allocated
+        ///     by bf_mem_op_alloc_huge.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to free.
+        ///   @param pmut_virt The virtual address returned by
+        ///     bf_mem_op_alloc_huge
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        bf_mem_op_free_huge(T *const pmut_virt) noexcept -> bsl::errc_type
+        {
+            bsl::expects(nullptr != pmut_virt);
+
+            auto const phys{m_alloc_huge_virt_to_phys.at(pmut_virt)};
+            bsl::expects(phys.is_valid_and_checked());
+            bsl::expects(phys.is_pos());
+
+            static_assert(bsl::is_pod<T>::value);
+            static_assert(sizeof(T) <= HYPERVISOR_PAGE_SIZE);
+
+            ++m_bf_mem_op_free_huge_count;
+            if (!m_bf_mem_op_free_huge) {
+                return m_bf_mem_op_free_huge;
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+            delete[] pmut_virt;    // GRCOV_EXCLUDE_BR
+            bsl::discard(m_alloc_huge_phys_to_virt.erase(phys));
+            bsl::discard(m_alloc_huge_virt_to_phys.erase(pmut_virt));
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the return value of bf_mem_op_free_huge.
+        ///     (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param errc the bsl::errc_type to return when executing
+        ///     bf_mem_op_free_huge
+        ///
+        constexpr void
+        set_bf_mem_op_free_huge(bsl::errc_type const errc) noexcept
+        {
+            m_bf_mem_op_free_huge = errc;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of times bf_mem_op_free_huge
+        ///     has been called (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of times bf_mem_op_free_huge
+        ///     has been called
+        ///
+        [[nodiscard]] constexpr auto
+        bf_mem_op_free_huge_count() const noexcept -> bsl::safe_umx
+        {
+            return m_bf_mem_op_free_huge_count.checked();
+        }
     };
 }
 
@@ -222,6 +222,50 @@ namespace syscall
 
         bf_debug_op_dump_huge_pool_impl();
     }
+
+    /// <!-- description -->
+    ///   @brief This syscall tells the microkernel to output the syscall
+    ///     stats of a specific physical processor. This includes the number
+    ///     of times each syscall was made, how often it failed, its average
+    ///     and max latency, a per-opcode latency histogram and a trace of
+    ///     the most recent syscalls. Requires HYPERVISOR_SYSCALL_STATS.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ppid The PPID of the PP to dump the syscall stats from
+    ///
+    constexpr void
+    bf_debug_op_dump_syscall_stats(bsl::safe_u16 const &ppid) noexcept
+    {
+        bsl::expects(ppid.is_valid_and_checked());
+
+        if (bsl::is_constant_evaluated()) {
+            return;
+        }
+
+        bf_debug_op_dump_syscall_stats_impl(ppid.get());
+    }
+
+    /// <!-- description -->
+    ///   @brief This syscall sets the microkernel's runtime log mask. The
+    ///     log mask stores a log level for each of the microkernel's
+    ///     subsystems (see BF_LOG_SUBSYSTEM_xxx and BF_LOG_LEVEL_xxx). The
+    ///     new log mask is used by all PPs, and each PP picks it up on its
+    ///     next VMExit.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mask The new log mask to use
+    ///
+    constexpr void
+    bf_debug_op_set_log_mask(bsl::safe_u64 const &mask) noexcept
+    {
+        bsl::expects(mask.is_valid_and_checked());
+
+        if (bsl::is_constant_evaluated()) {
+            return;
+        }
+
+        bf_debug_op_set_log_mask_impl(mask.get());
+    }
 }
 
 #endif
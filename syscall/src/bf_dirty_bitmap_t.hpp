@@ -0,0 +1,300 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BF_DIRTY_BITMAP_T_HPP
+#define BF_DIRTY_BITMAP_T_HPP
+
+#include <basic_page_4k_t.hpp>
+#include <bf_syscall_t.hpp>    // IWYU pragma: export
+// IWYU pragma: no_include "bf_syscall_t.hpp"
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace syscall
+{
+    /// @brief defines the number of guest pages tracked by each byte of the bitmap
+    constexpr auto BF_DIRTY_BITMAP_BITS_PER_BYTE{8_u64};
+    /// @brief defines the number of guest pages tracked by each page of the bitmap
+    constexpr auto BF_DIRTY_BITMAP_PAGES_PER_LEAF{
+        (bsl::to_u64(HYPERVISOR_PAGE_SIZE) * BF_DIRTY_BITMAP_BITS_PER_BYTE).checked()};
+    /// @brief defines the first guest physical address the bitmap cannot track (512G)
+    constexpr auto BF_DIRTY_BITMAP_MAX_GPA{0x0000008000000000_u64};
+    /// @brief defines the max number of pages the bitmap is made of
+    constexpr auto BF_DIRTY_BITMAP_MAX_LEAVES{
+        ((BF_DIRTY_BITMAP_MAX_GPA >> lib::BASIC_PAGE_4K_T_SHFT) / BF_DIRTY_BITMAP_PAGES_PER_LEAF)
+            .checked()};
+
+    /// <!-- description -->
+    ///   @brief Stores which pages of a VM's guest physical memory are
+    ///     dirty, using one bit per 4k page. The bitmap is split into
+    ///     pages that are allocated using bf_mem_op_alloc_page the first
+    ///     time one of the guest pages they track is marked, so a VM that
+    ///     only writes to a small part of its memory only costs a few
+    ///     pages, no matter how much memory it has. Both PML (see
+    ///     bf_pml_t) and a walk of the dirty flags in the second level
+    ///     page tables can be drained into the same bitmap, which is what
+    ///     lets an extension use the same code for Intel and AMD.
+    ///
+    /// <!-- notes -->
+    ///   @note The bitmap does not have a lock. mark() allocates leaves and
+    ///     updates bytes that are shared by 8 guest pages, so calls that
+    ///     modify the bitmap (mark(), clear() and release()) must be
+    ///     serialized by the caller, and must not overlap with calls that
+    ///     read it. An extension that drains PML buffers on more than one
+    ///     PP either gives each PP its own bitmap and merges them, or
+    ///     drains them while holding its own lock.
+    ///
+    class bf_dirty_bitmap_t final
+    {
+        /// @brief stores the pages that make up the bitmap
+        bsl::array<lib::basic_page_4k_t *, BF_DIRTY_BITMAP_MAX_LEAVES.get()> m_leaves{};
+        /// @brief stores the number of guest pages that are dirty
+        bsl::safe_u64 m_dirty_pages{};
+
+        /// <!-- description -->
+        ///   @brief Returns the byte of the bitmap that tracks the provided
+        ///     guest page frame, or a nullptr if that part of the bitmap
+        ///     was never allocated.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gfn the guest page frame number to look up
+        ///   @return Returns the byte of the bitmap that tracks the
+        ///     provided guest page frame, or a nullptr.
+        ///
+        [[nodiscard]] constexpr auto
+        byte(bsl::safe_u64 const &gfn) const noexcept -> bsl::uint8 *
+        {
+            auto const idx{bsl::to_idx(gfn / BF_DIRTY_BITMAP_PAGES_PER_LEAF)};
+            auto *const pmut_leaf{*m_leaves.at_if(idx)};
+            if (nullptr == pmut_leaf) {
+                return nullptr;
+            }
+
+            auto const bit{gfn % BF_DIRTY_BITMAP_PAGES_PER_LEAF};
+            return pmut_leaf->data.at_if(bsl::to_idx(bit / BF_DIRTY_BITMAP_BITS_PER_BYTE));
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Releases all of the pages that make up the bitmap.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///
+        constexpr void
+        release(bf_syscall_t &mut_sys) noexcept
+        {
+            for (auto &mut_leaf : m_leaves) {
+                if (nullptr != mut_leaf) {
+                    bsl::discard(mut_sys.bf_mem_op_free_page(mut_leaf));
+                    mut_leaf = nullptr;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            m_dirty_pages = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks every 4k guest page in the provided range as
+        ///     dirty, allocating the parts of the bitmap that track them
+        ///     if needed. This must not be called on more than one PP at
+        ///     the same time (see the notes on bf_dirty_bitmap_t).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param gpa the guest physical address of the range
+        ///   @param bytes the number of bytes in the range
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        mark(bf_syscall_t &mut_sys, bsl::safe_u64 const &gpa, bsl::safe_u64 const &bytes) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(gpa.is_valid_and_checked());
+            bsl::expects(bytes.is_valid_and_checked());
+
+            auto const end{(gpa + bytes).checked()};
+            if (bsl::unlikely(end > BF_DIRTY_BITMAP_MAX_GPA)) {
+                bsl::error() << "guest physical address "    // --
+                             << bsl::hex(end)                // --
+                             << " cannot be tracked"         // --
+                             << bsl::endl                    // --
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            auto const first{gpa >> lib::BASIC_PAGE_4K_T_SHFT};
+            auto const round{(end + lib::BASIC_PAGE_4K_T_MASK).checked()};
+            auto const last{round >> lib::BASIC_PAGE_4K_T_SHFT};
+
+            for (auto mut_gfn{first}; mut_gfn < last; ++mut_gfn) {
+                auto *pmut_mut_byte{this->byte(mut_gfn)};
+                if (nullptr == pmut_mut_byte) {
+                    auto const idx{bsl::to_idx(mut_gfn / BF_DIRTY_BITMAP_PAGES_PER_LEAF)};
+                    auto *const pmut_leaf{mut_sys.bf_mem_op_alloc_page<lib::basic_page_4k_t>()};
+                    if (bsl::unlikely(nullptr == pmut_leaf)) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::errc_failure;
+                    }
+
+                    *m_leaves.at_if(idx) = pmut_leaf;
+                    pmut_mut_byte = this->byte(mut_gfn);
+                }
+                else {
+                    bsl::touch();
+                }
+
+                auto const shft{mut_gfn % BF_DIRTY_BITMAP_BITS_PER_BYTE};
+                auto const bit{bsl::to_u8(bsl::safe_u64::magic_1() << shft)};
+                auto const val{bsl::to_u8(*pmut_mut_byte)};
+                if ((val & bit).is_zero()) {
+                    *pmut_mut_byte = (val | bit).get();
+                    ++m_dirty_pages;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the 4k guest page that the provided
+        ///     guest physical address is part of is dirty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gpa the guest physical address to query
+        ///   @return Returns true if the 4k guest page that the provided
+        ///     guest physical address is part of is dirty.
+        ///
+        [[nodiscard]] constexpr auto
+        is_dirty(bsl::safe_u64 const &gpa) const noexcept -> bool
+        {
+            bsl::expects(gpa.is_valid_and_checked());
+
+            if (gpa >= BF_DIRTY_BITMAP_MAX_GPA) {
+                return false;
+            }
+
+            auto const gfn{gpa >> lib::BASIC_PAGE_4K_T_SHFT};
+            auto const *const byte{this->byte(gfn)};
+            if (nullptr == byte) {
+                return false;
+            }
+
+            auto const bit{bsl::safe_u64::magic_1() << (gfn % BF_DIRTY_BITMAP_BITS_PER_BYTE)};
+            return (bsl::to_u64(*byte) & bit).is_pos();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of 4k guest pages that are dirty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of 4k guest pages that are dirty.
+        ///
+        [[nodiscard]] constexpr auto
+        dirty_pages() const noexcept -> bsl::safe_u64
+        {
+            return m_dirty_pages;
+        }
+
+        /// <!-- description -->
+        ///   @brief Calls mut_func(gpa) for every 4k guest page that is
+        ///     dirty, in ascending order. Bytes of the bitmap that have no
+        ///     dirty pages (and parts of the bitmap that were never
+        ///     allocated) are skipped as a whole.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FUNC the type of function to call
+        ///   @param mut_func the function to call for each dirty page
+        ///
+        template<typename FUNC>
+        constexpr void
+        for_each(FUNC &&mut_func) const noexcept
+        {
+            for (bsl::safe_idx mut_i{}; mut_i < m_leaves.size(); ++mut_i) {
+                auto const *const leaf{*m_leaves.at_if(mut_i)};
+                if (nullptr == leaf) {
+                    continue;
+                }
+
+                auto const base{(bsl::to_u64(mut_i) * BF_DIRTY_BITMAP_PAGES_PER_LEAF).checked()};
+                for (bsl::safe_idx mut_j{}; mut_j < leaf->data.size(); ++mut_j) {
+                    auto const val{bsl::to_u64(*leaf->data.at_if(mut_j))};
+                    if (val.is_zero()) {
+                        continue;
+                    }
+
+                    auto const offs{(bsl::to_u64(mut_j) * BF_DIRTY_BITMAP_BITS_PER_BYTE).checked()};
+                    for (bsl::safe_u64 mut_k{}; mut_k < BF_DIRTY_BITMAP_BITS_PER_BYTE; ++mut_k) {
+                        if ((val & (bsl::safe_u64::magic_1() << mut_k)).is_zero()) {
+                            continue;
+                        }
+
+                        auto const gfn{(base + offs + mut_k).checked()};
+                        mut_func((gfn << lib::BASIC_PAGE_4K_T_SHFT).checked());
+                    }
+                }
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks every guest page as clean. The pages that make up
+        ///     the bitmap are kept, as a VM that wrote to a part of its
+        ///     memory once is likely to write to it again.
+        ///
+        constexpr void
+        clear() noexcept
+        {
+            for (auto *const pmut_leaf : m_leaves) {
+                if (nullptr == pmut_leaf) {
+                    continue;
+                }
+
+                for (auto &mut_byte : pmut_leaf->data) {
+                    mut_byte = {};
+                }
+            }
+
+            m_dirty_pages = {};
+        }
+    };
+}
+
+#endif
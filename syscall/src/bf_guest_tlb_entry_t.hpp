@@ -0,0 +1,51 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BF_GUEST_TLB_ENTRY_T_HPP
+#define BF_GUEST_TLB_ENTRY_T_HPP
+
+#include <bsl/safe_integral.hpp>
+
+namespace syscall
+{
+    /// <!-- description -->
+    ///   @brief Defines an entry in the software TLB that the
+    ///     bf_guest_walker_t keeps for each VS.
+    ///
+    struct bf_guest_tlb_entry_t final
+    {
+        /// @brief stores the guest's CR3 at the time of the translation
+        bsl::safe_u64 cr3;
+        /// @brief stores the page aligned guest virtual address
+        bsl::safe_u64 gva;
+        /// @brief stores the page aligned guest physical address
+        bsl::safe_u64 gpa;
+        /// @brief stores whether or not the guest page may be written to
+        bool writable;
+        /// @brief stores whether or not this entry contains a translation
+        bool valid;
+    };
+}
+
+#endif
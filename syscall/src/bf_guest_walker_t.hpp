@@ -0,0 +1,576 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BF_GUEST_WALKER_T_HPP
+#define BF_GUEST_WALKER_T_HPP
+
+#include "bf_constants.hpp"            // IWYU pragma: export
+#include "bf_guest_tlb_entry_t.hpp"    // IWYU pragma: export
+#include "bf_reg_t.hpp"                // IWYU pragma: export
+
+#include <basic_page_4k_t.hpp>
+#include <bf_syscall_t.hpp>    // IWYU pragma: export
+// IWYU pragma: no_include "bf_syscall_t.hpp"
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace syscall
+{
+    /// @brief defines the number of software TLB entries each VS is given
+    constexpr auto BF_GUEST_TLB_SIZE{16_umx};
+    /// @brief defines the mask used to index into a VS's software TLB
+    constexpr auto BF_GUEST_TLB_MASK{(BF_GUEST_TLB_SIZE - bsl::safe_umx::magic_1()).checked()};
+
+    /// @brief defines the paging enable bit in the guest's CR0
+    constexpr auto BF_GUEST_CR0_PG{0x0000000080000000_u64};
+    /// @brief defines the write protect bit in the guest's CR0
+    constexpr auto BF_GUEST_CR0_WP{0x0000000000010000_u64};
+    /// @brief defines the 5-level paging bit in the guest's CR4
+    constexpr auto BF_GUEST_CR4_LA57{0x0000000000001000_u64};
+    /// @brief defines the long mode active bit in the guest's EFER
+    constexpr auto BF_GUEST_EFER_LMA{0x0000000000000400_u64};
+
+    /// @brief defines the present bit of a guest paging-structure entry
+    constexpr auto BF_GUEST_PTE_P{0x0000000000000001_u64};
+    /// @brief defines the read/write bit of a guest paging-structure entry
+    constexpr auto BF_GUEST_PTE_RW{0x0000000000000002_u64};
+    /// @brief defines the page size bit of a guest paging-structure entry
+    constexpr auto BF_GUEST_PTE_PS{0x0000000000000080_u64};
+    /// @brief defines the physical address bits of a guest paging-structure entry
+    constexpr auto BF_GUEST_PTE_PHYS{0x000FFFFFFFFFF000_u64};
+
+    /// @brief defines the number of bytes in a guest paging-structure entry
+    constexpr auto BF_GUEST_PTE_BYTES{8_u64};
+    /// @brief defines the number of bits used to index a guest paging-structure
+    constexpr auto BF_GUEST_PTE_INDEX_BITS{9_u64};
+    /// @brief defines the mask used to index a guest paging-structure
+    constexpr auto BF_GUEST_PTE_INDEX_MASK{0x1FF_u64};
+    /// @brief defines the number of paging-structure levels used by 4-level paging
+    constexpr auto BF_GUEST_4_LEVELS{4_u64};
+    /// @brief defines the number of paging-structure levels used by 5-level paging
+    constexpr auto BF_GUEST_5_LEVELS{5_u64};
+    /// @brief defines the highest level that may map a page (i.e., a PDPTE)
+    constexpr auto BF_GUEST_MAX_PS_LEVEL{2_u64};
+
+    /// @brief defines the shift of a guest 4k page
+    constexpr auto BF_GUEST_PAGE_SHIFT{12_u64};
+    /// @brief defines the offset mask of a guest 4k page
+    constexpr auto BF_GUEST_PAGE_MASK{(HYPERVISOR_PAGE_SIZE - bsl::safe_u64::magic_1()).checked()};
+
+    /// <!-- description -->
+    ///   @brief Walks a guest's page tables on behalf of an extension,
+    ///     translating guest virtual addresses into guest physical
+    ///     addresses. Both 4-level and 5-level paging are supported,
+    ///     including 2M and 1G pages. Each VS is given a small, direct
+    ///     mapped software TLB, keyed by the guest's CR3 and the guest
+    ///     virtual page, so that repeated accesses to the same page only
+    ///     cost a single syscall (to read CR3) instead of a syscall per
+    ///     paging-structure level.
+    ///
+    /// <!-- notes -->
+    ///   @note The extension is responsible for flushing the software TLB.
+    ///     tlb_flush(vsid) should be called whenever the guest writes to
+    ///     CR0, CR3 or CR4, and tlb_flush(vsid, gva) should be called
+    ///     whenever the guest executes INVLPG.
+    ///
+    ///   @note Guest physical addresses are accessed using
+    ///     bf_vm_op_map_direct, which means that guest physical addresses
+    ///     must equal system physical addresses (which is the case for
+    ///     the root VM). The walker does not set the accessed/dirty bits
+    ///     in the guest's page tables.
+    ///
+    class bf_guest_walker_t final
+    {
+        /// @brief defines the type used to store a VS's software TLB
+        using tlb_t = bsl::array<bf_guest_tlb_entry_t, BF_GUEST_TLB_SIZE.get()>;
+
+        /// @brief stores the software TLB for each VS
+        bsl::array<tlb_t, HYPERVISOR_MAX_VSS.get()> m_tlb{};
+
+        /// <!-- description -->
+        ///   @brief Returns the software TLB entry that the provided guest
+        ///     virtual address belongs to.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the VS whose TLB entry is returned
+        ///   @param gva the guest virtual address to get the TLB entry for
+        ///   @return Returns the software TLB entry that the provided guest
+        ///     virtual address belongs to.
+        ///
+        [[nodiscard]] constexpr auto
+        tlb_entry(bsl::safe_u16 const &vsid, bsl::safe_u64 const &gva) noexcept
+            -> bf_guest_tlb_entry_t *
+        {
+            auto *const pmut_tlb{m_tlb.at_if(bsl::to_idx(vsid))};
+            return pmut_tlb->at_if(bsl::to_idx((gva >> BF_GUEST_PAGE_SHIFT) & BF_GUEST_TLB_MASK));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the paging-structure entry located at the
+        ///     provided index in the guest paging-structure located at the
+        ///     provided guest physical address.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vmid the ID of the VM to map the paging-structure into
+        ///   @param table the guest physical address of the paging-structure
+        ///   @param idx the index of the entry to return
+        ///   @return Returns the requested paging-structure entry, or
+        ///     bsl::safe_u64::failure() on failure.
+        ///
+        [[nodiscard]] static constexpr auto
+        read_entry(
+            bf_syscall_t &mut_sys,
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u64 const &table,
+            bsl::safe_u64 const &idx) noexcept -> bsl::safe_u64
+        {
+            if (bsl::unlikely(table.is_zero() || table >= HYPERVISOR_EXT_DIRECT_MAP_SIZE)) {
+                bsl::error() << "guest paging-structure "    // --
+                             << bsl::hex(table)              // --
+                             << " cannot be mapped"          // --
+                             << bsl::endl                    // --
+                             << bsl::here();
+
+                return bsl::safe_u64::failure();
+            }
+
+            auto *const pmut_table{mut_sys.bf_vm_op_map_direct<lib::basic_page_4k_t>(vmid, table)};
+            if (bsl::unlikely(nullptr == pmut_table)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_u64::failure();
+            }
+
+            constexpr auto bits_per_byte{8_u64};
+            auto const offs{(idx * BF_GUEST_PTE_BYTES).checked()};
+
+            bsl::safe_u64 mut_entry{};
+            for (bsl::safe_idx mut_i{}; mut_i < BF_GUEST_PTE_BYTES; ++mut_i) {
+                auto const byte{*pmut_table->data.at_if(bsl::to_idx(offs + bsl::to_u64(mut_i)))};
+                mut_entry |= bsl::to_u64(byte) << (bsl::to_u64(mut_i) * bits_per_byte).checked();
+            }
+
+            auto const ret{mut_sys.bf_vm_op_unmap_direct(vmid, pmut_table)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_u64::failure();
+            }
+
+            return mut_entry.checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Walks the guest's page tables, returning a software TLB
+        ///     entry for the provided guest virtual page. If the walk fails,
+        ///     the valid field of the resulting entry is false.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vmid the ID of the VM the VS belongs to
+        ///   @param vsid the ID of the VS whose page tables are walked
+        ///   @param cr3 the guest's current CR3
+        ///   @param gva the page aligned guest virtual address to translate
+        ///   @return Returns a software TLB entry for the provided guest
+        ///     virtual page.
+        ///
+        [[nodiscard]] static constexpr auto
+        walk(
+            bf_syscall_t &mut_sys,
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u16 const &vsid,
+            bsl::safe_u64 const &cr3,
+            bsl::safe_u64 const &gva) noexcept -> bf_guest_tlb_entry_t
+        {
+            bf_guest_tlb_entry_t mut_entry{cr3, gva, {}, true, false};
+
+            auto const cr0{mut_sys.bf_vs_op_read(vsid, bf_reg_t::bf_reg_t_cr0)};
+            auto const cr4{mut_sys.bf_vs_op_read(vsid, bf_reg_t::bf_reg_t_cr4)};
+            auto const efer{mut_sys.bf_vs_op_read(vsid, bf_reg_t::bf_reg_t_efer)};
+            if (bsl::unlikely(cr0.is_invalid() || cr4.is_invalid() || efer.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return mut_entry;
+            }
+
+            if ((cr0 & BF_GUEST_CR0_PG).is_zero()) {
+                mut_entry.gpa = gva;
+                mut_entry.valid = true;
+                return mut_entry;
+            }
+
+            if (bsl::unlikely((efer & BF_GUEST_EFER_LMA).is_zero())) {
+                bsl::error() << "guest paging mode is not supported"    // --
+                             << bsl::endl                               // --
+                             << bsl::here();
+
+                return mut_entry;
+            }
+
+            auto mut_lvl{BF_GUEST_4_LEVELS};
+            if (!(cr4 & BF_GUEST_CR4_LA57).is_zero()) {
+                mut_lvl = BF_GUEST_5_LEVELS;
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto mut_table{cr3 & BF_GUEST_PTE_PHYS};
+            while (mut_lvl.is_pos()) {
+                --mut_lvl;
+
+                auto const bits{(mut_lvl * BF_GUEST_PTE_INDEX_BITS).checked()};
+                auto const shft{(BF_GUEST_PAGE_SHIFT + bits).checked()};
+                auto const idx{(gva >> shft) & BF_GUEST_PTE_INDEX_MASK};
+
+                auto const entry{read_entry(mut_sys, vmid, mut_table, idx)};
+                if (bsl::unlikely(entry.is_invalid())) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return mut_entry;
+                }
+
+                if (bsl::unlikely((entry & BF_GUEST_PTE_P).is_zero())) {
+                    bsl::error() << "guest virtual address "    // --
+                                 << bsl::hex(gva)               // --
+                                 << " is not present"           // --
+                                 << bsl::endl                   // --
+                                 << bsl::here();
+
+                    return mut_entry;
+                }
+
+                if ((entry & BF_GUEST_PTE_RW).is_zero()) {
+                    mut_entry.writable = false;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                bool const is_page{(entry & BF_GUEST_PTE_PS).is_pos()};
+                if (mut_lvl.is_zero() || (is_page && mut_lvl <= BF_GUEST_MAX_PS_LEVEL)) {
+                    auto const mask{(bsl::safe_u64::magic_1() << shft) - bsl::safe_u64::magic_1()};
+                    auto const base{((entry & BF_GUEST_PTE_PHYS) >> shft) << shft};
+
+                    mut_entry.gpa = (base | (gva & mask.checked())).checked();
+                    mut_entry.writable = mut_entry.writable || (cr0 & BF_GUEST_CR0_WP).is_zero();
+                    mut_entry.valid = true;
+
+                    return mut_entry;
+                }
+
+                mut_table = entry & BF_GUEST_PTE_PHYS;
+            }
+
+            bsl::expects(false);
+            return mut_entry;
+        }
+
+        /// <!-- description -->
+        ///   @brief Translates the provided guest virtual address and maps
+        ///     the guest page that it resides in, returning a pointer to the
+        ///     resulting page. The page must be unmapped using
+        ///     bf_vm_op_unmap_direct when the caller is done with it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vmid the ID of the VM the VS belongs to
+        ///   @param vsid the ID of the VS whose page tables are walked
+        ///   @param gva the guest virtual address to map
+        ///   @param write true if the page will be written to
+        ///   @return Returns a pointer to the mapped guest page on success,
+        ///     or a nullptr on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        map_guest_page(
+            bf_syscall_t &mut_sys,
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u16 const &vsid,
+            bsl::safe_u64 const &gva,
+            bool const write) noexcept -> lib::basic_page_4k_t *
+        {
+            auto const gpa{this->translate(mut_sys, vmid, vsid, gva, write)};
+            if (bsl::unlikely(gpa.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return nullptr;
+            }
+
+            auto const page{(gpa & ~BF_GUEST_PAGE_MASK).checked()};
+            if (bsl::unlikely(page.is_zero() || page >= HYPERVISOR_EXT_DIRECT_MAP_SIZE)) {
+                bsl::error() << "guest physical address "    // --
+                             << bsl::hex(page)               // --
+                             << " cannot be mapped"          // --
+                             << bsl::endl                    // --
+                             << bsl::here();
+
+                return nullptr;
+            }
+
+            return mut_sys.bf_vm_op_map_direct<lib::basic_page_4k_t>(vmid, page);
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Translates a guest virtual address into a guest physical
+        ///     address, using the VS's software TLB when possible.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vmid the ID of the VM the VS belongs to
+        ///   @param vsid the ID of the VS whose page tables are walked
+        ///   @param gva the guest virtual address to translate
+        ///   @param write true if the translation will be used to write to
+        ///     the guest page, false otherwise
+        ///   @return Returns the resulting guest physical address, or
+        ///     bsl::safe_u64::failure() on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        translate(
+            bf_syscall_t &mut_sys,
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u16 const &vsid,
+            bsl::safe_u64 const &gva,
+            bool const write = false) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(vmid.is_valid_and_checked());
+            bsl::expects(vmid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vmid) < HYPERVISOR_MAX_VMS);
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vsid) < HYPERVISOR_MAX_VSS);
+            bsl::expects(gva.is_valid_and_checked());
+
+            auto const cr3{mut_sys.bf_vs_op_read(vsid, bf_reg_t::bf_reg_t_cr3)};
+            if (bsl::unlikely(cr3.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_u64::failure();
+            }
+
+            auto const page{(gva & ~BF_GUEST_PAGE_MASK).checked()};
+            auto *const pmut_entry{this->tlb_entry(vsid, page)};
+
+            bool const hit{pmut_entry->valid && pmut_entry->cr3 == cr3 && pmut_entry->gva == page};
+            if (!hit) {
+                *pmut_entry = walk(mut_sys, vmid, vsid, cr3, page);
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (bsl::unlikely(!pmut_entry->valid)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_u64::failure();
+            }
+
+            if (bsl::unlikely(write && !pmut_entry->writable)) {
+                bsl::error() << "guest virtual address "    // --
+                             << bsl::hex(gva)               // --
+                             << " is read-only"             // --
+                             << bsl::endl                   // --
+                             << bsl::here();
+
+                return bsl::safe_u64::failure();
+            }
+
+            return (pmut_entry->gpa | (gva & BF_GUEST_PAGE_MASK)).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Reads buf.size() bytes from the guest, starting at the
+        ///     provided guest virtual address. The read may cross any number
+        ///     of guest pages.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vmid the ID of the VM the VS belongs to
+        ///   @param vsid the ID of the VS whose page tables are walked
+        ///   @param gva the guest virtual address to read from
+        ///   @param mut_buf the buffer to read the guest's memory into
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        read_guest_virt(
+            bf_syscall_t &mut_sys,
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u16 const &vsid,
+            bsl::safe_u64 const &gva,
+            bsl::span<bsl::uint8> &mut_buf) noexcept -> bsl::errc_type
+        {
+            bsl::safe_umx mut_done{};
+            while (mut_done < mut_buf.size()) {
+                auto const addr{(gva + mut_done).checked()};
+                auto const offs{addr & BF_GUEST_PAGE_MASK};
+
+                auto mut_num{(HYPERVISOR_PAGE_SIZE - offs).checked()};
+                if (mut_num > (mut_buf.size() - mut_done).checked()) {
+                    mut_num = (mut_buf.size() - mut_done).checked();
+                }
+                else {
+                    bsl::touch();
+                }
+
+                auto *const pmut_page{this->map_guest_page(mut_sys, vmid, vsid, addr, false)};
+                if (bsl::unlikely(nullptr == pmut_page)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                for (bsl::safe_idx mut_i{}; mut_i < mut_num; ++mut_i) {
+                    auto const src{bsl::to_idx((offs + bsl::to_u64(mut_i)).checked())};
+                    auto const dst{bsl::to_idx((mut_done + bsl::to_u64(mut_i)).checked())};
+                    *mut_buf.at_if(dst) = *pmut_page->data.at_if(src);
+                }
+
+                auto const ret{mut_sys.bf_vm_op_unmap_direct(vmid, pmut_page)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                mut_done += mut_num;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes buf.size() bytes to the guest, starting at the
+        ///     provided guest virtual address. The write may cross any
+        ///     number of guest pages. If a guest page is not writable, the
+        ///     write stops at that page and bsl::errc_failure is returned,
+        ///     meaning that some of the bytes may have already been written.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vmid the ID of the VM the VS belongs to
+        ///   @param vsid the ID of the VS whose page tables are walked
+        ///   @param gva the guest virtual address to write to
+        ///   @param buf the buffer to write to the guest's memory
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        write_guest_virt(
+            bf_syscall_t &mut_sys,
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u16 const &vsid,
+            bsl::safe_u64 const &gva,
+            bsl::span<bsl::uint8 const> const &buf) noexcept -> bsl::errc_type
+        {
+            bsl::safe_umx mut_done{};
+            while (mut_done < buf.size()) {
+                auto const addr{(gva + mut_done).checked()};
+                auto const offs{addr & BF_GUEST_PAGE_MASK};
+
+                auto mut_num{(HYPERVISOR_PAGE_SIZE - offs).checked()};
+                if (mut_num > (buf.size() - mut_done).checked()) {
+                    mut_num = (buf.size() - mut_done).checked();
+                }
+                else {
+                    bsl::touch();
+                }
+
+                auto *const pmut_page{this->map_guest_page(mut_sys, vmid, vsid, addr, true)};
+                if (bsl::unlikely(nullptr == pmut_page)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                for (bsl::safe_idx mut_i{}; mut_i < mut_num; ++mut_i) {
+                    auto const src{bsl::to_idx((mut_done + bsl::to_u64(mut_i)).checked())};
+                    auto const dst{bsl::to_idx((offs + bsl::to_u64(mut_i)).checked())};
+                    *pmut_page->data.at_if(dst) = *buf.at_if(src);
+                }
+
+                auto const ret{mut_sys.bf_vm_op_unmap_direct(vmid, pmut_page)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                mut_done += mut_num;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Flushes the entire software TLB of the provided VS.
+        ///     This should be called whenever the guest writes to CR0, CR3
+        ///     or CR4.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the VS whose software TLB is flushed
+        ///
+        constexpr void
+        tlb_flush(bsl::safe_u16 const &vsid) noexcept
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vsid) < HYPERVISOR_MAX_VSS);
+
+            auto *const pmut_tlb{m_tlb.at_if(bsl::to_idx(vsid))};
+            for (bsl::safe_idx mut_i{}; mut_i < pmut_tlb->size(); ++mut_i) {
+                *pmut_tlb->at_if(mut_i) = {};
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Flushes the provided guest virtual address from the
+        ///     software TLB of the provided VS, regardless of which CR3 it
+        ///     was translated with. This should be called whenever the
+        ///     guest executes INVLPG.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the VS whose software TLB is flushed
+        ///   @param gva the guest virtual address to flush
+        ///
+        constexpr void
+        tlb_flush(bsl::safe_u16 const &vsid, bsl::safe_u64 const &gva) noexcept
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vsid) < HYPERVISOR_MAX_VSS);
+            bsl::expects(gva.is_valid_and_checked());
+
+            auto const page{(gva & ~BF_GUEST_PAGE_MASK).checked()};
+            auto *const pmut_entry{this->tlb_entry(vsid, page)};
+            if (pmut_entry->gva == page) {
+                *pmut_entry = {};
+            }
+            else {
+                bsl::touch();
+            }
+        }
+    };
+}
+
+#endif
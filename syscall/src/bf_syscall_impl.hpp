@@ -56,6 +56,14 @@ namespace syscall
     // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
     using bf_callback_handler_fail_t = void (*)(bsl::uint64, bsl::uint64);
 
+    // -------------------------------------------------------------------------
+    // Tick Callback Handler Type
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the signature of the tick callback handler
+    // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+    using bf_callback_handler_tick_t = void (*)(bsl::uint16);
+
     // -------------------------------------------------------------------------
     // TLS ops
     // -------------------------------------------------------------------------
@@ -475,6 +483,22 @@ namespace syscall
     ///
     extern "C" void bf_debug_op_dump_huge_pool_impl() noexcept;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_dump_syscall_stats.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///
+    extern "C" void bf_debug_op_dump_syscall_stats_impl(bsl::uint16 const reg0_in) noexcept;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_set_log_mask.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///
+    extern "C" void bf_debug_op_set_log_mask_impl(bsl::uint64 const reg0_in) noexcept;
+
     // -------------------------------------------------------------------------
     // bf_callback_ops
     // -------------------------------------------------------------------------
@@ -515,6 +539,20 @@ namespace syscall
         bsl::uint64 const reg0_in, bf_callback_handler_fail_t const pmut_reg1_in) noexcept
         -> bsl::uint64;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_callback_op_register_tick.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param pmut_reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_callback_op_register_tick_impl(
+        bsl::uint64 const reg0_in,
+        bf_callback_handler_tick_t const pmut_reg1_in,
+        bsl::uint64 const reg2_in) noexcept -> bsl::uint64;
+
     // -------------------------------------------------------------------------
     // bf_vm_ops
     // -------------------------------------------------------------------------
@@ -597,6 +635,40 @@ namespace syscall
     bf_vm_op_tlb_flush_impl(bsl::uint64 const reg0_in, bsl::uint16 const reg1_in) noexcept
         -> bsl::uint64;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vm_op_map_direct_range.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @param pmut_reg0_out n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_vm_op_map_direct_range_impl(
+        bsl::uint64 const reg0_in,
+        bsl::uint16 const reg1_in,
+        bsl::uint64 const reg2_in,
+        bsl::uint64 const reg3_in,
+        void **const pmut_reg0_out) noexcept -> bsl::uint64;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vm_op_unmap_direct_range.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_vm_op_unmap_direct_range_impl(
+        bsl::uint64 const reg0_in,
+        bsl::uint16 const reg1_in,
+        bsl::uint64 const reg2_in,
+        bsl::uint64 const reg3_in) noexcept -> bsl::uint64;
+
     // -------------------------------------------------------------------------
     // bf_vp_ops
     // -------------------------------------------------------------------------
@@ -837,6 +909,17 @@ namespace syscall
         bsl::uint64 const reg0_in, bsl::uint16 const reg1_in, bsl::uint64 const reg2_in) noexcept
         -> bsl::uint64;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vs_op_drain_posted_events.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param pmut_reg0_out n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_vs_op_drain_posted_events_impl(
+        bsl::uint64 const reg0_in, bsl::uint64 *const pmut_reg0_out) noexcept -> bsl::uint64;
+
     // -------------------------------------------------------------------------
     // bf_intrinsic_ops
     // -------------------------------------------------------------------------
@@ -886,6 +969,18 @@ namespace syscall
         void **const pmut_reg0_out,
         bsl::uint64 *const pmut_reg1_out) noexcept -> bsl::uint64;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_mem_op_free_page.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto
+    bf_mem_op_free_page_impl(bsl::uint64 const reg0_in, bsl::uint64 const reg1_in) noexcept
+        -> bsl::uint64;
+
     /// <!-- description -->
     ///   @brief Implements the ABI for bf_mem_op_alloc_huge.
     ///
@@ -901,6 +996,18 @@ namespace syscall
         bsl::uint64 const reg1_in,
         void **const pmut_reg0_out,
         bsl::uint64 *const pmut_reg1_out) noexcept -> bsl::uint64;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_mem_op_free_huge.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto
+    bf_mem_op_free_huge_impl(bsl::uint64 const reg0_in, bsl::uint64 const reg1_in) noexcept
+        -> bsl::uint64;
 }
 
 #endif
@@ -442,6 +442,22 @@ extern "C" {
     ///
     pub fn bf_debug_op_dump_huge_pool_impl();
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_dump_syscall_stats.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///
+    pub fn bf_debug_op_dump_syscall_stats_impl(reg0_in: u16);
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_set_log_mask.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///
+    pub fn bf_debug_op_set_log_mask_impl(reg0_in: u64);
+
     // -------------------------------------------------------------------------
     // bf_callback_ops
     // -------------------------------------------------------------------------
@@ -476,6 +492,21 @@ extern "C" {
     ///
     pub fn bf_callback_op_register_fail_impl(reg0_in: u64, reg1_in: bsl::CPtrT) -> u64;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_callback_op_register_tick.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @return n/a
+    ///
+    pub fn bf_callback_op_register_tick_impl(
+        reg0_in: u64,
+        reg1_in: bsl::CPtrT,
+        reg2_in: u64,
+    ) -> u64;
+
     // -------------------------------------------------------------------------
     // bf_vm_ops
     // -------------------------------------------------------------------------
@@ -553,6 +584,42 @@ extern "C" {
     ///
     pub fn bf_vm_op_tlb_flush_impl(reg0_in: u64, reg1_in: u16) -> u64;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vm_op_map_direct_range.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @param reg0_out n/a
+    ///   @return n/a
+    ///
+    pub fn bf_vm_op_map_direct_range_impl(
+        reg0_in: u64,
+        reg1_in: u16,
+        reg2_in: u64,
+        reg3_in: u64,
+        reg0_out: *mut bsl::CPtrT,
+    ) -> u64;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vm_op_unmap_direct_range.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    pub fn bf_vm_op_unmap_direct_range_impl(
+        reg0_in: u64,
+        reg1_in: u16,
+        reg2_in: bsl::CPtrT,
+        reg3_in: u64,
+    ) -> u64;
+
     // -------------------------------------------------------------------------
     // bf_vp_ops
     // -------------------------------------------------------------------------
@@ -761,6 +828,16 @@ extern "C" {
     ///
     pub fn bf_vs_op_tlb_flush_impl(reg0_in: u64, reg1_in: u16, reg2_in: u64) -> u64;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vs_op_drain_posted_events.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg0_out n/a
+    ///   @return n/a
+    ///
+    pub fn bf_vs_op_drain_posted_events_impl(reg0_in: u64, reg0_out: *mut u64) -> u64;
+
     // -------------------------------------------------------------------------
     // bf_intrinsic_ops
     // -------------------------------------------------------------------------
@@ -806,6 +883,16 @@ extern "C" {
         pmut_reg1_out: *mut u64,
     ) -> u64;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_mem_op_free_page.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @return n/a
+    ///
+    pub fn bf_mem_op_free_page_impl(reg0_in: u64, reg1_in: bsl::CPtrT) -> u64;
+
     /// <!-- description -->
     ///   @brief Implements the ABI for bf_mem_op_alloc_huge.
     ///
@@ -823,4 +910,14 @@ extern "C" {
         pmut_reg1_out: *mut u64,
     ) -> u64;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_mem_op_free_huge.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @return n/a
+    ///
+    pub fn bf_mem_op_free_huge_impl(reg0_in: u64, reg1_in: bsl::CPtrT) -> u64;
+
 }
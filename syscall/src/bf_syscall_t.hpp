@@ -168,6 +168,43 @@ namespace syscall
             return m_hndl;
         }
 
+        /// <!-- description -->
+        ///   @brief Registers a tick handler that the microkernel will call
+        ///     on each PP roughly once every "period" TSC ticks. Unlike the
+        ///     VMExit handler, the tick handler is optional and can be
+        ///     registered at any time after initialize() has been called.
+        ///     When the tick handler is done, it must call
+        ///     bf_vs_op_run_current() to resume the VS that was running.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_tick_handler the tick handler to register
+        ///   @param period the number of TSC ticks between each tick
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_callback_op_register_tick(
+            bf_callback_handler_tick_t const pmut_tick_handler,
+            bsl::safe_u64 const &period) noexcept -> bsl::errc_type
+        {
+            bsl::expects(nullptr != pmut_tick_handler);
+            bsl::expects(period.is_valid_and_checked());
+            bsl::expects(period.is_pos());
+
+            bf_status_t const ret{
+                bf_callback_op_register_tick_impl(m_hndl.get(), pmut_tick_handler, period.get())};
+            if (bsl::unlikely(ret != BF_STATUS_SUCCESS)) {
+                bsl::error() << "bf_callback_op_register_tick failed with status "    // --
+                             << bsl::hex(ret)                                         // --
+                             << bsl::endl                                             // --
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
         // ---------------------------------------------------------------------
         // TLS ops
         // ---------------------------------------------------------------------
@@ -948,6 +985,117 @@ namespace syscall
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief This syscall tells the microkernel to map a physically
+        ///     contiguous range into the VM's direct map using a single
+        ///     syscall. Unlike bf_vm_op_map_direct, the microkernel will use
+        ///     2M and 1G pages wherever the alignment of the range allows,
+        ///     which reduces both the number of syscalls and the TLB
+        ///     pressure needed to access large buffers.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to return. Must be a POD type.
+        ///   @param vmid The ID of the VM to map the physical range to
+        ///   @param phys The physical address of the start of the range
+        ///   @param bytes The total number of bytes to map. Must be page
+        ///     aligned.
+        ///   @return Returns a pointer to the start of the map on success,
+        ///     returns a nullptr on failure.
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        bf_vm_op_map_direct_range(
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u64 const &phys,
+            bsl::safe_u64 const &bytes) noexcept -> T *
+        {
+            bsl::expects(vmid.is_valid_and_checked());
+            bsl::expects(vmid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vmid) < HYPERVISOR_MAX_VMS);
+            bsl::expects(phys.is_valid_and_checked());
+            bsl::expects(phys.is_pos());
+            bsl::expects(bf_is_page_aligned(phys));
+            bsl::expects(bytes.is_valid_and_checked());
+            bsl::expects(bytes.is_pos());
+            bsl::expects(bf_is_page_aligned(bytes));
+            bsl::expects((phys + bytes).checked() <= HYPERVISOR_EXT_DIRECT_MAP_SIZE);
+
+            static_assert(bsl::is_pod<T>::value);
+
+            void *pmut_mut_ptr{};
+
+            bf_status_t const ret{bf_vm_op_map_direct_range_impl(
+                m_hndl.get(), vmid.get(), phys.get(), bytes.get(), &pmut_mut_ptr)};
+            if (bsl::unlikely(ret != BF_STATUS_SUCCESS)) {
+                bsl::error() << "bf_vm_op_map_direct_range failed with status "    // --
+                             << bsl::hex(ret)                                      // --
+                             << bsl::endl                                          // --
+                             << bsl::here();
+
+                return nullptr;
+            }
+
+            return static_cast<T *>(pmut_mut_ptr);
+        }
+
+        /// <!-- description -->
+        ///   @brief This syscall tells the microkernel to unmap a range that
+        ///     was previously mapped using bf_vm_op_map_direct_range. The
+        ///     provided pointer and size must match the pointer returned by
+        ///     and the size given to bf_vm_op_map_direct_range. Like
+        ///     bf_vm_op_unmap_direct, the TLB is only flushed on the PP this
+        ///     syscall is executed on.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to unmap. Must be a POD type.
+        ///   @param vmid The ID of the VM to unmap the range from
+        ///   @param ptr The virtual address of the start of the range
+        ///   @param bytes The total number of bytes to unmap. Must be page
+        ///     aligned.
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        bf_vm_op_unmap_direct_range(
+            bsl::safe_u16 const &vmid, T const *const ptr, bsl::safe_u64 const &bytes) noexcept
+            -> bsl::errc_type
+        {
+            constexpr auto min_addr{HYPERVISOR_EXT_DIRECT_MAP_ADDR};
+            constexpr auto max_addr{(min_addr + HYPERVISOR_EXT_DIRECT_MAP_SIZE).checked()};
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            bsl::safe_u64 const virt{reinterpret_cast<bsl::uint64>(ptr)};
+
+            bsl::expects(vmid.is_valid_and_checked());
+            bsl::expects(vmid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vmid) < HYPERVISOR_MAX_VMS);
+            bsl::expects(virt.is_valid_and_checked());
+            bsl::expects(virt.is_pos());
+            bsl::expects(virt > min_addr);
+            bsl::expects(virt < max_addr);
+            bsl::expects(bf_is_page_aligned(virt));
+            bsl::expects(bytes.is_valid_and_checked());
+            bsl::expects(bytes.is_pos());
+            bsl::expects(bf_is_page_aligned(bytes));
+            bsl::expects((virt + bytes).checked() <= max_addr);
+
+            static_assert(bsl::is_pod<T>::value);
+
+            bf_status_t const ret{bf_vm_op_unmap_direct_range_impl(
+                m_hndl.get(), vmid.get(), virt.get(), bytes.get())};
+            if (bsl::unlikely(ret != BF_STATUS_SUCCESS)) {
+                bsl::error() << "bf_vm_op_unmap_direct_range failed with status "    // --
+                             << bsl::hex(ret)                                        // --
+                             << bsl::endl                                            // --
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
         // ---------------------------------------------------------------------
         // bf_vp_ops
         // ---------------------------------------------------------------------
@@ -1577,6 +1725,38 @@ namespace syscall
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Drains the events that the microkernel posted to the PP
+        ///     that this is executed on while the extension was executing
+        ///     (e.g., NMIs), allowing the extension to handle all of them
+        ///     in the same invocation instead of taking a VMExit for each.
+        ///     Any event returned is owned by the extension, meaning the
+        ///     microkernel will no longer deliver it on its own.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a mask of the BF_POSTED_EVENT bits that were
+        ///     drained (0 if nothing was posted), or
+        ///     bsl::safe_u64::failure() on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vs_op_drain_posted_events() noexcept -> bsl::safe_u64
+        {
+            bsl::safe_u64 mut_events{};
+
+            bf_status_t const ret{
+                bf_vs_op_drain_posted_events_impl(m_hndl.get(), mut_events.data())};
+            if (bsl::unlikely(ret != BF_STATUS_SUCCESS)) {
+                bsl::error() << "bf_vs_op_drain_posted_events failed with status "    // --
+                             << bsl::hex(ret)                                         // --
+                             << bsl::endl                                             // --
+                             << bsl::here();
+
+                return bsl::safe_u64::failure();
+            }
+
+            return mut_events;
+        }
+
         // ---------------------------------------------------------------------
         // bf_intrinsic_ops
         // ---------------------------------------------------------------------
@@ -1707,6 +1887,47 @@ namespace syscall
             return this->bf_mem_op_alloc_page<T>(mut_ignored);
         }
 
+        /// <!-- description -->
+        ///   @brief bf_mem_op_free_page frees a page previously allocated
+        ///     by bf_mem_op_alloc_page. The memory is unmapped from the
+        ///     extension (including the direct map of every VM) and returned
+        ///     to the microkernel's page pool. The TLB is only flushed on the PP
+        ///     that this syscall is executed on, so the extension must ensure
+        ///     that no other PP is still accessing the memory.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to free.
+        ///   @param ptr The virtual address returned by bf_mem_op_alloc_page
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        bf_mem_op_free_page(T const *const ptr) noexcept -> bsl::errc_type
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            bsl::safe_u64 const virt{reinterpret_cast<bsl::uint64>(ptr)};
+
+            bsl::expects(virt.is_valid_and_checked());
+            bsl::expects(virt.is_pos());
+            bsl::expects(bf_is_page_aligned(virt));
+
+            static_assert(bsl::is_pod<T>::value);
+            static_assert(sizeof(T) <= HYPERVISOR_PAGE_SIZE);
+
+            bf_status_t const ret{bf_mem_op_free_page_impl(m_hndl.get(), virt.get())};
+            if (bsl::unlikely(ret != BF_STATUS_SUCCESS)) {
+                bsl::error() << "bf_mem_op_free_page failed with status "    // --
+                             << bsl::hex(ret)                                // --
+                             << bsl::endl                                    // --
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief bf_mem_op_alloc_huge allocates a physically contiguous block
         ///     of memory. When allocating a page, the extension should keep in
@@ -1789,6 +2010,47 @@ namespace syscall
             bsl::safe_u64 mut_ignored{};
             return this->bf_mem_op_alloc_huge<T>(size, mut_ignored);
         }
+
+        /// <!-- description -->
+        ///   @brief bf_mem_op_free_huge frees memory previously allocated
+        ///     by bf_mem_op_alloc_huge. The memory is unmapped from the
+        ///     extension (including the direct map of every VM) and returned
+        ///     to the microkernel's huge pool. The TLB is only flushed on the PP
+        ///     that this syscall is executed on, so the extension must ensure
+        ///     that no other PP is still accessing the memory.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to free.
+        ///   @param ptr The virtual address returned by bf_mem_op_alloc_huge
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        bf_mem_op_free_huge(T const *const ptr) noexcept -> bsl::errc_type
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            bsl::safe_u64 const virt{reinterpret_cast<bsl::uint64>(ptr)};
+
+            bsl::expects(virt.is_valid_and_checked());
+            bsl::expects(virt.is_pos());
+            bsl::expects(bf_is_page_aligned(virt));
+
+            static_assert(bsl::is_pod<T>::value);
+            static_assert(sizeof(T) <= HYPERVISOR_PAGE_SIZE);
+
+            bf_status_t const ret{bf_mem_op_free_huge_impl(m_hndl.get(), virt.get())};
+            if (bsl::unlikely(ret != BF_STATUS_SUCCESS)) {
+                bsl::error() << "bf_mem_op_free_huge failed with status "    // --
+                             << bsl::hex(ret)                                // --
+                             << bsl::endl                                    // --
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
     };
 }
 
@@ -156,6 +156,51 @@ impl BfSyscallT {
         return self.m_hndl;
     }
 
+    /// <!-- description -->
+    ///   @brief Registers a tick handler that the microkernel will call
+    ///     on each PP roughly once every "period" TSC ticks. Unlike the
+    ///     VMExit handler, the tick handler is optional and can be
+    ///     registered at any time after initialize() has been called.
+    ///     When the tick handler is done, it must call
+    ///     bf_vs_op_run_current() to resume the VS that was running.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_tick_handler the tick handler to register
+    ///   @param period the number of TSC ticks between each tick
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     otherwise
+    ///
+    pub fn bf_callback_op_register_tick(
+        &self,
+        pmut_tick_handler: bsl::CPtrT,
+        period: bsl::SafeU64,
+    ) -> bsl::ErrcType {
+        let ret: u64;
+
+        bsl::expects(core::ptr::null() != pmut_tick_handler);
+        bsl::expects(period.is_valid_and_checked());
+        bsl::expects(period.is_pos());
+
+        unsafe {
+            ret = crate::bf_callback_op_register_tick_impl(
+                self.m_hndl.get(),
+                pmut_tick_handler,
+                period.get(),
+            );
+        }
+        if crate::BF_STATUS_SUCCESS != ret {
+            error!(
+                "bf_callback_op_register_tick failed with status {:#018x}\n{}",
+                ret,
+                bsl::here()
+            );
+
+            return bsl::errc_failure;
+        }
+
+        return bsl::errc_success;
+    }
+
     // ---------------------------------------------------------------------
     // TLS ops
     // ---------------------------------------------------------------------
@@ -918,6 +963,117 @@ impl BfSyscallT {
         return bsl::errc_success;
     }
 
+    /// <!-- description -->
+    ///   @brief This syscall tells the microkernel to map a physically
+    ///     contiguous range into the VM's direct map using a single
+    ///     syscall. Unlike bf_vm_op_map_direct, the microkernel will use
+    ///     2M and 1G pages wherever the alignment of the range allows,
+    ///     which reduces both the number of syscalls and the TLB
+    ///     pressure needed to access large buffers.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of pointer to return. Must be a POD type.
+    ///   @param vmid The ID of the VM to map the physical range to
+    ///   @param phys The physical address of the start of the range
+    ///   @param bytes The total number of bytes to map. Must be page
+    ///     aligned.
+    ///   @return Returns a pointer to the start of the map on success,
+    ///     returns a nullptr on failure.
+    ///
+    pub fn bf_vm_op_map_direct_range<T>(
+        &self,
+        vmid: bsl::SafeU16,
+        phys: bsl::SafeU64,
+        bytes: bsl::SafeU64,
+    ) -> *mut T {
+        let ret: u64;
+        let mut ptr: bsl::CPtrT = core::ptr::null_mut();
+
+        bsl::expects(vmid.is_valid_and_checked());
+        bsl::expects(crate::BF_INVALID_ID != vmid);
+        bsl::expects(crate::HYPERVISOR_MAX_VMS > bsl::to_umx(vmid));
+        bsl::expects(phys.is_valid_and_checked());
+        bsl::expects(phys.is_pos());
+        bsl::expects(crate::bf_is_page_aligned(phys));
+        bsl::expects(bytes.is_valid_and_checked());
+        bsl::expects(bytes.is_pos());
+        bsl::expects(crate::bf_is_page_aligned(bytes));
+        bsl::expects(crate::HYPERVISOR_EXT_DIRECT_MAP_SIZE >= phys + bytes);
+
+        unsafe {
+            ret = crate::bf_vm_op_map_direct_range_impl(
+                self.m_hndl.get(),
+                vmid.get(),
+                phys.get(),
+                bytes.get(),
+                &mut ptr,
+            );
+        }
+        if crate::BF_STATUS_SUCCESS != ret {
+            error!(
+                "bf_vm_op_map_direct_range failed with status {:#018x}\n{}",
+                ret,
+                bsl::here()
+            );
+
+            return core::ptr::null_mut();
+        }
+
+        return ptr as *mut T;
+    }
+
+    /// <!-- description -->
+    ///   @brief This syscall tells the microkernel to unmap a range that
+    ///     was previously mapped using bf_vm_op_map_direct_range. The
+    ///     provided pointer and size must match the pointer returned by
+    ///     and the size given to bf_vm_op_map_direct_range. Like
+    ///     bf_vm_op_unmap_direct, the TLB is only flushed on the PP this
+    ///     syscall is executed on.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param vmid The ID of the VM to unmap the range from
+    ///   @param ptr The virtual address of the start of the range
+    ///   @param bytes The total number of bytes to unmap. Must be page
+    ///     aligned.
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     otherwise
+    ///
+    pub fn bf_vm_op_unmap_direct_range(
+        &self,
+        vmid: bsl::SafeU16,
+        ptr: bsl::CPtrT,
+        bytes: bsl::SafeU64,
+    ) -> bsl::ErrcType {
+        let ret: u64;
+
+        bsl::expects(vmid.is_valid_and_checked());
+        bsl::expects(crate::BF_INVALID_ID != vmid);
+        bsl::expects(crate::HYPERVISOR_MAX_VMS > bsl::to_umx(vmid));
+        bsl::expects(bytes.is_valid_and_checked());
+        bsl::expects(bytes.is_pos());
+        bsl::expects(crate::bf_is_page_aligned(bytes));
+
+        unsafe {
+            ret = crate::bf_vm_op_unmap_direct_range_impl(
+                self.m_hndl.get(),
+                vmid.get(),
+                ptr,
+                bytes.get(),
+            );
+        }
+        if crate::BF_STATUS_SUCCESS != ret {
+            error!(
+                "bf_vm_op_unmap_direct_range failed with status {:#018x}\n{}",
+                ret,
+                bsl::here()
+            );
+
+            return bsl::errc_failure;
+        }
+
+        return bsl::errc_success;
+    }
+
     // ---------------------------------------------------------------------
     // bf_vp_ops
     // ---------------------------------------------------------------------
@@ -1610,6 +1766,39 @@ impl BfSyscallT {
         return bsl::errc_success;
     }
 
+    /// <!-- description -->
+    ///   @brief Drains the events that the microkernel posted to the PP
+    ///     that this is executed on while the extension was executing
+    ///     (e.g., NMIs), allowing the extension to handle all of them
+    ///     in the same invocation instead of taking a VMExit for each.
+    ///     Any event returned is owned by the extension, meaning the
+    ///     microkernel will no longer deliver it on its own.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns a mask of the BF_POSTED_EVENT bits that were
+    ///     drained (0 if nothing was posted), or
+    ///     bsl::SafeU64::failure() on failure.
+    ///
+    pub fn bf_vs_op_drain_posted_events(&self) -> bsl::SafeU64 {
+        let ret: u64;
+        let mut events: bsl::SafeU64 = bsl::SafeU64::default();
+
+        unsafe {
+            ret = crate::bf_vs_op_drain_posted_events_impl(self.m_hndl.get(), events.data());
+        }
+        if crate::BF_STATUS_SUCCESS != ret {
+            error!(
+                "bf_vs_op_drain_posted_events failed with status {:#018x}\n{}",
+                ret,
+                bsl::here()
+            );
+
+            return bsl::SafeU64::failure();
+        }
+
+        return events;
+    }
+
     // ---------------------------------------------------------------------
     // bf_intrinsic_ops
     // ---------------------------------------------------------------------
@@ -1723,6 +1912,38 @@ impl BfSyscallT {
         return ptr as *mut T;
     }
 
+    /// <!-- description -->
+    ///   @brief bf_mem_op_free_page frees a page previously allocated
+    ///     by bf_mem_op_alloc_page. The memory is unmapped from the
+    ///     extension (including the direct map of every VM) and returned
+    ///     to the microkernel's page pool. The TLB is only flushed on the PP
+    ///     that this syscall is executed on, so the extension must ensure
+    ///     that no other PP is still accessing the memory.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ptr The virtual address returned by bf_mem_op_alloc_page
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     otherwise
+    ///
+    pub fn bf_mem_op_free_page(&self, ptr: bsl::CPtrT) -> bsl::ErrcType {
+        let ret: u64;
+
+        unsafe {
+            ret = crate::bf_mem_op_free_page_impl(self.m_hndl.get(), ptr);
+        }
+        if crate::BF_STATUS_SUCCESS != ret {
+            error!(
+                "bf_mem_op_free_page failed with status {:#018x}\n{}",
+                ret,
+                bsl::here()
+            );
+
+            return bsl::errc_failure;
+        }
+
+        return bsl::errc_success;
+    }
+
     /// <!-- description -->
     ///   @brief bf_mem_op_alloc_huge allocates a physically contiguous block
     ///     of memory. When allocating a page, the extension should keep in
@@ -1776,4 +1997,36 @@ impl BfSyscallT {
 
         return ptr as *mut T;
     }
+
+    /// <!-- description -->
+    ///   @brief bf_mem_op_free_huge frees memory previously allocated
+    ///     by bf_mem_op_alloc_huge. The memory is unmapped from the
+    ///     extension (including the direct map of every VM) and returned
+    ///     to the microkernel's huge pool. The TLB is only flushed on the PP
+    ///     that this syscall is executed on, so the extension must ensure
+    ///     that no other PP is still accessing the memory.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ptr The virtual address returned by bf_mem_op_alloc_huge
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     otherwise
+    ///
+    pub fn bf_mem_op_free_huge(&self, ptr: bsl::CPtrT) -> bsl::ErrcType {
+        let ret: u64;
+
+        unsafe {
+            ret = crate::bf_mem_op_free_huge_impl(self.m_hndl.get(), ptr);
+        }
+        if crate::BF_STATUS_SUCCESS != ret {
+            error!(
+                "bf_mem_op_free_huge failed with status {:#018x}\n{}",
+                ret,
+                bsl::here()
+            );
+
+            return bsl::errc_failure;
+        }
+
+        return bsl::errc_success;
+    }
 }
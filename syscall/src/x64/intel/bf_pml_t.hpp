@@ -0,0 +1,340 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BF_PML_T_HPP
+#define BF_PML_T_HPP
+
+#include "bf_constants.hpp"    // IWYU pragma: export
+#include "bf_reg_t.hpp"        // IWYU pragma: export
+
+#include <basic_page_4k_t.hpp>
+#include <bf_dirty_bitmap_t.hpp>    // IWYU pragma: export
+#include <bf_syscall_t.hpp>         // IWYU pragma: export
+// IWYU pragma: no_include "bf_syscall_t.hpp"
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace syscall
+{
+    /// @brief defines the number of entries in a PML buffer
+    constexpr auto BF_PML_ENTRIES{512_u64};
+    /// @brief defines the number of bytes in a PML buffer entry
+    constexpr auto BF_PML_ENTRY_BYTES{8_u64};
+    /// @brief defines the PML index of an empty PML buffer
+    constexpr auto BF_PML_INDEX_EMPTY{(BF_PML_ENTRIES - bsl::safe_u64::magic_1()).checked()};
+    /// @brief defines the "enable PML" bit in the secondary processor-based controls
+    constexpr auto BF_PML_ENABLE{0x0000000000020000_u64};
+    /// @brief defines the exit reason of a "page-modification log full" VMExit
+    constexpr auto BF_PML_EXIT_REASON_FULL{0x3E_u64};
+
+    /// <!-- description -->
+    ///   @brief Manages page-modification logging (PML) for an extension's
+    ///     VSs. Each VS is given its own PML buffer, and the hardware
+    ///     logs the guest physical address of every 4k page that a VM
+    ///     writes to while the dirty flag of the EPT entry that maps it is
+    ///     clear. The buffer is drained into a bf_dirty_bitmap_t, either
+    ///     when the buffer is full (BF_PML_EXIT_REASON_FULL), or whenever
+    ///     the extension needs an up-to-date bitmap (e.g., before each
+    ///     pass of a live migration).
+    ///
+    /// <!-- notes -->
+    ///   @note PML only logs a write when the hardware sets a dirty flag,
+    ///     so the EPT must be given to the VS with the accessed and dirty
+    ///     flags enabled (see basic_second_level_page_table_t's
+    ///     set_accessed_dirty()), and the extension must clear the dirty
+    ///     flag of a page (clear_dirty()) and flush the EPT before a write
+    ///     to that page will be logged again. A 2M or 1G block is only
+    ///     logged once, using the address that was written to, which is
+    ///     why drain() asks for the size of the block that maps each
+    ///     logged address and marks the whole block as dirty.
+    ///
+    ///   @note AMD does not support PML. Extensions walk the dirty flags
+    ///     in the NPT instead (harvest_dirty()), which can be drained into
+    ///     the same bf_dirty_bitmap_t.
+    ///
+    class bf_pml_t final
+    {
+        /// @brief stores the PML buffer of each VS
+        bsl::array<lib::basic_page_4k_t *, HYPERVISOR_MAX_VSS.get()> m_buf{};
+        /// @brief stores the physical address of the PML buffer of each VS
+        bsl::array<bsl::safe_u64, HYPERVISOR_MAX_VSS.get()> m_buf_phys{};
+
+        /// <!-- description -->
+        ///   @brief Returns the entry located at the provided index in the
+        ///     provided PML buffer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param buf the PML buffer to read
+        ///   @param idx the index of the entry to return
+        ///   @return Returns the entry located at the provided index.
+        ///
+        [[nodiscard]] static constexpr auto
+        read_entry(lib::basic_page_4k_t const *const buf, bsl::safe_u64 const &idx) noexcept
+            -> bsl::safe_u64
+        {
+            constexpr auto bits_per_byte{8_u64};
+            auto const offs{(idx * BF_PML_ENTRY_BYTES).checked()};
+
+            bsl::safe_u64 mut_entry{};
+            for (bsl::safe_idx mut_i{}; mut_i < BF_PML_ENTRY_BYTES; ++mut_i) {
+                auto const byte{*buf->data.at_if(bsl::to_idx(offs + bsl::to_u64(mut_i)))};
+                mut_entry |= bsl::to_u64(byte) << (bsl::to_u64(mut_i) * bits_per_byte).checked();
+            }
+
+            return mut_entry.checked();
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Releases the PML buffers of every VS. PML must already
+        ///     be disabled for every VS that was given a buffer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///
+        constexpr void
+        release(bf_syscall_t &mut_sys) noexcept
+        {
+            for (bsl::safe_idx mut_i{}; mut_i < m_buf.size(); ++mut_i) {
+                auto *const pmut_buf{*m_buf.at_if(mut_i)};
+                if (nullptr != pmut_buf) {
+                    bsl::discard(mut_sys.bf_mem_op_free_page(pmut_buf));
+                    *m_buf.at_if(mut_i) = nullptr;
+                    *m_buf_phys.at_if(mut_i) = {};
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Enables PML for the provided VS. The first time this
+        ///     is called for a VS, its PML buffer is allocated. The buffer
+        ///     starts out empty, so anything that was logged before PML
+        ///     was disabled has to be drained before this is called.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vsid the ID of the VS to enable PML for
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        enable(bf_syscall_t &mut_sys, bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vsid) < HYPERVISOR_MAX_VSS);
+
+            auto *const pmut_buf{m_buf.at_if(bsl::to_idx(vsid))};
+            auto *const pmut_buf_phys{m_buf_phys.at_if(bsl::to_idx(vsid))};
+
+            if (nullptr == *pmut_buf) {
+                *pmut_buf = mut_sys.bf_mem_op_alloc_page<lib::basic_page_4k_t>(*pmut_buf_phys);
+                if (bsl::unlikely(nullptr == *pmut_buf)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const ctls{mut_sys.bf_vs_op_read(
+                vsid, bf_reg_t::bf_reg_t_secondary_proc_based_vm_execution_ctls)};
+            if (bsl::unlikely(ctls.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            auto mut_ret{
+                mut_sys.bf_vs_op_write(vsid, bf_reg_t::bf_reg_t_pml_address, *pmut_buf_phys)};
+            if (bsl::unlikely(!mut_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return mut_ret;
+            }
+
+            mut_ret =
+                mut_sys.bf_vs_op_write(vsid, bf_reg_t::bf_reg_t_pml_index, BF_PML_INDEX_EMPTY);
+            if (bsl::unlikely(!mut_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return mut_ret;
+            }
+
+            mut_ret = mut_sys.bf_vs_op_write(
+                vsid,
+                bf_reg_t::bf_reg_t_secondary_proc_based_vm_execution_ctls,
+                (ctls | BF_PML_ENABLE).checked());
+            if (bsl::unlikely(!mut_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return mut_ret;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Disables PML for the provided VS. The VS's PML buffer
+        ///     is kept (along with anything that is still in it), so that
+        ///     it can be drained, and so that PML can be enabled again
+        ///     without allocating a new buffer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vsid the ID of the VS to disable PML for
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] static constexpr auto
+        disable(bf_syscall_t &mut_sys, bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vsid) < HYPERVISOR_MAX_VSS);
+
+            auto const ctls{mut_sys.bf_vs_op_read(
+                vsid, bf_reg_t::bf_reg_t_secondary_proc_based_vm_execution_ctls)};
+            if (bsl::unlikely(ctls.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            auto const ret{mut_sys.bf_vs_op_write(
+                vsid,
+                bf_reg_t::bf_reg_t_secondary_proc_based_vm_execution_ctls,
+                (ctls & ~BF_PML_ENABLE).checked())};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks every guest page that was logged in the provided
+        ///     VS's PML buffer as dirty in the provided bitmap, and then
+        ///     empties the buffer. This is what an extension does when the
+        ///     VS exits with BF_PML_EXIT_REASON_FULL, after which the VS
+        ///     can be resumed without advancing its instruction pointer.
+        ///     The VS must not be running on another PP. The hardware logs
+        ///     a single address for a write to a 2M or 1G block, so
+        ///     mut_page_size(gpa) is called for each logged address and
+        ///     must return the size of the block that maps it in the EPT
+        ///     (i.e., basic_second_level_page_table_t's page_size()), and
+        ///     the whole block is marked. If it returns 0 (the address was
+        ///     unmapped since it was logged), only the 4k page is marked.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FUNC the type of function that returns block sizes
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vsid the ID of the VS whose PML buffer is drained
+        ///   @param mut_bitmap the bitmap to mark the logged pages in
+        ///   @param mut_page_size returns the size of the block that maps
+        ///     the provided guest physical address
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        template<typename FUNC>
+        [[nodiscard]] constexpr auto
+        drain(
+            bf_syscall_t &mut_sys,
+            bsl::safe_u16 const &vsid,
+            bf_dirty_bitmap_t &mut_bitmap,
+            FUNC &&mut_page_size) const noexcept -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vsid) < HYPERVISOR_MAX_VSS);
+
+            auto const *const buf{*m_buf.at_if(bsl::to_idx(vsid))};
+            if (bsl::unlikely(nullptr == buf)) {
+                bsl::error() << "PML was never enabled for vs "    // --
+                             << bsl::hex(vsid)                     // --
+                             << bsl::endl                          // --
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            auto const idx{mut_sys.bf_vs_op_read(vsid, bf_reg_t::bf_reg_t_pml_index)};
+            if (bsl::unlikely(idx.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            /// NOTE:
+            /// - The hardware logs starting at the last entry and works its
+            ///   way down, decrementing the index after each entry. Once
+            ///   the first entry is used, the 16 bit index wraps, which is
+            ///   how a full buffer is detected.
+            ///
+
+            if (idx == BF_PML_INDEX_EMPTY) {
+                return bsl::errc_success;
+            }
+
+            bsl::safe_u64 mut_first{};
+            if (idx < BF_PML_INDEX_EMPTY) {
+                mut_first = (idx + bsl::safe_u64::magic_1()).checked();
+            }
+            else {
+                bsl::touch();
+            }
+
+            for (auto mut_i{mut_first}; mut_i < BF_PML_ENTRIES; ++mut_i) {
+                auto const gpa{(read_entry(buf, mut_i) & ~lib::BASIC_PAGE_4K_T_MASK).checked()};
+
+                bsl::safe_u64 mut_bytes{mut_page_size(gpa)};
+                if (mut_bytes.is_zero()) {
+                    mut_bytes = bsl::to_u64(HYPERVISOR_PAGE_SIZE);
+                }
+                else {
+                    bsl::touch();
+                }
+
+                auto const mask{(mut_bytes - bsl::safe_u64::magic_1()).checked()};
+                auto const ret{mut_bitmap.mark(mut_sys, (gpa & ~mask).checked(), mut_bytes)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+            }
+
+            return mut_sys.bf_vs_op_write(vsid, bf_reg_t::bf_reg_t_pml_index, BF_PML_INDEX_EMPTY);
+        }
+    };
+}
+
+#endif
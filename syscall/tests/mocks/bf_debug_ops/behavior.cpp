@@ -160,6 +160,30 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_debug_op_dump_syscall_stats"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                g_mut_bf_debug_op_dump_syscall_stats_impl_executed = {};
+                bsl::ut_when{} = []() noexcept {
+                    bf_debug_op_dump_syscall_stats({});
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(g_mut_bf_debug_op_dump_syscall_stats_impl_executed);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_debug_op_set_log_mask"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                g_mut_bf_debug_op_set_log_mask_impl_executed = {};
+                bsl::ut_when{} = []() noexcept {
+                    bf_debug_op_set_log_mask({});
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(g_mut_bf_debug_op_set_log_mask_impl_executed);
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
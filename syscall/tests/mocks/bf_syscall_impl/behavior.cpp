@@ -584,6 +584,30 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_debug_op_dump_syscall_stats_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_bf_debug_op_dump_syscall_stats_impl_executed = {};
+                    bf_debug_op_dump_syscall_stats_impl({});
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(g_mut_bf_debug_op_dump_syscall_stats_impl_executed);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_debug_op_set_log_mask_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_bf_debug_op_set_log_mask_impl_executed = {};
+                    bf_debug_op_set_log_mask_impl({});
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(g_mut_bf_debug_op_set_log_mask_impl_executed);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_callback_op_register_bootstrap_impl failure"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bsl::ut_when{} = []() noexcept {
@@ -667,6 +691,33 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_callback_op_register_tick_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_callback_op_register_tick_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_callback_op_register_tick_impl({}, {}, {})};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_callback_op_register_tick_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_callback_op_register_tick_impl({}, {}, {})};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_vm_op_create_vm_impl invalid arg0"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bsl::ut_when{} = []() noexcept {
@@ -865,6 +916,78 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vm_op_map_direct_range_impl invalid arg0"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_vm_op_map_direct_range_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_vm_op_map_direct_range_impl({}, {}, {}, {}, {})};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vm_op_map_direct_range_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_vm_op_map_direct_range_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    void *pmut_mut_ptr{};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{
+                            bf_vm_op_map_direct_range_impl({}, {}, {}, {}, &pmut_mut_ptr)};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vm_op_map_direct_range_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    void *pmut_mut_ptr{};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{
+                            bf_vm_op_map_direct_range_impl({}, {}, {}, {}, &pmut_mut_ptr)};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vm_op_unmap_direct_range_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_vm_op_unmap_direct_range_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_vm_op_unmap_direct_range_impl({}, {}, {}, {})};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vm_op_unmap_direct_range_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_vm_op_unmap_direct_range_impl({}, {}, {}, {})};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_vp_op_create_vp_impl invalid arg0"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bsl::ut_when{} = []() noexcept {
@@ -1389,6 +1512,54 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vs_op_drain_posted_events_impl invalid arg1"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_vs_op_drain_posted_events_impl({}, {})};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_drain_posted_events_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::safe_u64 mut_reg0_out{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_vs_op_drain_posted_events_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    g_mut_data.at("bf_vs_op_drain_posted_events_impl_reg0_out") = ANSWER64;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{
+                            bf_vs_op_drain_posted_events_impl({}, mut_reg0_out.data())};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                        bsl::ut_check(mut_reg0_out.is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_drain_posted_events_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::safe_u64 mut_reg0_out{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_vs_op_drain_posted_events_impl_reg0_out") = ANSWER64;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{
+                            bf_vs_op_drain_posted_events_impl({}, mut_reg0_out.data())};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                        bsl::ut_check(ANSWER64 == mut_reg0_out);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_intrinsic_op_rdmsr_impl invalid arg0"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bsl::ut_when{} = []() noexcept {
@@ -1538,6 +1709,33 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_mem_op_free_page_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_mem_op_free_page_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_mem_op_free_page_impl({}, {})};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_mem_op_free_page_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_mem_op_free_page_impl({}, {})};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_mem_op_alloc_huge_impl invalid arg0"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bsl::safe_u64 mut_reg1_out{};
@@ -1610,6 +1808,33 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_mem_op_free_huge_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_mem_op_free_huge_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_mem_op_free_huge_impl({}, {})};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_mem_op_free_huge_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_mem_op_free_huge_impl({}, {})};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
@@ -173,6 +173,26 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_callback_op_register_tick"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                constexpr auto period{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_sys.bf_callback_op_register_tick(&dummy_tick_entry, period));
+                    };
+
+                    mut_sys.set_bf_callback_op_register_tick(bsl::errc_failure);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            !mut_sys.bf_callback_op_register_tick(&dummy_tick_entry, period));
+                        bsl::ut_check(mut_sys.bf_callback_op_register_tick_count().is_pos());
+                    };
+                };
+            };
+        };
+
         // ---------------------------------------------------------------------
         // TLS ops
         // ---------------------------------------------------------------------
@@ -750,6 +770,40 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"set_direct_map_data"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bsl::safe_u64 const arg1{HYPERVISOR_PAGE_SIZE};
+                bsl::safe_u64 const arg2{(HYPERVISOR_PAGE_SIZE + 0x8_u64).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_sys.set_direct_map_data(arg0, arg2, ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ANSWER64 == mut_sys.direct_map_data(arg0, arg2));
+                        bsl::ut_check(mut_sys.direct_map_data(arg0, arg1).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vm_op_map_direct with direct map data"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bsl::safe_u64 const arg1{HYPERVISOR_PAGE_SIZE};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_sys.set_direct_map_data(arg0, arg1, ANSWER64);
+                    auto *const pmut_ptr{mut_sys.bf_vm_op_map_direct<page_t>(arg0, arg1)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ANSWER64 == bsl::to_u64(*pmut_ptr->data.at_if({})));
+                        *pmut_ptr->data.at_if({}) = {};
+                        bsl::ut_check(mut_sys.bf_vm_op_unmap_direct(arg0, pmut_ptr));
+                        bsl::ut_check(mut_sys.direct_map_data(arg0, arg1).is_zero());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_vm_op_unmap_direct bf_vm_op_unmap_direct_impl fails"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 bf_syscall_t mut_sys{};
@@ -844,6 +898,85 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vm_op_map_direct_range bf_vm_op_map_direct_range_impl fails"} =
+            []() noexcept {
+                bsl::ut_given{} = []() noexcept {
+                    bf_syscall_t mut_sys{};
+                    bsl::safe_u16 const arg0{};
+                    bsl::safe_u64 const arg1{HYPERVISOR_PAGE_SIZE};
+                    bsl::safe_u64 const arg2{HYPERVISOR_PAGE_SIZE};
+                    bsl::ut_when{} = [&]() noexcept {
+                        mut_sys.set_bf_vm_op_map_direct_range(arg0, bsl::errc_failure);
+                        bsl::ut_then{} = [&]() noexcept {
+                            bsl::ut_check(
+                                mut_sys.bf_vm_op_map_direct_range<page_t>(arg0, arg1, arg2) ==
+                                nullptr);
+                        };
+                    };
+                };
+            };
+
+        bsl::ut_scenario{"bf_vm_op_map_direct_range success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bsl::safe_u64 const arg1{HYPERVISOR_PAGE_SIZE};
+                bsl::safe_u64 const arg2{HYPERVISOR_PAGE_SIZE};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto *const pmut_ptr{
+                        mut_sys.bf_vm_op_map_direct_range<page_t>(arg0, arg1, arg2)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(pmut_ptr != nullptr);
+                        bsl::ut_check(mut_sys.bf_vm_op_map_direct_range_count().is_pos());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        bsl::discard(mut_sys.bf_vm_op_unmap_direct_range(arg0, pmut_ptr, arg2));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vm_op_unmap_direct_range bf_vm_op_unmap_direct_range_impl fails"} =
+            []() noexcept {
+                bsl::ut_given{} = []() noexcept {
+                    bf_syscall_t mut_sys{};
+                    bsl::safe_u16 const arg0{};
+                    bsl::safe_u64 const arg1{HYPERVISOR_PAGE_SIZE};
+                    bsl::safe_u64 const arg2{HYPERVISOR_PAGE_SIZE};
+                    bsl::ut_when{} = [&]() noexcept {
+                        auto *const pmut_ptr{
+                            mut_sys.bf_vm_op_map_direct_range<page_t>(arg0, arg1, arg2)};
+                        mut_sys.set_bf_vm_op_unmap_direct_range(arg0, bsl::errc_failure);
+                        bsl::ut_then{} = [&]() noexcept {
+                            bsl::ut_check(
+                                !mut_sys.bf_vm_op_unmap_direct_range(arg0, pmut_ptr, arg2));
+                        };
+                        bsl::ut_cleanup{} = [&]() noexcept {
+                            mut_sys.set_bf_vm_op_unmap_direct_range(arg0, {});
+                            bsl::discard(
+                                mut_sys.bf_vm_op_unmap_direct_range(arg0, pmut_ptr, arg2));
+                        };
+                    };
+                };
+            };
+
+        bsl::ut_scenario{"bf_vm_op_unmap_direct_range success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bsl::safe_u64 const arg1{HYPERVISOR_PAGE_SIZE};
+                bsl::safe_u64 const arg2{HYPERVISOR_PAGE_SIZE};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto *const pmut_ptr{
+                        mut_sys.bf_vm_op_map_direct_range<page_t>(arg0, arg1, arg2)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_vm_op_unmap_direct_range(arg0, pmut_ptr, arg2));
+                        bsl::ut_check(mut_sys.bf_vm_op_unmap_direct_range_count().is_pos());
+                    };
+                };
+            };
+        };
+
         // ---------------------------------------------------------------------
         // bf_vp_ops
         // ---------------------------------------------------------------------
@@ -1300,6 +1433,33 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vs_op_drain_posted_events fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_sys.set_bf_vs_op_drain_posted_events(bsl::safe_u64::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_vs_op_drain_posted_events().is_invalid());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_drain_posted_events success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_sys.set_bf_vs_op_drain_posted_events(BF_POSTED_EVENT_NMI);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_sys.bf_vs_op_drain_posted_events() == BF_POSTED_EVENT_NMI);
+                        bsl::ut_check(mut_sys.bf_vs_op_drain_posted_events().is_zero());
+                        bsl::ut_check(mut_sys.bf_vs_op_drain_posted_events_count().is_pos());
+                    };
+                };
+            };
+        };
+
         // ---------------------------------------------------------------------
         // bf_intrinsic_ops
         // ---------------------------------------------------------------------
@@ -1400,6 +1560,36 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_mem_op_free_page bf_mem_op_free_page_impl fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto *const pmut_ptr{mut_sys.bf_mem_op_alloc_page<page_t>()};
+                    mut_sys.set_bf_mem_op_free_page(bsl::errc_failure);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_mem_op_free_page(pmut_ptr));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_sys.set_bf_mem_op_free_page({});
+                        bsl::discard(mut_sys.bf_mem_op_free_page(pmut_ptr));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_mem_op_free_page success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto *const pmut_ptr{mut_sys.bf_mem_op_alloc_page<page_t>()};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_mem_op_free_page(pmut_ptr));
+                        bsl::ut_check(mut_sys.bf_mem_op_free_page_count().is_pos());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_mem_op_alloc_huge bf_mem_op_alloc_huge_impl fails"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 bf_syscall_t mut_sys{};
@@ -1442,6 +1632,38 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_mem_op_free_huge bf_mem_op_free_huge_impl fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u64 const size{HYPERVISOR_PAGE_SIZE};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto *const pmut_ptr{mut_sys.bf_mem_op_alloc_huge<page_t>(size)};
+                    mut_sys.set_bf_mem_op_free_huge(bsl::errc_failure);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_mem_op_free_huge(pmut_ptr));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_sys.set_bf_mem_op_free_huge({});
+                        bsl::discard(mut_sys.bf_mem_op_free_huge(pmut_ptr));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_mem_op_free_huge success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u64 const size{HYPERVISOR_PAGE_SIZE};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto *const pmut_ptr{mut_sys.bf_mem_op_alloc_huge<page_t>(size)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_mem_op_free_huge(pmut_ptr));
+                        bsl::ut_check(mut_sys.bf_mem_op_free_huge_count().is_pos());
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
@@ -64,6 +64,9 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_sys.initialize({}, {}, {}, {})));
                 static_assert(noexcept(mut_sys.set_initialize({})));
                 static_assert(noexcept(mut_sys.release()));
+                static_assert(noexcept(mut_sys.bf_callback_op_register_tick({}, {})));
+                static_assert(noexcept(mut_sys.set_bf_callback_op_register_tick({})));
+                static_assert(noexcept(mut_sys.bf_callback_op_register_tick_count()));
                 static_assert(noexcept(mut_sys.bf_tls_rax()));
                 static_assert(noexcept(mut_sys.bf_tls_set_rax({})));
                 static_assert(noexcept(mut_sys.bf_tls_rbx()));
@@ -112,12 +115,18 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_sys.set_bf_vm_op_destroy_vm({}, {})));
                 static_assert(noexcept(mut_sys.bf_vm_op_map_direct<page_t>({}, {})));
                 static_assert(noexcept(mut_sys.set_bf_vm_op_map_direct({}, {})));
+                static_assert(noexcept(mut_sys.set_direct_map_data({}, {}, {})));
+                static_assert(noexcept(mut_sys.direct_map_data({}, {})));
                 static_assert(noexcept(mut_sys.bf_vm_op_unmap_direct<page_t>({}, {})));
                 static_assert(noexcept(mut_sys.set_bf_vm_op_unmap_direct({}, {})));
                 static_assert(noexcept(mut_sys.bf_vm_op_unmap_direct_broadcast<page_t>({}, {})));
                 static_assert(noexcept(mut_sys.set_bf_vm_op_unmap_direct_broadcast({}, {})));
                 static_assert(noexcept(mut_sys.bf_vm_op_tlb_flush({})));
                 static_assert(noexcept(mut_sys.set_bf_vm_op_tlb_flush({}, {})));
+                static_assert(noexcept(mut_sys.bf_vm_op_map_direct_range<page_t>({}, {}, {})));
+                static_assert(noexcept(mut_sys.set_bf_vm_op_map_direct_range({}, {})));
+                static_assert(noexcept(mut_sys.bf_vm_op_unmap_direct_range<page_t>({}, {}, {})));
+                static_assert(noexcept(mut_sys.set_bf_vm_op_unmap_direct_range({}, {})));
                 static_assert(noexcept(mut_sys.bf_vp_op_create_vp({})));
                 static_assert(noexcept(mut_sys.set_bf_vp_op_create_vp({}, {})));
                 static_assert(noexcept(mut_sys.bf_vp_op_destroy_vp({})));
@@ -153,6 +162,8 @@ main() noexcept -> bsl::exit_code
                     noexcept(mut_sys.set_bf_vs_op_advance_ip_and_set_active({}, {}, {}, {})));
                 static_assert(noexcept(mut_sys.bf_vs_op_tlb_flush({}, {})));
                 static_assert(noexcept(mut_sys.set_bf_vs_op_tlb_flush({}, {}, {})));
+                static_assert(noexcept(mut_sys.bf_vs_op_drain_posted_events()));
+                static_assert(noexcept(mut_sys.set_bf_vs_op_drain_posted_events({})));
                 static_assert(noexcept(mut_sys.bf_intrinsic_op_rdmsr({})));
                 static_assert(noexcept(mut_sys.set_bf_intrinsic_op_rdmsr({}, {})));
                 static_assert(noexcept(mut_sys.bf_intrinsic_op_wrmsr({}, {})));
@@ -160,9 +171,13 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_sys.bf_mem_op_alloc_page<page_t>(mut_phys)));
                 static_assert(noexcept(mut_sys.bf_mem_op_alloc_page<page_t>()));
                 static_assert(noexcept(mut_sys.set_bf_mem_op_alloc_page({})));
+                static_assert(noexcept(mut_sys.bf_mem_op_free_page<page_t>({})));
+                static_assert(noexcept(mut_sys.set_bf_mem_op_free_page({})));
                 static_assert(noexcept(mut_sys.bf_mem_op_alloc_huge<page_t>({}, mut_phys)));
                 static_assert(noexcept(mut_sys.bf_mem_op_alloc_huge<page_t>({})));
                 static_assert(noexcept(mut_sys.set_bf_mem_op_alloc_huge({})));
+                static_assert(noexcept(mut_sys.bf_mem_op_free_huge<page_t>({})));
+                static_assert(noexcept(mut_sys.set_bf_mem_op_free_huge({})));
 
                 static_assert(noexcept(sys.bf_tls_rax()));
                 static_assert(noexcept(sys.bf_tls_rbx()));
@@ -0,0 +1,192 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../src/bf_dirty_bitmap_t.hpp"
+
+#include <bf_syscall_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace syscall
+{
+    /// @brief stores the first guest physical address tracked by the bitmap's second page
+    constexpr auto LEAF1{0x0000000008000000_u64};
+    /// @brief stores the size of a page as a bsl::safe_u64
+    constexpr auto PAGE{0x1000_u64};
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"nothing is dirty"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_dirty_bitmap_t const bitmap{};
+                bsl::safe_u64 mut_calls{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!bitmap.is_dirty({}));
+                    bsl::ut_check(!bitmap.is_dirty(LEAF1));
+                    bsl::ut_check(!bitmap.is_dirty(BF_DIRTY_BITMAP_MAX_GPA));
+                    bsl::ut_check(bitmap.dirty_pages().is_zero());
+                    bitmap.for_each([&](bsl::safe_u64 const &) noexcept {
+                        ++mut_calls;
+                    });
+                    bsl::ut_check(mut_calls.is_zero());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mark fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_dirty_bitmap_t mut_bitmap{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_bitmap.mark(mut_sys, BF_DIRTY_BITMAP_MAX_GPA, PAGE));
+                    mut_sys.set_bf_mem_op_alloc_page(bsl::errc_failure);
+                    bsl::ut_check(!mut_bitmap.mark(mut_sys, PAGE, PAGE));
+                    bsl::ut_check(!mut_bitmap.is_dirty(PAGE));
+                    bsl::ut_check(mut_bitmap.dirty_pages().is_zero());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mark"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_dirty_bitmap_t mut_bitmap{};
+                constexpr auto gpa{0x3123_u64};
+                constexpr auto bytes{0x3000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_bitmap.mark(mut_sys, PAGE, PAGE));
+                    bsl::ut_required_step(mut_bitmap.mark(mut_sys, PAGE, PAGE));
+                    bsl::ut_required_step(mut_bitmap.mark(mut_sys, gpa, bytes));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_bitmap.is_dirty({}));
+                        bsl::ut_check(mut_bitmap.is_dirty(0x1FFF_u64));
+                        bsl::ut_check(!mut_bitmap.is_dirty(0x2000_u64));
+                        bsl::ut_check(mut_bitmap.is_dirty(0x3000_u64));
+                        bsl::ut_check(mut_bitmap.is_dirty(0x6000_u64));
+                        bsl::ut_check(!mut_bitmap.is_dirty(0x7000_u64));
+                        bsl::ut_check(5_u64 == mut_bitmap.dirty_pages());
+                        bsl::ut_check(1_umx == mut_sys.bf_mem_op_alloc_page_count());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_bitmap.release(mut_sys);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mark across pages of the bitmap"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_dirty_bitmap_t mut_bitmap{};
+                constexpr auto gpa{(LEAF1 - PAGE).checked()};
+                constexpr auto bytes{0x2000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_bitmap.mark(mut_sys, gpa, bytes));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_bitmap.is_dirty(gpa));
+                        bsl::ut_check(mut_bitmap.is_dirty(LEAF1));
+                        bsl::ut_check(2_u64 == mut_bitmap.dirty_pages());
+                        bsl::ut_check(2_umx == mut_sys.bf_mem_op_alloc_page_count());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_bitmap.release(mut_sys);
+                        bsl::ut_check(2_umx == mut_sys.bf_mem_op_free_page_count());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"for_each and clear"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_dirty_bitmap_t mut_bitmap{};
+                constexpr auto gpa{0x0000000000200000_u64};
+                bsl::array<bsl::safe_u64, 4_umx.get()> mut_seen{};
+                bsl::safe_idx mut_num{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_bitmap.mark(mut_sys, LEAF1, PAGE));
+                    bsl::ut_required_step(mut_bitmap.mark(mut_sys, gpa, (PAGE + PAGE).checked()));
+                    bsl::ut_required_step(mut_bitmap.mark(mut_sys, PAGE, PAGE));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_bitmap.for_each([&](bsl::safe_u64 const &page) noexcept {
+                            *mut_seen.at_if(mut_num) = page;
+                            ++mut_num;
+                        });
+                        bsl::ut_check(4_idx == mut_num);
+                        bsl::ut_check(PAGE == *mut_seen.at_if(0_idx));
+                        bsl::ut_check(gpa == *mut_seen.at_if(1_idx));
+                        bsl::ut_check((gpa + PAGE).checked() == *mut_seen.at_if(2_idx));
+                        bsl::ut_check(LEAF1 == *mut_seen.at_if(3_idx));
+
+                        mut_bitmap.clear();
+                        bsl::ut_check(!mut_bitmap.is_dirty(PAGE));
+                        bsl::ut_check(!mut_bitmap.is_dirty(LEAF1));
+                        bsl::ut_check(mut_bitmap.dirty_pages().is_zero());
+                        bsl::ut_check(mut_sys.bf_mem_op_free_page_count().is_zero());
+
+                        bsl::ut_check(mut_bitmap.mark(mut_sys, LEAF1, PAGE));
+                        bsl::ut_check(2_umx == mut_sys.bf_mem_op_alloc_page_count());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_bitmap.release(mut_sys);
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(syscall::tests() == bsl::ut_success());
+    return syscall::tests();
+}
@@ -0,0 +1,511 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../src/bf_guest_walker_t.hpp"
+
+#include <bf_syscall_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace syscall
+{
+    // -------------------------------------------------------------------------
+    // constants
+    // -------------------------------------------------------------------------
+
+    /// @brief stores the ID of the VM used by the tests
+    constexpr auto VMID{0_u16};
+    /// @brief stores the ID of the VS used by the tests
+    constexpr auto VSID{0_u16};
+
+    /// @brief stores the guest physical address of the PML5
+    constexpr auto PML5{0x7000_u64};
+    /// @brief stores the guest physical address of the PML4
+    constexpr auto PML4{0x1000_u64};
+    /// @brief stores the guest physical address of the PDPT
+    constexpr auto PDPT{0x2000_u64};
+    /// @brief stores the guest physical address of the PD
+    constexpr auto PD{0x3000_u64};
+    /// @brief stores the guest physical address of the PT
+    constexpr auto PT{0x4000_u64};
+    /// @brief stores the guest physical address of the first data page
+    constexpr auto DATA0{0x5000_u64};
+    /// @brief stores the guest physical address of the second data page
+    constexpr auto DATA1{0x8000_u64};
+
+    /// @brief stores the guest virtual address used by the tests
+    constexpr auto GVA{0x0000000000401123_u64};
+    /// @brief stores the guest virtual address at the end of the first page
+    constexpr auto GVA_END{0x0000000000401FFC_u64};
+
+    /// @brief stores the present/writable flags of an entry
+    constexpr auto PW{0x3_u64};
+    /// @brief stores the present/writable/page size flags of an entry
+    constexpr auto PWS{0x83_u64};
+    /// @brief stores the size of a paging-structure entry
+    constexpr auto PTE{8_u64};
+
+    /// <!-- description -->
+    ///   @brief Sets up a guest using 4-level paging that maps GVA using a
+    ///     4k page to DATA0, and the page after GVA to DATA1.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to set up
+    ///
+    constexpr void
+    setup_guest(bf_syscall_t &mut_sys) noexcept
+    {
+        mut_sys.set_bf_vs_op_read(VSID, bf_reg_t::bf_reg_t_cr0, BF_GUEST_CR0_PG | BF_GUEST_CR0_WP);
+        mut_sys.set_bf_vs_op_read(VSID, bf_reg_t::bf_reg_t_cr3, PML4);
+        mut_sys.set_bf_vs_op_read(VSID, bf_reg_t::bf_reg_t_cr4, {});
+        mut_sys.set_bf_vs_op_read(VSID, bf_reg_t::bf_reg_t_efer, BF_GUEST_EFER_LMA);
+
+        mut_sys.set_direct_map_data(VMID, PML4, PDPT | PW);
+        mut_sys.set_direct_map_data(VMID, PDPT, PD | PW);
+        mut_sys.set_direct_map_data(VMID, (PD + PTE * 2_u64).checked(), PT | PW);
+        mut_sys.set_direct_map_data(VMID, (PT + PTE * 1_u64).checked(), DATA0 | PW);
+        mut_sys.set_direct_map_data(VMID, (PT + PTE * 2_u64).checked(), DATA1 | PW);
+    }
+
+    // -------------------------------------------------------------------------
+    // tests
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"translate paging disabled"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(GVA == mut_walker.translate(mut_sys, VMID, VSID, GVA));
+                    bsl::ut_check(mut_sys.bf_vm_op_map_direct_count().is_zero());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"translate 4k page"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const gpa{mut_walker.translate(mut_sys, VMID, VSID, GVA)};
+                        bsl::ut_check(0x5123_u64 == gpa);
+                        bsl::ut_check(4_umx == mut_sys.bf_vm_op_map_direct_count());
+                        bsl::ut_check(4_umx == mut_sys.bf_vm_op_unmap_direct_count());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"translate uses the software tlb"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(0x5123_u64 == mut_walker.translate(mut_sys, VMID, VSID, GVA));
+                        auto const gpa{mut_walker.translate(mut_sys, VMID, VSID, GVA_END)};
+                        bsl::ut_check(0x5FFC_u64 == gpa);
+                        bsl::ut_check(4_umx == mut_sys.bf_vm_op_map_direct_count());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"translate cr3 changed"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    bsl::ut_check(0x5123_u64 == mut_walker.translate(mut_sys, VMID, VSID, GVA));
+                    mut_sys.set_bf_vs_op_read(VSID, bf_reg_t::bf_reg_t_cr3, PML5);
+                    mut_sys.set_direct_map_data(VMID, PML5, PDPT | PW);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(0x5123_u64 == mut_walker.translate(mut_sys, VMID, VSID, GVA));
+                        bsl::ut_check(8_umx == mut_sys.bf_vm_op_map_direct_count());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"tlb_flush"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    bsl::ut_check(0x5123_u64 == mut_walker.translate(mut_sys, VMID, VSID, GVA));
+                    mut_sys.set_direct_map_data(VMID, (PT + PTE).checked(), DATA1 | PW);
+                    mut_walker.tlb_flush(VSID);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(0x8123_u64 == mut_walker.translate(mut_sys, VMID, VSID, GVA));
+                        bsl::ut_check(8_umx == mut_sys.bf_vm_op_map_direct_count());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"tlb_flush gva"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    bsl::ut_check(0x5123_u64 == mut_walker.translate(mut_sys, VMID, VSID, GVA));
+                    mut_sys.set_direct_map_data(VMID, (PT + PTE).checked(), DATA1 | PW);
+                    mut_walker.tlb_flush(VSID, GVA);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(0x8123_u64 == mut_walker.translate(mut_sys, VMID, VSID, GVA));
+                        bsl::ut_check(8_umx == mut_sys.bf_vm_op_map_direct_count());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"tlb_flush gva not cached"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    bsl::ut_check(0x5123_u64 == mut_walker.translate(mut_sys, VMID, VSID, GVA));
+                    mut_walker.tlb_flush(VSID, (GVA + 0x10000_u64).checked());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(0x5123_u64 == mut_walker.translate(mut_sys, VMID, VSID, GVA));
+                        bsl::ut_check(4_umx == mut_sys.bf_vm_op_map_direct_count());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"translate 2m page"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    mut_sys.set_direct_map_data(
+                        VMID, (PD + PTE * 2_u64).checked(), 0xA00000_u64 | PWS);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const gpa{mut_walker.translate(mut_sys, VMID, VSID, GVA)};
+                        bsl::ut_check(0xA01123_u64 == gpa);
+                        bsl::ut_check(3_umx == mut_sys.bf_vm_op_map_direct_count());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"translate 1g page"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    mut_sys.set_direct_map_data(VMID, PDPT, 0x40000000_u64 | PWS);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const gpa{mut_walker.translate(mut_sys, VMID, VSID, GVA)};
+                        bsl::ut_check(0x40401123_u64 == gpa);
+                        bsl::ut_check(2_umx == mut_sys.bf_vm_op_map_direct_count());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"translate 5-level paging"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    mut_sys.set_bf_vs_op_read(VSID, bf_reg_t::bf_reg_t_cr3, PML5);
+                    mut_sys.set_bf_vs_op_read(VSID, bf_reg_t::bf_reg_t_cr4, BF_GUEST_CR4_LA57);
+                    mut_sys.set_direct_map_data(VMID, PML5, PML4 | PW);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const gpa{mut_walker.translate(mut_sys, VMID, VSID, GVA)};
+                        bsl::ut_check(0x5123_u64 == gpa);
+                        bsl::ut_check(5_umx == mut_sys.bf_vm_op_map_direct_count());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"translate not present"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    mut_sys.set_direct_map_data(VMID, (PT + PTE).checked(), DATA0);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const gpa{mut_walker.translate(mut_sys, VMID, VSID, GVA)};
+                        bsl::ut_check(gpa.is_invalid());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"translate unsupported paging mode"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    mut_sys.set_bf_vs_op_read(VSID, bf_reg_t::bf_reg_t_efer, {});
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const gpa{mut_walker.translate(mut_sys, VMID, VSID, GVA)};
+                        bsl::ut_check(gpa.is_invalid());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"translate paging-structure cannot be mapped"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    mut_sys.set_bf_vs_op_read(VSID, bf_reg_t::bf_reg_t_cr3, {});
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const gpa{mut_walker.translate(mut_sys, VMID, VSID, GVA)};
+                        bsl::ut_check(gpa.is_invalid());
+                        bsl::ut_check(mut_sys.bf_vm_op_map_direct_count().is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"translate bf_vs_op_read cr3 fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    mut_sys.set_bf_vs_op_read(
+                        VSID, bf_reg_t::bf_reg_t_cr3, bsl::safe_u64::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const gpa{mut_walker.translate(mut_sys, VMID, VSID, GVA)};
+                        bsl::ut_check(gpa.is_invalid());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"translate bf_vs_op_read cr0 fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    mut_sys.set_bf_vs_op_read(
+                        VSID, bf_reg_t::bf_reg_t_cr0, bsl::safe_u64::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const gpa{mut_walker.translate(mut_sys, VMID, VSID, GVA)};
+                        bsl::ut_check(gpa.is_invalid());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"translate bf_vm_op_map_direct fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    mut_sys.set_bf_vm_op_map_direct(VMID, bsl::errc_failure);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const gpa{mut_walker.translate(mut_sys, VMID, VSID, GVA)};
+                        bsl::ut_check(gpa.is_invalid());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"translate read-only page"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    mut_sys.set_direct_map_data(VMID, (PT + PTE).checked(), DATA0 | BF_GUEST_PTE_P);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(0x5123_u64 == mut_walker.translate(mut_sys, VMID, VSID, GVA));
+                        auto const gpa{mut_walker.translate(mut_sys, VMID, VSID, GVA, true)};
+                        bsl::ut_check(gpa.is_invalid());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"translate read-only page without cr0.wp"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    mut_sys.set_bf_vs_op_read(VSID, bf_reg_t::bf_reg_t_cr0, BF_GUEST_CR0_PG);
+                    mut_sys.set_direct_map_data(VMID, (PT + PTE).checked(), DATA0 | BF_GUEST_PTE_P);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const gpa{mut_walker.translate(mut_sys, VMID, VSID, GVA, true)};
+                        bsl::ut_check(0x5123_u64 == gpa);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"read_guest_virt"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::array<bsl::uint8, PTE.get()> mut_buf{};
+                bsl::span<bsl::uint8> mut_span{mut_buf.data(), mut_buf.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    mut_sys.set_direct_map_data(VMID, 0x5FF8_u64, 0x1122334455667788_u64);
+                    mut_sys.set_direct_map_data(VMID, DATA1, 0x99AABBCCDDEEFF00_u64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_walker.read_guest_virt(mut_sys, VMID, VSID, GVA_END, mut_span));
+                        bsl::ut_check(0x44_u8 == *mut_buf.at_if(0_idx));
+                        bsl::ut_check(0x11_u8 == *mut_buf.at_if(3_idx));
+                        bsl::ut_check(0x00_u8 == *mut_buf.at_if(4_idx));
+                        bsl::ut_check(0xDD_u8 == *mut_buf.at_if(7_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"read_guest_virt not present"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::array<bsl::uint8, PTE.get()> mut_buf{};
+                bsl::span<bsl::uint8> mut_span{mut_buf.data(), mut_buf.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    mut_sys.set_direct_map_data(VMID, (PT + PTE * 2_u64).checked(), {});
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            !mut_walker.read_guest_virt(mut_sys, VMID, VSID, GVA_END, mut_span));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"read_guest_virt guest page cannot be mapped"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::array<bsl::uint8, PTE.get()> mut_buf{};
+                bsl::span<bsl::uint8> mut_span{mut_buf.data(), mut_buf.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    mut_sys.set_direct_map_data(VMID, (PT + PTE).checked(), PW);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            !mut_walker.read_guest_virt(mut_sys, VMID, VSID, GVA, mut_span));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"write_guest_virt"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::array<bsl::uint8, PTE.get()> const buf{0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8};
+                bsl::span<bsl::uint8 const> const span{buf.data(), buf.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_walker.write_guest_virt(mut_sys, VMID, VSID, GVA_END, span));
+                        auto const val0{mut_sys.direct_map_data(VMID, 0x5FF8_u64)};
+                        auto const val1{mut_sys.direct_map_data(VMID, DATA1)};
+                        bsl::ut_check(0x0403020100000000_u64 == val0);
+                        bsl::ut_check(0x0000000008070605_u64 == val1);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"write_guest_virt read-only page"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_guest_walker_t mut_walker{};
+                bsl::array<bsl::uint8, PTE.get()> const buf{};
+                bsl::span<bsl::uint8 const> const span{buf.data(), buf.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    setup_guest(mut_sys);
+                    mut_sys.set_direct_map_data(
+                        VMID, (PT + PTE * 2_u64).checked(), DATA1 | BF_GUEST_PTE_P);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            !mut_walker.write_guest_virt(mut_sys, VMID, VSID, GVA_END, span));
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(syscall::tests() == bsl::ut_success());
+    return syscall::tests();
+}
@@ -93,15 +93,20 @@ main() noexcept -> bsl::exit_code
             static_assert(noexcept(syscall::bf_debug_op_dump_ext_impl({})));
             static_assert(noexcept(syscall::bf_debug_op_dump_page_pool_impl()));
             static_assert(noexcept(syscall::bf_debug_op_dump_huge_pool_impl()));
+            static_assert(noexcept(syscall::bf_debug_op_dump_syscall_stats_impl({})));
+            static_assert(noexcept(syscall::bf_debug_op_set_log_mask_impl({})));
             static_assert(noexcept(syscall::bf_callback_op_register_bootstrap_impl({}, {})));
             static_assert(noexcept(syscall::bf_callback_op_register_vmexit_impl({}, {})));
             static_assert(noexcept(syscall::bf_callback_op_register_fail_impl({}, {})));
+            static_assert(noexcept(syscall::bf_callback_op_register_tick_impl({}, {}, {})));
             static_assert(noexcept(syscall::bf_vm_op_create_vm_impl({}, {})));
             static_assert(noexcept(syscall::bf_vm_op_destroy_vm_impl({}, {})));
             static_assert(noexcept(syscall::bf_vm_op_map_direct_impl({}, {}, {}, {})));
             static_assert(noexcept(syscall::bf_vm_op_unmap_direct_impl({}, {}, {})));
             static_assert(noexcept(syscall::bf_vm_op_unmap_direct_broadcast_impl({}, {}, {})));
             static_assert(noexcept(syscall::bf_vm_op_tlb_flush_impl({}, {})));
+            static_assert(noexcept(syscall::bf_vm_op_map_direct_range_impl({}, {}, {}, {}, {})));
+            static_assert(noexcept(syscall::bf_vm_op_unmap_direct_range_impl({}, {}, {}, {})));
             static_assert(noexcept(syscall::bf_vp_op_create_vp_impl({}, {}, {})));
             static_assert(noexcept(syscall::bf_vp_op_destroy_vp_impl({}, {})));
             static_assert(noexcept(syscall::bf_vs_op_create_vs_impl({}, {}, {}, {})));
@@ -120,10 +125,13 @@ main() noexcept -> bsl::exit_code
             static_assert(
                 noexcept(syscall::bf_vs_op_advance_ip_and_set_active_impl({}, {}, {}, {})));
             static_assert(noexcept(syscall::bf_vs_op_tlb_flush_impl({}, {}, {})));
+            static_assert(noexcept(syscall::bf_vs_op_drain_posted_events_impl({}, {})));
             static_assert(noexcept(syscall::bf_intrinsic_op_rdmsr_impl({}, {}, {})));
             static_assert(noexcept(syscall::bf_intrinsic_op_wrmsr_impl({}, {}, {})));
             static_assert(noexcept(syscall::bf_mem_op_alloc_page_impl({}, {}, {})));
+            static_assert(noexcept(syscall::bf_mem_op_free_page_impl({}, {})));
             static_assert(noexcept(syscall::bf_mem_op_alloc_huge_impl({}, {}, {}, {})));
+            static_assert(noexcept(syscall::bf_mem_op_free_huge_impl({}, {})));
         };
     };
 
@@ -182,6 +182,35 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_callback_op_register_tick fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                constexpr auto period{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_errc.at("bf_callback_op_register_tick_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            !mut_sys.bf_callback_op_register_tick(&dummy_tick_entry, period));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_callback_op_register_tick success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                constexpr auto period{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_sys.bf_callback_op_register_tick(&dummy_tick_entry, period));
+                    };
+                };
+            };
+        };
+
         // ---------------------------------------------------------------------
         // TLS ops
         // ---------------------------------------------------------------------
@@ -876,6 +905,85 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vm_op_map_direct_range bf_vm_op_map_direct_range_impl fails"} =
+            []() noexcept {
+                bsl::ut_given_at_runtime{} = []() noexcept {
+                    bf_syscall_t mut_sys{};
+                    bsl::safe_u16 const arg0{};
+                    bsl::safe_u64 const arg1{HYPERVISOR_PAGE_SIZE};
+                    bsl::safe_u64 const arg2{HYPERVISOR_PAGE_SIZE};
+                    bsl::ut_when{} = [&]() noexcept {
+                        g_mut_errc.clear();
+                        g_mut_errc.at("bf_vm_op_map_direct_range_impl") =
+                            BF_STATUS_FAILURE_UNKNOWN;
+                        bsl::ut_then{} = [&]() noexcept {
+                            bsl::ut_check(
+                                mut_sys.bf_vm_op_map_direct_range<page_t>(arg0, arg1, arg2) ==
+                                nullptr);
+                        };
+                    };
+                };
+            };
+
+        bsl::ut_scenario{"bf_vm_op_map_direct_range success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bsl::safe_u64 const arg1{HYPERVISOR_PAGE_SIZE};
+                bsl::safe_u64 const arg2{HYPERVISOR_PAGE_SIZE};
+                page_t mut_pg{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_ptrs.at("bf_vm_op_map_direct_range_impl_reg0_out") = &mut_pg;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_sys.bf_vm_op_map_direct_range<page_t>(arg0, arg1, arg2) ==
+                            &mut_pg);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vm_op_unmap_direct_range bf_vm_op_unmap_direct_range_impl fails"} =
+            []() noexcept {
+                bsl::ut_given_at_runtime{} = []() noexcept {
+                    bf_syscall_t mut_sys{};
+                    bsl::safe_u16 const arg0{};
+                    constexpr auto virt{
+                        (HYPERVISOR_EXT_DIRECT_MAP_ADDR + HYPERVISOR_PAGE_SIZE).checked()};
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                    page_t *const pmut_arg1{reinterpret_cast<page_t *>(virt.get())};
+                    bsl::safe_u64 const arg2{HYPERVISOR_PAGE_SIZE};
+                    bsl::ut_when{} = [&]() noexcept {
+                        g_mut_errc.clear();
+                        g_mut_errc.at("bf_vm_op_unmap_direct_range_impl") =
+                            BF_STATUS_FAILURE_UNKNOWN;
+                        bsl::ut_then{} = [&]() noexcept {
+                            bsl::ut_check(
+                                !mut_sys.bf_vm_op_unmap_direct_range(arg0, pmut_arg1, arg2));
+                        };
+                    };
+                };
+            };
+
+        bsl::ut_scenario{"bf_vm_op_unmap_direct_range success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                constexpr auto virt{
+                    (HYPERVISOR_EXT_DIRECT_MAP_ADDR + HYPERVISOR_PAGE_SIZE).checked()};
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                page_t *const pmut_arg1{reinterpret_cast<page_t *>(virt.get())};
+                bsl::safe_u64 const arg2{HYPERVISOR_PAGE_SIZE};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_vm_op_unmap_direct_range(arg0, pmut_arg1, arg2));
+                    };
+                };
+            };
+        };
+
         // ---------------------------------------------------------------------
         // bf_vp_ops
         // ---------------------------------------------------------------------
@@ -1452,6 +1560,38 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vs_op_drain_posted_events bf_vs_op_drain_posted_events_impl fails"} =
+            []() noexcept {
+                bsl::ut_given_at_runtime{} = []() noexcept {
+                    bf_syscall_t mut_sys{};
+                    bsl::ut_when{} = [&]() noexcept {
+                        g_mut_errc.clear();
+                        g_mut_data.clear();
+                        g_mut_errc.at("bf_vs_op_drain_posted_events_impl") =
+                            BF_STATUS_FAILURE_UNKNOWN;
+                        bsl::ut_then{} = [&]() noexcept {
+                            bsl::ut_check(mut_sys.bf_vs_op_drain_posted_events().is_invalid());
+                        };
+                    };
+                };
+            };
+
+        bsl::ut_scenario{"bf_vs_op_drain_posted_events success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_vs_op_drain_posted_events_impl_reg0_out") =
+                        BF_POSTED_EVENT_NMI;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_sys.bf_vs_op_drain_posted_events() == BF_POSTED_EVENT_NMI);
+                    };
+                };
+            };
+        };
+
         // ---------------------------------------------------------------------
         // bf_intrinsic_ops
         // ---------------------------------------------------------------------
@@ -1563,6 +1703,39 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_mem_op_free_page bf_mem_op_free_page_impl fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                constexpr auto virt{
+                    (HYPERVISOR_EXT_PAGE_POOL_ADDR + HYPERVISOR_PAGE_SIZE).checked()};
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                page_t const *const arg0{reinterpret_cast<page_t const *>(virt.get())};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_errc.at("bf_mem_op_free_page_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_mem_op_free_page(arg0));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_mem_op_free_page success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                constexpr auto virt{
+                    (HYPERVISOR_EXT_PAGE_POOL_ADDR + HYPERVISOR_PAGE_SIZE).checked()};
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                page_t const *const arg0{reinterpret_cast<page_t const *>(virt.get())};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_mem_op_free_page(arg0));
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_mem_op_alloc_huge bf_mem_op_alloc_huge_impl fails"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bf_syscall_t mut_sys{};
@@ -1606,6 +1779,39 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_mem_op_free_huge bf_mem_op_free_huge_impl fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                constexpr auto virt{
+                    (HYPERVISOR_EXT_HUGE_POOL_ADDR + HYPERVISOR_PAGE_SIZE).checked()};
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                page_t const *const arg0{reinterpret_cast<page_t const *>(virt.get())};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_errc.at("bf_mem_op_free_huge_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_mem_op_free_huge(arg0));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_mem_op_free_huge success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                constexpr auto virt{
+                    (HYPERVISOR_EXT_HUGE_POOL_ADDR + HYPERVISOR_PAGE_SIZE).checked()};
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                page_t const *const arg0{reinterpret_cast<page_t const *>(virt.get())};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_mem_op_free_huge(arg0));
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
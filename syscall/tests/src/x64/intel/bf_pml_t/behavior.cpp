@@ -0,0 +1,359 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../../../src/x64/intel/bf_pml_t.hpp"
+
+#include <basic_page_4k_t.hpp>
+#include <bf_dirty_bitmap_t.hpp>
+#include <bf_syscall_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace syscall
+{
+    /// @brief stores the ID of the VS used by the tests
+    constexpr auto VSID{0_u16};
+    /// @brief stores the secondary controls the VS starts out with
+    constexpr auto CTLS{0x0000000000000082_u64};
+    /// @brief stores the secondary controls of a VS with PML enabled
+    constexpr auto CTLS_PML{(CTLS | BF_PML_ENABLE).checked()};
+    /// @brief stores the PML index of a full PML buffer
+    constexpr auto INDEX_FULL{0xFFFF_u64};
+    /// @brief stores the size of a page as a bsl::safe_u64
+    constexpr auto PAGE{0x1000_u64};
+
+    /// @brief defines the register that stores the PML index
+    constexpr auto REG_INDEX{bf_reg_t::bf_reg_t_pml_index};
+    /// @brief defines the register that stores the secondary controls
+    constexpr auto REG_CTLS{bf_reg_t::bf_reg_t_secondary_proc_based_vm_execution_ctls};
+
+    /// <!-- description -->
+    ///   @brief Plays the role of the hardware, logging a write to the
+    ///     provided guest physical address in the PML buffer of VSID, and
+    ///     decrementing its PML index.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param gpa the guest physical address to log
+    ///
+    inline void
+    log_write(bf_syscall_t &mut_sys, bsl::safe_u64 const &gpa) noexcept
+    {
+        constexpr auto bits_per_byte{8_u64};
+        constexpr auto byte_mask{0xFF_u64};
+        constexpr auto index_mask{0xFFFF_u64};
+
+        auto const phys{mut_sys.bf_vs_op_read(VSID, bf_reg_t::bf_reg_t_pml_address)};
+        auto *const pmut_buf{mut_sys.alloc_page_virt<lib::basic_page_4k_t>(phys)};
+
+        auto const idx{mut_sys.bf_vs_op_read(VSID, REG_INDEX)};
+        auto const offs{(idx * BF_PML_ENTRY_BYTES).checked()};
+        for (bsl::safe_idx mut_i{}; mut_i < BF_PML_ENTRY_BYTES; ++mut_i) {
+            auto const shft{(bsl::to_u64(mut_i) * bits_per_byte).checked()};
+            auto const byte{bsl::to_u8((gpa >> shft) & byte_mask)};
+            *pmut_buf->data.at_if(bsl::to_idx(offs + bsl::to_u64(mut_i))) = byte.get();
+        }
+
+        auto const next{(idx + 0xFFFF_u64) & index_mask};
+        mut_sys.set_bf_vs_op_read(VSID, REG_INDEX, next.checked());
+    }
+
+    /// <!-- description -->
+    ///   @brief Plays the role of the EPT, returning the size of the block
+    ///     that maps the provided guest physical address. Unless a test
+    ///     says otherwise, every address is mapped using a 4k page.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param gpa the guest physical address to look up
+    ///   @return Returns the size of the block that maps gpa
+    ///
+    [[nodiscard]] constexpr auto
+    page_size_4k(bsl::safe_u64 const &gpa) noexcept -> bsl::safe_u64
+    {
+        bsl::discard(gpa);
+        return PAGE;
+    }
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"enable and disable"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_pml_t mut_pml{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_sys.set_bf_vs_op_read(VSID, REG_CTLS, CTLS);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_pml.enable(mut_sys, VSID));
+                        bsl::ut_check(CTLS_PML == mut_sys.bf_vs_op_read(VSID, REG_CTLS));
+                        bsl::ut_check(
+                            BF_PML_INDEX_EMPTY == mut_sys.bf_vs_op_read(VSID, REG_INDEX));
+                        bsl::ut_check(
+                            mut_sys.bf_vs_op_read(VSID, bf_reg_t::bf_reg_t_pml_address).is_pos());
+
+                        bsl::ut_check(mut_pml.disable(mut_sys, VSID));
+                        bsl::ut_check(CTLS == mut_sys.bf_vs_op_read(VSID, REG_CTLS));
+
+                        bsl::ut_check(mut_pml.enable(mut_sys, VSID));
+                        bsl::ut_check(1_umx == mut_sys.bf_mem_op_alloc_page_count());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_pml.release(mut_sys);
+                        bsl::ut_check(1_umx == mut_sys.bf_mem_op_free_page_count());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"enable fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_pml_t mut_pml{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_sys.set_bf_vs_op_read(VSID, REG_CTLS, CTLS);
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_sys.set_bf_mem_op_alloc_page(bsl::errc_failure);
+                        bsl::ut_check(!mut_pml.enable(mut_sys, VSID));
+                        mut_sys.set_bf_mem_op_alloc_page({});
+
+                        mut_sys.set_bf_vs_op_read(VSID, REG_CTLS, bsl::safe_u64::failure());
+                        bsl::ut_check(!mut_pml.enable(mut_sys, VSID));
+                        mut_sys.set_bf_vs_op_read(VSID, REG_CTLS, CTLS);
+
+                        mut_sys.set_bf_vs_op_write(
+                            VSID, REG_INDEX, BF_PML_INDEX_EMPTY, bsl::errc_failure);
+                        bsl::ut_check(!mut_pml.enable(mut_sys, VSID));
+                        mut_sys.set_bf_vs_op_write(VSID, REG_INDEX, BF_PML_INDEX_EMPTY, {});
+
+                        mut_sys.set_bf_vs_op_write(VSID, REG_CTLS, CTLS_PML, bsl::errc_failure);
+                        bsl::ut_check(!mut_pml.enable(mut_sys, VSID));
+                        bsl::ut_check(CTLS == mut_sys.bf_vs_op_read(VSID, REG_CTLS));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_pml.release(mut_sys);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"disable fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_sys.set_bf_vs_op_read(VSID, REG_CTLS, bsl::safe_u64::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!bf_pml_t::disable(mut_sys, VSID));
+                    };
+                };
+
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_sys.set_bf_vs_op_read(VSID, REG_CTLS, CTLS_PML);
+                    mut_sys.set_bf_vs_op_write(VSID, REG_CTLS, CTLS, bsl::errc_failure);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!bf_pml_t::disable(mut_sys, VSID));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"drain fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_pml_t mut_pml{};
+                bf_dirty_bitmap_t mut_bitmap{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_pml.drain(mut_sys, VSID, mut_bitmap, page_size_4k));
+                        bsl::ut_check(mut_pml.enable(mut_sys, VSID));
+                        mut_sys.set_bf_vs_op_read(VSID, REG_INDEX, bsl::safe_u64::failure());
+                        bsl::ut_check(!mut_pml.drain(mut_sys, VSID, mut_bitmap, page_size_4k));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_pml.release(mut_sys);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"drain an empty buffer"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_pml_t mut_pml{};
+                bf_dirty_bitmap_t mut_bitmap{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_pml.enable(mut_sys, VSID));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_pml.drain(mut_sys, VSID, mut_bitmap, page_size_4k));
+                        bsl::ut_check(mut_bitmap.dirty_pages().is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_pml.release(mut_sys);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"drain"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_pml_t mut_pml{};
+                bf_dirty_bitmap_t mut_bitmap{};
+                constexpr auto gpa0{0x0000000000005123_u64};
+                constexpr auto gpa1{0x0000000000009000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_pml.enable(mut_sys, VSID));
+                    log_write(mut_sys, gpa0);
+                    log_write(mut_sys, gpa1);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_pml.drain(mut_sys, VSID, mut_bitmap, page_size_4k));
+                        bsl::ut_check(mut_bitmap.is_dirty(gpa0));
+                        bsl::ut_check(mut_bitmap.is_dirty(gpa1));
+                        bsl::ut_check(2_u64 == mut_bitmap.dirty_pages());
+                        bsl::ut_check(
+                            BF_PML_INDEX_EMPTY == mut_sys.bf_vs_op_read(VSID, REG_INDEX));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_pml.release(mut_sys);
+                        mut_bitmap.release(mut_sys);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"drain a full buffer"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_pml_t mut_pml{};
+                bf_dirty_bitmap_t mut_bitmap{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_pml.enable(mut_sys, VSID));
+                    for (bsl::safe_u64 mut_i{}; mut_i < BF_PML_ENTRIES; ++mut_i) {
+                        log_write(mut_sys, (mut_i * PAGE).checked());
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(INDEX_FULL == mut_sys.bf_vs_op_read(VSID, REG_INDEX));
+                        bsl::ut_check(mut_pml.drain(mut_sys, VSID, mut_bitmap, page_size_4k));
+                        bsl::ut_check(BF_PML_ENTRIES == mut_bitmap.dirty_pages());
+                        bsl::ut_check(
+                            BF_PML_INDEX_EMPTY == mut_sys.bf_vs_op_read(VSID, REG_INDEX));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_pml.release(mut_sys);
+                        mut_bitmap.release(mut_sys);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"drain marks the whole block"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_pml_t mut_pml{};
+                bf_dirty_bitmap_t mut_bitmap{};
+                constexpr auto size_2m{0x0000000000200000_u64};
+                constexpr auto in_2m{0x0000000000234123_u64};
+                constexpr auto unmapped{0x0000000000600000_u64};
+                auto const page_size{[&](bsl::safe_u64 const &gpa) noexcept -> bsl::safe_u64 {
+                    if (gpa < unmapped) {
+                        return size_2m;
+                    }
+
+                    return {};
+                }};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_pml.enable(mut_sys, VSID));
+                    log_write(mut_sys, in_2m);
+                    log_write(mut_sys, unmapped);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_pml.drain(mut_sys, VSID, mut_bitmap, page_size));
+                        bsl::ut_check(mut_bitmap.is_dirty(size_2m));
+                        bsl::ut_check(mut_bitmap.is_dirty((size_2m * 2_u64 - PAGE).checked()));
+                        bsl::ut_check(!mut_bitmap.is_dirty((size_2m * 2_u64).checked()));
+                        bsl::ut_check(mut_bitmap.is_dirty(unmapped));
+                        bsl::ut_check(!mut_bitmap.is_dirty((unmapped + PAGE).checked()));
+                        bsl::ut_check(
+                            ((size_2m / PAGE) + 1_u64).checked() == mut_bitmap.dirty_pages());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_pml.release(mut_sys);
+                        mut_bitmap.release(mut_sys);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"drain fails to mark the bitmap"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bf_pml_t mut_pml{};
+                bf_dirty_bitmap_t mut_bitmap{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_pml.enable(mut_sys, VSID));
+                    log_write(mut_sys, PAGE);
+                    mut_sys.set_bf_mem_op_alloc_page(bsl::errc_failure);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_pml.drain(mut_sys, VSID, mut_bitmap, page_size_4k));
+                        bsl::ut_check(mut_bitmap.dirty_pages().is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_pml.release(mut_sys);
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(syscall::tests() == bsl::ut_success());
+    return syscall::tests();
+}
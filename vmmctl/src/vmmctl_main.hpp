@@ -26,16 +26,22 @@
 #define VMMCTL_MAIN_HPP
 
 #include <debug_ring_t.hpp>
+#include <dump_trace_args_t.hpp>
 #include <dump_vmm_args_t.hpp>
+#include <host_mem_t.hpp>
 #include <ifmap_t.hpp>
 #include <ioctl_t.hpp>
 #include <loader_platform_interface.hpp>
+#include <reload_vmm_args_t.hpp>
+#include <set_log_mask_args_t.hpp>
 #include <start_vmm_args_t.hpp>
 #include <stop_vmm_args_t.hpp>
+#include <trace_record_t.hpp>
 
 #include <bsl/arguments.hpp>
 #include <bsl/array.hpp>
 #include <bsl/carray.hpp>
+#include <bsl/char_type.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/errc_type.hpp>
@@ -51,11 +57,21 @@ namespace vmmctl
     /// @brief defines the IOCTL version this code supports.
     constexpr auto IOCTL_VERSION{1_umx};
 
+    /// @brief defines the number of bytes in a KB
+    constexpr auto POOL_SIZE_KB{0x400_umx};
+    /// @brief defines the number of bytes in a MB
+    constexpr auto POOL_SIZE_MB{0x100000_umx};
+    /// @brief defines the number of bytes in a GB
+    constexpr auto POOL_SIZE_GB{0x40000000_umx};
+    /// @brief defines the largest percentage of host memory a pool can use
+    constexpr auto POOL_SIZE_MAX_PERCENT{100_umx};
+
     /// <!-- description -->
     ///   @brief Provides the main implementation of the vmmctl application.
-    ///     This application is used to start and stop the VMM as well as
-    ///     to dump the contents of the VMM's internal debug ring to the
-    ///     console for debugging.
+    ///     This application is used to start and stop the VMM, to reload
+    ///     the VMM's extensions, to dump the contents of the VMM's internal
+    ///     debug ring to the console for debugging, to summarize the VMM's
+    ///     trace rings, and to set the VMM's runtime log mask.
     ///
     class vmmctl_main final
     {
@@ -65,12 +81,143 @@ namespace vmmctl
         static constexpr void
         help() noexcept
         {
-            bsl::print() << "Usage: vmmctl start microkernel ext1 <ext2> ..." << bsl::endl;
+            bsl::print() << "Usage: vmmctl start [options] microkernel ext1 <ext2> ...";
+            bsl::print() << bsl::endl;
+            bsl::print() << "  or:  vmmctl reload ext1 <ext2> ..." << bsl::endl;
             bsl::print() << "  or:  vmmctl stop" << bsl::endl;
             bsl::print() << "  or:  vmmctl dump" << bsl::endl;
+            bsl::print() << "  or:  vmmctl trace" << bsl::endl;
+            bsl::print() << "  or:  vmmctl loglevel mask" << bsl::endl;
             bsl::print() << bsl::endl;
             bsl::print() << "A utility for managing the Bareflank Hypervisor's VMM";
             bsl::print() << bsl::endl;
+            bsl::print() << bsl::endl;
+            bsl::print() << "Start options (size is in bytes, with an optional K, M or G";
+            bsl::print() << bsl::endl;
+            bsl::print() << "suffix, or a percentage of host memory, e.g. 256M or 5%):";
+            bsl::print() << bsl::endl;
+            bsl::print() << "  --page-pool=size          size of the microkernel's page pool";
+            bsl::print() << bsl::endl;
+            bsl::print() << "  --huge-pool=size          size of the microkernel's huge pool";
+            bsl::print() << bsl::endl;
+            bsl::print() << "  --page-pool-reserve=size  pages the page pool may grow into";
+            bsl::print() << bsl::endl;
+        }
+
+        /// <!-- description -->
+        ///   @brief Converts a user provided pool size into a number of
+        ///     pages. The size is either a number of bytes with an optional
+        ///     K, M or G suffix, or a percentage of the host's memory when
+        ///     followed by a %. An empty size returns 0, which tells the
+        ///     loader to use its default size.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the user provided pool size
+        ///   @return Returns the number of pages in the pool, or
+        ///     bsl::safe_u32::failure() if the size is invalid.
+        ///
+        [[nodiscard]] static constexpr auto
+        pool_size_to_pages(bsl::string_view const &str) noexcept -> bsl::safe_u32
+        {
+            constexpr auto base{10_umx};
+            constexpr auto max_pages{bsl::to_umx(bsl::safe_u32::max_value())};
+
+            if (str.empty()) {
+                return {};
+            }
+
+            bsl::safe_umx mut_val{};
+            bsl::safe_umx mut_digits{};
+            bsl::safe_umx mut_bytes{};
+            bsl::char_type mut_suffix{};
+
+            for (bsl::safe_idx mut_i{}; mut_i < str.size(); ++mut_i) {
+                auto const c{*str.at_if(mut_i)};
+                if ((c < '0') || (c > '9')) {
+                    if (bsl::unlikely((mut_i + bsl::safe_idx::magic_1()) != str.size())) {
+                        bsl::error() << "invalid pool size: \"" << str << "\"\n";
+                        return bsl::safe_u32::failure();
+                    }
+
+                    mut_suffix = c;
+                    break;
+                }
+
+                mut_val *= base;
+                mut_val += bsl::to_umx(static_cast<bsl::uintmx>(c - '0'));
+                ++mut_digits;
+            }
+
+            if (bsl::unlikely(mut_digits.is_zero())) {
+                bsl::error() << "invalid pool size: \"" << str << "\"\n";
+                return bsl::safe_u32::failure();
+            }
+
+            if (bsl::unlikely(mut_val.is_invalid())) {
+                bsl::error() << "pool size is too large: \"" << str << "\"\n";
+                return bsl::safe_u32::failure();
+            }
+
+            switch (mut_suffix) {
+                case '\0': {
+                    mut_bytes = mut_val;
+                    break;
+                }
+
+                case 'k':
+                    [[fallthrough]];
+                case 'K': {
+                    mut_bytes = mut_val * POOL_SIZE_KB;
+                    break;
+                }
+
+                case 'm':
+                    [[fallthrough]];
+                case 'M': {
+                    mut_bytes = mut_val * POOL_SIZE_MB;
+                    break;
+                }
+
+                case 'g':
+                    [[fallthrough]];
+                case 'G': {
+                    mut_bytes = mut_val * POOL_SIZE_GB;
+                    break;
+                }
+
+                case '%': {
+                    if (bsl::unlikely(mut_val > POOL_SIZE_MAX_PERCENT)) {
+                        bsl::error() << "invalid pool percentage: \"" << str << "\"\n";
+                        return bsl::safe_u32::failure();
+                    }
+
+                    mut_bytes = (host_mem_t::total() / POOL_SIZE_MAX_PERCENT) * mut_val;
+                    break;
+                }
+
+                default: {
+                    bsl::error() << "invalid pool size suffix: \"" << str << "\"\n";
+                    return bsl::safe_u32::failure();
+                }
+            }
+
+            if (bsl::unlikely(mut_bytes.is_invalid())) {
+                bsl::error() << "invalid pool size: \"" << str << "\"\n";
+                return bsl::safe_u32::failure();
+            }
+
+            auto const pages{(mut_bytes / HYPERVISOR_PAGE_SIZE).checked()};
+            if (bsl::unlikely(pages.is_zero())) {
+                bsl::error() << "pool size is smaller than a page: \"" << str << "\"\n";
+                return bsl::safe_u32::failure();
+            }
+
+            if (bsl::unlikely(pages > max_pages)) {
+                bsl::error() << "pool size is too large: \"" << str << "\"\n";
+                return bsl::safe_u32::failure();
+            }
+
+            return bsl::to_u32(pages);
         }
 
         /// <!-- description -->
@@ -86,7 +233,31 @@ namespace vmmctl
         [[nodiscard]] static constexpr auto
         start_vmm(bsl::arguments &mut_args, ioctl_t &mut_ioctl) noexcept -> bsl::errc_type
         {
-            loader::start_vmm_args_t mut_start_args{IOCTL_VERSION.get(), {}, {}, {}, {}};
+            loader::start_vmm_args_t mut_start_args{
+                loader::START_VMM_ARGS_VER.get(), {}, {}, {}, {}, {}, {}};
+
+            auto const page_pool{pool_size_to_pages(mut_args.get<bsl::string_view>("--page-pool"))};
+            if (bsl::unlikely(page_pool.is_invalid())) {
+                help();
+                return bsl::errc_failure;
+            }
+
+            auto const huge_pool{pool_size_to_pages(mut_args.get<bsl::string_view>("--huge-pool"))};
+            if (bsl::unlikely(huge_pool.is_invalid())) {
+                help();
+                return bsl::errc_failure;
+            }
+
+            auto const reserve{
+                pool_size_to_pages(mut_args.get<bsl::string_view>("--page-pool-reserve"))};
+            if (bsl::unlikely(reserve.is_invalid())) {
+                help();
+                return bsl::errc_failure;
+            }
+
+            mut_start_args.num_pages_in_page_pool = page_pool.get();
+            mut_start_args.num_pages_in_huge_pool = huge_pool.get();
+            mut_start_args.num_pages_in_page_pool_reserve = reserve.get();
 
             auto const mk_filename{mut_args.front<bsl::string_view>()};
             if (mk_filename.empty()) {
@@ -142,6 +313,61 @@ namespace vmmctl
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Reloads the VMM's extensions given a set of ioctl_t
+        ///     arguments to send to the loader. The microkernel and the
+        ///     page/huge pools that were provided to "vmmctl start" are kept,
+        ///     so this is much faster than stopping and starting the VMM.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_args the command line arguments provided by the user.
+        ///   @param mut_ioctl the ioctl_t to use
+        ///   @return Returns bsl::errc_success if the VMM was successfully
+        ///     reloaded, otherwise returns bsl::errc_failure.
+        ///
+        [[nodiscard]] static constexpr auto
+        reload_vmm(bsl::arguments &mut_args, ioctl_t &mut_ioctl) noexcept -> bsl::errc_type
+        {
+            loader::reload_vmm_args_t mut_reload_args{IOCTL_VERSION.get(), {}};
+
+            auto mut_ext_filename{mut_args.front<bsl::string_view>()};
+            if (mut_ext_filename.empty()) {
+                bsl::error() << "the extension's path is either missing or empty\n";
+                help();
+                return bsl::errc_failure;
+            }
+
+            bsl::array<ifmap_t, HYPERVISOR_MAX_EXTENSIONS.get()> mut_ext_maps{};
+            for (bsl::safe_idx mut_i{}; mut_i < HYPERVISOR_MAX_EXTENSIONS; ++mut_i) {
+                auto *const pmut_ext_map{mut_ext_maps.at_if(mut_i)};
+                auto *const pmut_ext_elf{mut_reload_args.ext_elf_files.at_if(mut_i)};
+
+                *pmut_ext_map = ifmap_t{mut_ext_filename};
+                if (bsl::unlikely(pmut_ext_map->empty())) {
+                    help();
+                    return bsl::errc_failure;
+                }
+
+                *pmut_ext_elf = pmut_ext_map->view();
+
+                ++mut_args;
+                mut_ext_filename = mut_args.front<bsl::string_view>();
+                if (mut_ext_filename.empty()) {
+                    break;
+                }
+
+                bsl::touch();
+            }
+
+            auto const ret{mut_ioctl.write(loader::RELOAD_VMM, &mut_reload_args)};
+            if (bsl::unlikely(ret.is_neg())) {
+                bsl::error() << "vmmctl failed. check kernel logs details\n";
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief Stops the VMM given a set of ioctl_t arguments to send
         ///     to the loader.
@@ -219,6 +445,161 @@ namespace vmmctl
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Dumps a summary of the VMM's trace rings given a set of
+        ///     ioctl_t arguments to send to the loader. Each probe marks the
+        ///     start of a phase, so the time spent in a phase is the number
+        ///     of TSC ticks between a record and the next record on the same
+        ///     PP. These are summed per probe across all online PPs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_ioctl the ioctl_t to use
+        ///   @return Returns bsl::errc_success if the trace rings were
+        ///     successfully dumped to the console, otherwise returns
+        ///     bsl::errc_failure.
+        ///
+        [[nodiscard]] static constexpr auto
+        dump_trace(ioctl_t &mut_ioctl) noexcept -> bsl::errc_type
+        {
+            bsl::array<bsl::string_view, loader::TRACE_PROBE_MAX.get()> const names{
+                "vmexit",
+                "call_ext",
+                "syscall",
+                "syscall_ret",
+                "vs_run",
+                "page_alloc",
+                "page_alloc_ret"};
+
+            bsl::array<bsl::safe_u64, loader::TRACE_PROBE_MAX.get()> mut_counts{};
+            bsl::array<bsl::safe_u64, loader::TRACE_PROBE_MAX.get()> mut_ticks{};
+            bsl::safe_u64 mut_dropped{};
+            bsl::safe_u64 mut_total{};
+
+            loader::dump_trace_args_t mut_trace_args{};
+            bsl::safe_u16 mut_online_pps{bsl::safe_u16::magic_1()};
+
+            for (bsl::safe_u16 mut_ppid{}; mut_ppid < mut_online_pps; ++mut_ppid) {
+                mut_trace_args.ver = IOCTL_VERSION.get();
+                mut_trace_args.ppid = mut_ppid.get();
+
+                auto const ret{mut_ioctl.read_write(loader::DUMP_TRACE, &mut_trace_args)};
+                if (bsl::unlikely(ret.is_neg())) {
+                    bsl::error() << "vmmctl failed. check kernel logs details\n";
+                    return bsl::errc_failure;
+                }
+
+                mut_online_pps = bsl::to_u16(mut_trace_args.online_pps);
+
+                auto const &ring{mut_trace_args.trace_ring};
+                auto const size{bsl::to_u64(ring.buf.size())};
+                auto const epos{bsl::to_u64(ring.epos)};
+
+                bsl::safe_u64 mut_spos{};
+                if (epos > size) {
+                    mut_spos = (epos - size).checked();
+                    mut_dropped += mut_spos;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                for (bsl::safe_u64 mut_i{mut_spos}; mut_i < epos; ++mut_i) {
+                    auto const *const rec{ring.buf.at_if((mut_i % size).get())};
+                    auto const probe{bsl::to_idx(rec->probe)};
+
+                    if (bsl::unlikely(probe >= mut_counts.size())) {
+                        bsl::error() << "kernel returned an invalid trace ring\n";
+                        return bsl::errc_failure;
+                    }
+
+                    auto const next{(mut_i + bsl::safe_u64::magic_1()).checked()};
+                    if (next >= epos) {
+                        break;
+                    }
+
+                    auto const *const nxt{ring.buf.at_if((next % size).get())};
+                    auto const tsc{bsl::to_u64(rec->tsc)};
+                    auto const nxt_tsc{bsl::to_u64(nxt->tsc)};
+
+                    /// NOTE:
+                    /// - The TSC is not guaranteed to be monotonic across a
+                    ///   migration or a reset of the TSC, so any negative
+                    ///   deltas are simply ignored.
+                    ///
+
+                    if (nxt_tsc >= tsc) {
+                        *mut_counts.at_if(probe) += bsl::safe_u64::magic_1();
+                        *mut_ticks.at_if(probe) += (nxt_tsc - tsc).checked();
+                        ++mut_total;
+                    }
+                    else {
+                        bsl::touch();
+                    }
+                }
+            }
+
+            if (mut_total.is_zero()) {
+                bsl::alert() << "no trace data to dump\n";
+                return bsl::errc_success;
+            }
+
+            for (bsl::safe_idx mut_i{}; mut_i < names.size(); ++mut_i) {
+                auto const count{mut_counts.at_if(mut_i)->checked()};
+                auto const ticks{mut_ticks.at_if(mut_i)->checked()};
+
+                if (count.is_pos()) {
+                    bsl::print() << *names.at_if(mut_i) << ": count " << count << ", ticks "
+                                 << ticks << ", avg " << (ticks / count).checked() << bsl::endl;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            if (mut_dropped.is_pos()) {
+                bsl::print() << "dropped " << mut_dropped.checked()
+                             << " records (see HYPERVISOR_TRACE_RING_SIZE)" << bsl::endl;
+            }
+            else {
+                bsl::touch();
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the VMM's runtime log mask given a set of ioctl_t
+        ///     arguments to send to the loader. The log mask is made up of
+        ///     a 4 bit log level for each of the microkernel's subsystems
+        ///     (see BF_LOG_SUBSYSTEM_xxx).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_args the command line arguments provided by the user.
+        ///   @param mut_ioctl the ioctl_t to use
+        ///   @return Returns bsl::errc_success if the log mask was
+        ///     successfully set, otherwise returns bsl::errc_failure.
+        ///
+        [[nodiscard]] static constexpr auto
+        set_log_mask(bsl::arguments &mut_args, ioctl_t &mut_ioctl) noexcept -> bsl::errc_type
+        {
+            auto const mask{mut_args.front<bsl::safe_u64>()};
+            if (bsl::unlikely(mask.is_invalid())) {
+                bsl::error() << "the log mask is either missing or invalid\n";
+                help();
+                return bsl::errc_failure;
+            }
+
+            loader::set_log_mask_args_t const log_args{IOCTL_VERSION.get(), mask.get()};
+
+            auto const ret{mut_ioctl.write(loader::SET_LOG_MASK, &log_args)};
+            if (bsl::unlikely(ret.is_neg())) {
+                bsl::error() << "vmmctl failed. check kernel logs details\n";
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief Process the user provided command line arguments assuming
         ///     the first argument is the command while also ignoring "help".
@@ -243,6 +624,10 @@ namespace vmmctl
                 return this->start_vmm(mut_args, mut_ioctl);
             }
 
+            if (cmd == "reload") {
+                return this->reload_vmm(mut_args, mut_ioctl);
+            }
+
             if (cmd == "stop") {
                 return this->stop_vmm(mut_ioctl);
             }
@@ -251,6 +636,14 @@ namespace vmmctl
                 return this->dump_vmm(mut_ioctl);
             }
 
+            if (cmd == "trace") {
+                return this->dump_trace(mut_ioctl);
+            }
+
+            if (cmd == "loglevel") {
+                return this->set_log_mask(mut_args, mut_ioctl);
+            }
+
             if (cmd.empty()) {
                 bsl::error() << "missing command\n";
             }
@@ -45,6 +45,12 @@ namespace loader
     constexpr auto STOP_VMM{0x2_umx};
     /// @brief defines IOCTL for dumping a VMs debug ring
     constexpr auto DUMP_VMM{0x3_umx};
+    /// @brief defines IOCTL for setting a VMs runtime log mask
+    constexpr auto SET_LOG_MASK{0x4_umx};
+    /// @brief defines IOCTL for reloading a VMs extensions
+    constexpr auto RELOAD_VMM{0x5_umx};
+    /// @brief defines IOCTL for dumping a PPs trace ring
+    constexpr auto DUMP_TRACE{0x6_umx};
 }
 
 #endif
@@ -25,13 +25,16 @@
 #include "../../../src/vmmctl_main.hpp"
 
 #include <debug_ring_t.hpp>
+#include <dump_trace_args_t.hpp>
 #include <dump_vmm_args_t.hpp>
 #include <ioctl_t.hpp>
 #include <loader_platform_interface.hpp>
+#include <trace_record_t.hpp>
 
 #include <bsl/arguments.hpp>
 #include <bsl/array.hpp>
 #include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
@@ -50,6 +53,11 @@ namespace mk
     [[nodiscard]] constexpr auto
     tests() noexcept -> bsl::exit_code
     {
+        // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+        constexpr bsl::uintmx idx0{};
+        // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+        constexpr bsl::uintmx idx1{1U};
+
         bsl::ut_scenario{"help"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 vmmctl::vmmctl_main mut_vmmctl{};
@@ -168,6 +176,121 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"start with pool sizes"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{
+                    "start",
+                    "--page-pool=256M",
+                    "--huge-pool=1%",
+                    "--page-pool-reserve=64K",
+                    "kernel",
+                    "extension"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"start with a pool size in bytes"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"start", "--page-pool=1048576", "kernel", "extension"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"start with a pool size in GB"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"start", "--page-pool=1G", "kernel", "extension"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"start with an invalid pool size"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"start", "--page-pool=M", "kernel", "extension"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"start with an invalid pool size suffix"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"start", "--huge-pool=1X", "kernel", "extension"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"start with trailing characters in the pool size"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"start", "--huge-pool=1MB", "kernel", "extension"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"start with an invalid pool percentage"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"start", "--page-pool=101%", "kernel", "extension"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"start with a pool smaller than a page"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"start", "--page-pool-reserve=1K", "kernel", "extension"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"start with a pool that is too large"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{
+                    "start", "--page-pool=99999999999999999999", "kernel", "extension"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
         bsl::ut_scenario{"start fails"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 vmmctl::vmmctl_main mut_vmmctl{};
@@ -180,6 +303,54 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"reload"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"reload", "extension1", "extension2"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"reload empty extension path"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"reload", ""};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"reload invalid extension path"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"reload", "failure"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"reload fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"failure"};
+                bsl::array const argv{"reload", "extension"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
         bsl::ut_scenario{"stop"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 vmmctl::vmmctl_main mut_vmmctl{};
@@ -204,6 +375,42 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"loglevel"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"loglevel", "4640"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"loglevel missing mask"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"loglevel"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"loglevel fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"failure"};
+                bsl::array const argv{"loglevel", "4640"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
         bsl::ut_scenario{"dump"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 vmmctl::vmmctl_main mut_vmmctl{};
@@ -316,6 +523,108 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"trace"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"trace"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                loader::dump_trace_args_t mut_trace_args{};
+                constexpr auto epos{3_u64};
+                constexpr auto tsc0{30_u64};
+                constexpr auto tsc1{20_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto *const pmut_rec0{mut_trace_args.trace_ring.buf.at_if(idx0)};
+                    auto *const pmut_rec1{mut_trace_args.trace_ring.buf.at_if(idx1)};
+                    mut_trace_args.online_pps = bsl::safe_u16::magic_1().get();
+                    mut_trace_args.trace_ring.epos = epos.get();
+                    pmut_rec0->tsc = tsc0.get();
+                    pmut_rec0->probe = loader::TRACE_PROBE_CALL_EXT.get();
+                    pmut_rec1->tsc = tsc1.get();
+                    pmut_rec1->probe = loader::TRACE_PROBE_VMEXIT.get();
+                    bsl::ut_required_step(mut_ioctl.write(loader::DUMP_TRACE, &mut_trace_args));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vmmctl.process(mut_args, mut_ioctl));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"trace tsc goes backwards"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"trace"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                loader::dump_trace_args_t mut_trace_args{};
+                constexpr auto epos{2_u64};
+                constexpr auto tsc0{20_u64};
+                constexpr auto tsc1{10_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto *const pmut_rec0{mut_trace_args.trace_ring.buf.at_if(idx0)};
+                    auto *const pmut_rec1{mut_trace_args.trace_ring.buf.at_if(idx1)};
+                    mut_trace_args.online_pps = bsl::safe_u16::magic_1().get();
+                    mut_trace_args.trace_ring.epos = epos.get();
+                    pmut_rec0->tsc = tsc0.get();
+                    pmut_rec1->tsc = tsc1.get();
+                    bsl::ut_required_step(mut_ioctl.write(loader::DUMP_TRACE, &mut_trace_args));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vmmctl.process(mut_args, mut_ioctl));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"trace invalid probe"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"trace"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                loader::dump_trace_args_t mut_trace_args{};
+                constexpr auto epos{1_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto *const pmut_rec0{mut_trace_args.trace_ring.buf.at_if(idx0)};
+                    mut_trace_args.online_pps = bsl::safe_u16::magic_1().get();
+                    mut_trace_args.trace_ring.epos = epos.get();
+                    pmut_rec0->probe = loader::TRACE_PROBE_MAX.get();
+                    bsl::ut_required_step(mut_ioctl.write(loader::DUMP_TRACE, &mut_trace_args));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"nothing to trace"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"trace"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                loader::dump_trace_args_t mut_trace_args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_trace_args.online_pps = bsl::safe_u16::magic_1().get();
+                    bsl::ut_required_step(mut_ioctl.write(loader::DUMP_TRACE, &mut_trace_args));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vmmctl.process(mut_args, mut_ioctl));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"trace fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"failure"};
+                bsl::array const argv{"trace"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }